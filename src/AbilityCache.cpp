@@ -0,0 +1,94 @@
+#include "AbilityCache.h"
+#include "CCBot.h"
+#include "Util.h"
+
+const uint32_t ABILITY_CACHE_KEEP_UNIT_FRAMES = 24;	// a unit stays in the batch for 1 second after its last request
+
+AbilityCache::AbilityCache(CCBot & bot)
+	: m_bot(bot)
+	, m_requestCount(0)
+	, m_queryCount(0)
+	, m_lastFrameRequestCount(0)
+	, m_lastFrameQueryCount(0)
+	, m_totalSavedQueries(0)
+{
+}
+
+void AbilityCache::onFrame()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_lastFrameRequestCount = m_requestCount;
+	m_lastFrameQueryCount = m_queryCount;
+	m_totalSavedQueries += m_requestCount - m_queryCount;
+	m_requestCount = 0;
+	m_queryCount = 0;
+	m_abilities.clear();
+
+	const uint32_t currentFrame = m_bot.GetCurrentFrame();
+	sc2::Units units;
+	for (auto it = m_lastRequestFrame.begin(); it != m_lastRequestFrame.end();)
+	{
+		const auto unit = m_bot.GetUnitPtr(it->first);
+		if (!unit || !unit->is_alive || currentFrame - it->second > ABILITY_CACHE_KEEP_UNIT_FRAMES)
+		{
+			it = m_lastRequestFrame.erase(it);
+			continue;
+		}
+		units.push_back(unit);
+		++it;
+	}
+
+	query(units);
+}
+
+void AbilityCache::prefetch(const sc2::Units & units)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	const uint32_t currentFrame = m_bot.GetCurrentFrame();
+	sc2::Units missingUnits;
+	m_requestCount += units.size();
+	for (const auto unit : units)
+	{
+		m_lastRequestFrame[unit->tag] = currentFrame;
+		if (m_abilities.find(unit->tag) == m_abilities.end())
+			missingUnits.push_back(unit);
+	}
+
+	query(missingUnits);
+}
+
+const sc2::AvailableAbilities & AbilityCache::getAbilities(const sc2::Unit * unit)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	++m_requestCount;
+	m_lastRequestFrame[unit->tag] = m_bot.GetCurrentFrame();
+	auto it = m_abilities.find(unit->tag);
+	if (it == m_abilities.end())
+	{
+		// The unit was not part of the batch, query it alone. It will be part of the batch next frame.
+		++m_queryCount;
+		it = m_abilities.insert({ unit->tag, m_bot.Query()->GetAbilitiesForUnit(unit) }).first;
+	}
+	return it->second;
+}
+
+bool AbilityCache::isAbilityAvailable(const sc2::Unit * unit, sc2::ABILITY_ID abilityId)
+{
+	return Util::IsAbilityAvailable(abilityId, getAbilities(unit));
+}
+
+// Must be called with the mutex locked
+void AbilityCache::query(const sc2::Units & units)
+{
+	if (units.empty())
+		return;
+
+	++m_queryCount;
+	for (auto & availableAbilities : m_bot.Query()->GetAbilitiesForUnits(units))
+	{
+		m_abilities[availableAbilities.unit_tag] = std::move(availableAbilities);
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Common.h"
+#include <mutex>
+#include <unordered_map>
+
+class CCBot;
+
+/*
+ * Frame-scoped snapshot of the available abilities of our units.
+ * Every unit that asked for its abilities in the last few frames is queried in a single
+ * batched GetAbilitiesForUnits call at the start of the frame, then every caller is served from that snapshot.
+ * A unit missing from the snapshot falls back to a single query and gets added to the next batch.
+ * The returned references are only valid until the next call to onFrame.
+ */
+class AbilityCache
+{
+	CCBot & m_bot;
+	std::unordered_map<sc2::Tag, sc2::AvailableAbilities> m_abilities;
+	std::unordered_map<sc2::Tag, uint32_t> m_lastRequestFrame;
+	std::mutex m_mutex;
+	int m_requestCount;				// number of times the abilities of a unit were asked this frame
+	int m_queryCount;				// number of queries sent to the game this frame
+	int m_lastFrameRequestCount;
+	int m_lastFrameQueryCount;
+	long long m_totalSavedQueries;
+
+	void query(const sc2::Units & units);
+
+public:
+	AbilityCache(CCBot & bot);
+
+	void onFrame();
+	void prefetch(const sc2::Units & units);
+	const sc2::AvailableAbilities & getAbilities(const sc2::Unit * unit);
+	bool isAbilityAvailable(const sc2::Unit * unit, sc2::ABILITY_ID abilityId);
+	int getLastFrameRequestCount() const { return m_lastFrameRequestCount; }
+	int getLastFrameQueryCount() const { return m_lastFrameQueryCount; }
+	int getLastFrameSavedQueries() const { return m_lastFrameRequestCount - m_lastFrameQueryCount; }
+	long long getTotalSavedQueries() const { return m_totalSavedQueries; }
+};
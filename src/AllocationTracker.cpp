@@ -0,0 +1,99 @@
+#include "AllocationTracker.h"
+#include <cstdlib>
+#include <new>
+
+#ifdef TRACK_ALLOCATIONS
+
+namespace
+{
+	// Plain integers so that they are usable before any constructor runs, operator new can be called very early
+	thread_local uint64_t threadAllocations = 0;
+	thread_local uint64_t threadAllocatedBytes = 0;
+
+	void * TrackedAllocate(std::size_t size)
+	{
+		++threadAllocations;
+		threadAllocatedBytes += size;
+		return std::malloc(size > 0 ? size : 1);
+	}
+}
+
+void * operator new(std::size_t size)
+{
+	void * ptr = TrackedAllocate(size);
+	if (!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void * operator new[](std::size_t size)
+{
+	void * ptr = TrackedAllocate(size);
+	if (!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void * operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	return TrackedAllocate(size);
+}
+
+void * operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	return TrackedAllocate(size);
+}
+
+void operator delete(void * ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void * ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void * ptr, const std::nothrow_t &) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void * ptr, const std::nothrow_t &) noexcept
+{
+	std::free(ptr);
+}
+
+bool AllocationTracker::IsEnabled()
+{
+	return true;
+}
+
+AllocationTracker::Counters AllocationTracker::GetThreadCounters()
+{
+	return Counters(threadAllocations, threadAllocatedBytes);
+}
+
+#else
+
+bool AllocationTracker::IsEnabled()
+{
+	return false;
+}
+
+AllocationTracker::Counters AllocationTracker::GetThreadCounters()
+{
+	return Counters();
+}
+
+#endif
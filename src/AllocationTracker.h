@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+/*
+ * Opt-in counting of the heap allocations, to find the code that allocates every frame.
+ * When the bot is built with TRACK_ALLOCATIONS (the MICROMACHINE_TRACK_ALLOCATIONS CMake option), the global
+ * operator new is replaced by one that counts the allocations of the calling thread. The profiler reads these
+ * counters in StartProfiling and StopProfiling to attribute the allocations to the profiled zones.
+ * Without the flag, the counters always stay at zero and nothing is replaced.
+ */
+namespace AllocationTracker
+{
+	struct Counters
+	{
+		uint64_t allocations;
+		uint64_t bytes;
+
+		Counters() : allocations(0), bytes(0) {}
+		Counters(uint64_t allocations, uint64_t bytes) : allocations(allocations), bytes(bytes) {}
+		Counters operator-(const Counters & rhs) const { return Counters(allocations - rhs.allocations, bytes - rhs.bytes); }
+		Counters & operator+=(const Counters & rhs) { allocations += rhs.allocations; bytes += rhs.bytes; return *this; }
+		Counters & operator-=(const Counters & rhs) { allocations -= rhs.allocations; bytes -= rhs.bytes; return *this; }
+	};
+
+	bool IsEnabled();
+
+	// Allocations made by the calling thread since it started
+	Counters GetThreadCounters();
+}
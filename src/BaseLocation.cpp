@@ -43,18 +43,11 @@ BaseLocation::BaseLocation(CCBot & bot, int baseID, const std::vector<Unit> & re
             resourceCenterX += resource.getPosition().x;
             resourceCenterY += resource.getPosition().y;
         }
-
-        // set the limits of the base location bounding box
-        CCPositionType resWidth = Util::TileToPosition(1);
-        CCPositionType resHeight = Util::TileToPosition(0.5);
-
-        m_left   = std::min(m_left,   resource.getPosition().x - resWidth);
-        m_right  = std::max(m_right,  resource.getPosition().x + resWidth);
-        m_top    = std::max(m_top,    resource.getPosition().y + resHeight);
-        m_bottom = std::min(m_bottom, resource.getPosition().y - resHeight);
     }
 
-    m_centerOfResources = CCPosition(m_left + (m_right-m_left)/2, m_top + (m_bottom-m_top)/2);
+    // set the limits of the base location bounding box
+    GetBoundsOfResources(resources, m_left, m_right, m_top, m_bottom);
+    m_centerOfResources = GetCenterOfResources(resources);
 
 	for (auto & mineral : m_minerals)
 	{
@@ -348,6 +341,30 @@ const std::vector<CCTilePosition> & BaseLocation::getClosestTiles() const
     return m_distanceMap.getSortedTiles();
 }
 
+void BaseLocation::GetBoundsOfResources(const std::vector<Unit> & resources, CCPositionType & left, CCPositionType & right, CCPositionType & top, CCPositionType & bottom)
+{
+    left = std::numeric_limits<CCPositionType>::max();
+    right = std::numeric_limits<CCPositionType>::lowest();
+    top = std::numeric_limits<CCPositionType>::lowest();
+    bottom = std::numeric_limits<CCPositionType>::max();
+    const CCPositionType resWidth = Util::TileToPosition(1);
+    const CCPositionType resHeight = Util::TileToPosition(0.5);
+    for (auto & resource : resources)
+    {
+        left   = std::min(left,   resource.getPosition().x - resWidth);
+        right  = std::max(right,  resource.getPosition().x + resWidth);
+        top    = std::max(top,    resource.getPosition().y + resHeight);
+        bottom = std::min(bottom, resource.getPosition().y - resHeight);
+    }
+}
+
+CCPosition BaseLocation::GetCenterOfResources(const std::vector<Unit> & resources)
+{
+    CCPositionType left, right, top, bottom;
+    GetBoundsOfResources(resources, left, right, top, bottom);
+    return CCPosition(left + (right-left)/2, top + (bottom-top)/2);
+}
+
 const bool & BaseLocation::isGeyserSplit() const
 {
 	return m_isSplitGeyser;
@@ -80,5 +80,10 @@ public:
     const std::vector<CCTilePosition> & getClosestTiles() const;
 	const bool & isGeyserSplit() const;
 
+	// bounding box of the resources, a mineral field is 2x1 tiles
+	static void GetBoundsOfResources(const std::vector<Unit> & resources, CCPositionType & left, CCPositionType & right, CCPositionType & top, CCPositionType & bottom);
+	// center of the bounding box of the resources, where the distance map of the base location starts
+	static CCPosition GetCenterOfResources(const std::vector<Unit> & resources);
+
     void draw();
 };
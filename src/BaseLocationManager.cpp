@@ -12,7 +12,7 @@ BaseLocationManager::BaseLocationManager(CCBot & bot)
 
 void BaseLocationManager::onStart()
 {
-    m_tileBaseLocations = std::vector<std::vector<BaseLocation *>>(m_bot.Map().totalWidth(), std::vector<BaseLocation *>(m_bot.Map().totalHeight(), nullptr));
+    m_tileBaseLocations = GridPlane<BaseLocation *>(m_bot.Map().totalWidth(), m_bot.Map().totalHeight(), nullptr);
     m_playerStartingBaseLocations[Players::Self]  = nullptr;
     m_playerStartingBaseLocations[Players::Enemy] = nullptr;
     
@@ -21,18 +21,7 @@ void BaseLocationManager::onStart()
     const CCPositionType maxClusterDistanceSq = Util::TileToPosition(12*12);//Can't be lower than 12 or some minerals/geysers will not be detected as part of a cluster.
 
 	//Initialize resource proximity map
-	const size_t mapWidth = m_bot.Map().totalWidth();
-	const size_t mapHeight = m_bot.Map().totalHeight();
-	m_resourceProximity.resize(mapWidth);
-	for (size_t x = 0; x < mapWidth; ++x)
-	{
-		auto& m_resourceProximityRow = m_resourceProximity[x];
-		m_resourceProximityRow.resize(mapHeight);
-		for (size_t y = 0; y < mapHeight; ++y)
-		{
-			m_resourceProximityRow[y] = false;
-		}
-	}
+	m_resourceProximity = TileBitmask(m_bot.Map().totalWidth(), m_bot.Map().totalHeight());
     
     // stores each cluster of resources based on some ground distance
     std::vector<std::vector<Unit>> resourceClusters;
@@ -61,7 +50,7 @@ void BaseLocationManager::onStart()
 					{
 						continue;
 					}
-					m_resourceProximity[i][j] = true;
+					m_resourceProximity.set(i, j);
 				}
 			}
 		}
@@ -92,7 +81,7 @@ void BaseLocationManager::onStart()
 				{
 					continue;
 				}
-				m_resourceProximity[i][j] = true;
+				m_resourceProximity.set(i, j);
 			}
 		}
 
@@ -103,8 +92,9 @@ void BaseLocationManager::onStart()
 	m_bot.Commander().Combat().initInfluenceMaps();
 	m_bot.Commander().Combat().updateBlockedTilesWithNeutral();
 
-	// add the base locations if there are more than 6 resouces in the cluster
-    int baseID = 0;
+	// keep the clusters with more than 6 resouces and a geyser
+	std::vector<const std::vector<Unit> *> baseClusters;
+	std::vector<CCTilePosition> baseCenters;
     for (auto & cluster : resourceClusters)
     {
         if (cluster.size() > 6)
@@ -119,10 +109,23 @@ void BaseLocationManager::onStart()
 				}
 			}
         	if (hasGeyser)
-				m_baseLocationData.push_back(BaseLocation(m_bot, baseID++, cluster));
+			{
+				baseClusters.push_back(&cluster);
+				baseCenters.push_back(Util::GetTilePosition(BaseLocation::GetCenterOfResources(cluster)));
+			}
         }
     }
 
+	// the distance maps of the base locations are independent, compute them all at once before creating the base locations
+	m_bot.Map().computeDistanceMaps(baseCenters);
+
+	// add the base locations
+    int baseID = 0;
+	for (auto cluster : baseClusters)
+	{
+		m_baseLocationData.push_back(BaseLocation(m_bot, baseID++, *cluster));
+	}
+
     // construct the vectors of base location pointers, this is safe since they will never change
     for (auto & baseLocation : m_baseLocationData)
     {
@@ -175,7 +178,7 @@ void BaseLocationManager::onStart()
 				//Fix for a missing tile for the base position. Doesn't modify minDistance, to keep the original logic, but still have the missing tile included.
 				if (groundDistance == 0)
 				{
-					m_tileBaseLocations[x][y] = &base;
+					m_tileBaseLocations(x, y) = &base;
 					continue;
 				}
 
@@ -190,7 +193,7 @@ void BaseLocationManager::onStart()
 				if (minDistance == 0.f || groundDistanceSq < minDistance)
 				{
 					minDistance = groundDistanceSq;//to be able to use DistSq above
-					m_tileBaseLocations[x][y] = &base;
+					m_tileBaseLocations(x, y) = &base;
 				}
 			}
         }
@@ -201,6 +204,12 @@ void BaseLocationManager::onStart()
     m_occupiedBaseLocations[Players::Enemy] = std::set<BaseLocation *>();
 }
 
+// The distance maps of the bases are computed at the start of the game, so this is a constant time lookup
+int BaseLocationManager::getGroundDistance(const BaseLocation * from, const BaseLocation * to) const
+{
+	return from->getGroundDistance(to->getDepotTilePosition());
+}
+
 bool BaseLocationManager::affectToCluster(std::vector<std::vector<Unit>> & resourceClusters, Unit & resource, float maxDistanceWithCluster) const
 {
 	bool foundCluster = false;
@@ -399,9 +408,9 @@ BaseLocation * BaseLocationManager::getBaseLocation(const CCPosition & pos) cons
     if (!m_bot.Map().isValidPosition(pos)) { return nullptr; }
 
 #ifdef SC2API
-    return m_tileBaseLocations[(int)pos.x][(int)pos.y];
+    return m_tileBaseLocations((int)pos.x, (int)pos.y);
 #else
-    return m_tileBaseLocations[pos.x / 32][pos.y / 32];
+    return m_tileBaseLocations(pos.x / 32, pos.y / 32);
 #endif
 }
 
@@ -434,12 +443,11 @@ void BaseLocationManager::drawTileBaseLocationAssociations() const
 		return;
 	}
 
-	for (size_t x = 0; x < m_tileBaseLocations.size(); ++x)
+	for (int y = 0; y < m_tileBaseLocations.height(); ++y)
 	{
-		const auto & xRow = m_tileBaseLocations.at(x);
-		for (size_t y = 0; y < xRow.size(); ++y)
+		for (int x = 0; x < m_tileBaseLocations.width(); ++x)
 		{
-			const auto baseLocation = xRow[y];
+			const auto baseLocation = m_tileBaseLocations(x, y);
 			if (baseLocation)
 			{
 				m_bot.Map().drawTile(x, y, CCColor(255, 255, 255));
@@ -463,11 +471,11 @@ void BaseLocationManager::drawResourceProxity()
 
 	const size_t mapWidth = m_bot.Map().totalWidth();
 	const size_t mapHeight = m_bot.Map().totalHeight();
-	for (int x = 0; x < mapWidth - 1; x++)
+	for (int y = 0; y < mapHeight - 1; y++)
 	{
-		for (int y = 0; y < mapHeight - 1; y++)
+		for (int x = 0; x < mapWidth - 1; x++)
 		{
-			if (m_resourceProximity[x][y])
+			if (m_resourceProximity.get(x, y))
 			{
 				m_bot.Map().drawTile(x, y, CCColor(255, 255, 255));
 			}
@@ -533,7 +541,9 @@ BaseLocation * BaseLocationManager::getClosestOccupiedBaseLocationForUnit(const
 	float minDistance = 0.f;
 	for (auto baseLocation : getOccupiedBaseLocations(unit.getPlayer()))
 	{
-		const float distance = Util::DistSq(unit, baseLocation->getPosition());
+		// the distance maps of the bases give the ground distance of any tile in constant time
+		const int groundDistance = unit.isFlying() ? -1 : baseLocation->getGroundDistance(unit.getPosition());
+		const float distance = groundDistance >= 0 ? groundDistance : Util::Dist(unit, baseLocation->getPosition());
 		if (!closestBase || distance < minDistance)
 		{
 			closestBase = baseLocation;
@@ -553,7 +563,7 @@ BaseLocation * BaseLocationManager::getFarthestOccupiedBaseLocation() const
 	{
 		if (!baseLocation->getResourceDepot().isValid())
 			continue;
-		const auto distance = baseLocation->getGroundDistance(enemyLocation);
+		const auto distance = enemyBaseLocation ? getGroundDistance(baseLocation, enemyBaseLocation) : baseLocation->getGroundDistance(enemyLocation);
 		if (!closestBase || distance < minDistance)
 		{
 			closestBase = baseLocation;
@@ -634,7 +644,7 @@ BaseLocation* BaseLocationManager::getNextExpansion(int player, bool checkBlocke
 		}
 
 		// the base's distance from our main nexus
-		int distanceFromHome = homeBase->getGroundDistance(tile);
+		int distanceFromHome = getGroundDistance(homeBase, base);
 
 		// if it is not connected, continue
 		if (distanceFromHome < 0)
@@ -645,7 +655,7 @@ BaseLocation* BaseLocationManager::getNextExpansion(int player, bool checkBlocke
 		int distanceFromEnemyHome = 0;
 		if (enemyHomeBase != nullptr)
 		{
-			distanceFromEnemyHome = enemyHomeBase->getGroundDistance(tile);
+			distanceFromEnemyHome = getGroundDistance(enemyHomeBase, base);
 
 			// if it is not connected, ignore
 			if (distanceFromEnemyHome < 0)
@@ -685,20 +695,20 @@ CCTilePosition BaseLocationManager::getBasePosition(int player, int index) const
 
 BaseLocation* BaseLocationManager::getClosestBase(const CCPosition position, bool checkContains) const
 {
-	BaseLocation* closestBase;
+	BaseLocation* closestBase = nullptr;
 	float minDistance = 0.f;
-	for (auto base : m_baseLocationData)
+	for (auto & base : m_baseLocationPtrs)
 	{
-		if (checkContains && !base.containsPosition(position))
+		if (checkContains && !base->containsPosition(position))
 		{
 			continue;
 		}
 
-		const float dist = base.getGroundDistance(position);
+		const float dist = base->getGroundDistance(position);
 		if (minDistance == 0.f || dist < minDistance)
 		{
 			minDistance = dist;
-			closestBase = &base;
+			closestBase = base;
 		}
 	}
 	return closestBase;
@@ -821,7 +831,7 @@ void BaseLocationManager::sortBaseLocationPtrs()
 
 bool BaseLocationManager::isInProximityOfResources(int x, int y) const
 {
-	return m_resourceProximity[x][y];
+	return m_resourceProximity.get(x, y);
 }
 
 int BaseLocationManager::getAccessibleMineralFieldCount() const
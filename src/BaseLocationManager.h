@@ -1,6 +1,7 @@
 #pragma once
 
 #include "BaseLocation.h"
+#include "MapGrid.h"
 
 class CCBot;
 
@@ -14,8 +15,8 @@ class BaseLocationManager
     std::vector<const BaseLocation *>               m_startingBaseLocations;
     std::map<int, const BaseLocation *>             m_playerStartingBaseLocations;
     std::map<int, std::set<BaseLocation *>>			m_occupiedBaseLocations;
-    std::vector<std::vector<BaseLocation *>>        m_tileBaseLocations;
-	std::vector<std::vector<bool>>					m_resourceProximity;
+    GridPlane<BaseLocation *>                       m_tileBaseLocations;
+	TileBitmask										m_resourceProximity;
 
 	const int NearBaseLocationTileDistance = 38;
 	const float TerrainHeightCostMultiplier = 5.f;
@@ -56,4 +57,5 @@ public:
 	const BaseLocation* getBaseContainingPosition(const CCPosition position, int player) const;
 	bool isInProximityOfResources(int x, int y) const;
 	int getAccessibleMineralFieldCount() const;
+	int getGroundDistance(const BaseLocation * from, const BaseLocation * to) const;
 };
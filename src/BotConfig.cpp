@@ -37,6 +37,7 @@ BotConfig::BotConfig()
     DrawReservedBuildingTiles = false;
     DrawBuildingInfo = false;
 	DrawStartingRamp = false;
+	DrawRegions = false;
 	DrawWall = false;
     DrawEnemyUnitInfo = false;
     DrawUnitTargetInfo = false;
@@ -46,6 +47,9 @@ BotConfig::BotConfig()
 	DrawMemoryInfo = false;
 	DrawUnitID = false;
 	DrawProfilingInfo = false;
+	ProfileAllocations = false;
+	DebugDrawMaxPrimitives = 3000;
+	DebugDrawCoalesceTiles = true;
 	DrawInfluenceMaps = false;
 	DrawBlockedTiles = false;
 	DrawRepairStation = false;
@@ -59,6 +63,10 @@ BotConfig::BotConfig()
     ScoutHarassEnemy = true;
     MaxTargetDistance = 25.0f;
     MaxWorkerRepairDistance = 20.0f;
+	PipelinedFrames = false;
+	PipelineMaxStaleSteps = 2;
+	AsyncCombatSimulation = false;
+	CombatSimulationQueueSize = 8;
 
     ColorLineTarget = CCColor(255, 255, 255);
     ColorLineMineral = CCColor(0, 128, 128);
@@ -127,6 +135,10 @@ void BotConfig::readConfigFile()
         JSONTools::ReadBool("WeakestEnemy", micro, WeakestEnemy);
 		JSONTools::ReadBool("HighestPriority", micro, HighestPriority);
 		JSONTools::ReadBool("EnableMultiThreading", micro, EnableMultiThreading);
+		JSONTools::ReadBool("PipelinedFrames", micro, PipelinedFrames);
+		JSONTools::ReadInt("PipelineMaxStaleSteps", micro, PipelineMaxStaleSteps);
+		JSONTools::ReadBool("AsyncCombatSimulation", micro, AsyncCombatSimulation);
+		JSONTools::ReadInt("CombatSimulationQueueSize", micro, CombatSimulationQueueSize);
 		JSONTools::ReadBool("TournamentMode", micro, TournamentMode);
 		JSONTools::ReadString("StarCraft2Version", micro, StarCraft2Version);
     }
@@ -194,6 +206,7 @@ void BotConfig::readConfigFile()
 			JSONTools::ReadBool("DrawBaseLocationInfo", debug, DrawBaseLocationInfo);
 			JSONTools::ReadBool("DrawBaseTiles", debug, DrawBaseTiles);
 			JSONTools::ReadBool("DrawStartingRamp", debug, DrawStartingRamp);
+			JSONTools::ReadBool("DrawRegions", debug, DrawRegions);
 			JSONTools::ReadBool("DrawWall", debug, DrawWall);
 			JSONTools::ReadBool("DrawWalkableSectors", debug, DrawWalkableSectors);
 			JSONTools::ReadBool("DrawBuildableSectors", debug, DrawBuildableSectors);
@@ -213,6 +226,7 @@ void BotConfig::readConfigFile()
 			JSONTools::ReadBool("DrawMemoryInfo", debug, DrawMemoryInfo);
 			JSONTools::ReadBool("DrawUnitID", debug, DrawUnitID);
 			JSONTools::ReadBool("DrawProfilingInfo", debug, DrawProfilingInfo);
+			JSONTools::ReadBool("ProfileAllocations", debug, ProfileAllocations);
 			JSONTools::ReadBool("DrawInfluenceMaps", debug, DrawInfluenceMaps);
 			JSONTools::ReadBool("DrawBlockedTiles", debug, DrawBlockedTiles);
 			JSONTools::ReadBool("DrawRepairStation", debug, DrawRepairStation);
@@ -221,6 +235,16 @@ void BotConfig::readConfigFile()
 			JSONTools::ReadBool("DrawResourcesProximity", debug, DrawResourcesProximity);
 			JSONTools::ReadBool("DrawCombatInformation", debug, DrawCombatInformation);
 			JSONTools::ReadBool("DrawPathfindingTiles", debug, DrawPathfindingTiles);
+			JSONTools::ReadInt("DebugDrawMaxPrimitives", debug, DebugDrawMaxPrimitives);
+			JSONTools::ReadBool("DebugDrawCoalesceTiles", debug, DebugDrawCoalesceTiles);
+			if (debug.count("DebugDrawCategories") && debug["DebugDrawCategories"].is_array())
+			{
+				for (auto & category : debug["DebugDrawCategories"])
+				{
+					BOT_ASSERT(category.is_string(), "DebugDrawCategories should only contain strings");
+					DebugDrawCategories.push_back(category.get<std::string>());
+				}
+			}
 			JSONTools::ReadBool("TimeControl", debug, TimeControl);
 		}
     }
@@ -49,6 +49,7 @@ public:
     bool DrawReservedBuildingTiles;
     bool DrawBuildingInfo;
 	bool DrawStartingRamp;
+	bool DrawRegions;
 	bool DrawWall;
     bool DrawEnemyUnitInfo;
     bool DrawUnitTargetInfo;
@@ -58,6 +59,7 @@ public:
 	bool DrawMemoryInfo;
 	bool DrawUnitID;
 	bool DrawProfilingInfo;
+	bool ProfileAllocations;
 	bool DrawInfluenceMaps;
 	bool DrawBlockedTiles;
 	bool DrawRepairStation;
@@ -66,6 +68,9 @@ public:
 	bool DrawResourcesProximity;
 	bool DrawCombatInformation;
 	bool DrawPathfindingTiles;
+	std::vector<std::string> DebugDrawCategories;	// empty means every category is drawn
+	int DebugDrawMaxPrimitives;
+	bool DebugDrawCoalesceTiles;
 	bool TimeControl;
 	bool PrintGreetingMessage;
 	bool RandomProxyLocation;
@@ -98,6 +103,10 @@ public:
     bool WeakestEnemy;
     bool HighestPriority;
 	bool EnableMultiThreading;
+	bool PipelinedFrames;
+	int PipelineMaxStaleSteps;
+	bool AsyncCombatSimulation;
+	int CombatSimulationQueueSize;
 	bool TournamentMode;
 	std::string StarCraft2Version;
     
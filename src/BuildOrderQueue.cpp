@@ -9,13 +9,27 @@ BuildOrderQueue::BuildOrderQueue(CCBot & bot)
     , m_defaultPrioritySpacing(10)
     , m_numSkippedItems(0)
 {
+    m_queuedTechTypeCounts.fill(0);
+}
 
+// Keeps the tech types of the queued units up to date for ProductionManager, it mirrors contains
+void BuildOrderQueue::updateQueuedTechType(const MetaType & type, int delta)
+{
+    if (!type.isUnit())
+        return;
+    const int index = m_bot.Tech().getTechTypeIndex(type.getUnitType());
+    if (index <= 0)
+        return;
+    m_queuedTechTypeCounts[index] += delta;
+    m_queuedTechTypes.set(index, m_queuedTechTypeCounts[index] > 0);
 }
 
 void BuildOrderQueue::clearAll()
 {
     // clear the queue
     m_queue.clear();
+    m_queuedTechTypeCounts.fill(0);
+    m_queuedTechTypes.reset();
 
     // reset the priorities
     m_highestPriority = 0;
@@ -96,6 +110,7 @@ BuildOrderItem BuildOrderQueue::queueItem(const BuildOrderItem & b)
     {
         m_queue.push_back(b);
     }
+    updateQueuedTechType(b.type, 1);
 
     // if the item is somewhere in the middle, we have to sort again
     if ((m_queue.size() > 1) && (b.priority < m_highestPriority) && (b.priority > m_lowestPriority))
@@ -138,6 +153,7 @@ BuildOrderItem BuildOrderQueue::queueAsLowestPriority(const MetaType & type, boo
 void BuildOrderQueue::removeHighestPriorityItem()
 {
     // remove the back element of the vector
+    updateQueuedTechType(m_queue.back().type, -1);
     m_queue.pop_back();
 
     // if the list is not empty, set the highest accordingly
@@ -148,7 +164,9 @@ void BuildOrderQueue::removeHighestPriorityItem()
 void BuildOrderQueue::removeCurrentHighestPriorityItem()
 {
     // remove the back element of the vector
-    m_queue.erase(m_queue.begin() + m_queue.size() - 1 - m_numSkippedItems);
+    const auto it = m_queue.begin() + m_queue.size() - 1 - m_numSkippedItems;
+    updateQueuedTechType(it->type, -1);
+    m_queue.erase(it);
 
     //assert((int)(queue.size()) < size);
 
@@ -169,6 +187,7 @@ void BuildOrderQueue::removeAllOfType(const MetaType & type)
 	}
 	for(int index : stack)
 	{
+		updateQueuedTechType(m_queue[index].type, -1);
 		m_queue.erase(m_queue.begin() + index);
 	}
 }
@@ -2,6 +2,8 @@
 
 #include "Common.h"
 #include "MetaType.h"
+#include "TechTree.h"
+#include <array>
 
 class CCBot;
 
@@ -29,6 +31,10 @@ class BuildOrderQueue
     int m_highestPriority;
     int m_defaultPrioritySpacing;
     int m_numSkippedItems;
+    std::array<int, MaxTechTypes> m_queuedTechTypeCounts;	// number of queued items per tech type
+    TechMask m_queuedTechTypes;
+
+    void updateQueuedTechType(const MetaType & type, int delta);
 
 public:
 
@@ -53,6 +59,7 @@ public:
     bool canSkipItem();
     std::string getQueueInformation() const;
 	bool contains(const MetaType & type) const;
+	const TechMask & getQueuedTechTypes() const { return m_queuedTechTypes; }
 
     // overload the bracket operator for ease of use
     BuildOrderItem operator [] (int i);
@@ -3,13 +3,14 @@
 #include "BuildingManager.h"
 #include "CCBot.h"
 #include "Util.h"
+#include "WallSolver.h"
 
 BuildingManager::BuildingManager(CCBot & bot)
     : m_bot(bot)
     , m_buildingPlacer(bot)
     , m_debugMode(false)
 {
-
+	m_techTypesBeingBuiltCounts.fill(0);
 }
 
 void BuildingManager::onStart()
@@ -22,12 +23,8 @@ void BuildingManager::onFirstFrame()
 	//if (m_bot.GetPlayerRace(Players::Enemy) != sc2::Race::Protoss)
 	{
 		//Ramp wall location
-		std::list<CCTilePosition> checkedTiles;
-		FindRampTiles(m_rampTiles, checkedTiles, m_bot.Bases().getPlayerStartingBaseLocation(Players::Self)->getDepotTilePosition());
-		FindMainRamp(m_rampTiles);
-
-		auto tilesToBlock = FindRampTilesToPlaceBuilding(m_rampTiles);
-		PlaceWallBuildings(tilesToBlock);
+		FindMainRampTiles(Players::Self, m_rampTiles);
+		PlaceWallBuildings();
 	}
 }
 
@@ -121,339 +118,171 @@ void BuildingManager::lowPriorityChecks()
 	removeBuildings(toRemove);
 }
 
-void BuildingManager::FindRampTiles(std::list<CCTilePosition> &rampTiles, std::list<CCTilePosition> &checkedTiles, CCTilePosition currentTile)
+// Tiles of the main ramp of the player that touch the buildable tiles of its main region, they are the ones the wall has to block
+void BuildingManager::FindMainRampTiles(int player, std::list<CCTilePosition> &rampTiles) const
 {
-	if (std::find(checkedTiles.begin(), checkedTiles.end(), currentTile) != checkedTiles.end())
+	const auto mainRegion = m_bot.Regions().getMainRegion(player);
+	const auto mainRamp = m_bot.Regions().getMainRamp(player);
+	if (!mainRegion || !mainRamp)
 	{
 		return;
 	}
 
-	checkedTiles.push_front(currentTile);
-	if (m_bot.Map().isWalkable(currentTile))
+	for (const auto & tile : mainRamp->tiles)
 	{
-		if (m_bot.Map().isBuildable(currentTile))
-		{
-			FindRampTiles(rampTiles, checkedTiles, CCTilePosition(currentTile.x + 1, currentTile.y));
-			FindRampTiles(rampTiles, checkedTiles, CCTilePosition(currentTile.x - 1, currentTile.y));
-			FindRampTiles(rampTiles, checkedTiles, CCTilePosition(currentTile.x, currentTile.y + 1));
-			FindRampTiles(rampTiles, checkedTiles, CCTilePosition(currentTile.x, currentTile.y - 1));
-		}
-		else
+		auto touchesMainRegion = false;
+		for (const auto & neighborTile : { CCTilePosition(tile.x + 1, tile.y), CCTilePosition(tile.x - 1, tile.y), CCTilePosition(tile.x, tile.y + 1), CCTilePosition(tile.x, tile.y - 1) })
 		{
-			const auto tileHeight = m_bot.Map().terrainHeight(currentTile.x, currentTile.y);
-			auto slightlyLowerDiagonalNeighbors = 0;
-			auto slightlyLowerAdjacentNeighbors = 0;
-			for (int x = -1; x <= 1; ++x)
+			if (m_bot.Regions().getRegionId(neighborTile.x, neighborTile.y) == mainRegion->id && m_bot.Map().isBuildable(neighborTile))
 			{
-				for (int y = -1; y <= 1; ++y)
-				{
-					if (x == 0 && y == 0)
-						continue;
-					const auto neighborTile = CCTilePosition(currentTile.x + x, currentTile.y + y);
-					if (!m_bot.Map().isWalkable(neighborTile))
-						continue;
-					const auto neighborHeightDiff = tileHeight - m_bot.Map().terrainHeight(neighborTile);
-					if(neighborHeightDiff >= 0.24f && neighborHeightDiff <= 0.26f || neighborHeightDiff >= 1.99f && neighborHeightDiff <= 2.01f)
-					{
-						const auto diagonal = x != 0 && y != 0;
-						if (diagonal)
-							++slightlyLowerDiagonalNeighbors;
-						else
-							++slightlyLowerAdjacentNeighbors;
-					}
-				}
-			}
-			if (slightlyLowerDiagonalNeighbors == 1 || slightlyLowerAdjacentNeighbors == 2)
-			{
-				rampTiles.push_back(currentTile);
+				touchesMainRegion = true;
+				break;
 			}
 		}
-	}
-}
-
-void BuildingManager::FindMainRamp(std::list<CCTilePosition> &rampTiles)
-{
-	int minDistance = INT_MAX;
-	CCTilePosition mainRampTile;
-	for (auto & tile : rampTiles)
-	{
-		int distance = Util::DistSq(Util::GetPosition(tile), m_bot.Map().center());
-		if (distance < minDistance)
-		{
-			minDistance = distance;
-			mainRampTile = tile;
-		}
-	}
-	std::list<CCTilePosition> mainRamp;
-	mainRamp.push_back(mainRampTile);
-	for (auto & tile : rampTiles)
-	{
-		if (tile == mainRampTile)
-		{
-			continue;
-		}
-		if (mainRampTile.x + 1 == tile.x && mainRampTile.y + 1 == tile.y)
+		if (touchesMainRegion && IsRampEdgeTile(tile))
 		{
-			mainRamp.push_back(tile);
-		}
-		else if (mainRampTile.x + 1 == tile.x && mainRampTile.y - 1 == tile.y)
-		{
-			mainRamp.push_back(tile);
-		}
-		else if (mainRampTile.x - 1 == tile.x && mainRampTile.y + 1 == tile.y)
-		{
-			mainRamp.push_back(tile);
-		}
-		else if (mainRampTile.x - 1 == tile.x && mainRampTile.y - 1 == tile.y)
-		{
-			mainRamp.push_back(tile);
+			rampTiles.push_back(tile);
 		}
 	}
 }
 
-std::vector<CCTilePosition> BuildingManager::FindRampTilesToPlaceBuilding(std::list<CCTilePosition> &rampTiles)
+bool BuildingManager::IsRampEdgeTile(const CCTilePosition & tile) const
 {
-	std::vector<CCTilePosition> tilesToBlock;
-	for (auto & tile : rampTiles)
+	const auto tileHeight = m_bot.Map().terrainHeight(tile.x, tile.y);
+	auto slightlyLowerDiagonalNeighbors = 0;
+	auto slightlyLowerAdjacentNeighbors = 0;
+	for (int x = -1; x <= 1; ++x)
 	{
-		for (int x = -1; x <= 1; ++x)
+		for (int y = -1; y <= 1; ++y)
 		{
-			for (int y = -1; y <= 1; ++y)
+			if (x == 0 && y == 0)
+				continue;
+			const auto neighborTile = CCTilePosition(tile.x + x, tile.y + y);
+			if (!m_bot.Map().isWalkable(neighborTile))
+				continue;
+			const auto neighborHeightDiff = tileHeight - m_bot.Map().terrainHeight(neighborTile);
+			if(neighborHeightDiff >= 0.24f && neighborHeightDiff <= 0.26f || neighborHeightDiff >= 1.99f && neighborHeightDiff <= 2.01f)
 			{
-				if (x == 0 && y == 0 || x != 0 && y != 0)
-					continue;	//only adjacent tiles are parsed
-				const auto neighbor = CCTilePosition(tile.x + x, tile.y + y);
-				if (m_bot.Map().isBuildable(neighbor) && m_bot.Map().isWalkable(neighbor) && m_bot.Map().terrainHeight(neighbor) >= m_bot.Map().terrainHeight(tile))
-				{
-					//we need to block this tile
-					if (std::find(tilesToBlock.begin(), tilesToBlock.end(), neighbor) == tilesToBlock.end())
-					{
-						tilesToBlock.push_back(neighbor);
-					}
-				}
+				const auto diagonal = x != 0 && y != 0;
+				if (diagonal)
+					++slightlyLowerDiagonalNeighbors;
+				else
+					++slightlyLowerAdjacentNeighbors;
 			}
 		}
 	}
-	if(tilesToBlock.size() != 3)
-	{
-		//Handle maps with multiple ramps
-
-		//Create a list of all connected tiles
-		std::map<int, std::vector<CCTilePosition>> connectedTiles;
-		for (auto & tile : tilesToBlock)
-		{
-			for (auto & tile2 : tilesToBlock)
-			{
-				if (tile == tile2)
-					continue;
-				int diff = abs(tile.x - tile2.x) + abs(tile.y - tile2.y);
-				if (diff <= 2)
-				{
-					connectedTiles[Util::ToMapKey(tile)].push_back(tile2);
-				}
-			}
-		}
-
-		//Connects connected tiles together.
-		bool hasChanges = true;
-		while (hasChanges)
-		{
-			hasChanges = false;
-
-			for (auto & connectedTile : connectedTiles)
-			{
-				for (auto & connectedTile2 : connectedTiles)
-				{
-					if (connectedTile.first == connectedTile2.first)
-						continue;
-
-					//If the connectedTiles contain this tile, add its results
-					if(std::find(connectedTile.second.begin(), connectedTile.second.end(), Util::FromCCTilePositionMapKey(connectedTile2.first)) != connectedTile.second.end())
-					{
-						for (auto & tile : connectedTile2.second)
-						{
-							//If these connected tiles do not contain this tile yet, add it
-							if (std::find(connectedTile.second.begin(), connectedTile.second.end(), tile) == connectedTile.second.end())
-							{
-								connectedTile.second.push_back(tile);
-								hasChanges = true;
-							}
-						}
-					}
-				}
-			}
-		}
+	return slightlyLowerDiagonalNeighbors == 1 || slightlyLowerAdjacentNeighbors == 2;
+}
 
-		//Check if we found a 3 wide ramp
-		bool found = false;
-		for (auto & connectedTile : connectedTiles)
-		{
-			if (connectedTile.second.size() == 3)
-			{//found the ramp
-				tilesToBlock = connectedTile.second;
-				found = true;
-				break;
-			}
-		}
-		if (!found)
-		{
-			Util::DisplayError("Unusual ramp detected, tiles to block = " + std::to_string(tilesToBlock.size()), "0x00000003", m_bot, false);
-			return {};
-		}
-	}
-	
-	int swap = 0;
-	while((abs(tilesToBlock.at(0).x - tilesToBlock.at(2).x) != 1 || abs(tilesToBlock.at(0).y - tilesToBlock.at(2).y) != 1)
-		&& swap < tilesToBlock.size() - 1)
+// Places the wall buildings at the top of the main ramp, with the barracks when it fits
+void BuildingManager::PlaceWallBuildings()
+{
+	const auto mainRegion = m_bot.Regions().getMainRegion(Players::Self);
+	const auto mainRamp = m_bot.Regions().getMainRamp(Players::Self);
+	if (!mainRegion || !mainRamp || !mainRamp->isRamp)
 	{
-		//Move front to back
-		std::rotate(tilesToBlock.begin(), tilesToBlock.begin() + 1, tilesToBlock.end());
-		swap++;
+		Util::DisplayError("Unusual ramp detected, the main region has no ramp", "0x00000003", m_bot, false);
+		return;
 	}
-	if (swap == tilesToBlock.size() - 1)
+
+	//The solver only looks at the ramp and the tiles around it
+	auto minTile = mainRamp->tiles.front();
+	auto maxTile = mainRamp->tiles.front();
+	for (const auto & tile : mainRamp->tiles)
 	{
-		Util::DisplayError("Ramp tiles are wrong.", "0x00000004", m_bot, false);
-		return {};
+		minTile = CCTilePosition(std::min(minTile.x, tile.x), std::min(minTile.y, tile.y));
+		maxTile = CCTilePosition(std::max(maxTile.x, tile.x), std::max(maxTile.y, tile.y));
 	}
-	return tilesToBlock;
-}
+	minTile = CCTilePosition(std::max(0, minTile.x - WallSearchMargin), std::max(0, minTile.y - WallSearchMargin));
+	maxTile = CCTilePosition(std::min(m_bot.Map().totalWidth() - 1, maxTile.x + WallSearchMargin), std::min(m_bot.Map().totalHeight() - 1, maxTile.y + WallSearchMargin));
 
-void BuildingManager::PlaceWallBuildings(std::vector<CCTilePosition> tilesToBlock)
-{
-	std::list<CCTilePosition> buildingTiles;
-	for (auto & tile : tilesToBlock)
+	WallSolver solver(minTile, maxTile.x - minTile.x + 1, maxTile.y - minTile.y + 1);
+	for (int y = minTile.y; y <= maxTile.y; ++y)
 	{
-		if (m_bot.Map().isBuildable(tile) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x - 1, tile.y)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x, tile.y - 1)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x - 1, tile.y - 1)))
-		{
-			if (ValidateSupplyDepotPosition(buildingTiles, CCTilePosition(tile.x - 1, tile.y - 1)))
-			{
-				buildingTiles.push_back(CCTilePosition(tile.x - 1, tile.y - 1));
-				continue;
-			}
-		}
-		if (m_bot.Map().isBuildable(CCTilePosition(tile.x + 1, tile.y)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x, tile.y)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x + 1, tile.y - 1)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x, tile.y - 1)))
+		for (int x = minTile.x; x <= maxTile.x; ++x)
 		{
-			if (ValidateSupplyDepotPosition(buildingTiles, CCTilePosition(tile.x, tile.y - 1)))
-			{
-				buildingTiles.push_back(CCTilePosition(tile.x, tile.y - 1));
+			const auto tile = CCTilePosition(x, y);
+			if (!m_bot.Map().isWalkable(tile))
 				continue;
-			}
-		}
-		if (m_bot.Map().isBuildable(CCTilePosition(tile.x, tile.y + 1)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x - 1, tile.y + 1)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x, tile.y)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x - 1, tile.y)))
-		{
-			if (ValidateSupplyDepotPosition(buildingTiles, CCTilePosition(tile.x - 1, tile.y)))
-			{
-				buildingTiles.push_back(CCTilePosition(tile.x - 1, tile.y));
-				continue;
-			}
+			const auto inMainRegion = m_bot.Regions().getRegionId(x, y) == mainRegion->id;
+			solver.setTile(tile, inMainRegion && m_bot.Map().isBuildable(tile) ? WallSolver::TileType::Buildable : WallSolver::TileType::Walkable);
+			if (inMainRegion && (x == minTile.x || x == maxTile.x || y == minTile.y || y == maxTile.y))
+				solver.addInsideTile(tile);
 		}
-		if (m_bot.Map().isBuildable(CCTilePosition(tile.x + 1, tile.y + 1)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x, tile.y + 1)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x + 1, tile.y)) &&
-			m_bot.Map().isBuildable(CCTilePosition(tile.x, tile.y)))
+	}
+	std::vector<CCTilePosition> targetTiles;
+	for (const auto & tile : mainRamp->tiles)
+	{
+		solver.addOutsideTile(tile);
+		for (const auto & neighborTile : { CCTilePosition(tile.x + 1, tile.y), CCTilePosition(tile.x - 1, tile.y), CCTilePosition(tile.x, tile.y + 1), CCTilePosition(tile.x, tile.y - 1) })
 		{
-			if (ValidateSupplyDepotPosition(buildingTiles, CCTilePosition(tile.x, tile.y)))
+			if (m_bot.Regions().getRegionId(neighborTile.x, neighborTile.y) == mainRegion->id && m_bot.Map().isBuildable(neighborTile)
+				&& std::find(targetTiles.begin(), targetTiles.end(), neighborTile) == targetTiles.end())
 			{
-				buildingTiles.push_back(CCTilePosition(tile.x, tile.y));
-				continue;
+				targetTiles.push_back(neighborTile);
+				solver.addTargetTile(neighborTile);
 			}
 		}
-		BOT_ASSERT(false, "Can't find possible position for a wall build. This shouldn't happen.");
-		//TODO: Check remove the buildingTiles and try again in a different order. To try again, pop front tilesToBlock and push back the front.
 	}
 
-	bool barrackInWall = !m_bot.Strategy().isProxyStartingStrategy();
-	
-	if (barrackInWall)
+	//The barracks keeps the space of its addon if it can, the wall is closed since we lower the depots to get out
+	const WallFootprint barracks = { 3, true };
+	const WallFootprint barracksWithoutAddon = { 3, false };
+	const WallFootprint supplyDepot = { 2, false };
+	std::vector<std::vector<WallFootprint>> footprintSets;
+	if (!m_bot.Strategy().isProxyStartingStrategy())
 	{
-		//Calculate the center of the buildings
-		auto centerX = 0.f;
-		auto centerY = 0.f;
-		for (auto building : buildingTiles)
-		{
-			centerX += building.x;
-			centerY += building.y;
-		}
-		centerX = centerX / buildingTiles.size();
-		centerY = centerY / buildingTiles.size();
-
-		if (centerX > buildingTiles.front().x)
-		{
-			buildingTiles.front().x -= 1;
-		}
-
-		if (centerY > buildingTiles.front().y)
-		{
-			buildingTiles.front().y -= 1;
-		}
+		footprintSets.push_back({ barracks, supplyDepot, supplyDepot });
+		footprintSets.push_back({ barracksWithoutAddon, supplyDepot, supplyDepot });
 	}
+	footprintSets.push_back({ supplyDepot, supplyDepot, supplyDepot });
 
-	auto i = 0;
-	for (auto building : buildingTiles)
+	WallSolution solution;
+	const std::vector<WallFootprint> * footprints = nullptr;
+	auto truncated = false;
+	for (const auto & footprintSet : footprintSets)
 	{
-		auto position = CCTilePosition(building.x + 1, building.y + 1);
-
-		if (barrackInWall && i == 0)//0 is always the center building
+		if (solver.solve(footprintSet, 0, solution))
 		{
-			//offset the barrack in the opposite direction of the center, so we can build it
-			m_nextBuildingPosition[MetaTypeEnum::Barracks.getUnitType()].push_back(position);
-			m_buildingPlacer.reserveTiles(position.x, position.y, 3, 3);
-		}
-		else
-		{
-			m_nextBuildingPosition[MetaTypeEnum::SupplyDepot.getUnitType()].push_back(position);
-			m_buildingPlacer.reserveTiles(position.x, position.y, 2, 2);
+			footprints = &footprintSet;
+			break;
 		}
-		m_wallBuildingPosition.push_back(position);
-
-		i++;
+		truncated = truncated || solution.truncated;
+	}
+	if (!footprints)
+	{
+		//When the search ran out of nodes, a wall may exist
+		Util::DisplayError("Can't find a wall for the main ramp, tiles to block = " + std::to_string(targetTiles.size()) + (truncated ? ", search truncated" : ""), "0x00000004", m_bot, false);
+		return;
 	}
-}
-
-bool BuildingManager::ValidateSupplyDepotPosition(std::list<CCTilePosition> buildingTiles, CCTilePosition possibleTile)
-{
-	std::list<CCTilePosition> possibleTiles;
-	possibleTiles.push_back(CCTilePosition(possibleTile.x, possibleTile.y));
-	possibleTiles.push_back(CCTilePosition(possibleTile.x + 1, possibleTile.y));
-	possibleTiles.push_back(CCTilePosition(possibleTile.x, possibleTile.y + 1));
-	possibleTiles.push_back(CCTilePosition(possibleTile.x + 1, possibleTile.y + 1));
 
-	for (auto tile : buildingTiles)
+	//The first wall building is the center of the wall, the barracks or else the depot closest to the ramp
+	std::vector<size_t> order;
+	for (size_t i = 0; i < footprints->size(); ++i)
+		order.push_back(i);
+	std::sort(order.begin(), order.end(), [&](size_t a, size_t b)
 	{
-		std::list<CCTilePosition> tiles;
-		tiles.push_back(CCTilePosition(tile.x, tile.y));
-		tiles.push_back(CCTilePosition(tile.x + 1, tile.y));
-		tiles.push_back(CCTilePosition(tile.x, tile.y + 1));
-		tiles.push_back(CCTilePosition(tile.x + 1, tile.y + 1));
-		for (auto t : tiles)
-		{
-			if (std::find(possibleTiles.begin(), possibleTiles.end(), t) != possibleTiles.end())
-			{
-				return false;
-			}
-		}
+		if ((*footprints)[a].size != (*footprints)[b].size)
+			return (*footprints)[a].size > (*footprints)[b].size;
+		return Util::DistSq(Util::GetPosition(solution.positions[a]), mainRamp->center) < Util::DistSq(Util::GetPosition(solution.positions[b]), mainRamp->center);
+	});
+	for (const auto i : order)
+	{
+		const auto size = (*footprints)[i].size;
+		const auto position = CCTilePosition(solution.positions[i].x + 1, solution.positions[i].y + 1);
+		const auto & type = size == 3 ? MetaTypeEnum::Barracks.getUnitType() : MetaTypeEnum::SupplyDepot.getUnitType();
+		m_nextBuildingPosition[type].push_back(position);
+		m_buildingPlacer.reserveTiles(position.x, position.y, size, size);
+		m_wallBuildingPosition.push_back(position);
 	}
-	return true;
 }
 
 void BuildingManager::FindOpponentMainRamp()
 {
-	const auto enemyBaseLocation = m_bot.Bases().getPlayerStartingBaseLocation(Players::Enemy);
-	if(enemyBaseLocation)
+	std::list<CCTilePosition> rampTiles;
+	FindMainRampTiles(Players::Enemy, rampTiles);
+	if(!rampTiles.empty())
 	{
-		std::list<CCTilePosition> checkedTiles;
-		std::list<CCTilePosition> rampTiles;
-		FindRampTiles(rampTiles, checkedTiles, enemyBaseLocation->getDepotTilePosition());
-		FindMainRamp(rampTiles);
 		CCPosition rampPos;
 		for (const auto & rampTile : rampTiles)
 		{
@@ -1183,6 +1012,7 @@ bool BuildingManager::addBuildingTask(Building & b, bool filterMovingWorker)
 	}
 
 	m_buildings.push_back(b);
+	updateTechTypeBeingBuilt(b.type, 1);
 
 	return true;
 }
@@ -1354,29 +1184,19 @@ CCTilePosition BuildingManager::getProxyLocation()
 	FindOpponentMainRamp();
 	if (m_enemyMainRamp != CCPosition())
 	{
-		const auto & scv = *m_bot.Workers().getWorkers().begin();
-		auto scvPtr = scv.getUnitPtr();
-		bool deletePtr = false;
+		const auto startingBaseLocation = m_bot.Bases().getPlayerStartingBaseLocation(Players::Self);
+		auto mainPathStart = Util::GetPosition(startingBaseLocation->getDepotTilePosition());
 		if (!m_rampTiles.empty())
 		{
-			deletePtr = true;
-			auto fakeSCV = new sc2::Unit();
-			fakeSCV->unit_type = sc2::UnitTypeID(sc2::UNIT_TYPEID::TERRAN_SCV);
-			fakeSCV->is_flying = false;
-			fakeSCV->radius = 0.375f;
-			auto rampPos = CCPosition();
+			mainPathStart = CCPosition();
 			for (auto rampTile : m_rampTiles)
-				rampPos += Util::GetPosition(rampTile);
-			rampPos /= m_rampTiles.size();
-			fakeSCV->pos = sc2::Point3D(rampPos.x, rampPos.y, Util::TerrainHeight(rampPos));
-			scvPtr = fakeSCV;
-		}
-		const auto mainPath = Util::PathFinding::FindOptimalPathWithoutLimit(scvPtr, m_enemyMainRamp, m_bot);
-		if (deletePtr)
-			delete scvPtr;
+				mainPathStart += Util::GetPosition(rampTile);
+			mainPathStart /= m_rampTiles.size();
+		}
+		// The ground path between the ramps, it does not need a unit
+		const auto mainPath = m_bot.Pathfinder().findPath(mainPathStart, m_enemyMainRamp);
 		if (mainPath.empty())
 			return Util::GetTilePosition(m_bot.Map().center());
-		const auto startingBaseLocation = m_bot.Bases().getPlayerStartingBaseLocation(Players::Self);
 		const auto enemyBasePosition = Util::GetPosition(m_bot.Bases().getPlayerStartingBaseLocation(Players::Enemy)->getDepotTilePosition());
 		const auto enemyNext = m_bot.Bases().getNextExpansion(Players::Enemy, false, false);
 		const auto & baseLocations = m_bot.Bases().getBaseLocations();	// Sorted by closest to enemy base
@@ -1387,7 +1207,7 @@ CCTilePosition BuildingManager::getProxyLocation()
 			if (baseLocation == enemyNext || baseLocation == startingBaseLocation)
 				continue;
 			const auto dist = baseLocation->getGroundDistance(m_enemyMainRamp);
-			const auto startingBaseDist = startingBaseLocation->getGroundDistance(baseLocation->getDepotTilePosition());
+			const auto startingBaseDist = m_bot.Bases().getGroundDistance(startingBaseLocation, baseLocation);
 			const auto totalDist = dist * 2 + startingBaseDist;
 			const auto baseHeight = m_bot.Map().terrainHeight(baseLocation->getDepotTilePosition());
 			const auto basePosition = Util::GetPosition(baseLocation->getDepotTilePosition());
@@ -1605,11 +1425,22 @@ void BuildingManager::removeBuildings(const std::vector<Building> & toRemove)
 				m_buildingsProgress.erase(it->buildingUnit.getTag());
 				m_buildingsNewWorker.erase(b.buildingUnit.getTag());
 			}
+			updateTechTypeBeingBuilt(it->type, -1);
             m_buildings.erase(it);
         }
     }
 }
 
+// Keeps the tech types of m_buildings up to date for ProductionManager, it mirrors isBeingBuilt
+void BuildingManager::updateTechTypeBeingBuilt(const UnitType & type, int delta)
+{
+	const int index = m_bot.Tech().getTechTypeIndex(type);
+	if (index <= 0)
+		return;
+	m_techTypesBeingBuiltCounts[index] += delta;
+	m_techTypesBeingBuilt.set(index, m_techTypesBeingBuiltCounts[index] > 0);
+}
+
 void BuildingManager::removeNonStartedBuildingsOfType(sc2::UNIT_TYPEID type)
 {
 	std::vector<Building> toRemove;
@@ -1673,6 +1504,7 @@ void BuildingManager::updateBaseBuildings()
 {
 	m_baseBuildings.clear();
 	m_finishedBaseBuildings.clear();
+	m_techTypesInProduction.reset();
 	for (auto building : m_bot.UnitInfo().getUnits(Players::Self))
 	{
 		// filter out non building or building under construction
@@ -1685,6 +1517,13 @@ void BuildingManager::updateBaseBuildings()
 		{
 			m_baseBuildings.push_back(building);
 			m_finishedBaseBuildings.push_back(building);
+			const auto & orders = building.getUnitPtr()->orders;
+			if (!orders.empty())
+			{
+				const int index = m_bot.Tech().getTechTypeIndexOfAbility(orders[0].ability_id);
+				if (index > 0)
+					m_techTypesInProduction.set(index);
+			}
 		}
 		else if (building.isBeingConstructed())
 		{
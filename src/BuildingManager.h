@@ -2,6 +2,8 @@
 
 #include "Common.h"
 #include "BuildingPlacer.h"
+#include "TechTree.h"
+#include <array>
 #include <list>
 
 class CCBot;
@@ -18,6 +20,9 @@ class BuildingManager
 	std::map<sc2::Tag, Unit> m_buildingsNewWorker;
 	std::vector<Unit> m_baseBuildings;
 	std::vector<Unit> m_finishedBaseBuildings;
+	std::array<int, MaxTechTypes> m_techTypesBeingBuiltCounts;	// number of m_buildings per tech type
+	TechMask m_techTypesBeingBuilt;
+	TechMask m_techTypesInProduction;	// units trained by m_finishedBaseBuildings
 	std::vector<Unit> m_previousBaseBuildings; //Base buildings last frame, useful to find dead buildings
 	std::list<CCTilePosition> m_rampTiles;
 	CCPosition m_enemyMainRamp;
@@ -34,6 +39,8 @@ class BuildingManager
 	std::vector<std::pair<CCTilePosition, CCTilePosition>> m_previousNextBuildingPositionByBase;
 	std::map<sc2::Tag, CCPosition> liftedBuildingPositions;
 
+	const int WallSearchMargin = 6;	// tiles around the main ramp considered by the wall solver
+
     bool            m_debugMode;
 
     bool            isBuildingPositionExplored(const Building & b) const;
@@ -42,6 +49,7 @@ class BuildingManager
 	void			LiftOrLandDamagedBuildings();
 	Building		CancelBuilding(Building b);
 	void			updateBaseBuildings();
+	void			updateTechTypeBeingBuilt(const UnitType & type, int delta);
 
     void            validateWorkersAndBuildings();		    // STEP 1
     void            assignWorkersToUnassignedBuildings();	// STEP 2
@@ -61,11 +69,9 @@ public:
 	void				onFirstFrame();
     void                onFrame(bool executeMacro);
 	void				lowPriorityChecks();
-	void				FindRampTiles(std::list<CCTilePosition> &rampTiles, std::list<CCTilePosition> &checkedTiles, CCTilePosition currentTile);
-	void				FindMainRamp(std::list<CCTilePosition> &rampTiles);
-	std::vector<CCTilePosition> FindRampTilesToPlaceBuilding(std::list<CCTilePosition> &rampTiles);
-	void				PlaceWallBuildings(std::vector<CCTilePosition> tilesToBlock);
-	bool				ValidateSupplyDepotPosition(std::list<CCTilePosition> buildingTiles, CCTilePosition possibleTile);
+	void				FindMainRampTiles(int player, std::list<CCTilePosition> &rampTiles) const;
+	bool				IsRampEdgeTile(const CCTilePosition & tile) const;
+	void				PlaceWallBuildings();
 	void FindOpponentMainRamp();
 	bool				addBuildingTask(Building & b, bool filterMovingWorker = true);
 	bool				isConstructingType(const UnitType & type);
@@ -95,6 +101,8 @@ public:
 	bool				isWallPosition(int x, int y) const;
 	int					countBeingBuilt(UnitType type, bool underConstruction = false) const;
 	int					countBoughtButNotBeingBuilt(sc2::UNIT_TYPEID type) const;
+	const TechMask &	getTechTypesBeingBuilt() const { return m_techTypesBeingBuilt; }
+	const TechMask &	getTechTypesInProduction() const { return m_techTypesInProduction; }
 
 	void				removeBuildings(const std::vector<Building> & toRemove);
 	void				removeNonStartedBuildingsOfType(sc2::UNIT_TYPEID type);
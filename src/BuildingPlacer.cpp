@@ -12,7 +12,7 @@ BuildingPlacer::BuildingPlacer(CCBot & bot)
 
 void BuildingPlacer::onStart()
 {
-    m_reserveMap = std::vector< std::vector<bool> >(m_bot.Map().totalWidth(), std::vector<bool>(m_bot.Map().totalHeight(), false));
+    m_reserveMap = TileBitmask(m_bot.Map().totalWidth(), m_bot.Map().totalHeight());
 
 auto bases = m_bot.Bases().getBaseLocations();
 for (auto baseLocation : bases)
@@ -205,7 +205,7 @@ bool BuildingPlacer::intersects(Unit unit, CCPosition buildingAbsoluteCenter, in
 	return distance_sq <= pow(r + buildingRadius, 2);
 }
 
-std::vector<CCTilePosition> BuildingPlacer::getTilesForBuildLocation(Unit building) const
+FrameVector<CCTilePosition> BuildingPlacer::getTilesForBuildLocation(Unit building) const
 {
 	BOT_ASSERT(building.getType().isBuilding(), "Should not call getTilesForBuildLocation on a none building unit.");
 	auto position = building.getTilePosition();
@@ -213,7 +213,7 @@ std::vector<CCTilePosition> BuildingPlacer::getTilesForBuildLocation(Unit buildi
 	return getTilesForBuildLocation(position.x, position.y, type, type.tileWidth(), type.tileHeight(), true);
 }
 
-std::vector<CCTilePosition> BuildingPlacer::getTilesForBuildLocation(int bx, int by, const UnitType & type, int width, int height, bool includeExtraTiles) const
+FrameVector<CCTilePosition> BuildingPlacer::getTilesForBuildLocation(int bx, int by, const UnitType & type, int width, int height, bool includeExtraTiles) const
 {
 	//width and height are not taken from the Type to allow a padding around the building of we want to.
 	int offset = getBuildingCenterOffset(bx, by, width, height);
@@ -222,7 +222,8 @@ std::vector<CCTilePosition> BuildingPlacer::getTilesForBuildLocation(int bx, int
 	int y = by - offset;
 
 	//tiles for the actual building
-	std::vector<CCTilePosition> tiles;
+	FrameVector<CCTilePosition> tiles;
+	tiles.reserve(width * height + (includeExtraTiles ? 4 + width : 0));	// addon and exit tiles
 	for (int i = 0; i < width; i++)
 	{
 		for (int j = 0; j < height; j++)
@@ -488,7 +489,7 @@ bool BuildingPlacer::buildable(const UnitType type, int x, int y, bool ignoreRes
 	}
 	
 	//check reserved tiles
-	if (!ignoreReservedTiles && m_reserveMap[x][y])
+	if (!ignoreReservedTiles && m_reserveMap.get(x, y))
 	{
 		return false;
 	}
@@ -521,14 +522,14 @@ void BuildingPlacer::reserveTiles(int bx, int by, int width, int height)
 	auto tiles = getTilesForBuildLocation(bx, by, UnitType(), width, height, true);
 	for (auto tile : tiles)
 	{
-		m_reserveMap[tile.x][tile.y] = true;
+		m_reserveMap.set(tile.x, tile.y);
 	}
 }
 
 void BuildingPlacer::reserveTiles(CCTilePosition start, CCTilePosition end)//Used only for zones, not for buildings. Like mineral all the way to the depot for example.
 {
-	int rwidth = (int)m_reserveMap.size();
-	int rheight = (int)m_reserveMap[0].size();
+	int rwidth = m_reserveMap.width();
+	int rheight = m_reserveMap.height();
 	int minX;
 	int maxX;
 	if (start.x > end.x)
@@ -555,11 +556,11 @@ void BuildingPlacer::reserveTiles(CCTilePosition start, CCTilePosition end)//Use
 		maxY = end.y;
 	}
 
-	for (int x = minX; x <= maxX && x < rwidth; x++)
+	for (int x = std::max(0, minX); x <= maxX && x < rwidth; x++)
 	{
-		for (int y = minY; y <= maxY && y < rheight; y++)
+		for (int y = std::max(0, minY); y <= maxY && y < rheight; y++)
 		{
-			m_reserveMap[x][y] = true;
+			m_reserveMap.set(x, y);
 		}
 	}
 }
@@ -574,15 +575,15 @@ void BuildingPlacer::drawReservedTiles()
         return;
     }
 
-    int rwidth = (int)m_reserveMap.size();
-    int rheight = (int)m_reserveMap[0].size();
+    int rwidth = m_reserveMap.width();
+    int rheight = m_reserveMap.height();
 
 	CCColor yellow = CCColor(255, 255, 0);
-    for (int x = 0; x < rwidth; ++x)
+    for (int y = 0; y < rheight; ++y)
     { 
-        for (int y = 0; y < rheight; ++y)
+        for (int x = 0; x < rwidth; ++x)
         {
-			if (m_reserveMap[x][y])
+			if (m_reserveMap.get(x, y))
 			{
 				m_bot.Map().drawTile(x, y, yellow);
 			}
@@ -595,7 +596,7 @@ void BuildingPlacer::freeTiles(int bx, int by, int width, int height)
 	auto tiles = getTilesForBuildLocation(bx, by, UnitType(), width, height, true);
 	for (auto tile : tiles)
 	{
-		m_reserveMap[tile.x][tile.y] = false;
+		m_reserveMap.unset(tile.x, tile.y);
 	}
 }
 
@@ -613,8 +614,8 @@ CCTilePosition BuildingPlacer::getRefineryPosition()
 {
 	m_bot.StartProfiling("getRefineryPosition");
     CCPosition closestGeyser(0, 0);
-    double minGeyserDistanceFromHome = std::numeric_limits<double>::max();
     CCPosition homePosition = m_bot.GetStartLocation();
+	std::vector<std::pair<double, CCPosition>> candidateGeysers;
 	//auto& depots = m_bot.GetAllyDepotUnits();
 	auto& bases = m_bot.Bases().getOccupiedBaseLocations(Players::Self);
 
@@ -637,15 +638,24 @@ CCTilePosition BuildingPlacer::getRefineryPosition()
 				continue;
 			}
 
-			const double homeDistance = Util::DistSq(geyser, homePosition);
-			if (homeDistance < minGeyserDistanceFromHome)
-			{
-				if (m_bot.Query()->Placement(sc2::ABILITY_ID::BUILD_REFINERY, geyserPos))
-				{
-					minGeyserDistanceFromHome = homeDistance;
-					closestGeyser = geyserPos;
-				}
-			}
+			candidateGeysers.push_back(std::make_pair(Util::DistSq(geyser, homePosition), geyserPos));
+			break;
+		}
+	}
+
+	// Validate all the candidates with a single placement request, then keep the closest valid one
+	std::sort(candidateGeysers.begin(), candidateGeysers.end(), [](const std::pair<double, CCPosition> & a, const std::pair<double, CCPosition> & b) { return a.first < b.first; });
+	std::vector<CCTilePosition> candidateTiles;
+	for (auto & candidateGeyser : candidateGeysers)
+	{
+		candidateTiles.push_back(Util::GetTilePosition(candidateGeyser.second));
+	}
+	const auto placements = m_bot.Map().canBuildTypeAtPositions(candidateTiles, Util::GetRefineryType());
+	for (size_t i = 0; i < placements.size(); ++i)
+	{
+		if (placements[i])
+		{
+			closestGeyser = candidateGeysers[i].second;
 			break;
 		}
 	}
@@ -680,12 +690,12 @@ bool BuildingPlacer::isGeyserAssigned(CCTilePosition geyserTilePos) const
 
 bool BuildingPlacer::isReserved(int x, int y) const
 {
-    int rwidth = (int)m_reserveMap.size();
-    int rheight = (int)m_reserveMap[0].size();
+    int rwidth = m_reserveMap.width();
+    int rheight = m_reserveMap.height();
     if (x < 0 || y < 0 || x >= rwidth || y >= rheight)
     {
         return false;
     }
 
-    return m_reserveMap[x][y];
+    return m_reserveMap.get(x, y);
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "Common.h"
 #include "BuildingData.h"
+#include "FrameAllocator.h"
+#include "MapGrid.h"
 
 class CCBot;
 class BaseLocation;
@@ -10,7 +12,7 @@ class BuildingPlacer
 {
     CCBot & m_bot;
 
-    std::vector< std::vector<bool> > m_reserveMap;
+    TileBitmask m_reserveMap;
 
     // queries for various BuildingPlacer data
 	bool isGeyserAssigned(CCTilePosition geyserTilePos) const;
@@ -31,8 +33,8 @@ public:
     bool canBuildHere(int bx, int by, const UnitType & type, int buildDist, bool ignoreReserved, bool checkInfluenceMap, bool includeExtraTiles) const;
 	bool isEnemyUnitBlocking(CCTilePosition center, UnitType type) const;
 	bool intersects(Unit unit, CCPosition buildingAbsoluteCenter, int buildingRadius) const;
-	std::vector<CCTilePosition> getTilesForBuildLocation(Unit building) const;
-	std::vector<CCTilePosition> getTilesForBuildLocation(int bx, int by, const UnitType & type, int width, int height, bool includeExtraTiles) const;
+	FrameVector<CCTilePosition> getTilesForBuildLocation(Unit building) const;
+	FrameVector<CCTilePosition> getTilesForBuildLocation(int bx, int by, const UnitType & type, int width, int height, bool includeExtraTiles) const;
 	CCTilePosition getBottomLeftForBuildLocation(int bx, int by, const UnitType & type) const;
 	int getBuildingCenterOffset(int x, int y, int width, int height) const;
 
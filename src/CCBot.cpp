@@ -4,11 +4,14 @@
 CCBot::CCBot(std::string botVersion, bool realtime)
 	: m_map(*this)
 	, m_bases(*this)
+	, m_regions(*this)
 	, m_unitInfo(*this)
 	, m_workers(*this)
 	, m_buildings(*this)
 	, m_strategy(*this)
 	, m_repairStations(*this)
+	, m_abilities(*this)
+	, m_pathfinder(*this)
 	, m_combatAnalyzer(*this)
 	, m_gameCommander(*this)
 	, m_techTree(*this)
@@ -192,8 +195,10 @@ void CCBot::OnNuclearLaunchDetected() {}
 void CCBot::OnGameStart() //full start
 {	
     m_config.readConfigFile();
+	// In realtime the game does not wait for OnGameStart, so the simulator is initialized after the first frames
 	if (!m_realtime)
 		Util::InitializeCombatSimulator();
+	m_map.initializeTerrain();
 	Util::Initialize(*this, GetPlayerRace(Players::Self), Observation()->GetGameInfo());
 
     // add all the possible start locations on the map
@@ -210,6 +215,25 @@ void CCBot::OnGameStart() //full start
 
 	// Create logfile
 	Util::CreateLog(*this);
+	if (m_config.ProfileAllocations)
+	{
+		if (!AllocationTracker::IsEnabled())
+		{
+			std::cout << "ProfileAllocations is ignored, the bot needs to be built with the MICROMACHINE_TRACK_ALLOCATIONS CMake option" << std::endl;
+		}
+		else
+		{
+			// Allocations of each profiled zone per frame, next to the log file
+			m_trackAllocations = true;
+			time_t now = time(0);
+			char buf[80];
+			strftime(buf, sizeof(buf), "./data/%Y-%m-%d--%H-%M-%S", localtime(&now));
+			std::stringstream ss;
+			ss << buf << "_" << GetOpponentId() << "_allocations.csv";
+			m_allocationsFile.open(ss.str());
+			m_allocationsFile << "frame,zone,allocations,bytes" << std::endl;
+		}
+	}
 	m_versionMessage << "MicroMachine v" << m_botVersion;
 	Util::Log(__FUNCTION__, m_versionMessage.str(), *this);
 	std::cout << m_versionMessage.str() << std::endl;
@@ -221,6 +245,8 @@ void CCBot::OnGameStart() //full start
     m_map.onStart();
     m_unitInfo.onStart();
     m_bases.onStart();
+	m_regions.onStart();
+	m_pathfinder.onStart();
     m_workers.onStart();
 	m_buildings.onStart();
 	m_repairStations.onStart();
@@ -274,6 +300,10 @@ void CCBot::OnStep()
 
 	checkForConcede();
 
+	StartProfiling("0.3 m_abilities.onFrame");
+	m_abilities.onFrame();
+	StopProfiling("0.3 m_abilities.onFrame");
+
 	StartProfiling("0.4 m_map.onFrame");
 	m_map.onFrame();
 	StopProfiling("0.4 m_map.onFrame");
@@ -284,6 +314,7 @@ void CCBot::OnStep()
 
 	StartProfiling("0.6 m_bases.onFrame");
     m_bases.onFrame();
+	m_regions.draw();
 	StopProfiling("0.6 m_bases.onFrame");
 
 	StartProfiling("0.7 m_workers.onFrame");
@@ -319,10 +350,16 @@ void CCBot::OnStep()
 	if (Config().AllowDebug)
 	{
 		drawProfilingInfo();
+		Map().flushDebugDraw();
 		Debug()->SendDebug();
 	}
 #endif
+	// when debug is not allowed, the primitives buffered during the frame are never sent
+	Map().clearDebugDraw();
 #endif
+	endProfilingFrame();
+	// every temporary of the frame is gone, their memory can be reused by the next frame
+	FrameArena::Get().reset();
 	StartProfiling("0 Starcraft II");
 
 	if (Config().TimeControl)
@@ -504,6 +541,7 @@ void CCBot::setUnits()
 	m_allyUnitsPerType.clear();
 	m_unitCount.clear();
 	m_unitCompletedCount.clear();
+	m_completedTechTypes.reset();
 	m_strategy.setEnemyCurrentlyHasInvisible(false);
 	bool firstPhoenix = true;
 	const bool zergEnemy = GetPlayerRace(Players::Enemy) == CCRace::Zerg;
@@ -557,6 +595,9 @@ void CCBot::setUnits()
 				if (unit.isCompleted())
 				{
 					m_unitCompletedCount[unit.getAPIUnitType()]++;
+					const int techTypeIndex = m_techTree.getTechTypeIndex(unit.getType());
+					if (techTypeIndex > 0)
+						m_completedTechTypes.set(techTypeIndex);
 				}
 			}
 			if (unitptr->unit_type == sc2::UNIT_TYPEID::TERRAN_KD8CHARGE)
@@ -570,13 +611,13 @@ void CCBot::setUnits()
 				{
 					uint32_t & spawnFrame = it->second;
 					if (GetGameLoop() - spawnFrame > 10)	// Will consider our KD8 Charges to be dangerous only after a few frames
-						m_enemyUnits[unitptr->tag] = unit;
+						setEnemyUnit(unit);
 				}
 			}
 		}
 		else if (unitptr->alliance == sc2::Unit::Enemy)
 		{
-			m_enemyUnits[unitptr->tag] = unit;
+			setEnemyUnit(unit);
 			// If the enemy zergling was seen last frame
 			if (zergEnemy && !m_strategy.enemyHasMetabolicBoost() && unitptr->unit_type == sc2::UNIT_TYPEID::ZERG_ZERGLING
 				&& unitptr->last_seen_game_loop == GetGameLoop())
@@ -933,6 +974,31 @@ void CCBot::identifyEnemyWorkersGoingIntoRefinery()
 	}
 }
 
+// The combat analyzer keeps its enemy stats up to date from these changes, the API does not send an event when a unit morphs
+void CCBot::setEnemyUnit(const Unit & unit)
+{
+	const auto it = m_enemyUnits.find(unit.getTag());
+	if (it == m_enemyUnits.end())
+	{
+		m_enemyUnits[unit.getTag()] = unit;
+		m_combatAnalyzer.onEnemyUnitAdded(unit);
+		return;
+	}
+	// The stored unit still has the type it had last frame
+	const bool morphed = !(it->second.getType() == unit.getType());
+	it->second = unit;
+	if (morphed)
+	{
+		m_combatAnalyzer.onEnemyUnitMorphed(unit);
+	}
+}
+
+void CCBot::removeEnemyUnit(sc2::Tag tag)
+{
+	m_enemyUnits.erase(tag);
+	m_combatAnalyzer.onEnemyUnitRemoved(tag);
+}
+
 void CCBot::clearDeadUnits()
 {
 	std::vector<sc2::Tag> unitsToRemove;
@@ -945,6 +1011,7 @@ void CCBot::clearDeadUnits()
 			unit.getPlayer() == Players::Enemy)	// In case of one of our units get neural parasited, its alliance will switch)
 		{
 			unitsToRemove.push_back(tag);
+			m_combatAnalyzer.onAllyUnitRemoved(tag, unit.getUnitPtr()->unit_type);
 			if (unit.getUnitPtr()->unit_type == sc2::UNIT_TYPEID::TERRAN_KD8CHARGE)
 				m_KD8ChargesSpawnFrame.erase(tag);
 			if (unit.getPlayer() == Players::Enemy)
@@ -983,7 +1050,7 @@ void CCBot::clearDeadUnits()
 	// Remove dead enemy units
 	for (auto tag : unitsToRemove)
 	{
-		m_enemyUnits.erase(tag);
+		removeEnemyUnit(tag);
 	}
 
 	unitsToRemove.clear();
@@ -1043,7 +1110,7 @@ void CCBot::clearDuplicateUnits()
 	// Remove duplicate enemy units
 	for (auto tag : unitsToRemove)
 	{
-		m_enemyUnits.erase(tag);
+		removeEnemyUnit(tag);
 	}
 
 	unitsToRemove.clear();
@@ -1827,21 +1894,30 @@ void CCBot::OnError(const std::vector<sc2::ClientError> & client_errors, const s
 	}
 }
 
+// The zones are profiled to draw them, or to write their allocations even when nothing is drawn
+bool CCBot::isProfiling() const
+{
+#ifdef PUBLIC_RELEASE
+	return m_trackAllocations;
+#else
+	return m_config.DrawProfilingInfo || m_trackAllocations;
+#endif
+}
+
 void CCBot::StartProfiling(const std::string & profilerName)
 {
-#ifndef PUBLIC_RELEASE
-	if (m_config.DrawProfilingInfo)
+	if (isProfiling())
 	{
 		auto & profiler = m_profilingTimes[profilerName];	// Get the profiling queue tuple
 		profiler.start = std::chrono::steady_clock::now();	// Set the start time (third element of the tuple) to now
+		if (m_trackAllocations)
+			profiler.allocationStart = AllocationTracker::GetThreadCounters();
 	}
-#endif
 }
 
 void CCBot::StopProfiling(const std::string & profilerName)
 {
-#ifndef PUBLIC_RELEASE
-	if (m_config.DrawProfilingInfo)
+	if (isProfiling())
 	{
 		auto & profiler = m_profilingTimes[profilerName];	// Get the profiling queue tuple
 
@@ -1857,8 +1933,18 @@ void CCBot::StopProfiling(const std::string & profilerName)
 		}
 		else
 			queue[0] += elapsedTime;						// Add the time to the queue
+
+		if (m_trackAllocations)
+		{
+			// Like the times, the allocations of a zone include the ones of the zones nested in it
+			const auto allocations = AllocationTracker::GetThreadCounters() - profiler.allocationStart;
+			profiler.allocationTotal += allocations;
+			auto & allocationQueue = profiler.allocationQueue;
+			if (allocationQueue.empty())
+				allocationQueue.resize(queue.size());
+			allocationQueue[0] += allocations;
+		}
 	}
-#endif
 }
 
 void CCBot::drawProfilingInfo()
@@ -1868,12 +1954,16 @@ void CCBot::drawProfilingInfo()
 #endif
 	if (m_config.DrawProfilingInfo)
 	{
+		DebugDrawScope drawScope(Map().getDebugDraw(), DebugDrawCategory::Profiling);
 		const std::string stepString = "0.0 OnStep";
 		long long stepTime = 0;
+		uint64_t stepAllocations = 0;
 		const auto it = m_profilingTimes.find(stepString);
 		if(it != m_profilingTimes.end())
 		{
 			stepTime = (*it).second.total / (*it).second.queue.size();
+			if (!(*it).second.allocationQueue.empty())
+				stepAllocations = (*it).second.allocationTotal.allocations / (*it).second.allocationQueue.size();
 		}
 
 		std::string profilingInfo = "Profiling info (ms)";
@@ -1885,6 +1975,12 @@ void CCBot::drawProfilingInfo()
 			profilingInfo += "\nSkipped " + std::to_string(skipped) + " frames since last loop.";
 			m_previousGameLoop = m_gameLoop;
 		}
+		profilingInfo += "\nAbility queries: " + std::to_string(m_abilities.getLastFrameQueryCount()) + " for " + std::to_string(m_abilities.getLastFrameRequestCount()) + " requests (saved " + std::to_string(m_abilities.getLastFrameSavedQueries()) + ")";
+		profilingInfo += "\nPlacement: " + std::to_string(m_map.getPlacementLocalHits()) + " local, " + std::to_string(m_map.getPlacementCacheHits()) + " cached, " + std::to_string(m_map.getPlacementQueriedPositions()) + " queried in " + std::to_string(m_map.getPlacementQueries()) + " queries";
+		auto & flowFields = m_gameCommander.Combat().getFlowFields();
+		profilingInfo += "\nFlow fields: " + std::to_string(flowFields.getFlowFieldCount()) + " cached, " + std::to_string(flowFields.getLastFrameComputeCount()) + " computed for " + std::to_string(flowFields.getLastFrameRequestCount()) + " requests";
+		if (m_config.PipelinedFrames)
+			profilingInfo += "\nInfluence maps: " + std::to_string(m_gameCommander.Combat().getInfluenceMapsAge()) + " steps old, " + std::to_string(m_gameCommander.Combat().getInfluenceMapWorker().getSupersededCount()) + " steps superseded";
 		for (auto & mapPair : m_profilingTimes)
 		{
 			const std::string& key = mapPair.first;
@@ -1892,6 +1988,14 @@ void CCBot::drawProfilingInfo()
 			auto& queue = profiler.queue;
 			const int queueCount = queue.size();
 			const long long time = profiler.total / std::max(queueCount, 1);
+			auto& allocationQueue = profiler.allocationQueue;
+			AllocationTracker::Counters allocations;
+			if (!allocationQueue.empty())
+			{
+				allocations.allocations = profiler.allocationTotal.allocations / allocationQueue.size();
+				allocations.bytes = profiler.allocationTotal.bytes / allocationQueue.size();
+			}
+			const std::string allocationInfo = m_trackAllocations ? " (" + std::to_string(allocations.allocations) + " allocs, " + std::to_string(allocations.bytes / 1024) + " KB)" : "";
 			if (key == stepString)
 			{
 				long long maxFrameTime = 0;
@@ -1906,10 +2010,16 @@ void CCBot::drawProfilingInfo()
 					profilingInfo += "!!!";
 				}
 				profilingInfo += "\n Recent Frame Avg: " + std::to_string(0.001f * time);
+				if (m_trackAllocations)
+				{
+					profilingInfo += "\n Recent Frame Allocations:" + allocationInfo;
+					const FrameArena & arena = FrameArena::Get();
+					profilingInfo += "\n Frame Arena: " + std::to_string(arena.getUsedBytes() / 1024) + " KB (peak " + std::to_string(arena.getPeakBytes() / 1024) + " KB)";
+				}
 			}
 			else if (time * 10 > stepTime)
 			{
-				profilingInfo += "\n" + mapPair.first + ": " + std::to_string(0.001f * time);
+				profilingInfo += "\n" + mapPair.first + ": " + std::to_string(0.001f * time) + allocationInfo;
 				profilingInfo += " !";
 				if (time * 4 > stepTime)
 				{
@@ -1921,18 +2031,44 @@ void CCBot::drawProfilingInfo()
 					}
 				}
 			}
-
-			if(queue.size() >= 50)
+			else if (m_trackAllocations && allocations.allocations * 10 > stepAllocations)
 			{
-				queue.push_front(0);
-				profiler.total -= queue[50];
-				queue.pop_back();
+				// Fast enough but allocates a lot
+				profilingInfo += "\n" + mapPair.first + ": " + std::to_string(0.001f * time) + allocationInfo;
 			}
 		}
 		m_map.drawTextScreen(0.72f, 0.1f, profilingInfo);
 	}
 }
 
+// Writes the allocations of the frame and starts the next frame in the queues of the profiled zones, whether they are drawn or not
+void CCBot::endProfilingFrame()
+{
+	if (!isProfiling())
+		return;
+	for (auto & mapPair : m_profilingTimes)
+	{
+		auto & profiler = mapPair.second;
+		auto & queue = profiler.queue;
+		auto & allocationQueue = profiler.allocationQueue;
+		if (m_trackAllocations && !allocationQueue.empty() && allocationQueue[0].allocations > 0)
+			m_allocationsFile << m_gameLoop << ",\"" << mapPair.first << "\"," << allocationQueue[0].allocations << "," << allocationQueue[0].bytes << "\n";
+
+		if(queue.size() >= 50)
+		{
+			queue.push_front(0);
+			profiler.total -= queue[50];
+			queue.pop_back();
+		}
+		if (allocationQueue.size() >= 50)
+		{
+			allocationQueue.push_front(AllocationTracker::Counters());
+			profiler.allocationTotal -= allocationQueue[50];
+			allocationQueue.pop_back();
+		}
+	}
+}
+
 void CCBot::drawTimeControl()
 {
 #ifdef PUBLIC_RELEASE
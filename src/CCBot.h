@@ -16,6 +16,7 @@
 
 #include "MapTools.h"
 #include "BaseLocationManager.h"
+#include "RegionManager.h"
 #include "UnitInfoManager.h"
 #include "WorkerManager.h"
 #include "BuildingManager.h"
@@ -26,6 +27,9 @@
 #include "TechTree.h"
 #include "Unit.h"
 #include "RepairStationManager.h"
+#include "AbilityCache.h"
+#include "HierarchicalPathfinder.h"
+#include "AllocationTracker.h"
 
 class CCBot : public sc2::Agent 
 {
@@ -35,6 +39,9 @@ class CCBot : public sc2::Agent
 		std::deque<long long> queue;
 		long long total;
 		std::chrono::steady_clock::time_point start;
+		std::deque<AllocationTracker::Counters> allocationQueue;	// same frames as queue, only filled when tracking allocations
+		AllocationTracker::Counters allocationTotal;
+		AllocationTracker::Counters allocationStart;
 	};
 
 	uint32_t				m_gameLoop = 0;
@@ -45,11 +52,14 @@ class CCBot : public sc2::Agent
 	uint32_t				m_lastProfilingLagOutput = 0;
     MapTools                m_map;
     BaseLocationManager     m_bases;
+	RegionManager			m_regions;
     UnitInfoManager         m_unitInfo;
     WorkerManager           m_workers;
 	BuildingManager			m_buildings;
 	StrategyManager         m_strategy;
 	RepairStationManager    m_repairStations;
+	AbilityCache			m_abilities;
+	HierarchicalPathfinder	m_pathfinder;
     BotConfig               m_config;
     TechTree                m_techTree;
 	CombatAnalyzer			m_combatAnalyzer;
@@ -60,6 +70,7 @@ class CCBot : public sc2::Agent
 	int						m_reservedGas = 0;					// gas reserved for planned buildings
 	std::map<sc2::UNIT_TYPEID, int> m_unitCount;
 	std::map<sc2::UNIT_TYPEID, int> m_unitCompletedCount;
+	TechMask				m_completedTechTypes;				// tech types of m_unitCompletedCount
 	std::map<sc2::UNIT_TYPEID, int> m_deadAllyUnitsCount;
 	std::map<sc2::Tag, Unit> m_allyUnits;
 	std::map<sc2::Tag, Unit> m_enemyUnits;
@@ -80,6 +91,8 @@ class CCBot : public sc2::Agent
 	std::set<const sc2::Unit *> m_enemyWorkersGoingInRefinery;
 	CCRace selfRace;
 	std::map<std::string, Profiler> m_profilingTimes;
+	bool					m_trackAllocations = false;
+	std::ofstream			m_allocationsFile;
 	std::mutex m_command_mutex;
 	bool m_concede;
 	bool m_saidHallucinationLine;
@@ -109,6 +122,8 @@ class CCBot : public sc2::Agent
 
 	void checkKeyState();
 	void setUnits();
+	void setEnemyUnit(const Unit & unit);
+	void removeEnemyUnit(sc2::Tag tag);
 	void identifyEnemyRepairingSCVs();
 	void identifyEnemySCVBuilders();
 	void identifyEnemyWorkersGoingIntoRefinery();
@@ -116,7 +131,9 @@ class CCBot : public sc2::Agent
 	void clearDuplicateUnits();
 	void updatePreviousFrameEnemyUnitPos();
 	void checkForConcede();
+	bool isProfiling() const;
 	void drawProfilingInfo();
+	void endProfilingFrame();
 
     void OnError(const std::vector<sc2::ClientError> & client_errors, 
                  const std::vector<std::string> & protocol_errors = {}) override;
@@ -142,12 +159,16 @@ public:
           WorkerManager & Workers();
 		  BuildingManager & Buildings();
 		  BaseLocationManager & Bases();
+	const RegionManager & Regions() const { return m_regions; }
 		  CombatAnalyzer & Analyzer();
 		  GameCommander & Commander();
     const MapTools & Map() const;
     const UnitInfoManager & UnitInfo() const;
 	StrategyManager & Strategy();
 	RepairStationManager & RepairStations() { return m_repairStations; }
+	AbilityCache & Abilities() { return m_abilities; }
+	HierarchicalPathfinder & Pathfinder() { return m_pathfinder; }
+	const TechTree & Tech() const { return m_techTree; }
     const TypeData & Data(const UnitType & type);
     const TypeData & Data(const CCUpgrade & type) const;
     const TypeData & Data(const MetaType & type);
@@ -180,6 +201,7 @@ public:
     const std::vector<Unit> & GetUnits() const;
 	int GetUnitCount(sc2::UNIT_TYPEID type, bool completed = false, bool underConstruction = false);
 	const std::map<sc2::UNIT_TYPEID, int> & GetCompletedUnitCounts() const { return m_unitCompletedCount; }
+	const TechMask & GetCompletedTechTypes() const { return m_completedTechTypes; }
 	int GetDeadAllyUnitsCount(sc2::UNIT_TYPEID type) const;
 	std::map<sc2::Tag, Unit> & GetAllyUnits();
 	const std::vector<Unit> & GetAllyUnits(sc2::UNIT_TYPEID type);
@@ -20,9 +20,6 @@ void CombatAnalyzer::onFrame()
 	m_bot.StartProfiling("0.10.4.4    checkUnitsState");
 	checkUnitsState();
 	m_bot.StopProfiling("0.10.4.4    checkUnitsState");
-	m_bot.StartProfiling("0.10.4.5    UpdateTotalHealthLoss");
-	UpdateTotalHealthLoss();
-	m_bot.StartProfiling("0.10.4.5    UpdateTotalHealthLoss");
 	m_bot.StartProfiling("0.10.4.6    UpdateRatio");
 	UpdateRatio();
 	m_bot.StartProfiling("0.10.4.6    UpdateRatio");
@@ -41,151 +38,6 @@ void CombatAnalyzer::lowPriorityChecks()
 	}
 	m_lastLowPriorityFrame = m_bot.GetGameLoop();
 
-	std::vector<CCTilePosition> buildingPositions;
-	aliveEnemiesCountByType.clear();
-
-	lightCountByType.clear();
-	armoredCountByType.clear();
-	bioCountByType.clear();
-	mechCountByType.clear();
-	psiCountByType.clear();
-	massiveCountByType.clear();
-
-	m_enemyHasCombatAirUnit = false;
-	totalKnownWorkerCount = 0;
-	totalAirUnitsCount = 0;
-	totalGroundUnitsCount = 0;
-	totalGroundLightCount = 0;
-	totalAirLightCount = 0;
-	totalGroundArmoredCount = 0;
-	totalAirArmoredCount = 0;
-	totalGroundBioCount = 0;
-	totalAirBioCount = 0;
-	totalGroundMechCount = 0;
-	totalAirMechCount = 0;
-	totalGroundPsiCount = 0;
-	totalAirPsiCount = 0;
-	totalGroundMassiveCount = 0;
-	totalAirMassiveCount = 0;
-
-	for (auto enemy : m_bot.GetEnemyUnits())
-	{
-		auto unit = enemy.second;
-		sc2::UNIT_TYPEID type = (sc2::UNIT_TYPEID)unit.getAPIUnitType();
-		
-		if (m_bot.Data(unit).isBuilding)
-		{
-			if (std::find(buildingPositions.begin(), buildingPositions.end(), unit.getTilePosition()) == buildingPositions.end())
-			{
-				buildingPositions.push_back(unit.getTilePosition());
-			}
-		}
-		aliveEnemiesCountByType[unit.getUnitPtr()->unit_type]++;
-
-		if (unit.getType().isBuilding())
-		{
-			continue;
-		}
-
-		//Count units by types
-		if (unit.getType().isWorker())
-		{
-			totalKnownWorkerCount++;
-			continue;
-		}
-
-		//Ignored units
-		switch (type)
-		{
-			case sc2::UNIT_TYPEID::TERRAN_AUTOTURRET:
-			case sc2::UNIT_TYPEID::PROTOSS_INTERCEPTOR:
-			case sc2::UNIT_TYPEID::ZERG_LARVA:
-			case sc2::UNIT_TYPEID::ZERG_BROODLING:
-			case sc2::UNIT_TYPEID::ZERG_CHANGELING:
-			case sc2::UNIT_TYPEID::ZERG_INFESTEDTERRANSEGG:
-			case sc2::UNIT_TYPEID::ZERG_INFESTORTERRAN:
-			case sc2::UNIT_TYPEID::ZERG_EGG:
-			case sc2::UNIT_TYPEID::ZERG_BANELINGCOCOON:
-			case sc2::UNIT_TYPEID::ZERG_BROODLORDCOCOON:
-			case sc2::UNIT_TYPEID::ZERG_RAVAGERCOCOON:
-			case sc2::UNIT_TYPEID::ZERG_TRANSPORTOVERLORDCOCOON:
-			continue;
-		}
-
-		if (unit.isFlying())
-		{
-			totalAirUnitsCount++;
-			// This will ignore Observers, Warp Prisms and Overlords (+Cocoons)
-			if (unit.getType().isCombatUnit() && (Util::GetMaxAttackRange(unit.getUnitPtr(), m_bot) > 0 || unit.getUnitPtr()->energy_max > 0))
-				m_enemyHasCombatAirUnit = true;
-		}
-		else
-			totalGroundUnitsCount++;
-
-
-		if (unit.isLight())
-		{
-			lightCountByType[type]++;
-			if (unit.isFlying())
-				totalAirLightCount++;
-			else
-				totalGroundLightCount++;
-		}
-
-		//Check armored units
-		if (unit.isArmored())
-		{
-			armoredCountByType[type]++;
-			if (unit.isFlying())
-				totalAirArmoredCount++;
-			else
-				totalGroundArmoredCount++;
-		}
-
-		//Check biological units
-		if (unit.isBiological())
-		{
-
-			bioCountByType[type]++;
-			if (unit.isFlying())
-				totalAirBioCount++;
-			else
-				totalGroundBioCount++;
-		}
-
-		//Check mech units
-		if (unit.isMechanical())
-		{
-			mechCountByType[type]++;
-			if (unit.isFlying())
-				totalAirMechCount++;
-			else
-				totalGroundMechCount++;
-		}
-
-		//Check psi units
-		if (unit.isPsionic())
-		{
-			psiCountByType[type]++;
-			if (unit.isFlying())
-				totalAirPsiCount++;
-			else
-				totalGroundPsiCount++;
-		}
-
-		//Check massive units
-		if (unit.isMassive())
-		{
-			massiveCountByType[type]++;
-			if (unit.isFlying())
-				totalAirMassiveCount++;
-			else
-				totalGroundMassiveCount++;
-		}
-	}
-	
-	//TODO handle dead ally units
-
 	//Upgrades
 	const auto combatVehicleCount = m_bot.UnitInfo().getUnitTypeCount(Players::Self, MetaTypeEnum::Hellion.getUnitType(), true, true) +
 		m_bot.UnitInfo().getUnitTypeCount(Players::Self, MetaTypeEnum::Cyclone.getUnitType(), true, true);
@@ -236,14 +88,6 @@ void CombatAnalyzer::drawAreasUnderDetection()
 	}
 }
 
-void CombatAnalyzer::UpdateTotalHealthLoss()
-{
-	for (auto unitstate : m_unitStates)
-	{
-		increaseTotalHealthLoss(unitstate.second.GetDamageTaken(), unitstate.second.GetType());
-	}
-}
-
 void CombatAnalyzer::increaseTotalDamage(float damageDealt, sc2::UNIT_TYPEID unittype)
 {
 	if (damageDealt <= 0)
@@ -345,13 +189,7 @@ void CombatAnalyzer::drawDamageHealthRatio()
 
 void CombatAnalyzer::checkUnitsState()
 {
-	m_bot.StartProfiling("0.10.4.4.1      resetStates");
-	for (auto & state : m_unitStates)
-	{
-		state.second.Reset();
-	}
-	m_bot.StopProfiling("0.10.4.4.1      resetStates");
-
+	// The states of dead units are released by onAllyUnitRemoved, so there is nothing to reset or sweep here
 	m_bot.StartProfiling("0.10.4.4.2      updateStates");
 	for (auto & unit : m_bot.Commander().getValidUnits())
 	{
@@ -362,26 +200,6 @@ void CombatAnalyzer::checkUnitsState()
 		checkUnitState(building.buildingUnit);
 	}
 	m_bot.StopProfiling("0.10.4.4.2      updateStates");
-
-	m_bot.StartProfiling("0.10.4.4.3      removeStates");
-	std::vector<CCUnitID> toRemove;
-	for (auto & state : m_unitStates)
-	{
-		if (!state.second.WasUpdated())
-		{
-			//Unit died
-			toRemove.push_back(state.first);
-
-			deadCountByType[state.second.GetType()]++;
-		}
-	}
-
-	//Remove dead units from the map
-	for (auto & tag : toRemove)
-	{
-		m_unitStates.erase(tag);
-	}
-	m_bot.StopProfiling("0.10.4.4.3      removeStates");
 }
 
 void CombatAnalyzer::checkUnitState(Unit unit)
@@ -394,20 +212,19 @@ void CombatAnalyzer::checkUnitState(Unit unit)
 	m_bot.StartProfiling("0.10.4.4.2.1        addState");
 	auto tag = unit.getTag();
 
-	auto it = m_unitStates.find(tag);
-	if (it == m_unitStates.end())
+	const auto it = m_unitStateSlots.find(tag);
+	if (it == m_unitStateSlots.end())
 	{
-		UnitState state = UnitState(unit.getUnitPtr());
-		state.Update();
-		m_unitStates[tag] = state;
+		getUnitState(unit.getUnitPtr());
 		m_bot.StopProfiling("0.10.4.4.2.1        addState");
 		return;
 	}
 	m_bot.StopProfiling("0.10.4.4.2.1        addState");
 
 	m_bot.StartProfiling("0.10.4.4.2.2        updateState");
-	UnitState & state = it->second;
+	UnitState & state = m_unitStates[it->second];
 	state.Update(unit.getHitPoints(), unit.getShields(), unit.getEnergy());
+	increaseTotalHealthLoss(state.GetDamageTaken(), state.GetType());
 	m_bot.StopProfiling("0.10.4.4.2.2        updateState");
 	if (state.WasAttacked())
 	{
@@ -461,19 +278,178 @@ void CombatAnalyzer::checkUnitState(Unit unit)
 
 const UnitState & CombatAnalyzer::getUnitState(const sc2::Unit * unit)
 {
-	const auto it = m_unitStates.find(unit->tag);
-	if (it == m_unitStates.end())
+	const auto it = m_unitStateSlots.find(unit->tag);
+	if (it != m_unitStateSlots.end())
 	{
-		UnitState state = UnitState(unit);
-		state.Update();
-		m_unitStates[unit->tag] = state;
+		return m_unitStates[it->second];
 	}
-	return m_unitStates[unit->tag];
+
+	UnitState state = UnitState(unit);
+	state.Update();
+	size_t slot;
+	if (m_freeUnitStateSlots.empty())
+	{
+		slot = m_unitStates.size();
+		m_unitStates.push_back(state);
+	}
+	else
+	{
+		slot = m_freeUnitStateSlots.back();
+		m_freeUnitStateSlots.pop_back();
+		m_unitStates[slot] = state;
+	}
+	m_unitStateSlots[unit->tag] = slot;
+	return m_unitStates[slot];
+}
+
+void CombatAnalyzer::onAllyUnitRemoved(sc2::Tag tag, sc2::UNIT_TYPEID type)
+{
+	const auto it = m_unitStateSlots.find(tag);
+	if (it == m_unitStateSlots.end())
+	{
+		return;
+	}
+	m_freeUnitStateSlots.push_back(it->second);
+	m_unitStateSlots.erase(it);
+
+	const auto typeIndex = static_cast<size_t>(type);
+	if (deadCountByType.size() <= typeIndex)
+	{
+		deadCountByType.resize(typeIndex + 1, 0);
+	}
+	deadCountByType[typeIndex]++;
 }
 
 void CombatAnalyzer::increaseDeadEnemy(sc2::UNIT_TYPEID type)
 {
-	deadEnemiesCountByType[type]++;
+	const auto typeIndex = static_cast<size_t>(type);
+	if (deadEnemiesCountByType.size() <= typeIndex)
+	{
+		deadEnemiesCountByType.resize(typeIndex + 1, 0);
+	}
+	deadEnemiesCountByType[typeIndex]++;
+}
+
+CombatAnalyzer::EnemyUnitContribution CombatAnalyzer::getEnemyUnitContribution(const Unit & unit) const
+{
+	EnemyUnitContribution contribution;
+	contribution.type = (sc2::UNIT_TYPEID)unit.getAPIUnitType();
+	contribution.isWorker = false;
+	contribution.isArmyUnit = false;
+	contribution.isFlying = unit.isFlying();
+	contribution.isCombatAirUnit = false;
+	contribution.categories.fill(false);
+
+	if (unit.getType().isBuilding())
+	{
+		return contribution;
+	}
+
+	if (unit.getType().isWorker())
+	{
+		contribution.isWorker = true;
+		return contribution;
+	}
+
+	//Ignored units
+	switch (contribution.type)
+	{
+		case sc2::UNIT_TYPEID::TERRAN_AUTOTURRET:
+		case sc2::UNIT_TYPEID::PROTOSS_INTERCEPTOR:
+		case sc2::UNIT_TYPEID::ZERG_LARVA:
+		case sc2::UNIT_TYPEID::ZERG_BROODLING:
+		case sc2::UNIT_TYPEID::ZERG_CHANGELING:
+		case sc2::UNIT_TYPEID::ZERG_INFESTEDTERRANSEGG:
+		case sc2::UNIT_TYPEID::ZERG_INFESTORTERRAN:
+		case sc2::UNIT_TYPEID::ZERG_EGG:
+		case sc2::UNIT_TYPEID::ZERG_BANELINGCOCOON:
+		case sc2::UNIT_TYPEID::ZERG_BROODLORDCOCOON:
+		case sc2::UNIT_TYPEID::ZERG_RAVAGERCOCOON:
+		case sc2::UNIT_TYPEID::ZERG_TRANSPORTOVERLORDCOCOON:
+			return contribution;
+		default:
+			break;
+	}
+
+	contribution.isArmyUnit = true;
+	// This will ignore Observers, Warp Prisms and Overlords (+Cocoons)
+	contribution.isCombatAirUnit = contribution.isFlying && unit.getType().isCombatUnit()
+		&& (Util::GetMaxAttackRange(unit.getUnitPtr(), m_bot) > 0 || unit.getUnitPtr()->energy_max > 0);
+	contribution.categories[Light] = unit.isLight();
+	contribution.categories[Armored] = unit.isArmored();
+	contribution.categories[Bio] = unit.isBiological();
+	contribution.categories[Mech] = unit.isMechanical();
+	contribution.categories[Psi] = unit.isPsionic();
+	contribution.categories[Massive] = unit.isMassive();
+	return contribution;
+}
+
+// count is 1 to add the contribution and -1 to take it back
+void CombatAnalyzer::addEnemyUnitContribution(const EnemyUnitContribution & contribution, int count)
+{
+	const auto typeIndex = static_cast<size_t>(contribution.type);
+	if (aliveEnemiesCountByType.size() <= typeIndex)
+	{
+		aliveEnemiesCountByType.resize(typeIndex + 1, 0);
+		categoryCountByType.resize(typeIndex + 1, std::array<int, EnemyUnitCategoryCount>());
+	}
+	aliveEnemiesCountByType[typeIndex] += count;
+
+	if (contribution.isWorker)
+	{
+		totalKnownWorkerCount += count;
+	}
+	if (!contribution.isArmyUnit)
+	{
+		return;
+	}
+
+	(contribution.isFlying ? totalAirUnitsCount : totalGroundUnitsCount) += count;
+	if (contribution.isCombatAirUnit)
+	{
+		enemyCombatAirUnitCount += count;
+	}
+
+	auto & totalCategoryCount = contribution.isFlying ? totalAirCategoryCount : totalGroundCategoryCount;
+	for (int category = 0; category < EnemyUnitCategoryCount; ++category)
+	{
+		if (contribution.categories[category])
+		{
+			categoryCountByType[typeIndex][category] += count;
+			totalCategoryCount[category] += count;
+		}
+	}
+}
+
+void CombatAnalyzer::onEnemyUnitAdded(const Unit & unit)
+{
+	const auto contribution = getEnemyUnitContribution(unit);
+	m_enemyContributions[unit.getTag()] = contribution;
+	addEnemyUnitContribution(contribution, 1);
+}
+
+void CombatAnalyzer::onEnemyUnitMorphed(const Unit & unit)
+{
+	onEnemyUnitRemoved(unit.getTag());
+	onEnemyUnitAdded(unit);
+}
+
+void CombatAnalyzer::onEnemyUnitRemoved(sc2::Tag tag)
+{
+	const auto it = m_enemyContributions.find(tag);
+	if (it != m_enemyContributions.end())
+	{
+		addEnemyUnitContribution(it->second, -1);
+		m_enemyContributions.erase(it);
+	}
+
+	// The state of an enemy unit is only created when it is asked for
+	const auto stateIt = m_unitStateSlots.find(tag);
+	if (stateIt != m_unitStateSlots.end())
+	{
+		m_freeUnitStateSlots.push_back(stateIt->second);
+		m_unitStateSlots.erase(stateIt);
+	}
 }
 
 bool CombatAnalyzer::shouldProduceGroundAntiGround()
@@ -688,7 +664,7 @@ int CombatAnalyzer::getUnitUpgradeWeapon(const sc2::Unit* unit)
 void CombatAnalyzer::detectUpgrades(Unit & unit, UnitState & state)
 {
 	int healthLost = state.GetDamageTaken();
-	sc2::UnitTypeData unitTypeData = Util::GetUnitTypeDataFromUnitTypeId(unit.getAPIUnitType(), m_bot);
+	const sc2::UnitTypeData & unitTypeData = Util::GetUnitTypeDataFromUnitTypeId(unit.getAPIUnitType(), m_bot);
 	UnitType type = UnitType(unit.getAPIUnitType(), m_bot);
 	int unitUpgradeArmor = getUnitUpgradeArmor(unit.getUnitPtr());
 	
@@ -698,7 +674,7 @@ void CombatAnalyzer::detectUpgrades(Unit & unit, UnitState & state)
 	{
 		//TODO validate unit is looking towards the unit
 
-		sc2::UnitTypeData threatTypeData = Util::GetUnitTypeDataFromUnitTypeId(threat->unit_type, m_bot);
+		const sc2::UnitTypeData & threatTypeData = Util::GetUnitTypeDataFromUnitTypeId(threat->unit_type, m_bot);
 		auto range = Util::GetAttackRangeForTarget(threat, unit.getUnitPtr(), m_bot, true);
 		auto distSq = Util::DistSq(unit.getPosition(), threat->pos) - type.radius() - threat->radius;
 		// If the threat is too far and cant have dealt damage (doesn't consider projectil travel time)
@@ -711,7 +687,7 @@ void CombatAnalyzer::detectUpgrades(Unit & unit, UnitState & state)
 		float weaponDamage = Util::GetDamageForTarget(threat, unit.getUnitPtr(), m_bot);
 		
 		//Get the weapon, even if we have the range and damage, to see if there is another bonus damage that applies to the unit, if there is, apply the + on it.
-		sc2::UnitTypeData targetTypeData = Util::GetUnitTypeDataFromUnitTypeId(threat->unit_type, m_bot);
+		const sc2::UnitTypeData & targetTypeData = Util::GetUnitTypeDataFromUnitTypeId(threat->unit_type, m_bot);
 		for (auto & weapon : unitTypeData.weapons)
 		{
 			if (weapon.type == sc2::Weapon::TargetType::Any || weapon.type == expectedWeaponType)
@@ -4,7 +4,9 @@
 #include "Common.h"
 #include "UnitState.h"
 #include "Unit.h"
+#include <array>
 #include <list>
+#include <unordered_map>
 
 class CCBot;
 
@@ -14,54 +16,50 @@ class CombatAnalyzer {
 	float overallDamage;
 	float overallRatio;
 
-	std::map<CCUnitID, UnitState> m_unitStates;
+	// Unit states live in a flat table, a unit keeps its slot until it dies and the slot is then reused
+	std::vector<UnitState> m_unitStates;
+	std::unordered_map<CCUnitID, size_t> m_unitStateSlots;
+	std::vector<size_t> m_freeUnitStateSlots;
 	std::map<sc2::UNIT_TYPEID, float> ratio;
 	std::map<sc2::UNIT_TYPEID, float> totalDamage;
 	std::map<sc2::UNIT_TYPEID, float> totalhealthLoss;
-	std::map<sc2::Tag, Unit> enemies;
-	std::map<sc2::UNIT_TYPEID, int> aliveEnemiesCountByType;
-	std::map<sc2::UNIT_TYPEID, int> deadEnemiesCountByType;
-	std::map<sc2::UNIT_TYPEID, int> deadCountByType;
+	std::vector<int> deadEnemiesCountByType;	// all the "ByType" vectors are indexed by UNIT_TYPEID
+	std::vector<int> deadCountByType;
 	std::list<std::pair<CCPosition, uint32_t>> m_areasUnderDetection;
 
-	bool m_enemyHasCombatAirUnit = false;
-
-	//Stats for each unit types
-	std::map<sc2::UNIT_TYPEID, int> lightCountByType;
-	int totalGroundLightCount = 0;
-	int totalAirLightCount = 0;
-
-	std::map<sc2::UNIT_TYPEID, int> armoredCountByType;
-	int totalGroundArmoredCount = 0;
-	int totalAirArmoredCount = 0;
-
-	std::map<sc2::UNIT_TYPEID, int> bioCountByType;
-	int totalGroundBioCount = 0;
-	int totalAirBioCount = 0;
-
-	std::map<sc2::UNIT_TYPEID, int> mechCountByType;
-	int totalGroundMechCount = 0;
-	int totalAirMechCount = 0;
-
-	std::map<sc2::UNIT_TYPEID, int> psiCountByType;
-	int totalGroundPsiCount = 0;
-	int totalAirPsiCount = 0;
-
-	std::map<sc2::UNIT_TYPEID, int> massiveCountByType;
-	int totalGroundMassiveCount = 0;
-	int totalAirMassiveCount = 0;
+	//Stats for each unit types, updated by the enemy unit events instead of being recounted
+	enum EnemyUnitCategory { Light, Armored, Bio, Mech, Psi, Massive, EnemyUnitCategoryCount };
+
+	// What a known enemy unit adds to the stats, so that it can be taken back when the unit morphs or is removed
+	struct EnemyUnitContribution
+	{
+		sc2::UNIT_TYPEID type;
+		bool isArmyUnit;		// buildings, workers and ignored units are only counted as alive
+		bool isWorker;
+		bool isFlying;
+		bool isCombatAirUnit;
+		std::array<bool, EnemyUnitCategoryCount> categories;
+	};
+	std::unordered_map<sc2::Tag, EnemyUnitContribution> m_enemyContributions;
+
+	std::vector<int> aliveEnemiesCountByType;
+	std::vector<std::array<int, EnemyUnitCategoryCount>> categoryCountByType;
+	std::array<int, EnemyUnitCategoryCount> totalGroundCategoryCount = {};
+	std::array<int, EnemyUnitCategoryCount> totalAirCategoryCount = {};
 
 	int totalKnownWorkerCount = 0;
 	int totalGroundUnitsCount = 0;
 	int totalAirUnitsCount = 0;
+	int enemyCombatAirUnitCount = 0;
 
 	int getUnitUpgradeArmor(const sc2::Unit* unit);
 	int getUnitUpgradeWeapon(const sc2::Unit* unit);
 
 	void clearAreasUnderDetection();
-	void UpdateTotalHealthLoss();
 	void drawDamageHealthRatio();
 	void drawAreasUnderDetection();
+	EnemyUnitContribution getEnemyUnitContribution(const Unit & unit) const;
+	void addEnemyUnitContribution(const EnemyUnitContribution & contribution, int count);
 public:
 	int selfTerranBioArmor = 0;
 	int selfTerranBioWeapon = 0;
@@ -112,11 +110,15 @@ public:
 	void checkUnitState(Unit unit);
 	const UnitState & getUnitState(const sc2::Unit * unit);
 	void increaseDeadEnemy(sc2::UNIT_TYPEID type);
+	void onEnemyUnitAdded(const Unit & unit);
+	void onEnemyUnitMorphed(const Unit & unit);
+	void onEnemyUnitRemoved(sc2::Tag tag);
+	void onAllyUnitRemoved(sc2::Tag tag, sc2::UNIT_TYPEID type);
 	bool shouldProduceGroundAntiGround();
 	bool shouldProduceGroundAntiAir();
 	bool shouldProduceAirAntiGround();
 	bool shouldProduceAirAntiAir();
-	bool enemyHasCombatAirUnit() const { return m_enemyHasCombatAirUnit; }
+	bool enemyHasCombatAirUnit() const { return enemyCombatAirUnitCount > 0; }
 	void detectUpgrades(Unit & unit, UnitState & state);
 	void detectTechs(Unit & unit, UnitState & state);
 };
\ No newline at end of file
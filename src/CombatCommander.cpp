@@ -25,13 +25,186 @@ const float MainAttackRegroupCooldown = 200;	//Min number of frames required to
 const float MainAttackMinRetreatDuration = 50;	//Max number of frames allowed for a regroup order
 
 const size_t BLOCKED_TILES_UPDATE_FREQUENCY = 24;
+const size_t CHANGED_TILES_HISTORY = 48;		// number of frames the changed tiles are kept for the searches that are not updated on every frame
 const uint32_t WORKER_RUSH_DETECTION_COOLDOWN = 30 * 24;
 const size_t MAX_DISTANCE_FROM_CLOSEST_BASE_FOR_WORKER_FLEE = 15;
 const int ACTION_REEXECUTION_FREQUENCY = 50;
+const size_t DefaultCombatSimulationQueueSize = 8;	//Replaced by the config value on start
+const size_t PIPELINED_INFLUENCE_MAPS_BUFFERS = 2;	//One rasterized by the worker while the other waits to be taken
+
+void CombatInfluenceMaps::resize(size_t width, size_t height)
+{
+	m_groundFromGround.assign(width, std::vector<float>(height, 0.f));
+	m_groundFromAir.assign(width, std::vector<float>(height, 0.f));
+	m_airFromGround.assign(width, std::vector<float>(height, 0.f));
+	m_airFromAir.assign(width, std::vector<float>(height, 0.f));
+	m_groundEffect.assign(width, std::vector<float>(height, 0.f));
+	m_airEffect.assign(width, std::vector<float>(height, 0.f));
+	m_groundFromGroundCloaked.assign(width, std::vector<float>(height, 0.f));
+	m_stampedTiles = TileBitmask(int(width), int(height));
+}
+
+// Clears the maps and adds the influence circle of every stamp to them. Only the tiles stamped by the previous rasterization need to be cleared.
+void CombatInfluenceMaps::rasterize(const std::vector<InfluenceStamp> & stamps, const CCPosition & mapMin, const CCPosition & mapMax)
+{
+	for (int y = 0; y < m_stampedTiles.height(); ++y)
+	{
+		for (int wordX = 0; wordX < m_stampedTiles.wordsPerRow(); ++wordX)
+		{
+			uint64_t stampedBits = m_stampedTiles.word(wordX, y);
+			while (stampedBits != 0)
+			{
+				const int x = wordX * 64 + LowestBitIndex(stampedBits);
+				m_groundFromGround[x][y] = 0.f;
+				m_groundFromAir[x][y] = 0.f;
+				m_airFromGround[x][y] = 0.f;
+				m_airFromAir[x][y] = 0.f;
+				m_groundEffect[x][y] = 0.f;
+				m_airEffect[x][y] = 0.f;
+				m_groundFromGroundCloaked[x][y] = 0.f;
+				stampedBits &= stampedBits - 1;
+			}
+		}
+	}
+	m_stampedTiles.clear();
+
+	for (const auto & stamp : stamps)
+	{
+		const float totalRange = stamp.range + stamp.speed;
+		const int minX = std::max(mapMin.x, std::floor(stamp.position.x - totalRange));
+		const int maxX = std::min(mapMax.x, std::ceil(stamp.position.x + totalRange));
+		const int minY = std::max(mapMin.y, std::floor(stamp.position.y - totalRange));
+		const int maxY = std::min(mapMax.y, std::ceil(stamp.position.y + totalRange));
+		auto& influenceMap = stamp.ground ? (stamp.effect ? m_groundEffect : (stamp.fromGround ? m_groundFromGround : m_groundFromAir)) : (stamp.effect ? m_airEffect : (stamp.fromGround ? m_airFromGround : m_airFromAir));
+		//loop for a square of size equal to the diameter of the influence circle
+		for (int x = minX; x < maxX; ++x)
+		{
+			for (int y = minY; y < maxY; ++y)
+			{
+				const float distance = Util::Dist(stamp.position, CCPosition(x + 0.5f, y + 0.5f));
+				float multiplier = 1.f;
+				if (distance > stamp.range)
+					multiplier = std::max(0.f, (stamp.speed - (distance - stamp.range)) / stamp.speed);	//value is linearly interpolated in the speed buffer zone
+				influenceMap[x][y] += stamp.dps * multiplier;
+				if (stamp.fromGround && stamp.cloaked)
+					m_groundFromGroundCloaked[x][y] += stamp.dps * multiplier;
+				m_stampedTiles.set(x, y);
+			}
+		}
+	}
+}
+
+InfluenceMapWorker::InfluenceMapWorker()
+	: m_step(0)
+	, m_hasStamps(false)
+	, m_supersededSteps(0)
+	, m_stopping(false)
+{
+}
+
+InfluenceMapWorker::~InfluenceMapWorker()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_condition.notify_all();
+	if (m_worker.joinable())
+		m_worker.join();
+}
+
+void InfluenceMapWorker::resize(size_t width, size_t height, size_t bufferCount)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_freeBuffers.clear();
+	m_result.reset();
+	for (size_t i = 0; i < bufferCount; ++i)
+	{
+		m_freeBuffers.push_back(std::make_unique<CombatInfluenceMaps>());
+		m_freeBuffers.back()->resize(width, height);
+	}
+}
+
+void InfluenceMapWorker::post(std::vector<InfluenceStamp> & stamps, const CCPosition & mapMin, const CCPosition & mapMax, uint32_t step)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_hasStamps)
+		++m_supersededSteps;
+	m_stamps.swap(stamps);
+	m_mapMin = mapMin;
+	m_mapMax = mapMax;
+	m_step = step;
+	m_hasStamps = true;
+	if (!m_worker.joinable())
+		m_worker = std::thread(&InfluenceMapWorker::runWorker, this);
+	m_condition.notify_one();
+}
+
+std::unique_ptr<CombatInfluenceMaps> InfluenceMapWorker::takeResult()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return std::move(m_result);
+}
+
+void InfluenceMapWorker::giveBack(std::unique_ptr<CombatInfluenceMaps> maps)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_freeBuffers.push_back(std::move(maps));
+	}
+	m_condition.notify_one();
+}
+
+size_t InfluenceMapWorker::getSupersededCount()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_supersededSteps;
+}
+
+void InfluenceMapWorker::runWorker()
+{
+	std::vector<InfluenceStamp> stamps;
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		// Waits for stamps and for a buffer, the result that was not taken yet is reused when it is the only one left
+		m_condition.wait(lock, [this] { return m_stopping || (m_hasStamps && (!m_freeBuffers.empty() || m_result)); });
+		if (m_stopping)
+			return;
+		std::unique_ptr<CombatInfluenceMaps> maps;
+		if (!m_freeBuffers.empty())
+		{
+			maps = std::move(m_freeBuffers.back());
+			m_freeBuffers.pop_back();
+		}
+		else
+		{
+			maps = std::move(m_result);
+		}
+		stamps.swap(m_stamps);
+		m_stamps.clear();
+		m_hasStamps = false;
+		const CCPosition mapMin = m_mapMin;
+		const CCPosition mapMax = m_mapMax;
+		const uint32_t step = m_step;
+		lock.unlock();
+
+		maps->rasterize(stamps, mapMin, mapMax);
+		maps->m_step = step;
+
+		lock.lock();
+		// A result that was not taken is older than this one
+		if (m_result)
+			m_freeBuffers.push_back(std::move(m_result));
+		m_result = std::move(maps);
+	}
+}
 
 CombatCommander::CombatCommander(CCBot & bot)
     : m_bot(bot)
     , m_squadData(bot)
+	, m_flowFields(bot)
+	, m_simulationService(DefaultCombatSimulationQueueSize)
     , m_initialized(false)
     , m_attackStarted(false)
 	, m_currentBaseExplorationIndex(0)
@@ -41,6 +214,8 @@ CombatCommander::CombatCommander(CCBot & bot)
 
 void CombatCommander::onStart()
 {
+	m_simulationService.setMaxQueuedRequests(size_t(std::max(1, m_bot.Config().CombatSimulationQueueSize)));
+
 	for (auto& ability : m_bot.Observation()->GetAbilityData())
 	{
 		m_abilityCastingRanges[ability.ability_id] = ability.cast_range;
@@ -50,11 +225,11 @@ void CombatCommander::onStart()
 
 	// the squad that consists of units waiting for the squad to be big enough to begin the main attack
 	SquadOrder idleOrder(SquadOrderTypes::Idle, CCPosition(), DefaultOrderRadius, "Prepare for battle");
-	m_squadData.addSquad("Idle", Squad("Idle", idleOrder, IdlePriority, m_bot));
+	m_idleSquad = m_squadData.addSquad("Idle", Squad("Idle", idleOrder, IdlePriority, m_bot));
 
 	// the squad that consists of fleeing workers
 	SquadOrder fleeOrder(SquadOrderTypes::Retreat, CCPosition(), DefaultOrderRadius, "Worker flee");
-	m_squadData.addSquad("WorkerFlee", Squad("WorkerFlee", fleeOrder, WorkerFleePriority, m_bot));
+	m_workerFleeSquad = m_squadData.addSquad("WorkerFlee", Squad("WorkerFlee", fleeOrder, WorkerFleePriority, m_bot));
 
 	// the harass attack squad that will pressure the enemy's main base workers
 	SquadOrder harassOrder(SquadOrderTypes::Harass, CCPosition(0, 0), HarassOrderRadius, "Harass");
@@ -62,19 +237,19 @@ void CombatCommander::onStart()
 
     // the main attack squad that will pressure the enemy's closest base location
     SquadOrder mainAttackOrder(SquadOrderTypes::Attack, CCPosition(0, 0), MainAttackOrderRadius, "Attack");
-    m_squadData.addSquad("MainAttack", Squad("MainAttack", mainAttackOrder, MainAttackMaxRegroupDuration, MainAttackRegroupCooldown, MainAttackMinRetreatDuration, MainAttackMaxDistance, AttackPriority, m_bot));
+    m_mainAttackSquad = m_squadData.addSquad("MainAttack", Squad("MainAttack", mainAttackOrder, MainAttackMaxRegroupDuration, MainAttackRegroupCooldown, MainAttackMinRetreatDuration, MainAttackMaxDistance, AttackPriority, m_bot));
 
     // the backup squad that will send reinforcements to the main attack squad
     SquadOrder backupSquadOrder(SquadOrderTypes::Attack, CCPosition(0, 0), DefaultOrderRadius, "Send backups");
-    m_squadData.addSquad("Backup", Squad("Backup", backupSquadOrder, BackupPriority, m_bot));
+    m_backupSquad = m_squadData.addSquad("Backup", Squad("Backup", backupSquadOrder, BackupPriority, m_bot));
 
     // the scout defense squad will handle chasing the enemy worker scout
 	// the -5 is to prevent enemy workers (during worker rush) to get outside the base defense range
     SquadOrder enemyScoutDefense(SquadOrderTypes::Defend, m_bot.GetStartLocation(), DefaultOrderRadius - 5, "Chase scout");
-    m_squadData.addSquad("ScoutDefense", Squad("ScoutDefense", enemyScoutDefense, ScoutDefensePriority, m_bot));
+    m_scoutDefenseSquad = m_squadData.addSquad("ScoutDefense", Squad("ScoutDefense", enemyScoutDefense, ScoutDefensePriority, m_bot));
 
 	SquadOrder scoutOrder(SquadOrderTypes::Scout, CCPosition(), ScoutOrderRadius, "Scouting for new bases");
-	m_squadData.addSquad("Scout", Squad("Scout", scoutOrder, ScoutPriority, m_bot));
+	m_scoutSquad = m_squadData.addSquad("Scout", Squad("Scout", scoutOrder, ScoutPriority, m_bot));
 
 	//The influence maps are initialised earlier so we can use the blocked tiles influence map to place the turrets
 }
@@ -140,12 +315,14 @@ void CombatCommander::onFrame(const std::vector<Unit> & combatUnits)
 
 	sc2::Units units;
 	Util::CCUnitsToSc2Units(combatUnits, units);
-	m_unitsAbilities = m_bot.Query()->GetAbilitiesForUnits(units);
+	m_bot.Abilities().prefetch(units);
 
 	m_bot.StartProfiling("0.10.4.0    updateInfluenceMaps");
 	updateInfluenceMaps();
 	m_bot.StopProfiling("0.10.4.0    updateInfluenceMaps");
 
+	m_flowFields.onFrame();
+
 	m_bot.StartProfiling("0.10.4.1    CalcBestFlyingCycloneHelpers");
 	CalcBestFlyingCycloneHelpers();
 	m_bot.StopProfiling("0.10.4.1    CalcBestFlyingCycloneHelpers");
@@ -226,7 +403,11 @@ void CombatCommander::initInfluenceMaps()
 	m_groundEffectInfluenceMap.resize(mapWidth);
 	m_airEffectInfluenceMap.resize(mapWidth);
 	m_groundFromGroundCloakedCombatInfluenceMap.resize(mapWidth);
-	m_blockedTiles.resize(mapWidth);
+	m_blockedTiles = TileBitmask(mapWidth, mapHeight);
+	m_previousBlockedTiles = TileBitmask(mapWidth, mapHeight);
+	m_stampedTiles = TileBitmask(mapWidth, mapHeight);
+	m_creepTiles = TileBitmask(mapWidth, mapHeight);
+	m_previousCreepTiles = TileBitmask(mapWidth, mapHeight);
 	for(size_t x = 0; x < mapWidth; ++x)
 	{
 		auto& groundFromGroundInfluenceMapRow = m_groundFromGroundCombatInfluenceMap[x];
@@ -236,7 +417,6 @@ void CombatCommander::initInfluenceMaps()
 		auto& groundEffectInfluenceMapRow = m_groundEffectInfluenceMap[x];
 		auto& airEffectInfluenceMapRow = m_airEffectInfluenceMap[x];
 		auto& groundFromGroundCloakedCombatInfluenceMapRow = m_groundFromGroundCloakedCombatInfluenceMap[x];
-		auto& blockedTilesRow = m_blockedTiles[x];
 		groundFromGroundInfluenceMapRow.resize(mapHeight);
 		groundFromAirInfluenceMapRow.resize(mapHeight);
 		airFromGroundInfluenceMapRow.resize(mapHeight);
@@ -244,7 +424,6 @@ void CombatCommander::initInfluenceMaps()
 		groundEffectInfluenceMapRow.resize(mapHeight);
 		airEffectInfluenceMapRow.resize(mapHeight);
 		groundFromGroundCloakedCombatInfluenceMapRow.resize(mapHeight);
-		blockedTilesRow.resize(mapHeight);
 		for (size_t y = 0; y < mapHeight; ++y)
 		{
 			groundFromGroundInfluenceMapRow[y] = 0;
@@ -254,43 +433,28 @@ void CombatCommander::initInfluenceMaps()
 			groundEffectInfluenceMapRow[y] = 0;
 			airEffectInfluenceMapRow[y] = 0;
 			groundFromGroundCloakedCombatInfluenceMapRow[y] = 0;
-			blockedTilesRow[y] = false;
 		}
 	}
+
+	m_influenceMapsBuffer = std::make_unique<CombatInfluenceMaps>();
+	m_influenceMapsBuffer->resize(mapWidth, mapHeight);
+	if (m_bot.Config().PipelinedFrames)
+		m_influenceMapWorker.resize(mapWidth, mapHeight, PIPELINED_INFLUENCE_MAPS_BUFFERS);
 }
 
 void CombatCommander::resetInfluenceMaps()
 {
-	const size_t mapWidth = m_bot.Map().totalWidth();
-	const size_t mapHeight = m_bot.Map().totalHeight();
-	const bool resetBlockedTiles = m_bot.GetGameLoop() - m_lastBlockedTilesResetFrame >= BLOCKED_TILES_UPDATE_FREQUENCY;
-	if (resetBlockedTiles)
+	// the influence maps themselves are cleared when the stamps are rasterized
+	m_influenceStamps.clear();
+
+	m_changedTiles.emplace_back(m_bot.GetCurrentFrame(), std::vector<CCTilePosition>());
+	while (m_changedTiles.size() > CHANGED_TILES_HISTORY)
+		m_changedTiles.pop_front();
+
+	if (m_bot.GetGameLoop() - m_lastBlockedTilesResetFrame >= BLOCKED_TILES_UPDATE_FREQUENCY)
+	{
 		m_lastBlockedTilesResetFrame = m_bot.GetGameLoop();
-	for (size_t x = 0; x < mapWidth; ++x)
-	{
-		std::vector<float> & groundFromGroundInfluenceMap = m_groundFromGroundCombatInfluenceMap[x];
-		std::vector<float> & groundFromAirInfluenceMap = m_groundFromAirCombatInfluenceMap[x];
-		std::vector<float> & airFromGroundInfluenceMap = m_airFromGroundCombatInfluenceMap[x];
-		std::vector<float> & airFromAirInfluenceMap = m_airFromAirCombatInfluenceMap[x];
-		std::vector<float> & groundEffectInfluenceMap = m_groundEffectInfluenceMap[x];
-		std::vector<float> & airEffectInfluenceMap = m_airEffectInfluenceMap[x];
-		std::vector<float> & groundFromGroundCloakedCombatInfluenceMap = m_groundFromGroundCloakedCombatInfluenceMap[x];
-		std::fill(groundFromGroundInfluenceMap.begin(), groundFromGroundInfluenceMap.end(), 0.f);
-		std::fill(groundFromAirInfluenceMap.begin(), groundFromAirInfluenceMap.end(), 0.f);
-		std::fill(airFromGroundInfluenceMap.begin(), airFromGroundInfluenceMap.end(), 0.f);
-		std::fill(airFromAirInfluenceMap.begin(), airFromAirInfluenceMap.end(), 0.f);
-		std::fill(groundEffectInfluenceMap.begin(), groundEffectInfluenceMap.end(), 0.f);
-		std::fill(airEffectInfluenceMap.begin(), airEffectInfluenceMap.end(), 0.f);
-		std::fill(groundFromGroundCloakedCombatInfluenceMap.begin(), groundFromGroundCloakedCombatInfluenceMap.end(), 0.f);
-
-		if (resetBlockedTiles)
-		{
-			auto& blockedTilesRow = m_blockedTiles[x];
-			for (size_t y = 0; y < mapHeight; ++y)
-			{
-				blockedTilesRow[y] = false;
-			}
-		}
+		m_blockedTiles.clear();
 	}
 }
 
@@ -305,6 +469,11 @@ void CombatCommander::updateInfluenceMaps()
 	m_bot.StartProfiling("0.10.4.0.3      updateInfluenceMapsWithEffects");
 	updateInfluenceMapsWithEffects();
 	m_bot.StopProfiling("0.10.4.0.3      updateInfluenceMapsWithEffects");
+	m_bot.StartProfiling("0.10.4.0.6      applyInfluenceStamps");
+	applyInfluenceStamps();
+	m_bot.StopProfiling("0.10.4.0.6      applyInfluenceStamps");
+	updateChangedBlockedTiles();
+	updateChangedCreepTiles();
 	
 	drawInfluenceMaps();	
 	drawBlockedTiles();
@@ -481,37 +650,152 @@ void CombatCommander::updateInfluenceMapForUnit(const Unit& enemyUnit, const boo
 
 void CombatCommander::updateInfluenceMap(float dps, float range, float speed, const CCPosition & position, bool ground, bool fromGround, bool effect, bool cloaked)
 {
-	const float totalRange = range + speed;
+	m_influenceStamps.push_back({ dps, range, speed, position, ground, fromGround, effect, cloaked });
+}
+
+// The stamps read the units through the API, so they are recorded on the game thread and only their rasterization can run on the worker.
+// Every step is posted to the worker, a step it did not start before the next post is superseded by it.
+void CombatCommander::applyInfluenceStamps()
+{
+	const CCPosition mapMin = m_bot.Map().mapMin();
+	const CCPosition mapMax = m_bot.Map().mapMax();
+	const bool pipelined = m_bot.Config().PipelinedFrames;
+	++m_influenceMapsStep;
+	// Without the pipeline the maps always come from the current frame, which keeps the bot deterministic
+	if (!pipelined || !collectPipelinedInfluenceMaps())
+	{
+		m_influenceMapsBuffer->rasterize(m_influenceStamps, mapMin, mapMax);
+		m_influenceMapsBuffer->m_step = m_influenceMapsStep;
+		m_currentInfluenceMapsStep = m_influenceMapsStep;
+		swapInfluenceMaps(*m_influenceMapsBuffer);
+	}
+
+	if (pipelined)
+	{
+		m_influenceMapWorker.post(m_influenceStamps, mapMin, mapMax, m_influenceMapsStep);
+		m_influenceStamps.clear();
+	}
+}
+
+// Uses the maps rasterized in the background from a previous step if they are done, or keeps the current maps while the worker is busy.
+// The game thread never waits for the worker, it only rasterizes the current step itself when the maps it would use are too many steps old.
+bool CombatCommander::collectPipelinedInfluenceMaps()
+{
+	const uint32_t maxStaleSteps = uint32_t(std::max(0, m_bot.Config().PipelineMaxStaleSteps));
+	std::unique_ptr<CombatInfluenceMaps> maps = m_influenceMapWorker.takeResult();
+	if (maps)
+	{
+		const uint32_t step = maps->m_step;
+		const bool recentEnough = m_influenceMapsStep - step <= maxStaleSteps;
+		if (recentEnough)
+		{
+			swapInfluenceMaps(*maps);
+			m_currentInfluenceMapsStep = step;
+		}
+		m_influenceMapWorker.giveBack(std::move(maps));
+		return recentEnough;
+	}
+	return m_currentInfluenceMapsStep > 0 && m_influenceMapsStep - m_currentInfluenceMapsStep <= maxStaleSteps;
+}
+
+// The maps given back hold the previous influence, which is compared to the new one to record the changed tiles.
+// Both maps are 0 outside of their stamped tiles, so only the tiles stamped in one of them are compared.
+void CombatCommander::swapInfluenceMaps(CombatInfluenceMaps & maps)
+{
+	m_groundFromGroundCombatInfluenceMap.swap(maps.m_groundFromGround);
+	m_groundFromAirCombatInfluenceMap.swap(maps.m_groundFromAir);
+	m_airFromGroundCombatInfluenceMap.swap(maps.m_airFromGround);
+	m_airFromAirCombatInfluenceMap.swap(maps.m_airFromAir);
+	m_groundEffectInfluenceMap.swap(maps.m_groundEffect);
+	m_airEffectInfluenceMap.swap(maps.m_airEffect);
+	m_groundFromGroundCloakedCombatInfluenceMap.swap(maps.m_groundFromGroundCloaked);
+	std::swap(m_stampedTiles, maps.m_stampedTiles);
+
+	auto & changedTiles = m_changedTiles.back().second;
+	for (int y = 0; y < m_stampedTiles.height(); ++y)
+	{
+		for (int wordX = 0; wordX < m_stampedTiles.wordsPerRow(); ++wordX)
+		{
+			uint64_t stampedBits = m_stampedTiles.word(wordX, y) | maps.m_stampedTiles.word(wordX, y);
+			while (stampedBits != 0)
+			{
+				const int x = wordX * 64 + LowestBitIndex(stampedBits);
+				if (m_groundFromGroundCombatInfluenceMap[x][y] != maps.m_groundFromGround[x][y]
+					|| m_groundFromAirCombatInfluenceMap[x][y] != maps.m_groundFromAir[x][y]
+					|| m_airFromGroundCombatInfluenceMap[x][y] != maps.m_airFromGround[x][y]
+					|| m_airFromAirCombatInfluenceMap[x][y] != maps.m_airFromAir[x][y]
+					|| m_groundEffectInfluenceMap[x][y] != maps.m_groundEffect[x][y]
+					|| m_airEffectInfluenceMap[x][y] != maps.m_airEffect[x][y])
+				{
+					changedTiles.push_back(CCTilePosition(x, y));
+				}
+				stampedBits &= stampedBits - 1;
+			}
+		}
+	}
+}
+
+void CombatCommander::updateChangedBlockedTiles()
+{
+	addChangedTiles(m_blockedTiles, m_previousBlockedTiles);
+}
+
+// The creep changes the cost of the ground tiles for the path planners. It spreads slowly, so it is only read from time to time and against Zerg.
+void CombatCommander::updateChangedCreepTiles()
+{
+	const auto enemyRace = m_bot.GetPlayerRace(Players::Enemy);
+	if (enemyRace == sc2::Terran || enemyRace == sc2::Protoss)
+		return;
+	if (m_bot.GetGameLoop() - m_lastCreepUpdateFrame < BLOCKED_TILES_UPDATE_FREQUENCY)
+		return;
+	m_lastCreepUpdateFrame = m_bot.GetGameLoop();
+
+	m_creepTiles.clear();
+	for (int y = 0; y < m_creepTiles.height(); ++y)
+	{
+		for (int x = 0; x < m_creepTiles.width(); ++x)
+		{
+			if (m_bot.Map().isWalkable(x, y) && m_bot.Observation()->HasCreep(Util::GetPosition(CCTilePosition(x, y))))
+				m_creepTiles.set(x, y);
+		}
+	}
+	addChangedTiles(m_creepTiles, m_previousCreepTiles);
+}
 
-	const float fminX = floor(position.x - totalRange);
-	const float fmaxX = ceil(position.x + totalRange);
-	const float fminY = floor(position.y - totalRange);
-	const float fmaxY = ceil(position.y + totalRange);
-	const float minMapX = m_bot.Map().mapMin().x;
-	const float minMapY = m_bot.Map().mapMin().y;
-	const float maxMapX = m_bot.Map().mapMax().x;
-	const float maxMapY = m_bot.Map().mapMax().y;
-	const int minX = std::max(minMapX, fminX);
-	const int maxX = std::min(maxMapX, fmaxX);
-	const int minY = std::max(minMapY, fminY);
-	const int maxY = std::min(maxMapY, fmaxY);
-	auto& influenceMap = ground ? (effect ? m_groundEffectInfluenceMap : (fromGround ? m_groundFromGroundCombatInfluenceMap : m_groundFromAirCombatInfluenceMap)) : (effect ? m_airEffectInfluenceMap : (fromGround ? m_airFromGroundCombatInfluenceMap : m_airFromAirCombatInfluenceMap));
-	//loop for a square of size equal to the diameter of the influence circle
-	for (int x = minX; x < maxX; ++x)
+// Records the tiles that differ between the two bitmasks, then copies the current tiles into the previous ones
+void CombatCommander::addChangedTiles(const TileBitmask & tiles, TileBitmask & previousTiles)
+{
+	auto & changedTiles = m_changedTiles.back().second;
+	for (int y = 0; y < tiles.height(); ++y)
 	{
-		for (int y = minY; y < maxY; ++y)
+		for (int wordX = 0; wordX < tiles.wordsPerRow(); ++wordX)
 		{
-			const float distance = Util::Dist(position, CCPosition(x + 0.5f, y + 0.5f));
-			float multiplier = 1.f;
-			if (distance > range)
-				multiplier = std::max(0.f, (speed - (distance - range)) / speed);	//value is linearly interpolated in the speed buffer zone
-			influenceMap[x][y] += dps * multiplier;
-			if (fromGround && cloaked)
-				m_groundFromGroundCloakedCombatInfluenceMap[x][y] += dps * multiplier;
+			uint64_t changedBits = tiles.word(wordX, y) ^ previousTiles.word(wordX, y);
+			while (changedBits != 0)
+			{
+				changedTiles.push_back(CCTilePosition(wordX * 64 + LowestBitIndex(changedBits), y));
+				changedBits &= changedBits - 1;
+			}
+			previousTiles.word(wordX, y) = tiles.word(wordX, y);
 		}
 	}
 }
 
+// Adds the tiles whose influence or blocked state changed after the given frame, which has to be a frame the maps were updated on.
+// Returns false if the changes are not known back to that frame, in which case any tile may have changed.
+bool CombatCommander::getChangedTilesSince(uint32_t frame, std::vector<CCTilePosition> & tiles) const
+{
+	if (m_changedTiles.empty() || m_changedTiles.front().first > frame)
+		return false;
+	for (const auto & frameChangedTiles : m_changedTiles)
+	{
+		if (frameChangedTiles.first > frame)
+			tiles.insert(tiles.end(), frameChangedTiles.second.begin(), frameChangedTiles.second.end());
+	}
+	return true;
+}
+
+// Runs on a worker thread, it only reads its arguments
 void CombatCommander::updateBlockedTilesWithUnit(const Unit& unit)
 {
 	CCTilePosition bottomLeft;
@@ -522,7 +806,7 @@ void CombatCommander::updateBlockedTilesWithUnit(const Unit& unit)
 	{
 		for(int y = bottomLeft.y; y < topRight.y; ++y)
 		{
-			m_blockedTiles[x][y] = true;
+			m_blockedTiles.set(x, y);
 		}
 	}
 }
@@ -544,6 +828,7 @@ void CombatCommander::drawInfluenceMaps()
 	if (m_bot.Config().DrawInfluenceMaps)
 	{
 		m_bot.StartProfiling("0.10.4.0.4      drawInfluenceMaps");
+		DebugDrawScope drawScope(m_bot.Map().getDebugDraw(), DebugDrawCategory::InfluenceMaps);
 		const size_t mapWidth = m_bot.Map().totalWidth();
 		const size_t mapHeight = m_bot.Map().totalHeight();
 		for (size_t x = 0; x < mapWidth; ++x)
@@ -592,14 +877,14 @@ void CombatCommander::drawBlockedTiles()
 	if (m_bot.Config().DrawBlockedTiles)
 	{
 		m_bot.StartProfiling("0.10.4.0.5      drawBlockedTiles");
+		DebugDrawScope drawScope(m_bot.Map().getDebugDraw(), DebugDrawCategory::BlockedTiles);
 		const size_t mapWidth = m_bot.Map().totalWidth();
 		const size_t mapHeight = m_bot.Map().totalHeight();
-		for (size_t x = 0; x < mapWidth; ++x)
+		for (size_t y = 0; y < mapHeight; ++y)
 		{
-			auto& blockedTilesRow = m_blockedTiles[x];
-			for (size_t y = 0; y < mapHeight; ++y)
+			for (size_t x = 0; x < mapWidth; ++x)
 			{
-				if (blockedTilesRow[y])
+				if (m_blockedTiles.get(x, y))
 					m_bot.Map().drawTile(x, y, sc2::Colors::Red);
 			}
 		}
@@ -625,7 +910,7 @@ void CombatCommander::updateIdlePosition()
 
 void CombatCommander::updateIdleSquad()
 {
-    Squad & idleSquad = m_squadData.getSquad("Idle");
+    Squad & idleSquad = m_squadData.getSquad(m_idleSquad);
     for (auto & unit : m_combatUnits)
     {
 		if (unit.getAPIUnitType() == sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING)
@@ -654,7 +939,7 @@ void CombatCommander::updateIdleSquad()
 
 void CombatCommander::updateWorkerFleeSquad()
 {
-	Squad & workerFleeSquad = m_squadData.getSquad("WorkerFlee");
+	Squad & workerFleeSquad = m_squadData.getSquad(m_workerFleeSquad);
 	for (auto & worker : m_bot.Workers().getWorkers())
 	{
 		const CCTilePosition tile = Util::GetTilePosition(worker.getPosition());
@@ -702,8 +987,8 @@ void CombatCommander::updateBackupSquads()
         return;
     }
 
-    Squad & mainAttackSquad = m_squadData.getSquad("MainAttack");
-    Squad & backupSquad = m_squadData.getSquad("Backup");
+    Squad & mainAttackSquad = m_squadData.getSquad(m_mainAttackSquad);
+    Squad & backupSquad = m_squadData.getSquad(m_backupSquad);
 	std::vector<Unit*> idleHellions;
 	std::vector<Unit*> idleMarines;
 	std::vector<Unit*> idleVikings;
@@ -836,9 +1121,9 @@ void CombatCommander::updateBackupSquads()
 void CombatCommander::updateClearExpandSquads()
 {
 	// reset clear expand squads
-	for (const auto & kv : m_squadData.getSquads())
+	for (const auto & squadPtr : m_squadData.getSquads())
 	{
-		const Squad & squad = kv.second;
+		const Squad & squad = *squadPtr;
 		if (squad.getName().find("Clear Expand") != std::string::npos)
 		{
 			m_squadData.getSquad(squad.getName()).clear();
@@ -904,7 +1189,7 @@ void CombatCommander::updateScoutSquad()
 	if (!m_bot.Strategy().enemyHasMassZerglings() && m_bot.GetCurrentFrame() < 4704)	//around 3:30, or as soon as enemy has a lot of lings
 		return;
 
-	Squad & scoutSquad = m_squadData.getSquad("Scout");
+	Squad & scoutSquad = m_squadData.getSquad(m_scoutSquad);
 	if (scoutSquad.getUnits().empty())
 	{
 		Unit bestCandidate;
@@ -985,7 +1270,7 @@ void CombatCommander::updateHarassSquads()
 		}
 	}
 	
-	Squad & idleSquad = m_squadData.getSquad("Idle");
+	Squad & idleSquad = m_squadData.getSquad(m_idleSquad);
 	for (auto & idleUnit : idleSquad.getUnits())
 	{
 		if (idleUnit.getAPIUnitType() == sc2::UNIT_TYPEID::TERRAN_BANSHEE)
@@ -1019,7 +1304,7 @@ void CombatCommander::updateAttackSquads()
         return;
     }*/
 
-    Squad & mainAttackSquad = m_squadData.getSquad("MainAttack");
+    Squad & mainAttackSquad = m_squadData.getSquad(m_mainAttackSquad);
 
 	// Worker rush strategy is not used anymore
 	/*if (m_bot.Strategy().getStartingStrategy() == WORKER_RUSH && m_bot.GetCurrentFrame() >= 224)
@@ -1039,7 +1324,7 @@ void CombatCommander::updateAttackSquads()
 
 	const auto squadCenter = mainAttackSquad.calcCenter();
 	std::vector<Unit> unitsToTransfer;
-	Squad & backupSquad = m_squadData.getSquad("Backup");
+	Squad & backupSquad = m_squadData.getSquad(m_backupSquad);
 
 	for (auto & unit : mainAttackSquad.getUnits())
 	{
@@ -1134,23 +1419,25 @@ void CombatCommander::updateAttackSquads()
 			}
 			m_bot.StopProfiling("0.10.4.2.3.0     calcEnemies");
 			m_bot.StartProfiling("0.10.4.2.3.1     simulateCombat");
-			const float simulationResult = Util::SimulateCombat(allyUnits, enemyUnits, m_bot);
-			m_bot.StopProfiling("0.10.4.2.3.1     simulateCombat");
-			if (m_winAttackSimulation)
+			if (m_bot.Config().AsyncCombatSimulation)
 			{
-				m_winAttackSimulation = simulationResult > 0.f;
-				if (!m_winAttackSimulation)
+				// The previous decision is kept until the result of a newer simulation arrives
+				float simulationResult;
+				if (CombatSimulationService::poll(m_pendingAttackSimulation, simulationResult) && m_pendingAttackSimulationFrame >= uint32_t(m_lastRetreatFrame))
+					updateWinAttackSimulation(simulationResult);
+				if (!m_pendingAttackSimulation.valid())
 				{
-					m_bot.Actions()->SendChat("Cancel offensive", sc2::ChatChannel::Team);
-					m_lastRetreatFrame = m_bot.GetCurrentFrame();
+					Util::CombatSimulation simulation;
+					Util::PrepareCombatSimulation(allyUnits, allyUnits, enemyUnits, simulation, m_bot);
+					m_pendingAttackSimulation = m_simulationService.request(std::move(simulation), CombatSimulationService::Priority::Strategic);
+					m_pendingAttackSimulationFrame = m_bot.GetCurrentFrame();
 				}
 			}
 			else
 			{
-				m_winAttackSimulation = simulationResult > 0.5f;
-				if (m_winAttackSimulation)
-					m_bot.Actions()->SendChat("Relaunch offensive", sc2::ChatChannel::Team);
+				updateWinAttackSimulation(Util::SimulateCombat(allyUnits, enemyUnits, m_bot));
 			}
+			m_bot.StopProfiling("0.10.4.2.3.1     simulateCombat");
 			if (!m_winAttackSimulation)
 				orderPosition = m_bot.Strategy().isProxyStartingStrategy() ? Util::GetPosition(m_bot.Buildings().getProxyLocation()) : m_idlePosition;
 		}
@@ -1177,10 +1464,29 @@ void CombatCommander::updateAttackSquads()
     }*/
 }
 
+void CombatCommander::updateWinAttackSimulation(float simulationResult)
+{
+	if (m_winAttackSimulation)
+	{
+		m_winAttackSimulation = simulationResult > 0.f;
+		if (!m_winAttackSimulation)
+		{
+			m_bot.Actions()->SendChat("Cancel offensive", sc2::ChatChannel::Team);
+			m_lastRetreatFrame = m_bot.GetCurrentFrame();
+		}
+	}
+	else
+	{
+		m_winAttackSimulation = simulationResult > 0.5f;
+		if (m_winAttackSimulation)
+			m_bot.Actions()->SendChat("Relaunch offensive", sc2::ChatChannel::Team);
+	}
+}
+
 void CombatCommander::updateScoutDefenseSquad()
 {
     // if the current squad has units in it then we can ignore this
-    Squad & scoutDefenseSquad = m_squadData.getSquad("ScoutDefense");
+    Squad & scoutDefenseSquad = m_squadData.getSquad(m_scoutDefenseSquad);
 
     // get the region that our base is located in
     const BaseLocation * myBaseLocation = m_bot.Bases().getPlayerStartingBaseLocation(Players::Self);
@@ -1452,9 +1758,9 @@ struct RegionArmyInformation
 void CombatCommander::updateDefenseSquads()
 {
 	// reset defense squads
-	for (const auto & kv : m_squadData.getSquads())
+	for (const auto & squadPtr : m_squadData.getSquads())
 	{
-		const Squad & squad = kv.second;
+		const Squad & squad = *squadPtr;
 		const SquadOrder & order = squad.getSquadOrder();
 
 		if (order.getType() != SquadOrderTypes::Defend || squad.getName() == "ScoutDefense")
@@ -1477,6 +1783,7 @@ void CombatCommander::updateDefenseSquads()
 	bases.insert(ourBases.begin(), ourBases.end());
 	if (nextExpansion)
 		bases.insert(nextExpansion);
+	const auto mainRegion = m_bot.Regions().getMainRegion(Players::Self);
 	for (BaseLocation * myBaseLocation : bases)
 	{
 		// don't defend inside the enemy region, this will end badly when we are stealing gas or cannon rushing
@@ -1491,6 +1798,7 @@ void CombatCommander::updateDefenseSquads()
 		auto region = RegionArmyInformation(myBaseLocation, m_bot);
 
 		const CCPosition basePosition = Util::GetPosition(myBaseLocation->getDepotTilePosition());
+		const bool isMainBase = myBaseLocation == m_bot.Bases().getPlayerStartingBaseLocation(Players::Self);
 
 		// calculate how many units are flying / ground units
 		bool unitOtherThanWorker = false;
@@ -1510,7 +1818,9 @@ void CombatCommander::updateDefenseSquads()
 			if (!UnitType::isTargetable(unit.getAPIUnitType()))
 				continue;
 
-			if (myBaseLocation->containsUnitApproximative(unit, m_bot.Strategy().isWorkerRushed() ? WorkerRushDefenseOrderRadius : 0))
+			// The ground units anywhere in our main region are inside the main base too, like the ones dropped at its back
+			const bool inMainRegion = isMainBase && mainRegion && !unit.isFlying() && m_bot.Regions().getRegion(unit.getPosition()) == mainRegion;
+			if (inMainRegion || myBaseLocation->containsUnitApproximative(unit, m_bot.Strategy().isWorkerRushed() ? WorkerRushDefenseOrderRadius : 0))
 			{
 				if (!workerRushed && unit.getType().isWorker() && !unitOtherThanWorker && m_bot.GetGameLoop() < 4392 && myBaseLocation == m_bot.Bases().getPlayerStartingBaseLocation(Players::Self))	// first 3 minutes
 				{
@@ -2152,11 +2462,11 @@ float CombatCommander::getGroundFromGroundCloakedCombatInfluence(CCTilePosition
 
 bool CombatCommander::isTileBlocked(int x, int y)
 {
-	if (m_blockedTiles.size() <= 0)
+	if (m_blockedTiles.width() <= 0)
 	{
 		return false;
 	}
-	return m_blockedTiles[x][y];
+	return m_blockedTiles.get(x, y);
 }
 
 void CombatCommander::drawCombatInformation()
@@ -2201,12 +2511,12 @@ CCPosition CombatCommander::getMainAttackLocation()
 		}
     }
 
-	const CCPosition mainAttackSquadCenter = m_squadData.getSquad("MainAttack").calcCenter();
+	const CCPosition mainAttackSquadCenter = m_squadData.getSquad(m_mainAttackSquad).calcCenter();
 	float lowestDistance = -1.f;
 	CCPosition closestEnemyPosition;
 
     // Second choice: Attack known enemy buildings
-	Squad& mainAttackSquad = m_squadData.getSquad("MainAttack");
+	Squad& mainAttackSquad = m_squadData.getSquad(m_mainAttackSquad);
     for (const auto & enemyUnit : mainAttackSquad.getTargets())
     {
         if (enemyUnit.getType().isBuilding() && enemyUnit.isAlive() && enemyUnit.getUnitPtr()->display_type != sc2::Unit::Hidden)
@@ -2279,7 +2589,8 @@ CCPosition CombatCommander::GetClosestEnemyBaseLocation()
 	const auto & baseLocations = m_bot.Bases().getOccupiedBaseLocations(Players::Enemy);
 	for(const auto baseLocation : baseLocations)
 	{
-		const auto dist = Util::DistSq(baseLocation->getPosition(), base->getPosition());
+		const int groundDistance = m_bot.Bases().getGroundDistance(base, baseLocation);
+		const float dist = groundDistance >= 0 ? groundDistance : Util::Dist(baseLocation->getPosition(), base->getPosition());
 		if(!closestEnemyBase || dist < closestDistance)
 		{
 			closestEnemyBase = baseLocation;
@@ -2305,7 +2616,7 @@ CCPosition CombatCommander::GetNextBaseLocationToScout()
 	}
 
 	CCPosition targetBasePosition;
-	auto & squad = m_squadData.getSquad("Scout");
+	auto & squad = m_squadData.getSquad(m_scoutSquad);
 	if (!squad.getUnits().empty())
 	{
 		float minDistance = 0.f;
@@ -2753,7 +3064,7 @@ bool CombatCommander::ShouldUnitHeal(const sc2::Unit * unit) const
 				if (m_bot.Config().StarCraft2Version <= "4.10.4")
 					percentageMultiplier = 0.5f;
 				else if (m_bot.Analyzer().getUnitState(unit).GetRecentDamageTaken() * 1.8f >= unit->health
-					&& Util::IsAbilityAvailable(sc2::ABILITY_ID::EFFECT_TACTICALJUMP, unit, m_unitsAbilities))
+					&& m_bot.Abilities().isAbilityAvailable(unit, sc2::ABILITY_ID::EFFECT_TACTICALJUMP))
 					forceHeal = true;	// After version 4.10.4, Tactical Jump has a 1 second vulnerability
 				break;
 			case sc2::UNIT_TYPEID::TERRAN_CYCLONE:
@@ -2777,13 +3088,6 @@ bool CombatCommander::ShouldUnitHeal(const sc2::Unit * unit) const
 
 bool CombatCommander::GetUnitAbilities(const sc2::Unit * unit, sc2::AvailableAbilities & outUnitAbilities) const
 {
-	for (const auto & availableAbilitiesForUnit : m_unitsAbilities)
-	{
-		if (availableAbilitiesForUnit.unit_tag == unit->tag)
-		{
-			outUnitAbilities = availableAbilitiesForUnit;
-			return true;
-		}
-	}
-	return false;
+	outUnitAbilities = m_bot.Abilities().getAbilities(unit);
+	return true;
 }
\ No newline at end of file
@@ -4,6 +4,15 @@
 #include "Squad.h"
 #include "SquadData.h"
 #include "BaseLocation.h"
+#include "FlowFieldManager.h"
+#include "MapGrid.h"
+#include "CombatSimulationService.h"
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 class CCBot;
 struct RegionArmyInformation;
@@ -114,6 +123,76 @@ struct RangedUnitAction
 	}
 };
 
+// Influence circle of an enemy unit or effect, recorded during the frame and rasterized afterward
+struct InfluenceStamp
+{
+	float dps;
+	float range;
+	float speed;
+	CCPosition position;
+	bool ground;
+	bool fromGround;
+	bool effect;
+	bool cloaked;
+};
+
+// Back buffer of the combat influence maps, indexed by [x][y]. It never touches the bot so it can be filled on a worker thread.
+struct CombatInfluenceMaps
+{
+	uint32_t m_step = 0;	// influence map update (bot step) of the snapshot the maps were computed from
+	std::vector<std::vector<float>> m_groundFromGround;
+	std::vector<std::vector<float>> m_groundFromAir;
+	std::vector<std::vector<float>> m_airFromGround;
+	std::vector<std::vector<float>> m_airFromAir;
+	std::vector<std::vector<float>> m_groundEffect;
+	std::vector<std::vector<float>> m_airEffect;
+	std::vector<std::vector<float>> m_groundFromGroundCloaked;
+	TileBitmask m_stampedTiles;		// tiles in the square of a stamp, the influence is 0 on the other tiles
+
+	void resize(size_t width, size_t height);
+	void rasterize(const std::vector<InfluenceStamp> & stamps, const CCPosition & mapMin, const CCPosition & mapMax);
+};
+
+/*
+ * Persistent thread rasterizing the influence stamps of the pipelined frames.
+ * The game thread posts the stamps of every step in a mailbox that keeps only the latest step: a step still waiting when a newer one
+ * is posted is superseded (and counted), never lost silently. The worker rasterizes into a pool of buffers and keeps its latest result
+ * until the game thread takes it, the taken buffers are given back once they are swapped with the current maps.
+ */
+class InfluenceMapWorker
+{
+	std::vector<InfluenceStamp> m_stamps;
+	CCPosition m_mapMin;
+	CCPosition m_mapMax;
+	uint32_t m_step;
+	bool m_hasStamps;
+	std::vector<std::unique_ptr<CombatInfluenceMaps>> m_freeBuffers;
+	std::unique_ptr<CombatInfluenceMaps> m_result;
+	size_t m_supersededSteps;
+	bool m_stopping;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::thread m_worker;	// started by the first post
+
+	void runWorker();
+
+public:
+
+	InfluenceMapWorker();
+	~InfluenceMapWorker();
+	InfluenceMapWorker(const InfluenceMapWorker &) = delete;
+	InfluenceMapWorker & operator=(const InfluenceMapWorker &) = delete;
+
+	// Must be called before the first post
+	void resize(size_t width, size_t height, size_t bufferCount);
+	// Swaps the stamps with the ones of the mailbox, the vector given back must be cleared before reuse
+	void post(std::vector<InfluenceStamp> & stamps, const CCPosition & mapMin, const CCPosition & mapMax, uint32_t step);
+	// Returns nullptr if no new result is available, never waits
+	std::unique_ptr<CombatInfluenceMaps> takeResult();
+	void giveBack(std::unique_ptr<CombatInfluenceMaps> maps);
+	size_t getSupersededCount();
+};
+
 const float CYCLONE_PREFERRED_MAX_DISTANCE_TO_HELPER = 4.f;
 
 class CombatCommander
@@ -125,8 +204,18 @@ class CombatCommander
 	uint32_t m_lastBlockedTilesResetFrame = 0;
 	uint32_t m_lastBlockedTilesUpdateFrame = 0;
 	uint32_t m_lastIdlePositionUpdateFrame = 0;
+	uint32_t m_influenceMapsStep = 0;		// number of influence map updates so far
+	uint32_t m_currentInfluenceMapsStep = 0;	// update the current influence maps were computed from
 	CCPosition m_idlePosition;
     SquadData       m_squadData;
+    // Handles of the squads created at the start of the game, the other squads are looked up by name
+    SquadHandle     m_idleSquad;
+    SquadHandle     m_workerFleeSquad;
+    SquadHandle     m_mainAttackSquad;
+    SquadHandle     m_backupSquad;
+    SquadHandle     m_scoutDefenseSquad;
+    SquadHandle     m_scoutSquad;
+	FlowFieldManager m_flowFields;
     std::vector<Unit>  m_combatUnits;
 	std::map<const sc2::Unit *, RangedUnitAction> unitActions;
 	std::map<const sc2::Unit *, uint32_t> nextCommandFrameForUnit;
@@ -138,7 +227,19 @@ class CombatCommander
 	std::vector<std::vector<float>> m_groundEffectInfluenceMap;
 	std::vector<std::vector<float>> m_airEffectInfluenceMap;
 	std::vector<std::vector<float>> m_groundFromGroundCloakedCombatInfluenceMap;
-	std::vector<std::vector<bool>> m_blockedTiles;
+	std::vector<InfluenceStamp> m_influenceStamps;
+	std::unique_ptr<CombatInfluenceMaps> m_influenceMapsBuffer;		// rasterized on the game thread when the pipeline is off or its result is unusable
+	InfluenceMapWorker m_influenceMapWorker;	// rasterizes the stamps in the background when the pipeline is on
+	CombatSimulationService m_simulationService;
+	std::shared_future<float> m_pendingAttackSimulation;
+	uint32_t m_pendingAttackSimulationFrame = 0;
+	TileBitmask m_blockedTiles;
+	TileBitmask m_previousBlockedTiles;
+	TileBitmask m_stampedTiles;			// tiles of the current influence maps that can have influence
+	TileBitmask m_creepTiles;
+	TileBitmask m_previousCreepTiles;
+	uint32_t m_lastCreepUpdateFrame = 0;
+	std::deque<std::pair<uint32_t, std::vector<CCTilePosition>>> m_changedTiles;	// <frame, tiles whose influence or blocked state changed on that frame>
 	std::vector<CCPosition> m_enemyScans;
 	std::map<sc2::ABILITY_ID, std::map<const sc2::Unit *, uint32_t>> m_nextAvailableAbility;
 	std::map<sc2::ABILITY_ID, float> m_abilityCastingRanges;
@@ -162,7 +263,6 @@ class CombatCommander
 	uint32_t			m_lastWorkerRushDetectionFrame = 0;
 	std::map<const sc2::Unit *, FlyingHelperMission> m_cycloneFlyingHelpers;
 	std::map<const sc2::Unit *, const sc2::Unit *> m_cyclonesWithHelper;
-	std::vector<sc2::AvailableAbilities> m_unitsAbilities;
 
 	void			clearYamatoTargets();
 	void			updateIdlePosition();
@@ -176,6 +276,7 @@ class CombatCommander
 	void            updateScoutSquad();
 	void            updateHarassSquads();
 	void            updateAttackSquads();
+	void            updateWinAttackSimulation(float simulationResult);
 	void            updateIdleSquad();
 	void            updateWorkerFleeSquad();
     bool            isSquadUpdateFrame();
@@ -200,6 +301,12 @@ class CombatCommander
 	void			updateAirInfluenceMapForUnit(const Unit& enemyUnit);
 	void			updateInfluenceMapForUnit(const Unit& enemyUnit, const bool ground);
 	void			updateInfluenceMap(float dps, float range, float speed, const CCPosition & position, bool ground, bool fromGround, bool effect, bool cloaked);
+	void			applyInfluenceStamps();
+	bool			collectPipelinedInfluenceMaps();
+	void			swapInfluenceMaps(CombatInfluenceMaps & maps);
+	void			updateChangedBlockedTiles();
+	void			updateChangedCreepTiles();
+	void			addChangedTiles(const TileBitmask & tiles, TileBitmask & previousTiles);
 	void			updateBlockedTilesWithUnit(const Unit& unit);
 	void			drawCombatInformation();
 	void			drawInfluenceMaps();
@@ -225,7 +332,12 @@ public:
 	std::map<const sc2::Unit *, std::pair<const sc2::Unit *, uint32_t>> & getLockOnTargets() { return m_lockOnTargets; }
 	std::set<sc2::Tag> & getNewCyclones() { return m_newCyclones; }
 	std::set<sc2::Tag> & getToggledCyclones() { return m_toggledCyclones; }
-	const std::vector<std::vector<bool>> & getBlockedTiles() const { return m_blockedTiles; }
+	const TileBitmask & getBlockedTiles() const { return m_blockedTiles; }
+	bool getChangedTilesSince(uint32_t frame, std::vector<CCTilePosition> & tiles) const;
+	FlowFieldManager & getFlowFields() { return m_flowFields; }
+	InfluenceMapWorker & getInfluenceMapWorker() { return m_influenceMapWorker; }
+	CombatSimulationService & getSimulationService() { return m_simulationService; }
+	uint32_t getInfluenceMapsAge() const { return m_influenceMapsStep - m_currentInfluenceMapsStep; }
 	const std::map<const sc2::Unit *, FlyingHelperMission> & getCycloneFlyingHelpers() const { return m_cycloneFlyingHelpers; }
 	const std::map<const sc2::Unit *, const sc2::Unit *> & getCyclonesWithHelper() const { return m_cyclonesWithHelper; }
 	float getTotalGroundInfluence(CCTilePosition tilePosition) const;
@@ -0,0 +1,151 @@
+#include "CombatSimulationService.h"
+#include <algorithm>
+
+CombatSimulationService::CombatSimulationService(size_t maxQueuedRequests)
+	: m_maxQueuedRequests(maxQueuedRequests)
+	, m_refusedRequests(0)
+	, m_stopping(false)
+{
+}
+
+CombatSimulationService::~CombatSimulationService()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_condition.notify_all();
+	if (m_worker.joinable())
+		m_worker.join();
+}
+
+std::shared_future<float> CombatSimulationService::request(Util::CombatSimulation && simulation, Priority priority)
+{
+	// The known results do not need the worker
+	if (simulation.knownResult >= 0.f)
+	{
+		std::promise<float> promise;
+		promise.set_value(simulation.knownResult);
+		return promise.get_future().share();
+	}
+
+	const uint64_t hash = simulation.getHash();
+	std::lock_guard<std::mutex> lock(m_mutex);
+	const auto it = m_pendingResults.find(hash);
+	if (it != m_pendingResults.end())
+	{
+		// A micro critical request for the state of a queued strategic one moves it ahead
+		if (priority == Priority::MicroCritical)
+		{
+			const auto queuedIt = std::find_if(m_strategicQueue.begin(), m_strategicQueue.end(), [hash](const Request & queued) { return queued.hash == hash; });
+			if (queuedIt != m_strategicQueue.end())
+			{
+				m_microCriticalQueue.push_back(std::move(*queuedIt));
+				m_strategicQueue.erase(queuedIt);
+			}
+		}
+		return it->second;
+	}
+
+	if (m_microCriticalQueue.size() + m_strategicQueue.size() >= m_maxQueuedRequests)
+	{
+		if (priority == Priority::Strategic || m_strategicQueue.empty())
+		{
+			++m_refusedRequests;
+			return std::shared_future<float>();
+		}
+		// The promise of the replaced request is destroyed, which stores a broken promise exception in its future
+		m_pendingResults.erase(m_strategicQueue.back().hash);
+		m_strategicQueue.pop_back();
+		++m_refusedRequests;
+	}
+
+	if (!m_worker.joinable())
+		m_worker = std::thread(&CombatSimulationService::runWorker, this);
+
+	auto & queue = priority == Priority::MicroCritical ? m_microCriticalQueue : m_strategicQueue;
+	queue.push_back({ hash, std::move(simulation), std::promise<float>() });
+	const auto future = queue.back().promise.get_future().share();
+	m_pendingResults[hash] = future;
+	m_condition.notify_one();
+	return future;
+}
+
+bool CombatSimulationService::poll(std::shared_future<float> & future, float & result)
+{
+	if (!future.valid() || future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return false;
+	const auto readyFuture = future;
+	future = std::shared_future<float>();
+	try
+	{
+		result = readyFuture.get();
+	}
+	catch (...)
+	{
+		return false;
+	}
+	return true;
+}
+
+// Takes the oldest micro critical request, or else the oldest strategic one, waits for one if both queues are empty. Returns false when stopping.
+bool CombatSimulationService::popRequest(Request & request)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		if (m_stopping)
+			return false;
+		auto & queue = !m_microCriticalQueue.empty() ? m_microCriticalQueue : m_strategicQueue;
+		if (!queue.empty())
+		{
+			request = std::move(queue.front());
+			queue.pop_front();
+			return true;
+		}
+		m_condition.wait(lock);
+	}
+}
+
+void CombatSimulationService::runWorker()
+{
+	Request request;
+	while (popRequest(request))
+	{
+		float result = 0.f;
+		std::exception_ptr exception;
+		try
+		{
+			result = Util::RunCombatSimulation(request.simulation);
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+		// The result is pending until it is set, so a request for the same state cannot start a new simulation in between
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (exception)
+			request.promise.set_exception(exception);
+		else
+			request.promise.set_value(result);
+		m_pendingResults.erase(request.hash);
+	}
+}
+
+void CombatSimulationService::setMaxQueuedRequests(size_t maxQueuedRequests)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_maxQueuedRequests = maxQueuedRequests;
+}
+
+size_t CombatSimulationService::getQueuedCount()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_microCriticalQueue.size() + m_strategicQueue.size();
+}
+
+size_t CombatSimulationService::getRefusedCount()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_refusedRequests;
+}
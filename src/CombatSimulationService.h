@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Util.h"
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+/*
+ * Runs the combat simulations on a worker thread so no frame has to carry a full army simulation.
+ * The simulations are prepared on the game thread (Util::PrepareCombatSimulation) and their results are polled on the next frames,
+ * the caller keeps its previous decision until then. A request for the same state as a pending one shares its future.
+ * The micro critical requests are run before the strategic ones, each class in order. The queue is bounded: a strategic request
+ * is refused when it is full, a micro critical one replaces the newest strategic request, whose future then holds an exception.
+ */
+class CombatSimulationService
+{
+public:
+
+	enum class Priority
+	{
+		MicroCritical,
+		Strategic
+	};
+
+private:
+
+	struct Request
+	{
+		uint64_t hash;
+		Util::CombatSimulation simulation;
+		std::promise<float> promise;
+	};
+
+	size_t m_maxQueuedRequests;
+	std::deque<Request> m_microCriticalQueue;
+	std::deque<Request> m_strategicQueue;
+	std::map<uint64_t, std::shared_future<float>> m_pendingResults;	// <hash, result> of the queued and running requests
+	size_t m_refusedRequests;
+	bool m_stopping;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::thread m_worker;	// started by the first request
+
+	void runWorker();
+	bool popRequest(Request & request);
+
+public:
+
+	CombatSimulationService(size_t maxQueuedRequests);
+	~CombatSimulationService();
+	CombatSimulationService(const CombatSimulationService &) = delete;
+	CombatSimulationService & operator=(const CombatSimulationService &) = delete;
+
+	// Returns an invalid future when the queue is full
+	std::shared_future<float> request(Util::CombatSimulation && simulation, Priority priority);
+	// Returns true and resets the future if its result is available, never waits. A future holding an exception
+	// (failed or replaced request) is reset without a result so the caller makes a new request.
+	static bool poll(std::shared_future<float> & future, float & result);
+
+	void setMaxQueuedRequests(size_t maxQueuedRequests);
+	size_t getQueuedCount();
+	size_t getRefusedCount();
+};
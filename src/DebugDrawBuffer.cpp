@@ -0,0 +1,190 @@
+#include "DebugDrawBuffer.h"
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+namespace
+{
+	const char * CategoryNames[] = { "General", "Map", "InfluenceMaps", "BlockedTiles", "Pathfinding", "Squads", "Profiling" };
+	static_assert(sizeof(CategoryNames) / sizeof(CategoryNames[0]) == size_t(DebugDrawCategory::Count), "Every debug draw category needs a name");
+
+	bool HaveSameLook(const DebugDrawBuffer::Tile & a, const DebugDrawBuffer::Tile & b)
+	{
+		return a.color.r == b.color.r && a.color.g == b.color.g && a.color.b == b.color.b && a.size == b.size;
+	}
+
+	// Groups the tiles of the same look, then sorts them row by row so the tiles that can be merged are consecutive
+	bool IsTileBefore(const DebugDrawBuffer::Tile & a, const DebugDrawBuffer::Tile & b)
+	{
+		return std::tie(a.color.r, a.color.g, a.color.b, a.size, a.y, a.x) < std::tie(b.color.r, b.color.g, b.color.b, b.size, b.y, b.x);
+	}
+
+	// A scope on a micro thread must not change the category of the primitives added by the game thread
+	thread_local DebugDrawCategory currentCategory = DebugDrawCategory::General;
+}
+
+DebugDrawBuffer::DebugDrawBuffer()
+	: m_maxPrimitivesPerCategory(0)
+	, m_coalesceTiles(true)
+	, m_enabled(true)
+{
+	m_enabledCategories.fill(true);
+	m_primitiveCounts.fill(0);
+	m_droppedCounts.fill(0);
+}
+
+const char * DebugDrawBuffer::GetCategoryName(DebugDrawCategory category)
+{
+	return CategoryNames[int(category)];
+}
+
+bool DebugDrawBuffer::GetCategoryFromName(const std::string & name, DebugDrawCategory & category)
+{
+	for (int i = 0; i < CategoryCount; ++i)
+	{
+		if (name == CategoryNames[i])
+		{
+			category = DebugDrawCategory(i);
+			return true;
+		}
+	}
+	return false;
+}
+
+DebugDrawCategory DebugDrawBuffer::getCategory() const
+{
+	return currentCategory;
+}
+
+void DebugDrawBuffer::setCategory(DebugDrawCategory category)
+{
+	currentCategory = category;
+}
+
+// Counts a primitive against the budget of the current category, returns false if it must be dropped. The mutex must be locked.
+bool DebugDrawBuffer::isEnabled() const
+{
+	return m_enabled && m_enabledCategories[int(currentCategory)];
+}
+
+bool DebugDrawBuffer::reservePrimitive()
+{
+	const int category = int(currentCategory);
+	if (!m_enabledCategories[category])
+		return false;
+	if (m_maxPrimitivesPerCategory > 0 && m_primitiveCounts[category] >= m_maxPrimitivesPerCategory)
+	{
+		++m_droppedCounts[category];
+		return false;
+	}
+	++m_primitiveCounts[category];
+	return true;
+}
+
+void DebugDrawBuffer::addLine(const sc2::Point3D & p1, const sc2::Point3D & p2, const CCColor & color)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (reservePrimitive())
+		m_lines.push_back({ p1, p2, color });
+}
+
+void DebugDrawBuffer::addBox(const sc2::Point3D & min, const sc2::Point3D & max, const CCColor & color)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (reservePrimitive())
+		m_boxes.push_back({ min, max, color });
+}
+
+void DebugDrawBuffer::addSphere(const sc2::Point3D & center, float radius, const CCColor & color)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (reservePrimitive())
+		m_spheres.push_back({ center, radius, color });
+}
+
+void DebugDrawBuffer::addText(const std::string & text, const sc2::Point3D & position, const CCColor & color)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (reservePrimitive())
+		m_texts.push_back({ text, position, color, false });
+}
+
+void DebugDrawBuffer::addScreenText(const std::string & text, float xPerc, float yPerc, const CCColor & color)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (reservePrimitive())
+		m_texts.push_back({ text, sc2::Point3D(xPerc, yPerc, 0.f), color, true });
+}
+
+void DebugDrawBuffer::addTile(int x, int y, const CCColor & color, float size)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (reservePrimitive())
+		m_tiles.push_back({ x, y, color, size });
+}
+
+// Merges the tiles of the same look into horizontal runs, then stacks the runs covering the same columns on consecutive rows
+std::vector<DebugDrawBuffer::TileRectangle> DebugDrawBuffer::getTileRectangles() const
+{
+	std::vector<TileRectangle> rectangles;
+	if (!m_coalesceTiles)
+	{
+		for (const auto & tile : m_tiles)
+			rectangles.push_back({ tile.x, tile.y, tile.x + 1, tile.y + 1, tile.color, tile.size });
+		return rectangles;
+	}
+
+	std::vector<Tile> tiles = m_tiles;
+	std::sort(tiles.begin(), tiles.end(), IsTileBefore);
+
+	std::map<std::pair<int, int>, size_t> openRectangles;	// <minX, maxX> -> index of the last rectangle covering these columns in the current look
+	for (size_t i = 0; i < tiles.size();)
+	{
+		const Tile & first = tiles[i];
+		if (i == 0 || !HaveSameLook(first, tiles[i - 1]))
+			openRectangles.clear();
+
+		int maxX = first.x + 1;
+		size_t next = i + 1;
+		// the same tile can be drawn more than once, it then has x == maxX - 1
+		while (next < tiles.size() && HaveSameLook(first, tiles[next]) && tiles[next].y == first.y && tiles[next].x <= maxX)
+		{
+			maxX = std::max(maxX, tiles[next].x + 1);
+			++next;
+		}
+
+		const auto columns = std::make_pair(first.x, maxX);
+		const auto it = openRectangles.find(columns);
+		if (it != openRectangles.end() && rectangles[it->second].maxY == first.y)
+		{
+			rectangles[it->second].maxY = first.y + 1;
+		}
+		else
+		{
+			openRectangles[columns] = rectangles.size();
+			rectangles.push_back({ first.x, first.y, maxX, first.y + 1, first.color, first.size });
+		}
+		i = next;
+	}
+	return rectangles;
+}
+
+int DebugDrawBuffer::getTotalDroppedCount() const
+{
+	int total = 0;
+	for (int dropped : m_droppedCounts)
+		total += dropped;
+	return total;
+}
+
+void DebugDrawBuffer::clear()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_lines.clear();
+	m_boxes.clear();
+	m_spheres.clear();
+	m_texts.clear();
+	m_tiles.clear();
+	m_primitiveCounts.fill(0);
+	m_droppedCounts.fill(0);
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Common.h"
+#include <mutex>
+
+enum class DebugDrawCategory
+{
+	General,
+	Map,
+	InfluenceMaps,
+	BlockedTiles,
+	Pathfinding,
+	Squads,
+	Profiling,
+	Count
+};
+
+/*
+ * Debug primitives recorded during the frame and sent to the debug interface once per frame by MapTools::flushDebugDraw.
+ * Each category can be disabled and has a per-frame primitive budget, the primitives over the budget are dropped.
+ * Tiles of the same color and size are coalesced into rectangles, so a grid of tiles only costs a few lines.
+ * The buffer does not know the camera, MapTools culls the primitives before adding them.
+ * The primitives can be added from the micro threads, the current category is kept per thread. The buffer is read and cleared
+ * on the game thread once the micro threads are done.
+ */
+class DebugDrawBuffer
+{
+public:
+
+	struct Line
+	{
+		sc2::Point3D p1;
+		sc2::Point3D p2;
+		CCColor color;
+	};
+
+	struct Box
+	{
+		sc2::Point3D min;
+		sc2::Point3D max;
+		CCColor color;
+	};
+
+	struct Sphere
+	{
+		sc2::Point3D center;
+		float radius;
+		CCColor color;
+	};
+
+	struct Text
+	{
+		std::string text;
+		sc2::Point3D position;	// x and y are ratios of the screen size for screen texts
+		CCColor color;
+		bool screen;
+	};
+
+	struct Tile
+	{
+		int x;
+		int y;
+		CCColor color;
+		float size;
+	};
+
+	// tiles from (minX, minY) included to (maxX, maxY) excluded
+	struct TileRectangle
+	{
+		int minX;
+		int minY;
+		int maxX;
+		int maxY;
+		CCColor color;
+		float size;
+	};
+
+private:
+
+	static const int CategoryCount = int(DebugDrawCategory::Count);
+
+	std::vector<Line> m_lines;
+	std::vector<Box> m_boxes;
+	std::vector<Sphere> m_spheres;
+	std::vector<Text> m_texts;
+	std::vector<Tile> m_tiles;
+	std::mutex m_mutex;
+	std::array<bool, CategoryCount> m_enabledCategories;
+	std::array<int, CategoryCount> m_primitiveCounts;
+	std::array<int, CategoryCount> m_droppedCounts;
+	int m_maxPrimitivesPerCategory;		// 0 means no budget
+	bool m_coalesceTiles;
+	bool m_enabled;
+
+	bool reservePrimitive();
+
+public:
+
+	DebugDrawBuffer();
+
+	static const char * GetCategoryName(DebugDrawCategory category);
+	static bool GetCategoryFromName(const std::string & name, DebugDrawCategory & category);
+
+	// category of the primitives added by the calling thread
+	DebugDrawCategory getCategory() const;
+	void setCategory(DebugDrawCategory category);
+	bool isCategoryEnabled(DebugDrawCategory category) const { return m_enabledCategories[int(category)]; }
+	void setCategoryEnabled(DebugDrawCategory category, bool enabled) { m_enabledCategories[int(category)] = enabled; }
+	// false when the primitives added by the calling thread would be discarded, the draw calls return before preparing them
+	bool isEnabled() const;
+	void setEnabled(bool enabled) { m_enabled = enabled; }
+	void setMaxPrimitivesPerCategory(int maxPrimitives) { m_maxPrimitivesPerCategory = maxPrimitives; }
+	void setCoalesceTiles(bool coalesceTiles) { m_coalesceTiles = coalesceTiles; }
+
+	void addLine(const sc2::Point3D & p1, const sc2::Point3D & p2, const CCColor & color);
+	void addBox(const sc2::Point3D & min, const sc2::Point3D & max, const CCColor & color);
+	void addSphere(const sc2::Point3D & center, float radius, const CCColor & color);
+	void addText(const std::string & text, const sc2::Point3D & position, const CCColor & color);
+	void addScreenText(const std::string & text, float xPerc, float yPerc, const CCColor & color);
+	void addTile(int x, int y, const CCColor & color, float size);
+
+	const std::vector<Line> & getLines() const { return m_lines; }
+	const std::vector<Box> & getBoxes() const { return m_boxes; }
+	const std::vector<Sphere> & getSpheres() const { return m_spheres; }
+	const std::vector<Text> & getTexts() const { return m_texts; }
+	std::vector<TileRectangle> getTileRectangles() const;
+	int getDroppedCount(DebugDrawCategory category) const { return m_droppedCounts[int(category)]; }
+	int getTotalDroppedCount() const;
+
+	void clear();
+};
+
+// Draws the primitives added in its scope in the given category, the previous category is restored when it is destroyed
+class DebugDrawScope
+{
+	DebugDrawBuffer & m_buffer;
+	DebugDrawCategory m_previousCategory;
+
+public:
+
+	DebugDrawScope(DebugDrawBuffer & buffer, DebugDrawCategory category)
+		: m_buffer(buffer)
+		, m_previousCategory(buffer.getCategory())
+	{
+		m_buffer.setCategory(category);
+	}
+
+	~DebugDrawScope()
+	{
+		m_buffer.setCategory(m_previousCategory);
+	}
+
+	DebugDrawScope(const DebugDrawScope &) = delete;
+	DebugDrawScope & operator=(const DebugDrawScope &) = delete;
+};
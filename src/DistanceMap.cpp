@@ -2,11 +2,10 @@
 #include "CCBot.h"
 #include "Util.h"
 
-const size_t LegalActions = 4;
-const int actionX[LegalActions] = {1, -1, 0, 0};
-const int actionY[LegalActions] = {0, 0, 1, -1};
-
 DistanceMap::DistanceMap() 
+    : m_width(0)
+    , m_height(0)
+    , m_maxDistance(-1)
 {
     
 }
@@ -14,7 +13,7 @@ DistanceMap::DistanceMap()
 int DistanceMap::getDistance(int tileX, int tileY) const
 {  
     BOT_ASSERT(tileX < m_width && tileY < m_height, "Index out of range: X = %d, Y = %d", tileX, tileY);
-    return m_dist[tileX][tileY]; 
+    return m_dist[tileY * m_width + tileX]; 
 }
 
 int DistanceMap::getDistance(const CCTilePosition & pos) const
@@ -36,50 +35,74 @@ const std::vector<CCTilePosition> & DistanceMap::getSortedTiles() const
     return m_sortedTiles;
 }
 
-// Computes m_dist[x][y] = ground distance from (startX, startY) to (x,y)
-// Uses BFS, since the map is quite large and DFS may cause a stack overflow
-void DistanceMap::computeDistanceMap(CCBot & m_bot, const CCTilePosition & startTile)
+// Tiles are ordered by distance, then by row and column. They are bucketed from the distance layer, which is a single pass over the map.
+void DistanceMap::computeSortedTiles()
 {
-    m_startTile = startTile;
-    m_width = m_bot.Map().totalWidth();
-    m_height = m_bot.Map().totalHeight();
-    m_dist = std::vector<std::vector<int>>(m_width, std::vector<int>(m_height, -1));
-    m_sortedTiles.reserve(m_width * m_height);
-
-    // the fringe for the BFS we will perform to calculate distances
-    std::vector<CCTilePosition> fringe;
-    fringe.reserve(m_width * m_height);
-    fringe.push_back(startTile);
-    m_sortedTiles.push_back(startTile);
-
-    m_dist[(int)startTile.x][(int)startTile.y] = 0;
-
-    for (size_t fringeIndex=0; fringeIndex<fringe.size(); ++fringeIndex)
+    std::vector<int> layerStart(m_maxDistance + 2, 0);
+    for (int dist : m_dist)
     {
-        auto & tile = fringe[fringeIndex];
-
-        // check every possible child of this tile
-        for (size_t a=0; a<LegalActions; ++a)
+        if (dist >= 0)
         {
-            CCTilePosition nextTile(tile.x + actionX[a], tile.y + actionY[a]);
+            ++layerStart[dist + 1];
+        }
+    }
+    for (int d = 1; d <= m_maxDistance + 1; ++d)
+    {
+        layerStart[d] += layerStart[d - 1];
+    }
 
-            // if the new tile is inside the map bounds, is walkable, and has not been visited yet, set the distance of its parent + 1
-            if (m_bot.Map().isWalkable(nextTile) && getDistance(nextTile) == -1)
+    m_sortedTiles.resize(layerStart[m_maxDistance + 1]);
+    for (int y = 0; y < m_height; ++y)
+    {
+        for (int x = 0; x < m_width; ++x)
+        {
+            const int dist = m_dist[y * m_width + x];
+            if (dist >= 0)
             {
-                m_dist[(int)nextTile.x][(int)nextTile.y] = m_dist[(int)tile.x][(int)tile.y] + 1;
-                fringe.push_back(nextTile);
-                m_sortedTiles.push_back(nextTile);
+                m_sortedTiles[layerStart[dist]++] = CCTilePosition(x, y);
             }
         }
     }
 }
 
+// Computes m_dist = ground distance from (startX, startY) to every tile
+// Uses a breadth-first wavefront over the walkable bitmask of the map, one distance layer per step
+void DistanceMap::computeDistanceMap(CCBot & m_bot, const CCTilePosition & startTile)
+{
+    const TileBitmask & walkable = m_bot.Map().getWalkableMask();
+    m_startTile = startTile;
+    m_width = walkable.width();
+    m_height = walkable.height();
+    m_dist.assign(m_width * m_height, -1);
+    m_sortedTiles.clear();
+    m_maxDistance = -1;
+
+    if (startTile.x < 0 || startTile.y < 0 || startTile.x >= m_width || startTile.y >= m_height)
+    {
+        return;
+    }
+
+    WalkableWavefront wavefront(walkable);
+    wavefront.addStart(startTile.x, startTile.y);
+    m_dist[startTile.y * m_width + startTile.x] = 0;
+    m_maxDistance = 0;
+
+    int distance = 1;
+    auto setDistance = [this, &distance](int x, int y) { m_dist[y * m_width + x] = distance; };
+    while (wavefront.step(setDistance))
+    {
+        m_maxDistance = distance++;
+    }
+
+    computeSortedTiles();
+}
+
 void DistanceMap::draw(CCBot & bot) const
 {
     const int tilesToDraw = 200;
     for (size_t i(0); i < tilesToDraw; ++i)
     {
-        auto & tile = m_sortedTiles[i];
+        auto & tile = getSortedTiles()[i];
         int dist = getDistance(tile);
 
         CCPosition textPos(tile.x + Util::TileToPosition(0.5), tile.y + Util::TileToPosition(0.5));
@@ -1,24 +1,159 @@
 #pragma once
 
 #include "Common.h"
+#include "libvoxelbot/utilities/aligned_allocator.h"
+#include <cstdint>
 #include <map>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 class CCBot;
 
+const size_t CacheLineSize = 64;
+
+// One bit per tile, stored in rows of 64-tile words so that searches can process a whole word of tiles at a time
+class TileBitmask
+{
+    int m_width;
+    int m_height;
+    int m_wordsPerRow;
+    std::vector<uint64_t, AlignedAllocator<uint64_t, CacheLineSize>> m_words;
+
+public:
+
+    TileBitmask() : m_width(0), m_height(0), m_wordsPerRow(0) {}
+    TileBitmask(int width, int height)
+        : m_width(width), m_height(height), m_wordsPerRow((width + 63) / 64), m_words(m_wordsPerRow * height, 0) {}
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    int wordsPerRow() const { return m_wordsPerRow; }
+
+    uint64_t & word(int wordX, int y) { return m_words[y * m_wordsPerRow + wordX]; }
+    uint64_t word(int wordX, int y) const { return m_words[y * m_wordsPerRow + wordX]; }
+
+    bool get(int x, int y) const { return (word(x / 64, y) >> (x % 64)) & 1; }
+    void set(int x, int y) { word(x / 64, y) |= uint64_t(1) << (x % 64); }
+    void set(int x, int y, bool value) { if (value) set(x, y); else unset(x, y); }
+    void unset(int x, int y) { word(x / 64, y) &= ~(uint64_t(1) << (x % 64)); }
+    void clear() { std::fill(m_words.begin(), m_words.end(), 0); }
+    void clearRow(int y) { std::fill(m_words.begin() + y * m_wordsPerRow, m_words.begin() + (y + 1) * m_wordsPerRow, 0); }
+};
+
+inline int LowestBitIndex(uint64_t bits)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return (int)index;
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+// 4-directional breadth-first search over the walkable tiles. Instead of visiting the fringe tile by tile,
+// each step grows the whole frontier by one tile with word-wide shifts and masks it with the walkable tiles.
+class WalkableWavefront
+{
+    const TileBitmask & m_walkable;
+    TileBitmask m_visited;
+    TileBitmask m_frontier;
+    TileBitmask m_next;
+    int m_minRow;       // rows spanned by the frontier, the other rows of m_frontier and all of m_next are empty
+    int m_maxRow;
+
+public:
+
+    WalkableWavefront(const TileBitmask & walkable)
+        : m_walkable(walkable)
+        , m_visited(walkable.width(), walkable.height())
+        , m_frontier(walkable.width(), walkable.height())
+        , m_next(walkable.width(), walkable.height())
+        , m_minRow(walkable.height())
+        , m_maxRow(-1)
+    {
+    }
+
+    bool isVisited(int x, int y) const { return m_visited.get(x, y); }
+
+    // the start tile does not need to be walkable, only the tiles reached from it do
+    void addStart(int x, int y)
+    {
+        m_visited.set(x, y);
+        m_frontier.set(x, y);
+        m_minRow = std::min(m_minRow, y);
+        m_maxRow = std::max(m_maxRow, y);
+    }
+
+    // expands the frontier by one tile and calls visit(x, y) for every tile reached for the first time,
+    // returns false once no new tile can be reached
+    template <typename Visitor>
+    bool step(Visitor visit)
+    {
+        const int words = m_walkable.wordsPerRow();
+        const int firstRow = std::max(0, m_minRow - 1);
+        const int lastRow = std::min(m_walkable.height() - 1, m_maxRow + 1);
+        int minRow = m_walkable.height();
+        int maxRow = -1;
 
-class DistanceMap 
+        for (int y = firstRow; y <= lastRow; ++y)
+        {
+            for (int k = 0; k < words; ++k)
+            {
+                const uint64_t frontier = m_frontier.word(k, y);
+                uint64_t grown = frontier | (frontier << 1) | (frontier >> 1);
+                if (k > 0) grown |= m_frontier.word(k - 1, y) >> 63;
+                if (k < words - 1) grown |= m_frontier.word(k + 1, y) << 63;
+                if (y > 0) grown |= m_frontier.word(k, y - 1);
+                if (y < m_walkable.height() - 1) grown |= m_frontier.word(k, y + 1);
+
+                uint64_t reached = grown & m_walkable.word(k, y) & ~m_visited.word(k, y);
+                if (reached == 0)
+                {
+                    continue;
+                }
+
+                m_next.word(k, y) = reached;
+                m_visited.word(k, y) |= reached;
+                minRow = std::min(minRow, y);
+                maxRow = y;
+                for (; reached != 0; reached &= reached - 1)
+                {
+                    visit(k * 64 + LowestBitIndex(reached), y);
+                }
+            }
+        }
+
+        for (int y = m_minRow; y <= m_maxRow; ++y)
+        {
+            m_frontier.clearRow(y);
+        }
+        std::swap(m_frontier, m_next);
+        m_minRow = minRow;
+        m_maxRow = maxRow;
+        return maxRow >= 0;
+    }
+};
+
+class DistanceMap
 {
     int m_width;
     int m_height;
+    int m_maxDistance;
     CCTilePosition m_startTile;
 
-    // 2D matrix storing distances from the start tile
-    std::vector<std::vector<int>> m_dist;
+    // distances from the start tile, indexed by y * m_width + x (-1 when unreachable)
+    std::vector<int> m_dist;
 
+    // built with the distances so the distance maps shared with the micro threads are never written afterward
     std::vector<CCTilePosition> m_sortedTiles;
-    
+
+    void computeSortedTiles();
+
 public:
-    
+
     DistanceMap();
     void computeDistanceMap(CCBot & m_bot, const CCTilePosition & startTile);
 
@@ -31,4 +166,4 @@ public:
     const CCTilePosition & getStartTile() const;
 
     void draw(CCBot & bot) const;
-};
\ No newline at end of file
+};
@@ -0,0 +1,220 @@
+#include "FlowFieldManager.h"
+#include "CCBot.h"
+#include "Util.h"
+#include "libvoxelbot/utilities/pathfinding.h"
+
+const uint32_t FLOW_FIELD_EPOCH_FRAME_COUNT = 8;		// the influence maps are considered unchanged for that many frames
+const uint32_t FLOW_FIELD_MAX_STALE_EPOCHS = 2;			// a field computed with older influence maps than this is not used anymore
+const uint32_t FLOW_FIELD_KEEP_FRAMES = 48;				// a field that was not requested for that many frames is dropped
+const float FLOW_FIELD_TILE_BASE_COST = 1.f;
+const float FLOW_FIELD_TILE_CREEP_COST = 0.5f;
+
+float FlowField::getDistance(CCTilePosition tile) const
+{
+	if (tile.x < 0 || tile.y < 0 || tile.x >= m_distances.w || tile.y >= m_distances.h)
+		return std::numeric_limits<float>::infinity();
+	return float(m_distances(tile.x, tile.y));
+}
+
+CCTilePosition FlowField::getNextTile(CCTilePosition tile) const
+{
+	CCTilePosition nextTile = tile;
+	float nextTileDistance = getDistance(tile);
+	for (int x = -1; x <= 1; ++x)
+	{
+		for (int y = -1; y <= 1; ++y)
+		{
+			if (x == 0 && y == 0)
+				continue;
+			// Do not cut corners, the unreachable tiles have an infinite distance
+			if (x != 0 && y != 0 && (std::isinf(getDistance(CCTilePosition(tile.x + x, tile.y))) || std::isinf(getDistance(CCTilePosition(tile.x, tile.y + y)))))
+				continue;
+			const CCTilePosition neighbor(tile.x + x, tile.y + y);
+			const float distance = getDistance(neighbor);
+			if (distance < nextTileDistance)
+			{
+				nextTile = neighbor;
+				nextTileDistance = distance;
+			}
+		}
+	}
+	return nextTile;
+}
+
+// Returns the center of the tile reached after following the field for the given number of steps, or (0, 0) if the goal is not reachable
+CCPosition FlowField::getMovePosition(CCPosition position, int steps) const
+{
+	const CCTilePosition startTile = Util::GetTilePosition(position);
+	if (std::isinf(getDistance(startTile)))
+		return CCPosition();
+
+	CCTilePosition tile = startTile;
+	for (int i = 0; i < steps; ++i)
+	{
+		const CCTilePosition nextTile = getNextTile(tile);
+		if (nextTile == tile)
+			break;
+		tile = nextTile;
+	}
+	if (tile == startTile)
+		return CCPosition();
+	return Util::GetPosition(tile) + CCPosition(0.5f, 0.5f);
+}
+
+FlowFieldManager::FlowFieldManager(CCBot & bot)
+	: m_bot(bot)
+	, m_costsEpoch(0)
+	, m_stopping(false)
+	, m_requestCount(0)
+	, m_computeCount(0)
+	, m_lastFrameRequestCount(0)
+	, m_lastFrameComputeCount(0)
+{
+}
+
+FlowFieldManager::~FlowFieldManager()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_condition.notify_all();
+	if (m_worker.joinable())
+		m_worker.join();
+}
+
+void FlowFieldManager::onFrame()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_lastFrameRequestCount = m_requestCount;
+	m_lastFrameComputeCount = m_computeCount;
+	m_requestCount = 0;
+	m_computeCount = 0;
+
+	const uint32_t currentFrame = m_bot.GetCurrentFrame();
+	for (auto it = m_flowFields.begin(); it != m_flowFields.end();)
+	{
+		auto & entry = it->second;
+		// We don't want to block on a computation in progress, the entry will be dropped once it is done
+		if (!entry.m_pending && currentFrame - entry.m_lastRequestFrame > FLOW_FIELD_KEEP_FRAMES)
+		{
+			it = m_flowFields.erase(it);
+			continue;
+		}
+		++it;
+	}
+
+	// Called right after the influence maps are updated, the grids are only needed once some field was requested
+	const uint32_t epoch = getCurrentEpoch();
+	if (!m_flowFields.empty() && (!m_groundCosts || m_costsEpoch != epoch))
+	{
+		m_groundCosts = std::make_shared<const InfluenceMap>(createCostGrid(false));
+		m_airCosts = std::make_shared<const InfluenceMap>(createCostGrid(true));
+		m_costsEpoch = epoch;
+	}
+}
+
+// Returns the flow field toward the goal for the given layer, or nullptr if no recent enough field is available yet.
+// In the latter case, the caller should fall back on the regular pathfinding.
+std::shared_ptr<const FlowField> FlowFieldManager::getFlowField(CCPosition goal, bool flying)
+{
+	const CCTilePosition goalTile = Util::GetTilePosition(goal);
+	if (goal == CCPosition() || !m_bot.Map().isValidTile(goalTile))
+		return nullptr;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	++m_requestCount;
+	auto & entry = m_flowFields[FlowFieldKey(goalTile.x, goalTile.y, flying)];
+	entry.m_lastRequestFrame = m_bot.GetCurrentFrame();
+
+	// The grids of a new goal are built on the next frame
+	const auto & costs = flying ? m_airCosts : m_groundCosts;
+	if (costs && (!entry.m_field || entry.m_field->m_epoch < m_costsEpoch) && !entry.m_pending)
+	{
+		++m_computeCount;
+		entry.m_pending = true;
+		m_queue.push_back({ FlowFieldKey(goalTile.x, goalTile.y, flying), m_costsEpoch, costs });
+		if (!m_worker.joinable())
+			m_worker = std::thread(&FlowFieldManager::runWorker, this);
+		m_condition.notify_one();
+	}
+
+	const uint32_t epoch = getCurrentEpoch();
+	if (entry.m_field && entry.m_field->m_epoch + FLOW_FIELD_MAX_STALE_EPOCHS >= epoch)
+		return entry.m_field;
+	return nullptr;
+}
+
+uint32_t FlowFieldManager::getCurrentEpoch() const
+{
+	return m_bot.GetCurrentFrame() / FLOW_FIELD_EPOCH_FRAME_COUNT;
+}
+
+// Computes the queued fields in order and stores them in their entry, which is kept while it is pending
+void FlowFieldManager::runWorker()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true)
+	{
+		m_condition.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+		if (m_stopping)
+			return;
+		const FlowFieldRequest request = std::move(m_queue.front());
+		m_queue.pop_front();
+		lock.unlock();
+
+		const CCTilePosition goal(std::get<0>(request.key), std::get<1>(request.key));
+		const auto field = computeFlowField(goal, std::get<2>(request.key), request.epoch, request.costs);
+
+		lock.lock();
+		auto & entry = m_flowFields[request.key];
+		entry.m_field = field;
+		entry.m_pending = false;
+	}
+}
+
+// Snapshot of the cost of entering each tile, using the same costs as the A* of Util::PathFinding (without the turn cost).
+// It is taken on the game thread so neither the micro threads nor the worker query the game.
+InfluenceMap FlowFieldManager::createCostGrid(bool flying) const
+{
+	auto & combatCommander = m_bot.Commander().Combat();
+	const CCPosition mapMin = m_bot.Map().mapMin();
+	const CCPosition mapMax = m_bot.Map().mapMax();
+	InfluenceMap costs(m_bot.Map().totalWidth(), m_bot.Map().totalHeight());
+	for (int y = 0; y < costs.h; ++y)
+	{
+		for (int x = 0; x < costs.w; ++x)
+		{
+			if (x < mapMin.x || y < mapMin.y || x >= mapMax.x || y >= mapMax.y)
+			{
+				costs(x, y) = std::numeric_limits<double>::infinity();
+				continue;
+			}
+			const CCTilePosition tile(x, y);
+			if (flying)
+			{
+				costs(x, y) = FLOW_FIELD_TILE_BASE_COST + combatCommander.getTotalAirInfluence(tile);
+			}
+			else if (!m_bot.Map().isWalkable(tile) || combatCommander.isTileBlocked(x, y))
+			{
+				costs(x, y) = std::numeric_limits<double>::infinity();
+			}
+			else
+			{
+				const float creepCost = m_bot.Observation()->HasCreep(Util::GetPosition(tile)) ? FLOW_FIELD_TILE_CREEP_COST : 0.f;
+				costs(x, y) = FLOW_FIELD_TILE_BASE_COST + creepCost + combatCommander.getTotalGroundInfluence(tile);
+			}
+		}
+	}
+	return costs;
+}
+
+std::shared_ptr<const FlowField> FlowFieldManager::computeFlowField(CCTilePosition goal, bool flying, uint32_t epoch, std::shared_ptr<const InfluenceMap> costs)
+{
+	auto flowField = std::make_shared<FlowField>(goal, flying, epoch);
+	// getDistances uses per thread scratch buffers, the worker keeps them from one field to the next
+	flowField->m_distances = getDistances(std::vector<sc2::Point2DI>{ sc2::Point2DI(goal.x, goal.y) }, *costs);
+	return flowField;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Common.h"
+#include "libvoxelbot/utilities/influence.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+class CCBot;
+
+/*
+ * Distance field toward a goal tile, computed with a single Dijkstra pass over the influence weighted cost grid.
+ * Every unit moving toward the same goal can then get its next move position in O(1) instead of running its own A*.
+ */
+struct FlowField
+{
+	CCTilePosition m_goal;
+	bool m_flying;
+	uint32_t m_epoch;
+	InfluenceMap m_distances;
+
+	FlowField(CCTilePosition goal, bool flying, uint32_t epoch)
+		: m_goal(goal)
+		, m_flying(flying)
+		, m_epoch(epoch)
+	{}
+
+	float getDistance(CCTilePosition tile) const;
+	CCTilePosition getNextTile(CCTilePosition tile) const;
+	CCPosition getMovePosition(CCPosition position, int steps) const;
+};
+
+/*
+ * Caches the flow fields per (goal, layer, influence epoch).
+ * The cost grids are built once per epoch on the game thread and shared read-only with the computations.
+ * A missing field is queued for a persistent worker thread that computes them in order, meanwhile the most recent field
+ * of the previous epochs is returned if it is not too stale.
+ */
+class FlowFieldManager
+{
+	typedef std::tuple<int, int, bool> FlowFieldKey;	// <goal x, goal y, flying>
+
+	struct FlowFieldEntry
+	{
+		std::shared_ptr<const FlowField> m_field;
+		bool m_pending = false;		// queued or being computed, the entry is not dropped until its field is set
+		uint32_t m_lastRequestFrame = 0;
+	};
+
+	struct FlowFieldRequest
+	{
+		FlowFieldKey key;
+		uint32_t epoch;
+		std::shared_ptr<const InfluenceMap> costs;
+	};
+
+	CCBot & m_bot;
+	std::map<FlowFieldKey, FlowFieldEntry> m_flowFields;
+	std::shared_ptr<const InfluenceMap> m_groundCosts;
+	std::shared_ptr<const InfluenceMap> m_airCosts;
+	uint32_t m_costsEpoch;
+	std::deque<FlowFieldRequest> m_queue;
+	bool m_stopping;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::thread m_worker;	// started by the first computation
+	int m_requestCount;
+	int m_computeCount;
+	int m_lastFrameRequestCount;
+	int m_lastFrameComputeCount;
+
+	uint32_t getCurrentEpoch() const;
+	void runWorker();
+	InfluenceMap createCostGrid(bool flying) const;
+	static std::shared_ptr<const FlowField> computeFlowField(CCTilePosition goal, bool flying, uint32_t epoch, std::shared_ptr<const InfluenceMap> costs);
+
+public:
+	FlowFieldManager(CCBot & bot);
+	~FlowFieldManager();
+	FlowFieldManager(const FlowFieldManager &) = delete;
+	FlowFieldManager & operator=(const FlowFieldManager &) = delete;
+
+	void onFrame();
+	std::shared_ptr<const FlowField> getFlowField(CCPosition goal, bool flying);
+	int getLastFrameRequestCount() const { return m_lastFrameRequestCount; }
+	int getLastFrameComputeCount() const { return m_lastFrameComputeCount; }
+	size_t getFlowFieldCount() const { return m_flowFields.size(); }
+};
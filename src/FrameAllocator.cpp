@@ -0,0 +1,140 @@
+#include "FrameAllocator.h"
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+	const size_t FirstBlockSize = 64 * 1024;	// small for the short lived threads, the main thread arena grows to the size of a frame
+	const size_t MaxPooledBlocks = 32;			// more than the number of threads alive at once
+
+	// Blocks of the arenas of the threads that exited, reused by the arenas of the next threads
+	struct BlockPool
+	{
+		std::mutex mutex;
+		std::vector<std::pair<char *, size_t>> blocks;
+
+		~BlockPool()
+		{
+			for (auto & block : blocks)
+				::operator delete(block.first);
+		}
+	};
+
+	BlockPool & GetBlockPool()
+	{
+		static BlockPool pool;
+		return pool;
+	}
+}
+
+FrameArena::FrameArena()
+	: m_currentBlock(0)
+	, m_offset(0)
+	, m_usedBytes(0)
+	, m_peakBytes(0)
+{
+}
+
+FrameArena::~FrameArena()
+{
+	auto largestBlock = std::max_element(m_blocks.begin(), m_blocks.end(), [](const Block & a, const Block & b) { return a.size < b.size; });
+	if (largestBlock != m_blocks.end())
+	{
+		auto & pool = GetBlockPool();
+		std::lock_guard<std::mutex> lock(pool.mutex);
+		if (pool.blocks.size() < MaxPooledBlocks)
+		{
+			pool.blocks.push_back({ largestBlock->data, largestBlock->size });
+			m_blocks.erase(largestBlock);
+		}
+	}
+	for (auto & block : m_blocks)
+		::operator delete(block.data);
+}
+
+// Used for the first block of an arena, returns false if no pooled block is large enough
+bool FrameArena::takePooledBlock(size_t minSize)
+{
+	auto & pool = GetBlockPool();
+	std::lock_guard<std::mutex> lock(pool.mutex);
+	auto it = std::find_if(pool.blocks.begin(), pool.blocks.end(), [minSize](const std::pair<char *, size_t> & block) { return block.second >= minSize; });
+	if (it == pool.blocks.end())
+		return false;
+	m_blocks.push_back({ it->first, it->second });
+	pool.blocks.erase(it);
+	m_currentBlock = 0;
+	m_offset = 0;
+	return true;
+}
+
+FrameArena & FrameArena::Get()
+{
+	thread_local FrameArena arena;
+	return arena;
+}
+
+// Each new block is at least as large as all the previous ones together, so a frame needs few blocks
+void FrameArena::addBlock(size_t minSize)
+{
+	if (m_blocks.empty() && takePooledBlock(std::max(minSize, FirstBlockSize)))
+		return;
+
+	size_t size = FirstBlockSize;
+	for (auto & block : m_blocks)
+		size += block.size;
+	size = std::max(size, minSize);
+	m_blocks.push_back({ static_cast<char *>(::operator new(size)), size });
+	m_currentBlock = m_blocks.size() - 1;
+	m_offset = 0;
+}
+
+void * FrameArena::allocate(size_t bytes, size_t alignment)
+{
+	bytes = std::max<size_t>(bytes, 1);
+	while (true)
+	{
+		if (m_currentBlock < m_blocks.size())
+		{
+			const Block & block = m_blocks[m_currentBlock];
+			const size_t alignedOffset = (m_offset + alignment - 1) & ~(alignment - 1);
+			if (alignedOffset + bytes <= block.size)
+			{
+				m_offset = alignedOffset + bytes;
+				m_usedBytes += bytes;
+				return block.data + alignedOffset;
+			}
+			if (m_currentBlock + 1 < m_blocks.size())
+			{
+				++m_currentBlock;
+				m_offset = 0;
+				continue;
+			}
+		}
+		addBlock(bytes + alignment);
+	}
+}
+
+void FrameArena::reset()
+{
+	m_peakBytes = std::max(m_peakBytes, m_usedBytes);
+	// The frame did not fit in a single block, replace the blocks by one that can hold the whole frame
+	if (m_blocks.size() > 1)
+	{
+		const size_t capacity = getCapacity();
+		for (auto & block : m_blocks)
+			::operator delete(block.data);
+		m_blocks.clear();
+		addBlock(capacity);
+	}
+	m_currentBlock = 0;
+	m_offset = 0;
+	m_usedBytes = 0;
+}
+
+size_t FrameArena::getCapacity() const
+{
+	size_t capacity = 0;
+	for (auto & block : m_blocks)
+		capacity += block.size;
+	return capacity;
+}
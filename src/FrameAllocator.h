@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <map>
+#include <new>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Monotonic arena for the temporaries of a frame. Allocating only moves an offset in a block and freeing does nothing,
+ * all the memory is reclaimed at once by reset, which CCBot::OnStep calls at the end of every frame.
+ * Each thread has its own arena, a thread that lives longer than a frame must reset it itself (only the main thread does for now).
+ * The short lived threads, like the RangedManager ones, give the largest block of their arena back to a shared pool when they exit,
+ * the arenas of the next threads start from the pooled blocks instead of allocating new ones.
+ * After a few frames the arena has a single block large enough for a whole frame and no longer allocates on the heap.
+ * Anything allocated in it, like the Frame containers below, must not outlive the frame.
+ */
+class FrameArena
+{
+	struct Block
+	{
+		char * data;
+		size_t size;
+	};
+
+	std::vector<Block> m_blocks;
+	size_t m_currentBlock;
+	size_t m_offset;		// in the current block
+	size_t m_usedBytes;		// since the last reset
+	size_t m_peakBytes;
+
+	FrameArena();
+	void addBlock(size_t minSize);
+	bool takePooledBlock(size_t minSize);
+
+public:
+
+	~FrameArena();
+	FrameArena(const FrameArena &) = delete;
+	FrameArena & operator=(const FrameArena &) = delete;
+
+	// The arena of the calling thread
+	static FrameArena & Get();
+
+	void * allocate(size_t bytes, size_t alignment);
+	// Frees everything that was allocated since the last reset
+	void reset();
+
+	// Only for types that do not need their destructor to be called, since the arena never calls it
+	template <class T, class... Args>
+	T * create(Args &&... args)
+	{
+		static_assert(std::is_trivially_destructible<T>::value, "The frame arena does not call the destructors");
+		return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+	}
+
+	size_t getUsedBytes() const { return m_usedBytes; }
+	size_t getPeakBytes() const { return m_peakBytes; }
+	size_t getCapacity() const;
+};
+
+// Standard allocator that takes its memory from the frame arena of the calling thread
+template <class T>
+class FrameAllocator
+{
+public:
+
+	typedef T value_type;
+
+	FrameAllocator() noexcept {}
+	template <class U>
+	FrameAllocator(const FrameAllocator<U> &) noexcept {}
+
+	T * allocate(size_t count)
+	{
+		return static_cast<T *>(FrameArena::Get().allocate(count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T *, size_t) noexcept {}
+};
+
+template <class T, class U>
+bool operator==(const FrameAllocator<T> &, const FrameAllocator<U> &) noexcept { return true; }
+template <class T, class U>
+bool operator!=(const FrameAllocator<T> &, const FrameAllocator<U> &) noexcept { return false; }
+
+template <class T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+template <class T>
+using FrameList = std::list<T, FrameAllocator<T>>;
+template <class T, class Compare = std::less<T>>
+using FrameSet = std::set<T, Compare, FrameAllocator<T>>;
+template <class Key, class T, class Compare = std::less<Key>>
+using FrameMap = std::map<Key, T, Compare, FrameAllocator<std::pair<const Key, T>>>;
@@ -0,0 +1,342 @@
+#include "HierarchicalPathfinder.h"
+#include "CCBot.h"
+#include "Util.h"
+#include <queue>
+
+const int PATHFINDER_CLUSTER_SIZE = 16;
+const int PATHFINDER_PORTAL_SPLIT_LENGTH = 6;				// openings at least this wide get a portal at each end instead of one in the middle
+
+typedef std::pair<float, int> PathfinderQueueEntry;		// <cost, index>
+typedef std::priority_queue<PathfinderQueueEntry, std::vector<PathfinderQueueEntry>, std::greater<PathfinderQueueEntry>> PathfinderQueue;
+
+HierarchicalPathfinder::HierarchicalPathfinder(CCBot & bot)
+	: m_bot(bot)
+	, m_clusterCountX(0)
+	, m_clusterCountY(0)
+{
+}
+
+void HierarchicalPathfinder::onStart()
+{
+	m_clusterCountX = (m_bot.Map().totalWidth() + PATHFINDER_CLUSTER_SIZE - 1) / PATHFINDER_CLUSTER_SIZE;
+	m_clusterCountY = (m_bot.Map().totalHeight() + PATHFINDER_CLUSTER_SIZE - 1) / PATHFINDER_CLUSTER_SIZE;
+	const int clusterCount = m_clusterCountX * m_clusterCountY;
+	m_nodes.clear();
+	m_clusterNodes.clear();
+	m_clusterNodes.resize(clusterCount);
+
+	// Create the portals between each pair of neighbor clusters
+	std::map<int, int> nodeIndices;
+	for (int y = 0; y < m_clusterCountY; ++y)
+	{
+		for (int x = 0; x < m_clusterCountX; ++x)
+		{
+			const int cluster = x + y * m_clusterCountX;
+			if (x + 1 < m_clusterCountX)
+				createPortals(cluster, cluster + 1, true, nodeIndices);
+			if (y + 1 < m_clusterCountY)
+				createPortals(cluster, cluster + m_clusterCountX, false, nodeIndices);
+		}
+	}
+
+	// Precompute the walking distances between the portals of a same cluster
+	std::vector<float> distances;
+	for (int cluster = 0; cluster < clusterCount; ++cluster)
+	{
+		const auto & clusterNodes = m_clusterNodes[cluster];
+		for (const int node : clusterNodes)
+		{
+			computeClusterDistances(cluster, m_nodes[node].m_tile, distances);
+			for (const int otherNode : clusterNodes)
+			{
+				if (otherNode == node)
+					continue;
+				const float distance = getClusterDistance(cluster, distances, m_nodes[otherNode].m_tile);
+				if (!std::isinf(distance))
+					m_nodes[node].m_edges.push_back({ otherNode, distance });
+			}
+		}
+	}
+}
+
+// Returns the path of tile centers from the start to the goal (both included) or an empty list if there is none
+std::list<CCPosition> HierarchicalPathfinder::findPath(CCPosition start, CCPosition goal) const
+{
+	std::list<CCPosition> path;
+	std::vector<CCTilePosition> tiles;
+	float distance;
+	if (!findAbstractPath(Util::GetTilePosition(start), Util::GetTilePosition(goal), tiles, distance))
+		return path;
+
+	path.push_back(Util::GetPosition(tiles.front()) + CCPosition(0.5f, 0.5f));
+	for (size_t i = 1; i < tiles.size(); ++i)
+	{
+		refineSegment(tiles[i - 1], tiles[i], path);
+	}
+	return path;
+}
+
+int HierarchicalPathfinder::getCluster(CCTilePosition tile) const
+{
+	return tile.x / PATHFINDER_CLUSTER_SIZE + (tile.y / PATHFINDER_CLUSTER_SIZE) * m_clusterCountX;
+}
+
+void HierarchicalPathfinder::getClusterBounds(int cluster, CCTilePosition & min, CCTilePosition & max) const
+{
+	min = CCTilePosition((cluster % m_clusterCountX) * PATHFINDER_CLUSTER_SIZE, (cluster / m_clusterCountX) * PATHFINDER_CLUSTER_SIZE);
+	max = CCTilePosition(std::min(min.x + PATHFINDER_CLUSTER_SIZE, m_bot.Map().totalWidth()) - 1, std::min(min.y + PATHFINDER_CLUSTER_SIZE, m_bot.Map().totalHeight()) - 1);
+}
+
+bool HierarchicalPathfinder::isValidMove(CCTilePosition from, int dx, int dy, CCTilePosition min, CCTilePosition max) const
+{
+	const int x = from.x + dx;
+	const int y = from.y + dy;
+	if (x < min.x || y < min.y || x > max.x || y > max.y || !m_bot.Map().isWalkable(x, y))
+		return false;
+	// Do not cut corners
+	if (dx != 0 && dy != 0)
+		return m_bot.Map().isWalkable(from.x + dx, from.y) && m_bot.Map().isWalkable(from.x, from.y + dy);
+	return true;
+}
+
+int HierarchicalPathfinder::getOrCreateNode(CCTilePosition tile, std::map<int, int> & nodeIndices)
+{
+	const int tileIndex = tile.x + tile.y * m_bot.Map().totalWidth();
+	const auto it = nodeIndices.find(tileIndex);
+	if (it != nodeIndices.end())
+		return it->second;
+
+	const int node = int(m_nodes.size());
+	PortalNode portalNode;
+	portalNode.m_tile = tile;
+	portalNode.m_cluster = getCluster(tile);
+	m_nodes.push_back(portalNode);
+	m_clusterNodes[portalNode.m_cluster].push_back(node);
+	nodeIndices[tileIndex] = node;
+	return node;
+}
+
+// Creates a pair of portal nodes for each walkable opening on the border between the two clusters.
+// The second cluster is on the right of the first one if vertical is true, above it otherwise.
+void HierarchicalPathfinder::createPortals(int firstCluster, int secondCluster, bool vertical, std::map<int, int> & nodeIndices)
+{
+	CCTilePosition min, max;
+	getClusterBounds(firstCluster, min, max);
+	const int borderLength = vertical ? max.y - min.y + 1 : max.x - min.x + 1;
+	const CCTilePosition borderStart = vertical ? CCTilePosition(max.x, min.y) : CCTilePosition(min.x, max.y);
+	const CCTilePosition borderStep = vertical ? CCTilePosition(0, 1) : CCTilePosition(1, 0);
+	const CCTilePosition crossStep = vertical ? CCTilePosition(1, 0) : CCTilePosition(0, 1);
+
+	const auto addPortal = [&](int borderIndex)
+	{
+		const CCTilePosition tile(borderStart.x + borderStep.x * borderIndex, borderStart.y + borderStep.y * borderIndex);
+		const int firstNode = getOrCreateNode(tile, nodeIndices);
+		const int secondNode = getOrCreateNode(CCTilePosition(tile.x + crossStep.x, tile.y + crossStep.y), nodeIndices);
+		m_nodes[firstNode].m_edges.push_back({ secondNode, 1.f });
+		m_nodes[secondNode].m_edges.push_back({ firstNode, 1.f });
+	};
+
+	int runStart = -1;
+	for (int i = 0; i <= borderLength; ++i)
+	{
+		bool open = false;
+		if (i < borderLength)
+		{
+			const CCTilePosition tile(borderStart.x + borderStep.x * i, borderStart.y + borderStep.y * i);
+			open = m_bot.Map().isWalkable(tile) && m_bot.Map().isWalkable(CCTilePosition(tile.x + crossStep.x, tile.y + crossStep.y));
+		}
+		if (open && runStart < 0)
+		{
+			runStart = i;
+		}
+		else if (!open && runStart >= 0)
+		{
+			const int runEnd = i - 1;
+			if (runEnd - runStart + 1 < PATHFINDER_PORTAL_SPLIT_LENGTH)
+			{
+				addPortal((runStart + runEnd) / 2);
+			}
+			else
+			{
+				addPortal(runStart);
+				addPortal(runEnd);
+			}
+			runStart = -1;
+		}
+	}
+}
+
+// Dijkstra bounded to the cluster. The distances are indexed relatively to the bottom left corner of the cluster.
+void HierarchicalPathfinder::computeClusterDistances(int cluster, CCTilePosition from, std::vector<float> & distances) const
+{
+	CCTilePosition min, max;
+	getClusterBounds(cluster, min, max);
+	distances.assign(PATHFINDER_CLUSTER_SIZE * PATHFINDER_CLUSTER_SIZE, std::numeric_limits<float>::infinity());
+
+	PathfinderQueue queue;
+	const int fromIndex = (from.x - min.x) + (from.y - min.y) * PATHFINDER_CLUSTER_SIZE;
+	distances[fromIndex] = 0.f;
+	queue.push(PathfinderQueueEntry(0.f, fromIndex));
+	while (!queue.empty())
+	{
+		const auto entry = queue.top();
+		queue.pop();
+		if (entry.first > distances[entry.second])
+			continue;
+
+		const CCTilePosition tile(min.x + entry.second % PATHFINDER_CLUSTER_SIZE, min.y + entry.second / PATHFINDER_CLUSTER_SIZE);
+		for (int dx = -1; dx <= 1; ++dx)
+		{
+			for (int dy = -1; dy <= 1; ++dy)
+			{
+				if ((dx == 0 && dy == 0) || !isValidMove(tile, dx, dy, min, max))
+					continue;
+				const int index = entry.second + dx + dy * PATHFINDER_CLUSTER_SIZE;
+				const float distance = entry.first + (dx != 0 && dy != 0 ? 1.41421356f : 1.f);
+				if (distance < distances[index])
+				{
+					distances[index] = distance;
+					queue.push(PathfinderQueueEntry(distance, index));
+				}
+			}
+		}
+	}
+}
+
+float HierarchicalPathfinder::getClusterDistance(int cluster, const std::vector<float> & distances, CCTilePosition tile) const
+{
+	CCTilePosition min, max;
+	getClusterBounds(cluster, min, max);
+	return distances[(tile.x - min.x) + (tile.y - min.y) * PATHFINDER_CLUSTER_SIZE];
+}
+
+// A* on the portal graph, with the start and the goal temporarily linked to the portals of their cluster
+bool HierarchicalPathfinder::findAbstractPath(CCTilePosition start, CCTilePosition goal, std::vector<CCTilePosition> & outTiles, float & outDistance) const
+{
+	if (!isInitialized() || !m_bot.Map().isWalkable(start) || !m_bot.Map().isWalkable(goal))
+		return false;
+
+	const int startCluster = getCluster(start);
+	const int goalCluster = getCluster(goal);
+	std::vector<float> startDistances;
+	computeClusterDistances(startCluster, start, startDistances);
+	if (startCluster == goalCluster)
+	{
+		const float distance = getClusterDistance(startCluster, startDistances, goal);
+		if (!std::isinf(distance))
+		{
+			outTiles = { start, goal };
+			outDistance = distance;
+			return true;
+		}
+	}
+	std::vector<float> goalDistances;
+	computeClusterDistances(goalCluster, goal, goalDistances);
+
+	const int startNode = int(m_nodes.size());
+	const int goalNode = startNode + 1;
+	const auto getTile = [&](int node) { return node == startNode ? start : node == goalNode ? goal : m_nodes[node].m_tile; };
+	std::vector<float> distances(m_nodes.size() + 2, std::numeric_limits<float>::infinity());
+	std::vector<int> parents(m_nodes.size() + 2, -1);
+	std::vector<bool> closed(m_nodes.size() + 2, false);
+	PathfinderQueue queue;
+	distances[startNode] = 0.f;
+	queue.push(PathfinderQueueEntry(Util::Dist(start, goal), startNode));
+
+	const auto relax = [&](int node, int neighbor, float distance)
+	{
+		if (closed[neighbor] || distances[node] + distance >= distances[neighbor])
+			return;
+		distances[neighbor] = distances[node] + distance;
+		parents[neighbor] = node;
+		queue.push(PathfinderQueueEntry(distances[neighbor] + Util::Dist(getTile(neighbor), goal), neighbor));
+	};
+
+	while (!queue.empty())
+	{
+		const int node = queue.top().second;
+		queue.pop();
+		if (closed[node])
+			continue;
+		closed[node] = true;
+		if (node == goalNode)
+			break;
+
+		if (node == startNode)
+		{
+			for (const int portal : m_clusterNodes[startCluster])
+			{
+				const float distance = getClusterDistance(startCluster, startDistances, m_nodes[portal].m_tile);
+				if (!std::isinf(distance))
+					relax(node, portal, distance);
+			}
+			continue;
+		}
+
+		const auto & portalNode = m_nodes[node];
+		for (const auto & edge : portalNode.m_edges)
+		{
+			relax(node, edge.m_node, edge.m_distance);
+		}
+		if (portalNode.m_cluster == goalCluster)
+		{
+			const float distance = getClusterDistance(goalCluster, goalDistances, portalNode.m_tile);
+			if (!std::isinf(distance))
+				relax(node, goalNode, distance);
+		}
+	}
+
+	if (!closed[goalNode])
+		return false;
+
+	outTiles.clear();
+	for (int node = goalNode; node >= 0; node = parents[node])
+	{
+		outTiles.insert(outTiles.begin(), getTile(node));
+	}
+	outDistance = distances[goalNode];
+	return true;
+}
+
+// Appends the tile centers between two consecutive abstract path tiles (the first one excluded), which are either neighbors or in the same cluster
+void HierarchicalPathfinder::refineSegment(CCTilePosition from, CCTilePosition to, std::list<CCPosition> & path) const
+{
+	if (std::abs(from.x - to.x) <= 1 && std::abs(from.y - to.y) <= 1)
+	{
+		if (from != to)
+			path.push_back(Util::GetPosition(to) + CCPosition(0.5f, 0.5f));
+		return;
+	}
+
+	// Follow the distance gradient from the start of the segment to its end
+	const int cluster = getCluster(from);
+	CCTilePosition min, max;
+	getClusterBounds(cluster, min, max);
+	std::vector<float> distances;
+	computeClusterDistances(cluster, to, distances);
+	CCTilePosition tile = from;
+	float tileDistance = getClusterDistance(cluster, distances, tile);
+	while (tile != to)
+	{
+		CCTilePosition nextTile = tile;
+		for (int dx = -1; dx <= 1; ++dx)
+		{
+			for (int dy = -1; dy <= 1; ++dy)
+			{
+				if ((dx == 0 && dy == 0) || !isValidMove(tile, dx, dy, min, max))
+					continue;
+				const CCTilePosition neighbor(tile.x + dx, tile.y + dy);
+				const float distance = getClusterDistance(cluster, distances, neighbor);
+				if (distance < tileDistance)
+				{
+					nextTile = neighbor;
+					tileDistance = distance;
+				}
+			}
+		}
+		if (nextTile == tile)
+			break;	// should not happen since the abstract edge exists
+		tile = nextTile;
+		path.push_back(Util::GetPosition(tile) + CCPosition(0.5f, 0.5f));
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Common.h"
+
+class CCBot;
+
+/*
+ * HPA* style abstraction of the ground pathing of the map, used for the long range path queries that would time out with the tile A*.
+ * The map is split in square clusters. Every walkable opening between two neighbor clusters (ramps, chokes or open ground)
+ * gets a pair of portal nodes and the walking distances between the portals of a same cluster are precomputed at game start.
+ * A query only searches the small portal graph, then each abstract segment is refined with a search bounded to a single cluster.
+ * The paths ignore the influence, the callers that need it use the tile A*.
+ */
+class HierarchicalPathfinder
+{
+	struct Edge
+	{
+		int m_node;
+		float m_distance;
+	};
+
+	struct PortalNode
+	{
+		CCTilePosition m_tile;
+		int m_cluster;
+		std::vector<Edge> m_edges;
+	};
+
+	CCBot & m_bot;
+	int m_clusterCountX;
+	int m_clusterCountY;
+	std::vector<PortalNode> m_nodes;
+	std::vector<std::vector<int>> m_clusterNodes;
+
+	int getCluster(CCTilePosition tile) const;
+	void getClusterBounds(int cluster, CCTilePosition & min, CCTilePosition & max) const;
+	bool isValidMove(CCTilePosition from, int dx, int dy, CCTilePosition min, CCTilePosition max) const;
+	int getOrCreateNode(CCTilePosition tile, std::map<int, int> & nodeIndices);
+	void createPortals(int firstCluster, int secondCluster, bool vertical, std::map<int, int> & nodeIndices);
+	void computeClusterDistances(int cluster, CCTilePosition from, std::vector<float> & distances) const;
+	float getClusterDistance(int cluster, const std::vector<float> & distances, CCTilePosition tile) const;
+	bool findAbstractPath(CCTilePosition start, CCTilePosition goal, std::vector<CCTilePosition> & outTiles, float & outDistance) const;
+	void refineSegment(CCTilePosition from, CCTilePosition to, std::list<CCPosition> & path) const;
+
+public:
+	HierarchicalPathfinder(CCBot & bot);
+
+	void onStart();
+	bool isInitialized() const { return !m_clusterNodes.empty(); }
+	size_t getPortalCount() const { return m_nodes.size(); }
+	std::list<CCPosition> findPath(CCPosition start, CCPosition goal) const;
+};
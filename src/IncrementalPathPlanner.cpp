@@ -0,0 +1,340 @@
+#include "IncrementalPathPlanner.h"
+#include "CCBot.h"
+#include "Util.h"
+
+const float PLANNER_TILE_BASE_COST = 1.f;
+const float PLANNER_TILE_CREEP_COST = 0.5f;
+const int PLANNER_FULL_SEARCH_BUDGET = 2000;	// max number of expanded nodes when the search restarts from scratch
+const int PLANNER_REPAIR_BUDGET = 300;			// max number of expanded nodes to repair the search
+const int PLANNER_MAX_CHANGED_TILES = 64;		// above that many changed tiles, a full search is cheaper than a repair
+const int PLANNER_MAX_NODES = 20000;
+const float PLANNER_GOAL_MOVE_TOLERANCE = 1.5f;
+const float PLANNER_INFINITY = std::numeric_limits<float>::infinity();
+
+IncrementalPathPlanner::IncrementalPathPlanner(CCBot & bot)
+	: m_bot(bot)
+	, m_goalRange(0.f)
+	, m_flying(false)
+	, m_km(0.f)
+	, m_initialized(false)
+	, m_abandoned(false)
+	, m_lastSenseFrame(0)
+	, m_lastUseFrame(0)
+	, m_expandedNodes(0)
+	, m_fullSearches(0)
+{
+}
+
+/*
+ * Returns the position the unit should move to in order to reach a tile in range of the goal without influence.
+ * Returns (0, 0) if no path was found, in which case the regular A* should be used.
+ * When a repair does not fit in its expansion budget, it resumes on the next request and the unit keeps its previous move meanwhile.
+ * When the first search toward a goal does not fit in its budget, it is abandoned until the goal changes so the A* does not run
+ * on top of it on every request.
+ * Unlike the A* with getCloser, the cheapest tile in range is reached instead of the closest one to the goal.
+ */
+CCPosition IncrementalPathPlanner::getMovePosition(const sc2::Unit * unit, CCPosition goal, float goalRange)
+{
+	m_lastUseFrame = m_bot.GetCurrentFrame();
+
+	const bool goalChanged = Util::DistSq(goal, m_goal) > PLANNER_GOAL_MOVE_TOLERANCE * PLANNER_GOAL_MOVE_TOLERANCE || goalRange != m_goalRange;
+	if (m_abandoned && !goalChanged && unit->is_flying == m_flying)
+		return CCPosition();
+
+	bool fullSearch = !m_initialized || goalChanged || unit->is_flying != m_flying || int(m_nodes.size()) > PLANNER_MAX_NODES;
+	if (!fullSearch)
+	{
+		const CCTilePosition start = Util::GetTilePosition(unit->pos);
+		if (start != m_start)
+		{
+			m_km += Util::Dist(m_start, start);
+			m_start = start;
+		}
+		bool complete;
+		fullSearch = senseChanges(unit, complete) > PLANNER_MAX_CHANGED_TILES || !complete;
+	}
+	if (fullSearch)
+	{
+		if (goalChanged || unit->is_flying != m_flying)
+			m_lastMovePosition = CCPosition();
+		++m_fullSearches;
+		initialize(unit, goal, goalRange);
+	}
+
+	const int startIndex = getIndex(m_start);
+	if (std::isinf(getNode(startIndex, unit).cost))
+		return CCPosition();
+
+	if (!computeShortestPath(fullSearch ? PLANNER_FULL_SEARCH_BUDGET : PLANNER_REPAIR_BUDGET, unit))
+	{
+		if (m_lastMovePosition != CCPosition() && Util::DistSq(unit->pos, m_lastMovePosition) > 1.f)
+			return m_lastMovePosition;
+		if (m_lastMovePosition == CCPosition())
+		{
+			m_abandoned = true;
+			m_nodes.clear();
+			m_queue.clear();
+		}
+		return CCPosition();
+	}
+
+	if (std::isinf(getNode(startIndex, unit).g))
+		return CCPosition();
+
+	// Follow the cheapest successors, like the A* path the command position is taken from
+	std::list<CCPosition> path;
+	CCTilePosition tile = m_start;
+	path.push_back(Util::GetPosition(tile) + CCPosition(0.5f, 0.5f));
+	for (int step = 0; step < 2 && !getNode(getIndex(tile), unit).goal; ++step)
+	{
+		CCTilePosition nextTile = tile;
+		float nextTileCost = PLANNER_INFINITY;
+		for (int x = -1; x <= 1; ++x)
+		{
+			for (int y = -1; y <= 1; ++y)
+			{
+				if ((x == 0 && y == 0) || !m_bot.Map().isValidTile(tile.x + x, tile.y + y))
+					continue;
+				const CCTilePosition neighbor(tile.x + x, tile.y + y);
+				const auto & neighborNode = getNode(getIndex(neighbor), unit);
+				const float cost = Util::Dist(tile, neighbor) * neighborNode.cost + neighborNode.g;
+				if (cost < nextTileCost)
+				{
+					nextTile = neighbor;
+					nextTileCost = cost;
+				}
+			}
+		}
+		if (nextTile == tile)
+			break;
+		tile = nextTile;
+		path.push_back(Util::GetPosition(tile) + CCPosition(0.5f, 0.5f));
+	}
+	m_lastMovePosition = Util::PathFinding::GetCommandPositionFromPath(path, unit, true, m_bot);
+	return m_lastMovePosition;
+}
+
+int IncrementalPathPlanner::getIndex(CCTilePosition tile) const
+{
+	return tile.x + tile.y * m_bot.Map().totalWidth();
+}
+
+CCTilePosition IncrementalPathPlanner::getTile(int index) const
+{
+	return CCTilePosition(index % m_bot.Map().totalWidth(), index / m_bot.Map().totalWidth());
+}
+
+// Same cost as in the A* of Util::PathFinding, without the turning cost
+float IncrementalPathPlanner::getTileCost(CCTilePosition tile, const sc2::Unit * unit) const
+{
+	const CCPosition mapMin = m_bot.Map().mapMin();
+	const CCPosition mapMax = m_bot.Map().mapMax();
+	if (tile.x < mapMin.x || tile.y < mapMin.y || tile.x >= mapMax.x || tile.y >= mapMax.y)
+		return PLANNER_INFINITY;
+	if (!unit->is_flying && (!m_bot.Map().isWalkable(tile) || m_bot.Commander().Combat().isTileBlocked(tile.x, tile.y)))
+		return PLANNER_INFINITY;
+
+	const float creepCost = !unit->is_flying && m_bot.Observation()->HasCreep(Util::GetPosition(tile)) ? PLANNER_TILE_CREEP_COST : 0.f;
+	const float influence = Util::PathFinding::GetEffectInfluenceOnTile(tile, unit, m_bot) + Util::PathFinding::GetCombatInfluenceOnTile(tile, unit, m_bot);
+	return PLANNER_TILE_BASE_COST + creepCost + influence;
+}
+
+bool IncrementalPathPlanner::isGoalTile(CCTilePosition tile, const sc2::Unit * unit) const
+{
+	return Util::Dist(Util::GetPosition(tile) + CCPosition(0.5f, 0.5f), m_goal) < m_goalRange
+		&& Util::PathFinding::GetCombatInfluenceOnTile(tile, unit, m_bot) == 0.f
+		&& Util::PathFinding::GetEffectInfluenceOnTile(tile, unit, m_bot) == 0.f;
+}
+
+// Nodes are created lazily with the current cost of their tile
+IncrementalPathPlanner::NodeState & IncrementalPathPlanner::getNode(int index, const sc2::Unit * unit)
+{
+	auto it = m_nodes.find(index);
+	if (it == m_nodes.end())
+	{
+		const CCTilePosition tile = getTile(index);
+		NodeState node;
+		node.g = PLANNER_INFINITY;
+		node.rhs = PLANNER_INFINITY;
+		node.cost = getTileCost(tile, unit);
+		node.goal = !std::isinf(node.cost) && isGoalTile(tile, unit);
+		node.queued = false;
+		it = m_nodes.insert({ index, node }).first;
+	}
+	return it->second;
+}
+
+IncrementalPathPlanner::Key IncrementalPathPlanner::calculateKey(const NodeState & node, CCTilePosition tile) const
+{
+	const float minG = std::min(node.g, node.rhs);
+	return Key(minG + Util::Dist(m_start, tile) * PLANNER_TILE_BASE_COST + m_km, minG);
+}
+
+void IncrementalPathPlanner::updateVertex(int index, const sc2::Unit * unit)
+{
+	const CCTilePosition tile = getTile(index);
+	auto & node = getNode(index, unit);
+	if (std::isinf(node.cost))
+	{
+		node.rhs = PLANNER_INFINITY;
+	}
+	else if (node.goal)
+	{
+		node.rhs = 0.f;
+	}
+	else
+	{
+		node.rhs = PLANNER_INFINITY;
+		for (int x = -1; x <= 1; ++x)
+		{
+			for (int y = -1; y <= 1; ++y)
+			{
+				if ((x == 0 && y == 0) || !m_bot.Map().isValidTile(tile.x + x, tile.y + y))
+					continue;
+				const CCTilePosition neighbor(tile.x + x, tile.y + y);
+				const auto & neighborNode = getNode(getIndex(neighbor), unit);
+				node.rhs = std::min(node.rhs, Util::Dist(tile, neighbor) * neighborNode.cost + neighborNode.g);
+			}
+		}
+	}
+
+	if (node.queued)
+	{
+		m_queue.erase({ node.key, index });
+		node.queued = false;
+	}
+	if (node.g != node.rhs)
+	{
+		node.key = calculateKey(node, tile);
+		m_queue.insert({ node.key, index });
+		node.queued = true;
+	}
+}
+
+void IncrementalPathPlanner::initialize(const sc2::Unit * unit, CCPosition goal, float goalRange)
+{
+	m_nodes.clear();
+	m_queue.clear();
+	m_start = Util::GetTilePosition(unit->pos);
+	m_goal = goal;
+	m_goalRange = goalRange;
+	m_flying = unit->is_flying;
+	m_km = 0.f;
+	m_initialized = true;
+	m_abandoned = false;
+	m_lastSenseFrame = m_bot.GetCurrentFrame();
+
+	const int range = int(std::ceil(goalRange));
+	const CCTilePosition goalTile = Util::GetTilePosition(goal);
+	for (int x = goalTile.x - range; x <= goalTile.x + range; ++x)
+	{
+		for (int y = goalTile.y - range; y <= goalTile.y + range; ++y)
+		{
+			if (!m_bot.Map().isValidTile(x, y))
+				continue;
+			const int index = getIndex(CCTilePosition(x, y));
+			if (getNode(index, unit).goal)
+				updateVertex(index, unit);
+		}
+	}
+}
+
+// Refreshes the cost of the known tiles whose influence or blocked state changed since the previous request, then updates the nodes
+// affected by the changes. The creep is not tracked, it spreads slowly and only adds a small cost.
+// Returns the number of changed tiles, complete is false if the changes since the previous request are not known.
+int IncrementalPathPlanner::senseChanges(const sc2::Unit * unit, bool & complete)
+{
+	std::vector<CCTilePosition> candidateTiles;
+	complete = m_bot.Commander().Combat().getChangedTilesSince(m_lastSenseFrame, candidateTiles);
+	if (!complete)
+		return 0;
+	m_lastSenseFrame = m_bot.GetCurrentFrame();
+
+	std::vector<int> changedTiles;
+	for (const auto & tile : candidateTiles)
+	{
+		auto it = m_nodes.find(getIndex(tile));
+		if (it == m_nodes.end())
+			continue;
+		auto & node = it->second;
+		const float cost = getTileCost(tile, unit);
+		const bool goal = !std::isinf(cost) && isGoalTile(tile, unit);
+		if (cost != node.cost || goal != node.goal)
+		{
+			node.cost = cost;
+			node.goal = goal;
+			changedTiles.push_back(it->first);
+			if (int(changedTiles.size()) > PLANNER_MAX_CHANGED_TILES)
+				break;
+		}
+	}
+
+	if (int(changedTiles.size()) > PLANNER_MAX_CHANGED_TILES)
+		return int(changedTiles.size());
+
+	// The cost of entering a tile changes the rhs of all its neighbors
+	for (const int index : changedTiles)
+	{
+		const CCTilePosition tile = getTile(index);
+		updateVertex(index, unit);
+		for (int x = -1; x <= 1; ++x)
+		{
+			for (int y = -1; y <= 1; ++y)
+			{
+				if ((x != 0 || y != 0) && m_bot.Map().isValidTile(tile.x + x, tile.y + y))
+					updateVertex(getIndex(CCTilePosition(tile.x + x, tile.y + y)), unit);
+			}
+		}
+	}
+	return int(changedTiles.size());
+}
+
+// Returns false if the budget was exhausted before the start node became consistent
+bool IncrementalPathPlanner::computeShortestPath(int budget, const sc2::Unit * unit)
+{
+	const int startIndex = getIndex(m_start);
+	int expandedNodes = 0;
+	while (!m_queue.empty())
+	{
+		const auto & startNode = getNode(startIndex, unit);
+		if (!(m_queue.begin()->first < calculateKey(startNode, m_start)) && startNode.rhs == startNode.g)
+			break;
+		if (expandedNodes >= budget)
+			return false;
+		++expandedNodes;
+		++m_expandedNodes;
+
+		const Key oldKey = m_queue.begin()->first;
+		const int index = m_queue.begin()->second;
+		const CCTilePosition tile = getTile(index);
+		auto & node = getNode(index, unit);
+		m_queue.erase(m_queue.begin());
+		node.queued = false;
+
+		const Key newKey = calculateKey(node, tile);
+		if (oldKey < newKey)
+		{
+			node.key = newKey;
+			m_queue.insert({ node.key, index });
+			node.queued = true;
+			continue;
+		}
+
+		if (node.g > node.rhs)
+			node.g = node.rhs;
+		else
+		{
+			node.g = PLANNER_INFINITY;
+			updateVertex(index, unit);
+		}
+		for (int x = -1; x <= 1; ++x)
+		{
+			for (int y = -1; y <= 1; ++y)
+			{
+				if ((x != 0 || y != 0) && m_bot.Map().isValidTile(tile.x + x, tile.y + y))
+					updateVertex(getIndex(CCTilePosition(tile.x + x, tile.y + y)), unit);
+			}
+		}
+	}
+	return true;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Common.h"
+#include <unordered_map>
+
+class CCBot;
+
+/*
+ * D* Lite planner keeping the search state of a unit between its path requests.
+ * The search goes from the goal tiles (tiles in range of the goal without influence) toward the unit,
+ * so the unit moving along the path is almost free. Each request refreshes the known tiles whose influence or blocked state
+ * changed since the previous request, as recorded by the CombatCommander, and only repairs the part of the search affected
+ * by the changes, with a bounded number of expanded nodes.
+ * The search restarts from scratch when the goal moves or when too many tiles changed.
+ */
+class IncrementalPathPlanner
+{
+	typedef std::pair<float, float> Key;
+
+	struct NodeState
+	{
+		float g;
+		float rhs;
+		float cost;		// cost of entering the tile, infinite if it is not pathable
+		bool goal;
+		bool queued;
+		Key key;
+	};
+
+	CCBot & m_bot;
+	std::unordered_map<int, NodeState> m_nodes;
+	std::set<std::pair<Key, int>> m_queue;
+	CCTilePosition m_start;
+	CCPosition m_goal;
+	float m_goalRange;
+	bool m_flying;
+	float m_km;
+	bool m_initialized;
+	bool m_abandoned;				// the first search toward this goal did not fit in its budget
+	CCPosition m_lastMovePosition;	// result of the last completed search toward this goal
+	uint32_t m_lastSenseFrame;
+	uint32_t m_lastUseFrame;
+	int m_expandedNodes;
+	int m_fullSearches;
+
+	int getIndex(CCTilePosition tile) const;
+	CCTilePosition getTile(int index) const;
+	float getTileCost(CCTilePosition tile, const sc2::Unit * unit) const;
+	bool isGoalTile(CCTilePosition tile, const sc2::Unit * unit) const;
+	NodeState & getNode(int index, const sc2::Unit * unit);
+	Key calculateKey(const NodeState & node, CCTilePosition tile) const;
+	void updateVertex(int index, const sc2::Unit * unit);
+	void initialize(const sc2::Unit * unit, CCPosition goal, float goalRange);
+	int senseChanges(const sc2::Unit * unit, bool & complete);
+	bool computeShortestPath(int budget, const sc2::Unit * unit);
+
+public:
+	IncrementalPathPlanner(CCBot & bot);
+
+	CCPosition getMovePosition(const sc2::Unit * unit, CCPosition goal, float goalRange);
+	uint32_t getLastUseFrame() const { return m_lastUseFrame; }
+	int getExpandedNodes() const { return m_expandedNodes; }
+	int getFullSearches() const { return m_fullSearches; }
+};
@@ -0,0 +1,50 @@
+#include "MapGrid.h"
+#include <algorithm>
+
+MapGrid::MapGrid()
+	: m_width(0)
+	, m_height(0)
+{
+}
+
+void MapGrid::initializeTerrain(const sc2::GameInfo & gameInfo)
+{
+	m_width = gameInfo.width;
+	m_height = gameInfo.height;
+	m_pathable = TileBitmask(m_width, m_height);
+	m_placement = TileBitmask(m_width, m_height);
+	m_walkable = TileBitmask(m_width, m_height);
+	m_buildable = TileBitmask(m_width, m_height);
+	m_depotBuildable = TileBitmask(m_width, m_height);
+	m_heightIndices = GridPlane<uint8_t>(m_width, m_height);
+	m_sectorNumbers = GridPlane<int>(m_width, m_height);
+	m_heightPalette.clear();
+
+	const auto pathingGrid = sc2::PathingGrid(gameInfo);
+	const auto placementGrid = sc2::PlacementGrid(gameInfo);
+	const auto heightMap = sc2::HeightMap(gameInfo);
+	std::vector<float> heights(size_t(m_width) * m_height);
+	for (int y = 0; y < m_height; ++y)
+	{
+		for (int x = 0; x < m_width; ++x)
+		{
+			const sc2::Point2DI point(x, y);
+			m_pathable.set(x, y, pathingGrid.IsPathable(point));
+			m_placement.set(x, y, placementGrid.IsPlacable(point));
+			heights[m_heightIndices.index(x, y)] = heightMap.TerrainHeight(point);
+		}
+	}
+
+	m_heightPalette = heights;
+	std::sort(m_heightPalette.begin(), m_heightPalette.end());
+	m_heightPalette.erase(std::unique(m_heightPalette.begin(), m_heightPalette.end()), m_heightPalette.end());
+	BOT_ASSERT(m_heightPalette.size() <= 256, "More terrain heights than the game can encode");
+	for (int y = 0; y < m_height; ++y)
+	{
+		for (int x = 0; x < m_width; ++x)
+		{
+			const auto it = std::lower_bound(m_heightPalette.begin(), m_heightPalette.end(), heights[m_heightIndices.index(x, y)]);
+			m_heightIndices(x, y) = uint8_t(it - m_heightPalette.begin());
+		}
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Common.h"
+#include "DistanceMap.h"
+
+// A value per tile in row-major order, the storage starts on a cache line
+template <class T>
+class GridPlane
+{
+	int m_width;
+	int m_height;
+	std::vector<T, AlignedAllocator<T, CacheLineSize>> m_values;
+
+public:
+
+	GridPlane() : m_width(0), m_height(0) {}
+	GridPlane(int width, int height, const T & value = T()) : m_width(width), m_height(height), m_values(size_t(width) * height, value) {}
+
+	int width() const { return m_width; }
+	int height() const { return m_height; }
+	bool empty() const { return m_values.empty(); }
+	bool isInside(int x, int y) const { return x >= 0 && y >= 0 && x < m_width && y < m_height; }
+	size_t index(int x, int y) const { return size_t(y) * m_width + x; }
+
+	T & operator()(int x, int y) { return m_values[index(x, y)]; }
+	const T & operator()(int x, int y) const { return m_values[index(x, y)]; }
+	void fill(const T & value) { std::fill(m_values.begin(), m_values.end(), value); }
+};
+
+/*
+ * The static terrain layers of the map, MapTools owns the only instance and every manager reads it through MapTools::getGrid.
+ * The boolean layers are bit planes, the height is quantized to an index in the palette of the heights found on the map,
+ * which is exact since the game encodes the heights on a byte.
+ */
+class MapGrid
+{
+	int m_width;
+	int m_height;
+	TileBitmask m_pathable;
+	TileBitmask m_placement;
+	TileBitmask m_walkable;			// pathable or placeable, only in the playable area
+	TileBitmask m_buildable;		// placeable, minus the static resources
+	TileBitmask m_depotBuildable;	// buildable, minus the tiles within 3 tiles of a static resource
+	GridPlane<uint8_t> m_heightIndices;
+	std::vector<float> m_heightPalette;
+	GridPlane<int> m_sectorNumbers;	// connectivity sector number, two tiles are ground connected if they have the same number
+
+public:
+
+	MapGrid();
+
+	// Reads the pathing, placement and height grids of the game
+	void initializeTerrain(const sc2::GameInfo & gameInfo);
+
+	int width() const { return m_width; }
+	int height() const { return m_height; }
+	bool isInside(int x, int y) const { return x >= 0 && y >= 0 && x < m_width && y < m_height; }
+
+	// The accessors do not check the bounds
+	bool isPathable(int x, int y) const { return m_pathable.get(x, y); }
+	bool isPlaceable(int x, int y) const { return m_placement.get(x, y); }
+	float getTerrainHeight(int x, int y) const { return m_heightPalette[m_heightIndices(x, y)]; }
+	bool isWalkable(int x, int y) const { return m_walkable.get(x, y); }
+	bool isBuildable(int x, int y) const { return m_buildable.get(x, y); }
+	bool isDepotBuildable(int x, int y) const { return m_depotBuildable.get(x, y); }
+	int getSectorNumber(int x, int y) const { return m_sectorNumbers(x, y); }
+
+	// The layers derived by MapTools::onStart
+	TileBitmask & walkable() { return m_walkable; }
+	TileBitmask & buildable() { return m_buildable; }
+	TileBitmask & depotBuildable() { return m_depotBuildable; }
+	GridPlane<int> & sectorNumbers() { return m_sectorNumbers; }
+	const TileBitmask & walkable() const { return m_walkable; }
+};
@@ -7,13 +7,9 @@
 #include <fstream>
 #include <array>
 #include <string>
+#include <thread>
+#include <algorithm>
 
-const size_t LegalActions = 4;
-const int actionX[LegalActions] ={1, -1, 0, 0};
-const int actionY[LegalActions] ={0, 0, 1, -1};
-
-typedef std::vector<std::vector<bool>> vvb;
-typedef std::vector<std::vector<int>>  vvi;
 typedef std::vector<std::vector<float>>  vvf;
 
 #ifdef SC2API
@@ -29,12 +25,45 @@ MapTools::MapTools(CCBot & bot)
     , m_height  (0)
     , m_maxZ    (0.0f)
     , m_frame   (0)
+    , m_placementFrame(0)
+    , m_placementLocalHits(0)
+    , m_placementCacheHits(0)
+    , m_placementQueries(0)
+    , m_placementQueriedPositions(0)
 {
 
 }
 
+// Called before Util::Initialize, which reads the terrain from the grid
+void MapTools::initializeTerrain()
+{
+    m_grid.initializeTerrain(m_bot.Observation()->GetGameInfo());
+}
+
 void MapTools::onStart()
 {
+	// the buffer is only flushed when debug is allowed, otherwise nothing is buffered
+#ifdef PUBLIC_RELEASE
+	m_debugDraw.setEnabled(false);
+#else
+	m_debugDraw.setEnabled(m_bot.Config().AllowDebug);
+#endif
+	m_debugDraw.setMaxPrimitivesPerCategory(m_bot.Config().DebugDrawMaxPrimitives);
+	m_debugDraw.setCoalesceTiles(m_bot.Config().DebugDrawCoalesceTiles);
+	if (!m_bot.Config().DebugDrawCategories.empty())
+	{
+		for (int i = 0; i < int(DebugDrawCategory::Count); ++i)
+			m_debugDraw.setCategoryEnabled(DebugDrawCategory(i), false);
+		for (const auto & name : m_bot.Config().DebugDrawCategories)
+		{
+			DebugDrawCategory category;
+			if (DebugDrawBuffer::GetCategoryFromName(name, category))
+				m_debugDraw.setCategoryEnabled(category, true);
+			else
+				std::cout << "Warning: Unknown debug draw category " << name << "\n";
+		}
+	}
+
 #ifdef SC2API
 	m_totalWidth = m_bot.Observation()->GetGameInfo().width;
 	m_totalHeight = m_bot.Observation()->GetGameInfo().height;
@@ -47,20 +76,23 @@ void MapTools::onStart()
     m_height = BWAPI::Broodwar->mapHeight();
 #endif
 
-    m_walkable       = vvb(m_totalWidth, std::vector<bool>(m_totalHeight, true));
-    m_buildable      = vvb(m_totalWidth, std::vector<bool>(m_totalHeight, false));
-    m_depotBuildable = vvb(m_totalWidth, std::vector<bool>(m_totalHeight, false));
-    m_sectorNumber   = vvi(m_totalWidth, std::vector<int>(m_totalHeight, 0));
+    TileBitmask & walkable = m_grid.walkable();
+    TileBitmask & buildable = m_grid.buildable();
+    TileBitmask & depotBuildable = m_grid.depotBuildable();
+    walkable.clear();
+    buildable.clear();
+    depotBuildable.clear();
+    m_grid.sectorNumbers().fill(0);
 
-	auto & info = m_bot.Observation()->GetGameInfo();
     // Set the boolean grid data from the Map
-    for (int x = m_min.x; x < m_max.x; ++x)
+    for (int y = m_min.y; y < m_max.y; ++y)
     {
-        for (int y = m_min.y; y < m_max.y; ++y)
+        for (int x = m_min.x; x < m_max.x; ++x)
         {
-            m_buildable[x][y]       = canBuild(x, y);
-            m_depotBuildable[x][y]  = canBuild(x, y);
-            m_walkable[x][y]        = m_buildable[x][y] || canWalk(x, y);
+            const bool canBuildTile = canBuild(x, y);
+            buildable.set(x, y, canBuildTile);
+            depotBuildable.set(x, y, canBuildTile);
+            walkable.set(x, y, canBuildTile || canWalk(x, y));
         }
     }
 
@@ -91,7 +123,7 @@ void MapTools::onStart()
         {
             for (int y=tileY; y<tileY+height; ++y)
             {
-                m_buildable[x][y] = false;
+                buildable.unset(x, y);
 
                 // depots can't be built within 3 tiles of any resource
                 for (int rx=-3; rx<=3; rx++)
@@ -102,7 +134,7 @@ void MapTools::onStart()
                         if (std::abs(rx) + std::abs(ry) == 6) { continue; }
                         if (!isValidTile(CCTilePosition(x+rx, y+ry))) { continue; }
 
-                        m_depotBuildable[x+rx][y+ry] = false;
+                        depotBuildable.unset(x+rx, y+ry);
                     }
                 }
             }
@@ -125,7 +157,7 @@ void MapTools::onStart()
         {
             for (int y=tileY; y<tileY+resource->getType().tileHeight(); ++y)
             {
-                m_buildable[x][y] = false;
+                buildable.unset(x, y);
 
                 // depots can't be built within 3 tiles of any resource
                 for (int rx=-3; rx<=3; rx++)
@@ -137,7 +169,7 @@ void MapTools::onStart()
                             continue;
                         }
 
-                        m_depotBuildable[x+rx][y+ry] = false;
+                        depotBuildable.unset(x+rx, y+ry);
                     }
                 }
             }
@@ -158,12 +190,12 @@ void MapTools::onFrame()
 
 void MapTools::computeConnectivity()
 {
-    // the fringe data structe we will use to do our BFS searches
-    std::vector<std::array<int, 2>> fringe;
-    fringe.reserve(m_width*m_height);
+    // a single wavefront is reused for every sector since the tiles it visited already belong to a sector
+    WalkableWavefront wavefront(m_grid.walkable());
+    GridPlane<int> & sectorNumbers = m_grid.sectorNumbers();
     int sectorNumber = 0;
 
-    // for every tile on the map, do a connected flood fill using BFS
+    // for every tile on the map, do a connected flood fill
     for (int x = m_min.x; x < m_max.x; ++x)
     {
         for (int y = m_min.y; y < m_max.y; ++y)
@@ -176,31 +208,12 @@ void MapTools::computeConnectivity()
 
             // increase the sector number, so that walkable tiles have sectors 1-N
             sectorNumber++;
+            sectorNumbers(x, y) = sectorNumber;
+            wavefront.addStart(x, y);
 
-            // reset the fringe for the search and add the start tile to it
-            fringe.clear();
-            fringe.push_back({x,y});
-            m_sectorNumber[x][y] = sectorNumber;
-
-            // do the BFS, stopping when we reach the last element of the fringe
-            for (size_t fringeIndex=0; fringeIndex<fringe.size(); ++fringeIndex)
-            {
-                auto & tile = fringe[fringeIndex];
-
-                // check every possible child of this tile
-                for (size_t a=0; a<LegalActions; ++a)
-                {
-                    int nextX = tile[0] + actionX[a];
-                    int nextY = tile[1] + actionY[a];
-
-                    // if the new tile is inside the map bounds, is walkable, and has not been assigned a sector, add it to the current sector and the fringe
-                    if (isValidTile(nextX, nextY) && isWalkable(nextX, nextY) && (getSectorNumber(nextX, nextY) == 0))
-                    {
-                        m_sectorNumber[nextX][nextY] = sectorNumber;
-                        fringe.push_back({nextX, nextY});
-                    }
-                }
-            }
+            // grow the sector until no new tile can be reached
+            auto setSector = [&sectorNumbers, sectorNumber](int tileX, int tileY) { sectorNumbers(tileX, tileY) = sectorNumber; };
+            while (wavefront.step(setSector)) {}
         }
     }
 }
@@ -300,6 +313,53 @@ const DistanceMap & MapTools::getDistanceMap(const CCTilePosition & tile) const
     return m_allMaps[pairTile];
 }
 
+// Computes the missing distance maps of the given tiles in parallel, so the following getDistanceMap calls are cache hits
+void MapTools::computeDistanceMaps(const std::vector<CCTilePosition> & tiles) const
+{
+    std::vector<CCTilePosition> missingTiles;
+    for (auto & tile : tiles)
+    {
+        if (m_allMaps.find(std::pair<int, int>(tile.x, tile.y)) == m_allMaps.end() && std::find(missingTiles.begin(), missingTiles.end(), tile) == missingTiles.end())
+        {
+            missingTiles.push_back(tile);
+        }
+    }
+
+    std::vector<DistanceMap> distanceMaps(missingTiles.size());
+    const size_t threadCount = m_bot.Config().EnableMultiThreading ? std::min<size_t>(missingTiles.size(), std::max(1u, std::thread::hardware_concurrency())) : 0;
+    if (threadCount > 1)
+    {
+        // the walkable mask is read only at this point, so each thread only writes to its own distance maps
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([this, t, threadCount, &missingTiles, &distanceMaps]()
+            {
+                for (size_t i = t; i < missingTiles.size(); i += threadCount)
+                {
+                    distanceMaps[i].computeDistanceMap(m_bot, missingTiles[i]);
+                }
+            });
+        }
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < missingTiles.size(); ++i)
+        {
+            distanceMaps[i].computeDistanceMap(m_bot, missingTiles[i]);
+        }
+    }
+
+    for (size_t i = 0; i < missingTiles.size(); ++i)
+    {
+        m_allMaps[std::pair<int, int>(missingTiles[i].x, missingTiles[i].y)] = std::move(distanceMaps[i]);
+    }
+}
+
 int MapTools::getSectorNumber(int x, int y) const
 {
     if (!isValidTile(x, y))
@@ -307,7 +367,7 @@ int MapTools::getSectorNumber(int x, int y) const
         return 0;
     }
 
-    return m_sectorNumber[x][y];
+    return m_grid.getSectorNumber(x, y);
 }
 
 bool MapTools::isValidTile(int tileX, int tileY) const
@@ -327,9 +387,15 @@ bool MapTools::isValidPosition(const CCPosition & pos) const
 
 void MapTools::drawLine(CCPositionType x1, CCPositionType y1, CCPositionType x2, CCPositionType y2, const CCColor & color) const
 {
+	if (!m_debugDraw.isEnabled())
+		return;
+
+	if (!isInCameraFrustum(std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2)))
+		return;
+
 	const auto p1Height = Util::TerrainHeight(x1, y1);
 	const auto p2Height = Util::TerrainHeight(x2, y2);
-    m_bot.Debug()->DebugLineOut(sc2::Point3D(x1, y1, p1Height + 0.2f), sc2::Point3D(x2, y2, p2Height + 0.2f), color);
+    m_debugDraw.addLine(sc2::Point3D(x1, y1, p1Height + 0.2f), sc2::Point3D(x2, y2, p2Height + 0.2f), color);
 }
 
 void MapTools::drawLine(const CCPosition & p1, const CCPosition & p2, const CCColor & color) const
@@ -344,25 +410,23 @@ void MapTools::drawTile(const CCTilePosition& tilePosition, const CCColor & colo
 
 void MapTools::drawTile(int tileX, int tileY, const CCColor & color, float size, bool checkFrustum) const
 {
-	if (checkFrustum && !isInCameraFrustum(tileX, tileY))
+	if (!m_debugDraw.isEnabled())
 		return;
 
-	size = std::min(1.f, std::max(0.f, size));
-	const float margin = (1.f - size) / 2;
-    CCPositionType px = Util::TileToPosition((float)tileX) + Util::TileToPosition(margin);
-    CCPositionType py = Util::TileToPosition((float)tileY) + Util::TileToPosition(margin);
-    CCPositionType d  = Util::TileToPosition(size);
+	if (checkFrustum && !isInCameraFrustum(tileX, tileY))
+		return;
 
-    drawLine(px,     py,     px + d, py,     color);
-    drawLine(px + d, py,     px + d, py + d, color);
-    drawLine(px + d, py + d, px,     py + d, color);
-    drawLine(px,     py + d, px,     py,     color);
+	// the outline is only built when flushing, once neighboring tiles of the same look are merged
+	m_debugDraw.addTile(tileX, tileY, color, std::min(1.f, std::max(0.f, size)));
 }
 
 void MapTools::drawBox(CCPositionType x1, CCPositionType y1, CCPositionType x2, CCPositionType y2, const CCColor & color) const
 {
+	if (!m_debugDraw.isEnabled())
+		return;
 #ifdef SC2API
-    m_bot.Debug()->DebugBoxOut(sc2::Point3D(x1, y1, m_maxZ + 2.0f), sc2::Point3D(x2, y2, m_maxZ-5.0f), color);
+	if (isInCameraFrustum(std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2)))
+		m_debugDraw.addBox(sc2::Point3D(x1, y1, m_maxZ + 2.0f), sc2::Point3D(x2, y2, m_maxZ-5.0f), color);
 #else
     drawLine(x1, y1, x1, y2, color);
     drawLine(x1, y2, x2, y2, color);
@@ -373,11 +437,7 @@ void MapTools::drawBox(CCPositionType x1, CCPositionType y1, CCPositionType x2,
 
 void MapTools::drawBox(const CCPosition & tl, const CCPosition & br, const CCColor & color) const
 {
-#ifdef SC2API
-    m_bot.Debug()->DebugBoxOut(sc2::Point3D(tl.x, tl.y, m_maxZ + 2.0f), sc2::Point3D(br.x, br.y, m_maxZ-5.0f), color);
-#else
     drawBox(tl.x, tl.y, br.x, br.y, color);
-#endif
 }
 
 void MapTools::drawCircle(const CCPosition & pos, CCPositionType radius, const CCColor & color) const
@@ -387,26 +447,85 @@ void MapTools::drawCircle(const CCPosition & pos, CCPositionType radius, const C
 
 void MapTools::drawCircle(CCPositionType x, CCPositionType y, CCPositionType radius, const CCColor & color) const
 {
-	if(isInCameraFrustum(x, y))
-		m_bot.Debug()->DebugSphereOut(sc2::Point3D(x, y, m_maxZ), radius, color);
+	if (!m_debugDraw.isEnabled())
+		return;
+
+	if(isInCameraFrustum(x - radius, y - radius, x + radius, y + radius))
+		m_debugDraw.addSphere(sc2::Point3D(x, y, m_maxZ), radius, color);
 }
 
 
 void MapTools::drawText(const CCPosition & pos, const std::string & str, const CCColor & color) const
 {
+	if (!m_debugDraw.isEnabled())
+		return;
+
 	if(isInCameraFrustum(pos.x, pos.y))
-		m_bot.Debug()->DebugTextOut(str, sc2::Point3D(pos.x, pos.y, Util::TerrainHeight(pos)), color);
+		m_debugDraw.addText(str, sc2::Point3D(pos.x, pos.y, Util::TerrainHeight(pos)), color);
 }
 
 void MapTools::drawTextScreen(float xPerc, float yPerc, const std::string & str, const CCColor & color) const
 {
+	if (!m_debugDraw.isEnabled())
+		return;
 #ifdef SC2API
-    m_bot.Debug()->DebugTextOut(str, CCPosition(xPerc, yPerc), color);
+    m_debugDraw.addScreenText(str, xPerc, yPerc, color);
 #else
     BWAPI::Broodwar->drawTextScreen(BWAPI::Position((int)(640*xPerc), (int)(480*yPerc)), str.c_str());
 #endif
 }
 
+// Sends the primitives buffered during the frame to the debug interface, it is called once per frame before SendDebug
+void MapTools::flushDebugDraw() const
+{
+#ifdef SC2API
+	auto debug = m_bot.Debug();
+	for (const auto & rectangle : m_debugDraw.getTileRectangles())
+	{
+		const float margin = (1.f - rectangle.size) / 2;
+		const float x1 = rectangle.minX + margin;
+		const float y1 = rectangle.minY + margin;
+		const float x2 = rectangle.maxX - margin;
+		const float y2 = rectangle.maxY - margin;
+		const sc2::Point3D bottomLeft(x1, y1, Util::TerrainHeight(x1, y1) + 0.2f);
+		const sc2::Point3D bottomRight(x2, y1, Util::TerrainHeight(x2, y1) + 0.2f);
+		const sc2::Point3D topRight(x2, y2, Util::TerrainHeight(x2, y2) + 0.2f);
+		const sc2::Point3D topLeft(x1, y2, Util::TerrainHeight(x1, y2) + 0.2f);
+		debug->DebugLineOut(bottomLeft, bottomRight, rectangle.color);
+		debug->DebugLineOut(bottomRight, topRight, rectangle.color);
+		debug->DebugLineOut(topRight, topLeft, rectangle.color);
+		debug->DebugLineOut(topLeft, bottomLeft, rectangle.color);
+	}
+	for (const auto & line : m_debugDraw.getLines())
+		debug->DebugLineOut(line.p1, line.p2, line.color);
+	for (const auto & box : m_debugDraw.getBoxes())
+		debug->DebugBoxOut(box.min, box.max, box.color);
+	for (const auto & sphere : m_debugDraw.getSpheres())
+		debug->DebugSphereOut(sphere.center, sphere.radius, sphere.color);
+	for (const auto & text : m_debugDraw.getTexts())
+	{
+		if (text.screen)
+			debug->DebugTextOut(text.text, CCPosition(text.position.x, text.position.y), text.color);
+		else
+			debug->DebugTextOut(text.text, text.position, text.color);
+	}
+
+	if (m_debugDraw.getTotalDroppedCount() > 0)
+	{
+		std::stringstream ss;
+		ss << "Debug draw budget exceeded, dropped primitives:";
+		for (int i = 0; i < int(DebugDrawCategory::Count); ++i)
+		{
+			const auto category = DebugDrawCategory(i);
+			if (m_debugDraw.getDroppedCount(category) > 0)
+				ss << " " << DebugDrawBuffer::GetCategoryName(category) << " " << m_debugDraw.getDroppedCount(category);
+		}
+		debug->DebugTextOut(ss.str(), CCPosition(0.7f, 0.01f), CCColor(255, 0, 0));
+	}
+#endif
+	m_debugDraw.clear();
+}
+
 bool MapTools::isConnected(int x1, int y1, int x2, int y2) const
 {
     if (!isValidTile(x1, y1) || !isValidTile(x2, y2))
@@ -437,7 +556,7 @@ bool MapTools::isBuildable(int tileX, int tileY) const
         return false;
     }
 
-	return m_buildable[tileX][tileY];
+	return m_grid.isBuildable(tileX, tileY);
 }
 
 
@@ -448,18 +567,175 @@ bool MapTools::isBuildable(const CCTilePosition & tile) const
 		return false;
 	}
 
-	return m_buildable[tile.x][tile.y];
+	return m_grid.isBuildable(tile.x, tile.y);
 }
 
 bool MapTools::canBuildTypeAtPosition(int tileX, int tileY, const UnitType & type) const
 {
 #ifdef SC2API
-    return m_bot.Query()->Placement(m_bot.Data(type).buildAbility, CCPosition((float)tileX, (float)tileY));
+    return canBuildTypeAtPositions({ CCTilePosition(tileX, tileY) }, type)[0];
 #else
     return BWAPI::Broodwar->canBuildHere(BWAPI::TilePosition(tileX, tileY), type.getAPIUnitType());
 #endif
 }
 
+// Tiles are the center tiles of the buildings (same convention as the BuildingPlacer).
+// Placements are first predicted locally, only the uncertain ones are sent to the game in a single batched query.
+std::vector<bool> MapTools::canBuildTypeAtPositions(const std::vector<CCTilePosition> & tiles, const UnitType & type) const
+{
+    std::vector<bool> results(tiles.size(), false);
+#ifdef SC2API
+    std::lock_guard<std::mutex> lock(m_placementMutex);
+    updatePlacementFrameData();
+
+    const sc2::AbilityID buildAbility = m_bot.Data(type).buildAbility;
+    const int offset = type.tileWidth() / 2;
+    const float halfWidth = type.tileWidth() / 2.f;
+    std::vector<sc2::QueryInterface::PlacementQuery> queries;
+    std::vector<size_t> queryIndices;
+    for (size_t i = 0; i < tiles.size(); ++i)
+    {
+        const auto & tile = tiles[i];
+        const auto key = std::make_tuple(uint32_t(buildAbility), tile.x, tile.y);
+        const auto it = m_placementCache.find(key);
+        if (it != m_placementCache.end())
+        {
+            ++m_placementCacheHits;
+            results[i] = it->second;
+            continue;
+        }
+
+        const auto prediction = predictPlacement(tile.x, tile.y, type);
+        if (prediction != UNCERTAIN)
+        {
+            ++m_placementLocalHits;
+            results[i] = prediction == VALID;
+            m_placementCache[key] = results[i];
+            continue;
+        }
+
+        // The position sent to the game is the center of the footprint
+        const CCPosition center(tile.x - offset + halfWidth, tile.y - offset + halfWidth);
+        queries.push_back(sc2::QueryInterface::PlacementQuery(buildAbility, center));
+        queryIndices.push_back(i);
+    }
+
+    if (!queries.empty())
+    {
+        ++m_placementQueries;
+        m_placementQueriedPositions += queries.size();
+        const auto queryResults = m_bot.Query()->Placement(queries);
+        for (size_t i = 0; i < queryResults.size() && i < queryIndices.size(); ++i)
+        {
+            const auto & tile = tiles[queryIndices[i]];
+            results[queryIndices[i]] = queryResults[i];
+            m_placementCache[std::make_tuple(uint32_t(buildAbility), tile.x, tile.y)] = queryResults[i];
+        }
+    }
+#else
+    for (size_t i = 0; i < tiles.size(); ++i)
+    {
+        results[i] = canBuildTypeAtPosition(tiles[i].x, tiles[i].y, type);
+    }
+#endif
+    return results;
+}
+
+// Resets the placement cache and rasterizes the footprints of the visible units once per frame. m_placementMutex must be locked.
+void MapTools::updatePlacementFrameData() const
+{
+    const uint32_t currentFrame = m_bot.GetCurrentFrame();
+    if (m_placementFrame == currentFrame && m_occupiedTiles.width() > 0)
+        return;
+
+    m_placementFrame = currentFrame;
+    m_placementCache.clear();
+    if (m_occupiedTiles.width() == 0)
+    {
+        m_occupiedTiles = TileBitmask(m_totalWidth, m_totalHeight);
+        m_groundUnitTiles = TileBitmask(m_totalWidth, m_totalHeight);
+    }
+    m_occupiedTiles.clear();
+    m_groundUnitTiles.clear();
+    m_geyserPlacements.clear();
+
+    for (auto & unit : m_bot.GetUnits())
+    {
+        // the geysers are found once per frame, looking up the type data of every unit for each refinery query was costly
+        const auto & unitType = unit.getType();
+        const auto geyserTile = std::make_pair(unit.getTilePosition().x, unit.getTilePosition().y);
+        if (unitType.isRefinery())
+            m_geyserPlacements[geyserTile] = INVALID;
+        else if (unit.getPlayer() == Players::Neutral && unitType.isGeyser() && m_geyserPlacements.find(geyserTile) == m_geyserPlacements.end())
+            m_geyserPlacements[geyserTile] = unit.getUnitPtr()->display_type == sc2::Unit::Visible ? VALID : UNCERTAIN;
+
+        if (unit.isFlying() || unit.getUnitPtr()->display_type != sc2::Unit::Visible)
+            continue;
+
+        if (unit.getType().isBuilding())
+        {
+            CCTilePosition bottomLeft;
+            CCTilePosition topRight;
+            unit.getBuildingLimits(bottomLeft, topRight);
+            for (int x = bottomLeft.x; x < topRight.x; ++x)
+            {
+                for (int y = bottomLeft.y; y < topRight.y; ++y)
+                {
+                    if (isValidTile(x, y))
+                        m_occupiedTiles.set(x, y);
+                }
+            }
+        }
+        else
+        {
+            const auto tile = unit.getTilePosition();
+            if (isValidTile(tile))
+                m_groundUnitTiles.set(tile.x, tile.y);
+        }
+    }
+}
+
+MapTools::PlacementPrediction MapTools::predictPlacement(int tileX, int tileY, const UnitType & type) const
+{
+    if (type.isRefinery())
+    {
+        const auto it = m_geyserPlacements.find(std::make_pair(tileX, tileY));
+        return it != m_geyserPlacements.end() ? it->second : INVALID;
+    }
+
+    const auto race = type.getRace();
+    const bool needsCreep = Util::IsZerg(race) && !type.isResourceDepot();
+    // hatcheries can be placed with or without creep, the other buildings need creep only if they are zerg
+    const bool checkCreep = !Util::IsZerg(race) || !type.isResourceDepot();
+    const bool needsPower = Util::IsProtoss(race) && !type.isResourceDepot() && !type.isSupplyProvider();
+    if (needsPower && !isPowered(tileX, tileY))
+        return INVALID;
+
+    PlacementPrediction prediction = VALID;
+    const int offset = type.tileWidth() / 2;
+    for (int x = tileX - offset; x < tileX - offset + type.tileWidth(); ++x)
+    {
+        for (int y = tileY - offset; y < tileY - offset + type.tileHeight(); ++y)
+        {
+            if (!isBuildable(x, y) || (type.isResourceDepot() && !isDepotBuildableTile(x, y)))
+                return INVALID;
+            if (m_occupiedTiles.get(x, y))
+                return INVALID;
+            if (!isVisible(x, y))
+            {
+                // we don't know what might be hiding in the fog
+                prediction = UNCERTAIN;
+                continue;
+            }
+            if (checkCreep && m_bot.Observation()->HasCreep(CCPosition(x + HALF_TILE, y + HALF_TILE)) != needsCreep)
+                return INVALID;
+            if (m_groundUnitTiles.get(x, y) || m_bot.Commander().Combat().isTileBlocked(x, y))
+                prediction = UNCERTAIN;
+        }
+    }
+    return prediction;
+}
+
 void MapTools::printMap()
 {
     std::stringstream ss;
@@ -485,7 +761,7 @@ bool MapTools::isDepotBuildableTile(int tileX, int tileY) const
         return false;
     }
 
-    return m_depotBuildable[tileX][tileY];
+    return m_grid.isDepotBuildable(tileX, tileY);
 }
 
 bool MapTools::isWalkable(int tileX, int tileY) const
@@ -495,7 +771,7 @@ bool MapTools::isWalkable(int tileX, int tileY) const
         return false;
     }
 
-    return m_walkable[tileX][tileY];
+    return m_grid.isWalkable(tileX, tileY);
 }
 
 bool MapTools::isWalkable(const CCTilePosition & tile) const
@@ -532,6 +808,13 @@ bool MapTools::isInCameraFrustum(int x, int y) const
 	return x >= camera.x - 17 && x <= camera.x + 17 && y >= camera.y - 12 && y <= camera.y + 12;
 }
 
+// Whether the rectangle overlaps the area seen by the camera
+bool MapTools::isInCameraFrustum(float minX, float minY, float maxX, float maxY) const
+{
+	const CCPosition camera = m_bot.Observation()->GetCameraPos();
+	return maxX >= camera.x - 17 && minX <= camera.x + 17 && maxY >= camera.y - 12 && minY <= camera.y + 12;
+}
+
 bool MapTools::canBuild(int tileX, int tileY) 
 {
     auto & info = m_bot.Observation()->GetGameInfo();
@@ -559,6 +842,8 @@ void MapTools::draw() const
 		return;
 	}
 
+	DebugDrawScope drawScope(m_debugDraw, DebugDrawCategory::Map);
+
 #ifdef SC2API
     CCPosition camera = m_bot.Observation()->GetCameraPos();
     int sx = (int)(camera.x - 12.0f);
@@ -1,13 +1,27 @@
 #pragma once
 
 #include <vector>
+#include <tuple>
+#include <mutex>
+#include <map>
 #include "DistanceMap.h"
+#include "MapGrid.h"
+#include "DebugDrawBuffer.h"
 #include "UnitType.h"
 
 class CCBot;
 
 class MapTools
 {
+public:
+    enum PlacementPrediction
+    {
+        INVALID,
+        VALID,
+        UNCERTAIN
+    };
+
+private:
     CCBot & m_bot;
 	int     m_totalWidth;
 	int     m_totalHeight;
@@ -22,12 +36,27 @@ class MapTools
     // a cache of already computed distance maps, which is mutable since it only acts as a cache
     mutable std::map<std::pair<int,int>, DistanceMap>   m_allMaps;   
 
-    std::vector<std::vector<bool>>  m_walkable;         // whether a tile is buildable (includes static resources)
-    std::vector<std::vector<bool>>  m_buildable;        // whether a tile is buildable (includes static resources)
-    std::vector<std::vector<bool>>  m_depotBuildable;   // whether a depot is buildable on a tile (illegal within 3 tiles of static resource)
-    std::vector<std::vector<int>>   m_sectorNumber;     // connectivity sector number, two tiles are ground connected if they have the same number
+    MapGrid                         m_grid;             // the static terrain layers, out of map tiles are not walkable
+
+    // a frame-scoped cache of the building placements already validated, which is mutable since it only acts as a cache
+    // it can be queried from the micro threads, m_placementMutex guards it along with the frame data and the counters
+    mutable std::mutex m_placementMutex;
+    mutable std::map<std::tuple<uint32_t, int, int>, bool> m_placementCache;   // (build ability, x, y) -> can build
+    mutable TileBitmask m_occupiedTiles;        // tiles covered by a visible building this frame
+    mutable TileBitmask m_groundUnitTiles;      // tiles with a visible ground unit this frame
+    mutable std::map<std::pair<int, int>, PlacementPrediction> m_geyserPlacements;   // refinery placement on each geyser this frame
+    mutable uint32_t m_placementFrame;
+    mutable int m_placementLocalHits;
+    mutable int m_placementCacheHits;
+    mutable int m_placementQueries;
+    mutable int m_placementQueriedPositions;
+
+    // the draw functions are const, the buffer only records what to send to the debug interface
+    mutable DebugDrawBuffer m_debugDraw;
     
     void computeConnectivity();
+    void updatePlacementFrameData() const;
+    PlacementPrediction predictPlacement(int tileX, int tileY, const UnitType & type) const;
 
     int getSectorNumber(int x, int y) const;
         
@@ -36,11 +65,13 @@ class MapTools
     bool    canBuild(int tileX, int tileY);
     bool    canWalk(int tileX, int tileY);
 	bool isInCameraFrustum(int x, int y) const;
+	bool isInCameraFrustum(float minX, float minY, float maxX, float maxY) const;
 
 public:
 
     MapTools(CCBot & bot);
 
+    void    initializeTerrain();
     void    onStart();
     void    onFrame();
     void    draw() const;
@@ -67,6 +98,9 @@ public:
     void    drawCircle(const CCPosition & pos, CCPositionType radius, const CCColor & color = CCColor(255, 255, 255)) const;
     void    drawText(const CCPosition & pos, const std::string & str, const CCColor & color = CCColor(255, 255, 255)) const;
     void    drawTextScreen(float xPerc, float yPerc, const std::string & str, const CCColor & color = CCColor(255, 255, 255)) const;
+    DebugDrawBuffer & getDebugDraw() const { return m_debugDraw; }
+    void    flushDebugDraw() const;
+    void    clearDebugDraw() const { m_debugDraw.clear(); }
     
     bool    isValidTile(int tileX, int tileY) const;
     bool    isValidTile(const CCTilePosition & tile) const;
@@ -78,9 +112,17 @@ public:
 	bool	isVisible(CCPosition pos) const;
     bool    isVisible(int tileX, int tileY) const;
     bool    canBuildTypeAtPosition(int tileX, int tileY, const UnitType & type) const;
+    std::vector<bool> canBuildTypeAtPositions(const std::vector<CCTilePosition> & tiles, const UnitType & type) const;
+    int     getPlacementLocalHits() const { return m_placementLocalHits; }
+    int     getPlacementCacheHits() const { return m_placementCacheHits; }
+    int     getPlacementQueries() const { return m_placementQueries; }
+    int     getPlacementQueriedPositions() const { return m_placementQueriedPositions; }
 
     const   DistanceMap & getDistanceMap(const CCTilePosition & tile) const;
     const   DistanceMap & getDistanceMap(const CCPosition & tile) const;
+    void    computeDistanceMaps(const std::vector<CCTilePosition> & tiles) const;
+    const   MapGrid & getGrid() const { return m_grid; }
+    const   TileBitmask & getWalkableMask() const { return m_grid.walkable(); }
     int     getGroundDistance(const CCPosition & src, const CCPosition & dest) const;
     bool    isConnected(int x1, int y1, int x2, int y2) const;
     bool    isConnected(const CCTilePosition & from, const CCTilePosition & to) const;
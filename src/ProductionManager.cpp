@@ -1142,8 +1142,12 @@ void ProductionManager::fixBuildOrderDeadlock(BuildOrderItem & item)
 {
 	const TypeData& typeData = m_bot.Data(item.type);
 
+	// when the whole tech path is owned, being built or queued, there is no requirement or producer to add.
+	// Addons are excluded because their producer must not already have an addon.
+	const bool hasTechPath = !typeData.isAddon && (typeData.techPath & ~getAvailableTechTypes(true)).none();
+
 	// check to see if we have the prerequisites for the item
-    if (!hasRequired(item.type, true))
+    if (!hasTechPath && !hasRequired(item.type, true))
     {
 		for (auto & required : typeData.requiredUnits)
 		{
@@ -1160,7 +1164,7 @@ void ProductionManager::fixBuildOrderDeadlock(BuildOrderItem & item)
 
     // build the producer of the unit if we don't have one
 	MetaType builder = MetaType(typeData.whatBuilds[0], m_bot);
-    if (!hasProducer(item.type, true) && !m_queue.contains(builder))
+    if (!hasTechPath && !hasProducer(item.type, true) && !m_queue.contains(builder))
     {
 		std::cout << item.type.getName() << " needs a producer: " << builder.getName() << "\n";
 		BuildOrderItem producerItem = m_queue.queueItem(BuildOrderItem(builder, 0, item.blocking));
@@ -1374,8 +1378,9 @@ void ProductionManager::lowPriorityChecks()
 
 bool ProductionManager::currentlyHasRequirement(MetaType currentItem) const
 {
- 	auto requiredUnits = m_bot.Data(currentItem).requiredUnits;
-	if (requiredUnits.empty())
+	const TypeData & typeData = m_bot.Data(currentItem);
+	// every requirement is completed, the special cases below are only for the missing ones
+	if ((typeData.requiredTechTypes & ~m_bot.GetCompletedTechTypes()).none())
 	{
 		return true;
 	}
@@ -1431,24 +1436,28 @@ bool ProductionManager::currentlyHasRequirement(MetaType currentItem) const
 	return true;
 }
 
+// The tech types we own, that are being built or trained and optionally that are queued
+TechMask ProductionManager::getAvailableTechTypes(bool checkInQueue) const
+{
+	TechMask available = m_bot.GetCompletedTechTypes() | m_bot.Buildings().getTechTypesBeingBuilt() | m_bot.Buildings().getTechTypesInProduction();
+	if (checkInQueue)
+		available |= m_queue.getQueuedTechTypes();
+	return available;
+}
+
 bool ProductionManager::hasRequired(const MetaType& metaType, bool checkInQueue) const
 {
 	const TypeData& typeData = m_bot.Data(metaType);
 
-	if (typeData.requiredUnits.empty())
-		return true;
-
-	for (auto & required : typeData.requiredUnits)
-	{
-		if (!hasRequiredUnit(required, checkInQueue))
-			return false;
-	}
-
-	return true;
+	return (typeData.requiredTechTypes & ~getAvailableTechTypes(checkInQueue)).none();
 }
 
 bool ProductionManager::hasRequiredUnit(const UnitType& unitType, bool checkInQueue) const
 {
+	const int techTypeIndex = m_bot.Tech().getTechTypeIndex(unitType);
+	if (techTypeIndex > 0)
+		return getAvailableTechTypes(checkInQueue).test(techTypeIndex);
+
 	if (m_bot.UnitInfo().getUnitTypeCount(Players::Self, unitType, false, true) > 0)
 		return true;
 
@@ -1493,15 +1502,9 @@ bool ProductionManager::hasProducer(const MetaType& metaType, bool checkInQueue)
 			//Addons do not check further or else we could try to build an addon on a building with an addon already.
 			return checkInQueue && m_queue.contains(MetaType(producer, m_bot));
 		}
-		if (m_bot.UnitInfo().getUnitTypeCount(Players::Self, producer, false, true) > 0)
-			return true;
-		if (m_bot.Buildings().isBeingBuilt(producer))
-			return true;
-		if (checkInQueue && m_queue.contains(MetaType(producer, m_bot)))
-			return true;
 	}
 
-	return false;
+	return (typeData.producerTechTypes & getAvailableTechTypes(checkInQueue)).any();
 }
 
 Unit ProductionManager::getProducer(const MetaType & type, CCPosition closestTo) const
@@ -2135,7 +2138,7 @@ bool ProductionManager::canMakeNow(const Unit & producer, const MetaType & type)
 	}
 
 #ifdef SC2API
-	sc2::AvailableAbilities available_abilities = m_bot.Query()->GetAbilitiesForUnit(producer.getUnitPtr());
+	const sc2::AvailableAbilities & available_abilities = m_bot.Abilities().getAbilities(producer.getUnitPtr());
 
 	// quick check if the unit can't do anything it certainly can't build the thing we want
 	if (available_abilities.abilities.empty())
@@ -2190,10 +2193,16 @@ bool ProductionManager::canMakeNow(const Unit & producer, const MetaType & type)
 #endif
 }
 
+// The queue is deadlocked when an item needs a tech type that we do not own, are not making and that is not queued
 bool ProductionManager::detectBuildOrderDeadlock()
 {
-    // TODO: detect build order deadlocks here
-    return false;
+	const TechMask available = getAvailableTechTypes(true);
+	for (size_t i = 0; i < m_queue.size(); ++i)
+	{
+		if ((m_bot.Data(m_queue[i].type).techPath & ~available).any())
+			return true;
+	}
+	return false;
 }
 
 int ProductionManager::getExtraMinerals()
@@ -45,6 +45,7 @@ class ProductionManager
 	void	fixBuildOrderDeadlock(BuildOrderItem & item);
 	void	lowPriorityChecks();
 	bool	currentlyHasRequirement(MetaType currentItem) const;
+	TechMask getAvailableTechTypes(bool checkInQueue) const;
 	bool	hasRequiredUnit(const UnitType& unitType, bool checkInQueue) const;
 	bool	hasProducer(const MetaType& metaType, bool checkInQueue);
 
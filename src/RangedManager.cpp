@@ -18,6 +18,8 @@ const float HARASS_THREAT_MAX_REPULSION_INTENSITY = 1.5f;
 const float HARASS_THREAT_RANGE_BUFFER = 1.f;
 const float HARASS_THREAT_SPEED_MULTIPLIER_FOR_KD8CHARGE = 2.25f;
 const int HARASS_PATHFINDING_COOLDOWN_AFTER_FAIL = 50;
+const uint32_t PATH_PLANNER_KEEP_FRAMES = 48;
+const uint32_t VIKINGS_SIMULATION_MAX_AGE = 48;	// the result of an older simulation of the Vikings against the Tempests is not used anymore
 const int BATTLECRUISER_TELEPORT_FRAME_COUNT = 90;
 const int BATTLECRUISER_TELEPORT_COOLDOWN_FRAME_COUNT = 1591 + BATTLECRUISER_TELEPORT_FRAME_COUNT;
 const int BATTLECRUISER_YAMATO_CANNON_FRAME_COUNT = 68;
@@ -45,7 +47,7 @@ const std::vector<std::string> THREAT_FIGHTING_ACTION_DESCRIPTIONS = {
 	ACTION_DESCRIPTION_THREAT_FIGHT_MORPH
 };
 
-RangedManager::RangedManager(CCBot & bot) : MicroManager(bot)
+RangedManager::RangedManager(CCBot & bot) : MicroManager(bot), m_threatIndex(bot)
 {
 }
 
@@ -80,6 +82,7 @@ void RangedManager::executeMicro()
 		return;
 
 	sc2::Units rangedUnits;
+	rangedUnits.reserve(units.size());
 	for (auto & unit : units)
 	{
 		const sc2::Unit * rangedUnit = unit.getUnitPtr();
@@ -95,6 +98,7 @@ void RangedManager::executeMicro()
 	}
 
     sc2::Units rangedUnitTargets;
+    rangedUnitTargets.reserve(m_targets.size());
     for (auto target : m_targets)
     {
         rangedUnitTargets.push_back(target.getUnitPtr());
@@ -160,16 +164,58 @@ void RangedManager::HarassLogic(sc2::Units &rangedUnits, sc2::Units &rangedUnitT
 	return;
 #endif
 
-	m_combatSimulationResults.clear();
 	m_threatsForUnit.clear();
 	m_threatTargetForUnit.clear();
 	m_dummyAssaultVikings.clear();
 
+	// The planners are created here so the unit threads never modify the map
+	for (auto it = m_pathPlanners.begin(); it != m_pathPlanners.end();)
+	{
+		if (m_bot.GetCurrentFrame() - it->second.getLastUseFrame() > PATH_PLANNER_KEEP_FRAMES && !Util::Contains(it->first, rangedUnits))
+			it = m_pathPlanners.erase(it);
+		else
+			++it;
+	}
+	for (auto rangedUnit : rangedUnits)
+	{
+		if (m_pathPlanners.find(rangedUnit) == m_pathPlanners.end())
+			m_pathPlanners.emplace(rangedUnit, IncrementalPathPlanner(m_bot));
+	}
+
+	m_bot.StartProfiling("0.10.4.1.5.0        PrepareHarassLogic");
+	sc2::Units allyCombatUnits(rangedUnits);
+	allyCombatUnits.insert(allyCombatUnits.end(), otherSquadsUnits.begin(), otherSquadsUnits.end());
+
+	m_bot.StartProfiling("0.10.4.1.5.0.0          BuildThreatIndex");
+	float maxAllyRadius = 0.f;
+	for (const auto allyUnit : allyCombatUnits)
+		maxAllyRadius = std::max(maxAllyRadius, allyUnit->radius);
+	m_threatIndex.build(rangedUnitTargets, maxAllyRadius);
+	m_bot.StopProfiling("0.10.4.1.5.0.0          BuildThreatIndex");
+
+	m_bot.StartProfiling("0.10.4.1.5.0.1          CalcEngagementClusters");
+	std::vector<sc2::Units> engagementClusters;
+	CalcEngagementClusters(allyCombatUnits, rangedUnitTargets, engagementClusters);
+	m_bot.StopProfiling("0.10.4.1.5.0.1          CalcEngagementClusters");
+
+	m_bot.StartProfiling("0.10.4.1.5.0.2          SimulateEngagements");
+	m_engagementResults.assign(engagementClusters.size(), EngagementResult());
+	for (size_t i = 0; i < engagementClusters.size(); ++i)
+	{
+		// The clusters made only of units of other squads are fought by their own squad
+		const auto & clusterUnits = engagementClusters[i];
+		if (std::none_of(clusterUnits.begin(), clusterUnits.end(), [&rangedUnits](const sc2::Unit * unit) { return Util::Contains(unit, rangedUnits); }))
+			continue;
+		SimulateEngagement(clusterUnits, allyCombatUnits, rangedUnitTargets, otherSquadsUnits, m_engagementResults[i]);
+	}
+	m_bot.StopProfiling("0.10.4.1.5.0.2          SimulateEngagements");
+	m_bot.StopProfiling("0.10.4.1.5.0        PrepareHarassLogic");
+
 	m_bot.StartProfiling("0.10.4.1.5.1        HarassLogicForUnit");
 	if (m_bot.Config().EnableMultiThreading)
 	{
 		std::list<std::thread*> threads;
-		for (int i = 0; i < rangedUnits.size(); ++i)
+		for (size_t i = 0; i < rangedUnits.size(); ++i)
 		{
 			auto rangedUnit = rangedUnits[i];
 			sc2::AvailableAbilities unitAbilities;
@@ -185,7 +231,7 @@ void RangedManager::HarassLogic(sc2::Units &rangedUnits, sc2::Units &rangedUnitT
 	}
 	else
 	{
-		for (int i = 0; i < rangedUnits.size(); ++i)
+		for (size_t i = 0; i < rangedUnits.size(); ++i)
 		{
 			auto rangedUnit = rangedUnits[i];
 			sc2::AvailableAbilities unitAbilities;
@@ -194,6 +240,305 @@ void RangedManager::HarassLogic(sc2::Units &rangedUnits, sc2::Units &rangedUnitT
 		}
 	}
 	m_bot.StopProfiling("0.10.4.1.5.1        HarassLogicForUnit");
+
+	// rangedUnitTargets does not outlive the call
+	m_threatIndex.clear();
+}
+
+/*
+ * Simulates the Vikings against the Tempests on the simulation worker, before the strategic simulations.
+ * The result of the previous request is kept until the new one arrives, a result that is too old makes the Vikings stay away.
+ */
+bool RangedManager::SimulateVikingsAgainstTempests(const sc2::Units & vikings, const sc2::Units & tempests)
+{
+	const uint32_t currentFrame = m_bot.GetCurrentFrame();
+	float simulationResult;
+	if (CombatSimulationService::poll(m_pendingVikingsSimulation, simulationResult))
+	{
+		m_vikingsWinAgainstTempests = simulationResult > 0.f;
+		m_vikingsSimulationFrame = m_pendingVikingsSimulationFrame;
+	}
+	if (!m_pendingVikingsSimulation.valid())
+	{
+		Util::CombatSimulation simulation;
+		Util::PrepareCombatSimulation(vikings, vikings, tempests, simulation, m_bot);
+		m_pendingVikingsSimulation = m_bot.Commander().Combat().getSimulationService().request(std::move(simulation), CombatSimulationService::Priority::MicroCritical);
+		m_pendingVikingsSimulationFrame = currentFrame;
+	}
+	return m_vikingsWinAgainstTempests && currentFrame - m_vikingsSimulationFrame <= VIKINGS_SIMULATION_MAX_AGE;
+}
+
+/*
+ * Partitions our units in interaction clusters for the threat fighting logic.
+ * Allies close enough to support each other and allies threatened by the same enemy end up in the same cluster.
+ * The threats come from getThreats, so the threat index must be built before.
+ */
+void RangedManager::CalcEngagementClusters(const sc2::Units & allyUnits, const sc2::Units & enemyUnits, std::vector<sc2::Units> & clusters)
+{
+	m_engagementClusterForUnit.clear();
+	clusters.clear();
+
+	std::vector<size_t> parents(allyUnits.size());
+	for (size_t i = 0; i < allyUnits.size(); ++i)
+		parents[i] = i;
+	const auto findRoot = [&parents](size_t i)
+	{
+		while (parents[i] != i)
+		{
+			parents[i] = parents[parents[i]];
+			i = parents[i];
+		}
+		return i;
+	};
+	const auto merge = [&parents, &findRoot](size_t first, size_t second)
+	{
+		const size_t firstRoot = findRoot(first);
+		const size_t secondRoot = findRoot(second);
+		if (firstRoot != secondRoot)
+			parents[secondRoot] = firstRoot;
+	};
+
+	for (size_t i = 0; i < allyUnits.size(); ++i)
+	{
+		for (size_t j = i + 1; j < allyUnits.size(); ++j)
+		{
+			if (Util::DistSq(allyUnits[i]->pos, allyUnits[j]->pos) <= HARASS_FRIENDLY_SUPPORT_MAX_DISTANCE * HARASS_FRIENDLY_SUPPORT_MAX_DISTANCE)
+				merge(i, j);
+		}
+	}
+	std::map<const sc2::Unit *, size_t> firstAllyForThreat;
+	for (size_t i = 0; i < allyUnits.size(); ++i)
+	{
+		for (const auto threat : getThreats(allyUnits[i], enemyUnits))
+		{
+			const auto it = firstAllyForThreat.insert(std::make_pair(threat, i));
+			if (!it.second)
+				merge(it.first->second, i);
+		}
+	}
+
+	std::map<size_t, int> clusterForRoot;
+	for (size_t i = 0; i < allyUnits.size(); ++i)
+	{
+		const auto it = clusterForRoot.insert(std::make_pair(findRoot(i), int(clusterForRoot.size())));
+		if (it.second)
+			clusters.push_back(sc2::Units());
+		clusters[it.first->second].push_back(allyUnits[i]);
+		m_engagementClusterForUnit[allyUnits[i]] = it.first->second;
+	}
+}
+
+/*
+ * Simulates the fight of all the units of a cluster against all their threats.
+ * The Stim and the Vikings against Tempests variants are simulated at the same time, each unit then only reads the result.
+ */
+void RangedManager::SimulateEngagement(const sc2::Units & clusterUnits, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, sc2::Units & otherSquadsUnits, EngagementResult & engagement)
+{
+	sc2::Units closeUnits;
+	std::vector<std::pair<const sc2::Unit *, const sc2::Unit *>> closeUnitsTarget;
+	std::map<const sc2::Unit *, sc2::Unit> simulatedStimedUnits;
+	float unitsPower = 0.f;
+	float stimedUnitsPowerDifference = 0.f;
+	float minUnitRange = -1.f;
+	bool supportedByOtherSquads = false;
+	for (const auto unit : clusterUnits)
+	{
+		auto & unitAction = m_bot.Commander().Combat().GetRangedUnitAction(unit);
+		// Ignore units that are executing a prioritized action other than a threat fighting one
+		if (unitAction.prioritized && !Util::Contains(unitAction.description, THREAT_FIGHTING_ACTION_DESCRIPTIONS))
+			continue;
+		// Ignore Cyclones because their health is too valuable to trade
+		if (unit->unit_type == sc2::UNIT_TYPEID::TERRAN_CYCLONE)
+			continue;
+		// Ignore units that are disabled
+		if (Util::isUnitDisabled(unit))
+			continue;
+		const sc2::Unit * unitTarget = nullptr;
+		const sc2::Unit * simulatedUnit = GetSimulatedUnit(unit, allyCombatUnits, rangedUnitTargets, unitTarget);
+		if (!simulatedUnit)
+			continue;
+		// Ignore units that should heal to not consider them in the power calculation, unless their target is a Tempest
+		if (unitTarget->unit_type != sc2::UNIT_TYPEID::PROTOSS_TEMPEST && m_bot.Commander().Combat().ShouldUnitHeal(unit))
+			continue;
+
+		const auto unitPower = Util::GetUnitPower(simulatedUnit, unitTarget, m_bot);
+		// If the unit can use Stim we simulate it to compare and find if it is worth using it
+		if (CanUseStim(simulatedUnit))
+		{
+			simulatedStimedUnits[simulatedUnit] = simulatedUnit->unit_type == sc2::UNIT_TYPEID::TERRAN_MARINE ? Util::CreateDummyStimedMarineFromUnit(simulatedUnit) : Util::CreateDummyStimedMarauderFromUnit(simulatedUnit);
+			stimedUnitsPowerDifference += Util::GetUnitPower(&simulatedStimedUnits[simulatedUnit], unitTarget, m_bot) - unitPower;
+		}
+		closeUnits.push_back(simulatedUnit);
+		closeUnitsTarget.push_back(std::make_pair(simulatedUnit, unitTarget));
+		unitsPower += unitPower;
+		const float unitRange = Util::GetAttackRangeForTarget(simulatedUnit, unitTarget, m_bot);
+		if (minUnitRange < 0 || unitRange < minUnitRange)
+			minUnitRange = unitRange;
+		if (Util::Contains(unit, otherSquadsUnits))
+			supportedByOtherSquads = true;
+	}
+	if (closeUnits.empty())
+		return;
+
+	// Calculate all the threats of all the ally units participating in the fight
+	std::set<const sc2::Unit *> allThreatsSet;
+	for (const auto allyUnit : closeUnits)
+	{
+		const auto & allyUnitThreats = getThreats(allyUnit, rangedUnitTargets);
+		allThreatsSet.insert(allyUnitThreats.begin(), allyUnitThreats.end());
+	}
+	// Add enemies that are close to the threats
+	for (const auto enemy : rangedUnitTargets)
+	{
+		if (Util::Contains(enemy, allThreatsSet))
+			continue;
+		bool closeToThreat = false;
+		for (const auto threat : allThreatsSet)
+		{
+			if (Util::DistSq(threat->pos, enemy->pos) <= 3.f * 3.f)
+			{
+				closeToThreat = true;
+				break;
+			}
+		}
+		if (!closeToThreat)
+			continue;
+		const auto enemyTarget = getTarget(enemy, allyCombatUnits, false);
+		if (!enemyTarget)
+			continue;
+		const auto threatRange = Util::getThreatRange(enemyTarget, enemy, m_bot) + 3.f;
+		if (Util::DistSq(enemy->pos, enemyTarget->pos) <= threatRange * threatRange)
+			allThreatsSet.insert(enemy);
+	}
+	if (allThreatsSet.empty())
+		return;
+
+	float targetsPower = 0.f;
+	float maxThreatRange = 0.f;
+	sc2::Units threatsToKeep;
+	// Calculate enemy power
+	for (const auto threat : allThreatsSet)
+	{
+		if (threat->unit_type == sc2::UNIT_TYPEID::TERRAN_KD8CHARGE)
+			continue;
+		const float threatSpeed = Util::getSpeedOfUnit(threat, m_bot);
+		if (threatSpeed > engagement.maxThreatSpeed)
+			engagement.maxThreatSpeed = threatSpeed;
+		const sc2::Unit* threatTarget = getTarget(threat, closeUnits, false);
+		const float threatRange = Util::GetAttackRangeForTarget(threat, threatTarget, m_bot);
+		const float threatDistance = threatTarget ? Util::Dist(threat->pos, threatTarget->pos) : 0.f;
+		// If the building threat is too far from its target to attack it (with a very small buffer)
+		if (Unit(threat, m_bot).getType().isBuilding() && threatTarget && threatDistance > threatRange + 0.01f)
+		{
+			bool unitWillGetCloseEnough = false;
+			// Simulate the future position of our units to check if they would be in range of the building
+			for (const auto & unitTargetPair : closeUnitsTarget)
+			{
+				const auto unit = unitTargetPair.first;
+				const auto unitTarget = unitTargetPair.second;
+				if (Util::IsEnemyHiddenOnHighGround(unit, unitTarget, m_bot))
+				{
+					unitWillGetCloseEnough = true;
+					break;
+				}
+				const float unitRange = Util::GetAttackRangeForTarget(unit, unitTarget, m_bot);
+				const CCPosition futurePosition = unitTarget->pos + Util::Normalized(unit->pos - unitTarget->pos) * unitRange;
+				if (Util::Dist(threat->pos, futurePosition) <= threatRange)
+				{
+					unitWillGetCloseEnough = true;
+					break;
+				}
+			}
+			if (!unitWillGetCloseEnough)
+				continue;
+		}
+		if (threatRange > maxThreatRange)
+			maxThreatRange = threatRange;
+		targetsPower += Util::GetUnitPower(threat, threatTarget, m_bot);
+		threatsToKeep.push_back(threat);
+	}
+
+	// If our units have 2 more range, they should kite, not trade
+	if (minUnitRange - maxThreatRange >= 2.f)
+	{
+		engagement.shouldKite = true;
+		return;
+	}
+
+	const bool enemyHasLongRangeUnits = maxThreatRange >= 10;
+
+	sc2::Units vikings;
+	sc2::Units tempests;
+	int injuredVikings = 0;
+	int injuredTempests = 0;
+	for (const auto ally : closeUnits)
+	{
+		if (ally->unit_type == sc2::UNIT_TYPEID::TERRAN_VIKINGFIGHTER)
+		{
+			vikings.push_back(ally);
+			if (ally->health < ally->health_max)
+				++injuredVikings;
+		}
+	}
+	for (const auto threat : threatsToKeep)
+	{
+		if (threat->unit_type == sc2::UNIT_TYPEID::PROTOSS_TEMPEST)
+		{
+			tempests.push_back(threat);
+			if (threat->health < threat->health_max || threat->shield < threat->shield_max)
+				++injuredTempests;
+		}
+	}
+
+	// If we can beat the enemy
+	const float simulationResult = Util::SimulateCombat(closeUnits, threatsToKeep, m_bot);
+	// Harassing units fight only if they win by far, unless units of other squads support them
+	const float minDesiredOutcome = m_order.getType() == SquadOrderTypes::Harass && !supportedByOtherSquads ? 0.75f : 0.f;
+	bool winSimulation = simulationResult > minDesiredOutcome;
+	bool shouldFight = winSimulation && unitsPower >= targetsPower;
+
+	if (!simulatedStimedUnits.empty())
+	{
+		sc2::Units units;
+		for (const auto closeUnit : closeUnits)
+		{
+			const auto it = simulatedStimedUnits.find(closeUnit);
+			units.push_back(it != simulatedStimedUnits.end() ? &it->second : closeUnit);
+		}
+		const float stimedSimulationResult = Util::SimulateCombat(closeUnits, units, threatsToKeep, m_bot);
+		if (stimedSimulationResult > simulationResult && (enemyHasLongRangeUnits || unitsPower + stimedUnitsPowerDifference >= targetsPower))
+		{
+			winSimulation = true;
+			shouldFight = true;
+			engagement.useStim = true;
+		}
+	}
+
+	if (!shouldFight)
+	{
+		if (!winSimulation && !vikings.empty() && !tempests.empty())
+		{
+			const auto otherEnemies = threatsToKeep.size() - tempests.size();
+			if (otherEnemies > 0)
+			{
+				if (m_bot.Config().AsyncCombatSimulation)
+					winSimulation = SimulateVikingsAgainstTempests(vikings, tempests);
+				else
+					winSimulation = Util::SimulateCombat(vikings, tempests, m_bot) > 0.f;
+			}
+			shouldFight = winSimulation;
+			std::stringstream ss;
+			ss << getSquad()->getName() << ": " << vikings.size() << " Vikings (" << injuredVikings << " injured) vs " << tempests.size() << " Tempests (" << injuredTempests << " injured): " << (winSimulation ? "win" : "LOSE");
+			Util::Log(__FUNCTION__, ss.str(), m_bot);
+			m_bot.Commander().Combat().SetLogVikingActions(true);
+		}
+		else if (enemyHasLongRangeUnits)
+		{
+			shouldFight = winSimulation;	// We consider only the simulation for long range enemies because our formula is shit
+		}
+	}
+
+	engagement.shouldFight = shouldFight;
 }
 
 void RangedManager::HarassLogicForUnit(const sc2::Unit* rangedUnit, sc2::Units &rangedUnits, sc2::Units &rangedUnitTargets, sc2::AvailableAbilities &rangedUnitAbilities, sc2::Units &otherSquadsUnits)
@@ -463,7 +808,20 @@ void RangedManager::HarassLogicForUnit(const sc2::Unit* rangedUnit, sc2::Units &
 			const auto maxInfluence = (cycloneShouldUseLockOn && target) ? CYCLONE_MAX_INFLUENCE_FOR_LOCKON : 0.f;
 			const CCPosition secondaryGoal = (!cycloneShouldUseLockOn && !shouldAttack && !ignoreInfluence) ? m_bot.GetStartLocation() : CCPosition();	// Only set for Cyclones with lock-on target (other than Tempest)
 			const float maxRange = target ? unitAttackRange : 3.f;
-			CCPosition closePositionInPath = Util::PathFinding::FindOptimalPathToTarget(rangedUnit, pathFindEndPos, secondaryGoal, target, maxRange, ignoreInfluence, maxInfluence, m_bot);
+			CCPosition closePositionInPath;
+			// Units of the squad moving toward the order goal share the same flow field instead of each running their own A*.
+			// Reapers need the A* to jump cliffs.
+			if (pathFindEndPos == goal && !ignoreInfluence && !isReaper && Util::DistSq(rangedUnit->pos, goal) > maxRange * maxRange)
+			{
+				const auto flowField = m_bot.Commander().Combat().getFlowFields().getFlowField(goal, rangedUnit->is_flying);
+				if (flowField)
+					closePositionInPath = flowField->getMovePosition(rangedUnit->pos, 2);
+			}
+			// Otherwise, repair the search state kept from the previous requests of the unit
+			if (closePositionInPath == CCPosition() && !ignoreInfluence && maxInfluence == 0.f && secondaryGoal == CCPosition() && !isReaper)
+				closePositionInPath = m_pathPlanners.at(rangedUnit).getMovePosition(rangedUnit, pathFindEndPos, maxRange);
+			if (closePositionInPath == CCPosition())
+				closePositionInPath = Util::PathFinding::FindOptimalPathToTarget(rangedUnit, pathFindEndPos, secondaryGoal, target, maxRange, ignoreInfluence, maxInfluence, m_bot);
 			if (closePositionInPath != CCPosition())
 			{
 				const int actionDuration = rangedUnit->unit_type == sc2::UNIT_TYPEID::TERRAN_REAPER ? REAPER_MOVE_FRAME_COUNT : 0;
@@ -636,7 +994,7 @@ bool RangedManager::MonitorCyclone(const sc2::Unit * cyclone, sc2::AvailableAbil
 		auto damagePerFrame = 400.f / 14.3f / 22.4f;
 		if(m_bot.Strategy().isUpgradeCompleted(sc2::UPGRADE_ID::CYCLONELOCKONDAMAGEUPGRADE))
 		{
-			const sc2::UnitTypeData unitTypeData = Util::GetUnitTypeDataFromUnitTypeId(lockOnTarget->first->unit_type, m_bot);
+			const sc2::UnitTypeData & unitTypeData = Util::GetUnitTypeDataFromUnitTypeId(lockOnTarget->first->unit_type, m_bot);
 			if (Util::Contains(sc2::Attribute::Armored, unitTypeData.attributes))
 				damagePerFrame *= 2;
 		}
@@ -1146,7 +1504,7 @@ const sc2::Unit * RangedManager::ExecuteLockOnLogic(const sc2::Unit * cyclone, b
 				auto armoredScore = 0.f;
 				if(m_bot.Strategy().isUpgradeCompleted(sc2::UPGRADE_ID::CYCLONELOCKONDAMAGEUPGRADE))
 				{
-					const sc2::UnitTypeData unitTypeData = Util::GetUnitTypeDataFromUnitTypeId(threat->unit_type, m_bot);
+					const sc2::UnitTypeData & unitTypeData = Util::GetUnitTypeDataFromUnitTypeId(threat->unit_type, m_bot);
 					armoredScore = 15 * Util::Contains(sc2::Attribute::Armored, unitTypeData.attributes);
 				}
 				const float nydusBonus = threat->unit_type == sc2::UNIT_TYPEID::ZERG_NYDUSCANAL && threat->build_progress < 1.f ? 10000.f : 0.f;
@@ -1210,11 +1568,11 @@ bool RangedManager::ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, boo
 
 	float unitsPower = 0.f;
 	float stimedUnitsPowerDifference = 0.f;
-	float targetsPower = 0.f;
 	bool morphFlyingVikings = false;
-	bool useStim = false;
+	const auto clusterIt = m_engagementClusterForUnit.find(rangedUnit);
+	const int engagementCluster = clusterIt != m_engagementClusterForUnit.end() ? clusterIt->second : -1;
 	std::map<const sc2::Unit *, sc2::Unit> simulatedStimedUnits;
-	std::map<const sc2::Unit*, const sc2::Unit*> closeUnitsTarget;
+	FrameMap<const sc2::Unit*, const sc2::Unit*> closeUnitsTarget;
 
 	// The harass mode deactivation is to not ignore ranged targets
 	const sc2::Unit* target = getTarget(rangedUnit, rangedUnitTargets, false);
@@ -1321,9 +1679,10 @@ bool RangedManager::ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, boo
 
 	m_bot.StartProfiling("0.10.4.1.5.1.5.1          CalcCloseUnits");
 	float minUnitRange = -1;
-	// We create a set because we need an ordered data structure for accurate and efficient comparison with data in memory
-	std::set<const sc2::Unit *> closeUnitsSet;
+	// The close units are the units whose actions this unit plans with the engagement of its cluster
+	FrameSet<const sc2::Unit *> closeUnitsSet;
 	sc2::Units allyCombatUnits;
+	allyCombatUnits.reserve(rangedUnits.size() + otherSquadsUnits.size());
 	allyCombatUnits.insert(allyCombatUnits.end(), rangedUnits.begin(), rangedUnits.end());
 	allyCombatUnits.insert(allyCombatUnits.end(), otherSquadsUnits.begin(), otherSquadsUnits.end());
 	CalcCloseUnits(rangedUnit, target, allyCombatUnits, rangedUnitTargets, true, closeUnitsSet, morphFlyingVikings, simulatedStimedUnits, stimedUnitsPowerDifference, closeUnitsTarget, unitsPower, minUnitRange);
@@ -1339,213 +1698,12 @@ bool RangedManager::ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, boo
 		return false;
 	}
 
-	// Check for saved result
-	for (const auto & combatSimulationResultPair : m_combatSimulationResults)
-	{
-		const auto & allyUnits = combatSimulationResultPair.first;
-		if (allyUnits == closeUnitsSet)
-		{
-			bool savedResult = combatSimulationResultPair.second;
-			if (savedResult)
-			{
-				auto action = m_bot.Commander().Combat().GetRangedUnitAction(rangedUnit);
-				std::stringstream ss;
-				ss << "ThreatFightingLogic was called again when all close units should have been given a prioritized action... Current unit of type " << sc2::UnitTypeToName(rangedUnit->unit_type) << " had a " << action.description << " action and is " << (Util::Contains(rangedUnit, allyUnits) ? "" : "not") << " part of the set";
-				Util::Log(__FUNCTION__, ss.str(), m_bot);
-			}
-			return savedResult;
-		}
-	}
-
-	sc2::Units closeUnits;
-	for (const auto closeUnit : closeUnitsSet)
-		closeUnits.push_back(closeUnit);
-
-	m_bot.StartProfiling("0.10.4.1.5.1.5.2          CalcThreats");
-	// Calculate all the threats of all the ally units participating in the fight
-	std::set<const sc2::Unit *> allThreatsSet;
-	for (const auto allyUnit : closeUnits)
-	{
-		const auto & allyUnitThreats = getThreats(allyUnit, rangedUnitTargets);
-		for (const auto threat : allyUnitThreats)
-			allThreatsSet.insert(threat);
-	}
-	// Add enemies that are close to the threats
-	for (const auto enemy : rangedUnitTargets)
-	{
-		if (Util::Contains(enemy, allThreatsSet))
-			continue;
-		bool closeToThreat = false;
-		for (const auto threat : allThreatsSet)
-		{
-			if (Util::DistSq(threat->pos, enemy->pos) <= 3.f * 3.f)
-			{
-				closeToThreat = true;
-				break;
-			}
-		}
-		if (!closeToThreat)
-			continue;
-		const auto enemyTarget = getTarget(enemy, allyCombatUnits, false);
-		if (!enemyTarget)
-			continue;
-		const auto threatRange = Util::getThreatRange(enemyTarget, enemy, m_bot) + 3.f;
-		if (Util::DistSq(enemy->pos, enemyTarget->pos) <= threatRange * threatRange)
-			allThreatsSet.insert(enemy);
-	}
-	sc2::Units allThreats;
-	for (const auto threat : allThreatsSet)
-	{
-		allThreats.push_back(threat);
-	}
-	m_bot.StopProfiling("0.10.4.1.5.1.5.2          CalcThreats");
-
-	m_bot.StartProfiling("0.10.4.1.5.1.5.3          CalcThreatsPower");
-	float maxThreatSpeed = 0.f;
-	float maxThreatRange = 0.f;
-	sc2::Units threatsToKeep;
-	// Calculate enemy power
-	for (auto threat : allThreats)
-	{
-		if(threat->unit_type == sc2::UNIT_TYPEID::TERRAN_KD8CHARGE)
-		{
-			continue;
-		}
-		const float threatSpeed = Util::getSpeedOfUnit(threat, m_bot);
-		if (threatSpeed > maxThreatSpeed)
-			maxThreatSpeed = threatSpeed;
-		const sc2::Unit* threatTarget = getTarget(threat, closeUnits, false);
-		const float threatRange = Util::GetAttackRangeForTarget(threat, threatTarget, m_bot);
-		const float threatDistance = threatTarget ? Util::Dist(threat->pos, threatTarget->pos) : 0.f;
-		// If the building threat is too far from its target to attack it (with a very small buffer)
-		if (Unit(threat, m_bot).getType().isBuilding() && threatTarget && threatDistance > threatRange + 0.01f)
-		{
-			bool unitWillGetCloseEnough = false;
-			// Simulate the future position of our units to check if they would be in range of the building
-			for (const auto unitTargetPair : closeUnitsTarget)
-			{
-				const auto unit = unitTargetPair.first;
-				const auto unitTarget = unitTargetPair.second;
-				if (Util::IsEnemyHiddenOnHighGround(unit, unitTarget, m_bot))
-				{
-					unitWillGetCloseEnough = true;
-					break;
-				}
-				const float unitRange = Util::GetAttackRangeForTarget(unit, unitTarget, m_bot);
-				const CCPosition futurePosition = unitTarget->pos + Util::Normalized(unit->pos - unitTarget->pos) * unitRange;
-				if (Util::Dist(threat->pos, futurePosition) <= threatRange)
-				{
-					unitWillGetCloseEnough = true;
-					break;
-				}
-			}
-			if (!unitWillGetCloseEnough)
-				continue;
-		}
-		if (threatRange > maxThreatRange)
-			maxThreatRange = threatRange;
-		targetsPower += Util::GetUnitPower(threat, threatTarget, m_bot);
-		threatsToKeep.push_back(threat);
-	}
-	m_bot.StopProfiling("0.10.4.1.5.1.5.3          CalcThreatsPower");
-
-	// If our units have 2 more range, they should kite, not trade
-	if (minUnitRange - maxThreatRange >= 2.f)
-	{
-		m_combatSimulationResults[closeUnitsSet] = false;
+	// The engagement of the cluster was simulated before the logic of the units
+	if (engagementCluster < 0)
+		return false;
+	const auto & engagement = m_engagementResults[engagementCluster];
+	if (engagement.shouldKite)
 		return false;
-	}
-
-	const bool enemyHasLongRangeUnits = maxThreatRange >= 10;
-
-	sc2::Units vikings;
-	sc2::Units tempests;
-	int injuredVikings = 0;
-	int injuredTempests = 0;
-	for (const auto ally : closeUnits)
-	{
-		if (ally->unit_type == sc2::UNIT_TYPEID::TERRAN_VIKINGFIGHTER)
-		{
-			vikings.push_back(ally);
-			if (ally->health < ally->health_max)
-				++injuredVikings;
-		}
-	}
-	for (const auto threat : threatsToKeep)
-	{
-		if (threat->unit_type == sc2::UNIT_TYPEID::PROTOSS_TEMPEST)
-		{
-			tempests.push_back(threat);
-			if (threat->health < threat->health_max || threat->shield < threat->shield_max)
-				++injuredTempests;
-		}
-	}
-
-	// If we can beat the enemy
-	m_bot.StartProfiling("0.10.4.1.5.1.5.4          SimulateCombat");
-	float simulationResult = Util::SimulateCombat(closeUnits, threatsToKeep, m_bot);
-	float minDesiredOutcome = 0.f;
-	if (m_order.getType() == SquadOrderTypes::Harass)
-	{
-		minDesiredOutcome = 0.75f;
-		for (const auto closeUnit : closeUnits)
-		{
-			if (Util::Contains(closeUnit, otherSquadsUnits))
-			{
-				minDesiredOutcome = 0.f;
-				break;
-			}
-		}
-	}
-	bool winSimulation = simulationResult > minDesiredOutcome;
-	bool formulaWin = unitsPower >= targetsPower;
-	bool shouldFight = winSimulation && formulaWin;
-
-	if (!simulatedStimedUnits.empty())
-	{
-		sc2::Units units;
-		for (const auto closeUnit : closeUnitsSet)
-		{
-			const auto it = simulatedStimedUnits.find(closeUnit);
-			if (it != simulatedStimedUnits.end())
-				units.push_back(&it->second);
-			else
-				units.push_back(closeUnit);
-		}
-		const float stimedSimulationResult = Util::SimulateCombat(closeUnits, units, threatsToKeep, m_bot);
-		if (stimedSimulationResult > simulationResult && (enemyHasLongRangeUnits || unitsPower + stimedUnitsPowerDifference >= targetsPower))
-		{
-			winSimulation = true;
-			formulaWin = true;
-			shouldFight = true;
-			useStim = true;
-		}
-	}
-
-	if (!shouldFight)
-	{
-		if (!winSimulation && !vikings.empty() && !tempests.empty())
-		{
-			const auto otherEnemies = threatsToKeep.size() - tempests.size();
-			if (otherEnemies > 0)
-			{
-				winSimulation = Util::SimulateCombat(vikings, tempests, m_bot) > 0.f;
-			}
-			shouldFight = winSimulation;
-			std::stringstream ss;
-			ss << getSquad()->getName() << ": " << vikings.size() << " Vikings (" << injuredVikings << " injured) vs " << tempests.size() << " Tempests (" << injuredTempests << " injured): " << (winSimulation ? "win" : "LOSE");
-			Util::Log(__FUNCTION__, ss.str(), m_bot);
-			m_bot.Commander().Combat().SetLogVikingActions(true);
-		}
-		else if (enemyHasLongRangeUnits)
-		{
-			shouldFight = winSimulation;	// We consider only the simulation for long range enemies because our formula is shit
-		}
-	}
-	m_bot.StopProfiling("0.10.4.1.5.1.5.4          SimulateCombat");
-
-	// Save result
-	m_combatSimulationResults[closeUnitsSet] = shouldFight;
 
 	// For each of our close units
 	for (auto & unitAndTarget : closeUnitsTarget)
@@ -1553,7 +1711,11 @@ bool RangedManager::ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, boo
 		const auto unit = unitAndTarget.first;
 		const auto unitTarget = unitAndTarget.second;
 
-		if (shouldFight && unit->unit_type == sc2::UNIT_TYPEID::TERRAN_BANSHEE && ExecuteBansheeCloakLogic(unit, false))
+		// When the fight is lost, each unit of the cluster only checks if it can still attack
+		if (!engagement.shouldFight && unit != rangedUnit)
+			continue;
+
+		if (engagement.shouldFight && unit->unit_type == sc2::UNIT_TYPEID::TERRAN_BANSHEE && ExecuteBansheeCloakLogic(unit, false))
 		{
 			continue;
 		}
@@ -1569,7 +1731,7 @@ bool RangedManager::ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, boo
 		}
 
 		// Even if the fight would be lost, should still attack if it can, but only if it is slower than the fastest enemy and its target is not on high ground
-		if (!shouldFight && (!canAttackNow || Util::getSpeedOfUnit(unit, m_bot) > maxThreatSpeed || Util::IsEnemyHiddenOnHighGround(unit, unitTarget, m_bot)))
+		if (!engagement.shouldFight && (!canAttackNow || Util::getSpeedOfUnit(unit, m_bot) > engagement.maxThreatSpeed || Util::IsEnemyHiddenOnHighGround(unit, unitTarget, m_bot)))
 		{
 			continue;
 		}
@@ -1591,7 +1753,7 @@ bool RangedManager::ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, boo
 			}
 		}
 
-		if (shouldFight)
+		if (engagement.shouldFight)
 		{
 			// Morph the Viking
 			if (morphFlyingVikings && unit->unit_type == sc2::UNIT_TYPEID::TERRAN_VIKINGASSAULT)
@@ -1613,7 +1775,7 @@ bool RangedManager::ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, boo
 			}
 
 			// Stim the Marine or Marauder
-			if (useStim && ExecuteStimLogic(unit))
+			if (engagement.useStim && ExecuteStimLogic(unit))
 				continue;
 		}
 
@@ -1668,7 +1830,7 @@ bool RangedManager::ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, boo
 			m_bot.Analyzer().increaseTotalDamage(damageDealt, unit->unit_type);
 		}
 	}
-	return shouldFight;
+	return engagement.shouldFight;
 }
 
 /*
@@ -1676,12 +1838,12 @@ bool RangedManager::ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, boo
  * The result is stored in the closeUnitsSet.
  * We use a set because we need an ordered data structure for accurate and efficient comparison with data in memory.
  */
-void RangedManager::CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit * target, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, std::set<const sc2::Unit *> & closeUnitsSet)
+void RangedManager::CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit * target, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, FrameSet<const sc2::Unit *> & closeUnitsSet)
 {
 	bool morphFlyingVikings;
 	std::map<const sc2::Unit *, sc2::Unit> simulatedStimedUnits;
 	float stimedUnitsPowerDifference;
-	std::map<const sc2::Unit*, const sc2::Unit*> closeUnitsTarget;
+	FrameMap<const sc2::Unit*, const sc2::Unit*> closeUnitsTarget;
 	float unitsPower;
 	float minUnitRange;
 	const bool ignoreCyclones = false;
@@ -1692,7 +1854,7 @@ void RangedManager::CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit
  * The result is stored in the closeUnitsSet.
  * We use a set because we need an ordered data structure for accurate and efficient comparison with data in memory.
  */
-void RangedManager::CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit * target, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, bool ignoreCyclones, std::set<const sc2::Unit *> & closeUnitsSet, bool & morphFlyingVikings, std::map<const sc2::Unit *, sc2::Unit> & simulatedStimedUnits, float & stimedUnitsPowerDifference, std::map<const sc2::Unit*, const sc2::Unit*> & closeUnitsTarget, float & unitsPower, float & minUnitRange)
+void RangedManager::CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit * target, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, bool ignoreCyclones, FrameSet<const sc2::Unit *> & closeUnitsSet, bool & morphFlyingVikings, std::map<const sc2::Unit *, sc2::Unit> & simulatedStimedUnits, float & stimedUnitsPowerDifference, FrameMap<const sc2::Unit*, const sc2::Unit*> & closeUnitsTarget, float & unitsPower, float & minUnitRange)
 {
 	sc2::Units farAllyUnits;
 	// Calculate ally power
@@ -1756,31 +1918,10 @@ void RangedManager::CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit
 				continue;
 			}
 
-			const sc2::Unit* unitTarget = unit->unit_type == sc2::UNIT_TYPEID::TERRAN_MEDIVAC ? GetHealTarget(unit, allyCombatUnits, false) : getTarget(unit, rangedUnitTargets, false);
-			const sc2::Unit* unitToSave = unit;
-
-			const auto & cycloneFlyingHelpers = m_bot.Commander().Combat().getCycloneFlyingHelpers();
-			// If the flying Viking doesn't have a target, we check if it would have one as a landed Viking (unless it is a flying helper)
-			if (!unitTarget && !m_bot.Analyzer().enemyHasCombatAirUnit() && unit->unit_type == sc2::UNIT_TYPEID::TERRAN_VIKINGFIGHTER && cycloneFlyingHelpers.find(unit) == cycloneFlyingHelpers.end())
-			{
-				const sc2::Unit* vikingAssault = nullptr;
-				auto it = m_dummyAssaultVikings.find(unit->tag);
-				if (it != m_dummyAssaultVikings.end())
-				{
-					vikingAssault = &it->second;
-				}
-				else
-				{
-					m_dummyAssaultVikings[unit->tag] = Util::CreateDummyVikingAssaultFromUnit(unit);
-					vikingAssault = &m_dummyAssaultVikings[unit->tag];
-				}
-				unitTarget = getTarget(vikingAssault, rangedUnitTargets, false);
-				if (unitTarget)
-				{
-					unitToSave = vikingAssault;
-					morphFlyingVikings = true;
-				}
-			}
+			const sc2::Unit* unitTarget = nullptr;
+			const sc2::Unit* unitToSave = GetSimulatedUnit(unit, allyCombatUnits, rangedUnitTargets, unitTarget);
+			if (unitToSave && unitToSave != unit)
+				morphFlyingVikings = true;
 
 			// If the unit has a target, add it to the close units and calculate its power
 			if (unitTarget)
@@ -1803,6 +1944,36 @@ void RangedManager::CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit
 	}
 }
 
+/*
+ * Returns the unit to simulate for the given unit, with its target.
+ * A flying Viking without target is replaced by a landed dummy if the dummy would have one (unless it is a flying helper).
+ * Returns nullptr when the unit has no target.
+ */
+const sc2::Unit * RangedManager::GetSimulatedUnit(const sc2::Unit * unit, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, const sc2::Unit * & unitTarget)
+{
+	unitTarget = unit->unit_type == sc2::UNIT_TYPEID::TERRAN_MEDIVAC ? GetHealTarget(unit, allyCombatUnits, false) : getTarget(unit, rangedUnitTargets, false);
+	if (unitTarget)
+		return unit;
+
+	const auto & cycloneFlyingHelpers = m_bot.Commander().Combat().getCycloneFlyingHelpers();
+	if (m_bot.Analyzer().enemyHasCombatAirUnit() || unit->unit_type != sc2::UNIT_TYPEID::TERRAN_VIKINGFIGHTER || cycloneFlyingHelpers.find(unit) != cycloneFlyingHelpers.end())
+		return nullptr;
+
+	const sc2::Unit* vikingAssault = nullptr;
+	auto it = m_dummyAssaultVikings.find(unit->tag);
+	if (it != m_dummyAssaultVikings.end())
+	{
+		vikingAssault = &it->second;
+	}
+	else
+	{
+		m_dummyAssaultVikings[unit->tag] = Util::CreateDummyVikingAssaultFromUnit(unit);
+		vikingAssault = &m_dummyAssaultVikings[unit->tag];
+	}
+	unitTarget = getTarget(vikingAssault, rangedUnitTargets, false);
+	return unitTarget ? vikingAssault : nullptr;
+}
+
 void RangedManager::ExecuteCycloneLogic(const sc2::Unit * cyclone, bool isUnitDisabled, bool & unitShouldHeal, bool & shouldAttack, bool & cycloneShouldUseLockOn, bool & cycloneShouldStayCloseToTarget, const sc2::Units & rangedUnits, const sc2::Units & threats, const sc2::Unit * & target, CCPosition & goal, sc2::AvailableAbilities & abilities)
 {
 	bool lockOnAvailable;
@@ -2160,13 +2331,7 @@ bool RangedManager::CanUseStim(const sc2::Unit * unit) const
 
 bool RangedManager::QueryIsAbilityAvailable(const sc2::Unit* unit, sc2::ABILITY_ID abilityId) const
 {
-	const auto & availableAbilities = m_bot.Query()->GetAbilitiesForUnit(unit);
-	for (const auto & ability : availableAbilities.abilities)
-	{
-		if (ability.ability_id.ToType() == abilityId)
-			return true;
-	}
-	return false;
+	return m_bot.Abilities().isAbilityAvailable(unit, abilityId);
 }
 
 bool RangedManager::CanUseKD8Charge(const sc2::Unit * reaper)
@@ -2527,7 +2692,10 @@ sc2::Units & RangedManager::getThreats(const sc2::Unit * rangedUnit, const sc2::
 	if (it != m_threatsForUnit.end())
 		return it->second;
 	sc2::Units threats;
-	Util::getThreats(rangedUnit, targets, threats, m_bot);
+	if (m_threatIndex.canGetThreats(rangedUnit, targets))
+		m_threatIndex.getThreats(rangedUnit, threats);
+	else
+		Util::getThreats(rangedUnit, targets, threats, m_bot);
 	m_threatsForUnit[rangedUnit] = threats;
 	return m_threatsForUnit[rangedUnit];
 }
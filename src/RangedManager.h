@@ -2,6 +2,9 @@
 
 #include "Common.h"
 #include "MicroManager.h"
+#include "IncrementalPathPlanner.h"
+#include "ThreatCoverageIndex.h"
+#include <future>
 
 class CCBot;
 
@@ -11,6 +14,14 @@ enum FlyingHelperGoal
 	TRACK
 };
 
+struct EngagementResult
+{
+	bool shouldFight = false;
+	bool shouldKite = false;	// our units outrange the threats, they should kite instead of trading
+	bool useStim = false;
+	float maxThreatSpeed = 0.f;
+};
+
 struct FlyingHelperMission
 {
 	FlyingHelperMission() : goal(ESCORT), position(CCPosition()) {}
@@ -27,7 +38,7 @@ public:
     void setTargets(const std::vector<Unit> & targets) override;
     void executeMicro() override;
 	bool isTargetRanged(const sc2::Unit * target);
-	void CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit * target, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, std::set<const sc2::Unit *> & closeUnitsSet);
+	void CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit * target, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, FrameSet<const sc2::Unit *> & closeUnitsSet);
 	const sc2::Unit * getTarget(const sc2::Unit * rangedUnit, const std::vector<const sc2::Unit *> & targets, bool harass = true, bool filterHigherUnits = false, bool considerOnlyUnitsInRange = false, bool filterPassiveBuildings = true);
 
 private:
@@ -40,17 +51,28 @@ private:
 		sc2::UNIT_TYPEID::TERRAN_HELLIONTANK
 	};
 	std::map<const sc2::Unit *, uint32_t> nextPathFindingFrameForUnit;
-	std::map<std::set<const sc2::Unit *>, bool> m_combatSimulationResults;
+	std::map<const sc2::Unit *, IncrementalPathPlanner> m_pathPlanners;
+	std::map<const sc2::Unit *, int> m_engagementClusterForUnit;	// index of the interaction cluster of each ally unit in the fight
+	std::vector<EngagementResult> m_engagementResults;	// indexed by cluster, simulated once per frame before the logic of the units
 	std::map<sc2::Tag, sc2::Unit> m_dummyAssaultVikings;
 	std::map<const sc2::Unit *, sc2::Units> m_threatsForUnit;
+	ThreatCoverageIndex m_threatIndex;	// built each frame with the rangedUnitTargets of HarassLogic
 	std::map<const sc2::Unit *, std::map<std::set<const sc2::Unit *>, const sc2::Unit *>> m_threatTargetForUnit;	//<unit, <potential targets, target>>
 	bool m_flyingBarracksShouldReachEnemyRamp = true;
 	bool m_marauderAttackInitiated = false;
+	std::shared_future<float> m_pendingVikingsSimulation;
+	bool m_vikingsWinAgainstTempests = false;
+	uint32_t m_pendingVikingsSimulationFrame = 0;
+	uint32_t m_vikingsSimulationFrame = 0;	// frame of the request m_vikingsWinAgainstTempests comes from
 
 	bool isAbilityAvailable(sc2::ABILITY_ID abilityId, const sc2::Unit * rangedUnit) const;
 	void setNextFrameAbilityAvailable(sc2::ABILITY_ID abilityId, const sc2::Unit * rangedUnit, uint32_t nextAvailableFrame);
 	int getAttackDuration(const sc2::Unit* unit, const sc2::Unit* target) const;
 	void HarassLogic(sc2::Units &rangedUnits, sc2::Units &rangedUnitTargets, sc2::Units &otherSquadsUnits);
+	void CalcEngagementClusters(const sc2::Units & allyUnits, const sc2::Units & enemyUnits, std::vector<sc2::Units> & clusters);
+	void SimulateEngagement(const sc2::Units & clusterUnits, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, sc2::Units & otherSquadsUnits, EngagementResult & engagement);
+	bool SimulateVikingsAgainstTempests(const sc2::Units & vikings, const sc2::Units & tempests);
+	const sc2::Unit * GetSimulatedUnit(const sc2::Unit * unit, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, const sc2::Unit * & unitTarget);
 	void HarassLogicForUnit(const sc2::Unit* rangedUnit, sc2::Units &rangedUnits, sc2::Units &rangedUnitTargets, sc2::AvailableAbilities &rangedUnitAbilities, sc2::Units &otherSquadsUnits);
 	bool MonitorCyclone(const sc2::Unit * cyclone, sc2::AvailableAbilities & abilities);
 	bool IsCycloneLockOnCanceled(const sc2::Unit * cyclone, bool started, const sc2::AvailableAbilities & abilities) const;
@@ -71,7 +93,7 @@ private:
 	void LockOnTarget(const sc2::Unit * cyclone, const sc2::Unit * target);
 	bool CycloneHasTarget(const sc2::Unit * cyclone) const;
 	bool ExecuteThreatFightingLogic(const sc2::Unit * rangedUnit, bool unitShouldHeal, sc2::Units & rangedUnits, sc2::Units & rangedUnitTargets, sc2::Units & otherSquadsUnits);
-	void CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit * target, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, bool ignoreCyclones, std::set<const sc2::Unit *> & closeUnitsSet, bool & morphFlyingVikings, std::map<const sc2::Unit *, sc2::Unit> & simulatedStimedUnits, float & stimedUnitsPowerDifference, std::map<const sc2::Unit*, const sc2::Unit*> & closeUnitsTarget, float & unitsPower, float & minUnitRange);
+	void CalcCloseUnits(const sc2::Unit * rangedUnit, const sc2::Unit * target, sc2::Units & allyCombatUnits, sc2::Units & rangedUnitTargets, bool ignoreCyclones, FrameSet<const sc2::Unit *> & closeUnitsSet, bool & morphFlyingVikings, std::map<const sc2::Unit *, sc2::Unit> & simulatedStimedUnits, float & stimedUnitsPowerDifference, FrameMap<const sc2::Unit*, const sc2::Unit*> & closeUnitsTarget, float & unitsPower, float & minUnitRange);
 	void ExecuteCycloneLogic(const sc2::Unit * cyclone, bool isUnitDisabled, bool & unitShouldHeal, bool & shouldAttack, bool & cycloneShouldUseLockOn, bool & cycloneShouldStayCloseToTarget, const sc2::Units & rangedUnits, const sc2::Units & threats, const sc2::Unit * & target, CCPosition & goal, sc2::AvailableAbilities & abilities);
 	bool ExecutePrioritizedUnitAbilitiesLogic(const sc2::Unit * rangedUnit, sc2::Units & threats, sc2::Units & targets, CCPosition goal, bool unitShouldHeal, bool isCycloneHelper);
 	bool ExecuteUnitAbilitiesLogic(const sc2::Unit * rangedUnit, const sc2::Unit * target, sc2::Units & threats, sc2::Units & targets, sc2::Units & allyUnits, CCPosition goal, bool unitShouldHeal, bool isCycloneHelper, sc2::AvailableAbilities & abilities);
@@ -0,0 +1,564 @@
+#include "RegionManager.h"
+#include "CCBot.h"
+#include "Util.h"
+#include <limits>
+#include <sstream>
+
+namespace
+{
+	const int FourNeighborX[] = { 1, -1, 0, 0 };
+	const int FourNeighborY[] = { 0, 0, 1, -1 };
+
+	// Largest distance between two of the tiles, plus one
+	float GetTileSpan(const std::vector<CCTilePosition> & tiles)
+	{
+		float maxDistance = 0.f;
+		for (size_t i = 0; i < tiles.size(); ++i)
+		{
+			for (size_t j = i + 1; j < tiles.size(); ++j)
+			{
+				maxDistance = std::max(maxDistance, Util::Dist(tiles[i], tiles[j]));
+			}
+		}
+		return maxDistance + 1.f;
+	}
+}
+
+RegionManager::RegionManager(CCBot & bot)
+	: m_bot(bot)
+{
+}
+
+void RegionManager::onStart()
+{
+	const auto & grid = m_bot.Map().getGrid();
+	const int width = grid.width();
+	const int height = grid.height();
+	m_regions.clear();
+	m_chokes.clear();
+	m_tileRegions = GridPlane<int>(width, height, -1);
+	m_tileChokes = GridPlane<int>(width, height, -1);
+
+	// The walkable tiles that cannot be built on are grouped, the groups joining two terrain levels are the ramps
+	TileBitmask rampTiles(width, height);
+	TileBitmask visited(width, height);
+	std::vector<std::vector<CCTilePosition>> ramps;
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			if (visited.get(x, y) || !grid.isWalkable(x, y) || grid.isBuildable(x, y))
+				continue;
+
+			std::vector<CCTilePosition> tiles = { CCTilePosition(x, y) };
+			visited.set(x, y);
+			float minHeight = std::numeric_limits<float>::max();
+			float maxHeight = std::numeric_limits<float>::lowest();
+			for (size_t i = 0; i < tiles.size(); ++i)
+			{
+				const auto tile = tiles[i];
+				for (int dy = -1; dy <= 1; ++dy)
+				{
+					for (int dx = -1; dx <= 1; ++dx)
+					{
+						const int nx = tile.x + dx;
+						const int ny = tile.y + dy;
+						if (!grid.isInside(nx, ny) || !grid.isWalkable(nx, ny))
+							continue;
+						if (grid.isBuildable(nx, ny))
+						{
+							// Only the sides touch the terrain levels, the corners can touch a cliff
+							if (dx == 0 || dy == 0)
+							{
+								minHeight = std::min(minHeight, grid.getTerrainHeight(nx, ny));
+								maxHeight = std::max(maxHeight, grid.getTerrainHeight(nx, ny));
+							}
+						}
+						else if (!visited.get(nx, ny))
+						{
+							visited.set(nx, ny);
+							tiles.push_back(CCTilePosition(nx, ny));
+						}
+					}
+				}
+			}
+
+			if (int(tiles.size()) <= RampMaxTileCount && maxHeight - minHeight >= RampMinHeightDelta)
+			{
+				for (const auto & tile : tiles)
+					rampTiles.set(tile.x, tile.y);
+				ramps.push_back(std::move(tiles));
+			}
+		}
+	}
+
+	GridPlane<int> clearance(width, height, 0);
+	computeClearance(rampTiles, clearance);
+	computeRegions(clearance);
+
+	// The ramps become chokes between the two regions they touch the most, a ramp touching a single region is part of it
+	for (auto & ramp : ramps)
+	{
+		std::map<int, int> regionContacts;
+		for (const auto & tile : ramp)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				const int nx = tile.x + FourNeighborX[i];
+				const int ny = tile.y + FourNeighborY[i];
+				if (m_tileRegions.isInside(nx, ny) && m_tileRegions(nx, ny) >= 0)
+					++regionContacts[m_tileRegions(nx, ny)];
+			}
+		}
+		if (regionContacts.size() == 1)
+		{
+			const int region = regionContacts.begin()->first;
+			for (const auto & tile : ramp)
+				m_tileRegions(tile.x, tile.y) = region;
+			m_regions[region].tileCount += int(ramp.size());
+		}
+		else if (regionContacts.size() >= 2)
+		{
+			std::vector<std::pair<int, int>> contacts;	// <contact count, region>
+			for (const auto & regionContact : regionContacts)
+				contacts.push_back(std::make_pair(regionContact.second, regionContact.first));
+			std::sort(contacts.rbegin(), contacts.rend());
+			addChoke(contacts[0].second, contacts[1].second, true, std::move(ramp));
+		}
+	}
+
+	annotateRegions(clearance);
+}
+
+// Tile distance of each region tile to the closest tile that is unwalkable or part of a ramp, 0 for those
+void RegionManager::computeClearance(const TileBitmask & rampTiles, GridPlane<int> & clearance) const
+{
+	const auto & grid = m_bot.Map().getGrid();
+	std::vector<CCTilePosition> queue;
+	for (int y = 0; y < clearance.height(); ++y)
+	{
+		for (int x = 0; x < clearance.width(); ++x)
+		{
+			if (grid.isWalkable(x, y) && !rampTiles.get(x, y))
+			{
+				clearance(x, y) = -1;
+			}
+			else
+			{
+				clearance(x, y) = 0;
+				queue.push_back(CCTilePosition(x, y));
+			}
+		}
+	}
+
+	for (size_t i = 0; i < queue.size(); ++i)
+	{
+		const auto tile = queue[i];
+		for (int dy = -1; dy <= 1; ++dy)
+		{
+			for (int dx = -1; dx <= 1; ++dx)
+			{
+				const int nx = tile.x + dx;
+				const int ny = tile.y + dy;
+				if (clearance.isInside(nx, ny) && clearance(nx, ny) < 0)
+				{
+					clearance(nx, ny) = clearance(tile.x, tile.y) + 1;
+					queue.push_back(CCTilePosition(nx, ny));
+				}
+			}
+		}
+	}
+}
+
+// Watershed on the clearance: the tiles are flooded from the most open ones, a tile joins the deepest basin among its flooded neighbors.
+// When two deep basins meet at a tile with a much lower clearance than theirs, the tile is on the frontier of two regions, otherwise the basins merge.
+void RegionManager::computeRegions(const GridPlane<int> & clearance)
+{
+	struct FrontierTile
+	{
+		CCTilePosition tile;
+		int firstBasin;
+		int secondBasin;
+	};
+
+	std::vector<std::vector<CCTilePosition>> levels;
+	for (int y = 0; y < clearance.height(); ++y)
+	{
+		for (int x = 0; x < clearance.width(); ++x)
+		{
+			const int level = clearance(x, y);
+			if (level <= 0)
+				continue;
+			if (level >= int(levels.size()))
+				levels.resize(level + 1);
+			levels[level].push_back(CCTilePosition(x, y));
+		}
+	}
+
+	GridPlane<int> basins(clearance.width(), clearance.height(), -1);
+	std::vector<int> parents;
+	std::vector<int> basinClearances;
+	std::vector<FrontierTile> frontierTiles;
+	const auto findBasin = [&parents](int basin)
+	{
+		while (parents[basin] != basin)
+			basin = parents[basin] = parents[parents[basin]];
+		return basin;
+	};
+
+	for (int level = int(levels.size()) - 1; level > 0; --level)
+	{
+		for (const auto & tile : levels[level])
+		{
+			int neighborBasins[4];
+			int neighborBasinCount = 0;
+			int deepestBasin = -1;
+			for (int i = 0; i < 4; ++i)
+			{
+				const int nx = tile.x + FourNeighborX[i];
+				const int ny = tile.y + FourNeighborY[i];
+				if (!basins.isInside(nx, ny) || basins(nx, ny) < 0)
+					continue;
+				const int basin = findBasin(basins(nx, ny));
+				if (std::find(neighborBasins, neighborBasins + neighborBasinCount, basin) != neighborBasins + neighborBasinCount)
+					continue;
+				neighborBasins[neighborBasinCount++] = basin;
+				if (deepestBasin < 0 || basinClearances[basin] > basinClearances[deepestBasin])
+					deepestBasin = basin;
+			}
+
+			if (deepestBasin < 0)
+			{
+				basins(tile.x, tile.y) = int(parents.size());
+				parents.push_back(int(parents.size()));
+				basinClearances.push_back(level);
+				continue;
+			}
+
+			basins(tile.x, tile.y) = deepestBasin;
+			for (int i = 0; i < neighborBasinCount; ++i)
+			{
+				const int basin = neighborBasins[i];
+				if (basin == deepestBasin)
+					continue;
+				const int shallowClearance = basinClearances[basin];
+				if (shallowClearance >= RegionMinClearance && level <= shallowClearance * ChokeMaxClearanceRatio)
+					frontierTiles.push_back({ tile, deepestBasin, basin });
+				else
+					parents[basin] = deepestBasin;
+			}
+		}
+	}
+
+	std::vector<int> basinRegions(parents.size(), -1);
+	for (int y = 0; y < basins.height(); ++y)
+	{
+		for (int x = 0; x < basins.width(); ++x)
+		{
+			if (basins(x, y) < 0)
+				continue;
+			const int basin = findBasin(basins(x, y));
+			if (basinRegions[basin] < 0)
+			{
+				basinRegions[basin] = int(m_regions.size());
+				MapRegion region;
+				region.id = int(m_regions.size());
+				region.tileCount = 0;
+				region.height = 0.f;
+				region.maxClearance = 0;
+				region.base = nullptr;
+				m_regions.push_back(region);
+			}
+			m_tileRegions(x, y) = basinRegions[basin];
+			++m_regions[basinRegions[basin]].tileCount;
+		}
+	}
+
+	// The frontier tiles of each pair of regions are split in groups of touching tiles, one choke per group
+	std::map<std::pair<int, int>, std::vector<CCTilePosition>> regionPairFrontiers;
+	for (const auto & frontierTile : frontierTiles)
+	{
+		const int firstRegion = basinRegions[findBasin(frontierTile.firstBasin)];
+		const int secondRegion = basinRegions[findBasin(frontierTile.secondBasin)];
+		if (firstRegion != secondRegion)
+			regionPairFrontiers[std::make_pair(std::min(firstRegion, secondRegion), std::max(firstRegion, secondRegion))].push_back(frontierTile.tile);
+	}
+	// The tiles of the current pair are marked with their index so the neighbors of a tile are found without going through all of them
+	GridPlane<int> frontierIndices(basins.width(), basins.height(), -1);
+	for (const auto & regionPairFrontier : regionPairFrontiers)
+	{
+		const auto & tiles = regionPairFrontier.second;
+		std::vector<bool> grouped(tiles.size(), false);
+		for (size_t i = 0; i < tiles.size(); ++i)
+		{
+			// The same tile can be between two basins that ended in the same regions
+			if (frontierIndices(tiles[i].x, tiles[i].y) >= 0)
+				grouped[i] = true;
+			else
+				frontierIndices(tiles[i].x, tiles[i].y) = int(i);
+		}
+		for (size_t i = 0; i < tiles.size(); ++i)
+		{
+			if (grouped[i])
+				continue;
+			grouped[i] = true;
+			std::vector<CCTilePosition> group = { tiles[i] };
+			for (size_t j = 0; j < group.size(); ++j)
+			{
+				for (int dy = -1; dy <= 1; ++dy)
+				{
+					for (int dx = -1; dx <= 1; ++dx)
+					{
+						const int nx = group[j].x + dx;
+						const int ny = group[j].y + dy;
+						if (!frontierIndices.isInside(nx, ny))
+							continue;
+						const int k = frontierIndices(nx, ny);
+						if (k >= 0 && !grouped[k])
+						{
+							grouped[k] = true;
+							group.push_back(tiles[k]);
+						}
+					}
+				}
+			}
+			addChoke(regionPairFrontier.first.first, regionPairFrontier.first.second, false, std::move(group));
+		}
+		for (const auto & tile : tiles)
+			frontierIndices(tile.x, tile.y) = -1;
+	}
+}
+
+void RegionManager::addChoke(int firstRegion, int secondRegion, bool isRamp, std::vector<CCTilePosition> && tiles)
+{
+	MapChoke choke;
+	choke.id = int(m_chokes.size());
+	choke.firstRegion = firstRegion;
+	choke.secondRegion = secondRegion;
+	choke.isRamp = isRamp;
+	choke.tiles = std::move(tiles);
+	choke.width = 0.f;
+	choke.heightDelta = 0.f;
+	for (const auto & tile : choke.tiles)
+		m_tileChokes(tile.x, tile.y) = choke.id;
+	m_regions[firstRegion].chokes.push_back(choke.id);
+	m_regions[secondRegion].chokes.push_back(choke.id);
+	m_chokes.push_back(std::move(choke));
+}
+
+void RegionManager::annotateRegions(const GridPlane<int> & clearance)
+{
+	const auto & grid = m_bot.Map().getGrid();
+	for (int y = 0; y < m_tileRegions.height(); ++y)
+	{
+		for (int x = 0; x < m_tileRegions.width(); ++x)
+		{
+			if (m_tileRegions(x, y) < 0)
+				continue;
+			auto & region = m_regions[m_tileRegions(x, y)];
+			region.center += CCPosition(x + 0.5f, y + 0.5f);
+			region.height += grid.getTerrainHeight(x, y);
+			region.maxClearance = std::max(region.maxClearance, clearance(x, y));
+		}
+	}
+	for (auto & region : m_regions)
+	{
+		region.center /= float(region.tileCount);
+		region.height /= region.tileCount;
+	}
+
+	for (const auto baseLocation : m_bot.Bases().getBaseLocations())
+	{
+		const int regionId = getNearbyRegionId(baseLocation->getDepotTilePosition());
+		if (regionId >= 0 && !m_regions[regionId].base)
+			m_regions[regionId].base = baseLocation;
+	}
+
+	for (auto & choke : m_chokes)
+		annotateChoke(choke);
+}
+
+// The side of a choke is made of its tiles touching one of its regions, the width of a ramp is the span of its higher side
+void RegionManager::annotateChoke(MapChoke & choke) const
+{
+	const auto & grid = m_bot.Map().getGrid();
+	const int sideRegions[] = { choke.firstRegion, choke.secondRegion };
+	std::vector<CCTilePosition> sideTiles[2];
+	float sideHeights[2] = { 0.f, 0.f };
+	int sideHeightCounts[2] = { 0, 0 };
+	for (const auto & tile : choke.tiles)
+	{
+		bool touchesSide[2] = { false, false };
+		for (int i = 0; i < 4; ++i)
+		{
+			const int nx = tile.x + FourNeighborX[i];
+			const int ny = tile.y + FourNeighborY[i];
+			if (!m_tileRegions.isInside(nx, ny) || m_tileChokes(nx, ny) == choke.id)
+				continue;
+			for (int side = 0; side < 2; ++side)
+			{
+				if (m_tileRegions(nx, ny) == sideRegions[side])
+				{
+					touchesSide[side] = true;
+					sideHeights[side] += grid.getTerrainHeight(nx, ny);
+					++sideHeightCounts[side];
+				}
+			}
+		}
+		for (int side = 0; side < 2; ++side)
+		{
+			// The frontier tiles of a flat choke belong to one of the two regions
+			if (m_tileRegions(tile.x, tile.y) == sideRegions[side])
+			{
+				touchesSide[side] = true;
+				sideHeights[side] += grid.getTerrainHeight(tile.x, tile.y);
+				++sideHeightCounts[side];
+			}
+			if (touchesSide[side])
+				sideTiles[side].push_back(tile);
+		}
+		choke.center += CCPosition(tile.x + 0.5f, tile.y + 0.5f);
+	}
+	choke.center /= float(choke.tiles.size());
+
+	if (sideHeightCounts[0] > 0 && sideHeightCounts[1] > 0)
+	{
+		sideHeights[0] /= sideHeightCounts[0];
+		sideHeights[1] /= sideHeightCounts[1];
+		choke.heightDelta = std::abs(sideHeights[0] - sideHeights[1]);
+	}
+	if (choke.isRamp)
+	{
+		const int higherSide = sideHeights[0] >= sideHeights[1] ? 0 : 1;
+		choke.width = GetTileSpan(sideTiles[higherSide].empty() ? choke.tiles : sideTiles[higherSide]);
+	}
+	else
+	{
+		choke.width = GetTileSpan(choke.tiles);
+	}
+}
+
+// Region of the tile, of the first region of its choke or of the closest region tile within a few tiles, -1 if there is none
+int RegionManager::getNearbyRegionId(const CCTilePosition & tile) const
+{
+	const int regionId = getRegionId(tile.x, tile.y);
+	if (regionId >= 0)
+		return regionId;
+	if (m_tileChokes.isInside(tile.x, tile.y) && m_tileChokes(tile.x, tile.y) >= 0)
+		return m_chokes[m_tileChokes(tile.x, tile.y)].firstRegion;
+	const int maxRadius = 3;
+	for (int radius = 1; radius <= maxRadius; ++radius)
+	{
+		for (int dy = -radius; dy <= radius; ++dy)
+		{
+			for (int dx = -radius; dx <= radius; ++dx)
+			{
+				if (std::abs(dx) != radius && std::abs(dy) != radius)
+					continue;
+				const int nearbyRegionId = getRegionId(tile.x + dx, tile.y + dy);
+				if (nearbyRegionId >= 0)
+					return nearbyRegionId;
+			}
+		}
+	}
+	return -1;
+}
+
+int RegionManager::getRegionId(int x, int y) const
+{
+	if (!m_tileRegions.isInside(x, y))
+		return -1;
+	return m_tileRegions(x, y);
+}
+
+const MapRegion * RegionManager::getRegion(const CCTilePosition & tile) const
+{
+	const int regionId = getRegionId(tile.x, tile.y);
+	return regionId >= 0 ? &m_regions[regionId] : nullptr;
+}
+
+const MapRegion * RegionManager::getRegion(const CCPosition & position) const
+{
+	return getRegion(Util::GetTilePosition(position));
+}
+
+const MapChoke * RegionManager::getChoke(const CCTilePosition & tile) const
+{
+	if (!m_tileChokes.isInside(tile.x, tile.y) || m_tileChokes(tile.x, tile.y) < 0)
+		return nullptr;
+	return &m_chokes[m_tileChokes(tile.x, tile.y)];
+}
+
+std::vector<const MapChoke *> RegionManager::getChokesBetween(int firstRegion, int secondRegion) const
+{
+	std::vector<const MapChoke *> chokes;
+	if (firstRegion < 0 || firstRegion >= int(m_regions.size()))
+		return chokes;
+	for (const int chokeId : m_regions[firstRegion].chokes)
+	{
+		const auto & choke = m_chokes[chokeId];
+		if (choke.firstRegion == secondRegion || choke.secondRegion == secondRegion)
+			chokes.push_back(&choke);
+	}
+	return chokes;
+}
+
+const MapRegion * RegionManager::getMainRegion(int player) const
+{
+	const auto startingBaseLocation = m_bot.Bases().getPlayerStartingBaseLocation(player);
+	if (!startingBaseLocation)
+		return nullptr;
+	const int regionId = getNearbyRegionId(startingBaseLocation->getDepotTilePosition());
+	return regionId >= 0 ? &m_regions[regionId] : nullptr;
+}
+
+const MapChoke * RegionManager::getMainRamp(int player) const
+{
+	const auto mainRegion = getMainRegion(player);
+	if (!mainRegion)
+		return nullptr;
+
+	// The ramps going down first, then any choke, the closest to the center of the map
+	const MapChoke * mainRamp = nullptr;
+	bool isMainRampGoingDown = false;
+	float mainRampDistance = 0.f;
+	for (const int chokeId : mainRegion->chokes)
+	{
+		const auto & choke = m_chokes[chokeId];
+		const int otherRegion = choke.firstRegion == mainRegion->id ? choke.secondRegion : choke.firstRegion;
+		const bool goingDown = choke.isRamp && m_regions[otherRegion].height < mainRegion->height;
+		const float distance = Util::DistSq(choke.center, m_bot.Map().center());
+		if (!mainRamp || (goingDown && !isMainRampGoingDown) || (goingDown == isMainRampGoingDown && distance < mainRampDistance))
+		{
+			mainRamp = &choke;
+			isMainRampGoingDown = goingDown;
+			mainRampDistance = distance;
+		}
+	}
+	return mainRamp;
+}
+
+void RegionManager::draw() const
+{
+#ifdef PUBLIC_RELEASE
+	return;
+#endif
+	if (!m_bot.Config().DrawRegions)
+		return;
+
+	for (const auto & choke : m_chokes)
+	{
+		const auto color = choke.isRamp ? CCColor(255, 255, 0) : CCColor(255, 128, 0);
+		for (const auto & tile : choke.tiles)
+			m_bot.Map().drawTile(tile.x, tile.y, color);
+		std::stringstream ss;
+		ss << "Choke " << choke.id << " (" << choke.firstRegion << "-" << choke.secondRegion << ")\nwidth " << choke.width << " height " << choke.heightDelta;
+		m_bot.Map().drawText(choke.center, ss.str(), color);
+	}
+	for (const auto & region : m_regions)
+	{
+		std::stringstream ss;
+		ss << "Region " << region.id << "\n" << region.tileCount << " tiles" << (region.base ? "\nbase" : "");
+		m_bot.Map().drawText(region.center, ss.str());
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Common.h"
+#include "MapGrid.h"
+
+class CCBot;
+class BaseLocation;
+
+struct MapChoke
+{
+	int id;
+	int firstRegion;
+	int secondRegion;
+	bool isRamp;
+	std::vector<CCTilePosition> tiles;	// the ramp tiles, or the tiles where the two regions meet
+	CCPosition center;
+	float width;			// in tiles, across the passage
+	float heightDelta;		// terrain height difference between the two sides
+};
+
+struct MapRegion
+{
+	int id;
+	int tileCount;
+	CCPosition center;
+	float height;			// average terrain height
+	int maxClearance;		// largest tile distance to an unwalkable tile
+	const BaseLocation * base;	// base location whose depot is in the region, nullptr if there is none
+	std::vector<int> chokes;
+};
+
+/*
+ * Splits the walkable tiles of the map into regions joined by chokes, computed once at the start of the game.
+ * The ramps (walkable tiles that cannot be built on and that join terrain levels) are chokes of their own. The other tiles are grouped
+ * by a watershed on their clearance, two basins that meet at a clearance much lower than their own stay separated by a choke.
+ */
+class RegionManager
+{
+	CCBot & m_bot;
+	std::vector<MapRegion> m_regions;
+	std::vector<MapChoke> m_chokes;
+	GridPlane<int> m_tileRegions;	// region id of each tile, -1 for the unwalkable and the ramp tiles
+	GridPlane<int> m_tileChokes;	// choke id of each tile, -1 outside the chokes
+
+	const float RampMinHeightDelta = 1.f;
+	const int RampMaxTileCount = 200;
+	const int RegionMinClearance = 5;			// basins with a lower clearance merge with their neighbors
+	const float ChokeMaxClearanceRatio = 0.6f;	// of the clearance of the smaller of the two basins
+
+	void computeClearance(const TileBitmask & rampTiles, GridPlane<int> & clearance) const;
+	void computeRegions(const GridPlane<int> & clearance);
+	void addChoke(int firstRegion, int secondRegion, bool isRamp, std::vector<CCTilePosition> && tiles);
+	void annotateRegions(const GridPlane<int> & clearance);
+	void annotateChoke(MapChoke & choke) const;
+	int getNearbyRegionId(const CCTilePosition & tile) const;
+
+public:
+
+	RegionManager(CCBot & bot);
+
+	void onStart();
+	void draw() const;
+
+	const std::vector<MapRegion> & getRegions() const { return m_regions; }
+	const std::vector<MapChoke> & getChokes() const { return m_chokes; }
+	int getRegionId(int x, int y) const;
+	const MapRegion * getRegion(const CCTilePosition & tile) const;
+	const MapRegion * getRegion(const CCPosition & position) const;
+	const MapChoke * getChoke(const CCTilePosition & tile) const;
+	std::vector<const MapChoke *> getChokesBetween(int firstRegion, int secondRegion) const;
+	const MapRegion * getMainRegion(int player) const;
+	// The ramp going down from the main region of the player, nullptr until the starting base of the player is known
+	const MapChoke * getMainRamp(int player) const;
+};
@@ -138,7 +138,8 @@ void RepairStationManager::reservePlaceForUnit(const sc2::Unit* unit)
 				continue;
 
 			const int count = repairStation.second.size();
-			const float distance = Util::DistSq(unit->pos, repairStation.first->getPosition());
+			const int groundDistance = unit->is_flying ? -1 : repairStation.first->getGroundDistance(CCPosition(unit->pos));
+			const float distance = groundDistance >= 0 ? groundDistance : Util::Dist(unit->pos, repairStation.first->getPosition());
 			if (baseLocation == nullptr || count < lowestCount || (count == lowestCount && distance < lowestDistance))
 			{
 				baseLocation = repairStation.first;
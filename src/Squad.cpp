@@ -1,6 +1,10 @@
 #include "Squad.h"
 #include "CCBot.h"
 #include "Util.h"
+#include "SquadData.h"
+
+// Marks the snapshot of the members as outdated
+const uint32_t OutdatedUnitData = std::numeric_limits<uint32_t>::max();
 
 Squad::Squad(CCBot & bot)
     : m_bot(bot)
@@ -14,6 +18,9 @@ Squad::Squad(CCBot & bot)
     , m_name("Default")
     , m_meleeManager(bot)
     , m_rangedManager(bot)
+    , m_squadData(nullptr)
+    , m_handle()
+    , m_unitDataFrame(OutdatedUnitData)
 {
 }
 
@@ -32,6 +39,9 @@ Squad::Squad(const std::string & name, const SquadOrder & order, size_t priority
     , m_priority(priority)
 	, m_meleeManager(bot)
 	, m_rangedManager(bot)
+	, m_squadData(nullptr)
+	, m_handle()
+	, m_unitDataFrame(OutdatedUnitData)
 {
 }
 
@@ -50,9 +60,18 @@ Squad::Squad(const std::string & name, const SquadOrder & order, int maxRegroupD
     , m_priority(priority)
 	, m_meleeManager(bot)
 	, m_rangedManager(bot)
+	, m_squadData(nullptr)
+	, m_handle()
+	, m_unitDataFrame(OutdatedUnitData)
 {
 }
 
+void Squad::setSquadData(SquadData * squadData, SquadHandle handle)
+{
+	m_squadData = squadData;
+	m_handle = handle;
+}
+
 void Squad::onFrame()
 {
 	m_meleeManager.setSquad(this);
@@ -223,14 +242,18 @@ void Squad::setAllUnits()
     std::vector<Unit> goodUnits;
     for (auto & unit : m_units)
     {
-        if (!unit.isValid()) { continue; }
-        if (unit.isBeingConstructed()) { continue; }
-        if (unit.getHitPoints() <= 0) { continue; }
-        if (!unit.isAlive()) { continue; }
-        goodUnits.push_back(unit);
+        if (unit.isValid() && !unit.isBeingConstructed() && unit.getHitPoints() > 0 && unit.isAlive())
+        {
+            goodUnits.push_back(unit);
+        }
+        else if (m_squadData && unit.isValid())
+        {
+            m_squadData->onUnitRemoved(unit, m_handle);
+        }
     }
 
     m_units = goodUnits;
+    m_unitDataFrame = OutdatedUnitData;
 }
 
 void Squad::setNearEnemyUnits()
@@ -383,6 +406,10 @@ void Squad::setSquadOrder(const SquadOrder & so)
 
 bool Squad::containsUnit(const Unit & unit) const
 {
+	if (m_squadData)
+	{
+		return m_squadData->isUnitInSquad(unit, m_handle);
+	}
 	for(const auto & squadUnit : m_units)
 	{
 		if (squadUnit.getUnitPtr()->tag == unit.getUnitPtr()->tag)
@@ -401,9 +428,16 @@ void Squad::clear()
         {
             m_bot.Workers().finishedWithWorker(unit);
         }
+        if (m_squadData)
+        {
+            m_squadData->onUnitRemoved(unit, m_handle);
+        }
     }
 
     m_units.clear();
+    m_unitPositions.clear();
+    m_unitTypes.clear();
+    m_unitPositionSum = CCPosition(0, 0);
 }
 
 bool Squad::isUnitNearEnemy(const Unit & unit) const
@@ -421,18 +455,45 @@ bool Squad::isUnitNearEnemy(const Unit & unit) const
     return false;
 }
 
+void Squad::updateUnitData() const
+{
+    const uint32_t currentFrame = m_bot.GetCurrentFrame();
+    if (m_unitDataFrame == currentFrame)
+    {
+        return;
+    }
+
+    m_unitPositions.resize(m_units.size());
+    m_unitTypes.resize(m_units.size());
+    m_unitPositionSum = CCPosition(0, 0);
+    for (size_t i = 0; i < m_units.size(); ++i)
+    {
+        BOT_ASSERT(m_units[i].isValid(), "Unit pointer was null");
+        const sc2::Unit * unitPtr = m_units[i].getUnitPtr();
+        m_unitPositions[i] = unitPtr->pos;
+        m_unitTypes[i] = unitPtr->unit_type;
+        m_unitPositionSum += m_unitPositions[i];
+    }
+    m_unitDataFrame = currentFrame;
+}
+
 CCPosition Squad::calcCenter() const
 {
-    //TODO keep a reference to calc only once per frame
-    return Util::CalcCenter(m_units);
+    if (m_units.empty())
+    {
+        return CCPosition(0, 0);
+    }
+    updateUnitData();
+    return m_unitPositionSum / m_units.size();
 }
 
 float Squad::calcAverageHeight() const
 {
+    updateUnitData();
     float averageHeight = 0;
-    for (auto & unit : m_units)
+    for (auto & position : m_unitPositions)
     {
-        averageHeight += m_bot.Map().terrainHeight(unit.getTilePosition().x, unit.getTilePosition().y);
+        averageHeight += m_bot.Map().terrainHeight((int)position.x, (int)position.y);
     }
     averageHeight /= m_units.size();
     return averageHeight;
@@ -496,13 +557,12 @@ Unit Squad::unitClosestToEnemy() const
 
 int Squad::squadUnitsNear(const CCPosition & p) const
 {
+    updateUnitData();
     int numUnits = 0;
 
-    for (auto & unit : m_units)
+    for (auto & position : m_unitPositions)
     {
-        BOT_ASSERT(unit.isValid(), "null unit");
-
-        if (Util::DistSq(unit, p) < 20.0f * 20.0f)
+        if (Util::DistSq(position, p) < 20.0f * 20.0f)
         {
             numUnits++;
         }
@@ -518,22 +578,18 @@ const std::vector<Unit> & Squad::getUnits() const
 
 size_t Squad::getUnitCountOfType(sc2::UNIT_TYPEID unitType) const
 {
-	size_t units = 0;
-	for (const auto & unit : m_units)
-	{
-		if (unit.getAPIUnitType() == unitType)
-			++units;
-	}
-	return units;
+	updateUnitData();
+	return std::count(m_unitTypes.begin(), m_unitTypes.end(), unitType);
 }
 
 std::vector<Unit> Squad::getUnitsOfType(sc2::UNIT_TYPEID unitType) const
 {
+	updateUnitData();
 	std::vector<Unit> units;
-	for(const auto & unit : m_units)
+	for (size_t i = 0; i < m_units.size(); ++i)
 	{
-		if (unit.getAPIUnitType() == unitType)
-			units.push_back(unit);
+		if (m_unitTypes[i] == unitType)
+			units.push_back(m_units[i]);
 	}
 	return units;
 }
@@ -546,13 +602,36 @@ const SquadOrder & Squad::getSquadOrder()	const
 void Squad::addUnit(const Unit & unit)
 {
 	m_units.push_back(unit);
+	if (m_unitDataFrame == m_bot.GetCurrentFrame())
+	{
+		m_unitPositions.push_back(unit.getPosition());
+		m_unitTypes.push_back(unit.getAPIUnitType());
+		m_unitPositionSum += unit.getPosition();
+	}
+	if (m_squadData)
+	{
+		m_squadData->onUnitAdded(unit, m_handle);
+	}
 }
 
 void Squad::removeUnit(const Unit & unit)
 {
 	const auto it = std::find(m_units.begin(), m_units.end(), unit);
-	if (it != m_units.end())
-		m_units.erase(it);
+	if (it == m_units.end())
+		return;
+
+	if (m_unitDataFrame == m_bot.GetCurrentFrame())
+	{
+		const auto index = it - m_units.begin();
+		m_unitPositionSum -= m_unitPositions[index];
+		m_unitPositions.erase(m_unitPositions.begin() + index);
+		m_unitTypes.erase(m_unitTypes.begin() + index);
+	}
+	m_units.erase(it);
+	if (m_squadData)
+	{
+		m_squadData->onUnitRemoved(unit, m_handle);
+	}
 }
 
 void Squad::giveBackWorkers()
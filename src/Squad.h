@@ -7,6 +7,18 @@
 #include <ctime>
 
 class CCBot;
+class SquadData;
+
+// Slot of a squad in SquadData and the generation of the slot, so the handle of a removed squad never reaches the squad that reuses its slot
+struct SquadHandle
+{
+    int         index = -1;     // -1 for a squad that is not part of SquadData
+    uint32_t    generation = 0;
+
+    bool isValid() const { return index >= 0; }
+    bool operator==(const SquadHandle & other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const SquadHandle & other) const { return !(*this == other); }
+};
 
 class Squad
 {
@@ -36,6 +48,17 @@ class Squad
 
     std::map<Unit, bool> m_nearEnemy;
 
+    SquadData *         m_squadData;
+    SquadHandle         m_handle;
+
+    // Snapshot of the members taken once per frame, in the same order as m_units
+    mutable std::vector<CCPosition>         m_unitPositions;
+    mutable std::vector<sc2::UNIT_TYPEID>   m_unitTypes;
+    mutable CCPosition                      m_unitPositionSum;
+    mutable uint32_t                        m_unitDataFrame;
+
+    void updateUnitData() const;
+
     Unit unitClosestToEnemy() const;
 
     void updateUnits();
@@ -56,6 +79,7 @@ public:
 	RangedManager & getRangedManager() { return m_rangedManager; }
 
     void onFrame();
+    void setSquadData(SquadData * squadData, SquadHandle handle);
     void setSquadOrder(const SquadOrder & so);
     void addUnit(const Unit & unit);
     void removeUnit(const Unit & unit);
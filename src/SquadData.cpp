@@ -1,6 +1,7 @@
 #include "SquadData.h"
 #include "CCBot.h"
 #include "Util.h"
+#include <algorithm>
 
 SquadData::SquadData(CCBot & bot)
     : m_bot(bot)
@@ -11,55 +12,122 @@ SquadData::SquadData(CCBot & bot)
 void SquadData::onFrame()
 {
     updateAllSquads();
-    verifySquadUniqueMembership();
+    removeDeadUnits();
     drawSquadInformation();
 }
 
 void SquadData::clearSquadData()
 {
     // give back workers who were in squads
-    for (auto & kv : m_squads)
+    for (auto squad : m_squads)
     {
-        Squad & squad = kv.second;
-        squad.giveBackWorkers();//TODO 99% sure its useless since similar code is in .clear()
+        squad->giveBackWorkers();//TODO 99% sure its useless since similar code is in .clear()
     }
 
+    for (size_t index = 0; index < m_slots.size(); ++index)
+    {
+        auto & slot = m_slots[index];
+        if (!slot.squad)
+            continue;
+        slot.squad.reset();
+        ++slot.generation;
+        m_freeSlots.push_back((int)index);
+    }
     m_squads.clear();
+    m_squadHandles.clear();
+    m_unitSquads.clear();
 }
 
 void SquadData::removeSquad(const std::string & squadName)
 {
-    const auto & squadPtr = m_squads.find(squadName);
+    const auto & squadIt = m_squadHandles.find(squadName);
 
-    BOT_ASSERT(squadPtr != m_squads.end(), "Trying to clear a squad that didn't exist: %s", squadName.c_str());
-    if (squadPtr == m_squads.end())
+    BOT_ASSERT(squadIt != m_squadHandles.end(), "Trying to clear a squad that didn't exist: %s", squadName.c_str());
+    if (squadIt == m_squadHandles.end())
     {
         return;
     }
 
-    m_squads.erase(squadName);
+    // The slot is freed for the next squad, the other squads keep their handle
+    const SquadHandle handle = squadIt->second;
+    auto & slot = m_slots[handle.index];
+    for (auto & unit : slot.squad->getUnits())
+    {
+        if (unit.isValid())
+            onUnitRemoved(unit, handle);
+    }
+    m_squads.erase(std::find(m_squads.begin(), m_squads.end(), slot.squad.get()));
+    slot.squad.reset();
+    ++slot.generation;
+    m_freeSlots.push_back(handle.index);
+    m_squadHandles.erase(squadIt);
 }
 
-const std::map<std::string, Squad> & SquadData::getSquads() const
+const std::vector<Squad *> & SquadData::getSquads() const
 {
     return m_squads;
 }
 
 bool SquadData::squadExists(const std::string & squadName)
 {
-    return m_squads.find(squadName) != m_squads.end();
+    return m_squadHandles.find(squadName) != m_squadHandles.end();
 }
 
-void SquadData::addSquad(const std::string & squadName, const Squad & squad)
+bool SquadData::squadExists(SquadHandle handle) const
 {
-    m_squads.insert(std::pair<std::string, Squad>(squadName, squad));
+    return handle.index >= 0 && handle.index < (int)m_slots.size() && m_slots[handle.index].squad && m_slots[handle.index].generation == handle.generation;
+}
+
+SquadHandle SquadData::addSquad(const std::string & squadName, const Squad & squad)
+{
+    const auto squadIt = m_squadHandles.find(squadName);
+    if (squadIt != m_squadHandles.end())
+    {
+        return squadIt->second;
+    }
+
+    SquadHandle handle;
+    if (!m_freeSlots.empty())
+    {
+        handle.index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        handle.index = (int)m_slots.size();
+        m_slots.emplace_back();
+    }
+    auto & slot = m_slots[handle.index];
+    handle.generation = slot.generation;
+    slot.squad = std::make_unique<Squad>(squad);
+    slot.squad->setSquadData(this, handle);
+    m_squads.push_back(slot.squad.get());
+    m_squadHandles[squadName] = handle;
+    for (auto & unit : squad.getUnits())
+    {
+        onUnitAdded(unit, handle);
+    }
+    return handle;
 }
 
 void SquadData::updateAllSquads()
 {
-    for (auto & kv : m_squads)
+    for (auto squad : m_squads)
+    {
+        squad->onFrame();
+    }
+}
+
+// The squads cannot report the units that became invalid, their entries are erased here once they are dead
+void SquadData::removeDeadUnits()
+{
+    for (auto it = m_unitSquads.begin(); it != m_unitSquads.end();)
     {
-        kv.second.onFrame();
+        const auto unit = m_bot.GetUnitPtr(it->first);
+        if (!unit || !unit->is_alive)
+            it = m_unitSquads.erase(it);
+        else
+            ++it;
     }
 }
 
@@ -73,12 +141,13 @@ void SquadData::drawSquadInformation()
         return;
     }
 
+    DebugDrawScope drawScope(m_bot.Map().getDebugDraw(), DebugDrawCategory::Squads);
     std::stringstream ss;
     ss << "Squad Data\n\n";
 
-    for (auto & kv : m_squads)
+    for (auto & squadPtr : m_squads)
     {
-        const Squad & squad = kv.second;
+        const Squad & squad = *squadPtr;
 
         auto & units = squad.getUnits();
         const SquadOrder & order = squad.getSquadOrder();
@@ -87,8 +156,7 @@ void SquadData::drawSquadInformation()
 			ss << squad.getName() << ": [units: " << units.size() << ", status: " << order.getStatus() << "]\n";
 
         CCPosition squadCenter = squad.calcCenter();
-        float terrainHeight = m_bot.Map().terrainHeight(squadCenter.x, squadCenter.y);
-        m_bot.Debug()->DebugSphereOut(sc2::Point3D(squadCenter.x, squadCenter.y, terrainHeight), squad.getMaxDistanceFromCenter(), CCColor(0, 255, 0));
+        m_bot.Map().drawCircle(squadCenter, squad.getMaxDistanceFromCenter(), CCColor(0, 255, 0));
         m_bot.Map().drawCircle(order.getPosition(), 5, CCColor(255, 0, 0));
         m_bot.Map().drawText(order.getPosition(), squad.getName(), CCColor(255, 0, 0));
 
@@ -103,54 +171,64 @@ void SquadData::drawSquadInformation()
     m_bot.Map().drawTextScreen(0.5f, 0.2f, ss.str(), CCColor(255, 0, 0));
 }
 
-void SquadData::verifySquadUniqueMembership()
+bool SquadData::unitIsInSquad(const Unit & unit) const
 {
-    std::map<Unit, std::string> assigned;
-
-    for (const auto & kv : m_squads)
-    {
-        for (auto & unit : kv.second.getUnits())
-        {
-			const auto it = assigned.find(unit);
-			if(it != assigned.end())
-            {
-                std::cout << "Warning: A " << unit.getType().getName() << "(" << unit.getID() << ") is in at least two squads: " << kv.second.getName() << " and " << it->second << "\n";
-            }
+    return getUnitSquadHandle(unit).isValid();
+}
 
-            assigned[unit] = kv.second.getName();
-        }
-    }
+bool SquadData::isUnitInSquad(const Unit & unit, SquadHandle handle) const
+{
+    const auto it = m_unitSquads.find(unit.getID());
+    return it != m_unitSquads.end() && std::find(it->second.begin(), it->second.end(), handle) != it->second.end();
 }
 
-bool SquadData::unitIsInSquad(const Unit & unit) const
+SquadHandle SquadData::getUnitSquadHandle(const Unit & unit) const
 {
-    return getUnitSquad(unit) != nullptr;
+    const auto it = m_unitSquads.find(unit.getID());
+    return it != m_unitSquads.end() ? it->second.back() : SquadHandle();
 }
 
 const Squad * SquadData::getUnitSquad(const Unit & unit) const
 {
-    for (const auto & kv : m_squads)
-    {
-        if (kv.second.containsUnit(unit))
-        {
-            return &kv.second;
-        }
-    }
-
-    return nullptr;
+    const SquadHandle handle = getUnitSquadHandle(unit);
+    return handle.isValid() ? m_slots[handle.index].squad.get() : nullptr;
 }
 
 Squad * SquadData::getUnitSquad(const Unit & unit)
 {
-    for (auto & kv : m_squads)
+    const SquadHandle handle = getUnitSquadHandle(unit);
+    return handle.isValid() ? m_slots[handle.index].squad.get() : nullptr;
+}
+
+// Called by the squads, a unit can only be in one squad so being added to a second one is a bug.
+// The unit is still indexed with both squads so each of them finds it until it removes it.
+void SquadData::onUnitAdded(const Unit & unit, SquadHandle handle)
+{
+    auto & handles = m_unitSquads[unit.getID()];
+    if (std::find(handles.begin(), handles.end(), handle) != handles.end())
     {
-        if (kv.second.containsUnit(unit))
-        {
-            return &kv.second;
-        }
+        return;
+    }
+    if (!handles.empty())
+    {
+        std::cout << "Warning: A " << unit.getType().getName() << "(" << unit.getID() << ") is in at least two squads: " << getSquad(handle).getName() << " and " << getSquad(handles.back()).getName() << "\n";
     }
+    handles.push_back(handle);
+}
 
-    return nullptr;
+void SquadData::onUnitRemoved(const Unit & unit, SquadHandle handle)
+{
+    const auto it = m_unitSquads.find(unit.getID());
+    if (it == m_unitSquads.end())
+    {
+        return;
+    }
+    auto & handles = it->second;
+    handles.erase(std::remove(handles.begin(), handles.end(), handle), handles.end());
+    if (handles.empty())
+    {
+        m_unitSquads.erase(it);
+    }
 }
 
 void SquadData::assignUnitToSquad(const sc2::Unit* unitptr, Squad & squad)
@@ -210,5 +288,11 @@ Squad & SquadData::getSquad(const std::string & squadName)
         int a = 10;
     }
 
-    return m_squads.at(squadName);
+    return getSquad(m_squadHandles.at(squadName));
+}
+
+Squad & SquadData::getSquad(SquadHandle handle)
+{
+    BOT_ASSERT(squadExists(handle), "Trying to access squad that doesn't exist: %d", handle.index);
+    return *m_slots[handle.index].squad;
 }
\ No newline at end of file
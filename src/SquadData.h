@@ -2,16 +2,28 @@
 
 #include "Common.h"
 #include "Squad.h"
+#include <memory>
+#include <unordered_map>
 
 class CCBot;
 
 class SquadData
 {
+    struct SquadSlot
+    {
+        std::unique_ptr<Squad>  squad;
+        uint32_t                generation = 0;     // incremented when the squad of the slot is removed
+    };
+
     CCBot & m_bot;
-    std::map<std::string, Squad> m_squads;
+    std::vector<SquadSlot>                          m_slots;        // indexed by SquadHandle, the squads never move in memory
+    std::vector<int>                                m_freeSlots;    // slots of the removed squads, reused by the next added ones
+    std::vector<Squad *>                            m_squads;       // the squads of the slots, in the order they were added
+    std::unordered_map<std::string, SquadHandle>    m_squadHandles;
+    std::unordered_map<CCUnitID, std::vector<SquadHandle>> m_unitSquads;   // reverse index kept up to date by the squads, the last squad of a unit is its current one
 
     void    updateAllSquads();
-    void    verifySquadUniqueMembership();
+    void    removeDeadUnits();
 
 public:
 
@@ -23,16 +35,22 @@ public:
     bool            canAssignUnitToSquad(const Unit & unit, const Squad & squad, bool considerMaxSquadDistance = true) const;
 	void			assignUnitToSquad(const sc2::Unit* unitptr, Squad & squad);
 	void            assignUnitToSquad(const Unit & unit, Squad & squad);
-    void            addSquad(const std::string & squadName, const Squad & squad);
+    SquadHandle     addSquad(const std::string & squadName, const Squad & squad);
     void            removeSquad(const std::string & squadName);
     void            drawSquadInformation();
 
 
     bool            squadExists(const std::string & squadName);
+    bool            squadExists(SquadHandle handle) const;
     bool            unitIsInSquad(const Unit & unit) const;
+    bool            isUnitInSquad(const Unit & unit, SquadHandle handle) const;
+    SquadHandle     getUnitSquadHandle(const Unit & unit) const;
     const Squad *   getUnitSquad(const Unit & unit) const;
     Squad *         getUnitSquad(const Unit & unit);
+    void            onUnitAdded(const Unit & unit, SquadHandle handle);
+    void            onUnitRemoved(const Unit & unit, SquadHandle handle);
 
     Squad &         getSquad(const std::string & squadName);
-    const std::map<std::string, Squad> & getSquads() const;
+    Squad &         getSquad(SquadHandle handle);
+    const std::vector<Squad *> & getSquads() const;
 };
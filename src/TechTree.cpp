@@ -14,9 +14,156 @@ void TechTree::onStart()
 {
     initUnitTypeData();
     initUpgradeData();
+    compileTechRequirements();
     outputJSON("TechTree.json");
 }
 
+// The states of a unit type count as the same type, like UnitInfoManager::getUnitTypeCount does when it ignores the state
+static sc2::UNIT_TYPEID GetTechTypeAlias(sc2::UNIT_TYPEID type)
+{
+    switch (type)
+    {
+        case sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOTLOWERED: return sc2::UNIT_TYPEID::TERRAN_SUPPLYDEPOT;
+        case sc2::UNIT_TYPEID::TERRAN_BARRACKSFLYING: return sc2::UNIT_TYPEID::TERRAN_BARRACKS;
+        case sc2::UNIT_TYPEID::TERRAN_FACTORYFLYING: return sc2::UNIT_TYPEID::TERRAN_FACTORY;
+        case sc2::UNIT_TYPEID::TERRAN_STARPORTFLYING: return sc2::UNIT_TYPEID::TERRAN_STARPORT;
+        case sc2::UNIT_TYPEID::TERRAN_COMMANDCENTERFLYING: return sc2::UNIT_TYPEID::TERRAN_COMMANDCENTER;
+        case sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMANDFLYING: return sc2::UNIT_TYPEID::TERRAN_ORBITALCOMMAND;
+        case sc2::UNIT_TYPEID::TERRAN_HELLIONTANK: return sc2::UNIT_TYPEID::TERRAN_HELLION;
+        case sc2::UNIT_TYPEID::TERRAN_LIBERATORAG: return sc2::UNIT_TYPEID::TERRAN_LIBERATOR;
+        case sc2::UNIT_TYPEID::TERRAN_SIEGETANKSIEGED: return sc2::UNIT_TYPEID::TERRAN_SIEGETANK;
+        case sc2::UNIT_TYPEID::TERRAN_THORAP: return sc2::UNIT_TYPEID::TERRAN_THOR;
+        case sc2::UNIT_TYPEID::TERRAN_WIDOWMINEBURROWED: return sc2::UNIT_TYPEID::TERRAN_WIDOWMINE;
+        case sc2::UNIT_TYPEID::TERRAN_VIKINGASSAULT: return sc2::UNIT_TYPEID::TERRAN_VIKINGFIGHTER;
+        default: return type;
+    }
+}
+
+// Gives an index to every unit type that is a requirement or a producer, then computes the tech masks of all the items.
+// ProductionManager can then check the requirements of an item with a few bitset operations instead of counting units.
+void TechTree::compileTechRequirements()
+{
+    m_techTypes = { UnitType() };
+    m_techTypeIndices.clear();
+    m_techTypeIndicesByAbility.clear();
+    m_techTypePaths.clear();
+
+    auto addTechTypes = [this](const std::vector<UnitType> & types)
+    {
+        for (auto & type : types)
+        {
+            const sc2::UNIT_TYPEID alias = GetTechTypeAlias(type.getAPIUnitType());
+            if (alias == sc2::UNIT_TYPEID::INVALID || m_techTypeIndices.find(alias) != m_techTypeIndices.end())
+                continue;
+            BOT_ASSERT(m_techTypes.size() < MaxTechTypes, "Too many tech types, increase MaxTechTypes");
+            m_techTypeIndices[alias] = int(m_techTypes.size());
+            m_techTypes.push_back(UnitType(alias, m_bot));
+        }
+    };
+    for (auto & kv : m_unitTypeData)
+    {
+        addTechTypes(kv.second.requiredUnits);
+        addTechTypes(kv.second.whatBuilds);
+    }
+    for (auto & kv : m_upgradeData)
+    {
+        addTechTypes(kv.second.requiredUnits);
+        addTechTypes(kv.second.whatBuilds);
+    }
+
+    // the units being trained are found with the orders of their producer
+    for (auto & kv : m_unitTypeData)
+    {
+        const int index = getTechTypeIndex(kv.first);
+        if (index > 0 && !kv.second.isBuilding && uint32_t(kv.second.buildAbility) != 0)
+            m_techTypeIndicesByAbility.insert({ sc2::ABILITY_ID(uint32_t(kv.second.buildAbility)), index });
+    }
+
+    // the tech path of a type is its requirements, its first producer and their own tech paths, there are cycles (the workers build the bases that train them)
+    std::vector<TechMask> directTechTypes(m_techTypes.size());
+    for (size_t i = 1; i < m_techTypes.size(); ++i)
+    {
+        const auto it = m_unitTypeData.find(m_techTypes[i]);
+        if (it == m_unitTypeData.end())
+            continue;
+        compileTechMasks(it->second);
+        directTechTypes[i] = it->second.requiredTechTypes;
+        if (!it->second.whatBuilds.empty())
+            directTechTypes[i].set(getTechTypeIndexOrUnknown(it->second.whatBuilds[0]));
+    }
+    m_techTypePaths = directTechTypes;
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (size_t i = 1; i < m_techTypes.size(); ++i)
+        {
+            TechMask path = m_techTypePaths[i];
+            for (size_t j = 1; j < m_techTypes.size(); ++j)
+            {
+                if (directTechTypes[i].test(j))
+                    path |= m_techTypePaths[j];
+            }
+            if (path != m_techTypePaths[i])
+            {
+                m_techTypePaths[i] = path;
+                changed = true;
+            }
+        }
+    }
+
+    for (auto & kv : m_unitTypeData)
+        compileTechMasks(kv.second);
+    for (auto & kv : m_upgradeData)
+        compileTechMasks(kv.second);
+}
+
+void TechTree::compileTechMasks(TypeData & data) const
+{
+    data.requiredTechTypes.reset();
+    data.producerTechTypes.reset();
+    data.techPath.reset();
+    for (auto & required : data.requiredUnits)
+        data.requiredTechTypes.set(getTechTypeIndexOrUnknown(required));
+    for (auto & producer : data.whatBuilds)
+        data.producerTechTypes.set(getTechTypeIndexOrUnknown(producer));
+
+    TechMask direct = data.requiredTechTypes;
+    if (!data.whatBuilds.empty())
+        direct.set(getTechTypeIndexOrUnknown(data.whatBuilds[0]));
+    data.techPath = direct;
+    // the paths are not compiled yet while compileTechRequirements computes them
+    for (size_t i = 1; i < m_techTypePaths.size(); ++i)
+    {
+        if (direct.test(i))
+            data.techPath |= m_techTypePaths[i];
+    }
+}
+
+// The unknown index 0 is never available, so an item needing an unknown type is never considered buildable by the masks
+int TechTree::getTechTypeIndexOrUnknown(const UnitType & type) const
+{
+    const int index = getTechTypeIndex(type);
+    return index < 0 ? 0 : index;
+}
+
+int TechTree::getTechTypeIndex(const UnitType & type) const
+{
+    return getTechTypeIndex(sc2::UNIT_TYPEID(type.getAPIUnitType()));
+}
+
+int TechTree::getTechTypeIndex(sc2::UNIT_TYPEID type) const
+{
+    const auto it = m_techTypeIndices.find(GetTechTypeAlias(type));
+    return it == m_techTypeIndices.end() ? -1 : it->second;
+}
+
+int TechTree::getTechTypeIndexOfAbility(sc2::ABILITY_ID ability) const
+{
+    const auto it = m_techTypeIndicesByAbility.find(ability);
+    return it == m_techTypeIndicesByAbility.end() ? -1 : it->second;
+}
+
 
 #ifdef SC2API
 void TechTree::initUnitTypeData()
@@ -401,8 +548,10 @@ const TypeData & TechTree::getData(const UnitType & type)
     if (m_unitTypeData.find(type) == m_unitTypeData.end())
     {
         std::cout << "WARNING: Unit type not found: " << sc2::UnitTypeToName(type.getAPIUnitType()) << " (" << type.getAPIUnitType() << ")" << "\n";
-		m_unitTypeData[UnitType(sc2::UNIT_TYPEID(type.getAPIUnitType()), m_bot)] = { sc2::Race::Random, 0, 0, 0, 0, true, false, false, false, false, false, false, 0, 0,{ UnitType() },{ UnitType() },{} };
-        return m_unitTypeData[UnitType(sc2::UNIT_TYPEID(type.getAPIUnitType()), m_bot)];
+		auto & data = m_unitTypeData[UnitType(sc2::UNIT_TYPEID(type.getAPIUnitType()), m_bot)];
+		data = { sc2::Race::Random, 0, 0, 0, 0, true, false, false, false, false, false, false, 0, 0,{ UnitType() },{ UnitType() },{} };
+		compileTechMasks(data);
+        return data;
     }
 
     return m_unitTypeData.at(type);
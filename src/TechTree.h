@@ -2,10 +2,15 @@
 
 #include "Common.h"
 #include "UnitType.h"
+#include <bitset>
 
 class CCBot;
 class MetaType;
 
+// One bit per tech type, see TechTree::getTechTypeIndex
+const size_t MaxTechTypes = 256;
+typedef std::bitset<MaxTechTypes> TechMask;
+
 struct TypeData
 {
     CCRace                  race;
@@ -27,6 +32,9 @@ struct TypeData
     std::vector<UnitType>   whatBuilds;       // any of these units can build the item
     std::vector<UnitType>   requiredUnits;    // owning ONE of these is required to make
     std::vector<CCUpgrade>  requiredUpgrades; // having ALL of these is required to make
+    TechMask                requiredTechTypes;  // requiredUnits as tech type bits
+    TechMask                producerTechTypes;  // whatBuilds as tech type bits
+    TechMask                techPath;           // the requirements and the first producer, recursively: everything needed to make the item from scratch
 };
 
 class TechTree
@@ -35,8 +43,17 @@ class TechTree
     std::map<UnitType, TypeData>  m_unitTypeData;
     std::map<CCUpgrade, TypeData> m_upgradeData;
 
+    // the unit types that are a requirement or a producer of something, index 0 stands for the unknown types
+    std::vector<UnitType>                   m_techTypes;
+    std::map<sc2::UNIT_TYPEID, int>         m_techTypeIndices;
+    std::map<sc2::ABILITY_ID, int>          m_techTypeIndicesByAbility;    // only the units, buildings are tracked by the BuildingManager
+    std::vector<TechMask>                   m_techTypePaths;               // techPath of each tech type
+
     void initUnitTypeData();
     void initUpgradeData();
+    void compileTechRequirements();
+    void compileTechMasks(TypeData & data) const;
+    int  getTechTypeIndexOrUnknown(const UnitType & type) const;
 
     void outputJSON(const std::string & filename) const;
 
@@ -48,4 +65,11 @@ public:
     const TypeData & getData(const UnitType & type);
     const TypeData & getData(const CCUpgrade & type) const;
     const TypeData & getData(const MetaType & type);
+
+    // -1 if the type is neither a requirement nor a producer. The states of a type (lowered, flying, sieged...) share the same index.
+    int getTechTypeIndex(const UnitType & type) const;
+    int getTechTypeIndex(sc2::UNIT_TYPEID type) const;
+    // -1 if the ability does not make a unit (not a building) that is a requirement or a producer
+    int getTechTypeIndexOfAbility(sc2::ABILITY_ID ability) const;
+    size_t getTechTypeCount() const { return m_techTypes.size(); }
 };
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "ThreatCoverageIndex.h"
+#include "CCBot.h"
+#include "Util.h"
+#include <cmath>
+#include <limits>
+
+namespace
+{
+	// Upper bounds of the bonuses of Util::getThreatRange
+	const float THREAT_RANGE_MIN_SPEED_BONUS = 2.f;
+	const float THREAT_RANGE_HEIGHT_BONUS = 4.f;
+	const float THREAT_RANGE_TEMPEST_AIR_BONUS = 2.f;
+	const float THREAT_RANGE_BUFFER = 1.f;
+}
+
+ThreatCoverageIndex::ThreatCoverageIndex(CCBot & bot)
+	: m_bot(bot)
+	, m_targets(nullptr)
+	, m_maxTargetRadius(0.f)
+	, m_minX(0)
+	, m_minY(0)
+	, m_width(0)
+	, m_height(0)
+{
+}
+
+// Largest threat range of the threat against one of our units of at most m_maxTargetRadius, whatever the terrain height
+float ThreatCoverageIndex::getThreatRadius(const sc2::Unit * threat, bool flyingTarget) const
+{
+	sc2::Unit target;
+	target.unit_type = flyingTarget ? sc2::UNIT_TYPEID::TERRAN_VIKINGFIGHTER : sc2::UNIT_TYPEID::TERRAN_MARINE;
+	target.is_flying = flyingTarget;
+	target.radius = m_maxTargetRadius;
+	const float range = Util::GetAttackRangeForTarget(threat, &target, m_bot);
+	const float speed = std::max(THREAT_RANGE_MIN_SPEED_BONUS, Util::getSpeedOfUnit(threat, m_bot));
+	const float bonus = flyingTarget ? (threat->unit_type == sc2::UNIT_TYPEID::PROTOSS_TEMPEST ? THREAT_RANGE_TEMPEST_AIR_BONUS : 0.f) : THREAT_RANGE_HEIGHT_BONUS;
+	return range + speed + bonus + THREAT_RANGE_BUFFER;
+}
+
+void ThreatCoverageIndex::build(const sc2::Units & targets, float maxTargetRadius)
+{
+	clear();
+	m_targets = &targets;
+	m_maxTargetRadius = maxTargetRadius;
+
+	struct Disc
+	{
+		int slot;
+		CCPosition center;
+		float radius;
+	};
+	std::vector<Disc> discs[LayerCount];
+	int minX = std::numeric_limits<int>::max();
+	int minY = std::numeric_limits<int>::max();
+	int maxX = std::numeric_limits<int>::min();
+	int maxY = std::numeric_limits<int>::min();
+	for (size_t i = 0; i < targets.size(); ++i)
+	{
+		const sc2::Unit * target = targets[i];
+		BOT_ASSERT(target, "null target unit in ThreatCoverageIndex");
+		if (target->unit_type == sc2::UNIT_TYPEID::ZERG_NYDUSCANAL)
+		{
+			m_everywhereSlots.push_back(int(i));
+			continue;
+		}
+		for (int layer = 0; layer < LayerCount; ++layer)
+		{
+			const float radius = getThreatRadius(target, layer == Air);
+			discs[layer].push_back({ int(i), target->pos, radius });
+			minX = std::min(minX, int(std::floor(target->pos.x - radius)));
+			minY = std::min(minY, int(std::floor(target->pos.y - radius)));
+			maxX = std::max(maxX, int(std::floor(target->pos.x + radius)));
+			maxY = std::max(maxY, int(std::floor(target->pos.y + radius)));
+		}
+	}
+	if (discs[Ground].empty())
+		return;
+
+	// only the tiles the discs can cover are indexed
+	m_minX = std::max(0, minX);
+	m_minY = std::max(0, minY);
+	m_width = std::max(0, std::min(maxX, m_bot.Map().totalWidth() - 1) - m_minX + 1);
+	m_height = std::max(0, std::min(maxY, m_bot.Map().totalHeight() - 1) - m_minY + 1);
+	const size_t tileCount = size_t(m_width) * m_height;
+
+	// The tiles of a disc are those whose square intersects it, the row by row spans are visited twice: to count then to fill
+	auto forEachDiscTile = [this](const Disc & disc, auto && visit)
+	{
+		const int y0 = std::max(m_minY, int(std::floor(disc.center.y - disc.radius)));
+		const int y1 = std::min(m_minY + m_height - 1, int(std::floor(disc.center.y + disc.radius)));
+		for (int y = y0; y <= y1; ++y)
+		{
+			const float dy = std::max(0.f, std::max(y - disc.center.y, disc.center.y - (y + 1)));
+			const float halfWidth = std::sqrt(std::max(0.f, disc.radius * disc.radius - dy * dy));
+			const int x0 = std::max(m_minX, int(std::floor(disc.center.x - halfWidth)));
+			const int x1 = std::min(m_minX + m_width - 1, int(std::floor(disc.center.x + halfWidth)));
+			const size_t row = size_t(y - m_minY) * m_width;
+			for (int x = x0; x <= x1; ++x)
+				visit(row + (x - m_minX));
+		}
+	};
+
+	for (int layer = 0; layer < LayerCount; ++layer)
+	{
+		auto & offsets = m_tileOffsets[layer];
+		auto & slots = m_tileSlots[layer];
+		offsets.assign(tileCount + 1, 0);
+		for (const auto & disc : discs[layer])
+			forEachDiscTile(disc, [&offsets](size_t tile) { ++offsets[tile + 1]; });
+		for (size_t tile = 0; tile < tileCount; ++tile)
+			offsets[tile + 1] += offsets[tile];
+		slots.resize(offsets[tileCount]);
+		// the discs are in slot order, so each tile list is sorted like the targets
+		std::vector<int> fillOffsets(offsets.begin(), offsets.end() - 1);
+		for (const auto & disc : discs[layer])
+			forEachDiscTile(disc, [&](size_t tile) { slots[fillOffsets[tile]++] = disc.slot; });
+	}
+}
+
+void ThreatCoverageIndex::clear()
+{
+	m_targets = nullptr;
+	m_width = 0;
+	m_height = 0;
+	for (int layer = 0; layer < LayerCount; ++layer)
+	{
+		m_tileOffsets[layer].clear();
+		m_tileSlots[layer].clear();
+	}
+	m_everywhereSlots.clear();
+}
+
+bool ThreatCoverageIndex::canGetThreats(const sc2::Unit * unit, const sc2::Units & targets) const
+{
+	// Colossi can be hit by the anti-air weapons, the ground discs do not account for it
+	return m_targets == &targets && unit->radius <= m_maxTargetRadius && unit->unit_type != sc2::UNIT_TYPEID::PROTOSS_COLOSSUS;
+}
+
+void ThreatCoverageIndex::getThreats(const sc2::Unit * unit, sc2::Units & outThreats) const
+{
+	BOT_ASSERT(unit, "null ranged unit in getThreats");
+	const int x = int(unit->pos.x) - m_minX;
+	const int y = int(unit->pos.y) - m_minY;
+	const int * begin = nullptr;
+	const int * end = nullptr;
+	if (x >= 0 && y >= 0 && x < m_width && y < m_height)
+	{
+		const int layer = unit->is_flying ? Air : Ground;
+		const size_t tile = size_t(y) * m_width + x;
+		begin = m_tileSlots[layer].data() + m_tileOffsets[layer][tile];
+		end = m_tileSlots[layer].data() + m_tileOffsets[layer][tile + 1];
+	}
+
+	// merges the candidates of the tile with the threats to every unit to keep the order of the targets
+	auto everywhere = m_everywhereSlots.begin();
+	while (begin != end || everywhere != m_everywhereSlots.end())
+	{
+		int slot;
+		if (everywhere == m_everywhereSlots.end() || (begin != end && *begin < *everywhere))
+			slot = *begin++;
+		else
+			slot = *everywhere++;
+		Util::addThreatIfInRange(unit, (*m_targets)[slot], outThreats, m_bot);
+	}
+}
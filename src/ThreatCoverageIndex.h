@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Common.h"
+
+class CCBot;
+
+/*
+ * Finds the threats of many units against the same enemies without testing every enemy for every unit.
+ * build rasterizes, once per frame, a disc per enemy and per target layer (ground and air) into per-tile lists of enemy slots.
+ * The radius of a disc is an upper bound of Util::getThreatRange for any of our units up to the given radius,
+ * so getThreats only runs the exact Util::getThreats test on the enemies listed in the tile of the unit and gives the same result.
+ */
+class ThreatCoverageIndex
+{
+	enum Layer { Ground, Air, LayerCount };
+
+	CCBot & m_bot;
+	const sc2::Units * m_targets;		// the enemies given to build, they must live until the next build
+	float m_maxTargetRadius;
+	int m_minX;
+	int m_minY;
+	int m_width;
+	int m_height;
+	std::vector<int> m_tileOffsets[LayerCount];		// slots of tile i are from m_tileOffsets[i] to m_tileOffsets[i + 1]
+	std::vector<int> m_tileSlots[LayerCount];		// indices in m_targets
+	std::vector<int> m_everywhereSlots;				// threats to every unit, like Nydus Canals
+
+	float getThreatRadius(const sc2::Unit * threat, bool flyingTarget) const;
+
+public:
+
+	ThreatCoverageIndex(CCBot & bot);
+
+	// maxTargetRadius is the largest radius of the units that will be looked up
+	void build(const sc2::Units & targets, float maxTargetRadius);
+	void clear();
+	// false when the index was not built with these targets or the unit is not covered by the bound, getThreats would then be wrong
+	bool canGetThreats(const sc2::Unit * unit, const sc2::Units & targets) const;
+	// same as Util::getThreats(unit, targets, outThreats, bot), in the same order
+	void getThreats(const sc2::Unit * unit, sc2::Units & outThreats) const;
+};
@@ -701,12 +701,11 @@ void Unit::morph(const UnitType & type) const
 
 sc2::AvailableAbilities Unit::getAbilities() const
 {
-	return m_bot->Query()->GetAbilitiesForUnit(m_unit);
+	return m_bot->Abilities().getAbilities(m_unit);
 }
 
 /*
- * This method queries the game to check if the ability is available.
- * Since queries are slow, this method should not be used on every frame.
+ * This method checks the ability cache of the frame to know if the ability is available.
  */
 bool Unit::useAbility(const sc2::ABILITY_ID abilityId) const
 {
@@ -722,9 +721,8 @@ bool Unit::useAbility(const sc2::ABILITY_ID abilityId) const
 		}
 	}
 
-	auto query = m_bot->Query();
-	auto abilities = m_bot->Observation()->GetAbilityData();
-	sc2::AvailableAbilities available_abilities = query->GetAbilitiesForUnit(m_unit);
+	const auto & abilities = m_bot->Observation()->GetAbilityData();
+	const sc2::AvailableAbilities & available_abilities = m_bot->Abilities().getAbilities(m_unit);
 	for (const sc2::AvailableAbility & available_ability : available_abilities.abilities)
 	{
 		if (available_ability.ability_id >= abilities.size()) { continue; }
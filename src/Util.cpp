@@ -1,6 +1,7 @@
 #include "Util.h"
 #include "CCBot.h"
 #include "libvoxelbot/combat/combat_upgrades.h"
+#include <cstring>
 
 const float EPSILON = 1e-5;
 const float CLIFF_MIN_HEIGHT_DIFFERENCE = 1.f;
@@ -123,38 +124,8 @@ void Util::Initialize(CCBot & bot, CCRace race, const sc2::GameInfo & _gameInfo)
 	}
 	Util::gameInfo = &_gameInfo;
 
-	//assert(gameInfo->pathing_grid.data.size() == gameInfo->width * gameInfo->height);
-	m_pathable = std::vector<std::vector<bool>>(gameInfo->width);
-	m_placement = std::vector<std::vector<bool>>(gameInfo->width);
-	m_terrainHeight = std::vector<std::vector<float>>(gameInfo->width);
-	const auto pathingGrid = sc2::PathingGrid(*gameInfo);
-	const auto placementGrid = sc2::PlacementGrid(*gameInfo);
-	const auto heightMap = sc2::HeightMap(*gameInfo);
-	for (int x = 0; x < gameInfo->width; x++)
-	{
-		m_pathable[x] = std::vector<bool>(gameInfo->height);
-		m_placement[x] = std::vector<bool>(gameInfo->height);
-		m_terrainHeight[x] = std::vector<float>(gameInfo->height);
-		for (int y = 0; y < gameInfo->height; y++)
-		{
-			auto point = sc2::Point2DI(x, y);
-			auto index = x + y * gameInfo->width;
-			//Pathable
-			/*unsigned char encodedPathing = gameInfo->pathing_grid.data[index];
-			m_pathable[x][y] = encodedPathing == 255 ? false : true;*/
-			m_pathable[x][y] = pathingGrid.IsPathable(point);
-
-			//Placement
-			/*unsigned char encodedPlacement = gameInfo->placement_grid.data[index];
-			m_placement[x][y] = encodedPlacement == 255 ? true : false;*/
-			m_placement[x][y] = placementGrid.IsPlacable(point);
-			
-			//Terrain height
-			/*unsigned char encodedHeight = gameInfo->terrain_height.data[index];
-			m_terrainHeight[x][y] = float(encodedHeight) / 8.f - 15.875f;*/
-			m_terrainHeight[x][y] = heightMap.TerrainHeight(point);
-		}
-	}
+	// The terrain layers are read by MapTools::initializeTerrain, before this is called
+	m_mapGrid = &bot.Map().getGrid();
 
 	CreateDummyUnits(bot);
 }
@@ -167,7 +138,7 @@ void Util::InitializeCombatSimulator()
 	m_simulator->getCombatEnvironment({}, {});
 }
 
-Util::PathFinding::IMNode* getLowestCostNode(std::set<Util::PathFinding::IMNode*> & set)
+Util::PathFinding::IMNode* getLowestCostNode(FrameSet<Util::PathFinding::IMNode*> & set)
 {
 	Util::PathFinding::IMNode* lowestCostNode = nullptr;
 	for (const auto node : set)
@@ -254,13 +225,24 @@ CCPosition Util::PathFinding::FindOptimalPathToSaferRange(const sc2::Unit * unit
 }
 
 /*
- * Returns pathing distance. Returns -1 if no path is found.
+ * Returns pathing distance to the first position within 2 tiles of the goal. Returns -1 if no path is found.
  * If ignoreInfluence is true, no enemy influence will be taken into account when finding the path.
  * If it is false and enemy influence is encountered along the way, it will return -1.
+ * Ground units ignoring influence use the hierarchical pathfinder when the goal is walkable, the tile A* is used otherwise.
  */
 float Util::PathFinding::FindOptimalPathDistance(const sc2::Unit * unit, CCPosition goal, bool ignoreInfluence, CCBot & bot)
 {
-	const auto path = FindOptimalPath(unit, goal, CCPosition(), 2.f, !ignoreInfluence, false, false, ignoreInfluence, 0, false, bot);
+	const float maxRange = 2.f;
+	std::list<CCPosition> path;
+	// Reapers need the tile A* to jump cliffs, the hierarchical pathfinder does not stop on influence nor reaches unwalkable goals
+	if (ignoreInfluence && !unit->is_flying && unit->unit_type != sc2::UNIT_TYPEID::TERRAN_REAPER && bot.Pathfinder().isInitialized() && bot.Map().isWalkable(goal))
+	{
+		path = bot.Pathfinder().findPath(unit->pos, goal);
+	}
+	if (path.empty())
+	{
+		path = FindOptimalPath(unit, goal, CCPosition(), maxRange, !ignoreInfluence, false, false, ignoreInfluence, 0, false, bot);
+	}
 	if (path.empty())
 	{
 		return -1.f;
@@ -270,6 +252,10 @@ float Util::PathFinding::FindOptimalPathDistance(const sc2::Unit * unit, CCPosit
 	CCPosition lastPosition;
 	for (const auto position : path)
 	{
+		if (lastPosition != CCPosition() && Util::DistSq(lastPosition, goal) <= maxRange * maxRange)
+		{
+			break;
+		}
 		if (lastPosition != CCPosition())
 		{
 			dist += Dist(lastPosition, position);
@@ -296,12 +282,6 @@ CCPosition Util::PathFinding::FindOptimalPathToDodgeEffectAwayFromGoal(const sc2
 	return GetCommandPositionFromPath(path, unit, true, bot);
 }
 
-std::list<CCPosition> Util::PathFinding::FindOptimalPathWithoutLimit(const sc2::Unit * unit, CCPosition goal, CCBot & bot)
-{
-	FailureReason failureReason;
-	return FindOptimalPath(unit, goal, CCPosition(), 5.f, true, false, true, true, 0, false, false, failureReason, bot);
-}
-
 std::list<CCPosition> Util::PathFinding::FindOptimalPath(const sc2::Unit * unit, CCPosition goal, CCPosition secondaryGoal, float maxRange, bool exitOnInfluence, bool considerOnlyEffects, bool getCloser, bool ignoreInfluence, float maxInfluence, bool flee, CCBot & bot)
 {
 	FailureReason failureReason;
@@ -311,9 +291,11 @@ std::list<CCPosition> Util::PathFinding::FindOptimalPath(const sc2::Unit * unit,
 std::list<CCPosition> Util::PathFinding::FindOptimalPath(const sc2::Unit * unit, CCPosition goal, CCPosition secondaryGoal, float maxRange, bool exitOnInfluence, bool considerOnlyEffects, bool getCloser, bool ignoreInfluence, float maxInfluence, bool flee, bool limitSearch, FailureReason & failureReason, CCBot & bot)
 {
 	std::list<CCPosition> path;
-	std::set<IMNode*> opened;
-	std::set<IMNode*> closed;
-	std::map<int, float> bestCosts;
+	// The search temporaries, including the nodes, live in the frame arena
+	FrameSet<IMNode*> opened;
+	FrameSet<IMNode*> closed;
+	FrameMap<int, float> bestCosts;
+	FrameArena & arena = FrameArena::Get();
 
 	const auto maxExploredNode = HARASS_PATHFINDING_MAX_EXPLORED_NODE * (!limitSearch ? 20 : exitOnInfluence ? 5 : bot.Config().TournamentMode ? 3 : 1);
 	int numberOfTilesExploredAfterPathFound = 0;	//only used when getCloser is true
@@ -321,7 +303,7 @@ std::list<CCPosition> Util::PathFinding::FindOptimalPath(const sc2::Unit * unit,
 	const CCTilePosition startPosition = GetTilePosition(unit->pos);
 	const CCTilePosition goalPosition = GetTilePosition(goal);
 	const CCTilePosition secondaryGoalPosition = unit->is_flying || IsWorker(unit->unit_type) || unit->unit_type == sc2::UNIT_TYPEID::TERRAN_REAPER ? CCTilePosition() : GetTilePosition(secondaryGoal);
-	const auto start = new IMNode(startPosition);
+	const auto start = arena.create<IMNode>(startPosition);
 	bestCosts[start->getId()] = 0;
 	opened.insert(start);
 
@@ -334,6 +316,7 @@ std::list<CCPosition> Util::PathFinding::FindOptimalPath(const sc2::Unit * unit,
 		closed.insert(currentNode);
 		if (bot.Config().DrawPathfindingTiles)
 		{
+			DebugDrawScope drawScope(bot.Map().getDebugDraw(), DebugDrawCategory::Pathfinding);
 			bot.Map().drawTile(currentNode->position, sc2::Colors::White, 0.9f, false);
 		}
 
@@ -455,7 +438,7 @@ std::list<CCPosition> Util::PathFinding::FindOptimalPath(const sc2::Unit * unit,
 
 				const float heuristic = CalcEuclidianDistanceHeuristic(neighborPosition, goalPosition, secondaryGoalPosition, bot);
 				const float influence = totalInfluenceOnTile + currentNode->influence;
-				auto neighbor = new IMNode(neighborPosition, currentNode, totalCost, heuristic, influence);
+				auto neighbor = arena.create<IMNode>(neighborPosition, currentNode, totalCost, heuristic, influence);
 
 				if (bestCosts.find(neighbor->getId()) != bestCosts.end() && bestCosts[neighbor->getId()] <= totalCost)
 					continue;
@@ -475,10 +458,6 @@ std::list<CCPosition> Util::PathFinding::FindOptimalPath(const sc2::Unit * unit,
 	{
 		failureReason = TIMEOUT;
 	}
-	for (auto node : opened)
-		delete node;
-	for (auto node : closed)
-		delete node;
 	return path;
 }
 
@@ -499,7 +478,7 @@ CCTilePosition Util::PathFinding::GetNeighborNodePosition(int x, int y, IMNode*
 
 	if (!rangedUnit->is_flying)
 	{
-		if (bot.Commander().Combat().getBlockedTiles()[neighborPosition.x][neighborPosition.y])
+		if (bot.Commander().Combat().getBlockedTiles().get(neighborPosition.x, neighborPosition.y))
 			return {};	// tile is blocked
 
 		// TODO check if the unit can pass between 2 blocked tiles (this will need a change in the blocked tiles map to have types of block)
@@ -1624,7 +1603,7 @@ float Util::GetAttackRangeBonus(const sc2::UnitTypeID unitType, CCBot & bot)
 
 float Util::GetArmor(const sc2::Unit * unit, CCBot & bot)
 {
-    sc2::UnitTypeData unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
+    const sc2::UnitTypeData & unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
     return unitTypeData.armor;
 }
 
@@ -1648,7 +1627,7 @@ float Util::GetDps(const sc2::Unit * unit, const sc2::Weapon::TargetType targetT
 	float dps = GetSpecialCaseDps(unit, bot, targetType);
 	if (dps == 0.f)
 	{
-		sc2::UnitTypeData unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
+		const sc2::UnitTypeData & unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
 		for (auto & weapon : unitTypeData.weapons)
 		{
 			if (weapon.type == sc2::Weapon::TargetType::Any || targetType == sc2::Weapon::TargetType::Any || weapon.type == targetType)
@@ -1674,8 +1653,8 @@ float Util::GetDpsForTarget(const sc2::Unit * unit, const sc2::Unit * target, CC
     float dps = GetSpecialCaseDps(unit, bot, expectedWeaponType);
     if (dps == 0.f)
     {
-		sc2::UnitTypeData unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
-		sc2::UnitTypeData targetTypeData = GetUnitTypeDataFromUnitTypeId(target->unit_type, bot);
+		const sc2::UnitTypeData & unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
+		const sc2::UnitTypeData & targetTypeData = GetUnitTypeDataFromUnitTypeId(target->unit_type, bot);
         for (auto & weapon : unitTypeData.weapons)
         {
             if (weapon.type == sc2::Weapon::TargetType::Any || weapon.type == expectedWeaponType || target->unit_type == sc2::UNIT_TYPEID::PROTOSS_COLOSSUS)
@@ -1778,8 +1757,8 @@ float Util::GetDamageForTarget(const sc2::Unit * unit, const sc2::Unit * target,
 	float damage = GetSpecialCaseDamage(unit, bot, expectedWeaponType);
 	if (damage == 0.f)
 	{
-		sc2::UnitTypeData unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
-		sc2::UnitTypeData targetTypeData = GetUnitTypeDataFromUnitTypeId(target->unit_type, bot);
+		const sc2::UnitTypeData & unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
+		const sc2::UnitTypeData & targetTypeData = GetUnitTypeDataFromUnitTypeId(target->unit_type, bot);
 		for (auto & weapon : unitTypeData.weapons)
 		{
 			if (weapon.type == sc2::Weapon::TargetType::Any || weapon.type == expectedWeaponType || target->unit_type == sc2::UNIT_TYPEID::PROTOSS_COLOSSUS)
@@ -1853,37 +1832,42 @@ void Util::getThreats(const sc2::Unit * unit, const sc2::Units & targets, sc2::U
 {
 	BOT_ASSERT(unit, "null ranged unit in getThreats");
 
-	const auto & enemyUnitsBeingRepaired = bot.GetEnemyUnitsBeingRepaired();
-
 	// for each possible threat
 	for (auto targetUnit : targets)
 	{
-		BOT_ASSERT(targetUnit, "null target unit in getThreats");//can happen if a unit is not defined in an enum (sc2_typeenums.h)
-		if (targetUnit->unit_type == sc2::UNIT_TYPEID::ZERG_NYDUSCANAL)
-		{
-			outThreats.push_back(targetUnit);
-			continue;
-		}
-		if (Util::GetDpsForTarget(targetUnit, unit, bot) == 0.f)
-			continue;
-		//We consider a unit as a threat if the sum of its range and speed is bigger than the distance to our unit
-		//But this is not working so well for melee units, we keep every units in a radius of min threat range
-		const float threatRange = getThreatRange(unit, targetUnit, bot);
-		if (Util::DistSq(unit->pos, targetUnit->pos) < threatRange * threatRange)
-		{
-			outThreats.push_back(targetUnit);
+		addThreatIfInRange(unit, targetUnit, outThreats, bot);
+	}
+}
 
-			// We check if that threat is being repaired
-			if (!unit->is_flying)
+// Adds the target to the threats if it can reach our unit soon, also used by ThreatCoverageIndex on its candidates
+void Util::addThreatIfInRange(const sc2::Unit * unit, const sc2::Unit * targetUnit, sc2::Units & outThreats, CCBot & bot)
+{
+	BOT_ASSERT(targetUnit, "null target unit in getThreats");//can happen if a unit is not defined in an enum (sc2_typeenums.h)
+	if (targetUnit->unit_type == sc2::UNIT_TYPEID::ZERG_NYDUSCANAL)
+	{
+		outThreats.push_back(targetUnit);
+		return;
+	}
+	if (Util::GetDpsForTarget(targetUnit, unit, bot) == 0.f)
+		return;
+	//We consider a unit as a threat if the sum of its range and speed is bigger than the distance to our unit
+	//But this is not working so well for melee units, we keep every units in a radius of min threat range
+	const float threatRange = getThreatRange(unit, targetUnit, bot);
+	if (Util::DistSq(unit->pos, targetUnit->pos) < threatRange * threatRange)
+	{
+		outThreats.push_back(targetUnit);
+
+		// We check if that threat is being repaired
+		if (!unit->is_flying)
+		{
+			const auto & enemyUnitsBeingRepaired = bot.GetEnemyUnitsBeingRepaired();
+			const auto & it = enemyUnitsBeingRepaired.find(targetUnit);
+			if (it != enemyUnitsBeingRepaired.end())
 			{
-				const auto & it = enemyUnitsBeingRepaired.find(targetUnit);
-				if (it != enemyUnitsBeingRepaired.end())
+				// If so, we consider all the SCVs repairing it as threats
+				for (const auto enemyRepairingSCV : it->second)
 				{
-					// If so, we consider all the SCVs repairing it as threats
-					for (const auto enemyRepairingSCV : it->second)
-					{
-						outThreats.push_back(enemyRepairingSCV);
-					}
+					outThreats.push_back(enemyRepairingSCV);
 				}
 			}
 		}
@@ -2051,7 +2035,7 @@ bool Util::CanUnitSeeEnemyUnit(const sc2::Unit * unit, const sc2::Unit * enemyUn
 	const auto distSq = DistSq(unit->pos, enemyUnit->pos);
 	if (distSq > 20 * 20)
 		return false;	// Unit is just too far
-	const auto unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
+	const auto & unitTypeData = GetUnitTypeDataFromUnitTypeId(unit->unit_type, bot);
 	const auto sight = unitTypeData.sight_range + unit->radius + enemyUnit->radius;
 	if (distSq > sight * sight)
 		return false;	// Unit doesn't have enough sight range
@@ -2282,41 +2266,41 @@ sc2::Point2D Util::CalcPerpendicularVector(const sc2::Point2D & vector)
 bool Util::Pathable(const sc2::Point2D & point)
 {
 	sc2::Point2DI pointI((int)point.x, (int)point.y);
-	if (pointI.x < 0 || pointI.x >= gameInfo->width || pointI.y < 0 || pointI.y >= gameInfo->width)
+	if (!m_mapGrid->isInside(pointI.x, pointI.y))
 	{
 		return false;
 	}
-	return m_pathable[pointI.x][pointI.y];
+	return m_mapGrid->isPathable(pointI.x, pointI.y);
 }
 
 bool Util::Placement(const sc2::Point2D & point)
 {
 	sc2::Point2DI pointI((int)point.x, (int)point.y);
-	if (pointI.x < 0 || pointI.x >= gameInfo->width || pointI.y < 0 || pointI.y >= gameInfo->width)
+	if (!m_mapGrid->isInside(pointI.x, pointI.y))
 	{
 		return false;
 	}
-    return m_placement[pointI.x][pointI.y];
+    return m_mapGrid->isPlaceable(pointI.x, pointI.y);
 }
 
 float Util::TerrainHeight(const sc2::Point2D & point)
 {
 	sc2::Point2DI pointI((int)point.x, (int)point.y);
-	if (pointI.x < 0 || pointI.x >= gameInfo->width || pointI.y < 0 || pointI.y >= gameInfo->width)
+	if (!m_mapGrid->isInside(pointI.x, pointI.y))
 	{
 		return 0.0f;
 	}
-	return m_terrainHeight[pointI.x][pointI.y];
+	return m_mapGrid->getTerrainHeight(pointI.x, pointI.y);
 }
 
 float Util::TerrainHeight(const CCTilePosition pos)
 {
-	return m_terrainHeight[pos.x][pos.y];
+	return m_mapGrid->getTerrainHeight(pos.x, pos.y);
 }
 
 float Util::TerrainHeight(const int x, const int y)
 {
-	return m_terrainHeight[x][y];
+	return m_mapGrid->getTerrainHeight(x, y);
 }
 
 void Util::VisualizeGrids(CCBot& bot) 
@@ -2354,7 +2338,7 @@ sc2::UnitTypeID Util::GetUnitTypeIDFromName(const std::string & name, CCBot & bo
     return 0;
 }
 
-sc2::UnitTypeData Util::GetUnitTypeDataFromUnitTypeId(const sc2::UnitTypeID unitTypeId, CCBot & bot)
+const sc2::UnitTypeData & Util::GetUnitTypeDataFromUnitTypeId(const sc2::UnitTypeID unitTypeId, CCBot & bot)
 {
     return bot.Observation()->GetUnitTypeData()[unitTypeId];
 }
@@ -2431,7 +2415,7 @@ bool Util::UnitCanMetaTypeNow(const Unit & unit, const UnitType & type, CCBot &
 {
 #ifdef SC2API
     BOT_ASSERT(unit.isValid(), "Unit pointer was null");
-    sc2::AvailableAbilities available_abilities = bot.Query()->GetAbilitiesForUnit(unit.getUnitPtr());
+    const sc2::AvailableAbilities & available_abilities = bot.Abilities().getAbilities(unit.getUnitPtr());
     
     // quick check if the unit can't do anything it certainly can't build the thing we want
     if (available_abilities.abilities.empty()) 
@@ -2603,13 +2587,27 @@ float Util::SimulateCombat(const sc2::Units & units, const sc2::Units & enemyUni
  * Returns a value between 1 and 0, representing the army supply remaining after the fight.
  */
 float Util::SimulateCombat(const sc2::Units & units, const sc2::Units & simulatedUnits, const sc2::Units & enemyUnits, CCBot & bot)
+{
+	CombatSimulation simulation;
+	PrepareCombatSimulation(units, simulatedUnits, enemyUnits, simulation, bot);
+	return RunCombatSimulation(simulation);
+}
+
+void Util::PrepareCombatSimulation(const sc2::Units & units, const sc2::Units & simulatedUnits, const sc2::Units & enemyUnits, CombatSimulation & simulation, CCBot & bot)
 {
 	if (units.empty() || simulatedUnits.empty())
-		return 0.f;
+	{
+		simulation.knownResult = 0.f;
+		return;
+	}
 	if (enemyUnits.empty())
-		return 1.f;
+	{
+		simulation.knownResult = 1.f;
+		return;
+	}
 	const int playerId = GetSelfPlayerId(bot);
-	CombatState state;
+	simulation.playerId = playerId;
+	CombatState & state = simulation.state;
 	for(int i=0; i<2; ++i)
 	{
 		const sc2::Units & playerUnits = i == 0 ? simulatedUnits : enemyUnits;
@@ -2626,13 +2624,17 @@ float Util::SimulateCombat(const sc2::Units & units, const sc2::Units & simulate
 				state.units.push_back(CombatUnit(*unit));
 		}
 	}
+	for (const auto & unit : state.units)
+	{
+		if (unit.owner == playerId)
+			simulation.foodRequired[unit.type] = bot.Observation()->GetUnitTypeData()[sc2::UnitTypeID(unit.type)].food_required;
+	}
 	
 	// Calculate our army score to compare after the fight
-	float armySupplyScore = 0.f;
 	for (const auto unit : units)
 	{
 		const sc2::UnitTypeData & unitTypeData = bot.Observation()->GetUnitTypeData()[unit->unit_type];
-		armySupplyScore += unitTypeData.food_required * (0.25f + 0.75f * unit->health / unit->health_max);
+		simulation.armySupplyScore += unitTypeData.food_required * (0.25f + 0.75f * unit->health / unit->health_max);
 	}
 
 	CombatUpgrades player1upgrades = {};
@@ -2643,13 +2645,20 @@ float Util::SimulateCombat(const sc2::Units & units, const sc2::Units & simulate
 		(playerId == 1 ? player1upgrades : player2upgrades).add(upgrade);
 	
 	state.environment = &m_simulator->getCombatEnvironment(player1upgrades, player2upgrades);
-	
+}
+
+// Does not use the bot, so it can run on a worker thread
+float Util::RunCombatSimulation(const CombatSimulation & simulation)
+{
+	if (simulation.knownResult >= 0.f)
+		return simulation.knownResult;
+	const int playerId = simulation.playerId;
 	CombatSettings settings;
 	
 	// Simulate for at most 100 *game* seconds
 	// Just to show that it can be configured, in this case 100 game seconds is more than enough for the battle to finish.
 	settings.maxTime = 100;
-	const CombatResult outcome = m_simulator->predict_engage(state, settings);
+	const CombatResult outcome = m_simulator->predict_engage(simulation.state, settings);
 	const int winner = outcome.state.owner_with_best_outcome();
 	if (winner != playerId)
 		return 0.f;
@@ -2659,14 +2668,50 @@ float Util::SimulateCombat(const sc2::Units & units, const sc2::Units & simulate
 	{
 		if (unit.owner == playerId && unit.health > 0)
 		{
-			const sc2::UnitTypeData & unitTypeData = bot.Observation()->GetUnitTypeData()[sc2::UnitTypeID(unit.type)];
-			resultArmySupplyScore += unitTypeData.food_required * (0.25f + 0.75f * unit.health / unit.health_max);
+			const auto it = simulation.foodRequired.find(unit.type);
+			const float foodRequired = it != simulation.foodRequired.end() ? it->second : 0.f;
+			resultArmySupplyScore += foodRequired * (0.25f + 0.75f * unit.health / unit.health_max);
 		}
 	}
-	const float armyRating = resultArmySupplyScore / armySupplyScore;
+	const float armyRating = resultArmySupplyScore / simulation.armySupplyScore;
 	return armyRating;
 }
 
+// Two simulations with the same hash give the same result, the position of the units is not simulated
+uint64_t Util::CombatSimulation::getHash() const
+{
+	uint64_t hash = 14695981039346656037ull;
+	const auto combine = [&hash](uint64_t value)
+	{
+		hash ^= value;
+		hash *= 1099511628211ull;
+	};
+	const auto combineFloat = [&combine](float value)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		combine(bits);
+	};
+	combineFloat(knownResult);
+	combine(uint64_t(playerId));
+	combineFloat(armySupplyScore);
+	combine(uint64_t(reinterpret_cast<uintptr_t>(state.environment)));
+	for (const auto & unit : state.units)
+	{
+		combine(uint64_t(unit.owner));
+		combine(uint64_t(unit.type));
+		combineFloat(unit.health);
+		combineFloat(unit.health_max);
+		combineFloat(unit.shield);
+		combineFloat(unit.shield_max);
+		combineFloat(unit.energy);
+		combine(unit.is_flying);
+		for (const auto buff : unit.buffs)
+			combine(uint64_t(buff));
+	}
+	return hash;
+}
+
 int Util::GetSelfPlayerId(CCBot & bot)
 {
 	return bot.Observation()->GetGameInfo().player_info[0].player_id == bot.Observation()->GetPlayerID() ? 1 : 2;
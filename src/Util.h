@@ -2,11 +2,13 @@
 
 #include "Common.h"
 #include "UnitType.h"
+#include "FrameAllocator.h"
 #include <list>
 #include "libvoxelbot/combat/simulator.h"
 
 class CCBot;
 class Unit;
+class MapGrid;
 
 namespace Util
 {
@@ -25,9 +27,7 @@ namespace Util
 	static UnitType workerType;
 	static UnitType supplyType;
 	static const sc2::GameInfo * gameInfo;
-	static std::vector<std::vector<bool>> m_pathable;
-	static std::vector<std::vector<bool>> m_placement;
-	static std::vector<std::vector<float>> m_terrainHeight;
+	static const MapGrid * m_mapGrid;
 	static sc2::Unit * m_dummyVikingAssault;
 	static sc2::Unit * m_dummyStimedMarine;
 	static sc2::Unit * m_dummyStimedMarauder;
@@ -123,7 +123,6 @@ namespace Util
 		float FindOptimalPathDistance(const sc2::Unit * unit, CCPosition goal, bool ignoreInfluence, CCBot & bot);
 		CCPosition FindOptimalPathPosition(const sc2::Unit * unit, CCPosition goal, float maxRange, bool exitOnInfluence, bool considerOnlyEffects, bool getCloser, CCBot & bot);
 		CCPosition FindOptimalPathToDodgeEffectAwayFromGoal(const sc2::Unit * unit, CCPosition goal, float range, CCBot & bot);
-		std::list<CCPosition> FindOptimalPathWithoutLimit(const sc2::Unit * unit, CCPosition goal, CCBot & bot);
 		std::list<CCPosition> FindOptimalPath(const sc2::Unit * unit, CCPosition goal, CCPosition secondaryGoal, float maxRange, bool exitOnInfluence, bool considerOnlyEffects, bool getCloser, bool ignoreInfluence, float maxInfluence, bool flee, CCBot & bot);
 		std::list<CCPosition> FindOptimalPath(const sc2::Unit * unit, CCPosition goal, CCPosition secondaryGoal, float maxRange, bool exitOnInfluence, bool considerOnlyEffects, bool getCloser, bool ignoreInfluence, float maxInfluence, bool flee, bool limitSearch, FailureReason & failureReason, CCBot & bot);
 		CCTilePosition GetNeighborNodePosition(int x, int y, IMNode* currentNode, const sc2::Unit * rangedUnit, CCBot & bot);
@@ -160,7 +159,7 @@ namespace Util
 	std::string GetMapName();
 	
 	template< typename O, typename S>
-	bool Contains(O object, S structure) { return std::find(structure.begin(), structure.end(), object) != structure.end(); }
+	bool Contains(O object, const S & structure) { return std::find(structure.begin(), structure.end(), object) != structure.end(); }
 	template< typename O, typename S>
 	typename S::iterator Find(O object, S structure) { return std::find(structure.begin(), structure.end(), object); }
 	inline bool StringStartsWith(std::string s, std::string find) { return s.rfind(find, 0) == 0; }
@@ -203,6 +202,7 @@ namespace Util
 	float GetDamageForTarget(const sc2::Unit * unit, const sc2::Unit * target, CCBot & bot);
 	float GetSpecialCaseDamage(const sc2::Unit * unit, CCBot & bot, sc2::Weapon::TargetType where = sc2::Weapon::TargetType::Any);
 	void getThreats(const sc2::Unit * unit, const sc2::Units & targets, sc2::Units & outThreats, CCBot & bot);
+	void addThreatIfInRange(const sc2::Unit * unit, const sc2::Unit * target, sc2::Units & outThreats, CCBot & bot);
 	sc2::Units getThreats(const sc2::Unit * unit, const sc2::Units & targets, CCBot & bot);
 	sc2::Units getThreats(const sc2::Unit * unit, const std::vector<Unit> & targets, CCBot & bot);
 	float getThreatRange(const sc2::Unit * unit, const sc2::Unit * threat, CCBot & m_bot);
@@ -237,7 +237,7 @@ namespace Util
     void            Normalize(sc2::Point2D& point);
     sc2::Point2D    Normalized(const sc2::Point2D& point);
     float           GetDotProduct(const sc2::Point2D& v1, const sc2::Point2D& v2);
-    sc2::UnitTypeData GetUnitTypeDataFromUnitTypeId(const sc2::UnitTypeID unitTypeId, CCBot & bot);
+    const sc2::UnitTypeData & GetUnitTypeDataFromUnitTypeId(const sc2::UnitTypeID unitTypeId, CCBot & bot);
 
     sc2::UnitTypeID GetUnitTypeIDFromName(const std::string & name, CCBot & bot);
     sc2::UpgradeID  GetUpgradeIDFromName(const std::string & name, CCBot & bot);
@@ -303,5 +303,19 @@ namespace Util
 
 	float SimulateCombat(const sc2::Units & units, const sc2::Units & enemyUnits, CCBot & bot);
 	float SimulateCombat(const sc2::Units & units, const sc2::Units & simulatedUnits, const sc2::Units & enemyUnits, CCBot & bot);
+
+	// Everything SimulateCombat needs from the game, it is built on the game thread and can then be run on any thread
+	struct CombatSimulation
+	{
+		CombatState state;
+		int playerId = 0;
+		float armySupplyScore = 0.f;
+		std::map<sc2::UNIT_TYPEID, float> foodRequired;		// of the unit types we simulate
+		float knownResult = -1.f;		// set when the result is known without simulating
+
+		uint64_t getHash() const;
+	};
+	void PrepareCombatSimulation(const sc2::Units & units, const sc2::Units & simulatedUnits, const sc2::Units & enemyUnits, CombatSimulation & simulation, CCBot & bot);
+	float RunCombatSimulation(const CombatSimulation & simulation);
 	int GetSelfPlayerId(CCBot & bot);
 };
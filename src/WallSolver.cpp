@@ -0,0 +1,373 @@
+#include "WallSolver.h"
+#include <limits>
+
+namespace
+{
+	const int FourNeighborX[] = { 1, -1, 0, 0 };
+	const int FourNeighborY[] = { 0, 0, 1, -1 };
+	const int AddonSize = 2;
+
+	struct FlowEdge
+	{
+		int to;
+		int capacity;
+	};
+}
+
+struct WallSolver::Search
+{
+	std::vector<WallFootprint> footprints;			// sorted so the identical footprints follow each other
+	std::vector<size_t> footprintOrder;				// index of each sorted footprint in the footprints of the caller
+	std::vector<std::vector<Candidate>> candidates;	// per sorted footprint, by increasing cost
+	std::vector<float> minRemainingCosts;			// lowest cost of the footprints from this one to the last
+	std::vector<char> occupied;						// 1 for the footprint tiles, 2 for the addon tiles
+	std::vector<size_t> chosen;
+	std::vector<size_t> bestChosen;
+	float bestCost;
+	int bestGap;
+	int maxGap;
+	int nodes;
+	int gapComputations;
+	// The flow graph of all the open tiles is built once, the occupied tiles are skipped when looking for the paths
+	std::vector<FlowEdge> edges;
+	std::vector<int> capacities;					// of each edge in the graph without flow
+	std::vector<std::vector<int>> nodeEdges;
+	std::vector<int> previousEdges;
+	std::vector<int> queue;
+};
+
+WallSolver::WallSolver(const CCTilePosition & origin, int width, int height)
+	: m_origin(origin)
+	, m_width(width)
+	, m_height(height)
+	, m_tiles(size_t(width) * height, TileType::Blocked)
+	, m_outsideTiles(size_t(width) * height, false)
+	, m_insideTiles(size_t(width) * height, false)
+{
+}
+
+void WallSolver::setTile(const CCTilePosition & tile, TileType type)
+{
+	const int x = tile.x - m_origin.x;
+	const int y = tile.y - m_origin.y;
+	if (isInside(x, y))
+		m_tiles[index(x, y)] = type;
+}
+
+void WallSolver::addOutsideTile(const CCTilePosition & tile)
+{
+	const int x = tile.x - m_origin.x;
+	const int y = tile.y - m_origin.y;
+	if (isInside(x, y))
+		m_outsideTiles[index(x, y)] = true;
+}
+
+void WallSolver::addInsideTile(const CCTilePosition & tile)
+{
+	const int x = tile.x - m_origin.x;
+	const int y = tile.y - m_origin.y;
+	if (isInside(x, y))
+		m_insideTiles[index(x, y)] = true;
+}
+
+void WallSolver::addTargetTile(const CCTilePosition & tile)
+{
+	const int x = tile.x - m_origin.x;
+	const int y = tile.y - m_origin.y;
+	if (isInside(x, y))
+		m_targetTiles.push_back(CCTilePosition(x, y));
+}
+
+bool WallSolver::solve(const std::vector<WallFootprint> & footprints, int maxGap, WallSolution & solution) const
+{
+	solution.nodes = 0;
+	solution.gapComputations = 0;
+	solution.truncated = false;
+	if (footprints.empty() || m_targetTiles.empty())
+		return false;
+
+	Search search;
+	for (size_t i = 0; i < footprints.size(); ++i)
+		search.footprintOrder.push_back(i);
+	std::stable_sort(search.footprintOrder.begin(), search.footprintOrder.end(), [&footprints](size_t a, size_t b)
+	{
+		if (footprints[a].size != footprints[b].size)
+			return footprints[a].size > footprints[b].size;
+		return footprints[a].hasAddon && !footprints[b].hasAddon;
+	});
+	for (const auto i : search.footprintOrder)
+	{
+		search.footprints.push_back(footprints[i]);
+		search.candidates.push_back(getCandidates(footprints[i]));
+		if (search.candidates.back().empty())
+			return false;
+	}
+	search.minRemainingCosts.resize(footprints.size() + 1, 0.f);
+	for (int i = int(footprints.size()) - 1; i >= 0; --i)
+		search.minRemainingCosts[i] = search.minRemainingCosts[i + 1] + search.candidates[i].front().cost;
+	search.occupied.resize(m_tiles.size(), 0);
+	search.chosen.resize(footprints.size(), 0);
+	search.bestCost = std::numeric_limits<float>::max();
+	search.bestGap = maxGap + 1;
+	search.maxGap = maxGap;
+	search.nodes = 0;
+	search.gapComputations = 0;
+	buildFlowGraph(search);
+
+	this->search(search, 0, 0.f, 0);
+	solution.nodes = search.nodes;
+	solution.gapComputations = search.gapComputations;
+	solution.truncated = search.nodes > MaxSearchNodes;
+	if (search.bestGap > maxGap)
+		return false;
+
+	solution.positions.resize(footprints.size());
+	solution.gap = search.bestGap;
+	solution.compactness = 0.f;
+	for (size_t i = 0; i < footprints.size(); ++i)
+	{
+		const auto & candidate = search.candidates[i][search.bestChosen[i]];
+		solution.positions[search.footprintOrder[i]] = CCTilePosition(m_origin.x + candidate.x, m_origin.y + candidate.y);
+		solution.compactness += candidate.cost;
+	}
+	return true;
+}
+
+// Positions where the footprint and its addon are on buildable tiles and the footprint touches a target tile, by their side or corner
+std::vector<WallSolver::Candidate> WallSolver::getCandidates(const WallFootprint & footprint) const
+{
+	CCPosition targetCenter;
+	for (const auto & target : m_targetTiles)
+		targetCenter += CCPosition(target.x + 0.5f, target.y + 0.5f);
+	targetCenter /= float(m_targetTiles.size());
+
+	std::vector<Candidate> candidates;
+	const int width = footprint.size + (footprint.hasAddon ? AddonSize : 0);
+	for (int y = 0; y + footprint.size <= m_height; ++y)
+	{
+		for (int x = 0; x + width <= m_width; ++x)
+		{
+			bool touchesTarget = false;
+			for (const auto & target : m_targetTiles)
+			{
+				if (target.x >= x - 1 && target.x <= x + footprint.size && target.y >= y - 1 && target.y <= y + footprint.size)
+				{
+					touchesTarget = true;
+					break;
+				}
+			}
+			if (!touchesTarget)
+				continue;
+
+			bool buildable = true;
+			for (int j = 0; j < footprint.size && buildable; ++j)
+			{
+				for (int i = 0; i < width && buildable; ++i)
+				{
+					// The addon is at the bottom of the right side
+					if (i >= footprint.size && j >= AddonSize)
+						continue;
+					buildable = m_tiles[index(x + i, y + j)] == TileType::Buildable;
+				}
+			}
+			if (!buildable)
+				continue;
+
+			const float dx = x + footprint.size * 0.5f - targetCenter.x;
+			const float dy = y + footprint.size * 0.5f - targetCenter.y;
+			candidates.push_back({ x, y, dx * dx + dy * dy });
+		}
+	}
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate & a, const Candidate & b) { return a.cost < b.cost; });
+	return candidates;
+}
+
+void WallSolver::search(Search & search, size_t footprintIndex, float cost, size_t firstCandidate) const
+{
+	if (++search.nodes > MaxSearchNodes)
+		return;
+
+	if (footprintIndex == search.footprints.size())
+	{
+		// A building touching nothing is not part of a closed wall, the other buildings close it alone and the walls where it touches them are tried too
+		if (search.maxGap == 0)
+		{
+			for (size_t i = 0; i < search.footprints.size(); ++i)
+			{
+				const auto & candidate = search.candidates[i][search.chosen[i]];
+				if (!touchesWall(search.occupied, candidate.x, candidate.y, search.footprints[i].size))
+					return;
+			}
+		}
+		const int gap = computeGap(search);
+		const float totalCost = gap * GapCost + cost;
+		if (gap <= search.maxGap && totalCost < search.bestCost)
+		{
+			search.bestCost = totalCost;
+			search.bestGap = gap;
+			search.bestChosen = search.chosen;
+		}
+		return;
+	}
+
+	const auto & footprint = search.footprints[footprintIndex];
+	const auto & candidates = search.candidates[footprintIndex];
+	for (size_t c = firstCandidate; c < candidates.size(); ++c)
+	{
+		const auto & candidate = candidates[c];
+		// The candidates are sorted by cost and the gap only adds to it
+		if (cost + candidate.cost + search.minRemainingCosts[footprintIndex + 1] >= search.bestCost)
+			break;
+
+		// The footprint cannot overlap another footprint or an addon space, the addon space can only overlap another addon space
+		bool free = true;
+		for (int j = 0; j < footprint.size && free; ++j)
+		{
+			for (int i = 0; i < footprint.size && free; ++i)
+				free = search.occupied[index(candidate.x + i, candidate.y + j)] == 0;
+			for (int i = 0; footprint.hasAddon && j < AddonSize && i < AddonSize && free; ++i)
+				free = search.occupied[index(candidate.x + footprint.size + i, candidate.y + j)] != 1;
+		}
+		if (!free)
+			continue;
+
+		std::vector<int> addonTiles;
+		for (int j = 0; j < footprint.size; ++j)
+		{
+			for (int i = 0; i < footprint.size; ++i)
+				search.occupied[index(candidate.x + i, candidate.y + j)] = 1;
+			for (int i = 0; footprint.hasAddon && j < AddonSize && i < AddonSize; ++i)
+			{
+				const int addonTile = index(candidate.x + footprint.size + i, candidate.y + j);
+				if (search.occupied[addonTile] == 0)
+				{
+					search.occupied[addonTile] = 2;
+					addonTiles.push_back(addonTile);
+				}
+			}
+		}
+
+		search.chosen[footprintIndex] = c;
+		// Identical footprints are placed in the order of their candidates, the other orders are the same walls
+		const bool nextIsIdentical = footprintIndex + 1 < search.footprints.size()
+			&& search.footprints[footprintIndex + 1].size == footprint.size
+			&& search.footprints[footprintIndex + 1].hasAddon == footprint.hasAddon;
+		this->search(search, footprintIndex + 1, cost + candidate.cost, nextIsIdentical ? c + 1 : 0);
+
+		for (int j = 0; j < footprint.size; ++j)
+		{
+			for (int i = 0; i < footprint.size; ++i)
+				search.occupied[index(candidate.x + i, candidate.y + j)] = 0;
+		}
+		for (const int addonTile : addonTiles)
+			search.occupied[addonTile] = 0;
+
+		if (search.nodes > MaxSearchNodes)
+			return;
+	}
+}
+
+// Footprint tiles of the other buildings or blocked tiles around the footprint, by its side or corner. The edge of the area counts as a wall.
+bool WallSolver::touchesWall(const std::vector<char> & occupied, int x, int y, int size) const
+{
+	for (int j = -1; j <= size; ++j)
+	{
+		for (int i = -1; i <= size; ++i)
+		{
+			if (i >= 0 && i < size && j >= 0 && j < size)
+				continue;
+			if (!isInside(x + i, y + j))
+				return true;
+			const int tile = index(x + i, y + j);
+			if (m_tiles[tile] == TileType::Blocked || occupied[tile] == 1)
+				return true;
+		}
+	}
+	return false;
+}
+
+// Each open tile is split in an entry and an exit node joined by an edge of capacity 1, the outside and inside tiles are not limited
+void WallSolver::buildFlowGraph(Search & search) const
+{
+	const int unlimited = std::numeric_limits<int>::max() / 2;
+	const int tileCount = m_width * m_height;
+	const int source = 2 * tileCount;
+	const int sink = source + 1;
+	search.nodeEdges.assign(sink + 1, std::vector<int>());
+	search.previousEdges.resize(sink + 1);
+	const auto addEdge = [&search](int from, int to, int capacity)
+	{
+		search.nodeEdges[from].push_back(int(search.edges.size()));
+		search.edges.push_back({ to, capacity });
+		search.nodeEdges[to].push_back(int(search.edges.size()));
+		search.edges.push_back({ from, 0 });
+	};
+
+	for (int y = 0; y < m_height; ++y)
+	{
+		for (int x = 0; x < m_width; ++x)
+		{
+			const int tile = index(x, y);
+			if (m_tiles[tile] == TileType::Blocked)
+				continue;
+			const bool isSide = m_outsideTiles[tile] || m_insideTiles[tile];
+			addEdge(2 * tile, 2 * tile + 1, isSide ? unlimited : 1);
+			if (m_outsideTiles[tile])
+				addEdge(source, 2 * tile, unlimited);
+			if (m_insideTiles[tile])
+				addEdge(2 * tile + 1, sink, unlimited);
+			for (int i = 0; i < 4; ++i)
+			{
+				const int nx = x + FourNeighborX[i];
+				const int ny = y + FourNeighborY[i];
+				if (isInside(nx, ny) && m_tiles[index(nx, ny)] != TileType::Blocked)
+					addEdge(2 * tile + 1, 2 * index(nx, ny), unlimited);
+			}
+		}
+	}
+	search.capacities.reserve(search.edges.size());
+	for (const auto & edge : search.edges)
+		search.capacities.push_back(edge.capacity);
+}
+
+// Number of tile disjoint paths from the outside to the inside through the open tiles, stops counting above maxGap
+int WallSolver::computeGap(Search & search) const
+{
+	auto & edges = search.edges;
+	const int source = 2 * m_width * m_height;
+	const int sink = source + 1;
+	for (size_t i = 0; i < edges.size(); ++i)
+		edges[i].capacity = search.capacities[i];
+	++search.gapComputations;
+
+	int flow = 0;
+	while (flow <= search.maxGap)
+	{
+		std::fill(search.previousEdges.begin(), search.previousEdges.end(), -1);
+		search.queue.assign(1, source);
+		for (size_t i = 0; i < search.queue.size() && search.previousEdges[sink] < 0; ++i)
+		{
+			for (const int edge : search.nodeEdges[search.queue[i]])
+			{
+				const int to = edges[edge].to;
+				// The footprint tiles are not in the graph of the current placement
+				if (to < source && search.occupied[to / 2] == 1)
+					continue;
+				if (edges[edge].capacity > 0 && to != source && search.previousEdges[to] < 0)
+				{
+					search.previousEdges[to] = edge;
+					search.queue.push_back(to);
+				}
+			}
+		}
+		if (search.previousEdges[sink] < 0)
+			break;
+		for (int node = sink; node != source; node = edges[search.previousEdges[node] ^ 1].to)
+		{
+			edges[search.previousEdges[node]].capacity -= 1;
+			edges[search.previousEdges[node] ^ 1].capacity += 1;
+		}
+		++flow;
+	}
+	return flow;
+}
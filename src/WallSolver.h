@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Common.h"
+
+struct WallFootprint
+{
+	int size;		// side of the square footprint, 2 for a supply depot and 3 for a barracks
+	bool hasAddon;	// the 2x2 addon space on the right of the footprint has to stay free
+};
+
+struct WallSolution
+{
+	std::vector<CCTilePosition> positions;	// bottom left tile of each footprint, in the order of the footprints
+	int gap;								// smallest number of open tiles separating the two sides
+	float compactness;						// sum of the squared distances of the footprints to the target tiles
+	int nodes;								// placements explored by the search, set even when there is no solution
+	int gapComputations;					// complete placements whose gap was computed
+	bool truncated;							// the node budget ran out, a wall may exist even if none was found
+};
+
+/*
+ * Exact search for the placement of a few buildings that closes a choke. It only knows about tiles, so a fixture of a ramp is enough to run it.
+ * The outside tiles (the ramp) have to be separated from the inside tiles (the edge of the main region around the ramp), the units cannot
+ * walk between two buildings touching by a corner. A wall can leave a gap when the smallest set of open tiles separating the two sides
+ * is not larger than the allowed gap. The walls with the smallest gap are preferred, then the most compact around the target tiles.
+ * The footprints are placed next to the target tiles only and the search is a branch and bound with a node budget. Without an allowed gap,
+ * the buildings touching neither another building nor a blocked tile are not part of the wall and these placements are skipped.
+ */
+class WallSolver
+{
+public:
+
+	enum class TileType : uint8_t
+	{
+		Blocked,
+		Walkable,
+		Buildable
+	};
+
+private:
+
+	struct Candidate
+	{
+		int x;
+		int y;
+		float cost;
+	};
+
+	struct Search;
+
+	CCTilePosition m_origin;
+	int m_width;
+	int m_height;
+	std::vector<TileType> m_tiles;
+	std::vector<bool> m_outsideTiles;
+	std::vector<bool> m_insideTiles;
+	std::vector<CCTilePosition> m_targetTiles;
+
+	const int MaxSearchNodes = 200000;
+	const float GapCost = 1000.f;
+
+	bool isInside(int x, int y) const { return x >= 0 && y >= 0 && x < m_width && y < m_height; }
+	int index(int x, int y) const { return y * m_width + x; }
+	std::vector<Candidate> getCandidates(const WallFootprint & footprint) const;
+	void search(Search & search, size_t footprintIndex, float cost, size_t firstCandidate) const;
+	bool touchesWall(const std::vector<char> & occupied, int x, int y, int size) const;
+	void buildFlowGraph(Search & search) const;
+	int computeGap(Search & search) const;
+
+public:
+
+	WallSolver(const CCTilePosition & origin, int width, int height);
+
+	// The tiles are in map coordinates, the ones outside of the area of the solver are ignored
+	void setTile(const CCTilePosition & tile, TileType type);
+	void addOutsideTile(const CCTilePosition & tile);
+	void addInsideTile(const CCTilePosition & tile);
+	void addTargetTile(const CCTilePosition & tile);
+
+	// Returns false if the footprints cannot close the choke with at most maxGap open tiles
+	bool solve(const std::vector<WallFootprint> & footprints, int maxGap, WallSolution & solution) const;
+};
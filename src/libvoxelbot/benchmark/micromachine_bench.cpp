@@ -0,0 +1,425 @@
+// Offline benchmarks of the libvoxelbot algorithms and of the distance map search, built by the micromachine_bench CMake target.
+// Every benchmark is seeded, so two runs with the same seed do the same work and the JSON results can be compared across commits.
+// Usage: micromachine_bench [--seed N] [--repeat N] [--filter substring] [--output results.json]
+#include "../buildorder/optimizer.h"
+#include "../combat/simulator.h"
+#include "../common/unit_lists.h"
+#include "../utilities/influence.h"
+#include "../utilities/mappings.h"
+#include "../utilities/pathfinding.h"
+#include "../../DistanceMap.h"
+#include "../../json/json.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace sc2;
+
+struct BenchmarkSettings {
+    unsigned int seed = 1234;
+    int repeat = 1;
+    string filter;
+    string output;
+};
+
+struct BenchmarkResult {
+    string name;
+    int iterations = 0;
+    double meanMs = 0;
+    double medianMs = 0;
+    double minMs = 0;
+    double maxMs = 0;
+    // Summary of the outputs, a change means the benchmark did not do the same work as the run it is compared to
+    double checksum = 0;
+};
+
+class BenchmarkRunner {
+    const BenchmarkSettings& settings;
+    vector<BenchmarkResult> results;
+
+   public:
+    BenchmarkRunner(const BenchmarkSettings& settings) : settings(settings) {
+    }
+
+    /** Times the benchmark, it returns its checksum and is given the index of the iteration to derive its seed from */
+    void run(string name, int iterations, const function<double(int)>& benchmark) {
+        if (!settings.filter.empty() && name.find(settings.filter) == string::npos) return;
+
+        iterations *= settings.repeat;
+        BenchmarkResult result;
+        result.name = name;
+        result.iterations = iterations;
+        vector<double> times;
+        for (int i = 0; i < iterations; i++) {
+            // The combat simulator picks some of its targets with rand()
+            srand(settings.seed + i);
+            auto start = chrono::high_resolution_clock::now();
+            result.checksum += benchmark(i);
+            auto end = chrono::high_resolution_clock::now();
+            times.push_back(chrono::duration<double, milli>(end - start).count());
+        }
+
+        sort(times.begin(), times.end());
+        for (double time : times) result.meanMs += time / iterations;
+        result.medianMs = times[times.size() / 2];
+        result.minMs = times.front();
+        result.maxMs = times.back();
+        results.push_back(result);
+        cout << setw(40) << left << name << setw(12) << right << fixed << setprecision(3) << result.meanMs << " ms" << setw(12) << result.medianMs << " ms (median)" << endl;
+    }
+
+    nlohmann::json toJSON() const {
+        nlohmann::json output;
+        output["seed"] = settings.seed;
+        output["repeat"] = settings.repeat;
+        output["results"] = nlohmann::json::array();
+        for (auto& result : results) {
+            output["results"].push_back({
+                { "name", result.name },
+                { "iterations", result.iterations },
+                { "mean_ms", result.meanMs },
+                { "median_ms", result.medianMs },
+                { "min_ms", result.minMs },
+                { "max_ms", result.maxMs },
+                { "checksum", result.checksum },
+            });
+        }
+        return output;
+    }
+};
+
+static CombatState randomArmies(default_random_engine& rnd, int unitsPerPlayer) {
+    const vector<UNIT_TYPEID> terranUnits = { UNIT_TYPEID::TERRAN_MARINE, UNIT_TYPEID::TERRAN_MARAUDER, UNIT_TYPEID::TERRAN_SIEGETANK, UNIT_TYPEID::TERRAN_VIKINGFIGHTER, UNIT_TYPEID::TERRAN_MEDIVAC, UNIT_TYPEID::TERRAN_CYCLONE };
+    const vector<UNIT_TYPEID> zergUnits = { UNIT_TYPEID::ZERG_ZERGLING, UNIT_TYPEID::ZERG_ROACH, UNIT_TYPEID::ZERG_HYDRALISK, UNIT_TYPEID::ZERG_MUTALISK, UNIT_TYPEID::ZERG_BANELING, UNIT_TYPEID::ZERG_QUEEN };
+    CombatState state;
+    for (int i = 0; i < unitsPerPlayer; i++) {
+        state.units.push_back(makeUnit(1, terranUnits[rnd() % terranUnits.size()]));
+        state.units.push_back(makeUnit(2, zergUnits[rnd() % zergUnits.size()]));
+    }
+    return state;
+}
+
+static double healthChecksum(const CombatResult& result) {
+    double sum = result.time;
+    for (auto& unit : result.state.units) sum += unit.health + unit.shield;
+    return sum;
+}
+
+static void benchmarkCombat(BenchmarkRunner& runner, const BenchmarkSettings& settings, const CombatPredictor& predictor) {
+    for (int armySize : { 5, 20, 60 }) {
+        default_random_engine rnd(settings.seed);
+        vector<CombatState> states;
+        for (int i = 0; i < 16; i++) states.push_back(randomArmies(rnd, armySize));
+
+        runner.run("predict_engage " + to_string(armySize) + "v" + to_string(armySize), armySize >= 60 ? 50 : 200, [&](int i) {
+            return healthChecksum(predictor.predict_engage(states[i % states.size()]));
+        });
+    }
+
+    {
+        default_random_engine rnd(settings.seed);
+        CombatState opponent = randomArmies(rnd, 15);
+        opponent.units.erase(remove_if(opponent.units.begin(), opponent.units.end(), [](const CombatUnit& unit) { return unit.owner == 1; }), opponent.units.end());
+        runner.run("findBestCompositionGenetic", 3, [&](int i) {
+            CompositionSearchSettings compositionSettings(predictor, getAvailableUnitsForRace(Race::Terran, UnitCategory::ArmyCompositionOptions));
+            compositionSettings.randomSeed = settings.seed + i;
+            auto composition = findBestCompositionGenetic(opponent, compositionSettings);
+            double sum = 0;
+            for (auto& unitCount : composition.unitCounts) sum += (int)unitCount.first * unitCount.second;
+            return sum;
+        });
+    }
+}
+
+static void benchmarkBuildOrder(BenchmarkRunner& runner, const BenchmarkSettings& settings) {
+    vector<pair<UNIT_TYPEID, int>> startingUnits = { { UNIT_TYPEID::TERRAN_COMMANDCENTER, 1 }, { UNIT_TYPEID::TERRAN_SCV, 12 } };
+    libvoxelbot::BuildState startState(startingUnits);
+    vector<pair<UNIT_TYPEID, int>> target = { { UNIT_TYPEID::TERRAN_MARINE, 8 }, { UNIT_TYPEID::TERRAN_SIEGETANK, 2 }, { UNIT_TYPEID::TERRAN_MEDIVAC, 1 } };
+    runner.run("findBestBuildOrderGenetic", 3, [&](int i) {
+        BuildOptimizerParams params;
+        params.randomSeed = settings.seed + i;
+        auto buildOrder = findBestBuildOrderGenetic(startState, target, nullptr, params);
+        return (double)calculateFitness(startState, buildOrder).time;
+    });
+}
+
+/** The double InfluenceMap the float one replaced: one allocated map per arithmetic operator and scalar loops.
+ * The legacy benchmarks run it on the same inputs, their checksums only differ from the float ones by the rounding.
+ */
+struct LegacyInfluenceMap {
+    vector<double> weights;
+    int w, h;
+
+    LegacyInfluenceMap(int width, int height) : weights(width * height, 0.0), w(width), h(height) {
+    }
+
+    LegacyInfluenceMap operator+(const LegacyInfluenceMap& other) const {
+        auto ret = (*this);
+        for (int i = 0; i < w * h; i++) ret.weights[i] += other.weights[i];
+        return ret;
+    }
+
+    LegacyInfluenceMap operator*(const LegacyInfluenceMap& other) const {
+        auto ret = (*this);
+        for (int i = 0; i < w * h; i++) ret.weights[i] *= other.weights[i];
+        return ret;
+    }
+
+    LegacyInfluenceMap operator*(double factor) const {
+        LegacyInfluenceMap ret(w, h);
+        for (int i = 0; i < w * h; i++) ret.weights[i] = weights[i] * factor;
+        return ret;
+    }
+
+    double sum() const {
+        double ret = 0;
+        for (double weight : weights) ret += weight;
+        return ret;
+    }
+
+    void threshold(double value) {
+        for (int i = 0; i < w * h; i++) weights[i] = weights[i] >= value ? 1 : 0;
+    }
+
+    Point2DI argmax() const {
+        double mx = -100000;
+        Point2DI best(0, 0);
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                if (weights[y * w + x] > mx && isfinite(weights[y * w + x])) {
+                    mx = weights[y * w + x];
+                    best = Point2DI(x, y);
+                }
+            }
+        }
+        return best;
+    }
+
+    void propagateMax(double decay, double speed, const LegacyInfluenceMap& traversable) {
+        static vector<double> newWeights;
+        double factor = 1 - decay;
+        double factor2 = pow(factor, 1.41);
+        newWeights.resize(weights.size());
+        copyBorders();
+        for (int y = 1; y < h - 1; y++) {
+            for (int x = 1; x < w - 1; x++) {
+                int i = y * w + x;
+                if (traversable.weights[i] == 0) {
+                    newWeights[i] = 0;
+                    continue;
+                }
+                double c = 0;
+                c = std::max(c, weights[i]);
+                c = std::max(c, weights[i - 1]);
+                c = std::max(c, weights[i + 1]);
+                c = std::max(c, weights[i - w]);
+                c = std::max(c, weights[i + w]);
+                c *= factor;
+                double c2 = 0;
+                c2 = std::max(c2, weights[i - w - 1]);
+                c2 = std::max(c2, weights[i - w + 1]);
+                c2 = std::max(c2, weights[i + w - 1]);
+                c2 = std::max(c2, weights[i + w + 1]);
+                c2 *= factor2;
+                c = std::max(c, c2);
+                newWeights[i] = c * speed + (1 - speed) * weights[i];
+            }
+        }
+        copyInterior(newWeights);
+    }
+
+    void propagateSum(double decay, double speed, const LegacyInfluenceMap& traversable) {
+        static vector<double> newWeights;
+        double factor = 1 - decay;
+        newWeights.resize(weights.size());
+        copyBorders();
+        for (int y = 1; y < h - 1; y++) {
+            for (int x = 1; x < w - 1; x++) {
+                int i = y * w + x;
+                if (traversable.weights[i] == 0) {
+                    newWeights[i] = 0;
+                    continue;
+                }
+                const auto& t = traversable.weights;
+                double neighbours = 1 + (t[i - 1] + t[i + 1] + t[i - w] + t[i + w]) + 0.75 * (t[i - w - 1] + t[i - w + 1] + t[i + w - 1] + t[i + w + 1]);
+                double c = weights[i - 1] + weights[i + 1] + weights[i - w] + weights[i + w];
+                c += weights[i];
+                c += 0.75 * (weights[i - w - 1] + weights[i - w + 1] + weights[i + w - 1] + weights[i + w + 1]);
+                if (neighbours > 0) c /= neighbours;
+                c = c * speed + (1 - speed) * weights[i];
+                newWeights[i] = c * factor;
+            }
+        }
+        copyInterior(newWeights);
+    }
+
+   private:
+    void copyBorders() {
+        for (int y = 0; y < h; y++) {
+            weights[y * w + 0] = weights[y * w + 1];
+            weights[y * w + w - 1] = weights[y * w + w - 2];
+        }
+        for (int x = 0; x < w; x++) {
+            weights[x] = weights[x + w];
+            weights[(h - 1) * w + x] = weights[(h - 2) * w + x];
+        }
+    }
+
+    // Only the interior is computed, the borders keep the values copied by copyBorders
+    void copyInterior(const vector<double>& newWeights) {
+        for (int y = 1; y < h - 1; y++) {
+            for (int x = 1; x < w - 1; x++) {
+                weights[y * w + x] = newWeights[y * w + x];
+            }
+        }
+    }
+};
+
+static InfluenceMap randomCosts(default_random_engine& rnd, int size) {
+    // Mostly open ground with walls, like the pathable area of a map
+    uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    InfluenceMap costs(size, size);
+    for (auto& cost : costs.weights) cost = distribution(rnd) < 0.2f ? numeric_limits<float>::infinity() : 1 + distribution(rnd) * 4;
+    return costs;
+}
+
+static void benchmarkMaps(BenchmarkRunner& runner, const BenchmarkSettings& settings) {
+    const int size = 200;
+    default_random_engine rnd(settings.seed);
+    uniform_real_distribution<float> distribution(0.0f, 10.0f);
+    InfluenceMap influence(size, size), other(size, size), factors(size, size), traversable(size, size);
+    LegacyInfluenceMap legacyInfluence(size, size), legacyOther(size, size), legacyFactors(size, size), legacyTraversable(size, size);
+    for (int i = 0; i < size * size; i++) {
+        legacyInfluence.weights[i] = influence.weights[i] = distribution(rnd);
+        legacyOther.weights[i] = other.weights[i] = distribution(rnd);
+        legacyFactors.weights[i] = factors.weights[i] = distribution(rnd);
+        legacyTraversable.weights[i] = traversable.weights[i] = distribution(rnd) < 2 ? 0 : 1;
+    }
+
+    // Fused into a single pass over the maps by the expression templates
+    runner.run("InfluenceMap expression 200x200", 2000, [&](int) {
+        InfluenceMap map;
+        map = (influence + other) * factors * 0.5 + influence;
+        return map.sum();
+    });
+    runner.run("InfluenceMap::threshold 200x200", 2000, [&](int) {
+        InfluenceMap map = influence;
+        map.threshold(5);
+        return map.sum();
+    });
+    runner.run("InfluenceMap::argmax 200x200", 2000, [&](int) {
+        auto best = influence.argmax();
+        return (double)(best.x + best.y * size);
+    });
+
+    runner.run("InfluenceMap::propagateMax 200x200", 200, [&](int) {
+        InfluenceMap map = influence;
+        map.propagateMax(0.1f, 0.5f, traversable);
+        return map.sum();
+    });
+    runner.run("InfluenceMap::propagateSum 200x200", 200, [&](int) {
+        InfluenceMap map = influence;
+        map.propagateSum(0.1f, 0.5f, traversable);
+        return map.sum();
+    });
+
+    // The same operations with the double implementation, to compare with the float one
+    runner.run("LegacyInfluenceMap expression 200x200", 2000, [&](int) {
+        LegacyInfluenceMap map(size, size);
+        map = (legacyInfluence + legacyOther) * legacyFactors * 0.5 + legacyInfluence;
+        return map.sum();
+    });
+    runner.run("LegacyInfluenceMap::threshold 200x200", 2000, [&](int) {
+        LegacyInfluenceMap map = legacyInfluence;
+        map.threshold(5);
+        return map.sum();
+    });
+    runner.run("LegacyInfluenceMap::argmax 200x200", 2000, [&](int) {
+        auto best = legacyInfluence.argmax();
+        return (double)(best.x + best.y * size);
+    });
+    runner.run("LegacyInfluenceMap::propagateMax 200x200", 200, [&](int) {
+        LegacyInfluenceMap map = legacyInfluence;
+        map.propagateMax(0.1, 0.5, legacyTraversable);
+        return map.sum();
+    });
+    runner.run("LegacyInfluenceMap::propagateSum 200x200", 200, [&](int) {
+        LegacyInfluenceMap map = legacyInfluence;
+        map.propagateSum(0.1, 0.5, legacyTraversable);
+        return map.sum();
+    });
+
+    InfluenceMap costs = randomCosts(rnd, size);
+    vector<pair<Point2DI, Point2DI>> queries;
+    uniform_int_distribution<int> coordinate(0, size - 1);
+    while (queries.size() < 64) {
+        Point2DI from(coordinate(rnd), coordinate(rnd)), to(coordinate(rnd), coordinate(rnd));
+        if (isfinite(costs(from)) && isfinite(costs(to))) queries.push_back(make_pair(from, to));
+    }
+    runner.run("getPath 200x200", 200, [&](int i) {
+        return (double)getPath(queries[i % queries.size()].first, queries[i % queries.size()].second, costs).size();
+    });
+    runner.run("getDistances 200x200", 100, [&](int i) {
+        return getDistances(vector<Point2DI>{ queries[i % queries.size()].first }, costs).maxFinite();
+    });
+
+    // The wavefront used by DistanceMap::computeDistanceMap and MapTools::computeConnectivity
+    TileBitmask walkable(size, size);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            if (isfinite(costs(x, y))) walkable.set(x, y);
+        }
+    }
+    runner.run("DistanceMap wavefront 200x200", 200, [&](int i) {
+        WalkableWavefront wavefront(walkable);
+        auto start = queries[i % queries.size()].first;
+        wavefront.addStart(start.x, start.y);
+        double sum = 0;
+        int distance = 1;
+        auto visit = [&](int, int) { sum += distance; };
+        while (wavefront.step(visit)) distance++;
+        return sum;
+    });
+}
+
+int main(int argc, char** argv) {
+    BenchmarkSettings settings;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--seed" && i + 1 < argc) settings.seed = (unsigned int)stoul(argv[++i]);
+        else if (arg == "--repeat" && i + 1 < argc) settings.repeat = max(1, stoi(argv[++i]));
+        else if (arg == "--filter" && i + 1 < argc) settings.filter = argv[++i];
+        else if (arg == "--output" && i + 1 < argc) settings.output = argv[++i];
+        else {
+            cerr << "Usage: " << argv[0] << " [--seed N] [--repeat N] [--filter substring] [--output results.json]" << endl;
+            return 1;
+        }
+    }
+
+    initMappings();
+    CombatPredictor predictor;
+    predictor.init();
+
+    BenchmarkRunner runner(settings);
+    benchmarkCombat(runner, settings, predictor);
+    benchmarkBuildOrder(runner, settings);
+    benchmarkMaps(runner, settings);
+
+    auto results = runner.toJSON();
+    if (settings.output.empty()) {
+        cout << results.dump(4) << endl;
+    } else {
+        ofstream output(settings.output);
+        output << results.dump(4) << endl;
+    }
+    return 0;
+}
@@ -888,8 +888,7 @@ std::pair<libvoxelbot::BuildOrder, BuildOrderFitness> findBestBuildOrderGeneticW
     float lastBestFitness = -100000000000;
 
     vector<BuildOrderGene> generation(params.genePoolSize);
-    default_random_engine rnd(time(0));
-    // default_random_engine rnd(rand());
+    default_random_engine rnd(params.randomSeed != 0 ? params.randomSeed : (unsigned int)time(0));
     for (auto& gene : generation) {
         gene = BuildOrderGene(rnd, actionRequirements);
         gene.validate(actionRequirements);
@@ -44,6 +44,8 @@ struct BuildOptimizerParams {
     float mutationRateMove = 0.025f;
     float varianceBias = 0;
     bool allowChronoBoost = true;
+    // Seed of the genetic search, 0 seeds it with the current time
+    unsigned int randomSeed = 0;
 };
 
 std::pair<libvoxelbot::BuildOrder, std::vector<bool>> expandBuildOrderWithImplicitSteps (const libvoxelbot::BuildState& startState, libvoxelbot::BuildOrder buildOrder);
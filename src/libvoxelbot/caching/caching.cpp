@@ -174,7 +174,7 @@ class CachingBot : public sc2::Agent {
 
             // Try loading and re-saving the data to make sure that everything is loaded correctly
             int hash = hashFile(UNIT_DATA_CACHE_PATH);
-            auto unit_types2 = load_unit_data();
+            auto unit_types2 = load_unit_data(UNIT_DATA_CACHE_PATH);
             save_unit_data(unit_types2, "/tmp/unit_data.data");
             int hash2 = hashFile("/tmp/unit_data.data");
             if (hash != hash2) {
@@ -186,8 +186,9 @@ class CachingBot : public sc2::Agent {
             writeUnitTypeOverview(unit_lookup2, unit_types2, deps);
             unit_lookup2.close();
 
-            save_ability_data(Observation()->GetAbilityData());
-            save_upgrade_data(Observation()->GetUpgradeData());
+            save_unit_table(unit_types);
+            save_ability_table(Observation()->GetAbilityData());
+            save_upgrade_table(Observation()->GetUpgradeData());
         } else {
             cerr << "Note: run program again with 'pass2' as an argument on the commandline to get the correct output" << endl;
 
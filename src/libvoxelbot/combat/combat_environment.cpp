@@ -2,6 +2,7 @@
 #include "simulator.h"
 #include "../utilities/predicates.h"
 #include <iostream>
+#include <algorithm>
 
 using namespace std;
 using namespace sc2;
@@ -138,6 +139,12 @@ CombatEnvironment::CombatEnvironment(const CombatUpgrades& upgrades, const Comba
         combatInfo[owner][(int)UNIT_TYPEID::PROTOSS_ARCHON].groundWeapon.splash = 3;
         combatInfo[owner][(int)UNIT_TYPEID::PROTOSS_ARCHON].airWeapon.splash = 3;
         combatInfo[owner][(int)UNIT_TYPEID::PROTOSS_COLOSSUS].groundWeapon.splash = 3;
+
+        attackRanges[owner].resize(unitTypes.size());
+        for (size_t i = 0; i < unitTypes.size(); i++) {
+            attackRanges[owner][i] = attackRange(owner + 1, (UNIT_TYPEID)i);
+        }
+        if (this->upgrades[owner].hasUpgrade(UPGRADE_ID::EXTENDEDTHERMALLANCE)) attackRanges[owner][(int)UNIT_TYPEID::PROTOSS_COLOSSUS] += 2;
     }
 }
 
@@ -150,15 +157,37 @@ const CombatEnvironment& CombatPredictor::combineCombatEnvironment(const CombatE
     return getCombatEnvironment(newUpgrades[0], newUpgrades[1]);
 }
 
+static vector<pair<uint64_t, const CombatEnvironment*>>::const_iterator lowerBoundCombatEnvironment(const vector<pair<uint64_t, const CombatEnvironment*>>& environments, uint64_t hash) {
+    return lower_bound(environments.begin(), environments.end(), hash, [](const pair<uint64_t, const CombatEnvironment*>& entry, uint64_t hash) { return entry.first < hash; });
+}
+
+static const CombatEnvironment* findCombatEnvironment(const vector<pair<uint64_t, const CombatEnvironment*>>& environments, uint64_t hash) {
+    auto it = lowerBoundCombatEnvironment(environments, hash);
+    return it != environments.end() && it->first == hash ? it->second : nullptr;
+}
+
 const CombatEnvironment& CombatPredictor::getCombatEnvironment(const CombatUpgrades& upgrades, const CombatUpgrades& targetUpgrades) const {
     uint64_t hash = (upgrades.hash() * 5123143) ^ targetUpgrades.hash();
-    auto it = combatEnvironments.find(hash);
-    if (it != combatEnvironments.end()) {
-        return (*it).second;
-    }
 
-    // Note: references to map values are guaranteed to remain valid even after additional insertion into the map
-    return (*combatEnvironments.emplace(make_pair(hash, CombatEnvironment(upgrades, targetUpgrades))).first).second;
+    // Lock-free path: published tables are never modified, so this can run concurrently with an insertion
+    auto env = findCombatEnvironment(combatEnvironmentTable.load(memory_order_acquire)->environments, hash);
+    if (env != nullptr) return *env;
+
+    lock_guard<mutex> lock(combatEnvironmentsMutex);
+    // Another thread may have created the environment while we were waiting for the lock
+    auto table = combatEnvironmentTable.load(memory_order_relaxed);
+    env = findCombatEnvironment(table->environments, hash);
+    if (env != nullptr) return *env;
+
+    combatEnvironments.emplace_back(new CombatEnvironment(upgrades, targetUpgrades));
+    env = combatEnvironments.back().get();
+
+    // Publish a copy of the table with the new environment. The old table is kept alive since other threads may still be reading it.
+    auto newTable = new CombatEnvironmentTable(*table);
+    newTable->environments.insert(newTable->environments.begin() + (lowerBoundCombatEnvironment(table->environments, hash) - table->environments.begin()), make_pair(hash, env));
+    combatEnvironmentTables.emplace_back(newTable);
+    combatEnvironmentTable.store(newTable, memory_order_release);
+    return *env;
 }
 
 // TODO: Air?
@@ -168,12 +197,7 @@ float CombatEnvironment::attackRange(int owner, UNIT_TYPEID type) const {
 }
 
 float CombatEnvironment::attackRange(const CombatUnit& unit) const {
-    auto& info = combatInfo[unit.owner - 1][(int)unit.type];
-    float range = max(info.airWeapon.range(), info.groundWeapon.range());
-
-    if (unit.type == UNIT_TYPEID::PROTOSS_COLOSSUS && upgrades[unit.owner-1].hasUpgrade(UPGRADE_ID::EXTENDEDTHERMALLANCE)) range += 2;
-
-    return range;
+    return attackRanges[unit.owner - 1][(int)unit.type];
 }
 
 const UnitCombatInfo& CombatEnvironment::getCombatInfo(const CombatUnit& unit) const {
@@ -235,9 +259,9 @@ float WeaponInfo::getDPS(UNIT_TYPEID target, float modifier) const {
     if (!available || !weapon || weapon->speed == 0)
         return 0;
 
-	if (dpsCache.find(unsigned(target)) == dpsCache.end()) {
-		cerr << "CombatSimulator error: dpsCache does not contain unit of type " << unsigned(target) << " named " << UnitTypeToName(target) << endl;
-		dpsCache[unsigned(target)] = 0;
+    if (unsigned(target) >= dpsCache.size()) {
+        cerr << "CombatSimulator error: dpsCache does not contain unit of type " << unsigned(target) << " named " << UnitTypeToName(target) << endl;
+        return 0;
     }
 
     // TODO: Modifier ignores speed upgrades
@@ -264,6 +288,7 @@ WeaponInfo::WeaponInfo(const Weapon* weapon, UNIT_TYPEID type, const CombatUpgra
     baseDPS = (weapon->damage_ + getDamageBonus(type, upgrades)) * weapon->attacks / weapon->speed;
 
     auto& unitTypes = getUnitTypes();
+    dpsCache.resize(unitTypes.size());
     for (size_t i = 0; i < unitTypes.size(); i++) {
         dpsCache[i] = calculateDPS(type, UNIT_TYPEID(i), *weapon, upgrades, targetUpgrades);
     }
@@ -9,7 +9,8 @@ struct CombatUnit;
 
 struct WeaponInfo {
    private:
-    mutable std::map<unsigned, float> dpsCache;
+    // DPS against every unit type indexed by the target type, built eagerly so that lookups never modify the weapon
+    std::vector<float> dpsCache;
     float baseDPS;
 
    public:
@@ -45,6 +46,8 @@ struct UnitCombatInfo {
 struct CombatEnvironment {
 	std::array<std::vector<UnitCombatInfo>, 2> combatInfo;
 	std::array<CombatUpgrades, 2> upgrades;
+	// Attack range of every unit type for each owner, including range upgrades
+	std::array<std::vector<float>, 2> attackRanges;
 
 	CombatEnvironment(const CombatUpgrades& upgrades, const CombatUpgrades& targetUpgrades);
 
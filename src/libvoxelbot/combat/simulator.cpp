@@ -141,7 +141,9 @@ void CombatRecorder::finalize(string filename) {
     recording.writeCSV(filename);
 };
 
-CombatPredictor::CombatPredictor() : defaultCombatEnvironment({}, {}) {    
+CombatPredictor::CombatPredictor() : defaultCombatEnvironment({}, {}) {
+    combatEnvironmentTables.emplace_back(new CombatEnvironmentTable());
+    combatEnvironmentTable.store(combatEnvironmentTables.back().get());
 }
 
 void CombatPredictor::init() {
@@ -1234,7 +1236,7 @@ ArmyComposition findBestCompositionGenetic(const CombatState& opponent, Composit
     const int POOL_SIZE = 20;
     const float mutationRate = 0.2f;
     vector<CompositionGene> generation(POOL_SIZE);
-    default_random_engine rnd(micros());
+    default_random_engine rnd(settings.randomSeed != 0 ? settings.randomSeed : (unsigned int)micros());
     for (auto& gene : generation) {
         gene = CompositionGene(availableUnitTypes, 10, rnd);
 
@@ -6,6 +6,9 @@
 #include <limits>
 #include <vector>
 #include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include "../utilities/mappings.h"
 #include "combat_upgrades.h"
 
@@ -86,7 +89,17 @@ struct CombatSettings {
 
 struct CombatPredictor {
 private:
-	mutable std::map<uint64_t, CombatEnvironment> combatEnvironments;
+	// Immutable snapshot of the cached environments sorted by upgrade hash
+	struct CombatEnvironmentTable {
+		std::vector<std::pair<uint64_t, const CombatEnvironment*>> environments;
+	};
+
+	// Readers only load the current table, a new table is published when an environment is created.
+	// Environments and tables are never freed while the predictor is alive so that references stay valid.
+	mutable std::atomic<const CombatEnvironmentTable*> combatEnvironmentTable;
+	mutable std::mutex combatEnvironmentsMutex;
+	mutable std::vector<std::unique_ptr<CombatEnvironment>> combatEnvironments;
+	mutable std::vector<std::unique_ptr<CombatEnvironmentTable>> combatEnvironmentTables;
 public:
 	CombatEnvironment defaultCombatEnvironment;
 	CombatPredictor();
@@ -133,6 +146,8 @@ struct CompositionSearchSettings {
 	const AvailableUnitTypes& availableUnitTypes;
 	const BuildOptimizerNN* buildTimePredictor = nullptr;
 	float availableTime = 4 * 60;
+	// Seed of the genetic search, 0 seeds it with the current time
+	unsigned int randomSeed = 0;
 
 	CompositionSearchSettings(const CombatPredictor& combatPredictor, const AvailableUnitTypes& availableUnitTypes, const BuildOptimizerNN* buildTimePredictor = nullptr) : combatPredictor(combatPredictor), availableUnitTypes(availableUnitTypes), buildTimePredictor(buildTimePredictor) {}
 };
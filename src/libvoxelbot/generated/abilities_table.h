@@ -0,0 +1,4539 @@
+// Generated by save_ability_table in libvoxelbot/utilities/unit_data_caching.cpp, do not edit.
+#pragma once
+#include "../utilities/unit_data_tables.h"
+
+const AbilityRecord LIBVOXELBOT_TABLE_ABILITIES[] = {
+    { true, 0, "Null", 255, "", "", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1, "", 255, "Smart", "Smart", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 2, "Taunt", 0, "Taunt", "Effect Taunt", "Q", 0, 0, 0, 4, false, false, false, 0.0f, false, 10.0f },
+    { true, 3, "Taunt", 1, "", "Taunt_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 4, "stop", 0, "Stop", "Stop Stop", "W", 3665, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 5, "stop", 1, "HoldFireSpecial", "Stop HoldFireSpecial", "", 3665, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 6, "stop", 2, "Cheer", "Stop Cheer", "", 3665, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 7, "stop", 3, "Dance", "Stop Dance", "", 3665, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 8, "stop", 4, "", "stop_4", "", 3665, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 9, "stop", 5, "", "stop_5", "", 3665, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { false, 10, "HoldFire", 0, "StopSpecial", "Stop StopSpecial", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 11, "HoldFire", 1, "HoldFire", "Stop HoldFire", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 12, "HoldFire", 2, "", "HoldFire_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 13, "HoldFire", 3, "", "HoldFire_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 14, "HoldFire", 4, "", "HoldFire_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 15, "HoldFire", 5, "", "HoldFire_5", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 16, "move", 0, "Move", "Move", "Q", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 17, "move", 1, "MovePatrol", "Patrol", "R", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 18, "move", 2, "MoveHoldPosition", "HoldPosition", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 19, "move", 3, "AcquireMove", "Scan Move", "T", 3674, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 20, "move", 4, "Turn", "Move Turn", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { false, 21, "Beacon", 0, "Cancel", "Beacon_0", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 22, "Beacon", 1, "BeaconMove", "Beacon_1", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 23, "attack", 0, "Attack", "Attack Attack", "T", 3674, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 24, "attack", 1, "AttackTowards", "Attack AttackTowards", "", 0, 0, 0, 2, true, false, false, 0.0f, false, 0.0f },
+    { true, 25, "attack", 2, "AttackBarrage", "Attack AttackBarrage", "", 0, 0, 0, 2, true, false, false, 0.0f, false, 0.0f },
+    { true, 26, "SprayTerran", 0, "Spray", "Effect Spray Terran", "V", 3684, 0, 0, 2, false, false, false, 0.0f, false, 1.0f },
+    { true, 27, "SprayTerran", 1, "", "SprayTerran_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 28, "SprayZerg", 0, "Spray", "Effect Spray Zerg", "C", 3684, 0, 0, 2, false, false, false, 0.0f, false, 1.0f },
+    { true, 29, "SprayZerg", 1, "", "SprayZerg_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 30, "SprayProtoss", 0, "Spray", "Effect Spray Protoss", "V", 3684, 0, 0, 2, false, false, false, 0.0f, false, 1.0f },
+    { true, 31, "SprayProtoss", 1, "", "SprayProtoss_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 32, "SalvageShared", 0, "Salvage", "Effect Salvage", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 33, "SalvageShared", 1, "", "SalvageShared_1", "B", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 34, "Corruption", 0, "CorruptionAbility", "Effect CorruptionAbility", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 6.0f },
+    { false, 35, "Corruption", 1, "Cancel", "Corruption_1", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 36, "GhostHoldFire", 0, "HoldFire", "Behavior HoldFireOn Ghost", "D", 3688, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 37, "GhostHoldFire", 1, "", "GhostHoldFire_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 38, "GhostWeaponsFree", 0, "WeaponsFree", "Behavior HoldFireOff Ghost", "F", 3689, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 39, "GhostWeaponsFree", 1, "", "GhostWeaponsFree_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 40, "MorphToInfestedTerran", 0, "InfestedTerrans", "Morph InfestedTerrans", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 41, "MorphToInfestedTerran", 1, "", "MorphToInfestedTerran_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 42, "Explode", 0, "Explode", "Effect Explode", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 43, "Explode", 1, "", "Explode_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 44, "FleetBeaconResearch", 0, "ResearchInterceptorLaunchSpeedUpgrade", "Research InterceptorGravitonCatapult", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 45, "FleetBeaconResearch", 1, "ResearchInterceptorLaunchSpeedUpgrade", "Research ResearchInterceptorLaunchSpeedUpgrade", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 46, "FleetBeaconResearch", 2, "PhoenixRangeUpgrade", "Research PhoenixAnionPulseCrystals", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 47, "FleetBeaconResearch", 3, "TempestRangeUpgrade", "Research TempestRangeUpgrade", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 48, "FleetBeaconResearch", 4, "", "FleetBeaconResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 49, "FleetBeaconResearch", 5, "", "FleetBeaconResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 50, "FleetBeaconResearch", 6, "", "FleetBeaconResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 51, "FleetBeaconResearch", 7, "", "FleetBeaconResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 52, "FleetBeaconResearch", 8, "", "FleetBeaconResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 53, "FleetBeaconResearch", 9, "", "FleetBeaconResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 54, "FleetBeaconResearch", 10, "", "FleetBeaconResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 55, "FleetBeaconResearch", 11, "", "FleetBeaconResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 56, "FleetBeaconResearch", 12, "", "FleetBeaconResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 57, "FleetBeaconResearch", 13, "", "FleetBeaconResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 58, "FleetBeaconResearch", 14, "", "FleetBeaconResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 59, "FleetBeaconResearch", 15, "", "FleetBeaconResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 60, "FleetBeaconResearch", 16, "", "FleetBeaconResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 61, "FleetBeaconResearch", 17, "", "FleetBeaconResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 62, "FleetBeaconResearch", 18, "", "FleetBeaconResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 63, "FleetBeaconResearch", 19, "", "FleetBeaconResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 64, "FleetBeaconResearch", 20, "", "FleetBeaconResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 65, "FleetBeaconResearch", 21, "", "FleetBeaconResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 66, "FleetBeaconResearch", 22, "", "FleetBeaconResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 67, "FleetBeaconResearch", 23, "", "FleetBeaconResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 68, "FleetBeaconResearch", 24, "", "FleetBeaconResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 69, "FleetBeaconResearch", 25, "", "FleetBeaconResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 70, "FleetBeaconResearch", 26, "", "FleetBeaconResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 71, "FleetBeaconResearch", 27, "", "FleetBeaconResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 72, "FleetBeaconResearch", 28, "", "FleetBeaconResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 73, "FleetBeaconResearch", 29, "", "FleetBeaconResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 74, "FungalGrowth", 0, "FungalGrowth", "Effect FungalGrowth", "X", 0, 0, 0, 2, false, false, false, 0.0f, false, 10.0f },
+    { true, 75, "FungalGrowth", 1, "", "FungalGrowth_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 76, "GuardianShield", 0, "GuardianShield", "Effect GuardianShield", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 77, "GuardianShield", 1, "", "GuardianShield_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 78, "MULERepair", 0, "Repair", "Effect Repair Mule", "C", 3685, 0, 0, 3, false, true, false, 0.0f, false, 0.0f },
+    { true, 79, "MULERepair", 1, "", "MULERepair_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 80, "MorphZerglingToBaneling", 0, "Baneling", "Train Baneling", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 81, "MorphZerglingToBaneling", 1, "", "MorphZerglingToBaneling_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 82, "MorphZerglingToBaneling", 2, "", "MorphZerglingToBaneling_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 83, "MorphZerglingToBaneling", 3, "", "MorphZerglingToBaneling_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 84, "MorphZerglingToBaneling", 4, "", "MorphZerglingToBaneling_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 85, "MorphZerglingToBaneling", 5, "", "MorphZerglingToBaneling_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 86, "MorphZerglingToBaneling", 6, "", "MorphZerglingToBaneling_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 87, "MorphZerglingToBaneling", 7, "", "MorphZerglingToBaneling_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 88, "MorphZerglingToBaneling", 8, "", "MorphZerglingToBaneling_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 89, "MorphZerglingToBaneling", 9, "", "MorphZerglingToBaneling_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 90, "MorphZerglingToBaneling", 10, "", "MorphZerglingToBaneling_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 91, "MorphZerglingToBaneling", 11, "", "MorphZerglingToBaneling_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 92, "MorphZerglingToBaneling", 12, "", "MorphZerglingToBaneling_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 93, "MorphZerglingToBaneling", 13, "", "MorphZerglingToBaneling_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 94, "MorphZerglingToBaneling", 14, "", "MorphZerglingToBaneling_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 95, "MorphZerglingToBaneling", 15, "", "MorphZerglingToBaneling_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 96, "MorphZerglingToBaneling", 16, "", "MorphZerglingToBaneling_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 97, "MorphZerglingToBaneling", 17, "", "MorphZerglingToBaneling_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 98, "MorphZerglingToBaneling", 18, "", "MorphZerglingToBaneling_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 99, "MorphZerglingToBaneling", 19, "", "MorphZerglingToBaneling_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 100, "MorphZerglingToBaneling", 20, "", "MorphZerglingToBaneling_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 101, "MorphZerglingToBaneling", 21, "", "MorphZerglingToBaneling_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 102, "MorphZerglingToBaneling", 22, "", "MorphZerglingToBaneling_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 103, "MorphZerglingToBaneling", 23, "", "MorphZerglingToBaneling_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 104, "MorphZerglingToBaneling", 24, "", "MorphZerglingToBaneling_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 105, "MorphZerglingToBaneling", 25, "", "MorphZerglingToBaneling_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 106, "MorphZerglingToBaneling", 26, "", "MorphZerglingToBaneling_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 107, "MorphZerglingToBaneling", 27, "", "MorphZerglingToBaneling_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 108, "MorphZerglingToBaneling", 28, "", "MorphZerglingToBaneling_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 109, "MorphZerglingToBaneling", 29, "", "MorphZerglingToBaneling_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 110, "NexusTrainMothership", 0, "Mothership", "Train Mothership", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 111, "NexusTrainMothership", 1, "", "NexusTrainMothership_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 112, "NexusTrainMothership", 2, "", "NexusTrainMothership_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 113, "NexusTrainMothership", 3, "", "NexusTrainMothership_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 114, "NexusTrainMothership", 4, "", "NexusTrainMothership_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 115, "NexusTrainMothership", 5, "", "NexusTrainMothership_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 116, "NexusTrainMothership", 6, "", "NexusTrainMothership_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 117, "NexusTrainMothership", 7, "", "NexusTrainMothership_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 118, "NexusTrainMothership", 8, "", "NexusTrainMothership_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 119, "NexusTrainMothership", 9, "", "NexusTrainMothership_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 120, "NexusTrainMothership", 10, "", "NexusTrainMothership_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 121, "NexusTrainMothership", 11, "", "NexusTrainMothership_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 122, "NexusTrainMothership", 12, "", "NexusTrainMothership_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 123, "NexusTrainMothership", 13, "", "NexusTrainMothership_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 124, "NexusTrainMothership", 14, "", "NexusTrainMothership_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 125, "NexusTrainMothership", 15, "", "NexusTrainMothership_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 126, "NexusTrainMothership", 16, "", "NexusTrainMothership_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 127, "NexusTrainMothership", 17, "", "NexusTrainMothership_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 128, "NexusTrainMothership", 18, "", "NexusTrainMothership_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 129, "NexusTrainMothership", 19, "", "NexusTrainMothership_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 130, "NexusTrainMothership", 20, "", "NexusTrainMothership_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 131, "NexusTrainMothership", 21, "", "NexusTrainMothership_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 132, "NexusTrainMothership", 22, "", "NexusTrainMothership_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 133, "NexusTrainMothership", 23, "", "NexusTrainMothership_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 134, "NexusTrainMothership", 24, "", "NexusTrainMothership_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 135, "NexusTrainMothership", 25, "", "NexusTrainMothership_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 136, "NexusTrainMothership", 26, "", "NexusTrainMothership_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 137, "NexusTrainMothership", 27, "", "NexusTrainMothership_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 138, "NexusTrainMothership", 28, "", "NexusTrainMothership_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 139, "NexusTrainMothership", 29, "", "NexusTrainMothership_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 140, "Feedback", 0, "Feedback", "Effect Feedback", "Z", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { true, 141, "Feedback", 1, "", "Feedback_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 142, "MassRecall", 0, "MassRecall", "Effect MassRecall", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 143, "MassRecall", 1, "", "MassRecall_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 144, "PlacePointDefenseDrone", 0, "PointDefenseDrone", "Effect PointDefenseDrone", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 3.0f },
+    { false, 145, "PlacePointDefenseDrone", 1, "", "PlacePointDefenseDrone_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 146, "HallucinationArchon", 0, "Archon", "Hallucination Archon", "CS", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 147, "HallucinationArchon", 1, "", "HallucinationArchon_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 148, "HallucinationColossus", 0, "Colossus", "Hallucination Colossus", "CC", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 149, "HallucinationColossus", 1, "", "HallucinationColossus_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 150, "HallucinationHighTemplar", 0, "HighTemplar", "Hallucination HighTemplar", "CA", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 151, "HallucinationHighTemplar", 1, "", "HallucinationHighTemplar_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 152, "HallucinationImmortal", 0, "Immortal", "Hallucination Immortal", "CT", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 153, "HallucinationImmortal", 1, "", "HallucinationImmortal_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 154, "HallucinationPhoenix", 0, "Phoenix", "Hallucination Phoenix", "CF", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 155, "HallucinationPhoenix", 1, "", "HallucinationPhoenix_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 156, "HallucinationProbe", 0, "Probe", "Hallucination Probe", "CQ", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 157, "HallucinationProbe", 1, "", "HallucinationProbe_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 158, "HallucinationStalker", 0, "Stalker", "Hallucination Stalker", "CR", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 159, "HallucinationStalker", 1, "", "HallucinationStalker_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 160, "HallucinationVoidRay", 0, "VoidRay", "Hallucination VoidRay", "CD", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 161, "HallucinationVoidRay", 1, "", "HallucinationVoidRay_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 162, "HallucinationWarpPrism", 0, "WarpPrism", "Hallucination WarpPrism", "CZ", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 163, "HallucinationWarpPrism", 1, "", "HallucinationWarpPrism_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 164, "HallucinationZealot", 0, "Zealot", "Hallucination Zealot", "CW", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 165, "HallucinationZealot", 1, "", "HallucinationZealot_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 166, "MULEGather", 0, "GatherMULE", "Harvest Gather Mule", "A", 3666, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 167, "MULEGather", 1, "ReturnCargo", "Harvest Return Mule", "S", 3667, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 168, "MULEGather", 2, "", "MULEGather_2", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 169, "SeekerMissile", 0, "HunterSeekerMissile", "Effect HunterSeekerMissile", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { false, 170, "SeekerMissile", 1, "", "SeekerMissile_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 171, "CalldownMULE", 0, "CalldownMULE", "Effect CalldownMULE", "Z", 0, 0, 0, 4, false, false, false, 0.0f, false, 500.0f },
+    { true, 172, "CalldownMULE", 1, "", "CalldownMULE_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 173, "GravitonBeam", 0, "GravitonBeam", "Effect GravitonBeam", "Z", 0, 0, 0, 3, false, false, false, 0.0f, false, 4.0f },
+    { true, 174, "GravitonBeam", 1, "Cancel", "Cancel GravitonBeam", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 175, "BuildinProgressNydusCanal", 0, "Cancel", "BuildinProgressNydusCanal_0", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 176, "BuildinProgressNydusCanal", 1, "Cancel", "BuildinProgressNydusCanal_1", "", 3660, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 177, "Siphon", 0, "Siphon", "Effect Siphon", "", 0, 0, 0, 1, false, true, false, 0.0f, false, 9.0f },
+    { false, 178, "Siphon", 1, "Cancel", "Siphon_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 179, "Leech", 0, "Leech", "Effect Leech", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { false, 180, "Leech", 1, "", "Leech_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 181, "SpawnChangeling", 0, "SpawnChangeling", "Effect SpawnChangeling", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 182, "SpawnChangeling", 1, "", "SpawnChangeling_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 183, "DisguiseAsZealot", 0, "Zealot", "Morph Zealot", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 184, "DisguiseAsZealot", 1, "", "DisguiseAsZealot_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 185, "DisguiseAsMarineWithShield", 0, "Marine", "Morph Marine", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 186, "DisguiseAsMarineWithShield", 1, "", "DisguiseAsMarineWithShield_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 187, "DisguiseAsMarineWithoutShield", 0, "Marine", "Morph Marine", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 188, "DisguiseAsMarineWithoutShield", 1, "", "DisguiseAsMarineWithoutShield_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 189, "DisguiseAsZerglingWithWings", 0, "Zergling", "Morph Zergling", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 190, "DisguiseAsZerglingWithWings", 1, "", "DisguiseAsZerglingWithWings_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 191, "DisguiseAsZerglingWithoutWings", 0, "Zergling", "Morph Zergling", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 192, "DisguiseAsZerglingWithoutWings", 1, "", "DisguiseAsZerglingWithoutWings_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 193, "PhaseShift", 0, "PhaseShift", "Effect PhaseShift", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 9.0f },
+    { false, 194, "PhaseShift", 1, "", "PhaseShift_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 195, "Rally", 0, "Rally", "Rally Building", "B", 3673, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 196, "Rally", 1, "", "Rally_1", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 197, "Rally", 2, "", "Rally_2", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 198, "Rally", 3, "", "Rally_3", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 199, "ProgressRally", 0, "Rally", "Rally Morphing Unit", "B", 3673, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 200, "ProgressRally", 1, "", "ProgressRally_1", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 201, "ProgressRally", 2, "", "ProgressRally_2", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 202, "ProgressRally", 3, "", "ProgressRally_3", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 203, "RallyCommand", 0, "Rally", "Rally CommandCenter", "G", 3690, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 204, "RallyCommand", 1, "", "RallyCommand_1", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 205, "RallyCommand", 2, "", "RallyCommand_2", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 206, "RallyCommand", 3, "", "RallyCommand_3", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 207, "RallyNexus", 0, "Rally", "Rally Nexus", "G", 3690, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 208, "RallyNexus", 1, "", "RallyNexus_1", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 209, "RallyNexus", 2, "", "RallyNexus_2", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 210, "RallyNexus", 3, "", "RallyNexus_3", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 211, "RallyHatchery", 0, "Rally", "Rally Hatchery Units", "G", 3673, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 212, "RallyHatchery", 1, "", "Rally Hatchery Workers", "F", 3690, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 213, "RallyHatchery", 2, "", "RallyHatchery_2", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 214, "RallyHatchery", 3, "", "RallyHatchery_3", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 215, "RoachWarrenResearch", 0, "", "RoachWarrenResearch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 216, "RoachWarrenResearch", 1, "EvolveGlialRegeneration", "Research GlialRegeneration", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 217, "RoachWarrenResearch", 2, "EvolveTunnelingClaws", "Research TunnelingClaws", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 218, "RoachWarrenResearch", 3, "RoachSupply", "Research RoachSupply", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 219, "RoachWarrenResearch", 4, "", "RoachWarrenResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 220, "RoachWarrenResearch", 5, "", "RoachWarrenResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 221, "RoachWarrenResearch", 6, "", "RoachWarrenResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 222, "RoachWarrenResearch", 7, "", "RoachWarrenResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 223, "RoachWarrenResearch", 8, "", "RoachWarrenResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 224, "RoachWarrenResearch", 9, "", "RoachWarrenResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 225, "RoachWarrenResearch", 10, "", "RoachWarrenResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 226, "RoachWarrenResearch", 11, "", "RoachWarrenResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 227, "RoachWarrenResearch", 12, "", "RoachWarrenResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 228, "RoachWarrenResearch", 13, "", "RoachWarrenResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 229, "RoachWarrenResearch", 14, "", "RoachWarrenResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 230, "RoachWarrenResearch", 15, "", "RoachWarrenResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 231, "RoachWarrenResearch", 16, "", "RoachWarrenResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 232, "RoachWarrenResearch", 17, "", "RoachWarrenResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 233, "RoachWarrenResearch", 18, "", "RoachWarrenResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 234, "RoachWarrenResearch", 19, "", "RoachWarrenResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 235, "RoachWarrenResearch", 20, "", "RoachWarrenResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 236, "RoachWarrenResearch", 21, "", "RoachWarrenResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 237, "RoachWarrenResearch", 22, "", "RoachWarrenResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 238, "RoachWarrenResearch", 23, "", "RoachWarrenResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 239, "RoachWarrenResearch", 24, "", "RoachWarrenResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 240, "RoachWarrenResearch", 25, "", "RoachWarrenResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 241, "RoachWarrenResearch", 26, "", "RoachWarrenResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 242, "RoachWarrenResearch", 27, "", "RoachWarrenResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 243, "RoachWarrenResearch", 28, "", "RoachWarrenResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 244, "RoachWarrenResearch", 29, "", "RoachWarrenResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 245, "SapStructure", 0, "SapStructure", "Effect SapStructure", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 0.25f },
+    { true, 246, "SapStructure", 1, "", "SapStructure_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 247, "InfestedTerrans", 0, "InfestedTerrans", "Effect InfestedTerrans", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 8.0f },
+    { true, 248, "InfestedTerrans", 1, "", "InfestedTerrans_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 249, "NeuralParasite", 0, "NeuralParasite", "Effect NeuralParasite", "C", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { true, 250, "NeuralParasite", 1, "Cancel", "Cancel NeuralParasite", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 251, "SpawnLarva", 0, "MorphMorphalisk", "Effect InjectLarva", "X", 0, 0, 0, 3, false, false, false, 0.0f, false, 0.100097656f },
+    { true, 252, "SpawnLarva", 1, "", "SpawnLarva_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 253, "StimpackMarauder", 0, "Stim", "Effect Stim Marauder", "Z", 3675, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 254, "StimpackMarauder", 1, "", "StimpackMarauder_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 255, "SupplyDrop", 0, "SupplyDrop", "Effect SupplyDrop", "X", 0, 0, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { true, 256, "SupplyDrop", 1, "", "SupplyDrop_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 257, "250mmStrikeCannons", 0, "250mmStrikeCannons", "Effect 250mmStrikeCannons", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 7.0f },
+    { false, 258, "250mmStrikeCannons", 1, "Cancel", "250mmStrikeCannons_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 259, "TemporalRift", 0, "TemporalRift", "Effect TemporalRift", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 9.0f },
+    { false, 260, "TemporalRift", 1, "", "TemporalRift_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 261, "TimeWarp", 0, "TimeWarp", "Effect ChronoBoost", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { false, 262, "TimeWarp", 1, "", "TimeWarp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 263, "UltraliskCavernResearch", 0, "EvolveAnabolicSynthesis2", "Research EvolveAnabolicSynthesis2", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 264, "UltraliskCavernResearch", 1, "", "UltraliskCavernResearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 265, "UltraliskCavernResearch", 2, "EvolveChitinousPlating", "Research ChitinousPlating", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 266, "UltraliskCavernResearch", 3, "", "UltraliskCavernResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 267, "UltraliskCavernResearch", 4, "", "UltraliskCavernResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 268, "UltraliskCavernResearch", 5, "", "UltraliskCavernResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 269, "UltraliskCavernResearch", 6, "", "UltraliskCavernResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 270, "UltraliskCavernResearch", 7, "", "UltraliskCavernResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 271, "UltraliskCavernResearch", 8, "", "UltraliskCavernResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 272, "UltraliskCavernResearch", 9, "", "UltraliskCavernResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 273, "UltraliskCavernResearch", 10, "", "UltraliskCavernResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 274, "UltraliskCavernResearch", 11, "", "UltraliskCavernResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 275, "UltraliskCavernResearch", 12, "", "UltraliskCavernResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 276, "UltraliskCavernResearch", 13, "", "UltraliskCavernResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 277, "UltraliskCavernResearch", 14, "", "UltraliskCavernResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 278, "UltraliskCavernResearch", 15, "", "UltraliskCavernResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 279, "UltraliskCavernResearch", 16, "", "UltraliskCavernResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 280, "UltraliskCavernResearch", 17, "", "UltraliskCavernResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 281, "UltraliskCavernResearch", 18, "", "UltraliskCavernResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 282, "UltraliskCavernResearch", 19, "", "UltraliskCavernResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 283, "UltraliskCavernResearch", 20, "", "UltraliskCavernResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 284, "UltraliskCavernResearch", 21, "", "UltraliskCavernResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 285, "UltraliskCavernResearch", 22, "", "UltraliskCavernResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 286, "UltraliskCavernResearch", 23, "", "UltraliskCavernResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 287, "UltraliskCavernResearch", 24, "", "UltraliskCavernResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 288, "UltraliskCavernResearch", 25, "", "UltraliskCavernResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 289, "UltraliskCavernResearch", 26, "", "UltraliskCavernResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 290, "UltraliskCavernResearch", 27, "", "UltraliskCavernResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 291, "UltraliskCavernResearch", 28, "", "UltraliskCavernResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 292, "UltraliskCavernResearch", 29, "", "UltraliskCavernResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 293, "WormholeTransit", 0, "WormholeTransit", "Effect WormholeTransit", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { false, 294, "WormholeTransit", 1, "", "WormholeTransit_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 295, "SCVHarvest", 0, "Gather", "Harvest Gather SCV", "A", 3666, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 296, "SCVHarvest", 1, "ReturnCargo", "Harvest Return SCV", "S", 3667, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 297, "SCVHarvest", 2, "", "SCVHarvest_2", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 298, "ProbeHarvest", 0, "Gather", "Harvest Gather Probe", "A", 3666, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 299, "ProbeHarvest", 1, "ReturnCargo", "Harvest Return Probe", "S", 3667, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 300, "ProbeHarvest", 2, "", "ProbeHarvest_2", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 301, "AttackWarpPrism", 0, "AttackWarpPrism", "Attack AttackWarpPrism", "", 0, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 302, "AttackWarpPrism", 1, "AttackTowards", "Attack AttackTowards", "", 0, 0, 0, 2, true, false, false, 0.0f, false, 0.0f },
+    { true, 303, "AttackWarpPrism", 2, "AttackBarrage", "Attack AttackBarrage", "", 0, 0, 0, 2, true, false, false, 0.0f, false, 0.0f },
+    { true, 304, "que1", 0, "Cancel", "Cancel Queue1", "B", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 305, "que1", 1, "CancelSlot", "CancelSlot Queue1", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 306, "que5", 0, "Cancel", "Cancel Queue5", "B", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 307, "que5", 1, "CancelSlot", "CancelSlot Queue5", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 308, "que5CancelToSelection", 0, "Cancel", "Cancel QueueCancelToSelection", "B", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 309, "que5CancelToSelection", 1, "CancelSlot", "CancelSlot QueueCancelToSelection", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 310, "que5LongBlend", 0, "Cancel", "que5LongBlend_0", "B", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 311, "que5LongBlend", 1, "CancelSlot", "que5LongBlend_1", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 312, "que5Addon", 0, "Cancel", "Cancel QueueAddOn", "B", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 313, "que5Addon", 1, "CancelSlot", "CancelSlot Addon", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 314, "BuildInProgress", 0, "Cancel", "Cancel BuildInProgress", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 315, "BuildInProgress", 1, "Cancel", "Halt Building", "V", 3660, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 316, "Repair", 0, "Repair", "Effect Repair SCV", "C", 3685, 0, 0, 3, false, true, false, 0.0f, false, 0.0f },
+    { true, 317, "Repair", 1, "", "Repair_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 318, "TerranBuild", 0, "CommandCenter", "Build CommandCenter", "ZQ", 0, 0, 0, 2, false, false, true, 2.5f, false, 0.0f },
+    { true, 319, "TerranBuild", 1, "SupplyDepot", "Build SupplyDepot", "ZE", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 320, "TerranBuild", 2, "Refinery", "Build Refinery", "ZW", 0, 0, 0, 3, false, false, true, 1.5f, false, 0.0f },
+    { true, 321, "TerranBuild", 3, "Barracks", "Build Barracks", "ZA", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 322, "TerranBuild", 4, "EngineeringBay", "Build EngineeringBay", "ZS", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 323, "TerranBuild", 5, "MissileTurret", "Build MissileTurret", "ZX", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 324, "TerranBuild", 6, "Bunker", "Build Bunker", "ZZ", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 325, "TerranBuild", 7, "", "TerranBuild_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 326, "TerranBuild", 8, "SensorTower", "Build SensorTower", "ZC", 0, 0, 0, 2, false, false, true, 0.5f, false, 0.0f },
+    { true, 327, "TerranBuild", 9, "GhostAcademy", "Build GhostAcademy", "XQ", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 328, "TerranBuild", 10, "Factory", "Build Factory", "XA", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 329, "TerranBuild", 11, "Starport", "Build Starport", "XZ", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 330, "TerranBuild", 12, "", "TerranBuild_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 331, "TerranBuild", 13, "Armory", "Build Armory", "XS", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 332, "TerranBuild", 14, "", "TerranBuild_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 333, "TerranBuild", 15, "FusionCore", "Build FusionCore", "XX", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 334, "TerranBuild", 16, "", "TerranBuild_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 335, "TerranBuild", 17, "", "TerranBuild_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 336, "TerranBuild", 18, "", "TerranBuild_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 337, "TerranBuild", 19, "", "TerranBuild_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 338, "TerranBuild", 20, "", "TerranBuild_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 339, "TerranBuild", 21, "", "TerranBuild_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 340, "TerranBuild", 22, "", "TerranBuild_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 341, "TerranBuild", 23, "", "TerranBuild_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 342, "TerranBuild", 24, "", "TerranBuild_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 343, "TerranBuild", 25, "", "TerranBuild_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 344, "TerranBuild", 26, "", "TerranBuild_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 345, "TerranBuild", 27, "", "TerranBuild_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 346, "TerranBuild", 28, "", "TerranBuild_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 347, "TerranBuild", 29, "", "TerranBuild_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 348, "TerranBuild", 30, "Cancel", "Halt TerranBuild", "B", 3660, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 349, "RavenBuild", 0, "AutoTurret", "Build AutoTurret", "", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { false, 350, "RavenBuild", 1, "", "RavenBuild_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 351, "RavenBuild", 2, "", "RavenBuild_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 352, "RavenBuild", 3, "", "RavenBuild_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 353, "RavenBuild", 4, "", "RavenBuild_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 354, "RavenBuild", 5, "", "RavenBuild_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 355, "RavenBuild", 6, "", "RavenBuild_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 356, "RavenBuild", 7, "", "RavenBuild_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 357, "RavenBuild", 8, "", "RavenBuild_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 358, "RavenBuild", 9, "", "RavenBuild_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 359, "RavenBuild", 10, "", "RavenBuild_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 360, "RavenBuild", 11, "", "RavenBuild_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 361, "RavenBuild", 12, "", "RavenBuild_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 362, "RavenBuild", 13, "", "RavenBuild_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 363, "RavenBuild", 14, "", "RavenBuild_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 364, "RavenBuild", 15, "", "RavenBuild_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 365, "RavenBuild", 16, "", "RavenBuild_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 366, "RavenBuild", 17, "", "RavenBuild_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 367, "RavenBuild", 18, "", "RavenBuild_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 368, "RavenBuild", 19, "", "RavenBuild_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 369, "RavenBuild", 20, "", "RavenBuild_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 370, "RavenBuild", 21, "", "RavenBuild_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 371, "RavenBuild", 22, "", "RavenBuild_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 372, "RavenBuild", 23, "", "RavenBuild_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 373, "RavenBuild", 24, "", "RavenBuild_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 374, "RavenBuild", 25, "", "RavenBuild_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 375, "RavenBuild", 26, "", "RavenBuild_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 376, "RavenBuild", 27, "", "RavenBuild_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 377, "RavenBuild", 28, "", "RavenBuild_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 378, "RavenBuild", 29, "", "RavenBuild_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 379, "RavenBuild", 30, "Cancel", "RavenBuild_30", "", 3660, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 380, "Stimpack", 0, "Stim", "Effect Stim Marine", "Z", 3675, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 381, "Stimpack", 1, "", "Stimpack_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 382, "GhostCloak", 0, "CloakOnGhost", "Behavior CloakOn Ghost", "C", 3676, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 383, "GhostCloak", 1, "CloakOff", "Behavior CloakOff Ghost", "V", 3677, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 384, "Snipe", 0, "Snipe", "Effect Snipe", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { false, 385, "Snipe", 1, "", "Snipe_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 386, "MedivacHeal", 0, "Heal", "Effect Heal", "Z", 0, 0, 0, 3, false, true, false, 0.0f, false, 4.0f },
+    { true, 387, "MedivacHeal", 1, "", "MedivacHeal_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 388, "SiegeMode", 0, "SiegeMode", "Morph SiegeMode", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 389, "SiegeMode", 1, "", "SiegeMode_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 390, "Unsiege", 0, "Unsiege", "Morph Unsiege", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 391, "Unsiege", 1, "", "Unsiege_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 392, "BansheeCloak", 0, "CloakOnBanshee", "Behavior CloakOn Banshee", "Z", 3676, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 393, "BansheeCloak", 1, "CloakOff", "Behavior CloakOff Banshee", "X", 3677, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 394, "MedivacTransport", 0, "MedivacLoad", "Load Medivac", "C", 3668, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 395, "MedivacTransport", 1, "", "Unload Medivac", "", 3664, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 396, "MedivacTransport", 2, "MedivacUnloadAll", "UnloadAllAt Medivac", "V", 3669, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 397, "MedivacTransport", 3, "", "UnloadUnit Medivac", "", 3670, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 398, "MedivacTransport", 4, "", "MedivacTransport_4", "", 3663, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 399, "ScannerSweep", 0, "Scan", "Effect Scan", "C", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 400, "ScannerSweep", 1, "", "ScannerSweep_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 401, "Yamato", 0, "YamatoGun", "Effect YamatoGun", "Z", 0, 0, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { true, 402, "Yamato", 1, "", "Yamato_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 403, "AssaultMode", 0, "AssaultMode", "Morph VikingAssaultMode", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 404, "AssaultMode", 1, "", "AssaultMode_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 405, "FighterMode", 0, "FighterMode", "Morph VikingFighterMode", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 406, "FighterMode", 1, "", "FighterMode_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 407, "BunkerTransport", 0, "BunkerLoad", "Load Bunker", "X", 3668, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 408, "BunkerTransport", 1, "BunkerUnloadAll", "UnloadAll Bunker", "C", 3664, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 409, "BunkerTransport", 2, "", "BunkerTransport_2", "", 3669, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 410, "BunkerTransport", 3, "", "UnloadUnit Bunker", "", 3670, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 411, "BunkerTransport", 4, "", "BunkerTransport_4", "", 3663, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 412, "CommandCenterTransport", 0, "", "CommandCenterTransport_0", "", 3668, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 413, "CommandCenterTransport", 1, "CommandCenterUnloadAll", "UnloadAll CommandCenter", "X", 3664, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 414, "CommandCenterTransport", 2, "", "CommandCenterTransport_2", "", 3669, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 415, "CommandCenterTransport", 3, "", "UnloadUnit CommandCenter", "", 3670, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 416, "CommandCenterTransport", 4, "CommandCenterLoad", "LoadAll CommandCenter", "Z", 3663, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 417, "CommandCenterLiftOff", 0, "Lift", "Lift CommandCenter", "V", 3679, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 418, "CommandCenterLiftOff", 1, "", "CommandCenterLiftOff_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 419, "CommandCenterLand", 0, "Land", "Land CommandCenter", "V", 3678, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 420, "CommandCenterLand", 1, "", "CommandCenterLand_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 421, "BarracksAddOns", 0, "BuildTechLabBarracks", "Build TechLab Barracks", "Z", 3682, 0, 0, 5, false, false, true, 3.5f, true, 0.0f },
+    { true, 422, "BarracksAddOns", 1, "Reactor", "Build Reactor Barracks", "X", 3683, 0, 0, 5, false, false, true, 3.5f, true, 0.0f },
+    { true, 423, "BarracksAddOns", 2, "", "BarracksAddOns_2", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 424, "BarracksAddOns", 3, "", "BarracksAddOns_3", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 425, "BarracksAddOns", 4, "", "BarracksAddOns_4", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 426, "BarracksAddOns", 5, "", "BarracksAddOns_5", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 427, "BarracksAddOns", 6, "", "BarracksAddOns_6", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 428, "BarracksAddOns", 7, "", "BarracksAddOns_7", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 429, "BarracksAddOns", 8, "", "BarracksAddOns_8", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 430, "BarracksAddOns", 9, "", "BarracksAddOns_9", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 431, "BarracksAddOns", 10, "", "BarracksAddOns_10", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 432, "BarracksAddOns", 11, "", "BarracksAddOns_11", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 433, "BarracksAddOns", 12, "", "BarracksAddOns_12", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 434, "BarracksAddOns", 13, "", "BarracksAddOns_13", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 435, "BarracksAddOns", 14, "", "BarracksAddOns_14", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 436, "BarracksAddOns", 15, "", "BarracksAddOns_15", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 437, "BarracksAddOns", 16, "", "BarracksAddOns_16", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 438, "BarracksAddOns", 17, "", "BarracksAddOns_17", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 439, "BarracksAddOns", 18, "", "BarracksAddOns_18", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 440, "BarracksAddOns", 19, "", "BarracksAddOns_19", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 441, "BarracksAddOns", 20, "", "BarracksAddOns_20", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 442, "BarracksAddOns", 21, "", "BarracksAddOns_21", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 443, "BarracksAddOns", 22, "", "BarracksAddOns_22", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 444, "BarracksAddOns", 23, "", "BarracksAddOns_23", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 445, "BarracksAddOns", 24, "", "BarracksAddOns_24", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 446, "BarracksAddOns", 25, "", "BarracksAddOns_25", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 447, "BarracksAddOns", 26, "", "BarracksAddOns_26", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 448, "BarracksAddOns", 27, "", "BarracksAddOns_27", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 449, "BarracksAddOns", 28, "", "BarracksAddOns_28", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 450, "BarracksAddOns", 29, "", "BarracksAddOns_29", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 451, "BarracksAddOns", 30, "Cancel", "Cancel BarracksAddOn", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 452, "BarracksLiftOff", 0, "Lift", "Lift Barracks", "V", 3679, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 453, "BarracksLiftOff", 1, "", "BarracksLiftOff_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 454, "FactoryAddOns", 0, "BuildTechLabFactory", "Build TechLab Factory", "Z", 3682, 0, 0, 5, false, false, true, 3.5f, true, 0.0f },
+    { true, 455, "FactoryAddOns", 1, "Reactor", "Build Reactor Factory", "X", 3683, 0, 0, 5, false, false, true, 3.5f, true, 0.0f },
+    { true, 456, "FactoryAddOns", 2, "", "FactoryAddOns_2", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 457, "FactoryAddOns", 3, "", "FactoryAddOns_3", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 458, "FactoryAddOns", 4, "", "FactoryAddOns_4", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 459, "FactoryAddOns", 5, "", "FactoryAddOns_5", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 460, "FactoryAddOns", 6, "", "FactoryAddOns_6", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 461, "FactoryAddOns", 7, "", "FactoryAddOns_7", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 462, "FactoryAddOns", 8, "", "FactoryAddOns_8", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 463, "FactoryAddOns", 9, "", "FactoryAddOns_9", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 464, "FactoryAddOns", 10, "", "FactoryAddOns_10", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 465, "FactoryAddOns", 11, "", "FactoryAddOns_11", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 466, "FactoryAddOns", 12, "", "FactoryAddOns_12", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 467, "FactoryAddOns", 13, "", "FactoryAddOns_13", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 468, "FactoryAddOns", 14, "", "FactoryAddOns_14", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 469, "FactoryAddOns", 15, "", "FactoryAddOns_15", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 470, "FactoryAddOns", 16, "", "FactoryAddOns_16", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 471, "FactoryAddOns", 17, "", "FactoryAddOns_17", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 472, "FactoryAddOns", 18, "", "FactoryAddOns_18", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 473, "FactoryAddOns", 19, "", "FactoryAddOns_19", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 474, "FactoryAddOns", 20, "", "FactoryAddOns_20", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 475, "FactoryAddOns", 21, "", "FactoryAddOns_21", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 476, "FactoryAddOns", 22, "", "FactoryAddOns_22", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 477, "FactoryAddOns", 23, "", "FactoryAddOns_23", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 478, "FactoryAddOns", 24, "", "FactoryAddOns_24", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 479, "FactoryAddOns", 25, "", "FactoryAddOns_25", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 480, "FactoryAddOns", 26, "", "FactoryAddOns_26", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 481, "FactoryAddOns", 27, "", "FactoryAddOns_27", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 482, "FactoryAddOns", 28, "", "FactoryAddOns_28", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 483, "FactoryAddOns", 29, "", "FactoryAddOns_29", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 484, "FactoryAddOns", 30, "Cancel", "Cancel FactoryAddOn", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 485, "FactoryLiftOff", 0, "Lift", "Lift Factory", "V", 3679, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 486, "FactoryLiftOff", 1, "", "FactoryLiftOff_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 487, "StarportAddOns", 0, "BuildTechLabStarport", "Build TechLab Starport", "Z", 3682, 0, 0, 5, false, false, true, 3.5f, true, 0.0f },
+    { true, 488, "StarportAddOns", 1, "Reactor", "Build Reactor Starport", "X", 3683, 0, 0, 5, false, false, true, 3.5f, true, 0.0f },
+    { true, 489, "StarportAddOns", 2, "", "StarportAddOns_2", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 490, "StarportAddOns", 3, "", "StarportAddOns_3", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 491, "StarportAddOns", 4, "", "StarportAddOns_4", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 492, "StarportAddOns", 5, "", "StarportAddOns_5", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 493, "StarportAddOns", 6, "", "StarportAddOns_6", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 494, "StarportAddOns", 7, "", "StarportAddOns_7", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 495, "StarportAddOns", 8, "", "StarportAddOns_8", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 496, "StarportAddOns", 9, "", "StarportAddOns_9", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 497, "StarportAddOns", 10, "", "StarportAddOns_10", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 498, "StarportAddOns", 11, "", "StarportAddOns_11", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 499, "StarportAddOns", 12, "", "StarportAddOns_12", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 500, "StarportAddOns", 13, "", "StarportAddOns_13", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 501, "StarportAddOns", 14, "", "StarportAddOns_14", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 502, "StarportAddOns", 15, "", "StarportAddOns_15", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 503, "StarportAddOns", 16, "", "StarportAddOns_16", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 504, "StarportAddOns", 17, "", "StarportAddOns_17", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 505, "StarportAddOns", 18, "", "StarportAddOns_18", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 506, "StarportAddOns", 19, "", "StarportAddOns_19", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 507, "StarportAddOns", 20, "", "StarportAddOns_20", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 508, "StarportAddOns", 21, "", "StarportAddOns_21", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 509, "StarportAddOns", 22, "", "StarportAddOns_22", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 510, "StarportAddOns", 23, "", "StarportAddOns_23", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 511, "StarportAddOns", 24, "", "StarportAddOns_24", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 512, "StarportAddOns", 25, "", "StarportAddOns_25", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 513, "StarportAddOns", 26, "", "StarportAddOns_26", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 514, "StarportAddOns", 27, "", "StarportAddOns_27", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 515, "StarportAddOns", 28, "", "StarportAddOns_28", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 516, "StarportAddOns", 29, "", "StarportAddOns_29", "", 0, 0, 0, 1, false, false, false, 0.0f, true, 0.0f },
+    { true, 517, "StarportAddOns", 30, "Cancel", "Cancel StarportAddOn", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 518, "StarportLiftOff", 0, "Lift", "Lift Starport", "V", 3679, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 519, "StarportLiftOff", 1, "", "StarportLiftOff_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 520, "FactoryLand", 0, "Land", "Land Factory", "V", 3678, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 521, "FactoryLand", 1, "", "FactoryLand_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 522, "StarportLand", 0, "Land", "Land Starport", "V", 3678, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 523, "StarportLand", 1, "", "StarportLand_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 524, "CommandCenterTrain", 0, "SCV", "Train SCV", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 525, "CommandCenterTrain", 1, "", "CommandCenterTrain_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 526, "CommandCenterTrain", 2, "", "CommandCenterTrain_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 527, "CommandCenterTrain", 3, "", "CommandCenterTrain_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 528, "CommandCenterTrain", 4, "", "CommandCenterTrain_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 529, "CommandCenterTrain", 5, "", "CommandCenterTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 530, "CommandCenterTrain", 6, "", "CommandCenterTrain_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 531, "CommandCenterTrain", 7, "", "CommandCenterTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 532, "CommandCenterTrain", 8, "", "CommandCenterTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 533, "CommandCenterTrain", 9, "", "CommandCenterTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 534, "CommandCenterTrain", 10, "", "CommandCenterTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 535, "CommandCenterTrain", 11, "", "CommandCenterTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 536, "CommandCenterTrain", 12, "", "CommandCenterTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 537, "CommandCenterTrain", 13, "", "CommandCenterTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 538, "CommandCenterTrain", 14, "", "CommandCenterTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 539, "CommandCenterTrain", 15, "", "CommandCenterTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 540, "CommandCenterTrain", 16, "", "CommandCenterTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 541, "CommandCenterTrain", 17, "", "CommandCenterTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 542, "CommandCenterTrain", 18, "", "CommandCenterTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 543, "CommandCenterTrain", 19, "", "CommandCenterTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 544, "CommandCenterTrain", 20, "", "CommandCenterTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 545, "CommandCenterTrain", 21, "", "CommandCenterTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 546, "CommandCenterTrain", 22, "", "CommandCenterTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 547, "CommandCenterTrain", 23, "", "CommandCenterTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 548, "CommandCenterTrain", 24, "", "CommandCenterTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 549, "CommandCenterTrain", 25, "", "CommandCenterTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 550, "CommandCenterTrain", 26, "", "CommandCenterTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 551, "CommandCenterTrain", 27, "", "CommandCenterTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 552, "CommandCenterTrain", 28, "", "CommandCenterTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 553, "CommandCenterTrain", 29, "", "CommandCenterTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 554, "BarracksLand", 0, "Land", "Land Barracks", "V", 3678, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 555, "BarracksLand", 1, "", "BarracksLand_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 556, "SupplyDepotLower", 0, "Lower", "Morph SupplyDepot Lower", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 557, "SupplyDepotLower", 1, "", "SupplyDepotLower_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 558, "SupplyDepotRaise", 0, "Raise", "Morph SupplyDepot Raise", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 559, "SupplyDepotRaise", 1, "", "SupplyDepotRaise_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 560, "BarracksTrain", 0, "Marine", "Train Marine", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 561, "BarracksTrain", 1, "Reaper", "Train Reaper", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 562, "BarracksTrain", 2, "Ghost", "Train Ghost", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 563, "BarracksTrain", 3, "Marauder", "Train Marauder", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 564, "BarracksTrain", 4, "", "BarracksTrain_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 565, "BarracksTrain", 5, "", "BarracksTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 566, "BarracksTrain", 6, "", "BarracksTrain_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 567, "BarracksTrain", 7, "", "BarracksTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 568, "BarracksTrain", 8, "", "BarracksTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 569, "BarracksTrain", 9, "", "BarracksTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 570, "BarracksTrain", 10, "", "BarracksTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 571, "BarracksTrain", 11, "", "BarracksTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 572, "BarracksTrain", 12, "", "BarracksTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 573, "BarracksTrain", 13, "", "BarracksTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 574, "BarracksTrain", 14, "", "BarracksTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 575, "BarracksTrain", 15, "", "BarracksTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 576, "BarracksTrain", 16, "", "BarracksTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 577, "BarracksTrain", 17, "", "BarracksTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 578, "BarracksTrain", 18, "", "BarracksTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 579, "BarracksTrain", 19, "", "BarracksTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 580, "BarracksTrain", 20, "", "BarracksTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 581, "BarracksTrain", 21, "", "BarracksTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 582, "BarracksTrain", 22, "", "BarracksTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 583, "BarracksTrain", 23, "", "BarracksTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 584, "BarracksTrain", 24, "", "BarracksTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 585, "BarracksTrain", 25, "", "BarracksTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 586, "BarracksTrain", 26, "", "BarracksTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 587, "BarracksTrain", 27, "", "BarracksTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 588, "BarracksTrain", 28, "", "BarracksTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 589, "BarracksTrain", 29, "", "BarracksTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 590, "FactoryTrain", 0, "", "FactoryTrain_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 591, "FactoryTrain", 1, "SiegeTank", "Train SiegeTank", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 592, "FactoryTrain", 2, "", "FactoryTrain_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 593, "FactoryTrain", 3, "", "FactoryTrain_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 594, "FactoryTrain", 4, "Thor", "Train Thor", "S", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 595, "FactoryTrain", 5, "Hellion", "Train Hellion", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 596, "FactoryTrain", 6, "HellionTank", "Train Hellbat", "A", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 597, "FactoryTrain", 7, "BuildCyclone", "Train Cyclone", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 598, "FactoryTrain", 8, "", "FactoryTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 599, "FactoryTrain", 9, "", "FactoryTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 600, "FactoryTrain", 10, "", "FactoryTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 601, "FactoryTrain", 11, "", "FactoryTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 602, "FactoryTrain", 12, "", "FactoryTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 603, "FactoryTrain", 13, "", "FactoryTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 604, "FactoryTrain", 14, "", "FactoryTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 605, "FactoryTrain", 15, "", "FactoryTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 606, "FactoryTrain", 16, "", "FactoryTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 607, "FactoryTrain", 17, "", "FactoryTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 608, "FactoryTrain", 18, "", "FactoryTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 609, "FactoryTrain", 19, "", "FactoryTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 610, "FactoryTrain", 20, "", "FactoryTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 611, "FactoryTrain", 21, "", "FactoryTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 612, "FactoryTrain", 22, "", "FactoryTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 613, "FactoryTrain", 23, "", "FactoryTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 614, "FactoryTrain", 24, "WidowMine", "Train WidowMine", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 615, "FactoryTrain", 25, "", "FactoryTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 616, "FactoryTrain", 26, "", "FactoryTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 617, "FactoryTrain", 27, "", "FactoryTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 618, "FactoryTrain", 28, "", "FactoryTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 619, "FactoryTrain", 29, "", "FactoryTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 620, "StarportTrain", 0, "Medivac", "Train Medivac", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 621, "StarportTrain", 1, "Banshee", "Train Banshee", "T", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 622, "StarportTrain", 2, "Raven", "Train Raven", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 623, "StarportTrain", 3, "Battlecruiser", "Train Battlecruiser", "A", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 624, "StarportTrain", 4, "VikingFighter", "Train VikingFighter", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 625, "StarportTrain", 5, "", "StarportTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 626, "StarportTrain", 6, "Liberator", "Train Liberator", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 627, "StarportTrain", 7, "", "StarportTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 628, "StarportTrain", 8, "", "StarportTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 629, "StarportTrain", 9, "", "StarportTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 630, "StarportTrain", 10, "", "StarportTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 631, "StarportTrain", 11, "", "StarportTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 632, "StarportTrain", 12, "", "StarportTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 633, "StarportTrain", 13, "", "StarportTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 634, "StarportTrain", 14, "", "StarportTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 635, "StarportTrain", 15, "", "StarportTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 636, "StarportTrain", 16, "", "StarportTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 637, "StarportTrain", 17, "", "StarportTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 638, "StarportTrain", 18, "", "StarportTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 639, "StarportTrain", 19, "", "StarportTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 640, "StarportTrain", 20, "", "StarportTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 641, "StarportTrain", 21, "", "StarportTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 642, "StarportTrain", 22, "", "StarportTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 643, "StarportTrain", 23, "", "StarportTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 644, "StarportTrain", 24, "", "StarportTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 645, "StarportTrain", 25, "", "StarportTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 646, "StarportTrain", 26, "", "StarportTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 647, "StarportTrain", 27, "", "StarportTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 648, "StarportTrain", 28, "", "StarportTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 649, "StarportTrain", 29, "", "StarportTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 650, "EngineeringBayResearch", 0, "ResearchHiSecAutoTracking", "Research HiSecAutoTracking", "A", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 651, "EngineeringBayResearch", 1, "UpgradeBuildingArmorLevel1", "Research TerranStructureArmorUpgrade", "S", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 652, "EngineeringBayResearch", 2, "TerranInfantryWeaponsLevel1", "Research TerranInfantryWeaponsLevel1", "Q", 3698, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 653, "EngineeringBayResearch", 3, "TerranInfantryWeaponsLevel2", "Research TerranInfantryWeaponsLevel2", "Q", 3698, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 654, "EngineeringBayResearch", 4, "TerranInfantryWeaponsLevel3", "Research TerranInfantryWeaponsLevel3", "Q", 3698, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 655, "EngineeringBayResearch", 5, "ResearchNeosteelFrame", "Research NeosteelFrame", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 656, "EngineeringBayResearch", 6, "TerranInfantryArmorLevel1", "Research TerranInfantryArmorLevel1", "W", 3697, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 657, "EngineeringBayResearch", 7, "TerranInfantryArmorLevel2", "Research TerranInfantryArmorLevel2", "W", 3697, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 658, "EngineeringBayResearch", 8, "TerranInfantryArmorLevel3", "Research TerranInfantryArmorLevel3", "W", 3697, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 659, "EngineeringBayResearch", 9, "", "EngineeringBayResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 660, "EngineeringBayResearch", 10, "", "EngineeringBayResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 661, "EngineeringBayResearch", 11, "", "EngineeringBayResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 662, "EngineeringBayResearch", 12, "", "EngineeringBayResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 663, "EngineeringBayResearch", 13, "", "EngineeringBayResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 664, "EngineeringBayResearch", 14, "", "EngineeringBayResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 665, "EngineeringBayResearch", 15, "", "EngineeringBayResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 666, "EngineeringBayResearch", 16, "", "EngineeringBayResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 667, "EngineeringBayResearch", 17, "", "EngineeringBayResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 668, "EngineeringBayResearch", 18, "", "EngineeringBayResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 669, "EngineeringBayResearch", 19, "", "EngineeringBayResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 670, "EngineeringBayResearch", 20, "", "EngineeringBayResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 671, "EngineeringBayResearch", 21, "", "EngineeringBayResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 672, "EngineeringBayResearch", 22, "", "EngineeringBayResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 673, "EngineeringBayResearch", 23, "", "EngineeringBayResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 674, "EngineeringBayResearch", 24, "", "EngineeringBayResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 675, "EngineeringBayResearch", 25, "", "EngineeringBayResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 676, "EngineeringBayResearch", 26, "", "EngineeringBayResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 677, "EngineeringBayResearch", 27, "", "EngineeringBayResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 678, "EngineeringBayResearch", 28, "", "EngineeringBayResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 679, "EngineeringBayResearch", 29, "", "EngineeringBayResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 680, "MercCompoundResearch", 0, "", "MercCompoundResearch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 681, "MercCompoundResearch", 1, "", "MercCompoundResearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 682, "MercCompoundResearch", 2, "", "MercCompoundResearch_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 683, "MercCompoundResearch", 3, "ReaperSpeed", "Research ReaperSpeed", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 684, "MercCompoundResearch", 4, "", "MercCompoundResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 685, "MercCompoundResearch", 5, "", "MercCompoundResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 686, "MercCompoundResearch", 6, "", "MercCompoundResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 687, "MercCompoundResearch", 7, "", "MercCompoundResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 688, "MercCompoundResearch", 8, "", "MercCompoundResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 689, "MercCompoundResearch", 9, "", "MercCompoundResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 690, "MercCompoundResearch", 10, "", "MercCompoundResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 691, "MercCompoundResearch", 11, "", "MercCompoundResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 692, "MercCompoundResearch", 12, "", "MercCompoundResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 693, "MercCompoundResearch", 13, "", "MercCompoundResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 694, "MercCompoundResearch", 14, "", "MercCompoundResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 695, "MercCompoundResearch", 15, "", "MercCompoundResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 696, "MercCompoundResearch", 16, "", "MercCompoundResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 697, "MercCompoundResearch", 17, "", "MercCompoundResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 698, "MercCompoundResearch", 18, "", "MercCompoundResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 699, "MercCompoundResearch", 19, "", "MercCompoundResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 700, "MercCompoundResearch", 20, "", "MercCompoundResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 701, "MercCompoundResearch", 21, "", "MercCompoundResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 702, "MercCompoundResearch", 22, "", "MercCompoundResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 703, "MercCompoundResearch", 23, "", "MercCompoundResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 704, "MercCompoundResearch", 24, "", "MercCompoundResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 705, "MercCompoundResearch", 25, "", "MercCompoundResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 706, "MercCompoundResearch", 26, "", "MercCompoundResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 707, "MercCompoundResearch", 27, "", "MercCompoundResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 708, "MercCompoundResearch", 28, "", "MercCompoundResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 709, "MercCompoundResearch", 29, "", "MercCompoundResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 710, "ArmSiloWithNuke", 0, "NukeArm", "Build Nuke", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 711, "ArmSiloWithNuke", 1, "", "ArmSiloWithNuke_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 712, "ArmSiloWithNuke", 2, "", "ArmSiloWithNuke_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 713, "ArmSiloWithNuke", 3, "", "ArmSiloWithNuke_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 714, "ArmSiloWithNuke", 4, "", "ArmSiloWithNuke_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 715, "ArmSiloWithNuke", 5, "", "ArmSiloWithNuke_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 716, "ArmSiloWithNuke", 6, "", "ArmSiloWithNuke_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 717, "ArmSiloWithNuke", 7, "", "ArmSiloWithNuke_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 718, "ArmSiloWithNuke", 8, "", "ArmSiloWithNuke_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 719, "ArmSiloWithNuke", 9, "", "ArmSiloWithNuke_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 720, "ArmSiloWithNuke", 10, "", "ArmSiloWithNuke_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 721, "ArmSiloWithNuke", 11, "", "ArmSiloWithNuke_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 722, "ArmSiloWithNuke", 12, "", "ArmSiloWithNuke_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 723, "ArmSiloWithNuke", 13, "", "ArmSiloWithNuke_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 724, "ArmSiloWithNuke", 14, "", "ArmSiloWithNuke_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 725, "ArmSiloWithNuke", 15, "", "ArmSiloWithNuke_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 726, "ArmSiloWithNuke", 16, "", "ArmSiloWithNuke_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 727, "ArmSiloWithNuke", 17, "", "ArmSiloWithNuke_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 728, "ArmSiloWithNuke", 18, "", "ArmSiloWithNuke_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 729, "ArmSiloWithNuke", 19, "", "ArmSiloWithNuke_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 730, "BarracksTechLabResearch", 0, "Stimpack", "Research Stimpack", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 731, "BarracksTechLabResearch", 1, "ResearchShieldWall", "Research CombatShield", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 732, "BarracksTechLabResearch", 2, "ResearchPunisherGrenades", "Research ConcussiveShells", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 733, "BarracksTechLabResearch", 3, "", "BarracksTechLabResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 734, "BarracksTechLabResearch", 4, "", "BarracksTechLabResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 735, "BarracksTechLabResearch", 5, "", "BarracksTechLabResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 736, "BarracksTechLabResearch", 6, "", "BarracksTechLabResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 737, "BarracksTechLabResearch", 7, "", "BarracksTechLabResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 738, "BarracksTechLabResearch", 8, "", "BarracksTechLabResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 739, "BarracksTechLabResearch", 9, "", "BarracksTechLabResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 740, "BarracksTechLabResearch", 10, "", "BarracksTechLabResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 741, "BarracksTechLabResearch", 11, "", "BarracksTechLabResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 742, "BarracksTechLabResearch", 12, "", "BarracksTechLabResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 743, "BarracksTechLabResearch", 13, "", "BarracksTechLabResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 744, "BarracksTechLabResearch", 14, "", "BarracksTechLabResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 745, "BarracksTechLabResearch", 15, "", "BarracksTechLabResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 746, "BarracksTechLabResearch", 16, "", "BarracksTechLabResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 747, "BarracksTechLabResearch", 17, "", "BarracksTechLabResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 748, "BarracksTechLabResearch", 18, "", "BarracksTechLabResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 749, "BarracksTechLabResearch", 19, "", "BarracksTechLabResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 750, "BarracksTechLabResearch", 20, "", "BarracksTechLabResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 751, "BarracksTechLabResearch", 21, "", "BarracksTechLabResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 752, "BarracksTechLabResearch", 22, "", "BarracksTechLabResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 753, "BarracksTechLabResearch", 23, "", "BarracksTechLabResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 754, "BarracksTechLabResearch", 24, "", "BarracksTechLabResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 755, "BarracksTechLabResearch", 25, "", "BarracksTechLabResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 756, "BarracksTechLabResearch", 26, "", "BarracksTechLabResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 757, "BarracksTechLabResearch", 27, "", "BarracksTechLabResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 758, "BarracksTechLabResearch", 28, "", "BarracksTechLabResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 759, "BarracksTechLabResearch", 29, "", "BarracksTechLabResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 760, "FactoryTechLabResearch", 0, "", "FactoryTechLabResearch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 761, "FactoryTechLabResearch", 1, "ResearchHighCapacityBarrels", "Research InfernalPreigniter", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 762, "FactoryTechLabResearch", 2, "", "FactoryTechLabResearch_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 763, "FactoryTechLabResearch", 3, "ResearchTransformationServos", "Research ResearchTransformationServos", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 764, "FactoryTechLabResearch", 4, "ResearchDrillClaws", "Research DrillingClaws", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 765, "FactoryTechLabResearch", 5, "ResearchLockOnRangeUpgrade", "Research ResearchLockOnRangeUpgrade", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 766, "FactoryTechLabResearch", 6, "ResearchSmartServos", "Research SmartServos", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 767, "FactoryTechLabResearch", 7, "ResearchArmorPiercingRockets", "Research ResearchArmorPiercingRockets", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 768, "FactoryTechLabResearch", 8, "ResearchCycloneRapidFireLaunchers", "Research CycloneRapidFireLaunchers", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 769, "FactoryTechLabResearch", 9, "CycloneResearchLockOnDamageUpgrade", "Research CycloneResearchLockOnDamageUpgrade", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 770, "FactoryTechLabResearch", 10, "", "FactoryTechLabResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 771, "FactoryTechLabResearch", 11, "", "FactoryTechLabResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 772, "FactoryTechLabResearch", 12, "", "FactoryTechLabResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 773, "FactoryTechLabResearch", 13, "", "FactoryTechLabResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 774, "FactoryTechLabResearch", 14, "", "FactoryTechLabResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 775, "FactoryTechLabResearch", 15, "", "FactoryTechLabResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 776, "FactoryTechLabResearch", 16, "", "FactoryTechLabResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 777, "FactoryTechLabResearch", 17, "", "FactoryTechLabResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 778, "FactoryTechLabResearch", 18, "", "FactoryTechLabResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 779, "FactoryTechLabResearch", 19, "", "FactoryTechLabResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 780, "FactoryTechLabResearch", 20, "", "FactoryTechLabResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 781, "FactoryTechLabResearch", 21, "", "FactoryTechLabResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 782, "FactoryTechLabResearch", 22, "", "FactoryTechLabResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 783, "FactoryTechLabResearch", 23, "", "FactoryTechLabResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 784, "FactoryTechLabResearch", 24, "", "FactoryTechLabResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 785, "FactoryTechLabResearch", 25, "", "FactoryTechLabResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 786, "FactoryTechLabResearch", 26, "", "FactoryTechLabResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 787, "FactoryTechLabResearch", 27, "", "FactoryTechLabResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 788, "FactoryTechLabResearch", 28, "", "FactoryTechLabResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 789, "FactoryTechLabResearch", 29, "", "FactoryTechLabResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 790, "StarportTechLabResearch", 0, "ResearchBansheeCloak", "Research BansheeCloakingField", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 791, "StarportTechLabResearch", 1, "", "StarportTechLabResearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 792, "StarportTechLabResearch", 2, "ResearchMedivacEnergyUpgrade", "Research ResearchMedivacEnergyUpgrade", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 793, "StarportTechLabResearch", 3, "ResearchRavenEnergyUpgrade", "Research RavenCorvidReactor", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 794, "StarportTechLabResearch", 4, "", "StarportTechLabResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 795, "StarportTechLabResearch", 5, "", "StarportTechLabResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 796, "StarportTechLabResearch", 6, "ResearchSeekerMissile", "Research ResearchSeekerMissile", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 797, "StarportTechLabResearch", 7, "ResearchDurableMaterials", "Research ResearchDurableMaterials", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 798, "StarportTechLabResearch", 8, "", "StarportTechLabResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 799, "StarportTechLabResearch", 9, "BansheeSpeed", "Research BansheeHyperflightRotors", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 800, "StarportTechLabResearch", 10, "ResearchLiberatorAGMode", "Research ResearchLiberatorAGMode", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 801, "StarportTechLabResearch", 11, "", "StarportTechLabResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 802, "StarportTechLabResearch", 12, "ResearchRapidDeployment", "Research ResearchRapidDeployment", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 803, "StarportTechLabResearch", 13, "ResearchRavenRecalibratedExplosives", "Research RavenRecalibratedExplosives", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 804, "StarportTechLabResearch", 14, "ResearchHighCapacityFuelTanks", "Research HighCapacityFuelTanks", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 805, "StarportTechLabResearch", 15, "ResearchBallisticRange", "Research AdvancedBallistics", "A", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 806, "StarportTechLabResearch", 16, "RavenResearchEnhancedMunitions", "Research RavenResearchEnhancedMunitions", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 807, "StarportTechLabResearch", 17, "", "StarportTechLabResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 808, "StarportTechLabResearch", 18, "", "StarportTechLabResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 809, "StarportTechLabResearch", 19, "", "StarportTechLabResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 810, "StarportTechLabResearch", 20, "", "StarportTechLabResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 811, "StarportTechLabResearch", 21, "", "StarportTechLabResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 812, "StarportTechLabResearch", 22, "", "StarportTechLabResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 813, "StarportTechLabResearch", 23, "", "StarportTechLabResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 814, "StarportTechLabResearch", 24, "", "StarportTechLabResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 815, "StarportTechLabResearch", 25, "", "StarportTechLabResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 816, "StarportTechLabResearch", 26, "", "StarportTechLabResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 817, "StarportTechLabResearch", 27, "", "StarportTechLabResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 818, "StarportTechLabResearch", 28, "", "StarportTechLabResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 819, "StarportTechLabResearch", 29, "", "StarportTechLabResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 820, "GhostAcademyResearch", 0, "ResearchPersonalCloaking", "Research PersonalCloaking", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 821, "GhostAcademyResearch", 1, "ResearchGhostEnergyUpgrade", "Research ResearchGhostEnergyUpgrade", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 822, "GhostAcademyResearch", 2, "", "GhostAcademyResearch_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 823, "GhostAcademyResearch", 3, "", "GhostAcademyResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 824, "GhostAcademyResearch", 4, "", "GhostAcademyResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 825, "GhostAcademyResearch", 5, "", "GhostAcademyResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 826, "GhostAcademyResearch", 6, "", "GhostAcademyResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 827, "GhostAcademyResearch", 7, "", "GhostAcademyResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 828, "GhostAcademyResearch", 8, "", "GhostAcademyResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 829, "GhostAcademyResearch", 9, "", "GhostAcademyResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 830, "GhostAcademyResearch", 10, "", "GhostAcademyResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 831, "GhostAcademyResearch", 11, "", "GhostAcademyResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 832, "GhostAcademyResearch", 12, "", "GhostAcademyResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 833, "GhostAcademyResearch", 13, "", "GhostAcademyResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 834, "GhostAcademyResearch", 14, "", "GhostAcademyResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 835, "GhostAcademyResearch", 15, "", "GhostAcademyResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 836, "GhostAcademyResearch", 16, "", "GhostAcademyResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 837, "GhostAcademyResearch", 17, "", "GhostAcademyResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 838, "GhostAcademyResearch", 18, "", "GhostAcademyResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 839, "GhostAcademyResearch", 19, "", "GhostAcademyResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 840, "GhostAcademyResearch", 20, "", "GhostAcademyResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 841, "GhostAcademyResearch", 21, "", "GhostAcademyResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 842, "GhostAcademyResearch", 22, "", "GhostAcademyResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 843, "GhostAcademyResearch", 23, "", "GhostAcademyResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 844, "GhostAcademyResearch", 24, "", "GhostAcademyResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 845, "GhostAcademyResearch", 25, "", "GhostAcademyResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 846, "GhostAcademyResearch", 26, "", "GhostAcademyResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 847, "GhostAcademyResearch", 27, "", "GhostAcademyResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 848, "GhostAcademyResearch", 28, "", "GhostAcademyResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 849, "GhostAcademyResearch", 29, "", "GhostAcademyResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 850, "ArmoryResearch", 0, "", "ArmoryResearch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 851, "ArmoryResearch", 1, "", "ArmoryResearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 852, "ArmoryResearch", 2, "TerranVehiclePlatingLevel1", "Research TerranVehiclePlatingLevel1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 853, "ArmoryResearch", 3, "TerranVehiclePlatingLevel2", "Research TerranVehiclePlatingLevel2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 854, "ArmoryResearch", 4, "TerranVehiclePlatingLevel3", "Research TerranVehiclePlatingLevel3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 855, "ArmoryResearch", 5, "TerranVehicleWeaponsLevel1", "Research TerranVehicleWeaponsLevel1", "Q", 3701, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 856, "ArmoryResearch", 6, "TerranVehicleWeaponsLevel2", "Research TerranVehicleWeaponsLevel2", "Q", 3701, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 857, "ArmoryResearch", 7, "TerranVehicleWeaponsLevel3", "Research TerranVehicleWeaponsLevel3", "Q", 3701, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 858, "ArmoryResearch", 8, "TerranShipPlatingLevel1", "Research TerranShipPlatingLevel1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 859, "ArmoryResearch", 9, "TerranShipPlatingLevel2", "Research TerranShipPlatingLevel2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 860, "ArmoryResearch", 10, "TerranShipPlatingLevel3", "Research TerranShipPlatingLevel3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 861, "ArmoryResearch", 11, "TerranShipWeaponsLevel1", "Research TerranShipWeaponsLevel1", "A", 3699, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 862, "ArmoryResearch", 12, "TerranShipWeaponsLevel2", "Research TerranShipWeaponsLevel2", "A", 3699, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 863, "ArmoryResearch", 13, "TerranShipWeaponsLevel3", "Research TerranShipWeaponsLevel3", "A", 3699, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 864, "ArmoryResearch", 14, "TerranVehicleAndShipPlatingLevel1", "Research TerranVehicleAndShipPlatingLevel1", "W", 3700, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 865, "ArmoryResearch", 15, "TerranVehicleAndShipPlatingLevel2", "Research TerranVehicleAndShipPlatingLevel2", "W", 3700, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 866, "ArmoryResearch", 16, "TerranVehicleAndShipPlatingLevel3", "Research TerranVehicleAndShipPlatingLevel3", "W", 3700, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 867, "ArmoryResearch", 17, "", "ArmoryResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 868, "ArmoryResearch", 18, "", "ArmoryResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 869, "ArmoryResearch", 19, "", "ArmoryResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 870, "ArmoryResearch", 20, "", "ArmoryResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 871, "ArmoryResearch", 21, "", "ArmoryResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 872, "ArmoryResearch", 22, "", "ArmoryResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 873, "ArmoryResearch", 23, "", "ArmoryResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 874, "ArmoryResearch", 24, "", "ArmoryResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 875, "ArmoryResearch", 25, "", "ArmoryResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 876, "ArmoryResearch", 26, "", "ArmoryResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 877, "ArmoryResearch", 27, "", "ArmoryResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 878, "ArmoryResearch", 28, "", "ArmoryResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 879, "ArmoryResearch", 29, "", "ArmoryResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 880, "ProtossBuild", 0, "Nexus", "Build Nexus", "ZQ", 0, 0, 0, 2, false, false, true, 2.5f, false, 0.0f },
+    { true, 881, "ProtossBuild", 1, "Pylon", "Build Pylon", "ZE", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 882, "ProtossBuild", 2, "Assimilator", "Build Assimilator", "ZW", 0, 0, 0, 3, false, false, true, 1.5f, false, 0.0f },
+    { true, 883, "ProtossBuild", 3, "Gateway", "Build Gateway", "ZA", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 884, "ProtossBuild", 4, "Forge", "Build Forge", "ZS", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 885, "ProtossBuild", 5, "FleetBeacon", "Build FleetBeacon", "XS", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 886, "ProtossBuild", 6, "TwilightCouncil", "Build TwilightCouncil", "XQ", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 887, "ProtossBuild", 7, "PhotonCannon", "Build PhotonCannon", "ZX", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 888, "ProtossBuild", 8, "", "ProtossBuild_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 889, "ProtossBuild", 9, "Stargate", "Build Stargate", "XW", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 890, "ProtossBuild", 10, "TemplarArchive", "Build TemplarArchive", "XA", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 891, "ProtossBuild", 11, "DarkShrine", "Build DarkShrine", "XZ", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 892, "ProtossBuild", 12, "RoboticsBay", "Build RoboticsBay", "XD", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 893, "ProtossBuild", 13, "RoboticsFacility", "Build RoboticsFacility", "XE", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 894, "ProtossBuild", 14, "CyberneticsCore", "Build CyberneticsCore", "ZZ", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 895, "ProtossBuild", 15, "ShieldBattery", "Build ShieldBattery", "ZC", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 896, "ProtossBuild", 16, "", "ProtossBuild_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 897, "ProtossBuild", 17, "", "ProtossBuild_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 898, "ProtossBuild", 18, "", "ProtossBuild_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 899, "ProtossBuild", 19, "", "ProtossBuild_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 900, "ProtossBuild", 20, "", "ProtossBuild_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 901, "ProtossBuild", 21, "", "ProtossBuild_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 902, "ProtossBuild", 22, "", "ProtossBuild_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 903, "ProtossBuild", 23, "", "ProtossBuild_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 904, "ProtossBuild", 24, "", "ProtossBuild_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 905, "ProtossBuild", 25, "", "ProtossBuild_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 906, "ProtossBuild", 26, "", "ProtossBuild_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 907, "ProtossBuild", 27, "", "ProtossBuild_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 908, "ProtossBuild", 28, "", "ProtossBuild_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 909, "ProtossBuild", 29, "", "ProtossBuild_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 910, "ProtossBuild", 30, "Cancel", "ProtossBuild_30", "", 3660, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 911, "WarpPrismTransport", 0, "MedivacLoad", "Load WarpPrism", "C", 3668, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 912, "WarpPrismTransport", 1, "BunkerUnloadAll", "UnloadAll WarpPrism", "", 3664, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 913, "WarpPrismTransport", 2, "MedivacUnloadAll", "UnloadAllAt WarpPrism", "V", 3669, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 914, "WarpPrismTransport", 3, "", "UnloadUnit WarpPrism", "", 3670, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 915, "WarpPrismTransport", 4, "", "WarpPrismTransport_4", "", 3663, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 916, "GatewayTrain", 0, "Zealot", "Train Zealot", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 917, "GatewayTrain", 1, "Stalker", "Train Stalker", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 918, "GatewayTrain", 2, "", "GatewayTrain_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 919, "GatewayTrain", 3, "HighTemplar", "Train HighTemplar", "A", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 920, "GatewayTrain", 4, "DarkTemplar", "Train DarkTemplar", "S", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 921, "GatewayTrain", 5, "Sentry", "Train Sentry", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 922, "GatewayTrain", 6, "WarpInAdept", "Train Adept", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 923, "GatewayTrain", 7, "", "GatewayTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 924, "GatewayTrain", 8, "", "GatewayTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 925, "GatewayTrain", 9, "", "GatewayTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 926, "GatewayTrain", 10, "", "GatewayTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 927, "GatewayTrain", 11, "", "GatewayTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 928, "GatewayTrain", 12, "", "GatewayTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 929, "GatewayTrain", 13, "", "GatewayTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 930, "GatewayTrain", 14, "", "GatewayTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 931, "GatewayTrain", 15, "", "GatewayTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 932, "GatewayTrain", 16, "", "GatewayTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 933, "GatewayTrain", 17, "", "GatewayTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 934, "GatewayTrain", 18, "", "GatewayTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 935, "GatewayTrain", 19, "", "GatewayTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 936, "GatewayTrain", 20, "", "GatewayTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 937, "GatewayTrain", 21, "", "GatewayTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 938, "GatewayTrain", 22, "", "GatewayTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 939, "GatewayTrain", 23, "", "GatewayTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 940, "GatewayTrain", 24, "", "GatewayTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 941, "GatewayTrain", 25, "", "GatewayTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 942, "GatewayTrain", 26, "", "GatewayTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 943, "GatewayTrain", 27, "", "GatewayTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 944, "GatewayTrain", 28, "", "GatewayTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 945, "GatewayTrain", 29, "", "GatewayTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 946, "StargateTrain", 0, "Phoenix", "Train Phoenix", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 947, "StargateTrain", 1, "", "StargateTrain_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 948, "StargateTrain", 2, "Carrier", "Train Carrier", "T", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 949, "StargateTrain", 3, "", "StargateTrain_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 950, "StargateTrain", 4, "VoidRay", "Train VoidRay", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 951, "StargateTrain", 5, "", "StargateTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 952, "StargateTrain", 6, "", "StargateTrain_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 953, "StargateTrain", 7, "", "StargateTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 954, "StargateTrain", 8, "Oracle", "Train Oracle", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 955, "StargateTrain", 9, "Tempest", "Train Tempest", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 956, "StargateTrain", 10, "", "StargateTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 957, "StargateTrain", 11, "", "StargateTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 958, "StargateTrain", 12, "", "StargateTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 959, "StargateTrain", 13, "", "StargateTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 960, "StargateTrain", 14, "", "StargateTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 961, "StargateTrain", 15, "", "StargateTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 962, "StargateTrain", 16, "", "StargateTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 963, "StargateTrain", 17, "", "StargateTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 964, "StargateTrain", 18, "", "StargateTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 965, "StargateTrain", 19, "", "StargateTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 966, "StargateTrain", 20, "", "StargateTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 967, "StargateTrain", 21, "", "StargateTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 968, "StargateTrain", 22, "", "StargateTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 969, "StargateTrain", 23, "", "StargateTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 970, "StargateTrain", 24, "", "StargateTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 971, "StargateTrain", 25, "", "StargateTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 972, "StargateTrain", 26, "", "StargateTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 973, "StargateTrain", 27, "", "StargateTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 974, "StargateTrain", 28, "", "StargateTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 975, "StargateTrain", 29, "", "StargateTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 976, "RoboticsFacilityTrain", 0, "WarpPrism", "Train WarpPrism", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 977, "RoboticsFacilityTrain", 1, "Observer", "Train Observer", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 978, "RoboticsFacilityTrain", 2, "Colossus", "Train Colossus", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 979, "RoboticsFacilityTrain", 3, "Immortal", "Train Immortal", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 980, "RoboticsFacilityTrain", 4, "", "RoboticsFacilityTrain_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 981, "RoboticsFacilityTrain", 5, "", "RoboticsFacilityTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 982, "RoboticsFacilityTrain", 6, "", "RoboticsFacilityTrain_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 983, "RoboticsFacilityTrain", 7, "", "RoboticsFacilityTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 984, "RoboticsFacilityTrain", 8, "", "RoboticsFacilityTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 985, "RoboticsFacilityTrain", 9, "", "RoboticsFacilityTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 986, "RoboticsFacilityTrain", 10, "", "RoboticsFacilityTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 987, "RoboticsFacilityTrain", 11, "", "RoboticsFacilityTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 988, "RoboticsFacilityTrain", 12, "", "RoboticsFacilityTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 989, "RoboticsFacilityTrain", 13, "", "RoboticsFacilityTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 990, "RoboticsFacilityTrain", 14, "", "RoboticsFacilityTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 991, "RoboticsFacilityTrain", 15, "", "RoboticsFacilityTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 992, "RoboticsFacilityTrain", 16, "", "RoboticsFacilityTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 993, "RoboticsFacilityTrain", 17, "", "RoboticsFacilityTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 994, "RoboticsFacilityTrain", 18, "WarpinDisruptor", "Train Disruptor", "T", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 995, "RoboticsFacilityTrain", 19, "", "RoboticsFacilityTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 996, "RoboticsFacilityTrain", 20, "", "RoboticsFacilityTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 997, "RoboticsFacilityTrain", 21, "", "RoboticsFacilityTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 998, "RoboticsFacilityTrain", 22, "", "RoboticsFacilityTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 999, "RoboticsFacilityTrain", 23, "", "RoboticsFacilityTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1000, "RoboticsFacilityTrain", 24, "", "RoboticsFacilityTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1001, "RoboticsFacilityTrain", 25, "", "RoboticsFacilityTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1002, "RoboticsFacilityTrain", 26, "", "RoboticsFacilityTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1003, "RoboticsFacilityTrain", 27, "", "RoboticsFacilityTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1004, "RoboticsFacilityTrain", 28, "", "RoboticsFacilityTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1005, "RoboticsFacilityTrain", 29, "", "RoboticsFacilityTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1006, "NexusTrain", 0, "Probe", "Train Probe", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1007, "NexusTrain", 1, "", "NexusTrain_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1008, "NexusTrain", 2, "", "NexusTrain_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1009, "NexusTrain", 3, "", "NexusTrain_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1010, "NexusTrain", 4, "", "NexusTrain_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1011, "NexusTrain", 5, "", "NexusTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1012, "NexusTrain", 6, "", "NexusTrain_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1013, "NexusTrain", 7, "", "NexusTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1014, "NexusTrain", 8, "", "NexusTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1015, "NexusTrain", 9, "", "NexusTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1016, "NexusTrain", 10, "", "NexusTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1017, "NexusTrain", 11, "", "NexusTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1018, "NexusTrain", 12, "", "NexusTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1019, "NexusTrain", 13, "", "NexusTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1020, "NexusTrain", 14, "", "NexusTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1021, "NexusTrain", 15, "", "NexusTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1022, "NexusTrain", 16, "", "NexusTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1023, "NexusTrain", 17, "", "NexusTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1024, "NexusTrain", 18, "", "NexusTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1025, "NexusTrain", 19, "", "NexusTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1026, "NexusTrain", 20, "", "NexusTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1027, "NexusTrain", 21, "", "NexusTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1028, "NexusTrain", 22, "", "NexusTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1029, "NexusTrain", 23, "", "NexusTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1030, "NexusTrain", 24, "", "NexusTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1031, "NexusTrain", 25, "", "NexusTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1032, "NexusTrain", 26, "", "NexusTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1033, "NexusTrain", 27, "", "NexusTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1034, "NexusTrain", 28, "", "NexusTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1035, "NexusTrain", 29, "", "NexusTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1036, "PsiStorm", 0, "PsiStorm", "Effect PsiStorm", "X", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { true, 1037, "PsiStorm", 1, "", "PsiStorm_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1038, "HangarQueue5", 0, "Cancel", "Cancel HangarQueue5", "B", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1039, "HangarQueue5", 1, "CancelSlot", "CancelSlot HangarQueue5", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1040, "BroodLordQueue2", 0, "Cancel", "BroodLordQueue2_0", "", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1041, "BroodLordQueue2", 1, "CancelSlot", "BroodLordQueue2_1", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1042, "CarrierHangar", 0, "Interceptor", "Build Interceptors", "Z", 0, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1043, "CarrierHangar", 1, "", "CarrierHangar_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1044, "CarrierHangar", 2, "", "CarrierHangar_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1045, "CarrierHangar", 3, "", "CarrierHangar_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1046, "CarrierHangar", 4, "", "CarrierHangar_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1047, "CarrierHangar", 5, "", "CarrierHangar_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1048, "CarrierHangar", 6, "", "CarrierHangar_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1049, "CarrierHangar", 7, "", "CarrierHangar_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1050, "CarrierHangar", 8, "", "CarrierHangar_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1051, "CarrierHangar", 9, "", "CarrierHangar_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1052, "CarrierHangar", 10, "", "CarrierHangar_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1053, "CarrierHangar", 11, "", "CarrierHangar_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1054, "CarrierHangar", 12, "", "CarrierHangar_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1055, "CarrierHangar", 13, "", "CarrierHangar_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1056, "CarrierHangar", 14, "", "CarrierHangar_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1057, "CarrierHangar", 15, "", "CarrierHangar_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1058, "CarrierHangar", 16, "", "CarrierHangar_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1059, "CarrierHangar", 17, "", "CarrierHangar_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1060, "CarrierHangar", 18, "", "CarrierHangar_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1061, "CarrierHangar", 19, "", "CarrierHangar_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1062, "ForgeResearch", 0, "ProtossGroundWeaponsLevel1", "Research ProtossGroundWeaponsLevel1", "Q", 3695, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1063, "ForgeResearch", 1, "ProtossGroundWeaponsLevel2", "Research ProtossGroundWeaponsLevel2", "Q", 3695, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1064, "ForgeResearch", 2, "ProtossGroundWeaponsLevel3", "Research ProtossGroundWeaponsLevel3", "Q", 3695, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1065, "ForgeResearch", 3, "ProtossGroundArmorLevel1", "Research ProtossGroundArmorLevel1", "W", 3694, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1066, "ForgeResearch", 4, "ProtossGroundArmorLevel2", "Research ProtossGroundArmorLevel2", "W", 3694, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1067, "ForgeResearch", 5, "ProtossGroundArmorLevel3", "Research ProtossGroundArmorLevel3", "W", 3694, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1068, "ForgeResearch", 6, "ProtossShieldsLevel1", "Research ProtossShieldsLevel1", "E", 3696, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1069, "ForgeResearch", 7, "ProtossShieldsLevel2", "Research ProtossShieldsLevel2", "E", 3696, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1070, "ForgeResearch", 8, "ProtossShieldsLevel3", "Research ProtossShieldsLevel3", "E", 3696, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1071, "ForgeResearch", 9, "", "ForgeResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1072, "ForgeResearch", 10, "", "ForgeResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1073, "ForgeResearch", 11, "", "ForgeResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1074, "ForgeResearch", 12, "", "ForgeResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1075, "ForgeResearch", 13, "", "ForgeResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1076, "ForgeResearch", 14, "", "ForgeResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1077, "ForgeResearch", 15, "", "ForgeResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1078, "ForgeResearch", 16, "", "ForgeResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1079, "ForgeResearch", 17, "", "ForgeResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1080, "ForgeResearch", 18, "", "ForgeResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1081, "ForgeResearch", 19, "", "ForgeResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1082, "ForgeResearch", 20, "", "ForgeResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1083, "ForgeResearch", 21, "", "ForgeResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1084, "ForgeResearch", 22, "", "ForgeResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1085, "ForgeResearch", 23, "", "ForgeResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1086, "ForgeResearch", 24, "", "ForgeResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1087, "ForgeResearch", 25, "", "ForgeResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1088, "ForgeResearch", 26, "", "ForgeResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1089, "ForgeResearch", 27, "", "ForgeResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1090, "ForgeResearch", 28, "", "ForgeResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1091, "ForgeResearch", 29, "", "ForgeResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1092, "RoboticsBayResearch", 0, "", "RoboticsBayResearch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1093, "RoboticsBayResearch", 1, "ResearchGraviticBooster", "Research GraviticBooster", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1094, "RoboticsBayResearch", 2, "ResearchGraviticDrive", "Research GraviticDrive", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1095, "RoboticsBayResearch", 3, "", "RoboticsBayResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1096, "RoboticsBayResearch", 4, "", "RoboticsBayResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1097, "RoboticsBayResearch", 5, "ResearchExtendedThermalLance", "Research ExtendedThermalLance", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1098, "RoboticsBayResearch", 6, "", "RoboticsBayResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1099, "RoboticsBayResearch", 7, "ResearchImmortalRevive", "Research ResearchImmortalRevive", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1100, "RoboticsBayResearch", 8, "", "RoboticsBayResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1101, "RoboticsBayResearch", 9, "", "RoboticsBayResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1102, "RoboticsBayResearch", 10, "", "RoboticsBayResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1103, "RoboticsBayResearch", 11, "", "RoboticsBayResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1104, "RoboticsBayResearch", 12, "", "RoboticsBayResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1105, "RoboticsBayResearch", 13, "", "RoboticsBayResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1106, "RoboticsBayResearch", 14, "", "RoboticsBayResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1107, "RoboticsBayResearch", 15, "", "RoboticsBayResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1108, "RoboticsBayResearch", 16, "", "RoboticsBayResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1109, "RoboticsBayResearch", 17, "", "RoboticsBayResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1110, "RoboticsBayResearch", 18, "", "RoboticsBayResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1111, "RoboticsBayResearch", 19, "", "RoboticsBayResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1112, "RoboticsBayResearch", 20, "", "RoboticsBayResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1113, "RoboticsBayResearch", 21, "", "RoboticsBayResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1114, "RoboticsBayResearch", 22, "", "RoboticsBayResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1115, "RoboticsBayResearch", 23, "", "RoboticsBayResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1116, "RoboticsBayResearch", 24, "", "RoboticsBayResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1117, "RoboticsBayResearch", 25, "", "RoboticsBayResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1118, "RoboticsBayResearch", 26, "", "RoboticsBayResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1119, "RoboticsBayResearch", 27, "", "RoboticsBayResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1120, "RoboticsBayResearch", 28, "", "RoboticsBayResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1121, "RoboticsBayResearch", 29, "", "RoboticsBayResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1122, "TemplarArchivesResearch", 0, "", "TemplarArchivesResearch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1123, "TemplarArchivesResearch", 1, "", "TemplarArchivesResearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1124, "TemplarArchivesResearch", 2, "", "TemplarArchivesResearch_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1125, "TemplarArchivesResearch", 3, "", "TemplarArchivesResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1126, "TemplarArchivesResearch", 4, "ResearchPsiStorm", "Research PsiStorm", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1127, "TemplarArchivesResearch", 5, "", "TemplarArchivesResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1128, "TemplarArchivesResearch", 6, "", "TemplarArchivesResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1129, "TemplarArchivesResearch", 7, "", "TemplarArchivesResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1130, "TemplarArchivesResearch", 8, "", "TemplarArchivesResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1131, "TemplarArchivesResearch", 9, "", "TemplarArchivesResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1132, "TemplarArchivesResearch", 10, "", "TemplarArchivesResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1133, "TemplarArchivesResearch", 11, "", "TemplarArchivesResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1134, "TemplarArchivesResearch", 12, "", "TemplarArchivesResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1135, "TemplarArchivesResearch", 13, "", "TemplarArchivesResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1136, "TemplarArchivesResearch", 14, "", "TemplarArchivesResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1137, "TemplarArchivesResearch", 15, "", "TemplarArchivesResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1138, "TemplarArchivesResearch", 16, "", "TemplarArchivesResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1139, "TemplarArchivesResearch", 17, "", "TemplarArchivesResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1140, "TemplarArchivesResearch", 18, "", "TemplarArchivesResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1141, "TemplarArchivesResearch", 19, "", "TemplarArchivesResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1142, "TemplarArchivesResearch", 20, "", "TemplarArchivesResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1143, "TemplarArchivesResearch", 21, "", "TemplarArchivesResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1144, "TemplarArchivesResearch", 22, "", "TemplarArchivesResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1145, "TemplarArchivesResearch", 23, "", "TemplarArchivesResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1146, "TemplarArchivesResearch", 24, "", "TemplarArchivesResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1147, "TemplarArchivesResearch", 25, "", "TemplarArchivesResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1148, "TemplarArchivesResearch", 26, "", "TemplarArchivesResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1149, "TemplarArchivesResearch", 27, "", "TemplarArchivesResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1150, "TemplarArchivesResearch", 28, "", "TemplarArchivesResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1151, "TemplarArchivesResearch", 29, "", "TemplarArchivesResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1152, "ZergBuild", 0, "Hatchery", "Build Hatchery", "ZQ", 0, 0, 0, 2, false, false, true, 2.5f, false, 0.0f },
+    { true, 1153, "ZergBuild", 1, "CreepTumor", "Build CreepTumor", "", 0, 0, 0, 2, false, false, true, 0.5f, false, 0.0f },
+    { true, 1154, "ZergBuild", 2, "Extractor", "Build Extractor", "ZW", 0, 0, 0, 3, false, false, true, 1.5f, false, 0.0f },
+    { true, 1155, "ZergBuild", 3, "SpawningPool", "Build SpawningPool", "ZA", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1156, "ZergBuild", 4, "EvolutionChamber", "Build EvolutionChamber", "ZS", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1157, "ZergBuild", 5, "HydraliskDen", "Build HydraliskDen", "XQ", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1158, "ZergBuild", 6, "Spire", "Build Spire", "XA", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 1159, "ZergBuild", 7, "UltraliskCavern", "Build UltraliskCavern", "XZ", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1160, "ZergBuild", 8, "InfestationPit", "Build InfestationPit", "XW", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1161, "ZergBuild", 9, "NydusNetwork", "Build NydusNetwork", "XS", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1162, "ZergBuild", 10, "BanelingNest", "Build BanelingNest", "ZF", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1163, "ZergBuild", 11, "MutateintoLurkerDen", "Build LurkerDen", "XE", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1164, "ZergBuild", 12, "", "ZergBuild_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1165, "ZergBuild", 13, "RoachWarren", "Build RoachWarren", "ZD", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1166, "ZergBuild", 14, "SpineCrawler", "Build SpineCrawler", "ZZ", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 1167, "ZergBuild", 15, "SporeCrawler", "Build SporeCrawler", "ZX", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 1168, "ZergBuild", 16, "", "ZergBuild_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1169, "ZergBuild", 17, "", "ZergBuild_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1170, "ZergBuild", 18, "", "ZergBuild_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1171, "ZergBuild", 19, "", "ZergBuild_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1172, "ZergBuild", 20, "", "ZergBuild_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1173, "ZergBuild", 21, "", "ZergBuild_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1174, "ZergBuild", 22, "", "ZergBuild_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1175, "ZergBuild", 23, "", "ZergBuild_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1176, "ZergBuild", 24, "", "ZergBuild_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1177, "ZergBuild", 25, "", "ZergBuild_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1178, "ZergBuild", 26, "", "ZergBuild_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1179, "ZergBuild", 27, "", "ZergBuild_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1180, "ZergBuild", 28, "", "ZergBuild_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1181, "ZergBuild", 29, "", "ZergBuild_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1182, "ZergBuild", 30, "Cancel", "ZergBuild_30", "", 3660, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1183, "DroneHarvest", 0, "Gather", "Harvest Gather Drone", "A", 3666, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 1184, "DroneHarvest", 1, "ReturnCargo", "Harvest Return Drone", "S", 3667, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1185, "DroneHarvest", 2, "", "DroneHarvest_2", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1186, "evolutionchamberresearch", 0, "zergmeleeweapons1", "Research ZergMeleeWeaponsLevel1", "Q", 3705, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1187, "evolutionchamberresearch", 1, "zergmeleeweapons2", "Research ZergMeleeWeaponsLevel2", "Q", 3705, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1188, "evolutionchamberresearch", 2, "zergmeleeweapons3", "Research ZergMeleeWeaponsLevel3", "Q", 3705, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1189, "evolutionchamberresearch", 3, "zerggroundarmor1", "Research ZergGroundArmorLevel1", "E", 3704, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1190, "evolutionchamberresearch", 4, "zerggroundarmor2", "Research ZergGroundArmorLevel2", "E", 3704, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1191, "evolutionchamberresearch", 5, "zerggroundarmor3", "Research ZergGroundArmorLevel3", "E", 3704, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1192, "evolutionchamberresearch", 6, "zergmissileweapons1", "Research ZergMissileWeaponsLevel1", "W", 3706, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1193, "evolutionchamberresearch", 7, "zergmissileweapons2", "Research ZergMissileWeaponsLevel2", "W", 3706, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1194, "evolutionchamberresearch", 8, "zergmissileweapons3", "Research ZergMissileWeaponsLevel3", "W", 3706, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1195, "evolutionchamberresearch", 9, "", "evolutionchamberresearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1196, "evolutionchamberresearch", 10, "", "evolutionchamberresearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1197, "evolutionchamberresearch", 11, "", "evolutionchamberresearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1198, "evolutionchamberresearch", 12, "", "evolutionchamberresearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1199, "evolutionchamberresearch", 13, "", "evolutionchamberresearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1200, "evolutionchamberresearch", 14, "", "evolutionchamberresearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1201, "evolutionchamberresearch", 15, "", "evolutionchamberresearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1202, "evolutionchamberresearch", 16, "", "evolutionchamberresearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1203, "evolutionchamberresearch", 17, "", "evolutionchamberresearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1204, "evolutionchamberresearch", 18, "", "evolutionchamberresearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1205, "evolutionchamberresearch", 19, "", "evolutionchamberresearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1206, "evolutionchamberresearch", 20, "", "evolutionchamberresearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1207, "evolutionchamberresearch", 21, "", "evolutionchamberresearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1208, "evolutionchamberresearch", 22, "", "evolutionchamberresearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1209, "evolutionchamberresearch", 23, "", "evolutionchamberresearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1210, "evolutionchamberresearch", 24, "", "evolutionchamberresearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1211, "evolutionchamberresearch", 25, "", "evolutionchamberresearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1212, "evolutionchamberresearch", 26, "", "evolutionchamberresearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1213, "evolutionchamberresearch", 27, "", "evolutionchamberresearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1214, "evolutionchamberresearch", 28, "", "evolutionchamberresearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1215, "evolutionchamberresearch", 29, "", "evolutionchamberresearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1216, "UpgradeToLair", 0, "Lair", "Morph Lair", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1217, "UpgradeToLair", 1, "CancelMutateMorph", "Cancel MorphLair", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1218, "UpgradeToHive", 0, "Hive", "Morph Hive", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1219, "UpgradeToHive", 1, "CancelMutateMorph", "Cancel MorphHive", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1220, "UpgradeToGreaterSpire", 0, "GreaterSpire", "Morph GreaterSpire", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1221, "UpgradeToGreaterSpire", 1, "CancelMutateMorph", "Cancel MorphGreaterSpire", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1222, "LairResearch", 0, "", "LairResearch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1223, "LairResearch", 1, "overlordspeed", "Research PneumatizedCarapace", "A", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1224, "LairResearch", 2, "EvolveVentralSacks", "Research EvolveVentralSacks", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1225, "LairResearch", 3, "ResearchBurrow", "Research Burrow", "T", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1226, "LairResearch", 4, "", "LairResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1227, "LairResearch", 5, "", "LairResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1228, "LairResearch", 6, "", "LairResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1229, "LairResearch", 7, "", "LairResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1230, "LairResearch", 8, "", "LairResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1231, "LairResearch", 9, "", "LairResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1232, "LairResearch", 10, "", "LairResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1233, "LairResearch", 11, "", "LairResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1234, "LairResearch", 12, "", "LairResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1235, "LairResearch", 13, "", "LairResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1236, "LairResearch", 14, "", "LairResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1237, "LairResearch", 15, "", "LairResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1238, "LairResearch", 16, "", "LairResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1239, "LairResearch", 17, "", "LairResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1240, "LairResearch", 18, "", "LairResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1241, "LairResearch", 19, "", "LairResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1242, "LairResearch", 20, "", "LairResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1243, "LairResearch", 21, "", "LairResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1244, "LairResearch", 22, "", "LairResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1245, "LairResearch", 23, "", "LairResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1246, "LairResearch", 24, "", "LairResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1247, "LairResearch", 25, "", "LairResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1248, "LairResearch", 26, "", "LairResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1249, "LairResearch", 27, "", "LairResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1250, "LairResearch", 28, "", "LairResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1251, "LairResearch", 29, "", "LairResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1252, "SpawningPoolResearch", 0, "zerglingattackspeed", "Research ZerglingAdrenalGlands", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1253, "SpawningPoolResearch", 1, "zerglingmovementspeed", "Research ZerglingMetabolicBoost", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1254, "SpawningPoolResearch", 2, "", "SpawningPoolResearch_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1255, "SpawningPoolResearch", 3, "", "SpawningPoolResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1256, "SpawningPoolResearch", 4, "", "SpawningPoolResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1257, "SpawningPoolResearch", 5, "", "SpawningPoolResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1258, "SpawningPoolResearch", 6, "", "SpawningPoolResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1259, "SpawningPoolResearch", 7, "", "SpawningPoolResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1260, "SpawningPoolResearch", 8, "", "SpawningPoolResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1261, "SpawningPoolResearch", 9, "", "SpawningPoolResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1262, "SpawningPoolResearch", 10, "", "SpawningPoolResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1263, "SpawningPoolResearch", 11, "", "SpawningPoolResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1264, "SpawningPoolResearch", 12, "", "SpawningPoolResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1265, "SpawningPoolResearch", 13, "", "SpawningPoolResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1266, "SpawningPoolResearch", 14, "", "SpawningPoolResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1267, "SpawningPoolResearch", 15, "", "SpawningPoolResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1268, "SpawningPoolResearch", 16, "", "SpawningPoolResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1269, "SpawningPoolResearch", 17, "", "SpawningPoolResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1270, "SpawningPoolResearch", 18, "", "SpawningPoolResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1271, "SpawningPoolResearch", 19, "", "SpawningPoolResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1272, "SpawningPoolResearch", 20, "", "SpawningPoolResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1273, "SpawningPoolResearch", 21, "", "SpawningPoolResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1274, "SpawningPoolResearch", 22, "", "SpawningPoolResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1275, "SpawningPoolResearch", 23, "", "SpawningPoolResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1276, "SpawningPoolResearch", 24, "", "SpawningPoolResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1277, "SpawningPoolResearch", 25, "", "SpawningPoolResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1278, "SpawningPoolResearch", 26, "", "SpawningPoolResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1279, "SpawningPoolResearch", 27, "", "SpawningPoolResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1280, "SpawningPoolResearch", 28, "", "SpawningPoolResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1281, "SpawningPoolResearch", 29, "", "SpawningPoolResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1282, "HydraliskDenResearch", 0, "EvolveGroovedSpines", "Research GroovedSpines", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1283, "HydraliskDenResearch", 1, "EvolveMuscularAugments", "Research MuscularAugments", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1284, "HydraliskDenResearch", 2, "", "HydraliskDenResearch_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1285, "HydraliskDenResearch", 3, "", "HydraliskDenResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1286, "HydraliskDenResearch", 4, "ResearchLurkerRange", "Research ResearchLurkerRange", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1287, "HydraliskDenResearch", 5, "", "HydraliskDenResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1288, "HydraliskDenResearch", 6, "", "HydraliskDenResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1289, "HydraliskDenResearch", 7, "", "HydraliskDenResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1290, "HydraliskDenResearch", 8, "", "HydraliskDenResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1291, "HydraliskDenResearch", 9, "", "HydraliskDenResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1292, "HydraliskDenResearch", 10, "", "HydraliskDenResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1293, "HydraliskDenResearch", 11, "", "HydraliskDenResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1294, "HydraliskDenResearch", 12, "", "HydraliskDenResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1295, "HydraliskDenResearch", 13, "", "HydraliskDenResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1296, "HydraliskDenResearch", 14, "", "HydraliskDenResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1297, "HydraliskDenResearch", 15, "", "HydraliskDenResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1298, "HydraliskDenResearch", 16, "", "HydraliskDenResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1299, "HydraliskDenResearch", 17, "", "HydraliskDenResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1300, "HydraliskDenResearch", 18, "", "HydraliskDenResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1301, "HydraliskDenResearch", 19, "", "HydraliskDenResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1302, "HydraliskDenResearch", 20, "", "HydraliskDenResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1303, "HydraliskDenResearch", 21, "", "HydraliskDenResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1304, "HydraliskDenResearch", 22, "", "HydraliskDenResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1305, "HydraliskDenResearch", 23, "", "HydraliskDenResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1306, "HydraliskDenResearch", 24, "", "HydraliskDenResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1307, "HydraliskDenResearch", 25, "", "HydraliskDenResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1308, "HydraliskDenResearch", 26, "", "HydraliskDenResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1309, "HydraliskDenResearch", 27, "", "HydraliskDenResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1310, "HydraliskDenResearch", 28, "", "HydraliskDenResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1311, "HydraliskDenResearch", 29, "", "HydraliskDenResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1312, "SpireResearch", 0, "zergflyerattack1", "Research ZergFlyerAttackLevel1", "Q", 3703, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1313, "SpireResearch", 1, "zergflyerattack2", "Research ZergFlyerAttackLevel2", "Q", 3703, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1314, "SpireResearch", 2, "zergflyerattack3", "Research ZergFlyerAttackLevel3", "Q", 3703, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1315, "SpireResearch", 3, "zergflyerarmor1", "Research ZergFlyerArmorLevel1", "W", 3702, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1316, "SpireResearch", 4, "zergflyerarmor2", "Research ZergFlyerArmorLevel2", "W", 3702, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1317, "SpireResearch", 5, "zergflyerarmor3", "Research ZergFlyerArmorLevel3", "W", 3702, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1318, "SpireResearch", 6, "", "SpireResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1319, "SpireResearch", 7, "", "SpireResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1320, "SpireResearch", 8, "", "SpireResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1321, "SpireResearch", 9, "", "SpireResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1322, "SpireResearch", 10, "", "SpireResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1323, "SpireResearch", 11, "", "SpireResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1324, "SpireResearch", 12, "", "SpireResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1325, "SpireResearch", 13, "", "SpireResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1326, "SpireResearch", 14, "", "SpireResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1327, "SpireResearch", 15, "", "SpireResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1328, "SpireResearch", 16, "", "SpireResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1329, "SpireResearch", 17, "", "SpireResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1330, "SpireResearch", 18, "", "SpireResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1331, "SpireResearch", 19, "", "SpireResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1332, "SpireResearch", 20, "", "SpireResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1333, "SpireResearch", 21, "", "SpireResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1334, "SpireResearch", 22, "", "SpireResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1335, "SpireResearch", 23, "", "SpireResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1336, "SpireResearch", 24, "", "SpireResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1337, "SpireResearch", 25, "", "SpireResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1338, "SpireResearch", 26, "", "SpireResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1339, "SpireResearch", 27, "", "SpireResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1340, "SpireResearch", 28, "", "SpireResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1341, "SpireResearch", 29, "", "SpireResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1342, "LarvaTrain", 0, "Drone", "Train Drone", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1343, "LarvaTrain", 1, "Zergling", "Train Zergling", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1344, "LarvaTrain", 2, "Overlord", "Train Overlord", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1345, "LarvaTrain", 3, "Hydralisk", "Train Hydralisk", "A", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1346, "LarvaTrain", 4, "Mutalisk", "Train Mutalisk", "S", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1347, "LarvaTrain", 5, "", "LarvaTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1348, "LarvaTrain", 6, "Ultralisk", "Train Ultralisk", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1349, "LarvaTrain", 7, "", "LarvaTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1350, "LarvaTrain", 8, "", "LarvaTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1351, "LarvaTrain", 9, "Roach", "Train Roach", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1352, "LarvaTrain", 10, "Infestor", "Train Infestor", "F", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1353, "LarvaTrain", 11, "Corruptor", "Train Corruptor", "D", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1354, "LarvaTrain", 12, "Viper", "Train Viper", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1355, "LarvaTrain", 13, "", "LarvaTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1356, "LarvaTrain", 14, "SwarmHostMP", "Train SwarmHost", "G", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1357, "LarvaTrain", 15, "", "LarvaTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1358, "LarvaTrain", 16, "", "LarvaTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1359, "LarvaTrain", 17, "", "LarvaTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1360, "LarvaTrain", 18, "", "LarvaTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1361, "LarvaTrain", 19, "", "LarvaTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1362, "LarvaTrain", 20, "", "LarvaTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1363, "LarvaTrain", 21, "", "LarvaTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1364, "LarvaTrain", 22, "", "LarvaTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1365, "LarvaTrain", 23, "", "LarvaTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1366, "LarvaTrain", 24, "", "LarvaTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1367, "LarvaTrain", 25, "", "LarvaTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1368, "LarvaTrain", 26, "", "LarvaTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1369, "LarvaTrain", 27, "", "LarvaTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1370, "LarvaTrain", 28, "", "LarvaTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1371, "LarvaTrain", 29, "", "LarvaTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1372, "MorphToBroodLord", 0, "BroodLord", "Morph BroodLord", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1373, "MorphToBroodLord", 1, "Cancel", "Cancel MorphBroodlord", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1374, "BurrowBanelingDown", 0, "BurrowDown", "BurrowDown Baneling", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1375, "BurrowBanelingDown", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1376, "BurrowBanelingUp", 0, "BurrowUp", "BurrowUp Baneling", "B", 3662, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1377, "BurrowBanelingUp", 1, "", "BurrowBanelingUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1378, "BurrowDroneDown", 0, "BurrowDown", "BurrowDown Drone", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1379, "BurrowDroneDown", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1380, "BurrowDroneUp", 0, "BurrowUp", "BurrowUp Drone", "B", 3662, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1381, "BurrowDroneUp", 1, "", "BurrowDroneUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1382, "BurrowHydraliskDown", 0, "BurrowDown", "BurrowDown Hydralisk", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1383, "BurrowHydraliskDown", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1384, "BurrowHydraliskUp", 0, "BurrowUp", "BurrowUp Hydralisk", "B", 3662, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1385, "BurrowHydraliskUp", 1, "", "BurrowHydraliskUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1386, "BurrowRoachDown", 0, "BurrowDown", "BurrowDown Roach", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1387, "BurrowRoachDown", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1388, "BurrowRoachUp", 0, "BurrowUp", "BurrowUp Roach", "B", 3662, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1389, "BurrowRoachUp", 1, "", "BurrowRoachUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1390, "BurrowZerglingDown", 0, "BurrowDown", "BurrowDown Zergling", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1391, "BurrowZerglingDown", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1392, "BurrowZerglingUp", 0, "BurrowUp", "BurrowUp Zergling", "B", 3662, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1393, "BurrowZerglingUp", 1, "", "BurrowZerglingUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1394, "BurrowInfestorTerranDown", 0, "BurrowDown", "BurrowDown InfestorTerran", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1395, "BurrowInfestorTerranDown", 1, "", "BurrowInfestorTerranDown_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1396, "BurrowInfestorTerranUp", 0, "BurrowUp", "BurrowUp InfestorTerran", "B", 3662, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1397, "BurrowInfestorTerranUp", 1, "", "BurrowInfestorTerranUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1398, "RedstoneLavaCritterBurrow", 0, "BurrowDown", "Morph BurrowDown", "G", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1399, "RedstoneLavaCritterBurrow", 1, "", "RedstoneLavaCritterBurrow_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1400, "RedstoneLavaCritterInjuredBurrow", 0, "BurrowDown", "Morph BurrowDown", "G", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1401, "RedstoneLavaCritterInjuredBurrow", 1, "", "RedstoneLavaCritterInjuredBurrow_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1402, "RedstoneLavaCritterUnburrow", 0, "BurrowUp", "Morph BurrowUp", "G", 3662, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1403, "RedstoneLavaCritterUnburrow", 1, "", "RedstoneLavaCritterUnburrow_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1404, "RedstoneLavaCritterInjuredUnburrow", 0, "BurrowUp", "Morph BurrowUp", "G", 3662, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1405, "RedstoneLavaCritterInjuredUnburrow", 1, "", "RedstoneLavaCritterInjuredUnburrow_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1406, "OverlordTransport", 0, "OverlordTransportLoad", "Load Overlord", "C", 3668, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 1407, "OverlordTransport", 1, "", "OverlordTransport_1", "", 3664, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1408, "OverlordTransport", 2, "OverlordTransportUnload", "UnloadAllAt Overlord", "V", 3669, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 1409, "OverlordTransport", 3, "", "UnloadUnit Overlord", "", 3670, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1410, "OverlordTransport", 4, "", "OverlordTransport_4", "", 3663, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1411, "Mergeable", 0, "Cancel", "Mergeable_0", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1412, "Warpable", 0, "Cancel", "Warpable_0", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1413, "WarpGateTrain", 0, "Zealot", "TrainWarp Zealot", "Q", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1414, "WarpGateTrain", 1, "Stalker", "TrainWarp Stalker", "E", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1415, "WarpGateTrain", 2, "", "WarpGateTrain_2", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1416, "WarpGateTrain", 3, "HighTemplar", "TrainWarp HighTemplar", "A", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1417, "WarpGateTrain", 4, "DarkTemplar", "TrainWarp DarkTemplar", "S", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1418, "WarpGateTrain", 5, "Sentry", "TrainWarp Sentry", "W", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1419, "WarpGateTrain", 6, "WarpInAdept", "TrainWarp Adept", "R", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1420, "WarpGateTrain", 7, "", "WarpGateTrain_7", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1421, "WarpGateTrain", 8, "", "WarpGateTrain_8", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1422, "WarpGateTrain", 9, "", "WarpGateTrain_9", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1423, "WarpGateTrain", 10, "", "WarpGateTrain_10", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1424, "WarpGateTrain", 11, "", "WarpGateTrain_11", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1425, "WarpGateTrain", 12, "", "WarpGateTrain_12", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1426, "WarpGateTrain", 13, "", "WarpGateTrain_13", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1427, "WarpGateTrain", 14, "", "WarpGateTrain_14", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1428, "WarpGateTrain", 15, "", "WarpGateTrain_15", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1429, "WarpGateTrain", 16, "", "WarpGateTrain_16", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1430, "WarpGateTrain", 17, "", "WarpGateTrain_17", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1431, "WarpGateTrain", 18, "", "WarpGateTrain_18", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1432, "WarpGateTrain", 19, "", "WarpGateTrain_19", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1433, "BurrowQueenDown", 0, "BurrowDown", "BurrowDown Queen", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1434, "BurrowQueenDown", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1435, "BurrowQueenUp", 0, "BurrowUp", "BurrowUp Queen", "B", 3662, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1436, "BurrowQueenUp", 1, "", "BurrowQueenUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1437, "NydusCanalTransport", 0, "NydusCanalLoad", "Load NydusNetwork", "Z", 3668, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 1438, "NydusCanalTransport", 1, "NydusCanalUnloadAll", "UnloadAll NydasNetwork", "X", 3664, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1439, "NydusCanalTransport", 2, "", "NydusCanalTransport_2", "", 3669, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 1440, "NydusCanalTransport", 3, "", "UnloadUnit NydasNetwork", "", 3670, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1441, "NydusCanalTransport", 4, "", "NydusCanalTransport_4", "", 3663, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1442, "Blink", 0, "Blink", "Effect Blink Stalker", "Z", 3687, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 1443, "Blink", 1, "", "Blink_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1444, "BurrowInfestorDown", 0, "BurrowDown", "BurrowDown Infestor", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1445, "BurrowInfestorDown", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1446, "BurrowInfestorUp", 0, "BurrowUp", "BurrowUp Infestor", "B", 3662, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1447, "BurrowInfestorUp", 1, "", "BurrowInfestorUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1448, "MorphToOverseer", 0, "MorphToOverseer", "Morph Overseer", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1449, "MorphToOverseer", 1, "Cancel", "Cancel MorphOverseer", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1450, "UpgradeToPlanetaryFortress", 0, "PlanetaryFortress", "Morph PlanetaryFortress", "T", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1451, "UpgradeToPlanetaryFortress", 1, "CancelUpgradeMorph", "Cancel MorphPlanetaryFortress", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1452, "InfestationPitResearch", 0, "", "InfestationPitResearch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1453, "InfestationPitResearch", 1, "", "InfestationPitResearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1454, "InfestationPitResearch", 2, "EvolveInfestorEnergyUpgrade", "Research PathogenGlands", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1455, "InfestationPitResearch", 3, "ResearchNeuralParasite", "Research NeuralParasite", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1456, "InfestationPitResearch", 4, "ResearchLocustLifetimeIncrease", "Research ResearchLocustLifetimeIncrease", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1457, "InfestationPitResearch", 5, "", "InfestationPitResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1458, "InfestationPitResearch", 6, "", "InfestationPitResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1459, "InfestationPitResearch", 7, "", "InfestationPitResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1460, "InfestationPitResearch", 8, "", "InfestationPitResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1461, "InfestationPitResearch", 9, "", "InfestationPitResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1462, "InfestationPitResearch", 10, "", "InfestationPitResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1463, "InfestationPitResearch", 11, "", "InfestationPitResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1464, "InfestationPitResearch", 12, "", "InfestationPitResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1465, "InfestationPitResearch", 13, "", "InfestationPitResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1466, "InfestationPitResearch", 14, "", "InfestationPitResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1467, "InfestationPitResearch", 15, "", "InfestationPitResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1468, "InfestationPitResearch", 16, "", "InfestationPitResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1469, "InfestationPitResearch", 17, "", "InfestationPitResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1470, "InfestationPitResearch", 18, "", "InfestationPitResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1471, "InfestationPitResearch", 19, "", "InfestationPitResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1472, "InfestationPitResearch", 20, "", "InfestationPitResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1473, "InfestationPitResearch", 21, "", "InfestationPitResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1474, "InfestationPitResearch", 22, "", "InfestationPitResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1475, "InfestationPitResearch", 23, "", "InfestationPitResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1476, "InfestationPitResearch", 24, "", "InfestationPitResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1477, "InfestationPitResearch", 25, "", "InfestationPitResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1478, "InfestationPitResearch", 26, "", "InfestationPitResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1479, "InfestationPitResearch", 27, "", "InfestationPitResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1480, "InfestationPitResearch", 28, "", "InfestationPitResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1481, "InfestationPitResearch", 29, "", "InfestationPitResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1482, "BanelingNestResearch", 0, "EvolveCentrificalHooks", "Research CentrifugalHooks", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1483, "BanelingNestResearch", 1, "", "BanelingNestResearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1484, "BanelingNestResearch", 2, "", "BanelingNestResearch_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1485, "BanelingNestResearch", 3, "", "BanelingNestResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1486, "BanelingNestResearch", 4, "", "BanelingNestResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1487, "BanelingNestResearch", 5, "", "BanelingNestResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1488, "BanelingNestResearch", 6, "", "BanelingNestResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1489, "BanelingNestResearch", 7, "", "BanelingNestResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1490, "BanelingNestResearch", 8, "", "BanelingNestResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1491, "BanelingNestResearch", 9, "", "BanelingNestResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1492, "BanelingNestResearch", 10, "", "BanelingNestResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1493, "BanelingNestResearch", 11, "", "BanelingNestResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1494, "BanelingNestResearch", 12, "", "BanelingNestResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1495, "BanelingNestResearch", 13, "", "BanelingNestResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1496, "BanelingNestResearch", 14, "", "BanelingNestResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1497, "BanelingNestResearch", 15, "", "BanelingNestResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1498, "BanelingNestResearch", 16, "", "BanelingNestResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1499, "BanelingNestResearch", 17, "", "BanelingNestResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1500, "BanelingNestResearch", 18, "", "BanelingNestResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1501, "BanelingNestResearch", 19, "", "BanelingNestResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1502, "BanelingNestResearch", 20, "", "BanelingNestResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1503, "BanelingNestResearch", 21, "", "BanelingNestResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1504, "BanelingNestResearch", 22, "", "BanelingNestResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1505, "BanelingNestResearch", 23, "", "BanelingNestResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1506, "BanelingNestResearch", 24, "", "BanelingNestResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1507, "BanelingNestResearch", 25, "", "BanelingNestResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1508, "BanelingNestResearch", 26, "", "BanelingNestResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1509, "BanelingNestResearch", 27, "", "BanelingNestResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1510, "BanelingNestResearch", 28, "", "BanelingNestResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1511, "BanelingNestResearch", 29, "", "BanelingNestResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1512, "BurrowUltraliskDown", 0, "BurrowDown", "BurrowDown Ultralisk", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1513, "BurrowUltraliskDown", 1, "", "BurrowUltraliskDown_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1514, "BurrowUltraliskUp", 0, "BurrowUp", "BurrowUp Ultralisk", "B", 3662, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1515, "BurrowUltraliskUp", 1, "", "BurrowUltraliskUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1516, "UpgradeToOrbital", 0, "OrbitalCommand", "Morph OrbitalCommand", "R", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1517, "UpgradeToOrbital", 1, "CancelUpgradeMorph", "Cancel MorphOrbital", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1518, "UpgradeToWarpGate", 0, "UpgradeToWarpGate", "Morph WarpGate", "Z", 0, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1519, "UpgradeToWarpGate", 1, "Cancel", "Morph Cancel", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1520, "MorphBackToGateway", 0, "MorphBackToGateway", "Morph Gateway", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1521, "MorphBackToGateway", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1522, "OrbitalLiftOff", 0, "Lift", "Lift OrbitalCommand", "V", 3679, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1523, "OrbitalLiftOff", 1, "", "OrbitalLiftOff_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1524, "OrbitalCommandLand", 0, "Land", "Land OrbitalCommand", "V", 3678, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1525, "OrbitalCommandLand", 1, "", "OrbitalCommandLand_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1526, "ForceField", 0, "ForceField", "Effect ForceField", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { true, 1527, "ForceField", 1, "Cancel", "ForceField_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1528, "PhasingMode", 0, "PhasingMode", "Morph WarpPrismPhasingMode", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1529, "PhasingMode", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1530, "TransportMode", 0, "TransportMode", "Morph WarpPrismTransportMode", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1531, "TransportMode", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1532, "FusionCoreResearch", 0, "ResearchBattlecruiserSpecializations", "Research BattlecruiserWeaponRefit", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1533, "FusionCoreResearch", 1, "", "FusionCoreResearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1534, "FusionCoreResearch", 2, "", "FusionCoreResearch_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1535, "FusionCoreResearch", 3, "", "FusionCoreResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1536, "FusionCoreResearch", 4, "", "FusionCoreResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1537, "FusionCoreResearch", 5, "", "FusionCoreResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1538, "FusionCoreResearch", 6, "", "FusionCoreResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1539, "FusionCoreResearch", 7, "", "FusionCoreResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1540, "FusionCoreResearch", 8, "", "FusionCoreResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1541, "FusionCoreResearch", 9, "", "FusionCoreResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1542, "FusionCoreResearch", 10, "", "FusionCoreResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1543, "FusionCoreResearch", 11, "", "FusionCoreResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1544, "FusionCoreResearch", 12, "", "FusionCoreResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1545, "FusionCoreResearch", 13, "", "FusionCoreResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1546, "FusionCoreResearch", 14, "", "FusionCoreResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1547, "FusionCoreResearch", 15, "", "FusionCoreResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1548, "FusionCoreResearch", 16, "", "FusionCoreResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1549, "FusionCoreResearch", 17, "", "FusionCoreResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1550, "FusionCoreResearch", 18, "", "FusionCoreResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1551, "FusionCoreResearch", 19, "", "FusionCoreResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1552, "FusionCoreResearch", 20, "", "FusionCoreResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1553, "FusionCoreResearch", 21, "", "FusionCoreResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1554, "FusionCoreResearch", 22, "", "FusionCoreResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1555, "FusionCoreResearch", 23, "", "FusionCoreResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1556, "FusionCoreResearch", 24, "", "FusionCoreResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1557, "FusionCoreResearch", 25, "", "FusionCoreResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1558, "FusionCoreResearch", 26, "", "FusionCoreResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1559, "FusionCoreResearch", 27, "", "FusionCoreResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1560, "FusionCoreResearch", 28, "", "FusionCoreResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1561, "FusionCoreResearch", 29, "", "FusionCoreResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1562, "CyberneticsCoreResearch", 0, "ProtossAirWeaponsLevel1", "Research ProtossAirWeaponsLevel1", "Q", 3693, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1563, "CyberneticsCoreResearch", 1, "ProtossAirWeaponsLevel2", "Research ProtossAirWeaponsLevel2", "Q", 3693, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1564, "CyberneticsCoreResearch", 2, "ProtossAirWeaponsLevel3", "Research ProtossAirWeaponsLevel3", "Q", 3693, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1565, "CyberneticsCoreResearch", 3, "ProtossAirArmorLevel1", "Research ProtossAirArmorLevel1", "W", 3692, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1566, "CyberneticsCoreResearch", 4, "ProtossAirArmorLevel2", "Research ProtossAirArmorLevel2", "W", 3692, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1567, "CyberneticsCoreResearch", 5, "ProtossAirArmorLevel3", "Research ProtossAirArmorLevel3", "W", 3692, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1568, "CyberneticsCoreResearch", 6, "ResearchWarpGate", "Research WarpGate", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1569, "CyberneticsCoreResearch", 7, "", "CyberneticsCoreResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1570, "CyberneticsCoreResearch", 8, "", "CyberneticsCoreResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1571, "CyberneticsCoreResearch", 9, "ResearchHallucination", "Research ResearchHallucination", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1572, "CyberneticsCoreResearch", 10, "", "CyberneticsCoreResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1573, "CyberneticsCoreResearch", 11, "", "CyberneticsCoreResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1574, "CyberneticsCoreResearch", 12, "", "CyberneticsCoreResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1575, "CyberneticsCoreResearch", 13, "", "CyberneticsCoreResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1576, "CyberneticsCoreResearch", 14, "", "CyberneticsCoreResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1577, "CyberneticsCoreResearch", 15, "", "CyberneticsCoreResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1578, "CyberneticsCoreResearch", 16, "", "CyberneticsCoreResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1579, "CyberneticsCoreResearch", 17, "", "CyberneticsCoreResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1580, "CyberneticsCoreResearch", 18, "", "CyberneticsCoreResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1581, "CyberneticsCoreResearch", 19, "", "CyberneticsCoreResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1582, "CyberneticsCoreResearch", 20, "", "CyberneticsCoreResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1583, "CyberneticsCoreResearch", 21, "", "CyberneticsCoreResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1584, "CyberneticsCoreResearch", 22, "", "CyberneticsCoreResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1585, "CyberneticsCoreResearch", 23, "", "CyberneticsCoreResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1586, "CyberneticsCoreResearch", 24, "", "CyberneticsCoreResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1587, "CyberneticsCoreResearch", 25, "", "CyberneticsCoreResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1588, "CyberneticsCoreResearch", 26, "", "CyberneticsCoreResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1589, "CyberneticsCoreResearch", 27, "", "CyberneticsCoreResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1590, "CyberneticsCoreResearch", 28, "", "CyberneticsCoreResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1591, "CyberneticsCoreResearch", 29, "", "CyberneticsCoreResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1592, "TwilightCouncilResearch", 0, "ResearchCharge", "Research Charge", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1593, "TwilightCouncilResearch", 1, "ResearchStalkerTeleport", "Research Blink", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1594, "TwilightCouncilResearch", 2, "AdeptResearchPiercingUpgrade", "Research AdeptResonatingGlaives", "E", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1595, "TwilightCouncilResearch", 3, "", "TwilightCouncilResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1596, "TwilightCouncilResearch", 4, "", "TwilightCouncilResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1597, "TwilightCouncilResearch", 5, "", "TwilightCouncilResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1598, "TwilightCouncilResearch", 6, "", "TwilightCouncilResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1599, "TwilightCouncilResearch", 7, "", "TwilightCouncilResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1600, "TwilightCouncilResearch", 8, "", "TwilightCouncilResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1601, "TwilightCouncilResearch", 9, "", "TwilightCouncilResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1602, "TwilightCouncilResearch", 10, "", "TwilightCouncilResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1603, "TwilightCouncilResearch", 11, "", "TwilightCouncilResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1604, "TwilightCouncilResearch", 12, "", "TwilightCouncilResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1605, "TwilightCouncilResearch", 13, "", "TwilightCouncilResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1606, "TwilightCouncilResearch", 14, "", "TwilightCouncilResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1607, "TwilightCouncilResearch", 15, "", "TwilightCouncilResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1608, "TwilightCouncilResearch", 16, "", "TwilightCouncilResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1609, "TwilightCouncilResearch", 17, "", "TwilightCouncilResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1610, "TwilightCouncilResearch", 18, "", "TwilightCouncilResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1611, "TwilightCouncilResearch", 19, "", "TwilightCouncilResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1612, "TwilightCouncilResearch", 20, "", "TwilightCouncilResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1613, "TwilightCouncilResearch", 21, "", "TwilightCouncilResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1614, "TwilightCouncilResearch", 22, "", "TwilightCouncilResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1615, "TwilightCouncilResearch", 23, "", "TwilightCouncilResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1616, "TwilightCouncilResearch", 24, "", "TwilightCouncilResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1617, "TwilightCouncilResearch", 25, "", "TwilightCouncilResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1618, "TwilightCouncilResearch", 26, "", "TwilightCouncilResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1619, "TwilightCouncilResearch", 27, "", "TwilightCouncilResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1620, "TwilightCouncilResearch", 28, "", "TwilightCouncilResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1621, "TwilightCouncilResearch", 29, "", "TwilightCouncilResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1622, "TacNukeStrike", 0, "NukeCalldown", "Effect NukeCalldown", "A", 0, 0, 0, 2, false, false, false, 0.0f, false, 12.0f },
+    { true, 1623, "TacNukeStrike", 1, "Cancel", "Cancel Nuke", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1624, "SalvageBunkerRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1625, "SalvageBunkerRefund", 1, "", "SalvageBunkerRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1626, "SalvageBunker", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1627, "SalvageBunker", 1, "", "SalvageBunker_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1628, "EMP", 0, "EMP", "Effect EMP", "X", 0, 0, 0, 2, false, false, false, 0.0f, false, 10.0f },
+    { true, 1629, "EMP", 1, "", "EMP_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1630, "Vortex", 0, "Vortex", "Effect Vortex", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { false, 1631, "Vortex", 1, "", "Vortex_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1632, "TrainQueen", 0, "Queen", "Train Queen", "W", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1633, "TrainQueen", 1, "", "TrainQueen_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1634, "TrainQueen", 2, "", "TrainQueen_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1635, "TrainQueen", 3, "", "TrainQueen_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1636, "TrainQueen", 4, "", "TrainQueen_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1637, "TrainQueen", 5, "", "TrainQueen_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1638, "TrainQueen", 6, "", "TrainQueen_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1639, "TrainQueen", 7, "", "TrainQueen_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1640, "TrainQueen", 8, "", "TrainQueen_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1641, "TrainQueen", 9, "", "TrainQueen_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1642, "TrainQueen", 10, "", "TrainQueen_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1643, "TrainQueen", 11, "", "TrainQueen_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1644, "TrainQueen", 12, "", "TrainQueen_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1645, "TrainQueen", 13, "", "TrainQueen_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1646, "TrainQueen", 14, "", "TrainQueen_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1647, "TrainQueen", 15, "", "TrainQueen_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1648, "TrainQueen", 16, "", "TrainQueen_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1649, "TrainQueen", 17, "", "TrainQueen_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1650, "TrainQueen", 18, "", "TrainQueen_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1651, "TrainQueen", 19, "", "TrainQueen_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1652, "TrainQueen", 20, "", "TrainQueen_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1653, "TrainQueen", 21, "", "TrainQueen_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1654, "TrainQueen", 22, "", "TrainQueen_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1655, "TrainQueen", 23, "", "TrainQueen_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1656, "TrainQueen", 24, "", "TrainQueen_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1657, "TrainQueen", 25, "", "TrainQueen_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1658, "TrainQueen", 26, "", "TrainQueen_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1659, "TrainQueen", 27, "", "TrainQueen_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1660, "TrainQueen", 28, "", "TrainQueen_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1661, "TrainQueen", 29, "", "TrainQueen_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1662, "BurrowCreepTumorDown", 0, "BurrowDown", "Morph BurrowDown", "", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1663, "BurrowCreepTumorDown", 1, "", "BurrowCreepTumorDown_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1664, "Transfusion", 0, "Transfusion", "Effect Transfusion", "C", 0, 0, 0, 3, false, false, false, 0.0f, false, 7.0f },
+    { true, 1665, "Transfusion", 1, "", "Transfusion_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1666, "TechLabMorph", 0, "", "TechLabMorph_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1667, "TechLabMorph", 1, "", "TechLabMorph_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1668, "BarracksTechLabMorph", 0, "TechLabBarracks", "Morph TechLabBarracks", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1669, "BarracksTechLabMorph", 1, "", "BarracksTechLabMorph_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1670, "FactoryTechLabMorph", 0, "TechLabFactory", "Morph TechLabFactory", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1671, "FactoryTechLabMorph", 1, "", "FactoryTechLabMorph_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1672, "StarportTechLabMorph", 0, "TechLabStarport", "Morph TechLabStarport", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1673, "StarportTechLabMorph", 1, "", "StarportTechLabMorph_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1674, "ReactorMorph", 0, "", "ReactorMorph_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1675, "ReactorMorph", 1, "", "ReactorMorph_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1676, "BarracksReactorMorph", 0, "Reactor", "Morph Reactor", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1677, "BarracksReactorMorph", 1, "", "BarracksReactorMorph_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1678, "FactoryReactorMorph", 0, "Reactor", "Morph Reactor", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1679, "FactoryReactorMorph", 1, "", "FactoryReactorMorph_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1680, "StarportReactorMorph", 0, "Reactor", "Morph Reactor", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1681, "StarportReactorMorph", 1, "", "StarportReactorMorph_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1682, "AttackRedirect", 0, "AttackRedirect", "Attack Redirect", "T", 3674, 0, 0, 4, false, false, false, 0.0f, false, 0.0f },
+    { true, 1683, "StimpackRedirect", 0, "StimRedirect", "Effect Stim Marine Redirect", "Z", 3675, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1684, "StimpackMarauderRedirect", 0, "StimRedirect", "Effect Stim Marauder Redirect", "Z", 3675, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1685, "burrowedStop", 0, "StopRoachBurrowed", "Stop StopRoachBurrowed", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1686, "burrowedStop", 1, "HoldFireSpecial", "Stop HoldFireSpecial", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1687, "burrowedStop", 2, "", "burrowedStop_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1688, "burrowedStop", 3, "", "burrowedStop_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1689, "burrowedStop", 4, "", "burrowedStop_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1690, "burrowedStop", 5, "", "burrowedStop_5", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 1691, "StopRedirect", 0, "StopRedirect", "Stop Redirect", "W", 3665, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1692, "GenerateCreep", 0, "GenerateCreep", "Behavior GenerateCreepOn", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1693, "GenerateCreep", 1, "StopGenerateCreep", "Behavior GenerateCreepOff", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1694, "QueenBuild", 0, "CreepTumor", "Build CreepTumor Queen", "Z", 3691, 0, 0, 2, false, false, true, 0.5f, false, 0.0f },
+    { true, 1695, "QueenBuild", 1, "", "QueenBuild_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1696, "QueenBuild", 2, "", "QueenBuild_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1697, "QueenBuild", 3, "", "QueenBuild_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1698, "QueenBuild", 4, "", "QueenBuild_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1699, "QueenBuild", 5, "", "QueenBuild_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1700, "QueenBuild", 6, "", "QueenBuild_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1701, "QueenBuild", 7, "", "QueenBuild_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1702, "QueenBuild", 8, "", "QueenBuild_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1703, "QueenBuild", 9, "", "QueenBuild_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1704, "QueenBuild", 10, "", "QueenBuild_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1705, "QueenBuild", 11, "", "QueenBuild_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1706, "QueenBuild", 12, "", "QueenBuild_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1707, "QueenBuild", 13, "", "QueenBuild_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1708, "QueenBuild", 14, "", "QueenBuild_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1709, "QueenBuild", 15, "", "QueenBuild_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1710, "QueenBuild", 16, "", "QueenBuild_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1711, "QueenBuild", 17, "", "QueenBuild_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1712, "QueenBuild", 18, "", "QueenBuild_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1713, "QueenBuild", 19, "", "QueenBuild_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1714, "QueenBuild", 20, "", "QueenBuild_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1715, "QueenBuild", 21, "", "QueenBuild_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1716, "QueenBuild", 22, "", "QueenBuild_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1717, "QueenBuild", 23, "", "QueenBuild_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1718, "QueenBuild", 24, "", "QueenBuild_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1719, "QueenBuild", 25, "", "QueenBuild_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1720, "QueenBuild", 26, "", "QueenBuild_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1721, "QueenBuild", 27, "", "QueenBuild_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1722, "QueenBuild", 28, "", "QueenBuild_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1723, "QueenBuild", 29, "", "QueenBuild_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1724, "QueenBuild", 30, "Cancel", "QueenBuild_30", "", 3660, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1725, "SpineCrawlerUproot", 0, "SpineCrawlerUproot", "Morph SpineCrawlerUproot", "X", 3681, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1726, "SpineCrawlerUproot", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1727, "SporeCrawlerUproot", 0, "SporeCrawlerUproot", "Morph SporeCrawlerUproot", "X", 3681, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1728, "SporeCrawlerUproot", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1729, "SpineCrawlerRoot", 0, "SpineCrawlerRoot", "Morph SpineCrawlerRoot", "Z", 3680, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1730, "SpineCrawlerRoot", 1, "Cancel", "Cancel SpineCrawlerRoot", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1731, "SporeCrawlerRoot", 0, "SporeCrawlerRoot", "Morph SporeCrawlerRoot", "Z", 3680, 0, 0, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 1732, "SporeCrawlerRoot", 1, "Cancel", "Cancel SporeCrawlerRoot", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1733, "CreepTumorBuild", 0, "CreepTumor", "Build CreepTumor Tumor", "Z", 3691, 0, 0, 2, false, false, true, 0.5f, false, 0.0f },
+    { true, 1734, "CreepTumorBuild", 1, "", "CreepTumorBuild_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1735, "CreepTumorBuild", 2, "", "CreepTumorBuild_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1736, "CreepTumorBuild", 3, "", "CreepTumorBuild_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1737, "CreepTumorBuild", 4, "", "CreepTumorBuild_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1738, "CreepTumorBuild", 5, "", "CreepTumorBuild_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1739, "CreepTumorBuild", 6, "", "CreepTumorBuild_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1740, "CreepTumorBuild", 7, "", "CreepTumorBuild_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1741, "CreepTumorBuild", 8, "", "CreepTumorBuild_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1742, "CreepTumorBuild", 9, "", "CreepTumorBuild_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1743, "CreepTumorBuild", 10, "", "CreepTumorBuild_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1744, "CreepTumorBuild", 11, "", "CreepTumorBuild_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1745, "CreepTumorBuild", 12, "", "CreepTumorBuild_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1746, "CreepTumorBuild", 13, "", "CreepTumorBuild_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1747, "CreepTumorBuild", 14, "", "CreepTumorBuild_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1748, "CreepTumorBuild", 15, "", "CreepTumorBuild_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1749, "CreepTumorBuild", 16, "", "CreepTumorBuild_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1750, "CreepTumorBuild", 17, "", "CreepTumorBuild_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1751, "CreepTumorBuild", 18, "", "CreepTumorBuild_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1752, "CreepTumorBuild", 19, "", "CreepTumorBuild_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1753, "CreepTumorBuild", 20, "", "CreepTumorBuild_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1754, "CreepTumorBuild", 21, "", "CreepTumorBuild_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1755, "CreepTumorBuild", 22, "", "CreepTumorBuild_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1756, "CreepTumorBuild", 23, "", "CreepTumorBuild_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1757, "CreepTumorBuild", 24, "", "CreepTumorBuild_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1758, "CreepTumorBuild", 25, "", "CreepTumorBuild_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1759, "CreepTumorBuild", 26, "", "CreepTumorBuild_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1760, "CreepTumorBuild", 27, "", "CreepTumorBuild_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1761, "CreepTumorBuild", 28, "", "CreepTumorBuild_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1762, "CreepTumorBuild", 29, "", "CreepTumorBuild_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1763, "CreepTumorBuild", 30, "Cancel", "Cancel CreepTumor", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1764, "BuildAutoTurret", 0, "AutoTurret", "Effect AutoTurret", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 2.0f },
+    { true, 1765, "BuildAutoTurret", 1, "", "BuildAutoTurret_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1766, "ArchonWarp", 0, "AWrp", "Morph Archon", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1767, "ArchonWarp", 1, "ArchonWarpTarget", "Archon Warp Target", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 1768, "BuildNydusCanal", 0, "NydusCanal", "Build NydusWorm", "A", 0, 0, 0, 2, false, false, true, 1.5f, false, 0.0f },
+    { true, 1769, "BuildNydusCanal", 1, "SummonNydusCanalAttacker", "Build SummonNydusCanalAttacker", "", 0, 0, 0, 2, false, false, true, 1.0f, false, 0.0f },
+    { true, 1770, "BuildNydusCanal", 2, "", "BuildNydusCanal_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1771, "BuildNydusCanal", 3, "", "BuildNydusCanal_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1772, "BuildNydusCanal", 4, "", "BuildNydusCanal_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1773, "BuildNydusCanal", 5, "", "BuildNydusCanal_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1774, "BuildNydusCanal", 6, "", "BuildNydusCanal_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1775, "BuildNydusCanal", 7, "", "BuildNydusCanal_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1776, "BuildNydusCanal", 8, "", "BuildNydusCanal_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1777, "BuildNydusCanal", 9, "", "BuildNydusCanal_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1778, "BuildNydusCanal", 10, "", "BuildNydusCanal_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1779, "BuildNydusCanal", 11, "", "BuildNydusCanal_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1780, "BuildNydusCanal", 12, "", "BuildNydusCanal_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1781, "BuildNydusCanal", 13, "", "BuildNydusCanal_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1782, "BuildNydusCanal", 14, "", "BuildNydusCanal_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1783, "BuildNydusCanal", 15, "", "BuildNydusCanal_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1784, "BuildNydusCanal", 16, "", "BuildNydusCanal_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1785, "BuildNydusCanal", 17, "", "BuildNydusCanal_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1786, "BuildNydusCanal", 18, "", "BuildNydusCanal_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1787, "BuildNydusCanal", 19, "", "BuildNydusCanal_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1788, "BuildNydusCanal", 20, "", "BuildNydusCanal_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1789, "BuildNydusCanal", 21, "", "BuildNydusCanal_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1790, "BuildNydusCanal", 22, "", "BuildNydusCanal_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1791, "BuildNydusCanal", 23, "", "BuildNydusCanal_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1792, "BuildNydusCanal", 24, "", "BuildNydusCanal_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1793, "BuildNydusCanal", 25, "", "BuildNydusCanal_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1794, "BuildNydusCanal", 26, "", "BuildNydusCanal_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1795, "BuildNydusCanal", 27, "", "BuildNydusCanal_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1796, "BuildNydusCanal", 28, "", "BuildNydusCanal_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1797, "BuildNydusCanal", 29, "", "BuildNydusCanal_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1798, "BuildNydusCanal", 30, "Cancel", "BuildNydusCanal_30", "", 3660, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1799, "BroodLordHangar", 0, "", "BroodLordHangar_0", "", 0, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1800, "BroodLordHangar", 1, "", "BroodLordHangar_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1801, "BroodLordHangar", 2, "", "BroodLordHangar_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1802, "BroodLordHangar", 3, "", "BroodLordHangar_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1803, "BroodLordHangar", 4, "", "BroodLordHangar_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1804, "BroodLordHangar", 5, "", "BroodLordHangar_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1805, "BroodLordHangar", 6, "", "BroodLordHangar_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1806, "BroodLordHangar", 7, "", "BroodLordHangar_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1807, "BroodLordHangar", 8, "", "BroodLordHangar_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1808, "BroodLordHangar", 9, "", "BroodLordHangar_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1809, "BroodLordHangar", 10, "", "BroodLordHangar_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1810, "BroodLordHangar", 11, "", "BroodLordHangar_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1811, "BroodLordHangar", 12, "", "BroodLordHangar_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1812, "BroodLordHangar", 13, "", "BroodLordHangar_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1813, "BroodLordHangar", 14, "", "BroodLordHangar_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1814, "BroodLordHangar", 15, "", "BroodLordHangar_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1815, "BroodLordHangar", 16, "", "BroodLordHangar_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1816, "BroodLordHangar", 17, "", "BroodLordHangar_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1817, "BroodLordHangar", 18, "", "BroodLordHangar_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1818, "BroodLordHangar", 19, "", "BroodLordHangar_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1819, "Charge", 0, "Charge", "Effect Charge", "Z", 0, 0, 0, 3, false, true, false, 0.0f, false, 0.0f },
+    { true, 1820, "TowerCapture", 0, "", "TowerCapture_0", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 1821, "HerdInteract", 0, "Herd", "Effect Herd", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 6.0f },
+    { true, 1822, "HerdInteract", 1, "", "HerdInteract_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1823, "Frenzy", 0, "Frenzy", "Effect Frenzy", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { false, 1824, "Frenzy", 1, "", "Frenzy_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1825, "Contaminate", 0, "Contaminate", "Effect Contaminate", "V", 0, 0, 0, 3, false, false, false, 0.0f, false, 3.0f },
+    { true, 1826, "Contaminate", 1, "", "Contaminate_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1827, "Shatter", 0, "", "Shatter_0", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 0.100097656f },
+    { true, 1828, "Shatter", 1, "", "Shatter_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1829, "InfestedTerransLayEgg", 0, "InfestedTerrans", "Effect InfestedTerrans", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1830, "InfestedTerransLayEgg", 1, "", "InfestedTerransLayEgg_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1831, "que5Passive", 0, "Cancel", "Cancel QueuePasive", "B", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1832, "que5Passive", 1, "CancelSlot", "CancelSlot QueuePassive", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1833, "que5PassiveCancelToSelection", 0, "Cancel", "Cancel QueuePassiveCancelToSelection", "B", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1834, "que5PassiveCancelToSelection", 1, "CancelSlot", "CancelSlot QueuePassiveCancelToSelection", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1835, "MorphToGhostAlternate", 0, "Move", "Morph Move", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1836, "MorphToGhostAlternate", 1, "", "MorphToGhostAlternate_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1837, "MorphToGhostNova", 0, "Move", "Morph Move", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1838, "MorphToGhostNova", 1, "", "MorphToGhostNova_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1839, "DigesterCreepSpray", 0, "DigesterCreepSpray", "Effect DigesterCreepSpray", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 1840, "DigesterCreepSpray", 1, "", "Cancel DigesterCreepSpray", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1841, "MorphToCollapsibleTerranTowerDebris", 0, "", "MorphToCollapsibleTerranTowerDebris_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1842, "MorphToCollapsibleTerranTowerDebris", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1843, "MorphToCollapsibleTerranTowerDebrisRampLeft", 0, "", "MorphToCollapsibleTerranTowerDebrisRampLeft_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1844, "MorphToCollapsibleTerranTowerDebrisRampLeft", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1845, "MorphToCollapsibleTerranTowerDebrisRampRight", 0, "", "MorphToCollapsibleTerranTowerDebrisRampRight_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1846, "MorphToCollapsibleTerranTowerDebrisRampRight", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1847, "MorphToMothership", 0, "MorphToMothership", "Morph Mothership", "A", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1848, "MorphToMothership", 1, "CancelMothershipMorph", "Cancel MorphMothership", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1849, "MothershipStasis", 0, "MothershipStasis", "Effect MothershipStasis", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1850, "MothershipStasis", 1, "Cancel", "Cancel MothershipStasis", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1851, "MothershipCoreWeapon", 0, "MothershipStasis", "Effect MothershipStasis", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1852, "MothershipCoreWeapon", 1, "", "MothershipCoreWeapon_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1853, "NexusTrainMothershipCore", 0, "MothershipCore", "Train MothershipCore", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1854, "NexusTrainMothershipCore", 1, "", "NexusTrainMothershipCore_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1855, "NexusTrainMothershipCore", 2, "", "NexusTrainMothershipCore_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1856, "NexusTrainMothershipCore", 3, "", "NexusTrainMothershipCore_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1857, "NexusTrainMothershipCore", 4, "", "NexusTrainMothershipCore_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1858, "NexusTrainMothershipCore", 5, "", "NexusTrainMothershipCore_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1859, "NexusTrainMothershipCore", 6, "", "NexusTrainMothershipCore_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1860, "NexusTrainMothershipCore", 7, "", "NexusTrainMothershipCore_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1861, "NexusTrainMothershipCore", 8, "", "NexusTrainMothershipCore_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1862, "NexusTrainMothershipCore", 9, "", "NexusTrainMothershipCore_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1863, "NexusTrainMothershipCore", 10, "", "NexusTrainMothershipCore_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1864, "NexusTrainMothershipCore", 11, "", "NexusTrainMothershipCore_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1865, "NexusTrainMothershipCore", 12, "", "NexusTrainMothershipCore_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1866, "NexusTrainMothershipCore", 13, "", "NexusTrainMothershipCore_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1867, "NexusTrainMothershipCore", 14, "", "NexusTrainMothershipCore_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1868, "NexusTrainMothershipCore", 15, "", "NexusTrainMothershipCore_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1869, "NexusTrainMothershipCore", 16, "", "NexusTrainMothershipCore_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1870, "NexusTrainMothershipCore", 17, "", "NexusTrainMothershipCore_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1871, "NexusTrainMothershipCore", 18, "", "NexusTrainMothershipCore_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1872, "NexusTrainMothershipCore", 19, "", "NexusTrainMothershipCore_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1873, "NexusTrainMothershipCore", 20, "", "NexusTrainMothershipCore_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1874, "NexusTrainMothershipCore", 21, "", "NexusTrainMothershipCore_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1875, "NexusTrainMothershipCore", 22, "", "NexusTrainMothershipCore_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1876, "NexusTrainMothershipCore", 23, "", "NexusTrainMothershipCore_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1877, "NexusTrainMothershipCore", 24, "", "NexusTrainMothershipCore_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1878, "NexusTrainMothershipCore", 25, "", "NexusTrainMothershipCore_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1879, "NexusTrainMothershipCore", 26, "", "NexusTrainMothershipCore_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1880, "NexusTrainMothershipCore", 27, "", "NexusTrainMothershipCore_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1881, "NexusTrainMothershipCore", 28, "", "NexusTrainMothershipCore_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1882, "NexusTrainMothershipCore", 29, "", "NexusTrainMothershipCore_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1883, "MothershipCoreTeleport", 0, "MothershipCoreTeleport", "Effect MothershipCoreTeleport", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { false, 1884, "MothershipCoreTeleport", 1, "", "MothershipCoreTeleport_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1885, "SalvageDroneRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1886, "SalvageDroneRefund", 1, "", "SalvageDroneRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1887, "SalvageDrone", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1888, "SalvageDrone", 1, "", "SalvageDrone_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1889, "SalvageZerglingRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1890, "SalvageZerglingRefund", 1, "", "SalvageZerglingRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1891, "SalvageZergling", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1892, "SalvageZergling", 1, "", "SalvageZergling_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1893, "SalvageQueenRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1894, "SalvageQueenRefund", 1, "", "SalvageQueenRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1895, "SalvageQueen", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1896, "SalvageQueen", 1, "", "SalvageQueen_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1897, "SalvageRoachRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1898, "SalvageRoachRefund", 1, "", "SalvageRoachRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1899, "SalvageRoach", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1900, "SalvageRoach", 1, "", "SalvageRoach_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1901, "SalvageBanelingRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1902, "SalvageBanelingRefund", 1, "", "SalvageBanelingRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1903, "SalvageBaneling", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1904, "SalvageBaneling", 1, "", "SalvageBaneling_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1905, "SalvageHydraliskRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1906, "SalvageHydraliskRefund", 1, "", "SalvageHydraliskRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1907, "SalvageHydralisk", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1908, "SalvageHydralisk", 1, "", "SalvageHydralisk_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1909, "SalvageInfestorRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1910, "SalvageInfestorRefund", 1, "", "SalvageInfestorRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1911, "SalvageInfestor", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1912, "SalvageInfestor", 1, "", "SalvageInfestor_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1913, "SalvageSwarmHostRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1914, "SalvageSwarmHostRefund", 1, "", "SalvageSwarmHostRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1915, "SalvageSwarmHost", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1916, "SalvageSwarmHost", 1, "", "SalvageSwarmHost_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1917, "SalvageUltraliskRefund", 0, "Salvage", "Effect Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1918, "SalvageUltraliskRefund", 1, "", "SalvageUltraliskRefund_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1919, "SalvageUltralisk", 0, "Salvage", "Behavior Salvage", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1920, "SalvageUltralisk", 1, "", "SalvageUltralisk_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1921, "DigesterTransport", 0, "LoadDigester", "Transport LoadDigester", "", 3668, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { false, 1922, "DigesterTransport", 1, "", "DigesterTransport_1", "", 3664, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1923, "DigesterTransport", 2, "", "DigesterTransport_2", "", 3669, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { false, 1924, "DigesterTransport", 3, "", "DigesterTransport_3", "", 3670, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1925, "DigesterTransport", 4, "", "DigesterTransport_4", "", 3663, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1926, "SpectreShield", 0, "SpectreShield", "Effect SpectreShield", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 7.0f },
+    { false, 1927, "SpectreShield", 1, "", "SpectreShield_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1928, "XelNagaHealingShrine", 0, "XelNagaHealingShrine", "Effect XelNagaHealingShrine", "Z", 0, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 1929, "XelNagaHealingShrine", 1, "", "XelNagaHealingShrine_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1930, "NexusInvulnerability", 0, "NexusInvulnerability", "Effect NexusInvulnerability", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { true, 1931, "NexusInvulnerability", 1, "", "NexusInvulnerability_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1932, "NexusPhaseShift", 0, "NexusPhaseShift", "Effect NexusPhaseShift", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { false, 1933, "NexusPhaseShift", 1, "", "NexusPhaseShift_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1934, "SpawnChangelingTarget", 0, "SpawnChangeling", "Effect SpawnChangeling", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 10.0f },
+    { false, 1935, "SpawnChangelingTarget", 1, "", "SpawnChangelingTarget_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1936, "QueenLand", 0, "QueenLand", "Morph QueenLand", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1937, "QueenLand", 1, "", "QueenLand_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1938, "QueenFly", 0, "QueenFly", "Morph QueenFly", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1939, "QueenFly", 1, "", "QueenFly_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1940, "OracleCloakField", 0, "OracleCloakField", "Effect OracleCloakField", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1941, "OracleCloakField", 1, "", "OracleCloakField_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1942, "FlyerShield", 0, "FlyerShield", "Effect FlyerShield", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 7.0f },
+    { false, 1943, "FlyerShield", 1, "", "FlyerShield_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1944, "LocustTrain", 0, "SwarmHost", "Train SwarmHost", "", 0, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { false, 1945, "LocustTrain", 1, "", "LocustTrain_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1946, "LocustTrain", 2, "", "LocustTrain_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1947, "LocustTrain", 3, "", "LocustTrain_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1948, "LocustTrain", 4, "", "LocustTrain_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1949, "LocustTrain", 5, "", "LocustTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1950, "LocustTrain", 6, "", "LocustTrain_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1951, "LocustTrain", 7, "", "LocustTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1952, "LocustTrain", 8, "", "LocustTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1953, "LocustTrain", 9, "", "LocustTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1954, "LocustTrain", 10, "", "LocustTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1955, "LocustTrain", 11, "", "LocustTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1956, "LocustTrain", 12, "", "LocustTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1957, "LocustTrain", 13, "", "LocustTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1958, "LocustTrain", 14, "", "LocustTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1959, "LocustTrain", 15, "", "LocustTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1960, "LocustTrain", 16, "", "LocustTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1961, "LocustTrain", 17, "", "LocustTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1962, "LocustTrain", 18, "", "LocustTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1963, "LocustTrain", 19, "", "LocustTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1964, "LocustTrain", 20, "", "LocustTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1965, "LocustTrain", 21, "", "LocustTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1966, "LocustTrain", 22, "", "LocustTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1967, "LocustTrain", 23, "", "LocustTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1968, "LocustTrain", 24, "", "LocustTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1969, "LocustTrain", 25, "", "LocustTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1970, "LocustTrain", 26, "", "LocustTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1971, "LocustTrain", 27, "", "LocustTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1972, "LocustTrain", 28, "", "LocustTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1973, "LocustTrain", 29, "", "LocustTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1974, "MothershipCoreMassRecall", 0, "MothershipCoreMassRecall", "Effect MassRecall MothershipCore", "X", 3686, 0, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { true, 1975, "MothershipCoreMassRecall", 1, "", "MothershipCoreMassRecall_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1976, "SingleRecall", 0, "SingleRecall", "Effect SingleRecall", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { false, 1977, "SingleRecall", 1, "", "SingleRecall_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1978, "MorphToHellion", 0, "MorphToHellion", "Morph Hellion", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1979, "MorphToHellion", 1, "", "MorphToHellion_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1980, "RestoreShields", 0, "RestoreShields", "Effect RestoreShields", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 7.0f },
+    { false, 1981, "RestoreShields", 1, "", "RestoreShields_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1982, "Scryer", 0, "Scryer", "Effect Scryer", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 8.0f },
+    { false, 1983, "Scryer", 1, "", "Scryer_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1984, "BurrowChargeTrial", 0, "", "BurrowChargeTrial_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1985, "BurrowChargeTrial", 1, "", "BurrowChargeTrial_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1986, "LeechResources", 0, "", "LeechResources_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 2.0f },
+    { false, 1987, "LeechResources", 1, "Cancel", "LeechResources_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1988, "SnipeDoT", 0, "SnipeDoT", "Effect SnipeDoT", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { false, 1989, "SnipeDoT", 1, "", "SnipeDoT_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1990, "SwarmHostSpawnLocusts", 0, "LocustMP", "Effect LocustMP", "", 0, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { false, 1991, "SwarmHostSpawnLocusts", 1, "", "SwarmHostSpawnLocusts_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1992, "Clone", 0, "Clone", "Effect Clone", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { false, 1993, "Clone", 1, "", "Clone_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 1994, "BuildingShield", 0, "BuildingShield", "Effect BuildingShield", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { false, 1995, "BuildingShield", 1, "", "BuildingShield_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1996, "MorphToCollapsibleRockTowerDebris", 0, "", "MorphToCollapsibleRockTowerDebris_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1997, "MorphToCollapsibleRockTowerDebris", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1998, "MorphToHellionTank", 0, "HellionTank", "Morph Hellbat", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 1999, "MorphToHellionTank", 1, "", "MorphToHellionTank_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2000, "BuildingStasis", 0, "BuildingStasis", "Effect BuildingStasis", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { false, 2001, "BuildingStasis", 1, "", "BuildingStasis_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2002, "ResourceBlocker", 0, "", "ResourceBlocker_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 5.0f },
+    { false, 2003, "ResourceBlocker", 1, "", "ResourceBlocker_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2004, "ResourceStun", 0, "", "ResourceStun_0", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 8.0f },
+    { false, 2005, "ResourceStun", 1, "", "ResourceStun_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2006, "MaxiumThrust", 0, "MaximumThrust", "Effect MaximumThrust", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2007, "MaxiumThrust", 1, "", "MaxiumThrust_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2008, "Sacrifice", 0, "", "Sacrifice_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2009, "Sacrifice", 1, "", "Sacrifice_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2010, "BurrowChargeMP", 0, "", "BurrowChargeMP_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 9.0f },
+    { false, 2011, "BurrowChargeMP", 1, "", "BurrowChargeMP_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2012, "BurrowChargeRevD", 0, "", "BurrowChargeRevD_0", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { false, 2013, "BurrowChargeRevD", 1, "", "BurrowChargeRevD_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2014, "MorphToSwarmHostBurrowedMP", 0, "MorphToSwarmHostBurrowedMP", "BurrowDown SwarmHost", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2015, "MorphToSwarmHostBurrowedMP", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2016, "MorphToSwarmHostMP", 0, "MorphToSwarmHostMP", "BurrowUp SwarmHost", "B", 3662, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2017, "MorphToSwarmHostMP", 1, "", "MorphToSwarmHostMP_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2018, "SpawnInfestedTerran", 0, "LocustMP", "Train LocustMP", "", 0, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { false, 2019, "SpawnInfestedTerran", 1, "", "SpawnInfestedTerran_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2020, "SpawnInfestedTerran", 2, "", "SpawnInfestedTerran_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2021, "SpawnInfestedTerran", 3, "", "SpawnInfestedTerran_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2022, "SpawnInfestedTerran", 4, "", "SpawnInfestedTerran_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2023, "SpawnInfestedTerran", 5, "", "SpawnInfestedTerran_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2024, "SpawnInfestedTerran", 6, "", "SpawnInfestedTerran_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2025, "SpawnInfestedTerran", 7, "", "SpawnInfestedTerran_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2026, "SpawnInfestedTerran", 8, "", "SpawnInfestedTerran_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2027, "SpawnInfestedTerran", 9, "", "SpawnInfestedTerran_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2028, "SpawnInfestedTerran", 10, "", "SpawnInfestedTerran_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2029, "SpawnInfestedTerran", 11, "", "SpawnInfestedTerran_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2030, "SpawnInfestedTerran", 12, "", "SpawnInfestedTerran_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2031, "SpawnInfestedTerran", 13, "", "SpawnInfestedTerran_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2032, "SpawnInfestedTerran", 14, "", "SpawnInfestedTerran_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2033, "SpawnInfestedTerran", 15, "", "SpawnInfestedTerran_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2034, "SpawnInfestedTerran", 16, "", "SpawnInfestedTerran_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2035, "SpawnInfestedTerran", 17, "", "SpawnInfestedTerran_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2036, "SpawnInfestedTerran", 18, "", "SpawnInfestedTerran_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2037, "SpawnInfestedTerran", 19, "", "SpawnInfestedTerran_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2038, "SpawnInfestedTerran", 20, "", "SpawnInfestedTerran_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2039, "SpawnInfestedTerran", 21, "", "SpawnInfestedTerran_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2040, "SpawnInfestedTerran", 22, "", "SpawnInfestedTerran_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2041, "SpawnInfestedTerran", 23, "", "SpawnInfestedTerran_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2042, "SpawnInfestedTerran", 24, "", "SpawnInfestedTerran_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2043, "SpawnInfestedTerran", 25, "", "SpawnInfestedTerran_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2044, "SpawnInfestedTerran", 26, "", "SpawnInfestedTerran_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2045, "SpawnInfestedTerran", 27, "", "SpawnInfestedTerran_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2046, "SpawnInfestedTerran", 28, "", "SpawnInfestedTerran_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2047, "SpawnInfestedTerran", 29, "", "SpawnInfestedTerran_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2048, "attackProtossBuilding", 0, "AttackBuilding", "Attack AttackBuilding", "T", 3674, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 2049, "attackProtossBuilding", 1, "AttackTowards", "Attack AttackTowards", "", 0, 0, 0, 2, true, false, false, 0.0f, false, 0.0f },
+    { true, 2050, "attackProtossBuilding", 2, "AttackBarrage", "Attack AttackBarrage", "", 0, 0, 0, 2, true, false, false, 0.0f, false, 0.0f },
+    { false, 2051, "burrowedBanelingStop", 0, "StopRoachBurrowed", "Stop StopRoachBurrowed", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2052, "burrowedBanelingStop", 1, "HoldFireSpecial", "Stop HoldFireSpecial", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2053, "burrowedBanelingStop", 2, "", "burrowedBanelingStop_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2054, "burrowedBanelingStop", 3, "", "burrowedBanelingStop_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2055, "burrowedBanelingStop", 4, "", "burrowedBanelingStop_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2056, "burrowedBanelingStop", 5, "", "burrowedBanelingStop_5", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 2057, "stopProtossBuilding", 0, "Stop", "Stop Building", "R", 3665, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2058, "stopProtossBuilding", 1, "HoldFire", "Stop HoldFire", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2059, "stopProtossBuilding", 2, "Cheer", "Stop Cheer", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2060, "stopProtossBuilding", 3, "Dance", "Stop Dance", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2061, "stopProtossBuilding", 4, "", "stopProtossBuilding_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2062, "stopProtossBuilding", 5, "", "stopProtossBuilding_5", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 2063, "BlindingCloud", 0, "BlindingCloud", "Effect BlindingCloud", "C", 0, 0, 0, 2, false, false, false, 0.0f, false, 10.0f },
+    { true, 2064, "BlindingCloud", 1, "", "BlindingCloud_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2065, "EyeStalk", 0, "EyeStalk", "Effect EyeStalk", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { false, 2066, "EyeStalk", 1, "Cancel", "EyeStalk_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2067, "Yoink", 0, "FaceEmbrace", "Effect Abduct", "X", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { true, 2068, "Yoink", 1, "", "Yoink_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2069, "ViperConsume", 0, "ViperConsume", "Effect ViperConsume", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 7.0f },
+    { false, 2070, "ViperConsume", 1, "", "ViperConsume_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2071, "ViperConsumeMinerals", 0, "ViperConsume", "Effect ViperConsume", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 7.0f },
+    { false, 2072, "ViperConsumeMinerals", 1, "", "ViperConsumeMinerals_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2073, "ViperConsumeStructure", 0, "ViperConsume", "Effect ViperConsume", "Z", 0, 0, 0, 3, false, false, false, 0.0f, false, 7.0f },
+    { true, 2074, "ViperConsumeStructure", 1, "", "ViperConsumeStructure_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2075, "ProtossBuildingQueue", 0, "Cancel", "Cancel ProtossBuildingQueue", "", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2076, "ProtossBuildingQueue", 1, "CancelSlot", "ProtossBuildingQueue_1", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2077, "que8", 0, "Cancel", "que8_0", "", 3671, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2078, "que8", 1, "CancelSlot", "que8_1", "", 3672, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2079, "TestZerg", 0, "", "TestZerg_0", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 10.0f },
+    { true, 2080, "TestZerg", 1, "Cancel", "TestZerg_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2081, "VolatileBurstBuilding", 0, "EnableBuildingAttack", "Behavior BuildingAttackOn", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2082, "VolatileBurstBuilding", 1, "DisableBuildingAttack", "Behavior BuildingAttackOff", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2083, "PickupScrapSmall", 0, "PickupScrapSmall", "Effect PickupScrapSmall", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 1.0f },
+    { true, 2084, "PickupScrapSmall", 1, "", "PickupScrapSmall_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2085, "PickupScrapMedium", 0, "PickupScrapMedium", "Effect PickupScrapMedium", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 1.0f },
+    { true, 2086, "PickupScrapMedium", 1, "", "PickupScrapMedium_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2087, "PickupScrapLarge", 0, "PickupScrapLarge", "Effect PickupScrapLarge", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 1.0f },
+    { true, 2088, "PickupScrapLarge", 1, "", "PickupScrapLarge_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2089, "PickupPalletGas", 0, "PickupPalletGas", "Effect PickupPalletGas", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 1.0f },
+    { true, 2090, "PickupPalletGas", 1, "", "PickupPalletGas_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2091, "PickupPalletMinerals", 0, "PickupPalletMinerals", "Effect PickupPalletMinerals", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 1.0f },
+    { true, 2092, "PickupPalletMinerals", 1, "", "PickupPalletMinerals_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2093, "MassiveKnockover", 0, "MassiveKnockover", "Effect MassiveKnockover", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 1.0f },
+    { true, 2094, "MassiveKnockover", 1, "", "MassiveKnockover_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2095, "WidowMineBurrow", 0, "WidowMineBurrow", "BurrowDown WidowMine", "X", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2096, "WidowMineBurrow", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2097, "WidowMineUnburrow", 0, "WidowMineUnburrow", "BurrowUp WidowMine", "C", 3662, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2098, "WidowMineUnburrow", 1, "", "WidowMineUnburrow_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2099, "WidowMineAttack", 0, "WidowMineAttack", "Effect WidowMineAttack", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 5.0f },
+    { true, 2100, "WidowMineAttack", 1, "", "WidowMineAttack_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2101, "TornadoMissile", 0, "TornadoMissile", "Augment TornadoMissile", "Z", 0, 0, 0, 3, false, true, false, 0.0f, false, 0.0f },
+    { false, 2102, "MothershipCoreEnergize", 0, "MothershipCoreEnergize", "Effect MothershipCoreEnergize", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { false, 2103, "MothershipCoreEnergize", 1, "Cancel", "MothershipCoreEnergize_1", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2104, "LurkerAspectMPFromHydraliskBurrowed", 0, "LurkerMPFromHydraliskBurrowed", "Morph LurkerMPFromHydraliskBurrowed", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2105, "LurkerAspectMPFromHydraliskBurrowed", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2106, "LurkerAspectMP", 0, "LurkerMP", "Morph LurkerMP", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2107, "LurkerAspectMP", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2108, "BurrowLurkerMPDown", 0, "BurrowDown", "BurrowDown Lurker", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2109, "BurrowLurkerMPDown", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2110, "BurrowLurkerMPUp", 0, "BurrowUp", "BurrowUp Lurker", "B", 3662, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2111, "BurrowLurkerMPUp", 1, "", "BurrowLurkerMPUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2112, "UpgradeToLurkerDenMP", 0, "MutateintoLurkerDen", "Morph LurkerDen", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2113, "UpgradeToLurkerDenMP", 1, "Cancel", "Cancel MorphLurkerDen", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2114, "HallucinationOracle", 0, "Oracle", "Hallucination Oracle", "CX", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2115, "HallucinationOracle", 1, "", "Hallucination Oracle", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2116, "MedivacSpeedBoost", 0, "MedivacSpeedBoost", "Effect MedivacIgniteAfterburners", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2117, "MedivacSpeedBoost", 1, "", "MedivacSpeedBoost_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2118, "ExtendingBridgeNEWide8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2119, "ExtendingBridgeNEWide8Out", 1, "", "ExtendingBridgeNEWide8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2120, "ExtendingBridgeNEWide8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2121, "ExtendingBridgeNEWide8", 1, "", "ExtendingBridgeNEWide8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2122, "ExtendingBridgeNWWide8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2123, "ExtendingBridgeNWWide8Out", 1, "", "ExtendingBridgeNWWide8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2124, "ExtendingBridgeNWWide8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2125, "ExtendingBridgeNWWide8", 1, "", "ExtendingBridgeNWWide8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2126, "ExtendingBridgeNEWide10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2127, "ExtendingBridgeNEWide10Out", 1, "", "ExtendingBridgeNEWide10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2128, "ExtendingBridgeNEWide10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2129, "ExtendingBridgeNEWide10", 1, "", "ExtendingBridgeNEWide10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2130, "ExtendingBridgeNWWide10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2131, "ExtendingBridgeNWWide10Out", 1, "", "ExtendingBridgeNWWide10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2132, "ExtendingBridgeNWWide10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2133, "ExtendingBridgeNWWide10", 1, "", "ExtendingBridgeNWWide10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2134, "ExtendingBridgeNEWide12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2135, "ExtendingBridgeNEWide12Out", 1, "", "ExtendingBridgeNEWide12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2136, "ExtendingBridgeNEWide12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2137, "ExtendingBridgeNEWide12", 1, "", "ExtendingBridgeNEWide12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2138, "ExtendingBridgeNWWide12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2139, "ExtendingBridgeNWWide12Out", 1, "", "ExtendingBridgeNWWide12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2140, "ExtendingBridgeNWWide12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2141, "ExtendingBridgeNWWide12", 1, "", "ExtendingBridgeNWWide12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2142, "InvulnerabilityShield", 0, "InvulnerabilityShield", "Effect InvulnerabilityShield", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { false, 2143, "InvulnerabilityShield", 1, "", "InvulnerabilityShield_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2144, "CritterFlee", 0, "CritterFlee", "Effect CritterFlee", "S", 0, 0, 0, 2, false, true, false, 0.0f, false, 5.0f },
+    { true, 2145, "CritterFlee", 1, "", "CritterFlee_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2146, "OracleRevelation", 0, "OracleRevelation", "Effect OracleRevelation", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 12.0f },
+    { true, 2147, "OracleRevelation", 1, "", "OracleRevelation_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2148, "OracleRevelationMode", 0, "OracleRevelationMode", "Morph OracleRevelationMode", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2149, "OracleRevelationMode", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2150, "OracleNormalMode", 0, "OracleNormalMode", "Morph OracleNormalMode", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2151, "OracleNormalMode", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2152, "MorphToCollapsibleRockTowerDebrisRampRight", 0, "", "MorphToCollapsibleRockTowerDebrisRampRight_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2153, "MorphToCollapsibleRockTowerDebrisRampRight", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2154, "MorphToCollapsibleRockTowerDebrisRampLeft", 0, "", "MorphToCollapsibleRockTowerDebrisRampLeft_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2155, "MorphToCollapsibleRockTowerDebrisRampLeft", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2156, "VoidSiphon", 0, "VoidSiphon", "Effect VoidSiphon", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 7.0f },
+    { false, 2157, "VoidSiphon", 1, "", "VoidSiphon_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2158, "UltraliskWeaponCooldown", 0, "UltraliskWeaponCooldown", "Effect UltraliskWeaponCooldown", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2159, "UltraliskWeaponCooldown", 1, "", "UltraliskWeaponCooldown_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2160, "MothershipCorePurifyNexusCancel", 0, "Cancel", "Effect Cancel", "B", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2161, "MothershipCorePurifyNexusCancel", 1, "", "MothershipCorePurifyNexusCancel_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2162, "MothershipCorePurifyNexus", 0, "MothershipCoreWeapon", "Effect PhotonOvercharge", "Z", 0, 0, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { true, 2163, "MothershipCorePurifyNexus", 1, "", "MothershipCorePurifyNexus_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2164, "XelNaga_Caverns_DoorE", 0, "XelNaga_Caverns_DoorDefaultClose", "Morph XelNaga_Caverns_DoorDefaultClose", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2165, "XelNaga_Caverns_DoorE", 1, "", "XelNaga_Caverns_DoorE_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2166, "XelNaga_Caverns_DoorEOpened", 0, "XelNaga_Caverns_DoorDefaultClose", "Morph XelNaga_Caverns_DoorDefaultClose", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2167, "XelNaga_Caverns_DoorEOpened", 1, "", "XelNaga_Caverns_DoorEOpened_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2168, "XelNaga_Caverns_DoorN", 0, "XelNaga_Caverns_DoorDefaultClose", "Morph XelNaga_Caverns_DoorDefaultClose", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2169, "XelNaga_Caverns_DoorN", 1, "", "XelNaga_Caverns_DoorN_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2170, "XelNaga_Caverns_DoorNE", 0, "XelNaga_Caverns_DoorDefaultClose", "Morph XelNaga_Caverns_DoorDefaultClose", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2171, "XelNaga_Caverns_DoorNE", 1, "", "XelNaga_Caverns_DoorNE_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2172, "XelNaga_Caverns_DoorNEOpened", 0, "XelNaga_Caverns_DoorDefaultOpen", "Morph XelNaga_Caverns_DoorDefaultOpen", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2173, "XelNaga_Caverns_DoorNEOpened", 1, "", "XelNaga_Caverns_DoorNEOpened_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2174, "XelNaga_Caverns_DoorNOpened", 0, "XelNaga_Caverns_DoorDefaultOpen", "Morph XelNaga_Caverns_DoorDefaultOpen", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2175, "XelNaga_Caverns_DoorNOpened", 1, "", "XelNaga_Caverns_DoorNOpened_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2176, "XelNaga_Caverns_DoorNW", 0, "XelNaga_Caverns_DoorDefaultClose", "Morph XelNaga_Caverns_DoorDefaultClose", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2177, "XelNaga_Caverns_DoorNW", 1, "", "XelNaga_Caverns_DoorNW_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2178, "XelNaga_Caverns_DoorNWOpened", 0, "XelNaga_Caverns_DoorDefaultOpen", "Morph XelNaga_Caverns_DoorDefaultOpen", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2179, "XelNaga_Caverns_DoorNWOpened", 1, "", "XelNaga_Caverns_DoorNWOpened_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2180, "XelNaga_Caverns_DoorS", 0, "XelNaga_Caverns_DoorDefaultClose", "Morph XelNaga_Caverns_DoorDefaultClose", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2181, "XelNaga_Caverns_DoorS", 1, "", "XelNaga_Caverns_DoorS_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2182, "XelNaga_Caverns_DoorSE", 0, "XelNaga_Caverns_DoorDefaultClose", "Morph XelNaga_Caverns_DoorDefaultClose", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2183, "XelNaga_Caverns_DoorSE", 1, "", "XelNaga_Caverns_DoorSE_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2184, "XelNaga_Caverns_DoorSEOpened", 0, "XelNaga_Caverns_DoorDefaultOpen", "Morph XelNaga_Caverns_DoorDefaultOpen", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2185, "XelNaga_Caverns_DoorSEOpened", 1, "", "XelNaga_Caverns_DoorSEOpened_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2186, "XelNaga_Caverns_DoorSOpened", 0, "XelNaga_Caverns_DoorDefaultOpen", "Morph XelNaga_Caverns_DoorDefaultOpen", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2187, "XelNaga_Caverns_DoorSOpened", 1, "", "XelNaga_Caverns_DoorSOpened_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2188, "XelNaga_Caverns_DoorSW", 0, "XelNaga_Caverns_DoorDefaultClose", "Morph XelNaga_Caverns_DoorDefaultClose", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2189, "XelNaga_Caverns_DoorSW", 1, "", "XelNaga_Caverns_DoorSW_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2190, "XelNaga_Caverns_DoorSWOpened", 0, "XelNaga_Caverns_DoorDefaultOpen", "Morph XelNaga_Caverns_DoorDefaultOpen", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2191, "XelNaga_Caverns_DoorSWOpened", 1, "", "XelNaga_Caverns_DoorSWOpened_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2192, "XelNaga_Caverns_DoorW", 0, "XelNaga_Caverns_DoorDefaultClose", "Morph XelNaga_Caverns_DoorDefaultClose", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2193, "XelNaga_Caverns_DoorW", 1, "", "XelNaga_Caverns_DoorW_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2194, "XelNaga_Caverns_DoorWOpened", 0, "XelNaga_Caverns_DoorDefaultOpen", "Morph XelNaga_Caverns_DoorDefaultOpen", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2195, "XelNaga_Caverns_DoorWOpened", 1, "", "XelNaga_Caverns_DoorWOpened_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2196, "XelNaga_Caverns_Floating_BridgeNE8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2197, "XelNaga_Caverns_Floating_BridgeNE8Out", 1, "", "XelNaga_Caverns_Floating_BridgeNE8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2198, "XelNaga_Caverns_Floating_BridgeNE8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2199, "XelNaga_Caverns_Floating_BridgeNE8", 1, "", "XelNaga_Caverns_Floating_BridgeNE8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2200, "XelNaga_Caverns_Floating_BridgeNW8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2201, "XelNaga_Caverns_Floating_BridgeNW8Out", 1, "", "XelNaga_Caverns_Floating_BridgeNW8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2202, "XelNaga_Caverns_Floating_BridgeNW8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2203, "XelNaga_Caverns_Floating_BridgeNW8", 1, "", "XelNaga_Caverns_Floating_BridgeNW8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2204, "XelNaga_Caverns_Floating_BridgeNE10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2205, "XelNaga_Caverns_Floating_BridgeNE10Out", 1, "", "XelNaga_Caverns_Floating_BridgeNE10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2206, "XelNaga_Caverns_Floating_BridgeNE10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2207, "XelNaga_Caverns_Floating_BridgeNE10", 1, "", "XelNaga_Caverns_Floating_BridgeNE10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2208, "XelNaga_Caverns_Floating_BridgeNW10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2209, "XelNaga_Caverns_Floating_BridgeNW10Out", 1, "", "XelNaga_Caverns_Floating_BridgeNW10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2210, "XelNaga_Caverns_Floating_BridgeNW10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2211, "XelNaga_Caverns_Floating_BridgeNW10", 1, "", "XelNaga_Caverns_Floating_BridgeNW10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2212, "XelNaga_Caverns_Floating_BridgeNE12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2213, "XelNaga_Caverns_Floating_BridgeNE12Out", 1, "", "XelNaga_Caverns_Floating_BridgeNE12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2214, "XelNaga_Caverns_Floating_BridgeNE12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2215, "XelNaga_Caverns_Floating_BridgeNE12", 1, "", "XelNaga_Caverns_Floating_BridgeNE12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2216, "XelNaga_Caverns_Floating_BridgeNW12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2217, "XelNaga_Caverns_Floating_BridgeNW12Out", 1, "", "XelNaga_Caverns_Floating_BridgeNW12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2218, "XelNaga_Caverns_Floating_BridgeNW12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2219, "XelNaga_Caverns_Floating_BridgeNW12", 1, "", "XelNaga_Caverns_Floating_BridgeNW12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2220, "XelNaga_Caverns_Floating_BridgeH8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2221, "XelNaga_Caverns_Floating_BridgeH8Out", 1, "", "XelNaga_Caverns_Floating_BridgeH8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2222, "XelNaga_Caverns_Floating_BridgeH8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2223, "XelNaga_Caverns_Floating_BridgeH8", 1, "", "XelNaga_Caverns_Floating_BridgeH8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2224, "XelNaga_Caverns_Floating_BridgeV8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2225, "XelNaga_Caverns_Floating_BridgeV8Out", 1, "", "XelNaga_Caverns_Floating_BridgeV8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2226, "XelNaga_Caverns_Floating_BridgeV8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2227, "XelNaga_Caverns_Floating_BridgeV8", 1, "", "XelNaga_Caverns_Floating_BridgeV8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2228, "XelNaga_Caverns_Floating_BridgeH10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2229, "XelNaga_Caverns_Floating_BridgeH10Out", 1, "", "XelNaga_Caverns_Floating_BridgeH10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2230, "XelNaga_Caverns_Floating_BridgeH10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2231, "XelNaga_Caverns_Floating_BridgeH10", 1, "", "XelNaga_Caverns_Floating_BridgeH10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2232, "XelNaga_Caverns_Floating_BridgeV10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2233, "XelNaga_Caverns_Floating_BridgeV10Out", 1, "", "XelNaga_Caverns_Floating_BridgeV10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2234, "XelNaga_Caverns_Floating_BridgeV10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2235, "XelNaga_Caverns_Floating_BridgeV10", 1, "", "XelNaga_Caverns_Floating_BridgeV10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2236, "XelNaga_Caverns_Floating_BridgeH12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2237, "XelNaga_Caverns_Floating_BridgeH12Out", 1, "", "XelNaga_Caverns_Floating_BridgeH12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2238, "XelNaga_Caverns_Floating_BridgeH12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2239, "XelNaga_Caverns_Floating_BridgeH12", 1, "", "XelNaga_Caverns_Floating_BridgeH12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2240, "XelNaga_Caverns_Floating_BridgeV12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2241, "XelNaga_Caverns_Floating_BridgeV12Out", 1, "", "XelNaga_Caverns_Floating_BridgeV12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2242, "XelNaga_Caverns_Floating_BridgeV12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2243, "XelNaga_Caverns_Floating_BridgeV12", 1, "", "XelNaga_Caverns_Floating_BridgeV12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2244, "TemporalField", 0, "TemporalField", "Effect TimeWarp", "C", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { true, 2245, "TemporalField", 1, "", "TemporalField_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2246, "SnowRefinery_Terran_ExtendingBridgeNEShort8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2247, "SnowRefinery_Terran_ExtendingBridgeNEShort8Out", 1, "", "SnowRefinery_Terran_ExtendingBridgeNEShort8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2248, "SnowRefinery_Terran_ExtendingBridgeNEShort8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2249, "SnowRefinery_Terran_ExtendingBridgeNEShort8", 1, "", "SnowRefinery_Terran_ExtendingBridgeNEShort8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2250, "SnowRefinery_Terran_ExtendingBridgeNWShort8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2251, "SnowRefinery_Terran_ExtendingBridgeNWShort8Out", 1, "", "SnowRefinery_Terran_ExtendingBridgeNWShort8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2252, "SnowRefinery_Terran_ExtendingBridgeNWShort8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2253, "SnowRefinery_Terran_ExtendingBridgeNWShort8", 1, "", "SnowRefinery_Terran_ExtendingBridgeNWShort8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2254, "SnowRefinery_Terran_ExtendingBridgeNEShort10Out", 0, "BridgeExtend", "Morph BridgeExtend", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2255, "SnowRefinery_Terran_ExtendingBridgeNEShort10Out", 1, "", "SnowRefinery_Terran_ExtendingBridgeNEShort10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2256, "SnowRefinery_Terran_ExtendingBridgeNEShort10", 0, "BridgeRetract", "Morph BridgeRetract", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2257, "SnowRefinery_Terran_ExtendingBridgeNEShort10", 1, "", "SnowRefinery_Terran_ExtendingBridgeNEShort10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2258, "SnowRefinery_Terran_ExtendingBridgeNWShort10Out", 0, "BridgeExtend", "Morph BridgeExtend", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2259, "SnowRefinery_Terran_ExtendingBridgeNWShort10Out", 1, "", "SnowRefinery_Terran_ExtendingBridgeNWShort10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2260, "SnowRefinery_Terran_ExtendingBridgeNWShort10", 0, "BridgeRetract", "Morph BridgeRetract", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2261, "SnowRefinery_Terran_ExtendingBridgeNWShort10", 1, "", "SnowRefinery_Terran_ExtendingBridgeNWShort10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2262, "Tarsonis_DoorN", 0, "", "Tarsonis_DoorN_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2263, "Tarsonis_DoorN", 1, "", "Tarsonis_DoorN_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2264, "Tarsonis_DoorNLowered", 0, "", "Tarsonis_DoorNLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2265, "Tarsonis_DoorNLowered", 1, "", "Tarsonis_DoorNLowered_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2266, "Tarsonis_DoorNE", 0, "", "Tarsonis_DoorNE_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2267, "Tarsonis_DoorNE", 1, "", "Tarsonis_DoorNE_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2268, "Tarsonis_DoorNELowered", 0, "", "Tarsonis_DoorNELowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2269, "Tarsonis_DoorNELowered", 1, "", "Tarsonis_DoorNELowered_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2270, "Tarsonis_DoorE", 0, "", "Tarsonis_DoorE_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2271, "Tarsonis_DoorE", 1, "", "Tarsonis_DoorE_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2272, "Tarsonis_DoorELowered", 0, "", "Tarsonis_DoorELowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2273, "Tarsonis_DoorELowered", 1, "", "Tarsonis_DoorELowered_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2274, "Tarsonis_DoorNW", 0, "", "Tarsonis_DoorNW_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2275, "Tarsonis_DoorNW", 1, "", "Tarsonis_DoorNW_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2276, "Tarsonis_DoorNWLowered", 0, "", "Tarsonis_DoorNWLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2277, "Tarsonis_DoorNWLowered", 1, "", "Tarsonis_DoorNWLowered_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2278, "CompoundMansion_DoorN", 0, "", "CompoundMansion_DoorN_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2279, "CompoundMansion_DoorN", 1, "", "CompoundMansion_DoorN_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2280, "CompoundMansion_DoorNLowered", 0, "", "CompoundMansion_DoorNLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2281, "CompoundMansion_DoorNLowered", 1, "", "CompoundMansion_DoorNLowered_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2282, "CompoundMansion_DoorNE", 0, "", "CompoundMansion_DoorNE_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2283, "CompoundMansion_DoorNE", 1, "", "CompoundMansion_DoorNE_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2284, "CompoundMansion_DoorNELowered", 0, "", "CompoundMansion_DoorNELowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2285, "CompoundMansion_DoorNELowered", 1, "", "CompoundMansion_DoorNELowered_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2286, "CompoundMansion_DoorE", 0, "", "CompoundMansion_DoorE_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2287, "CompoundMansion_DoorE", 1, "", "CompoundMansion_DoorE_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2288, "CompoundMansion_DoorELowered", 0, "", "CompoundMansion_DoorELowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2289, "CompoundMansion_DoorELowered", 1, "", "CompoundMansion_DoorELowered_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2290, "CompoundMansion_DoorNW", 0, "", "CompoundMansion_DoorNW_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2291, "CompoundMansion_DoorNW", 1, "", "CompoundMansion_DoorNW_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2292, "CompoundMansion_DoorNWLowered", 0, "", "CompoundMansion_DoorNWLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2293, "CompoundMansion_DoorNWLowered", 1, "", "CompoundMansion_DoorNWLowered_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2294, "ArmoryResearchSwarm", 0, "TerranVehicleAndShipWeaponsLevel1", "Research TerranVehicleAndShipWeaponsLevel1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2295, "ArmoryResearchSwarm", 1, "TerranVehicleAndShipWeaponsLevel2", "Research TerranVehicleAndShipWeaponsLevel2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2296, "ArmoryResearchSwarm", 2, "TerranVehicleAndShipWeaponsLevel3", "Research TerranVehicleAndShipWeaponsLevel3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2297, "ArmoryResearchSwarm", 3, "TerranVehicleAndShipPlatingLevel1", "Research TerranVehicleAndShipPlatingLevel1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2298, "ArmoryResearchSwarm", 4, "TerranVehicleAndShipPlatingLevel2", "Research TerranVehicleAndShipPlatingLevel2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2299, "ArmoryResearchSwarm", 5, "TerranVehicleAndShipPlatingLevel3", "Research TerranVehicleAndShipPlatingLevel3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2300, "ArmoryResearchSwarm", 6, "", "ArmoryResearchSwarm_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2301, "ArmoryResearchSwarm", 7, "", "ArmoryResearchSwarm_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2302, "ArmoryResearchSwarm", 8, "", "ArmoryResearchSwarm_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2303, "ArmoryResearchSwarm", 9, "", "ArmoryResearchSwarm_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2304, "ArmoryResearchSwarm", 10, "", "ArmoryResearchSwarm_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2305, "ArmoryResearchSwarm", 11, "", "ArmoryResearchSwarm_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2306, "ArmoryResearchSwarm", 12, "", "ArmoryResearchSwarm_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2307, "ArmoryResearchSwarm", 13, "", "ArmoryResearchSwarm_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2308, "ArmoryResearchSwarm", 14, "", "ArmoryResearchSwarm_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2309, "ArmoryResearchSwarm", 15, "", "ArmoryResearchSwarm_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2310, "ArmoryResearchSwarm", 16, "", "ArmoryResearchSwarm_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2311, "ArmoryResearchSwarm", 17, "", "ArmoryResearchSwarm_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2312, "ArmoryResearchSwarm", 18, "", "ArmoryResearchSwarm_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2313, "ArmoryResearchSwarm", 19, "", "ArmoryResearchSwarm_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2314, "ArmoryResearchSwarm", 20, "", "ArmoryResearchSwarm_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2315, "ArmoryResearchSwarm", 21, "", "ArmoryResearchSwarm_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2316, "ArmoryResearchSwarm", 22, "", "ArmoryResearchSwarm_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2317, "ArmoryResearchSwarm", 23, "", "ArmoryResearchSwarm_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2318, "ArmoryResearchSwarm", 24, "", "ArmoryResearchSwarm_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2319, "ArmoryResearchSwarm", 25, "", "ArmoryResearchSwarm_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2320, "ArmoryResearchSwarm", 26, "", "ArmoryResearchSwarm_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2321, "ArmoryResearchSwarm", 27, "", "ArmoryResearchSwarm_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2322, "ArmoryResearchSwarm", 28, "", "ArmoryResearchSwarm_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2323, "ArmoryResearchSwarm", 29, "", "ArmoryResearchSwarm_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2324, "CausticSpray", 0, "CausticSpray", "Effect CausticSpray", "Z", 0, 0, 0, 3, false, false, false, 0.0f, false, 6.0f },
+    { true, 2325, "CausticSpray", 1, "", "CausticSpray_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2326, "OracleCloakingFieldTargeted", 0, "OracleCloakingFieldTargeted", "Effect OracleCloakingFieldTargeted", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 6.0f },
+    { false, 2327, "OracleCloakingFieldTargeted", 1, "", "OracleCloakingFieldTargeted_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2328, "ImmortalOverload", 0, "ImmortalOverload", "Effect ImmortalBarrier", "", 0, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { false, 2329, "ImmortalOverload", 1, "", "ImmortalOverload_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2330, "MorphToRavager", 0, "Ravager", "Morph Ravager", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2331, "MorphToRavager", 1, "Cancel", "Cancel MorphRavager", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2332, "MorphToLurker", 0, "LurkerMP", "Morph Lurker", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2333, "MorphToLurker", 1, "Cancel", "Cancel MorphLurker", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2334, "OraclePhaseShift", 0, "OraclePhaseShift", "Effect OraclePhaseShift", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 5.0f },
+    { false, 2335, "OraclePhaseShift", 1, "", "OraclePhaseShift_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2336, "ReleaseInterceptors", 0, "ReleaseInterceptors", "Effect ReleaseInterceptors", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 15.0f },
+    { false, 2337, "ReleaseInterceptors", 1, "", "ReleaseInterceptors_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2338, "RavagerCorrosiveBile", 0, "RavagerCorrosiveBile", "Effect CorrosiveBile", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { true, 2339, "RavagerCorrosiveBile", 1, "", "RavagerCorrosiveBile_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2340, "BurrowRavagerDown", 0, "BurrowDown", "BurrowDown Ravager", "V", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2341, "BurrowRavagerDown", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2342, "BurrowRavagerUp", 0, "BurrowUp", "BurrowUp Ravager", "B", 3662, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 2343, "BurrowRavagerUp", 1, "", "BurrowRavagerUp_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2344, "PurificationNova", 0, "PurificationNova", "Effect PurificationNova", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2345, "PurificationNova", 1, "", "PurificationNova_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2346, "PurificationNovaTargeted", 0, "PurificationNovaTargeted", "Effect PurificationNova", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 2347, "PurificationNovaTargeted", 1, "", "PurificationNovaTargeted_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2348, "Impale", 0, "Impale", "Effect Impale", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { false, 2349, "Impale", 1, "", "Impale_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2350, "LockOn", 0, "LockOn", "Effect LockOn", "Z", 0, 0, 0, 3, false, true, false, 0.0f, false, 7.0f },
+    { true, 2351, "LockOn", 1, "", "LockOn_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2352, "LockOnAir", 0, "LockOnAir", "Effect LockOnAir", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 7.0f },
+    { false, 2353, "LockOnAir", 1, "", "LockOnAir_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2354, "LockOnCancel", 0, "LockOnCancel", "Cancel LockOn", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2355, "LockOnCancel", 1, "", "LockOnCancel_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2356, "CorruptionBomb", 0, "CorruptionBomb", "Effect CorruptionBomb", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { false, 2357, "CorruptionBomb", 1, "Cancel", "CorruptionBomb_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2358, "Hyperjump", 0, "Hyperjump", "Effect TacticalJump", "X", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 2359, "Hyperjump", 1, "", "Hyperjump_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2360, "Overcharge", 0, "Overcharge", "Effect Overcharge", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2361, "Overcharge", 1, "", "Overcharge_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2362, "ThorAPMode", 0, "ArmorpiercingMode", "Morph ThorHighImpactMode", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2363, "ThorAPMode", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2364, "ThorNormalMode", 0, "ExplosiveMode", "Morph ThorExplosiveMode", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2365, "ThorNormalMode", 1, "Cancel", "Cancel MorphThorExplosiveMode", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2366, "LightofAiur", 0, "LightofAiur", "Effect LightofAiur", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2367, "LightofAiur", 1, "", "LightofAiur_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2368, "MothershipMassRecall", 0, "MothershipMassRecall", "Effect MassRecall Mothership", "", 3686, 0, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { false, 2369, "MothershipMassRecall", 1, "", "MothershipMassRecall_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2370, "NydusWormTransport", 0, "NydusCanalLoad", "Load NydusWorm", "Z", 3668, 0, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 2371, "NydusWormTransport", 1, "NydusCanalUnloadAll", "UnloadAll NydusWorm", "X", 3664, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2372, "NydusWormTransport", 2, "", "NydusWormTransport_2", "", 3669, 0, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 2373, "NydusWormTransport", 3, "", "UnloadUnit NydasWorm", "", 3670, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2374, "NydusWormTransport", 4, "", "NydusWormTransport_4", "", 3663, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2375, "OracleWeapon", 0, "OracleWeaponOn", "Behavior PulsarBeamOn", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2376, "OracleWeapon", 1, "OracleWeaponOff", "Behavior PulsarBeamOff", "V", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2377, "PulsarBeam", 0, "RipField", "Effect RipField", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 5.0f },
+    { false, 2378, "PulsarBeam", 1, "", "PulsarBeam_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2379, "PulsarCannon", 0, "PulsarCannon", "Effect PulsarCannon", "", 0, 0, 0, 1, false, true, false, 0.0f, false, 5.0f },
+    { false, 2380, "PulsarCannon", 1, "", "PulsarCannon_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2381, "VoidSwarmHostSpawnLocust", 0, "VoidSwarmHostSpawnLocust", "Effect VoidSwarmHostSpawnLocust", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 13.0f },
+    { false, 2382, "VoidSwarmHostSpawnLocust", 1, "", "VoidSwarmHostSpawnLocust_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2383, "LocustMPFlyingMorphToGround", 0, "LocustMPFlyingSwoop", "Morph LocustMPFlyingSwoop", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2384, "LocustMPFlyingMorphToGround", 1, "", "LocustMPFlyingMorphToGround_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2385, "LocustMPMorphToAir", 0, "LocustMPFlyingSwoop", "Morph LocustMPFlyingSwoop", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2386, "LocustMPMorphToAir", 1, "", "LocustMPMorphToAir_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2387, "LocustMPFlyingSwoop", 0, "LocustMPFlyingSwoop", "Effect LocustSwoop", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 6.0f },
+    { true, 2388, "LocustMPFlyingSwoop", 1, "", "LocustMPFlyingSwoop_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2389, "HallucinationDisruptor", 0, "WarpinDisruptor", "Hallucination Disruptor", "CV", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2390, "HallucinationDisruptor", 1, "", "HallucinationDisruptor_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2391, "HallucinationAdept", 0, "WarpInAdept", "Hallucination Adept", "CE", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2392, "HallucinationAdept", 1, "", "HallucinationAdept_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2393, "VoidRaySwarmDamageBoost", 0, "VoidRaySwarmDamageBoost", "Effect VoidRayPrismaticAlignment", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2394, "VoidRaySwarmDamageBoost", 1, "", "VoidRaySwarmDamageBoost_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2395, "SeekerDummyChannel", 0, "", "SeekerDummyChannel_0", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 500.0f },
+    { true, 2396, "SeekerDummyChannel", 1, "", "SeekerDummyChannel_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2397, "AiurLightBridgeNE8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2398, "AiurLightBridgeNE8Out", 1, "", "AiurLightBridgeNE8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2399, "AiurLightBridgeNE8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2400, "AiurLightBridgeNE8", 1, "", "AiurLightBridgeNE8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2401, "AiurLightBridgeNE10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2402, "AiurLightBridgeNE10Out", 1, "", "AiurLightBridgeNE10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2403, "AiurLightBridgeNE10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2404, "AiurLightBridgeNE10", 1, "", "AiurLightBridgeNE10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2405, "AiurLightBridgeNE12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2406, "AiurLightBridgeNE12Out", 1, "", "AiurLightBridgeNE12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2407, "AiurLightBridgeNE12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2408, "AiurLightBridgeNE12", 1, "", "AiurLightBridgeNE12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2409, "AiurLightBridgeNW8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2410, "AiurLightBridgeNW8Out", 1, "", "AiurLightBridgeNW8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2411, "AiurLightBridgeNW8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2412, "AiurLightBridgeNW8", 1, "", "AiurLightBridgeNW8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2413, "AiurLightBridgeNW10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2414, "AiurLightBridgeNW10Out", 1, "", "AiurLightBridgeNW10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2415, "AiurLightBridgeNW10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2416, "AiurLightBridgeNW10", 1, "", "AiurLightBridgeNW10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2417, "AiurLightBridgeNW12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2418, "AiurLightBridgeNW12Out", 1, "", "AiurLightBridgeNW12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2419, "AiurLightBridgeNW12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2420, "AiurLightBridgeNW12", 1, "", "AiurLightBridgeNW12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2421, "AiurTempleBridgeNE8Out", 0, "BridgeExtend", "Morph BridgeExtend", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2422, "AiurTempleBridgeNE8Out", 1, "", "AiurTempleBridgeNE8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2423, "AiurTempleBridgeNE8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2424, "AiurTempleBridgeNE8", 1, "", "AiurTempleBridgeNE8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2425, "AiurTempleBridgeNE10Out", 0, "BridgeExtend", "Morph BridgeExtend", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2426, "AiurTempleBridgeNE10Out", 1, "", "AiurTempleBridgeNE10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2427, "AiurTempleBridgeNE10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2428, "AiurTempleBridgeNE10", 1, "", "AiurTempleBridgeNE10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2429, "AiurTempleBridgeNE12Out", 0, "BridgeExtend", "Morph BridgeExtend", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2430, "AiurTempleBridgeNE12Out", 1, "", "AiurTempleBridgeNE12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2431, "AiurTempleBridgeNE12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2432, "AiurTempleBridgeNE12", 1, "", "AiurTempleBridgeNE12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2433, "AiurTempleBridgeNW8Out", 0, "BridgeExtend", "Morph BridgeExtend", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2434, "AiurTempleBridgeNW8Out", 1, "", "AiurTempleBridgeNW8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2435, "AiurTempleBridgeNW8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2436, "AiurTempleBridgeNW8", 1, "", "AiurTempleBridgeNW8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2437, "AiurTempleBridgeNW10Out", 0, "BridgeExtend", "Morph BridgeExtend", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2438, "AiurTempleBridgeNW10Out", 1, "", "AiurTempleBridgeNW10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2439, "AiurTempleBridgeNW10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2440, "AiurTempleBridgeNW10", 1, "", "AiurTempleBridgeNW10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2441, "AiurTempleBridgeNW12Out", 0, "BridgeExtend", "Morph BridgeExtend", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2442, "AiurTempleBridgeNW12Out", 1, "", "AiurTempleBridgeNW12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2443, "AiurTempleBridgeNW12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2444, "AiurTempleBridgeNW12", 1, "", "AiurTempleBridgeNW12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2445, "ShakurasLightBridgeNE8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2446, "ShakurasLightBridgeNE8Out", 1, "", "ShakurasLightBridgeNE8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2447, "ShakurasLightBridgeNE8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2448, "ShakurasLightBridgeNE8", 1, "", "ShakurasLightBridgeNE8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2449, "ShakurasLightBridgeNE10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2450, "ShakurasLightBridgeNE10Out", 1, "", "ShakurasLightBridgeNE10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2451, "ShakurasLightBridgeNE10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2452, "ShakurasLightBridgeNE10", 1, "", "ShakurasLightBridgeNE10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2453, "ShakurasLightBridgeNE12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2454, "ShakurasLightBridgeNE12Out", 1, "", "ShakurasLightBridgeNE12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2455, "ShakurasLightBridgeNE12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2456, "ShakurasLightBridgeNE12", 1, "", "ShakurasLightBridgeNE12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2457, "ShakurasLightBridgeNW8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2458, "ShakurasLightBridgeNW8Out", 1, "", "ShakurasLightBridgeNW8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2459, "ShakurasLightBridgeNW8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2460, "ShakurasLightBridgeNW8", 1, "", "ShakurasLightBridgeNW8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2461, "ShakurasLightBridgeNW10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2462, "ShakurasLightBridgeNW10Out", 1, "", "ShakurasLightBridgeNW10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2463, "ShakurasLightBridgeNW10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2464, "ShakurasLightBridgeNW10", 1, "", "ShakurasLightBridgeNW10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2465, "ShakurasLightBridgeNW12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2466, "ShakurasLightBridgeNW12Out", 1, "", "ShakurasLightBridgeNW12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2467, "ShakurasLightBridgeNW12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2468, "ShakurasLightBridgeNW12", 1, "", "ShakurasLightBridgeNW12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2469, "VoidMPImmortalReviveRebuild", 0, "Immortal", "Morph Immortal", "Z", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2470, "VoidMPImmortalReviveRebuild", 1, "", "VoidMPImmortalReviveRebuild_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2471, "VoidMPImmortalReviveDeath", 0, "Immortal", "Morph Immortal", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2472, "VoidMPImmortalReviveDeath", 1, "", "VoidMPImmortalReviveDeath_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2473, "ArbiterMPStasisField", 0, "ArbiterMPStasisField", "Effect ArbiterMPStasisField", "Z", 0, 0, 0, 4, false, false, false, 0.0f, false, 9.0f },
+    { true, 2474, "ArbiterMPStasisField", 1, "", "ArbiterMPStasisField_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2475, "ArbiterMPRecall", 0, "ArbiterMPRecall", "Effect ArbiterMPRecall", "X", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 2476, "ArbiterMPRecall", 1, "", "ArbiterMPRecall_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2477, "CorsairMPDisruptionWeb", 0, "CorsairMPDisruptionWeb", "Effect CorsairMPDisruptionWeb", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { true, 2478, "CorsairMPDisruptionWeb", 1, "", "CorsairMPDisruptionWeb_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2479, "MorphToGuardianMP", 0, "MorphToGuardianMP", "Morph MorphToGuardianMP", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2480, "MorphToGuardianMP", 1, "Cancel", "Morph Cancel", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2481, "MorphToDevourerMP", 0, "MorphToDevourerMP", "Morph MorphToDevourerMP", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2482, "MorphToDevourerMP", 1, "Cancel", "Morph Cancel", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2483, "DefilerMPConsume", 0, "DefilerMPConsume", "Effect DefilerMPConsume", "Z", 0, 0, 0, 3, false, false, false, 0.0f, false, 0.5f },
+    { true, 2484, "DefilerMPConsume", 1, "", "DefilerMPConsume_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2485, "DefilerMPDarkSwarm", 0, "DefilerMPDarkSwarm", "Effect DefilerMPDarkSwarm", "X", 0, 0, 0, 2, false, false, false, 0.0f, false, 8.0f },
+    { true, 2486, "DefilerMPDarkSwarm", 1, "", "DefilerMPDarkSwarm_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2487, "DefilerMPPlague", 0, "DefilerMPPlague", "Effect DefilerMPPlague", "C", 0, 0, 0, 2, false, false, false, 0.0f, false, 8.0f },
+    { true, 2488, "DefilerMPPlague", 1, "", "DefilerMPPlague_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2489, "DefilerMPBurrow", 0, "BurrowDown", "Morph BurrowDown", "B", 3661, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2490, "DefilerMPBurrow", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2491, "DefilerMPUnburrow", 0, "BurrowUp", "Morph BurrowUp", "B", 3662, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 2492, "DefilerMPUnburrow", 1, "", "DefilerMPUnburrow_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2493, "QueenMPEnsnare", 0, "QueenMPEnsnare", "Effect QueenMPEnsnare", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { true, 2494, "QueenMPEnsnare", 1, "", "QueenMPEnsnare_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2495, "QueenMPSpawnBroodlings", 0, "QueenMPSpawnBroodlings", "Effect QueenMPSpawnBroodlings", "X", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { true, 2496, "QueenMPSpawnBroodlings", 1, "", "QueenMPSpawnBroodlings_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2497, "QueenMPInfestCommandCenter", 0, "QueenMPInfestCommandCenter", "Effect QueenMPInfestCommandCenter", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 1.0f },
+    { true, 2498, "QueenMPInfestCommandCenter", 1, "", "QueenMPInfestCommandCenter_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2499, "LightningBomb", 0, "LightningBomb", "Effect LightningBomb", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { false, 2500, "LightningBomb", 1, "", "LightningBomb_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2501, "Grapple", 0, "Grapple", "Effect Grapple", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { false, 2502, "Grapple", 1, "", "Grapple_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2503, "OracleStasisTrap", 0, "OracleBuildStasisTrap", "Effect OracleBuildStasisTrap", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 4.0f },
+    { false, 2504, "OracleStasisTrap", 1, "", "OracleStasisTrap_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2505, "OracleStasisTrapBuild", 0, "OracleBuildStasisTrap", "Build StasisTrap", "X", 0, 0, 0, 2, false, false, true, 0.5f, false, 0.0f },
+    { true, 2506, "OracleStasisTrapBuild", 1, "", "OracleStasisTrapBuild_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2507, "OracleStasisTrapBuild", 2, "", "OracleStasisTrapBuild_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2508, "OracleStasisTrapBuild", 3, "", "OracleStasisTrapBuild_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2509, "OracleStasisTrapBuild", 4, "", "OracleStasisTrapBuild_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2510, "OracleStasisTrapBuild", 5, "", "OracleStasisTrapBuild_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2511, "OracleStasisTrapBuild", 6, "", "OracleStasisTrapBuild_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2512, "OracleStasisTrapBuild", 7, "", "OracleStasisTrapBuild_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2513, "OracleStasisTrapBuild", 8, "", "OracleStasisTrapBuild_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2514, "OracleStasisTrapBuild", 9, "", "OracleStasisTrapBuild_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2515, "OracleStasisTrapBuild", 10, "", "OracleStasisTrapBuild_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2516, "OracleStasisTrapBuild", 11, "", "OracleStasisTrapBuild_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2517, "OracleStasisTrapBuild", 12, "", "OracleStasisTrapBuild_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2518, "OracleStasisTrapBuild", 13, "", "OracleStasisTrapBuild_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2519, "OracleStasisTrapBuild", 14, "", "OracleStasisTrapBuild_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2520, "OracleStasisTrapBuild", 15, "", "OracleStasisTrapBuild_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2521, "OracleStasisTrapBuild", 16, "", "OracleStasisTrapBuild_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2522, "OracleStasisTrapBuild", 17, "", "OracleStasisTrapBuild_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2523, "OracleStasisTrapBuild", 18, "", "OracleStasisTrapBuild_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2524, "OracleStasisTrapBuild", 19, "", "OracleStasisTrapBuild_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2525, "OracleStasisTrapBuild", 20, "", "OracleStasisTrapBuild_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2526, "OracleStasisTrapBuild", 21, "", "OracleStasisTrapBuild_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2527, "OracleStasisTrapBuild", 22, "", "OracleStasisTrapBuild_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2528, "OracleStasisTrapBuild", 23, "", "OracleStasisTrapBuild_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2529, "OracleStasisTrapBuild", 24, "", "OracleStasisTrapBuild_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2530, "OracleStasisTrapBuild", 25, "", "OracleStasisTrapBuild_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2531, "OracleStasisTrapBuild", 26, "", "OracleStasisTrapBuild_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2532, "OracleStasisTrapBuild", 27, "", "OracleStasisTrapBuild_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2533, "OracleStasisTrapBuild", 28, "", "OracleStasisTrapBuild_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2534, "OracleStasisTrapBuild", 29, "", "OracleStasisTrapBuild_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2535, "OracleStasisTrapBuild", 30, "Cancel", "Cancel StasisTrap", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2536, "OracleStasisTrapActivate", 0, "ActivateStasisWard", "Effect ActivateStasisWard", "", 0, 0, 0, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 2537, "OracleStasisTrapActivate", 1, "", "OracleStasisTrapActivate_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2538, "SelfRepair", 0, "SelfRepair", "Effect SelfRepair", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2539, "SelfRepair", 1, "Cancel", "SelfRepair_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2540, "AggressiveMutation", 0, "AggressiveMutation", "Effect AggressiveMutation", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 9.0f },
+    { false, 2541, "AggressiveMutation", 1, "", "AggressiveMutation_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2542, "ParasiticBomb", 0, "ParasiticBomb", "Effect ParasiticBomb", "V", 0, 0, 0, 3, false, false, false, 0.0f, false, 8.0f },
+    { true, 2543, "ParasiticBomb", 1, "", "ParasiticBomb_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2544, "AdeptPhaseShift", 0, "AdeptPhaseShift", "Effect AdeptPhaseShift", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 2545, "AdeptPhaseShift", 1, "", "AdeptPhaseShift_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2546, "PurificationNovaMorph", 0, "PurificationNova", "Morph PurificationNova", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2547, "PurificationNovaMorph", 1, "", "PurificationNovaMorph_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2548, "PurificationNovaMorphBack", 0, "PurificationNova", "Morph PurificationNova", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2549, "PurificationNovaMorphBack", 1, "", "PurificationNovaMorphBack_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2550, "LurkerHoldFire", 0, "LurkerHoldFire", "Behavior HoldFireOn Lurker", "D", 3688, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2551, "LurkerHoldFire", 1, "", "LurkerHoldFire_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2552, "LurkerRemoveHoldFire", 0, "LurkerCancelHoldFire", "Behavior HoldFireOff Lurker", "F", 3689, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2553, "LurkerRemoveHoldFire", 1, "", "LurkerRemoveHoldFire_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2554, "LiberatorMorphtoAG", 0, "LiberatorAGMode", "Morph LiberatorAGMode", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2555, "LiberatorMorphtoAG", 1, "", "LiberatorMorphtoAG_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2556, "LiberatorMorphtoAA", 0, "LiberatorAAMode", "Morph LiberatorAAMode", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2557, "LiberatorMorphtoAA", 1, "", "LiberatorMorphtoAA_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2558, "LiberatorAGTarget", 0, "LiberatorAGMode", "Morph LiberatorAGMode", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 5.0f },
+    { true, 2559, "LiberatorAGTarget", 1, "", "LiberatorAGTarget_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2560, "LiberatorAATarget", 0, "LiberatorAAMode", "Morph LiberatorAAMode", "X", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2561, "LiberatorAATarget", 1, "", "LiberatorAATarget_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2562, "TimeStop", 0, "TimeStop", "Effect TimeStop", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { false, 2563, "TimeStop", 1, "Cancel", "TimeStop_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2564, "AiurLightBridgeAbandonedNE8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2565, "AiurLightBridgeAbandonedNE8Out", 1, "", "AiurLightBridgeAbandonedNE8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2566, "AiurLightBridgeAbandonedNE8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2567, "AiurLightBridgeAbandonedNE8", 1, "", "AiurLightBridgeAbandonedNE8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2568, "AiurLightBridgeAbandonedNE10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2569, "AiurLightBridgeAbandonedNE10Out", 1, "", "AiurLightBridgeAbandonedNE10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2570, "AiurLightBridgeAbandonedNE10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2571, "AiurLightBridgeAbandonedNE10", 1, "", "AiurLightBridgeAbandonedNE10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2572, "AiurLightBridgeAbandonedNE12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2573, "AiurLightBridgeAbandonedNE12Out", 1, "", "AiurLightBridgeAbandonedNE12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2574, "AiurLightBridgeAbandonedNE12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2575, "AiurLightBridgeAbandonedNE12", 1, "", "AiurLightBridgeAbandonedNE12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2576, "AiurLightBridgeAbandonedNW8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2577, "AiurLightBridgeAbandonedNW8Out", 1, "", "AiurLightBridgeAbandonedNW8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2578, "AiurLightBridgeAbandonedNW8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2579, "AiurLightBridgeAbandonedNW8", 1, "", "AiurLightBridgeAbandonedNW8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2580, "AiurLightBridgeAbandonedNW10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2581, "AiurLightBridgeAbandonedNW10Out", 1, "", "AiurLightBridgeAbandonedNW10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2582, "AiurLightBridgeAbandonedNW10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2583, "AiurLightBridgeAbandonedNW10", 1, "", "AiurLightBridgeAbandonedNW10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2584, "AiurLightBridgeAbandonedNW12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2585, "AiurLightBridgeAbandonedNW12Out", 1, "", "AiurLightBridgeAbandonedNW12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2586, "AiurLightBridgeAbandonedNW12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2587, "AiurLightBridgeAbandonedNW12", 1, "", "AiurLightBridgeAbandonedNW12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2588, "KD8Charge", 0, "KD8Charge", "Effect KD8Charge", "Z", 0, 0, 0, 4, false, false, false, 0.0f, false, 5.0f },
+    { true, 2589, "KD8Charge", 1, "", "KD8Charge_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2590, "PenetratingShot", 0, "PenetratingShot", "Effect PenetratingShot", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { false, 2591, "PenetratingShot", 1, "", "PenetratingShot_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2592, "CloakingDrone", 0, "CloakingDrone", "Effect CloakingDrone", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 5.0f },
+    { false, 2593, "CloakingDrone", 1, "", "CloakingDrone_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2594, "AdeptPhaseShiftCancel", 0, "Cancel", "Cancel AdeptPhaseShift", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2595, "AdeptPhaseShiftCancel", 1, "", "AdeptPhaseShiftCancel_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2596, "AdeptShadePhaseShiftCancel", 0, "Cancel", "Cancel AdeptShadePhaseShift", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2597, "AdeptShadePhaseShiftCancel", 1, "", "AdeptShadePhaseShiftCancel_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2598, "SlaynElementalGrab", 0, "SlaynElementalGrab", "Effect SlaynElementalGrab", "Z", 0, 0, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { true, 2599, "SlaynElementalGrab", 1, "", "SlaynElementalGrab_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2600, "MorphToCollapsiblePurifierTowerDebris", 0, "", "MorphToCollapsiblePurifierTowerDebris_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2601, "MorphToCollapsiblePurifierTowerDebris", 1, "Cancel", "Morph Cancel", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2602, "PortCity_Bridge_UnitNE8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2603, "PortCity_Bridge_UnitNE8Out", 1, "", "PortCity_Bridge_UnitNE8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2604, "PortCity_Bridge_UnitNE8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2605, "PortCity_Bridge_UnitNE8", 1, "", "PortCity_Bridge_UnitNE8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2606, "PortCity_Bridge_UnitSE8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2607, "PortCity_Bridge_UnitSE8Out", 1, "", "PortCity_Bridge_UnitSE8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2608, "PortCity_Bridge_UnitSE8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2609, "PortCity_Bridge_UnitSE8", 1, "", "PortCity_Bridge_UnitSE8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2610, "PortCity_Bridge_UnitNW8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2611, "PortCity_Bridge_UnitNW8Out", 1, "", "PortCity_Bridge_UnitNW8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2612, "PortCity_Bridge_UnitNW8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2613, "PortCity_Bridge_UnitNW8", 1, "", "PortCity_Bridge_UnitNW8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2614, "PortCity_Bridge_UnitSW8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2615, "PortCity_Bridge_UnitSW8Out", 1, "", "PortCity_Bridge_UnitSW8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2616, "PortCity_Bridge_UnitSW8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2617, "PortCity_Bridge_UnitSW8", 1, "", "PortCity_Bridge_UnitSW8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2618, "PortCity_Bridge_UnitNE10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2619, "PortCity_Bridge_UnitNE10Out", 1, "", "PortCity_Bridge_UnitNE10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2620, "PortCity_Bridge_UnitNE10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2621, "PortCity_Bridge_UnitNE10", 1, "", "PortCity_Bridge_UnitNE10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2622, "PortCity_Bridge_UnitSE10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2623, "PortCity_Bridge_UnitSE10Out", 1, "", "PortCity_Bridge_UnitSE10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2624, "PortCity_Bridge_UnitSE10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2625, "PortCity_Bridge_UnitSE10", 1, "", "PortCity_Bridge_UnitSE10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2626, "PortCity_Bridge_UnitNW10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2627, "PortCity_Bridge_UnitNW10Out", 1, "", "PortCity_Bridge_UnitNW10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2628, "PortCity_Bridge_UnitNW10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2629, "PortCity_Bridge_UnitNW10", 1, "", "PortCity_Bridge_UnitNW10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2630, "PortCity_Bridge_UnitSW10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2631, "PortCity_Bridge_UnitSW10Out", 1, "", "PortCity_Bridge_UnitSW10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2632, "PortCity_Bridge_UnitSW10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2633, "PortCity_Bridge_UnitSW10", 1, "", "PortCity_Bridge_UnitSW10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2634, "PortCity_Bridge_UnitNE12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2635, "PortCity_Bridge_UnitNE12Out", 1, "", "PortCity_Bridge_UnitNE12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2636, "PortCity_Bridge_UnitNE12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2637, "PortCity_Bridge_UnitNE12", 1, "", "PortCity_Bridge_UnitNE12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2638, "PortCity_Bridge_UnitSE12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2639, "PortCity_Bridge_UnitSE12Out", 1, "", "PortCity_Bridge_UnitSE12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2640, "PortCity_Bridge_UnitSE12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2641, "PortCity_Bridge_UnitSE12", 1, "", "PortCity_Bridge_UnitSE12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2642, "PortCity_Bridge_UnitNW12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2643, "PortCity_Bridge_UnitNW12Out", 1, "", "PortCity_Bridge_UnitNW12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2644, "PortCity_Bridge_UnitNW12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2645, "PortCity_Bridge_UnitNW12", 1, "", "PortCity_Bridge_UnitNW12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2646, "PortCity_Bridge_UnitSW12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2647, "PortCity_Bridge_UnitSW12Out", 1, "", "PortCity_Bridge_UnitSW12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2648, "PortCity_Bridge_UnitSW12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2649, "PortCity_Bridge_UnitSW12", 1, "", "PortCity_Bridge_UnitSW12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2650, "PortCity_Bridge_UnitN8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2651, "PortCity_Bridge_UnitN8Out", 1, "", "PortCity_Bridge_UnitN8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2652, "PortCity_Bridge_UnitN8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2653, "PortCity_Bridge_UnitN8", 1, "", "PortCity_Bridge_UnitN8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2654, "PortCity_Bridge_UnitS8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2655, "PortCity_Bridge_UnitS8Out", 1, "", "PortCity_Bridge_UnitS8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2656, "PortCity_Bridge_UnitS8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2657, "PortCity_Bridge_UnitS8", 1, "", "PortCity_Bridge_UnitS8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2658, "PortCity_Bridge_UnitE8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2659, "PortCity_Bridge_UnitE8Out", 1, "", "PortCity_Bridge_UnitE8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2660, "PortCity_Bridge_UnitE8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2661, "PortCity_Bridge_UnitE8", 1, "", "PortCity_Bridge_UnitE8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2662, "PortCity_Bridge_UnitW8Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2663, "PortCity_Bridge_UnitW8Out", 1, "", "PortCity_Bridge_UnitW8Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2664, "PortCity_Bridge_UnitW8", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2665, "PortCity_Bridge_UnitW8", 1, "", "PortCity_Bridge_UnitW8_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2666, "PortCity_Bridge_UnitN10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2667, "PortCity_Bridge_UnitN10Out", 1, "", "PortCity_Bridge_UnitN10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2668, "PortCity_Bridge_UnitN10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2669, "PortCity_Bridge_UnitN10", 1, "", "PortCity_Bridge_UnitN10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2670, "PortCity_Bridge_UnitS10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2671, "PortCity_Bridge_UnitS10Out", 1, "", "PortCity_Bridge_UnitS10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2672, "PortCity_Bridge_UnitS10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2673, "PortCity_Bridge_UnitS10", 1, "", "PortCity_Bridge_UnitS10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2674, "PortCity_Bridge_UnitE10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2675, "PortCity_Bridge_UnitE10Out", 1, "", "PortCity_Bridge_UnitE10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2676, "PortCity_Bridge_UnitE10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2677, "PortCity_Bridge_UnitE10", 1, "", "PortCity_Bridge_UnitE10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2678, "PortCity_Bridge_UnitW10Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2679, "PortCity_Bridge_UnitW10Out", 1, "", "PortCity_Bridge_UnitW10Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2680, "PortCity_Bridge_UnitW10", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2681, "PortCity_Bridge_UnitW10", 1, "", "PortCity_Bridge_UnitW10_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2682, "PortCity_Bridge_UnitN12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2683, "PortCity_Bridge_UnitN12Out", 1, "", "PortCity_Bridge_UnitN12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2684, "PortCity_Bridge_UnitN12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2685, "PortCity_Bridge_UnitN12", 1, "", "PortCity_Bridge_UnitN12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2686, "PortCity_Bridge_UnitS12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2687, "PortCity_Bridge_UnitS12Out", 1, "", "PortCity_Bridge_UnitS12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2688, "PortCity_Bridge_UnitS12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2689, "PortCity_Bridge_UnitS12", 1, "", "PortCity_Bridge_UnitS12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2690, "PortCity_Bridge_UnitE12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2691, "PortCity_Bridge_UnitE12Out", 1, "", "PortCity_Bridge_UnitE12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2692, "PortCity_Bridge_UnitE12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2693, "PortCity_Bridge_UnitE12", 1, "", "PortCity_Bridge_UnitE12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2694, "PortCity_Bridge_UnitW12Out", 0, "BridgeExtend", "Morph BridgeExtend", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2695, "PortCity_Bridge_UnitW12Out", 1, "", "PortCity_Bridge_UnitW12Out_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2696, "PortCity_Bridge_UnitW12", 0, "BridgeRetract", "Morph BridgeRetract", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2697, "PortCity_Bridge_UnitW12", 1, "", "PortCity_Bridge_UnitW12_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2698, "TempestDisruptionBlast", 0, "TempestDisruptionBlast", "Effect TempestDisruptionBlast", "", 0, 0, 0, 2, false, false, false, 0.0f, false, 10.0f },
+    { false, 2699, "TempestDisruptionBlast", 1, "Cancel", "Cancel TempestDisruptionBlast", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2700, "DarkTemplarBlink", 0, "DarkTemplarBlink", "Effect ShadowStride", "X", 3687, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 2701, "DarkTemplarBlink", 1, "", "DarkTemplarBlink_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2702, "LaunchInterceptors", 0, "", "LaunchInterceptors_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 9.0f },
+    { false, 2703, "LaunchInterceptors", 1, "", "LaunchInterceptors_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2704, "SpawnLocustsTargeted", 0, "SwarmHost", "Effect SpawnLocusts", "Z", 0, 0, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 2705, "SpawnLocustsTargeted", 1, "", "SpawnLocustsTargeted_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2706, "LocustMPFlyingSwoopAttack", 0, "LocustMPFlyingSwoop", "Effect LocustMPFlyingSwoop", "", 0, 0, 0, 4, false, false, false, 0.0f, false, 6.0f },
+    { true, 2707, "LocustMPFlyingSwoopAttack", 1, "", "LocustMPFlyingSwoopAttack_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2708, "MorphToTransportOverlord", 0, "MorphtoOverlordTransport", "Morph OverlordTransport", "C", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2709, "MorphToTransportOverlord", 1, "Cancel", "Cancel MorphOverlordTransport", "B", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2710, "BypassArmor", 0, "", "BypassArmor_0", "", 0, 0, 0, 3, false, true, false, 0.0f, false, 6.0f },
+    { false, 2711, "BypassArmor", 1, "", "BypassArmor_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2712, "BypassArmorDroneCU", 0, "", "BypassArmorDroneCU_0", "", 0, 0, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { false, 2713, "BypassArmorDroneCU", 1, "", "BypassArmorDroneCU_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2714, "ChannelSnipe", 0, "ChannelSnipe", "Effect GhostSnipe", "Z", 0, 0, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { true, 2715, "ChannelSnipe", 1, "", "ChannelSnipe_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2716, "PurifyMorphPylon", 0, "MothershipCoreWeapon", "Morph MothershipCoreWeapon", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2717, "PurifyMorphPylon", 1, "", "PurifyMorphPylon_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2718, "PurifyMorphPylonBack", 0, "MothershipCoreWeapon", "Morph MothershipCoreWeapon", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2719, "PurifyMorphPylonBack", 1, "", "PurifyMorphPylonBack_1", "", 3659, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2720, "DarkShrineResearch", 0, "ResearchDarkTemplarBlink", "Research ShadowStrike", "Q", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2721, "DarkShrineResearch", 1, "", "DarkShrineResearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2722, "DarkShrineResearch", 2, "", "DarkShrineResearch_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2723, "DarkShrineResearch", 3, "", "DarkShrineResearch_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2724, "DarkShrineResearch", 4, "", "DarkShrineResearch_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2725, "DarkShrineResearch", 5, "", "DarkShrineResearch_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2726, "DarkShrineResearch", 6, "", "DarkShrineResearch_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2727, "DarkShrineResearch", 7, "", "DarkShrineResearch_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2728, "DarkShrineResearch", 8, "", "DarkShrineResearch_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2729, "DarkShrineResearch", 9, "", "DarkShrineResearch_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2730, "DarkShrineResearch", 10, "", "DarkShrineResearch_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2731, "DarkShrineResearch", 11, "", "DarkShrineResearch_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2732, "DarkShrineResearch", 12, "", "DarkShrineResearch_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2733, "DarkShrineResearch", 13, "", "DarkShrineResearch_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2734, "DarkShrineResearch", 14, "", "DarkShrineResearch_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2735, "DarkShrineResearch", 15, "", "DarkShrineResearch_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2736, "DarkShrineResearch", 16, "", "DarkShrineResearch_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2737, "DarkShrineResearch", 17, "", "DarkShrineResearch_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2738, "DarkShrineResearch", 18, "", "DarkShrineResearch_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2739, "DarkShrineResearch", 19, "", "DarkShrineResearch_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2740, "DarkShrineResearch", 20, "", "DarkShrineResearch_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2741, "DarkShrineResearch", 21, "", "DarkShrineResearch_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2742, "DarkShrineResearch", 22, "", "DarkShrineResearch_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2743, "DarkShrineResearch", 23, "", "DarkShrineResearch_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2744, "DarkShrineResearch", 24, "", "DarkShrineResearch_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2745, "DarkShrineResearch", 25, "", "DarkShrineResearch_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2746, "DarkShrineResearch", 26, "", "DarkShrineResearch_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2747, "DarkShrineResearch", 27, "", "DarkShrineResearch_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2748, "DarkShrineResearch", 28, "", "DarkShrineResearch_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 2749, "DarkShrineResearch", 29, "", "DarkShrineResearch_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2750, "heal", 0, "MedicHeal", "heal_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2751, "heal", 1, "", "heal_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2752, "LurkerAspect", 0, "Lurker", "LurkerAspect_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2753, "LurkerAspect", 1, "Cancel", "LurkerAspect_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2754, "BurrowLurkerDown", 0, "BurrowDown", "BurrowLurkerDown_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2755, "BurrowLurkerDown", 1, "Cancel", "BurrowLurkerDown_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2756, "BurrowLurkerUp", 0, "BurrowUp", "BurrowLurkerUp_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2757, "BurrowLurkerUp", 1, "", "BurrowLurkerUp_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2758, "D8Charge", 0, "D8Charge", "D8Charge_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2759, "D8Charge", 1, "", "D8Charge_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2760, "DefensiveMatrix", 0, "DefensiveMatrix", "DefensiveMatrix_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2761, "DefensiveMatrix", 1, "", "DefensiveMatrix_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2762, "MissilePods", 0, "MissilePods", "MissilePods_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2763, "MissilePods", 1, "", "MissilePods_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2764, "LokiMissilePods", 0, "MissilePods", "LokiMissilePods_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2765, "LokiMissilePods", 1, "", "LokiMissilePods_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2766, "HutTransport", 0, "HutLoad", "HutTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2767, "HutTransport", 1, "HutUnloadAll", "HutTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2768, "HutTransport", 2, "", "HutTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2769, "HutTransport", 3, "", "HutTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2770, "HutTransport", 4, "", "HutTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2771, "MorphToTechReactor", 0, "", "MorphToTechReactor_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2772, "MorphToTechReactor", 1, "", "MorphToTechReactor_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2773, "LeviathanSpawnBroodLord", 0, "SpawnBroodLord", "LeviathanSpawnBroodLord_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2774, "LeviathanSpawnBroodLord", 1, "", "LeviathanSpawnBroodLord_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2775, "SS_CarrierBossAttackLaunch", 0, "SS_Shooting", "SS_CarrierBossAttackLaunch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2776, "SS_CarrierBossAttackLaunch", 1, "", "SS_CarrierBossAttackLaunch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2777, "SS_CarrierSpawnInterceptor", 0, "SS_CarrierSpawnInterceptor", "SS_CarrierSpawnInterceptor_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2778, "SS_CarrierSpawnInterceptor", 1, "", "SS_CarrierSpawnInterceptor_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2779, "SS_CarrierBossAttackTarget", 0, "SS_Shooting", "SS_CarrierBossAttackTarget_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2780, "SS_CarrierBossAttackTarget", 1, "", "SS_CarrierBossAttackTarget_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2781, "SS_FighterBomb", 0, "SS_FighterBomb", "SS_FighterBomb_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2782, "SS_FighterBomb", 1, "", "SS_FighterBomb_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2783, "SS_LightningProjectorToggle", 0, "", "SS_LightningProjectorToggle_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2784, "SS_LightningProjectorToggle", 1, "", "SS_LightningProjectorToggle_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2785, "SS_PhoenixShooting", 0, "SS_Shooting", "SS_PhoenixShooting_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2786, "SS_PhoenixShooting", 1, "", "SS_PhoenixShooting_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2787, "SS_PowerupMorphToBomb", 0, "", "SS_PowerupMorphToBomb_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2788, "SS_PowerupMorphToBomb", 1, "", "SS_PowerupMorphToBomb_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2789, "SS_BattlecruiserMissileAttack", 0, "SS_Shooting", "SS_BattlecruiserMissileAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2790, "SS_BattlecruiserMissileAttack", 1, "", "SS_BattlecruiserMissileAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2791, "SS_LeviathanSpawnBombs", 0, "SS_LeviathanSpawnBombs", "SS_LeviathanSpawnBombs_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2792, "SS_LeviathanSpawnBombs", 1, "", "SS_LeviathanSpawnBombs_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2793, "SS_BattlecruiserHunterSeekerAttack", 0, "SS_Shooting", "SS_BattlecruiserHunterSeekerAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2794, "SS_BattlecruiserHunterSeekerAttack", 1, "", "SS_BattlecruiserHunterSeekerAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2795, "SS_PowerupMorphToHealth", 0, "", "SS_PowerupMorphToHealth_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2796, "SS_PowerupMorphToHealth", 1, "", "SS_PowerupMorphToHealth_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2797, "SS_LeviathanTentacleAttackL1NoDelay", 0, "SS_LeviathanTentacleAttackL1NoDelay", "SS_LeviathanTentacleAttackL1NoDelay_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2798, "SS_LeviathanTentacleAttackL1NoDelay", 1, "", "SS_LeviathanTentacleAttackL1NoDelay_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2799, "SS_LeviathanTentacleAttackL2NoDelay", 0, "SS_LeviathanTentacleAttackL2NoDelay", "SS_LeviathanTentacleAttackL2NoDelay_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2800, "SS_LeviathanTentacleAttackL2NoDelay", 1, "", "SS_LeviathanTentacleAttackL2NoDelay_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2801, "SS_LeviathanTentacleAttackR1NoDelay", 0, "SS_LeviathanTentacleAttackR1NoDelay", "SS_LeviathanTentacleAttackR1NoDelay_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2802, "SS_LeviathanTentacleAttackR1NoDelay", 1, "", "SS_LeviathanTentacleAttackR1NoDelay_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2803, "SS_LeviathanTentacleAttackR2NoDelay", 0, "SS_LeviathanTentacleAttackR2NoDelay", "SS_LeviathanTentacleAttackR2NoDelay_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2804, "SS_LeviathanTentacleAttackR2NoDelay", 1, "", "SS_LeviathanTentacleAttackR2NoDelay_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2805, "SS_ScienceVesselTeleport", 0, "ZeratulBlink", "SS_ScienceVesselTeleport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2806, "SS_ScienceVesselTeleport", 1, "", "SS_ScienceVesselTeleport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2807, "SS_TerraTronBeamAttack", 0, "SS_TerraTronBeamAttack", "SS_TerraTronBeamAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2808, "SS_TerraTronBeamAttack", 1, "", "SS_TerraTronBeamAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2809, "SS_TerraTronSawAttack", 0, "SS_TerraTronSawAttack", "SS_TerraTronSawAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2810, "SS_TerraTronSawAttack", 1, "", "SS_TerraTronSawAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2811, "SS_WraithAttack", 0, "SS_Shooting", "SS_WraithAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2812, "SS_WraithAttack", 1, "", "SS_WraithAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2813, "SS_SwarmGuardianAttack", 0, "SS_Shooting", "SS_SwarmGuardianAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2814, "SS_SwarmGuardianAttack", 1, "", "SS_SwarmGuardianAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2815, "SS_PowerupMorphToSideMissiles", 0, "", "SS_PowerupMorphToSideMissiles_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2816, "SS_PowerupMorphToSideMissiles", 1, "", "SS_PowerupMorphToSideMissiles_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2817, "SS_PowerupMorphToStrongerMissiles", 0, "", "SS_PowerupMorphToStrongerMissiles_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2818, "SS_PowerupMorphToStrongerMissiles", 1, "", "SS_PowerupMorphToStrongerMissiles_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2819, "SS_ScoutAttack", 0, "SS_Shooting", "SS_ScoutAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2820, "SS_ScoutAttack", 1, "", "SS_ScoutAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2821, "SS_InterceptorAttack", 0, "SS_Shooting", "SS_InterceptorAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2822, "SS_InterceptorAttack", 1, "", "SS_InterceptorAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2823, "SS_CorruptorAttack", 0, "SS_Shooting", "SS_CorruptorAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2824, "SS_CorruptorAttack", 1, "", "SS_CorruptorAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2825, "SS_LeviathanTentacleAttackL2", 0, "SS_LeviathanTentacleAttackL2", "SS_LeviathanTentacleAttackL2_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2826, "SS_LeviathanTentacleAttackL2", 1, "", "SS_LeviathanTentacleAttackL2_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2827, "SS_LeviathanTentacleAttackR1", 0, "SS_LeviathanTentacleAttackR1", "SS_LeviathanTentacleAttackR1_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2828, "SS_LeviathanTentacleAttackR1", 1, "", "SS_LeviathanTentacleAttackR1_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2829, "SS_LeviathanTentacleAttackL1", 0, "SS_LeviathanTentacleAttackL1", "SS_LeviathanTentacleAttackL1_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2830, "SS_LeviathanTentacleAttackL1", 1, "", "SS_LeviathanTentacleAttackL1_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2831, "SS_LeviathanTentacleAttackR2", 0, "SS_LeviathanTentacleAttackR2", "SS_LeviathanTentacleAttackR2_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2832, "SS_LeviathanTentacleAttackR2", 1, "", "SS_LeviathanTentacleAttackR2_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2833, "SS_ScienceVesselAttack", 0, "SS_Shooting", "SS_ScienceVesselAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2834, "SS_ScienceVesselAttack", 1, "", "SS_ScienceVesselAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2835, "healRedirect", 0, "", "healRedirect_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2836, "LurkerAspectFromHydraliskBurrowed", 0, "LurkerFromHydraliskBurrowed", "LurkerAspectFromHydraliskBurrowed_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2837, "LurkerAspectFromHydraliskBurrowed", 1, "Cancel", "LurkerAspectFromHydraliskBurrowed_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2838, "UpgradeToLurkerDen", 0, "LurkerDen", "UpgradeToLurkerDen_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2839, "UpgradeToLurkerDen", 1, "Cancel", "UpgradeToLurkerDen_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2840, "AdvancedConstruction", 0, "Cancel", "AdvancedConstruction_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2841, "AdvancedConstruction", 1, "Cancel", "AdvancedConstruction_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2842, "BuildinProgressNonCancellable", 0, "Cancel", "BuildinProgressNonCancellable_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2843, "BuildinProgressNonCancellable", 1, "Cancel", "BuildinProgressNonCancellable_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2844, "InfestedVentSpawnCorruptor", 0, "SpawnCorruptor", "InfestedVentSpawnCorruptor_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2845, "InfestedVentSpawnCorruptor", 1, "", "InfestedVentSpawnCorruptor_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2846, "InfestedVentSpawnBroodLord", 0, "SpawnBroodLord", "InfestedVentSpawnBroodLord_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2847, "InfestedVentSpawnBroodLord", 1, "", "InfestedVentSpawnBroodLord_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2848, "Irradiate", 0, "Irradiate", "Irradiate_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2849, "Irradiate", 1, "Cancel", "Irradiate_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2850, "InfestedVentSpawnMutalisk", 0, "LeviathanSpawnMutalisk", "InfestedVentSpawnMutalisk_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2851, "InfestedVentSpawnMutalisk", 1, "", "InfestedVentSpawnMutalisk_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2852, "MakeVultureSpiderMines", 0, "SpiderMineReplenish", "MakeVultureSpiderMines_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2853, "MakeVultureSpiderMines", 1, "", "MakeVultureSpiderMines_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2854, "MakeVultureSpiderMines", 2, "", "MakeVultureSpiderMines_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2855, "MakeVultureSpiderMines", 3, "", "MakeVultureSpiderMines_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2856, "MakeVultureSpiderMines", 4, "", "MakeVultureSpiderMines_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2857, "MakeVultureSpiderMines", 5, "", "MakeVultureSpiderMines_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2858, "MakeVultureSpiderMines", 6, "", "MakeVultureSpiderMines_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2859, "MakeVultureSpiderMines", 7, "", "MakeVultureSpiderMines_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2860, "MakeVultureSpiderMines", 8, "", "MakeVultureSpiderMines_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2861, "MakeVultureSpiderMines", 9, "", "MakeVultureSpiderMines_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2862, "MakeVultureSpiderMines", 10, "", "MakeVultureSpiderMines_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2863, "MakeVultureSpiderMines", 11, "", "MakeVultureSpiderMines_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2864, "MakeVultureSpiderMines", 12, "", "MakeVultureSpiderMines_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2865, "MakeVultureSpiderMines", 13, "", "MakeVultureSpiderMines_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2866, "MakeVultureSpiderMines", 14, "", "MakeVultureSpiderMines_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2867, "MakeVultureSpiderMines", 15, "", "MakeVultureSpiderMines_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2868, "MakeVultureSpiderMines", 16, "", "MakeVultureSpiderMines_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2869, "MakeVultureSpiderMines", 17, "", "MakeVultureSpiderMines_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2870, "MakeVultureSpiderMines", 18, "", "MakeVultureSpiderMines_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2871, "MakeVultureSpiderMines", 19, "", "MakeVultureSpiderMines_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2872, "MedivacDoubleBeamHeal", 0, "Heal", "MedivacDoubleBeamHeal_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2873, "MedivacDoubleBeamHeal", 1, "", "MedivacDoubleBeamHeal_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2874, "MindControl", 0, "MindControl", "MindControl_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2875, "MindControl", 1, "", "MindControl_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2876, "Obliterate", 0, "Obliterate", "Obliterate_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2877, "Obliterate", 1, "", "Obliterate_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2878, "VoodooShield", 0, "VoodooShield", "VoodooShield_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2879, "VoodooShield", 1, "", "VoodooShield_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2880, "ReleaseMinion", 0, "ReleaseMinion", "ReleaseMinion_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2881, "ReleaseMinion", 1, "", "ReleaseMinion_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2882, "UltrasonicPulse", 0, "UltrasonicPulse", "UltrasonicPulse_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2883, "UltrasonicPulse", 1, "", "UltrasonicPulse_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2884, "ArchiveSeal", 0, "ArchiveSeal", "ArchiveSeal_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2885, "ArchiveSeal", 1, "", "ArchiveSeal_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2886, "ArtanisVortex", 0, "Vortex", "ArtanisVortex_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2887, "ArtanisVortex", 1, "", "ArtanisVortex_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2888, "ArtanisWormholeTransit", 0, "WormholeTransit", "ArtanisWormholeTransit_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2889, "ArtanisWormholeTransit", 1, "", "ArtanisWormholeTransit_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2890, "BunkerAttack", 0, "BunkerAttack", "BunkerAttack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2891, "BunkerAttack", 1, "AttackTowards", "BunkerAttack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2892, "BunkerAttack", 2, "AttackBarrage", "BunkerAttack_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2893, "BunkerStop", 0, "StopBunker", "BunkerStop_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2894, "BunkerStop", 1, "HoldFireSpecial", "BunkerStop_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2895, "BunkerStop", 2, "", "BunkerStop_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2896, "BunkerStop", 3, "", "BunkerStop_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2897, "BunkerStop", 4, "", "BunkerStop_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2898, "BunkerStop", 5, "", "BunkerStop_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2899, "CancelTerrazineHarvest", 0, "Cancel", "CancelTerrazineHarvest_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2900, "CancelTerrazineHarvest", 1, "", "CancelTerrazineHarvest_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2901, "LeviathanSpawnMutalisk", 0, "LeviathanSpawnMutalisk", "LeviathanSpawnMutalisk_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2902, "LeviathanSpawnMutalisk", 1, "", "LeviathanSpawnMutalisk_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2903, "ParkColonistVehicle", 0, "ParkColonistVehicle", "ParkColonistVehicle_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2904, "ParkColonistVehicle", 1, "", "ParkColonistVehicle_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2905, "StartColonistVehicle", 0, "StartColonistVehicle", "StartColonistVehicle_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2906, "StartColonistVehicle", 1, "", "StartColonistVehicle_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2907, "Consumption", 0, "Consumption", "Consumption_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2908, "Consumption", 1, "", "Consumption_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2909, "ConsumeDNA", 0, "ConsumeDNA", "ConsumeDNA_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2910, "ConsumeDNA", 1, "", "ConsumeDNA_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2911, "EggPop", 0, "EggPop", "EggPop_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2912, "EggPop", 1, "", "EggPop_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2913, "ExperimentalPlasmaGun", 0, "ExperimentalPlasmaGun", "ExperimentalPlasmaGun_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2914, "ExperimentalPlasmaGun", 1, "", "ExperimentalPlasmaGun_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2915, "GatherSpecialObject", 0, "GatherSpecialObject", "GatherSpecialObject_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2916, "GatherSpecialObject", 1, "", "GatherSpecialObject_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2917, "KerriganSearch", 0, "", "KerriganSearch_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2918, "KerriganSearch", 1, "", "KerriganSearch_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2919, "LokiUndock", 0, "Lift", "LokiUndock_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2920, "LokiUndock", 1, "", "LokiUndock_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2921, "MindBlast", 0, "MindBlast", "MindBlast_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2922, "MindBlast", 1, "", "MindBlast_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2923, "MorphToInfestedCivilian", 0, "MorphToInfestedCivilian", "MorphToInfestedCivilian_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2924, "MorphToInfestedCivilian", 1, "", "MorphToInfestedCivilian_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2925, "QueenShockwave", 0, "QueenShockwave", "QueenShockwave_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2926, "QueenShockwave", 1, "", "QueenShockwave_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2927, "TaurenOuthouseLiftoff", 0, "TaurenOuthouseFly", "TaurenOuthouseLiftoff_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2928, "TaurenOuthouseLiftoff", 1, "", "TaurenOuthouseLiftoff_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2929, "TaurenOuthouseTransport", 0, "LoadTaurenOuthouse", "TaurenOuthouseTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2930, "TaurenOuthouseTransport", 1, "UnloadTaurenOuthouse", "TaurenOuthouseTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2931, "TaurenOuthouseTransport", 2, "", "TaurenOuthouseTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2932, "TaurenOuthouseTransport", 3, "", "TaurenOuthouseTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2933, "TaurenOuthouseTransport", 4, "", "TaurenOuthouseTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2934, "Tychus03OmegaStorm", 0, "OmegaStorm", "Tychus03OmegaStorm_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2935, "Tychus03OmegaStorm", 1, "", "Tychus03OmegaStorm_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2936, "RaynorSnipe", 0, "RaynorSnipe", "RaynorSnipe_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2937, "RaynorSnipe", 1, "", "RaynorSnipe_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2938, "BonesHeal", 0, "BonesHeal", "BonesHeal_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2939, "BonesHeal", 1, "", "BonesHeal_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2940, "BonesTossGrenade", 0, "TossGrenadeTychus", "BonesTossGrenade_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2941, "BonesTossGrenade", 1, "", "BonesTossGrenade_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2942, "HerculesTransport", 0, "MedivacLoad", "HerculesTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2943, "HerculesTransport", 1, "", "HerculesTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2944, "HerculesTransport", 2, "MedivacUnloadAll", "HerculesTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2945, "HerculesTransport", 3, "", "HerculesTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2946, "HerculesTransport", 4, "", "HerculesTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2947, "SpecOpsDropshipTransport", 0, "MedivacLoad", "SpecOpsDropshipTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2948, "SpecOpsDropshipTransport", 1, "", "SpecOpsDropshipTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2949, "SpecOpsDropshipTransport", 2, "MedivacUnloadAll", "SpecOpsDropshipTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2950, "SpecOpsDropshipTransport", 3, "", "SpecOpsDropshipTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2951, "SpecOpsDropshipTransport", 4, "", "SpecOpsDropshipTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2952, "DuskWingBansheeCloakingField", 0, "CloakOnBanshee", "DuskWingBansheeCloakingField_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2953, "DuskWingBansheeCloakingField", 1, "CloakOff", "DuskWingBansheeCloakingField_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2954, "HyperionYamatoSpecial", 0, "HyperionYamatoGun", "HyperionYamatoSpecial_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2955, "HyperionYamatoSpecial", 1, "", "HyperionYamatoSpecial_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2956, "InfestableHutTransport", 0, "HutLoad", "InfestableHutTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2957, "InfestableHutTransport", 1, "HutUnloadAll", "InfestableHutTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2958, "InfestableHutTransport", 2, "", "InfestableHutTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2959, "InfestableHutTransport", 3, "", "InfestableHutTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2960, "InfestableHutTransport", 4, "", "InfestableHutTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2961, "DutchPlaceTurret", 0, "DutchPlaceTurret", "DutchPlaceTurret_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2962, "DutchPlaceTurret", 1, "", "DutchPlaceTurret_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2963, "BurrowInfestedCivilianDown", 0, "BurrowDown", "BurrowInfestedCivilianDown_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2964, "BurrowInfestedCivilianDown", 1, "", "BurrowInfestedCivilianDown_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2965, "BurrowInfestedCivilianUp", 0, "BurrowUp", "BurrowInfestedCivilianUp_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2966, "BurrowInfestedCivilianUp", 1, "", "BurrowInfestedCivilianUp_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2967, "SelendisHangar", 0, "Interceptor", "SelendisHangar_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2968, "SelendisHangar", 1, "", "SelendisHangar_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2969, "SelendisHangar", 2, "", "SelendisHangar_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2970, "SelendisHangar", 3, "", "SelendisHangar_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2971, "SelendisHangar", 4, "", "SelendisHangar_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2972, "SelendisHangar", 5, "", "SelendisHangar_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2973, "SelendisHangar", 6, "", "SelendisHangar_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2974, "SelendisHangar", 7, "", "SelendisHangar_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2975, "SelendisHangar", 8, "", "SelendisHangar_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2976, "SelendisHangar", 9, "", "SelendisHangar_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2977, "SelendisHangar", 10, "", "SelendisHangar_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2978, "SelendisHangar", 11, "", "SelendisHangar_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2979, "SelendisHangar", 12, "", "SelendisHangar_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2980, "SelendisHangar", 13, "", "SelendisHangar_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2981, "SelendisHangar", 14, "", "SelendisHangar_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2982, "SelendisHangar", 15, "", "SelendisHangar_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2983, "SelendisHangar", 16, "", "SelendisHangar_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2984, "SelendisHangar", 17, "", "SelendisHangar_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2985, "SelendisHangar", 18, "", "SelendisHangar_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2986, "SelendisHangar", 19, "", "SelendisHangar_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2987, "ForceFieldBeam", 0, "", "ForceFieldBeam_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2988, "ForceFieldBeam", 1, "", "ForceFieldBeam_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2989, "SiegeBreakerSiege", 0, "SiegeMode", "SiegeBreakerSiege_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2990, "SiegeBreakerSiege", 1, "", "SiegeBreakerSiege_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2991, "SiegeBreakerUnsiege", 0, "Unsiege", "SiegeBreakerUnsiege_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2992, "SiegeBreakerUnsiege", 1, "", "SiegeBreakerUnsiege_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2993, "SoulChannel", 0, "", "SoulChannel_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2994, "SoulChannel", 1, "Cancel", "SoulChannel_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2995, "PerditionTurretBurrow", 0, "", "PerditionTurretBurrow_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2996, "PerditionTurretBurrow", 1, "", "PerditionTurretBurrow_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2997, "PerditionTurretUnburrow", 0, "", "PerditionTurretUnburrow_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2998, "PerditionTurretUnburrow", 1, "", "PerditionTurretUnburrow_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 2999, "SentryGunBurrow", 0, "BurrowTurret", "SentryGunBurrow_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3000, "SentryGunBurrow", 1, "", "SentryGunBurrow_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3001, "SentryGunUnburrow", 0, "UnburrowTurret", "SentryGunUnburrow_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3002, "SentryGunUnburrow", 1, "", "SentryGunUnburrow_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3003, "SpiderMineUnburrowRangeDummy", 0, "", "SpiderMineUnburrowRangeDummy_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3004, "SpiderMineUnburrowRangeDummy", 1, "", "SpiderMineUnburrowRangeDummy_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3005, "GravitonPrison", 0, "GravitonPrison", "GravitonPrison_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3006, "GravitonPrison", 1, "", "GravitonPrison_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3007, "Implosion", 0, "Implosion", "Implosion_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3008, "Implosion", 1, "", "Implosion_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3009, "OmegaStorm", 0, "OmegaStorm", "OmegaStorm_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3010, "OmegaStorm", 1, "", "OmegaStorm_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3011, "PsionicShockwave", 0, "PsionicShockwave", "PsionicShockwave_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3012, "PsionicShockwave", 1, "", "PsionicShockwave_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3013, "HybridFAoEStun", 0, "HybridFAoEStun", "HybridFAoEStun_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3014, "HybridFAoEStun", 1, "", "HybridFAoEStun_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3015, "SummonMercenaries", 0, "HireKelmorianMiners", "SummonMercenaries_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3016, "SummonMercenaries", 1, "HireDevilDogs", "SummonMercenaries_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3017, "SummonMercenaries", 2, "HireSpartanCompany", "SummonMercenaries_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3018, "SummonMercenaries", 3, "HireHammerSecurities", "SummonMercenaries_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3019, "SummonMercenaries", 4, "HireSiegeBreakers", "SummonMercenaries_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3020, "SummonMercenaries", 5, "HireHelsAngels", "SummonMercenaries_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3021, "SummonMercenaries", 6, "HireDuskWing", "SummonMercenaries_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3022, "SummonMercenaries", 7, "HireDukesRevenge", "SummonMercenaries_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3023, "SummonMercenaries", 8, "", "SummonMercenaries_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3024, "SummonMercenaries", 9, "", "SummonMercenaries_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3025, "SummonMercenaries", 10, "", "SummonMercenaries_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3026, "SummonMercenaries", 11, "", "SummonMercenaries_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3027, "SummonMercenaries", 12, "", "SummonMercenaries_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3028, "SummonMercenaries", 13, "", "SummonMercenaries_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3029, "SummonMercenaries", 14, "", "SummonMercenaries_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3030, "SummonMercenaries", 15, "", "SummonMercenaries_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3031, "SummonMercenaries", 16, "", "SummonMercenaries_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3032, "SummonMercenaries", 17, "", "SummonMercenaries_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3033, "SummonMercenaries", 18, "", "SummonMercenaries_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3034, "SummonMercenaries", 19, "", "SummonMercenaries_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3035, "SummonMercenaries", 20, "", "SummonMercenaries_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3036, "SummonMercenaries", 21, "", "SummonMercenaries_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3037, "SummonMercenaries", 22, "", "SummonMercenaries_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3038, "SummonMercenaries", 23, "", "SummonMercenaries_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3039, "SummonMercenaries", 24, "", "SummonMercenaries_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3040, "SummonMercenaries", 25, "", "SummonMercenaries_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3041, "SummonMercenaries", 26, "", "SummonMercenaries_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3042, "SummonMercenaries", 27, "", "SummonMercenaries_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3043, "SummonMercenaries", 28, "", "SummonMercenaries_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3044, "SummonMercenaries", 29, "", "SummonMercenaries_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3045, "SummonMercenariesPH", 0, "HireKelmorianMinersPH", "SummonMercenariesPH_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3046, "SummonMercenariesPH", 1, "", "SummonMercenariesPH_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3047, "SummonMercenariesPH", 2, "", "SummonMercenariesPH_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3048, "SummonMercenariesPH", 3, "", "SummonMercenariesPH_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3049, "SummonMercenariesPH", 4, "", "SummonMercenariesPH_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3050, "SummonMercenariesPH", 5, "", "SummonMercenariesPH_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3051, "SummonMercenariesPH", 6, "", "SummonMercenariesPH_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3052, "SummonMercenariesPH", 7, "", "SummonMercenariesPH_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3053, "SummonMercenariesPH", 8, "", "SummonMercenariesPH_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3054, "SummonMercenariesPH", 9, "", "SummonMercenariesPH_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3055, "SummonMercenariesPH", 10, "", "SummonMercenariesPH_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3056, "SummonMercenariesPH", 11, "", "SummonMercenariesPH_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3057, "SummonMercenariesPH", 12, "", "SummonMercenariesPH_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3058, "SummonMercenariesPH", 13, "", "SummonMercenariesPH_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3059, "SummonMercenariesPH", 14, "", "SummonMercenariesPH_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3060, "SummonMercenariesPH", 15, "", "SummonMercenariesPH_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3061, "SummonMercenariesPH", 16, "", "SummonMercenariesPH_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3062, "SummonMercenariesPH", 17, "", "SummonMercenariesPH_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3063, "SummonMercenariesPH", 18, "", "SummonMercenariesPH_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3064, "SummonMercenariesPH", 19, "", "SummonMercenariesPH_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3065, "SummonMercenariesPH", 20, "", "SummonMercenariesPH_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3066, "SummonMercenariesPH", 21, "", "SummonMercenariesPH_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3067, "SummonMercenariesPH", 22, "", "SummonMercenariesPH_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3068, "SummonMercenariesPH", 23, "", "SummonMercenariesPH_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3069, "SummonMercenariesPH", 24, "", "SummonMercenariesPH_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3070, "SummonMercenariesPH", 25, "", "SummonMercenariesPH_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3071, "SummonMercenariesPH", 26, "", "SummonMercenariesPH_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3072, "SummonMercenariesPH", 27, "", "SummonMercenariesPH_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3073, "SummonMercenariesPH", 28, "", "SummonMercenariesPH_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3074, "SummonMercenariesPH", 29, "", "SummonMercenariesPH_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3075, "EnergyNova", 0, "EnergyNova", "EnergyNova_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3076, "EnergyNova", 1, "", "EnergyNova_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3077, "TheMorosDevice", 0, "TheMorosDevice", "TheMorosDevice_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3078, "TheMorosDevice", 1, "", "TheMorosDevice_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3079, "TossGrenade", 0, "TossGrenade", "TossGrenade_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3080, "TossGrenade", 1, "", "TossGrenade_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3081, "VoidSeekerTransport", 0, "MedivacLoad", "VoidSeekerTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3082, "VoidSeekerTransport", 1, "", "VoidSeekerTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3083, "VoidSeekerTransport", 2, "MedivacUnloadAll", "VoidSeekerTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3084, "VoidSeekerTransport", 3, "", "VoidSeekerTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3085, "VoidSeekerTransport", 4, "", "VoidSeekerTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3086, "TerranBuildDrop", 0, "SupplyDepotDrop", "TerranBuildDrop_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3087, "TerranBuildDrop", 1, "", "TerranBuildDrop_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3088, "TerranBuildDrop", 2, "", "TerranBuildDrop_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3089, "TerranBuildDrop", 3, "", "TerranBuildDrop_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3090, "TerranBuildDrop", 4, "", "TerranBuildDrop_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3091, "TerranBuildDrop", 5, "", "TerranBuildDrop_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3092, "TerranBuildDrop", 6, "", "TerranBuildDrop_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3093, "TerranBuildDrop", 7, "", "TerranBuildDrop_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3094, "TerranBuildDrop", 8, "", "TerranBuildDrop_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3095, "TerranBuildDrop", 9, "", "TerranBuildDrop_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3096, "TerranBuildDrop", 10, "", "TerranBuildDrop_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3097, "TerranBuildDrop", 11, "", "TerranBuildDrop_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3098, "TerranBuildDrop", 12, "", "TerranBuildDrop_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3099, "TerranBuildDrop", 13, "", "TerranBuildDrop_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3100, "TerranBuildDrop", 14, "", "TerranBuildDrop_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3101, "TerranBuildDrop", 15, "", "TerranBuildDrop_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3102, "TerranBuildDrop", 16, "", "TerranBuildDrop_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3103, "TerranBuildDrop", 17, "", "TerranBuildDrop_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3104, "TerranBuildDrop", 18, "", "TerranBuildDrop_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3105, "TerranBuildDrop", 19, "", "TerranBuildDrop_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3106, "TerranBuildDrop", 20, "", "TerranBuildDrop_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3107, "TerranBuildDrop", 21, "", "TerranBuildDrop_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3108, "TerranBuildDrop", 22, "", "TerranBuildDrop_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3109, "TerranBuildDrop", 23, "", "TerranBuildDrop_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3110, "TerranBuildDrop", 24, "", "TerranBuildDrop_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3111, "TerranBuildDrop", 25, "", "TerranBuildDrop_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3112, "TerranBuildDrop", 26, "", "TerranBuildDrop_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3113, "TerranBuildDrop", 27, "", "TerranBuildDrop_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3114, "TerranBuildDrop", 28, "", "TerranBuildDrop_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3115, "TerranBuildDrop", 29, "", "TerranBuildDrop_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3116, "TerranBuildDrop", 30, "Cancel", "TerranBuildDrop_30", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3117, "OdinNuclearStrike", 0, "OdinNukeCalldown", "OdinNuclearStrike_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3118, "OdinNuclearStrike", 1, "Cancel", "OdinNuclearStrike_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3119, "OdinWreckage", 0, "Odin", "OdinWreckage_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3120, "OdinWreckage", 1, "", "OdinWreckage_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3121, "ResearchLabTransport", 0, "HutLoad", "ResearchLabTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3122, "ResearchLabTransport", 1, "HutUnloadAll", "ResearchLabTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3123, "ResearchLabTransport", 2, "", "ResearchLabTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3124, "ResearchLabTransport", 3, "", "ResearchLabTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3125, "ResearchLabTransport", 4, "", "ResearchLabTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3126, "ColonyShipTransport", 0, "MedivacLoad", "ColonyShipTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3127, "ColonyShipTransport", 1, "", "ColonyShipTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3128, "ColonyShipTransport", 2, "MedivacUnloadAll", "ColonyShipTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3129, "ColonyShipTransport", 3, "", "ColonyShipTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3130, "ColonyShipTransport", 4, "", "ColonyShipTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3131, "ColonyInfestation", 0, "ColonyInfestation", "ColonyInfestation_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3132, "ColonyInfestation", 1, "", "ColonyInfestation_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3133, "Domination", 0, "Domination", "Domination_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3134, "Domination", 1, "Cancel", "Domination_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3135, "KarassPlasmaSurge", 0, "KarassPlasmaSurge", "KarassPlasmaSurge_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3136, "KarassPlasmaSurge", 1, "", "KarassPlasmaSurge_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3137, "KarassPsiStorm", 0, "PsiStorm", "KarassPsiStorm_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3138, "KarassPsiStorm", 1, "", "KarassPsiStorm_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3139, "HybridBlink", 0, "ZeratulBlink", "HybridBlink_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3140, "HybridBlink", 1, "", "HybridBlink_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3141, "HybridCPlasmaBlast", 0, "HybridCPlasmaBlast", "HybridCPlasmaBlast_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3142, "HybridCPlasmaBlast", 1, "", "HybridCPlasmaBlast_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3143, "HeroArmNuke", 0, "NukeArm", "HeroArmNuke_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3144, "HeroArmNuke", 1, "", "HeroArmNuke_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3145, "HeroArmNuke", 2, "", "HeroArmNuke_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3146, "HeroArmNuke", 3, "", "HeroArmNuke_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3147, "HeroArmNuke", 4, "", "HeroArmNuke_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3148, "HeroArmNuke", 5, "", "HeroArmNuke_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3149, "HeroArmNuke", 6, "", "HeroArmNuke_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3150, "HeroArmNuke", 7, "", "HeroArmNuke_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3151, "HeroArmNuke", 8, "", "HeroArmNuke_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3152, "HeroArmNuke", 9, "", "HeroArmNuke_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3153, "HeroArmNuke", 10, "", "HeroArmNuke_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3154, "HeroArmNuke", 11, "", "HeroArmNuke_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3155, "HeroArmNuke", 12, "", "HeroArmNuke_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3156, "HeroArmNuke", 13, "", "HeroArmNuke_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3157, "HeroArmNuke", 14, "", "HeroArmNuke_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3158, "HeroArmNuke", 15, "", "HeroArmNuke_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3159, "HeroArmNuke", 16, "", "HeroArmNuke_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3160, "HeroArmNuke", 17, "", "HeroArmNuke_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3161, "HeroArmNuke", 18, "", "HeroArmNuke_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3162, "HeroArmNuke", 19, "", "HeroArmNuke_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3163, "HeroNuclearStrike", 0, "NukeCalldown", "HeroNuclearStrike_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3164, "HeroNuclearStrike", 1, "Cancel", "HeroNuclearStrike_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3165, "OdinBarrage", 0, "OdinBarrage", "OdinBarrage_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3166, "OdinBarrage", 1, "Cancel", "OdinBarrage_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3167, "PurifierTogglePower", 0, "PurifierPowerDown", "PurifierTogglePower_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3168, "PurifierTogglePower", 1, "PurifierPowerUp", "PurifierTogglePower_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3169, "PhaseMineBlast", 0, "PhaseMineBlast", "PhaseMineBlast_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3170, "PhaseMineBlast", 1, "", "PhaseMineBlast_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3171, "VoidSeekerPhaseMineBlast", 0, "PhaseMineBlast", "VoidSeekerPhaseMineBlast_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3172, "VoidSeekerPhaseMineBlast", 1, "", "VoidSeekerPhaseMineBlast_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3173, "TransportTruckTransport", 0, "TransportTruckLoad", "TransportTruckTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3174, "TransportTruckTransport", 1, "TransportTruckUnloadAll", "TransportTruckTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3175, "TransportTruckTransport", 2, "", "TransportTruckTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3176, "TransportTruckTransport", 3, "", "TransportTruckTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3177, "TransportTruckTransport", 4, "", "TransportTruckTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3178, "Val03QueenOfBladesBurrow", 0, "BurrowDown", "Val03QueenOfBladesBurrow_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3179, "Val03QueenOfBladesBurrow", 1, "", "Val03QueenOfBladesBurrow_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3180, "Val03QueenOfBladesDeepTunnel", 0, "DeepTunnel", "Val03QueenOfBladesDeepTunnel_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3181, "Val03QueenOfBladesDeepTunnel", 1, "", "Val03QueenOfBladesDeepTunnel_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3182, "Val03QueenOfBladesUnburrow", 0, "BurrowUp", "Val03QueenOfBladesUnburrow_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3183, "Val03QueenOfBladesUnburrow", 1, "", "Val03QueenOfBladesUnburrow_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3184, "VultureSpiderMineBurrow", 0, "", "VultureSpiderMineBurrow_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3185, "VultureSpiderMineBurrow", 1, "", "VultureSpiderMineBurrow_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3186, "VultureSpiderMineUnburrow", 0, "", "VultureSpiderMineUnburrow_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3187, "VultureSpiderMineUnburrow", 1, "", "VultureSpiderMineUnburrow_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3188, "LokiYamato", 0, "LokiYamatoGun", "LokiYamato_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3189, "LokiYamato", 1, "", "LokiYamato_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3190, "DukesRevengeYamato", 0, "YamatoGun", "DukesRevengeYamato_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3191, "DukesRevengeYamato", 1, "", "DukesRevengeYamato_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3192, "ZeratulBlink", 0, "ZeratulBlink", "ZeratulBlink_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3193, "ZeratulBlink", 1, "", "ZeratulBlink_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3194, "RogueGhostCloak", 0, "CloakOnSpectre", "RogueGhostCloak_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3195, "RogueGhostCloak", 1, "CloakOff", "RogueGhostCloak_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3196, "VultureSpiderMines", 0, "SpiderMine", "VultureSpiderMines_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3197, "VultureSpiderMines", 1, "", "VultureSpiderMines_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3198, "VultureQueue3", 0, "Cancel", "VultureQueue3_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3199, "VultureQueue3", 1, "CancelSlot", "VultureQueue3_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3200, "SuperWarpGateTrain", 0, "Zealot", "SuperWarpGateTrain_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3201, "SuperWarpGateTrain", 1, "Stalker", "SuperWarpGateTrain_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3202, "SuperWarpGateTrain", 2, "Immortal", "SuperWarpGateTrain_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3203, "SuperWarpGateTrain", 3, "HighTemplar", "SuperWarpGateTrain_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3204, "SuperWarpGateTrain", 4, "DarkTemplar", "SuperWarpGateTrain_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3205, "SuperWarpGateTrain", 5, "Sentry", "SuperWarpGateTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3206, "SuperWarpGateTrain", 6, "Carrier", "SuperWarpGateTrain_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3207, "SuperWarpGateTrain", 7, "Phoenix", "SuperWarpGateTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3208, "SuperWarpGateTrain", 8, "VoidRay", "SuperWarpGateTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3209, "SuperWarpGateTrain", 9, "Archon", "SuperWarpGateTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3210, "SuperWarpGateTrain", 10, "WarpInZeratul", "SuperWarpGateTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3211, "SuperWarpGateTrain", 11, "WarpInUrun", "SuperWarpGateTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3212, "SuperWarpGateTrain", 12, "WarpInMohandar", "SuperWarpGateTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3213, "SuperWarpGateTrain", 13, "WarpInSelendis", "SuperWarpGateTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3214, "SuperWarpGateTrain", 14, "WarpInScout", "SuperWarpGateTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3215, "SuperWarpGateTrain", 15, "Colossus", "SuperWarpGateTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3216, "SuperWarpGateTrain", 16, "WarpPrism", "SuperWarpGateTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3217, "SuperWarpGateTrain", 17, "", "SuperWarpGateTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3218, "SuperWarpGateTrain", 18, "", "SuperWarpGateTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3219, "SuperWarpGateTrain", 19, "", "SuperWarpGateTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3220, "BurrowOmegaliskDown", 0, "BurrowDown", "BurrowOmegaliskDown_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3221, "BurrowOmegaliskDown", 1, "", "BurrowOmegaliskDown_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3222, "BurrowOmegaliskUp", 0, "BurrowUp", "BurrowOmegaliskUp_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3223, "BurrowOmegaliskUp", 1, "", "BurrowOmegaliskUp_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3224, "BurrowInfestedAbominationDown", 0, "BurrowDown", "BurrowInfestedAbominationDown_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3225, "BurrowInfestedAbominationDown", 1, "", "BurrowInfestedAbominationDown_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3226, "BurrowInfestedAbominationUp", 0, "BurrowUp", "BurrowInfestedAbominationUp_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3227, "BurrowInfestedAbominationUp", 1, "", "BurrowInfestedAbominationUp_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3228, "BurrowHunterKillerDown", 0, "BurrowDown", "BurrowHunterKillerDown_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3229, "BurrowHunterKillerDown", 1, "Cancel", "BurrowHunterKillerDown_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3230, "BurrowHunterKillerUp", 0, "BurrowUp", "BurrowHunterKillerUp_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3231, "BurrowHunterKillerUp", 1, "", "BurrowHunterKillerUp_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3232, "NovaSnipe", 0, "NovaSnipe", "NovaSnipe_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3233, "NovaSnipe", 1, "", "NovaSnipe_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3234, "VortexPurifier", 0, "Vortex", "VortexPurifier_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3235, "VortexPurifier", 1, "", "VortexPurifier_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3236, "TalDarimVortex", 0, "Vortex", "TalDarimVortex_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3237, "TalDarimVortex", 1, "", "TalDarimVortex_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3238, "PurifierPlanetCracker", 0, "PlanetCracker", "PurifierPlanetCracker_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3239, "PurifierPlanetCracker", 1, "", "PurifierPlanetCracker_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3240, "BurrowInfestedTerranCampaignDown", 0, "BurrowDown", "BurrowInfestedTerranCampaignDown_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3241, "BurrowInfestedTerranCampaignDown", 1, "", "BurrowInfestedTerranCampaignDown_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3242, "BurrowInfestedTerranCampaignUp", 0, "BurrowUp", "BurrowInfestedTerranCampaignUp_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3243, "BurrowInfestedTerranCampaignUp", 1, "", "BurrowInfestedTerranCampaignUp_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3244, "InfestedMonsterTrain", 0, "InfestedCivilian", "InfestedMonsterTrain_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3245, "InfestedMonsterTrain", 1, "InfestedTerranCampaign", "InfestedMonsterTrain_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3246, "InfestedMonsterTrain", 2, "InfestedAbomination", "InfestedMonsterTrain_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3247, "InfestedMonsterTrain", 3, "", "InfestedMonsterTrain_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3248, "InfestedMonsterTrain", 4, "", "InfestedMonsterTrain_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3249, "InfestedMonsterTrain", 5, "", "InfestedMonsterTrain_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3250, "InfestedMonsterTrain", 6, "", "InfestedMonsterTrain_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3251, "InfestedMonsterTrain", 7, "", "InfestedMonsterTrain_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3252, "InfestedMonsterTrain", 8, "", "InfestedMonsterTrain_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3253, "InfestedMonsterTrain", 9, "", "InfestedMonsterTrain_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3254, "InfestedMonsterTrain", 10, "", "InfestedMonsterTrain_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3255, "InfestedMonsterTrain", 11, "", "InfestedMonsterTrain_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3256, "InfestedMonsterTrain", 12, "", "InfestedMonsterTrain_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3257, "InfestedMonsterTrain", 13, "", "InfestedMonsterTrain_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3258, "InfestedMonsterTrain", 14, "", "InfestedMonsterTrain_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3259, "InfestedMonsterTrain", 15, "", "InfestedMonsterTrain_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3260, "InfestedMonsterTrain", 16, "", "InfestedMonsterTrain_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3261, "InfestedMonsterTrain", 17, "", "InfestedMonsterTrain_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3262, "InfestedMonsterTrain", 18, "", "InfestedMonsterTrain_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3263, "InfestedMonsterTrain", 19, "", "InfestedMonsterTrain_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3264, "InfestedMonsterTrain", 20, "", "InfestedMonsterTrain_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3265, "InfestedMonsterTrain", 21, "", "InfestedMonsterTrain_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3266, "InfestedMonsterTrain", 22, "", "InfestedMonsterTrain_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3267, "InfestedMonsterTrain", 23, "", "InfestedMonsterTrain_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3268, "InfestedMonsterTrain", 24, "", "InfestedMonsterTrain_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3269, "InfestedMonsterTrain", 25, "", "InfestedMonsterTrain_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3270, "InfestedMonsterTrain", 26, "", "InfestedMonsterTrain_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3271, "InfestedMonsterTrain", 27, "", "InfestedMonsterTrain_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3272, "InfestedMonsterTrain", 28, "", "InfestedMonsterTrain_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3273, "InfestedMonsterTrain", 29, "", "InfestedMonsterTrain_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3274, "BiodomeTransport", 0, "BiodomeLoad", "BiodomeTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3275, "BiodomeTransport", 1, "BiodomeUnloadAll", "BiodomeTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3276, "BiodomeTransport", 2, "", "BiodomeTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3277, "BiodomeTransport", 3, "", "BiodomeTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3278, "BiodomeTransport", 4, "", "BiodomeTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3279, "CheckStation", 0, "", "CheckStation_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3280, "CheckStation", 1, "", "CheckStation_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3281, "CheckStationDiagonalBLUR", 0, "", "CheckStationDiagonalBLUR_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3282, "CheckStationDiagonalBLUR", 1, "", "CheckStationDiagonalBLUR_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3283, "CheckStationDiagonalULBR", 0, "", "CheckStationDiagonalULBR_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3284, "CheckStationDiagonalULBR", 1, "", "CheckStationDiagonalULBR_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3285, "CheckStationVertical", 0, "", "CheckStationVertical_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3286, "CheckStationVertical", 1, "", "CheckStationVertical_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3287, "CheckStationOpened", 0, "", "CheckStationOpened_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3288, "CheckStationOpened", 1, "", "CheckStationOpened_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3289, "CheckStationDiagonalBLUROpened", 0, "", "CheckStationDiagonalBLUROpened_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3290, "CheckStationDiagonalBLUROpened", 1, "", "CheckStationDiagonalBLUROpened_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3291, "CheckStationDiagonalULBROpened", 0, "", "CheckStationDiagonalULBROpened_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3292, "CheckStationDiagonalULBROpened", 1, "", "CheckStationDiagonalULBROpened_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3293, "CheckStationVerticalOpened", 0, "", "CheckStationVerticalOpened_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3294, "CheckStationVerticalOpened", 1, "", "CheckStationVerticalOpened_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3295, "AttackAllowsInvulnerable", 0, "AttackAllowsInvulnerable", "AttackAllowsInvulnerable_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3296, "AttackAllowsInvulnerable", 1, "AttackTowards", "AttackAllowsInvulnerable_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3297, "AttackAllowsInvulnerable", 2, "AttackBarrage", "AttackAllowsInvulnerable_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3298, "ZeratulStun", 0, "ZeratulStun", "ZeratulStun_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3299, "ZeratulStun", 1, "", "ZeratulStun_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3300, "WraithCloak", 0, "", "WraithCloak_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3301, "WraithCloak", 1, "CloakOff", "WraithCloak_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3302, "TechReactorMorph", 0, "", "TechReactorMorph_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3303, "TechReactorMorph", 1, "", "TechReactorMorph_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3304, "BarracksTechReactorMorph", 0, "TechLabBarracks", "BarracksTechReactorMorph_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3305, "BarracksTechReactorMorph", 1, "", "BarracksTechReactorMorph_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3306, "FactoryTechReactorMorph", 0, "TechLabFactory", "FactoryTechReactorMorph_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3307, "FactoryTechReactorMorph", 1, "", "FactoryTechReactorMorph_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3308, "StarportTechReactorMorph", 0, "TechLabStarport", "StarportTechReactorMorph_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3309, "StarportTechReactorMorph", 1, "", "StarportTechReactorMorph_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3310, "SS_FighterShooting", 0, "SS_Shooting", "SS_FighterShooting_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3311, "SS_FighterShooting", 1, "", "SS_FighterShooting_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3312, "RaynorC4", 0, "PlantC4Charge", "RaynorC4_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3313, "RaynorC4", 1, "", "RaynorC4_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3314, "DukesRevengeDefensiveMatrix", 0, "DefensiveMatrix", "DukesRevengeDefensiveMatrix_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3315, "DukesRevengeDefensiveMatrix", 1, "", "DukesRevengeDefensiveMatrix_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3316, "DukesRevengeMissilePods", 0, "MissilePods", "DukesRevengeMissilePods_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3317, "DukesRevengeMissilePods", 1, "", "DukesRevengeMissilePods_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3318, "ThorWreckage", 0, "Thor", "ThorWreckage_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3319, "ThorWreckage", 1, "", "ThorWreckage_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3320, "330mmBarrageCannons", 0, "330mmBarrageCannons", "330mmBarrageCannons_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3321, "330mmBarrageCannons", 1, "Cancel", "330mmBarrageCannons_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3322, "ThorReborn", 0, "Thor", "ThorReborn_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3323, "ThorReborn", 1, "Cancel", "ThorReborn_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3324, "SpectreNuke", 0, "SpectreNukeCalldown", "SpectreNuke_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3325, "SpectreNuke", 1, "Cancel", "SpectreNuke_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3326, "SpectreNukeSiloArmMagazine", 0, "", "SpectreNukeSiloArmMagazine_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3327, "SpectreNukeSiloArmMagazine", 1, "SpectreNukeArm", "SpectreNukeSiloArmMagazine_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3328, "SpectreNukeSiloArmMagazine", 2, "", "SpectreNukeSiloArmMagazine_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3329, "SpectreNukeSiloArmMagazine", 3, "", "SpectreNukeSiloArmMagazine_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3330, "SpectreNukeSiloArmMagazine", 4, "", "SpectreNukeSiloArmMagazine_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3331, "SpectreNukeSiloArmMagazine", 5, "", "SpectreNukeSiloArmMagazine_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3332, "SpectreNukeSiloArmMagazine", 6, "", "SpectreNukeSiloArmMagazine_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3333, "SpectreNukeSiloArmMagazine", 7, "", "SpectreNukeSiloArmMagazine_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3334, "SpectreNukeSiloArmMagazine", 8, "", "SpectreNukeSiloArmMagazine_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3335, "SpectreNukeSiloArmMagazine", 9, "", "SpectreNukeSiloArmMagazine_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3336, "SpectreNukeSiloArmMagazine", 10, "", "SpectreNukeSiloArmMagazine_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3337, "SpectreNukeSiloArmMagazine", 11, "", "SpectreNukeSiloArmMagazine_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3338, "SpectreNukeSiloArmMagazine", 12, "", "SpectreNukeSiloArmMagazine_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3339, "SpectreNukeSiloArmMagazine", 13, "", "SpectreNukeSiloArmMagazine_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3340, "SpectreNukeSiloArmMagazine", 14, "", "SpectreNukeSiloArmMagazine_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3341, "SpectreNukeSiloArmMagazine", 15, "", "SpectreNukeSiloArmMagazine_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3342, "SpectreNukeSiloArmMagazine", 16, "", "SpectreNukeSiloArmMagazine_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3343, "SpectreNukeSiloArmMagazine", 17, "", "SpectreNukeSiloArmMagazine_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3344, "SpectreNukeSiloArmMagazine", 18, "", "SpectreNukeSiloArmMagazine_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3345, "SpectreNukeSiloArmMagazine", 19, "", "SpectreNukeSiloArmMagazine_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3346, "ColonistShipLiftOff", 0, "Lift", "ColonistShipLiftOff_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3347, "ColonistShipLiftOff", 1, "", "ColonistShipLiftOff_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3348, "ColonistShipLand", 0, "Land", "ColonistShipLand_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3349, "ColonistShipLand", 1, "", "ColonistShipLand_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3350, "BioDomeCommandLiftOff", 0, "Lift", "BioDomeCommandLiftOff_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3351, "BioDomeCommandLiftOff", 1, "", "BioDomeCommandLiftOff_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3352, "BioDomeCommandLand", 0, "Land", "BioDomeCommandLand_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3353, "BioDomeCommandLand", 1, "", "BioDomeCommandLand_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3354, "HerculesLiftOff", 0, "Lift", "HerculesLiftOff_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3355, "HerculesLiftOff", 1, "", "HerculesLiftOff_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3356, "HerculesLand", 0, "HerculesLand", "HerculesLand_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3357, "HerculesLand", 1, "", "HerculesLand_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3358, "LightBridgeOff", 0, "LightBridgeOff", "LightBridgeOff_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3359, "LightBridgeOff", 1, "", "LightBridgeOff_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3360, "LightBridgeOn", 0, "LightBridgeOn", "LightBridgeOn_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3361, "LightBridgeOn", 1, "", "LightBridgeOn_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3362, "LibraryDown", 0, "LibraryDown", "LibraryDown_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3363, "LibraryDown", 1, "", "LibraryDown_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3364, "LibraryUp", 0, "LibraryUp", "LibraryUp_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3365, "LibraryUp", 1, "", "LibraryUp_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3366, "TempleDoorDown", 0, "TempleDoorDown", "TempleDoorDown_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3367, "TempleDoorDown", 1, "", "TempleDoorDown_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3368, "TempleDoorUp", 0, "TempleDoorUp", "TempleDoorUp_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3369, "TempleDoorUp", 1, "", "TempleDoorUp_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3370, "TempleDoorDownURDL", 0, "TempleDoorDownURDL", "TempleDoorDownURDL_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3371, "TempleDoorDownURDL", 1, "", "TempleDoorDownURDL_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3372, "TempleDoorUpURDL", 0, "TempleDoorUpURDL", "TempleDoorUpURDL_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3373, "TempleDoorUpURDL", 1, "", "TempleDoorUpURDL_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3374, "PsytrousOxide", 0, "PsytrousOxideOn", "PsytrousOxide_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3375, "PsytrousOxide", 1, "PsytrousOxideOff", "PsytrousOxide_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3376, "VoidSeekerDock", 0, "", "VoidSeekerDock_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3377, "VoidSeekerDock", 1, "", "VoidSeekerDock_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3378, "BioPlasmidDischarge", 0, "BioPlasmidDischarge", "BioPlasmidDischarge_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3379, "BioPlasmidDischarge", 1, "", "BioPlasmidDischarge_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3380, "WreckingCrewAssaultMode", 0, "AssaultMode", "WreckingCrewAssaultMode_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3381, "WreckingCrewAssaultMode", 1, "", "WreckingCrewAssaultMode_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3382, "WreckingCrewFighterMode", 0, "FighterMode", "WreckingCrewFighterMode_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3383, "WreckingCrewFighterMode", 1, "", "WreckingCrewFighterMode_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3384, "BioStasis", 0, "BioStasis", "BioStasis_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3385, "BioStasis", 1, "", "BioStasis_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3386, "ColonistTransportTransport", 0, "ColonistTransportLoad", "ColonistTransportTransport_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3387, "ColonistTransportTransport", 1, "ColonistTransportUnloadAll", "ColonistTransportTransport_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3388, "ColonistTransportTransport", 2, "", "ColonistTransportTransport_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3389, "ColonistTransportTransport", 3, "", "ColonistTransportTransport_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3390, "ColonistTransportTransport", 4, "", "ColonistTransportTransport_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3391, "DropToSupplyDepot", 0, "Raise", "DropToSupplyDepot_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3392, "DropToSupplyDepot", 1, "", "DropToSupplyDepot_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3393, "RefineryToAutomatedRefinery", 0, "Raise", "RefineryToAutomatedRefinery_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3394, "RefineryToAutomatedRefinery", 1, "", "RefineryToAutomatedRefinery_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3395, "HeliosCrashMorph", 0, "CrashMorph", "HeliosCrashMorph_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3396, "HeliosCrashMorph", 1, "", "HeliosCrashMorph_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3397, "NanoRepair", 0, "Heal", "NanoRepair_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3398, "NanoRepair", 1, "", "NanoRepair_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3399, "Pickup", 0, "Pickup", "Pickup_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3400, "Pickup", 1, "", "Pickup_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3401, "PickupArcade", 0, "Pickup", "PickupArcade_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3402, "PickupArcade", 1, "", "PickupArcade_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3403, "PickupGas100", 0, "PickupGas100", "PickupGas100_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3404, "PickupGas100", 1, "", "PickupGas100_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3405, "PickupMinerals100", 0, "PickupMinerals100", "PickupMinerals100_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3406, "PickupMinerals100", 1, "", "PickupMinerals100_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3407, "PickupHealth25", 0, "", "PickupHealth25_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3408, "PickupHealth25", 1, "", "PickupHealth25_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3409, "PickupHealth50", 0, "", "PickupHealth50_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3410, "PickupHealth50", 1, "", "PickupHealth50_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3411, "PickupHealth100", 0, "", "PickupHealth100_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3412, "PickupHealth100", 1, "", "PickupHealth100_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3413, "PickupHealthFull", 0, "", "PickupHealthFull_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3414, "PickupHealthFull", 1, "", "PickupHealthFull_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3415, "PickupEnergy25", 0, "", "PickupEnergy25_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3416, "PickupEnergy25", 1, "", "PickupEnergy25_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3417, "PickupEnergy50", 0, "", "PickupEnergy50_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3418, "PickupEnergy50", 1, "", "PickupEnergy50_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3419, "PickupEnergy100", 0, "", "PickupEnergy100_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3420, "PickupEnergy100", 1, "", "PickupEnergy100_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3421, "PickupEnergyFull", 0, "", "PickupEnergyFull_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3422, "PickupEnergyFull", 1, "", "PickupEnergyFull_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3423, "TaurenStimpack", 0, "Stim", "TaurenStimpack_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3424, "TaurenStimpack", 1, "", "TaurenStimpack_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3425, "TestInventory", 0, "", "TestInventory_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3426, "TestInventory", 1, "", "TestInventory_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3427, "TestInventory", 2, "", "TestInventory_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3428, "TestInventory", 3, "", "TestInventory_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3429, "TestInventory", 4, "", "TestInventory_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3430, "TestInventory", 5, "", "TestInventory_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3431, "TestInventory", 6, "", "TestInventory_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3432, "TestInventory", 7, "", "TestInventory_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3433, "TestInventory", 8, "", "TestInventory_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3434, "TestPawn", 0, "", "TestPawn_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3435, "TestPawn", 1, "", "TestPawn_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3436, "TestPawn", 2, "", "TestPawn_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3437, "TestPawn", 3, "", "TestPawn_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3438, "TestPawn", 4, "", "TestPawn_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3439, "TestPawn", 5, "", "TestPawn_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3440, "TestPawn", 6, "", "TestPawn_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3441, "TestPawn", 7, "", "TestPawn_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3442, "TestPawn", 8, "", "TestPawn_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3443, "TestPawn", 9, "", "TestPawn_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3444, "TestPawn", 10, "", "TestPawn_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3445, "TestPawn", 11, "", "TestPawn_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3446, "TestPawn", 12, "", "TestPawn_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3447, "TestPawn", 13, "", "TestPawn_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3448, "TestPawn", 14, "", "TestPawn_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3449, "TestPawn", 15, "", "TestPawn_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3450, "TestPawn", 16, "", "TestPawn_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3451, "TestPawn", 17, "", "TestPawn_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3452, "TestPawn", 18, "", "TestPawn_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3453, "TestPawn", 19, "", "TestPawn_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3454, "TestRevive", 0, "SCV", "TestRevive_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3455, "TestRevive", 1, "", "TestRevive_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3456, "TestRevive", 2, "", "TestRevive_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3457, "TestRevive", 3, "", "TestRevive_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3458, "TestRevive", 4, "", "TestRevive_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3459, "TestRevive", 5, "", "TestRevive_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3460, "TestRevive", 6, "", "TestRevive_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3461, "TestRevive", 7, "", "TestRevive_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3462, "TestRevive", 8, "", "TestRevive_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3463, "TestRevive", 9, "", "TestRevive_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3464, "TestRevive", 10, "", "TestRevive_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3465, "TestRevive", 11, "", "TestRevive_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3466, "TestRevive", 12, "", "TestRevive_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3467, "TestRevive", 13, "", "TestRevive_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3468, "TestRevive", 14, "", "TestRevive_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3469, "TestRevive", 15, "", "TestRevive_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3470, "TestRevive", 16, "", "TestRevive_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3471, "TestRevive", 17, "", "TestRevive_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3472, "TestRevive", 18, "", "TestRevive_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3473, "TestRevive", 19, "", "TestRevive_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3474, "TestRevive", 20, "SCV", "TestRevive_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3475, "TestRevive", 21, "", "TestRevive_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3476, "TestRevive", 22, "", "TestRevive_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3477, "TestRevive", 23, "", "TestRevive_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3478, "TestRevive", 24, "", "TestRevive_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3479, "TestRevive", 25, "", "TestRevive_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3480, "TestRevive", 26, "", "TestRevive_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3481, "TestRevive", 27, "", "TestRevive_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3482, "TestRevive", 28, "", "TestRevive_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3483, "TestRevive", 29, "", "TestRevive_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3484, "TestSell", 0, "", "TestSell_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3485, "TestSell", 1, "", "TestSell_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3486, "TestSell", 2, "", "TestSell_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3487, "TestSell", 3, "", "TestSell_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3488, "TestSell", 4, "", "TestSell_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3489, "TestSell", 5, "", "TestSell_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3490, "TestSell", 6, "", "TestSell_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3491, "TestSell", 7, "", "TestSell_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3492, "TestSell", 8, "", "TestSell_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3493, "TestSell", 9, "", "TestSell_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3494, "TestSell", 10, "", "TestSell_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3495, "TestSell", 11, "", "TestSell_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3496, "TestSell", 12, "", "TestSell_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3497, "TestSell", 13, "", "TestSell_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3498, "TestSell", 14, "", "TestSell_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3499, "TestSell", 15, "", "TestSell_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3500, "TestSell", 16, "", "TestSell_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3501, "TestSell", 17, "", "TestSell_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3502, "TestSell", 18, "", "TestSell_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3503, "TestSell", 19, "", "TestSell_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3504, "TestSell", 20, "", "TestSell_20", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3505, "TestSell", 21, "", "TestSell_21", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3506, "TestSell", 22, "", "TestSell_22", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3507, "TestSell", 23, "", "TestSell_23", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3508, "TestSell", 24, "", "TestSell_24", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3509, "TestSell", 25, "", "TestSell_25", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3510, "TestSell", 26, "", "TestSell_26", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3511, "TestSell", 27, "", "TestSell_27", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3512, "TestSell", 28, "", "TestSell_28", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3513, "TestSell", 29, "", "TestSell_29", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3514, "TestInteract", 0, "Designate", "TestInteract_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3515, "CliffDoorOpen0", 0, "SpacePlatformDoorOpen", "CliffDoorOpen0_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3516, "CliffDoorOpen0", 1, "", "CliffDoorOpen0_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3517, "CliffDoorClose0", 0, "SpacePlatformDoorClose", "CliffDoorClose0_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3518, "CliffDoorClose0", 1, "", "CliffDoorClose0_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3519, "CliffDoorOpen1", 0, "SpacePlatformDoorOpen", "CliffDoorOpen1_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3520, "CliffDoorOpen1", 1, "", "CliffDoorOpen1_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3521, "CliffDoorClose1", 0, "SpacePlatformDoorClose", "CliffDoorClose1_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3522, "CliffDoorClose1", 1, "", "CliffDoorClose1_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3523, "DestructibleGateDiagonalBLURLowered", 0, "GateOpen", "DestructibleGateDiagonalBLURLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3524, "DestructibleGateDiagonalBLURLowered", 1, "", "DestructibleGateDiagonalBLURLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3525, "DestructibleGateDiagonalULBRLowered", 0, "GateOpen", "DestructibleGateDiagonalULBRLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3526, "DestructibleGateDiagonalULBRLowered", 1, "", "DestructibleGateDiagonalULBRLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3527, "DestructibleGateStraightHorizontalBFLowered", 0, "GateOpen", "DestructibleGateStraightHorizontalBFLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3528, "DestructibleGateStraightHorizontalBFLowered", 1, "", "DestructibleGateStraightHorizontalBFLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3529, "DestructibleGateStraightHorizontalLowered", 0, "GateOpen", "DestructibleGateStraightHorizontalLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3530, "DestructibleGateStraightHorizontalLowered", 1, "", "DestructibleGateStraightHorizontalLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3531, "DestructibleGateStraightVerticalLFLowered", 0, "GateOpen", "DestructibleGateStraightVerticalLFLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3532, "DestructibleGateStraightVerticalLFLowered", 1, "", "DestructibleGateStraightVerticalLFLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3533, "DestructibleGateStraightVerticalLowered", 0, "GateOpen", "DestructibleGateStraightVerticalLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3534, "DestructibleGateStraightVerticalLowered", 1, "", "DestructibleGateStraightVerticalLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3535, "DestructibleGateDiagonalBLUR", 0, "GateClose", "DestructibleGateDiagonalBLUR_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3536, "DestructibleGateDiagonalBLUR", 1, "", "DestructibleGateDiagonalBLUR_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3537, "DestructibleGateDiagonalULBR", 0, "GateClose", "DestructibleGateDiagonalULBR_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3538, "DestructibleGateDiagonalULBR", 1, "", "DestructibleGateDiagonalULBR_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3539, "DestructibleGateStraightHorizontalBF", 0, "GateClose", "DestructibleGateStraightHorizontalBF_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3540, "DestructibleGateStraightHorizontalBF", 1, "", "DestructibleGateStraightHorizontalBF_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3541, "DestructibleGateStraightHorizontal", 0, "GateClose", "DestructibleGateStraightHorizontal_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3542, "DestructibleGateStraightHorizontal", 1, "", "DestructibleGateStraightHorizontal_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3543, "DestructibleGateStraightVerticalLF", 0, "GateClose", "DestructibleGateStraightVerticalLF_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3544, "DestructibleGateStraightVerticalLF", 1, "", "DestructibleGateStraightVerticalLF_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3545, "DestructibleGateStraightVertical", 0, "GateClose", "DestructibleGateStraightVertical_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3546, "DestructibleGateStraightVertical", 1, "", "DestructibleGateStraightVertical_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3547, "TestLearn", 0, "TestLearn", "TestLearn_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3548, "TestLearn", 1, "", "TestLearn_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3549, "TestLearn", 2, "", "TestLearn_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3550, "TestLearn", 3, "", "TestLearn_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3551, "TestLearn", 4, "", "TestLearn_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3552, "TestLearn", 5, "", "TestLearn_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3553, "TestLearn", 6, "", "TestLearn_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3554, "TestLearn", 7, "", "TestLearn_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3555, "TestLearn", 8, "", "TestLearn_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3556, "TestLearn", 9, "", "TestLearn_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3557, "TestLearn", 10, "", "TestLearn_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3558, "TestLearn", 11, "", "TestLearn_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3559, "TestLearn", 12, "", "TestLearn_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3560, "TestLearn", 13, "", "TestLearn_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3561, "TestLearn", 14, "", "TestLearn_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3562, "TestLearn", 15, "", "TestLearn_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3563, "TestLearn", 16, "", "TestLearn_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3564, "TestLearn", 17, "", "TestLearn_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3565, "TestLearn", 18, "", "TestLearn_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3566, "TestLearn", 19, "", "TestLearn_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3567, "TestLeveledSpell", 0, "YamatoGun", "TestLeveledSpell_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3568, "TestLeveledSpell", 1, "", "TestLeveledSpell_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3569, "MetalGateDiagonalBLURLowered", 0, "GateOpen", "MetalGateDiagonalBLURLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3570, "MetalGateDiagonalBLURLowered", 1, "", "MetalGateDiagonalBLURLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3571, "MetalGateDiagonalULBRLowered", 0, "GateOpen", "MetalGateDiagonalULBRLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3572, "MetalGateDiagonalULBRLowered", 1, "", "MetalGateDiagonalULBRLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3573, "MetalGateStraightHorizontalBFLowered", 0, "GateOpen", "MetalGateStraightHorizontalBFLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3574, "MetalGateStraightHorizontalBFLowered", 1, "", "MetalGateStraightHorizontalBFLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3575, "MetalGateStraightHorizontalLowered", 0, "GateOpen", "MetalGateStraightHorizontalLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3576, "MetalGateStraightHorizontalLowered", 1, "", "MetalGateStraightHorizontalLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3577, "MetalGateStraightVerticalLFLowered", 0, "GateOpen", "MetalGateStraightVerticalLFLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3578, "MetalGateStraightVerticalLFLowered", 1, "", "MetalGateStraightVerticalLFLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3579, "MetalGateStraightVerticalLowered", 0, "GateOpen", "MetalGateStraightVerticalLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3580, "MetalGateStraightVerticalLowered", 1, "", "MetalGateStraightVerticalLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3581, "MetalGateDiagonalBLUR", 0, "GateClose", "MetalGateDiagonalBLUR_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3582, "MetalGateDiagonalBLUR", 1, "", "MetalGateDiagonalBLUR_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3583, "MetalGateDiagonalULBR", 0, "GateClose", "MetalGateDiagonalULBR_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3584, "MetalGateDiagonalULBR", 1, "", "MetalGateDiagonalULBR_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3585, "MetalGateStraightHorizontalBF", 0, "GateClose", "MetalGateStraightHorizontalBF_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3586, "MetalGateStraightHorizontalBF", 1, "", "MetalGateStraightHorizontalBF_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3587, "MetalGateStraightHorizontal", 0, "GateClose", "MetalGateStraightHorizontal_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3588, "MetalGateStraightHorizontal", 1, "", "MetalGateStraightHorizontal_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3589, "MetalGateStraightVerticalLF", 0, "GateClose", "MetalGateStraightVerticalLF_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3590, "MetalGateStraightVerticalLF", 1, "", "MetalGateStraightVerticalLF_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3591, "MetalGateStraightVertical", 0, "GateClose", "MetalGateStraightVertical_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3592, "MetalGateStraightVertical", 1, "", "MetalGateStraightVertical_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3593, "SecurityGateDiagonalBLURLowered", 0, "GateOpen", "SecurityGateDiagonalBLURLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3594, "SecurityGateDiagonalBLURLowered", 1, "", "SecurityGateDiagonalBLURLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3595, "SecurityGateDiagonalULBRLowered", 0, "GateOpen", "SecurityGateDiagonalULBRLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3596, "SecurityGateDiagonalULBRLowered", 1, "", "SecurityGateDiagonalULBRLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3597, "SecurityGateStraightHorizontalBFLowered", 0, "GateOpen", "SecurityGateStraightHorizontalBFLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3598, "SecurityGateStraightHorizontalBFLowered", 1, "", "SecurityGateStraightHorizontalBFLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3599, "SecurityGateStraightHorizontalLowered", 0, "GateOpen", "SecurityGateStraightHorizontalLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3600, "SecurityGateStraightHorizontalLowered", 1, "", "SecurityGateStraightHorizontalLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3601, "SecurityGateStraightVerticalLFLowered", 0, "GateOpen", "SecurityGateStraightVerticalLFLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3602, "SecurityGateStraightVerticalLFLowered", 1, "", "SecurityGateStraightVerticalLFLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3603, "SecurityGateStraightVerticalLowered", 0, "GateOpen", "SecurityGateStraightVerticalLowered_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3604, "SecurityGateStraightVerticalLowered", 1, "", "SecurityGateStraightVerticalLowered_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3605, "SecurityGateDiagonalBLUR", 0, "GateClose", "SecurityGateDiagonalBLUR_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3606, "SecurityGateDiagonalBLUR", 1, "", "SecurityGateDiagonalBLUR_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3607, "SecurityGateDiagonalULBR", 0, "GateClose", "SecurityGateDiagonalULBR_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3608, "SecurityGateDiagonalULBR", 1, "", "SecurityGateDiagonalULBR_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3609, "SecurityGateStraightHorizontalBF", 0, "GateClose", "SecurityGateStraightHorizontalBF_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3610, "SecurityGateStraightHorizontalBF", 1, "", "SecurityGateStraightHorizontalBF_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3611, "SecurityGateStraightHorizontal", 0, "GateClose", "SecurityGateStraightHorizontal_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3612, "SecurityGateStraightHorizontal", 1, "", "SecurityGateStraightHorizontal_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3613, "SecurityGateStraightVerticalLF", 0, "GateClose", "SecurityGateStraightVerticalLF_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3614, "SecurityGateStraightVerticalLF", 1, "", "SecurityGateStraightVerticalLF_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3615, "SecurityGateStraightVertical", 0, "GateClose", "SecurityGateStraightVertical_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3616, "SecurityGateStraightVertical", 1, "", "SecurityGateStraightVertical_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3617, "ChangeShrineTerran", 0, "ChangeShrineTerran", "ChangeShrineTerran_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3618, "ChangeShrineTerran", 1, "", "ChangeShrineTerran_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3619, "ChangeShrineProtoss", 0, "ChangeShrineProtoss", "ChangeShrineProtoss_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3620, "ChangeShrineProtoss", 1, "", "ChangeShrineProtoss_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3621, "SpectreHoldFire", 0, "SpectreHoldFire", "SpectreHoldFire_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3622, "SpectreHoldFire", 1, "", "SpectreHoldFire_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3623, "SpectreWeaponsFree", 0, "WeaponsFree", "SpectreWeaponsFree_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3624, "SpectreWeaponsFree", 1, "", "SpectreWeaponsFree_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3625, "GWALearn", 0, "TestLearn", "GWALearn_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3626, "GWALearn", 1, "TestLearn", "GWALearn_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3627, "GWALearn", 2, "", "GWALearn_2", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3628, "GWALearn", 3, "", "GWALearn_3", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3629, "GWALearn", 4, "", "GWALearn_4", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3630, "GWALearn", 5, "", "GWALearn_5", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3631, "GWALearn", 6, "", "GWALearn_6", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3632, "GWALearn", 7, "", "GWALearn_7", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3633, "GWALearn", 8, "", "GWALearn_8", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3634, "GWALearn", 9, "", "GWALearn_9", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3635, "GWALearn", 10, "", "GWALearn_10", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3636, "GWALearn", 11, "", "GWALearn_11", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3637, "GWALearn", 12, "", "GWALearn_12", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3638, "GWALearn", 13, "", "GWALearn_13", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3639, "GWALearn", 14, "", "GWALearn_14", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3640, "GWALearn", 15, "", "GWALearn_15", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3641, "GWALearn", 16, "", "GWALearn_16", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3642, "GWALearn", 17, "", "GWALearn_17", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3643, "GWALearn", 18, "", "GWALearn_18", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3644, "GWALearn", 19, "", "GWALearn_19", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3645, "ReaperPlacementMorph", 0, "", "ReaperPlacementMorph_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3646, "ReaperPlacementMorph", 1, "", "ReaperPlacementMorph_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3647, "LightBridgeOffTopRight", 0, "LightBridgeOff", "LightBridgeOffTopRight_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3648, "LightBridgeOffTopRight", 1, "", "LightBridgeOffTopRight_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3649, "LightBridgeOnTopRight", 0, "LightBridgeOn", "LightBridgeOnTopRight_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3650, "LightBridgeOnTopRight", 1, "", "LightBridgeOnTopRight_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3651, "TestHeroGrab", 0, "GrabZergling", "TestHeroGrab_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3652, "TestHeroGrab", 1, "", "TestHeroGrab_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3653, "TestHeroThrow", 0, "ThrowZergling", "TestHeroThrow_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3654, "TestHeroThrow", 1, "", "TestHeroThrow_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3655, "TestHeroDebugMissileAbility", 0, "TestHeroDebugMissileAbility", "TestHeroDebugMissileAbility_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3656, "TestHeroDebugMissileAbility", 1, "", "TestHeroDebugMissileAbility_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3657, "TestHeroDebugTrackingAbility", 0, "TestHeroDebugTrackingAbility", "TestHeroDebugTrackingAbility_0", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3658, "TestHeroDebugTrackingAbility", 1, "Cancel", "TestHeroDebugTrackingAbility_1", "", 0, 0, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3659, "Cancel", 0, "Cancel", "Cancel", "", 0, 0, 510, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3660, "Halt", 0, "Halt", "Halt", "", 0, 510, 8, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3661, "BurrowDown", 0, "BurrowDown", "BurrowDown", "", 0, 518, 17, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3662, "BurrowUp", 0, "BurrowUp", "BurrowUp", "", 0, 535, 16, 1, false, true, false, 0.0f, false, 0.0f },
+    { true, 3663, "TransportLoadAll", 0, "TransportLoadAll", "LoadAll", "", 0, 551, 8, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3664, "TransportUnloadAll", 0, "TransportUnloadAll", "UnloadAll", "", 0, 559, 8, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3665, "Stop", 0, "Stop", "Stop", "", 0, 567, 10, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3666, "HarvestGather", 0, "HarvestGather", "Harvest Gather", "", 0, 577, 4, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 3667, "HarvestReturn", 0, "HarvestReturn", "Harvest Return", "", 0, 581, 4, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3668, "TransportLoad", 0, "TransportLoad", "Load", "", 0, 585, 8, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 3669, "TransportUnloadAt", 0, "TransportUnloadAt", "UnloadAllAt", "", 0, 593, 8, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 3670, "TransportUnloadUnit", 0, "TransportUnloadUnit", "UnloadUnit", "", 0, 601, 8, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3671, "CancelLast", 0, "CancelLast", "Cancel Last", "", 0, 609, 11, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3672, "CancelSlot", 0, "CancelSlot", "Cancel Slot", "", 0, 620, 11, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3673, "GeneralRallyUnits", 0, "Rally Units", "Rally Units", "", 0, 631, 3, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 3674, "GeneralAttack", 0, "Attack", "Attack", "", 0, 634, 4, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 3675, "GeneralStimpack", 0, "Stim", "Effect Stim", "", 0, 638, 4, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3676, "GeneralCloakOn", 0, "CloakOn", "Behavior CloakOn", "", 0, 642, 2, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3677, "GeneralCloakOff", 0, "CloakOff", "Behavior CloakOff", "", 0, 644, 2, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3678, "Land", 0, "Land", "Land", "", 0, 646, 5, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 3679, "Lift", 0, "Lift", "Lift", "", 0, 651, 5, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3680, "Root", 0, "Root", "Morph Root", "", 0, 656, 2, 2, false, false, false, 0.0f, false, 0.0f },
+    { true, 3681, "Uproot", 0, "Uproot", "Morph Uproot", "", 0, 658, 2, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3682, "Build TechLab", 0, "Build TechLab", "Build TechLab", "", 0, 660, 3, 5, false, false, true, 3.5f, true, 0.0f },
+    { true, 3683, "Build TechReactor", 0, "Build TechReactor", "Build Reactor", "", 0, 663, 3, 5, false, false, true, 3.5f, true, 0.0f },
+    { true, 3684, "Spray", 0, "Spray", "Effect Spray", "", 0, 666, 3, 2, false, false, false, 0.0f, false, 1.0f },
+    { true, 3685, "RepairGeneral", 0, "Repair", "Effect Repair", "", 0, 669, 3, 3, false, true, false, 0.0f, false, 6.0f },
+    { true, 3686, "Effect MassRecall", 0, "Effect MassRecall", "Effect MassRecall", "", 0, 672, 3, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 3687, "Effect Blink", 0, "Effect Blink", "Effect Blink", "", 0, 675, 2, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 3688, "General HoldFire", 0, "HoldFire", "Behavior HoldFireOn", "", 0, 677, 2, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3689, "General Cancel HoldFire", 0, "Cancel HoldFire", "Behavior HoldFireOff", "", 0, 679, 2, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3690, "GeneralRallyWorkers", 0, "Rally Workers", "Rally Workers", "", 0, 681, 3, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 3691, "GeneralBuildCreepTumor", 0, "Build CreepTumor", "Build CreepTumor", "", 0, 684, 2, 2, false, false, true, 0.5f, false, 0.0f },
+    { true, 3692, "ResearchProtossAirArmor", 0, "Research ProtossAirArmor", "Research ProtossAirArmor", "", 0, 686, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3693, "ResearchProtossAirWeapons", 0, "Research ProtossAirWeapons", "Research ProtossAirWeapons", "", 0, 689, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3694, "ResearchProtossGroundArmor", 0, "Research ProtossGroundArmor", "Research ProtossGroundArmor", "", 0, 692, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3695, "ResearchProtossGroundWeapons", 0, "Research ProtossGroundWeapons", "Research ProtossGroundWeapons", "", 0, 695, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3696, "ResearchProtossShields", 0, "Research ProtossShields", "Research ProtossShields", "", 0, 698, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3697, "ResearchTerranInfantryArmor", 0, "Research TerranInfantryArmor", "Research TerranInfantryArmor", "", 0, 701, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3698, "ResearchTerranInfantryWeapons", 0, "Research TerranInfantryWeapons", "Research TerranInfantryWeapons", "", 0, 704, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3699, "ResearchTerranShipWeapons", 0, "Research TerranShipWeapons", "Research TerranShipWeapons", "", 0, 707, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3700, "ResearchTerranVehicleAndShipPlating", 0, "Research TerranVehicleAndShipPlating", "Research TerranVehicleAndShipPlating", "", 0, 710, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3701, "ResearchTerranVehicleWeapons", 0, "Research TerranVehicleWeapons", "Research TerranVehicleWeapons", "", 0, 713, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3702, "ResearchZergFlyerArmor", 0, "Research ZergFlyerArmor", "Research ZergFlyerArmor", "", 0, 716, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3703, "ResearchZergFlyerAttack", 0, "Research ZergFlyerAttack", "Research ZergFlyerAttack", "", 0, 719, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3704, "ResearchZergGroundArmor", 0, "Research ZergGroundArmor", "Research ZergGroundArmor", "", 0, 722, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3705, "ResearchZergMeleeWeapons", 0, "Research ZergMeleeWeapons", "Research ZergMeleeWeapons", "", 0, 725, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3706, "ResearchZergMissileWeapons", 0, "Research ZergMissileWeapons", "Research ZergMissileWeapons", "", 0, 728, 3, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3707, "VoidRaySwarmDamageBoostCancel", 0, "Cancel", "Effect Cancel", "B", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3708, "VoidRaySwarmDamageBoostCancel", 1, "", "VoidRaySwarmDamageBoostCancel_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3709, "LurkerDenResearch", 0, "EvolveDiggingClaws", "Research AdaptiveTalons", "Q", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3710, "LurkerDenResearch", 1, "", "LurkerDenResearch_1", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3711, "LurkerDenResearch", 2, "", "LurkerDenResearch_2", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3712, "LurkerDenResearch", 3, "", "LurkerDenResearch_3", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3713, "LurkerDenResearch", 4, "", "LurkerDenResearch_4", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3714, "LurkerDenResearch", 5, "", "LurkerDenResearch_5", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3715, "LurkerDenResearch", 6, "", "LurkerDenResearch_6", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3716, "LurkerDenResearch", 7, "", "LurkerDenResearch_7", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3717, "LurkerDenResearch", 8, "", "LurkerDenResearch_8", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3718, "LurkerDenResearch", 9, "", "LurkerDenResearch_9", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3719, "LurkerDenResearch", 10, "", "LurkerDenResearch_10", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3720, "LurkerDenResearch", 11, "", "LurkerDenResearch_11", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3721, "LurkerDenResearch", 12, "", "LurkerDenResearch_12", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3722, "LurkerDenResearch", 13, "", "LurkerDenResearch_13", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3723, "LurkerDenResearch", 14, "", "LurkerDenResearch_14", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3724, "LurkerDenResearch", 15, "", "LurkerDenResearch_15", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3725, "LurkerDenResearch", 16, "", "LurkerDenResearch_16", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3726, "LurkerDenResearch", 17, "", "LurkerDenResearch_17", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3727, "LurkerDenResearch", 18, "", "LurkerDenResearch_18", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3728, "LurkerDenResearch", 19, "", "LurkerDenResearch_19", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3729, "LurkerDenResearch", 20, "", "LurkerDenResearch_20", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3730, "LurkerDenResearch", 21, "", "LurkerDenResearch_21", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3731, "LurkerDenResearch", 22, "", "LurkerDenResearch_22", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3732, "LurkerDenResearch", 23, "", "LurkerDenResearch_23", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3733, "LurkerDenResearch", 24, "", "LurkerDenResearch_24", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3734, "LurkerDenResearch", 25, "", "LurkerDenResearch_25", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3735, "LurkerDenResearch", 26, "", "LurkerDenResearch_26", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3736, "LurkerDenResearch", 27, "", "LurkerDenResearch_27", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3737, "LurkerDenResearch", 28, "", "LurkerDenResearch_28", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3738, "LurkerDenResearch", 29, "", "LurkerDenResearch_29", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3739, "ObserverSiegeMorphtoObserver", 0, "MorphtoObserver", "Morph ObserverMode", "X", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3740, "ObserverSiegeMorphtoObserver", 1, "", "ObserverSiegeMorphtoObserver_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3741, "ObserverMorphtoObserverSiege", 0, "MorphtoObserverSiege", "Morph SurveillanceMode", "Z", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3742, "ObserverMorphtoObserverSiege", 1, "", "ObserverMorphtoObserverSiege_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3743, "OverseerMorphtoOverseerSiegeMode", 0, "MorphtoOverseerSiege", "Morph OversightMode", "Z", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3744, "OverseerMorphtoOverseerSiegeMode", 1, "", "OverseerMorphtoOverseerSiegeMode_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3745, "OverseerSiegeModeMorphtoOverseer", 0, "MorphtoOverseerNormal", "Morph OverseerMode", "X", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3746, "OverseerSiegeModeMorphtoOverseer", 1, "", "OverseerSiegeModeMorphtoOverseer_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3747, "RavenScramblerMissile", 0, "RavenScramblerMissile", "Effect InterferenceMatrix", "X", 0, 731, 0, 3, false, false, false, 0.0f, false, 9.0f },
+    { true, 3748, "RavenScramblerMissile", 1, "", "RavenScramblerMissile_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3749, "RavenRepairDrone", 0, "RavenRepairDrone", "Effect RepairDrone", "", 0, 731, 0, 2, false, false, false, 0.0f, false, 3.0f },
+    { false, 3750, "RavenRepairDrone", 1, "", "RavenRepairDrone_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3751, "RavenRepairDroneHeal", 0, "RavenRepairDroneHeal", "Effect Repair RepairDrone", "Z", 3685, 731, 0, 3, false, true, false, 0.0f, false, 6.0f },
+    { true, 3752, "RavenRepairDroneHeal", 1, "", "RavenRepairDroneHeal_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3753, "RavenShredderMissile", 0, "RavenShredderMissile", "Effect AntiArmorMissile", "C", 0, 731, 0, 3, false, false, false, 0.0f, false, 10.0f },
+    { true, 3754, "RavenShredderMissile", 1, "", "RavenShredderMissile_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3755, "ChronoBoostEnergyCost", 0, "ChronoBoostEnergyCost", "Effect ChronoBoostEnergyCost", "Z", 0, 731, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { true, 3756, "ChronoBoostEnergyCost", 1, "", "ChronoBoostEnergyCost_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3757, "NexusMassRecall", 0, "MassRecall", "Effect MassRecall Nexus", "X", 3686, 731, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 3758, "NexusMassRecall", 1, "", "NexusMassRecall_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3759, "NexusShieldRecharge", 0, "NexusShieldRecharge", "Effect NexusShieldRecharge", "", 0, 731, 0, 3, false, true, false, 0.0f, false, 8.0f },
+    { false, 3760, "NexusShieldRecharge", 1, "", "NexusShieldRecharge_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3761, "NexusShieldRechargeOnPylon", 0, "NexusShieldRechargeOnPylon", "Effect NexusShieldRechargeOnPylon", "", 0, 731, 0, 3, false, false, false, 0.0f, false, 13.0f },
+    { false, 3762, "NexusShieldRechargeOnPylon", 1, "", "NexusShieldRechargeOnPylon_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3763, "InfestorEnsnare", 0, "InfestorEnsnare", "Effect InfestorEnsnare", "", 0, 731, 0, 3, false, false, false, 0.0f, false, 8.0f },
+    { true, 3764, "InfestorEnsnare", 1, "", "InfestorEnsnare_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3765, "ShieldBatteryRechargeChanneled", 0, "ShieldBatteryRecharge", "Effect Restore", "Z", 0, 731, 0, 3, false, true, false, 0.0f, false, 6.0f },
+    { true, 3766, "ShieldBatteryRechargeChanneled", 1, "", "ShieldBatteryRechargeChanneled_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3767, "NexusShieldOvercharge", 0, "NexusShieldOvercharge", "Effect NexusShieldOvercharge", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3768, "NexusShieldOvercharge", 1, "", "NexusShieldOvercharge_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3769, "NexusShieldOverchargeOff", 0, "NexusShieldOverchargeOff", "Effect NexusShieldOverchargeOff", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3770, "NexusShieldOverchargeOff", 1, "", "NexusShieldOverchargeOff_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3771, "BattlecruiserAttack", 0, "Attack", "Attack Attack", "T", 0, 731, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 3772, "BattlecruiserAttack", 1, "AttackTowards", "Attack AttackTowards", "", 0, 731, 0, 2, true, false, false, 0.0f, false, 0.0f },
+    { true, 3773, "BattlecruiserAttack", 2, "AttackBarrage", "Attack AttackBarrage", "", 0, 731, 0, 2, true, false, false, 0.0f, false, 0.0f },
+    { false, 3774, "BattlecruiserAttackEvaluator", 0, "MothershipCoreAttack", "Effect MothershipCoreAttack", "", 0, 731, 0, 4, false, false, false, 0.0f, false, 500.0f },
+    { false, 3775, "BattlecruiserAttackEvaluator", 1, "", "BattlecruiserAttackEvaluator_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3776, "BattlecruiserMove", 0, "Move", "Move Move", "Q", 0, 731, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 3777, "BattlecruiserMove", 1, "MovePatrol", "Move MovePatrol", "R", 0, 731, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 3778, "BattlecruiserMove", 2, "MoveHoldPosition", "Move MoveHoldPosition", "E", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3779, "BattlecruiserMove", 3, "AcquireMove", "Move AcquireMove", "", 0, 731, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { true, 3780, "BattlecruiserMove", 4, "Turn", "Move Turn", "", 0, 731, 0, 4, true, false, false, 0.0f, false, 0.0f },
+    { false, 3781, "BattlecruiserStopEvaluator", 0, "Stop", "Effect Stop", "", 3665, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { false, 3782, "BattlecruiserStopEvaluator", 1, "", "BattlecruiserStopEvaluator_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3783, "BattlecruiserStop", 0, "Stop", "Stop Stop", "W", 3665, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3784, "BattlecruiserStop", 1, "HoldFire", "Stop HoldFire", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3785, "BattlecruiserStop", 2, "Cheer", "Stop Cheer", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3786, "BattlecruiserStop", 3, "Dance", "Stop Dance", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3787, "BattlecruiserStop", 4, "", "BattlecruiserStop_4", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3788, "BattlecruiserStop", 5, "", "BattlecruiserStop_5", "", 0, 731, 0, 3, false, false, false, 0.0f, false, 0.0f },
+    { true, 3789, "ViperParasiticBombRelay", 0, "ParasiticBomb", "Effect ParasiticBomb", "Q", 0, 731, 0, 3, false, false, false, 0.0f, false, 500.0f },
+    { true, 3790, "ViperParasiticBombRelay", 1, "", "ViperParasiticBombRelay_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3791, "ParasiticBombRelayDodge", 0, "ParasiticBomb", "Effect ParasiticBomb", "Q", 0, 731, 0, 2, false, false, false, 0.0f, false, 500.0f },
+    { true, 3792, "ParasiticBombRelayDodge", 1, "", "ParasiticBombRelayDodge_1", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3793, "MorphToCollapsibleRockTowerDebrisRampLeftGreen", 0, "", "MorphToCollapsibleRockTowerDebrisRampLeftGreen_0", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3794, "MorphToCollapsibleRockTowerDebrisRampLeftGreen", 1, "Cancel", "Morph Cancel", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3795, "MorphToCollapsibleRockTowerDebrisRampRightGreen", 0, "", "MorphToCollapsibleRockTowerDebrisRampRightGreen_0", "", 0, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+    { true, 3796, "MorphToCollapsibleRockTowerDebrisRampRightGreen", 1, "Cancel", "Morph Cancel", "", 3659, 731, 0, 1, false, false, false, 0.0f, false, 0.0f },
+};
+
+const size_t LIBVOXELBOT_TABLE_ABILITIES_SIZE = 3797;
+
+const int LIBVOXELBOT_TABLE_ABILITY_REMAPS_FROM[] = {
+    3,
+    21,
+    27,
+    29,
+    31,
+    35,
+    37,
+    39,
+    41,
+    43,
+    75,
+    77,
+    79,
+    141,
+    143,
+    145,
+    147,
+    149,
+    151,
+    153,
+    155,
+    157,
+    159,
+    161,
+    163,
+    165,
+    168,
+    170,
+    172,
+    174,
+    175,
+    178,
+    180,
+    182,
+    184,
+    186,
+    188,
+    190,
+    192,
+    194,
+    246,
+    248,
+    250,
+    252,
+    254,
+    256,
+    258,
+    260,
+    262,
+    294,
+    297,
+    300,
+    314,
+    317,
+    381,
+    385,
+    387,
+    389,
+    391,
+    400,
+    402,
+    404,
+    406,
+    418,
+    420,
+    451,
+    453,
+    484,
+    486,
+    517,
+    519,
+    521,
+    523,
+    555,
+    557,
+    559,
+    1037,
+    1185,
+    1217,
+    1219,
+    1221,
+    1373,
+    1375,
+    1377,
+    1379,
+    1381,
+    1383,
+    1385,
+    1387,
+    1389,
+    1391,
+    1393,
+    1395,
+    1397,
+    1399,
+    1401,
+    1403,
+    1405,
+    1411,
+    1412,
+    1434,
+    1436,
+    1443,
+    1445,
+    1447,
+    1449,
+    1451,
+    1513,
+    1515,
+    1517,
+    1519,
+    1521,
+    1523,
+    1525,
+    1527,
+    1529,
+    1531,
+    1623,
+    1625,
+    1629,
+    1631,
+    1663,
+    1665,
+    1667,
+    1669,
+    1671,
+    1673,
+    1675,
+    1677,
+    1679,
+    1681,
+    1726,
+    1728,
+    1730,
+    1732,
+    1763,
+    1765,
+    1822,
+    1824,
+    1826,
+    1828,
+    1830,
+    1836,
+    1838,
+    1840,
+    1842,
+    1844,
+    1846,
+    1848,
+    1850,
+    1852,
+    1884,
+    1886,
+    1890,
+    1894,
+    1898,
+    1902,
+    1906,
+    1910,
+    1914,
+    1918,
+    1927,
+    1929,
+    1931,
+    1933,
+    1935,
+    1937,
+    1939,
+    1941,
+    1943,
+    1975,
+    1977,
+    1979,
+    1981,
+    1983,
+    1985,
+    1987,
+    1989,
+    1991,
+    1993,
+    1995,
+    1997,
+    1999,
+    2001,
+    2003,
+    2005,
+    2007,
+    2009,
+    2011,
+    2013,
+    2015,
+    2017,
+    2064,
+    2066,
+    2068,
+    2070,
+    2072,
+    2074,
+    2080,
+    2084,
+    2086,
+    2088,
+    2090,
+    2092,
+    2094,
+    2096,
+    2098,
+    2100,
+    2103,
+    2105,
+    2107,
+    2109,
+    2111,
+    2113,
+    2115,
+    2117,
+    2119,
+    2121,
+    2123,
+    2125,
+    2127,
+    2129,
+    2131,
+    2133,
+    2135,
+    2137,
+    2139,
+    2141,
+    2143,
+    2145,
+    2147,
+    2149,
+    2151,
+    2153,
+    2155,
+    2157,
+    2159,
+    2161,
+    2163,
+    2165,
+    2167,
+    2169,
+    2171,
+    2173,
+    2175,
+    2177,
+    2179,
+    2181,
+    2183,
+    2185,
+    2187,
+    2189,
+    2191,
+    2193,
+    2195,
+    2197,
+    2199,
+    2201,
+    2203,
+    2205,
+    2207,
+    2209,
+    2211,
+    2213,
+    2215,
+    2217,
+    2219,
+    2221,
+    2223,
+    2225,
+    2227,
+    2229,
+    2231,
+    2233,
+    2235,
+    2237,
+    2239,
+    2241,
+    2243,
+    2245,
+    2247,
+    2249,
+    2251,
+    2253,
+    2255,
+    2257,
+    2259,
+    2261,
+    2263,
+    2265,
+    2267,
+    2269,
+    2271,
+    2273,
+    2275,
+    2277,
+    2279,
+    2281,
+    2283,
+    2285,
+    2287,
+    2289,
+    2291,
+    2293,
+    2325,
+    2327,
+    2329,
+    2331,
+    2333,
+    2335,
+    2337,
+    2339,
+    2341,
+    2343,
+    2345,
+    2347,
+    2349,
+    2351,
+    2353,
+    2354,
+    2355,
+    2357,
+    2359,
+    2361,
+    2363,
+    2365,
+    2367,
+    2369,
+    2378,
+    2380,
+    2382,
+    2384,
+    2386,
+    2388,
+    2390,
+    2392,
+    2394,
+    2396,
+    2398,
+    2400,
+    2402,
+    2404,
+    2406,
+    2408,
+    2410,
+    2412,
+    2414,
+    2416,
+    2418,
+    2420,
+    2422,
+    2424,
+    2426,
+    2428,
+    2430,
+    2432,
+    2434,
+    2436,
+    2438,
+    2440,
+    2442,
+    2444,
+    2446,
+    2448,
+    2450,
+    2452,
+    2454,
+    2456,
+    2458,
+    2460,
+    2462,
+    2464,
+    2466,
+    2468,
+    2470,
+    2472,
+    2474,
+    2476,
+    2478,
+    2480,
+    2482,
+    2484,
+    2486,
+    2488,
+    2490,
+    2492,
+    2494,
+    2496,
+    2498,
+    2500,
+    2502,
+    2504,
+    2535,
+    2537,
+    2539,
+    2541,
+    2543,
+    2545,
+    2547,
+    2549,
+    2551,
+    2553,
+    2555,
+    2557,
+    2559,
+    2561,
+    2563,
+    2565,
+    2567,
+    2569,
+    2571,
+    2573,
+    2575,
+    2577,
+    2579,
+    2581,
+    2583,
+    2585,
+    2587,
+    2589,
+    2591,
+    2593,
+    2594,
+    2595,
+    2596,
+    2597,
+    2599,
+    2601,
+    2603,
+    2605,
+    2607,
+    2609,
+    2611,
+    2613,
+    2615,
+    2617,
+    2619,
+    2621,
+    2623,
+    2625,
+    2627,
+    2629,
+    2631,
+    2633,
+    2635,
+    2637,
+    2639,
+    2641,
+    2643,
+    2645,
+    2647,
+    2649,
+    2651,
+    2653,
+    2655,
+    2657,
+    2659,
+    2661,
+    2663,
+    2665,
+    2667,
+    2669,
+    2671,
+    2673,
+    2675,
+    2677,
+    2679,
+    2681,
+    2683,
+    2685,
+    2687,
+    2689,
+    2691,
+    2693,
+    2695,
+    2697,
+    2699,
+    2701,
+    2703,
+    2705,
+    2707,
+    2709,
+    2711,
+    2713,
+    2715,
+    2717,
+    2719,
+    3708,
+    3740,
+    3742,
+    3744,
+    3746,
+    3748,
+    3750,
+    3752,
+    3754,
+    3756,
+    3758,
+    3760,
+    3762,
+    3764,
+    3766,
+    3768,
+    3770,
+    3775,
+    3782,
+    3790,
+    3792,
+    3794,
+    3796,
+    176,
+    315,
+    348,
+    379,
+    910,
+    1182,
+    1724,
+    1798,
+    1374,
+    1378,
+    1382,
+    1386,
+    1390,
+    1394,
+    1398,
+    1400,
+    1433,
+    1444,
+    1512,
+    1662,
+    2014,
+    2095,
+    2108,
+    2340,
+    2489,
+    1376,
+    1380,
+    1384,
+    1388,
+    1392,
+    1396,
+    1402,
+    1404,
+    1435,
+    1446,
+    1514,
+    2016,
+    2097,
+    2110,
+    2342,
+    2491,
+    398,
+    411,
+    416,
+    915,
+    1410,
+    1441,
+    1925,
+    2374,
+    395,
+    408,
+    413,
+    912,
+    1407,
+    1438,
+    1922,
+    2371,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1691,
+    2057,
+    3781,
+    3783,
+    166,
+    295,
+    298,
+    1183,
+    167,
+    296,
+    299,
+    1184,
+    394,
+    407,
+    412,
+    911,
+    1406,
+    1437,
+    1921,
+    2370,
+    396,
+    409,
+    414,
+    913,
+    1408,
+    1439,
+    1923,
+    2372,
+    397,
+    410,
+    415,
+    914,
+    1409,
+    1440,
+    1924,
+    2373,
+    304,
+    306,
+    308,
+    310,
+    312,
+    1038,
+    1040,
+    1831,
+    1833,
+    2075,
+    2077,
+    305,
+    307,
+    309,
+    311,
+    313,
+    1039,
+    1041,
+    1832,
+    1834,
+    2076,
+    2078,
+    195,
+    199,
+    211,
+    19,
+    23,
+    1682,
+    2048,
+    253,
+    380,
+    1683,
+    1684,
+    382,
+    392,
+    383,
+    393,
+    419,
+    520,
+    522,
+    554,
+    1524,
+    417,
+    452,
+    485,
+    518,
+    1522,
+    1729,
+    1731,
+    1725,
+    1727,
+    421,
+    454,
+    487,
+    422,
+    455,
+    488,
+    26,
+    28,
+    30,
+    78,
+    316,
+    3751,
+    1974,
+    2368,
+    3757,
+    1442,
+    2700,
+    36,
+    2550,
+    38,
+    2552,
+    203,
+    207,
+    212,
+    1694,
+    1733,
+    1565,
+    1566,
+    1567,
+    1562,
+    1563,
+    1564,
+    1065,
+    1066,
+    1067,
+    1062,
+    1063,
+    1064,
+    1068,
+    1069,
+    1070,
+    656,
+    657,
+    658,
+    652,
+    653,
+    654,
+    861,
+    862,
+    863,
+    864,
+    865,
+    866,
+    855,
+    856,
+    857,
+    1315,
+    1316,
+    1317,
+    1312,
+    1313,
+    1314,
+    1189,
+    1190,
+    1191,
+    1186,
+    1187,
+    1188,
+    1192,
+    1193,
+    1194,
+};
@@ -1,10147 +0,0 @@
-const unsigned char LIBVOXELBOT_DATA_UNITS[] = { 
-0x31, 0x39, 0x35, 0x37, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x79, 0x73, 0x74, 
-0x65, 0x6d, 0x5f, 0x53, 0x6e, 0x61, 0x70, 0x73, 0x68, 0x6f, 0x74, 0x5f, 0x44, 0x75, 0x6d, 0x6d, 
-0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x22, 0x42, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x36, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x65, 0x72, 0x65, 
-0x6f, 0x73, 0x63, 0x6f, 0x70, 0x69, 0x63, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x55, 0x6e, 
-0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x34, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6f, 0x73, 0x73, 0x75, 0x73, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x0d, 0x0a, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x37, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 
-0x20, 0x35, 0x0d, 0x0a, 0x32, 0x20, 0x37, 0x20, 0x31, 0x2e, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 
-0x20, 0x30, 0x20, 0x39, 0x37, 0x38, 0x20, 0x32, 0x20, 0x31, 0x32, 0x30, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x37, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x0d, 0x0a, 0x22, 0x54, 0x65, 0x63, 0x68, 0x4c, 0x61, 0x62, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x36, 0x36, 0x36, 0x20, 
-0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x0d, 0x0a, 0x22, 0x52, 0x65, 0x61, 
-0x63, 0x74, 0x6f, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 
-0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x36, 0x37, 0x34, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x0d, 0x0a, 
-0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x2e, 0x39, 0x33, 0x37, 0x35, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x31, 0x34, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x33, 0x33, 0x30, 0x30, 0x38, 0x0d, 0x0a, 0x31, 0x20, 0x36, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x36, 0x30, 
-0x38, 0x34, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x34, 0x30, 0x20, 0x31, 0x20, 0x37, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x0d, 0x0a, 0x22, 0x42, 0x61, 0x6e, 0x65, 0x6c, 
-0x69, 0x6e, 0x67, 0x43, 0x6f, 0x63, 0x6f, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 
-0x0a, 0x32, 0x2e, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x2e, 
-0x35, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x35, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 
-0x0d, 0x0a, 0x22, 0x42, 0x61, 0x6e, 0x65, 0x6c, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 
-0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x2e, 0x35, 0x20, 0x30, 0x20, 0x38, 0x30, 0x20, 0x31, 0x20, 0x33, 0x32, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 0x36, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x4d, 0x6f, 0x74, 0x68, 0x65, 0x72, 
-0x73, 0x68, 0x69, 0x70, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x34, 0x30, 0x30, 
-0x0d, 0x0a, 0x34, 0x30, 0x30, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x36, 0x20, 
-0x37, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x33, 0x20, 0x36, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x20, 0x37, 0x20, 0x32, 
-0x2e, 0x32, 0x30, 0x39, 0x39, 0x36, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x20, 0x30, 0x20, 0x31, 0x31, 
-0x30, 0x20, 0x32, 0x20, 0x32, 0x35, 0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x34, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x31, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x65, 0x6e, 0x73, 0x65, 
-0x44, 0x72, 0x6f, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x37, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x0d, 0x0a, 0x22, 
-0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 
-0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x33, 0x0d, 0x0a, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x69, 0x6e, 0x67, 0x5a, 0x65, 
-0x61, 0x6c, 0x6f, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x38, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x20, 0x30, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 0x31, 0x2e, 0x31, 
-0x39, 0x39, 0x39, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x38, 0x33, 0x20, 
-0x31, 0x20, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x43, 
-0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x69, 0x6e, 0x67, 0x4d, 0x61, 0x72, 0x69, 0x6e, 0x65, 0x53, 
-0x68, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 
-0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x36, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x36, 0x30, 0x38, 0x34, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x38, 0x35, 0x20, 0x31, 0x20, 0x38, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 
-0x69, 0x6e, 0x67, 0x4d, 0x61, 0x72, 0x69, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 
-0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x36, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x36, 0x30, 
-0x38, 0x34, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x38, 0x37, 0x20, 0x31, 0x20, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x43, 0x68, 0x61, 
-0x6e, 0x67, 0x65, 0x6c, 0x69, 0x6e, 0x67, 0x5a, 0x65, 0x72, 0x67, 0x6c, 0x69, 0x6e, 0x67, 0x57, 
-0x69, 0x6e, 0x67, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x39, 0x35, 
-0x33, 0x31, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 
-0x30, 0x2e, 0x36, 0x39, 0x36, 0x30, 0x34, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x31, 0x38, 0x39, 0x20, 0x31, 0x20, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 
-0x0d, 0x0a, 0x22, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x69, 0x6e, 0x67, 0x5a, 0x65, 0x72, 
-0x67, 0x6c, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x39, 
-0x35, 0x33, 0x31, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x39, 0x38, 
-0x20, 0x30, 0x2e, 0x36, 0x39, 0x36, 0x30, 0x34, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x31, 0x39, 0x31, 0x20, 0x31, 0x20, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x38, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x43, 0x65, 0x6e, 0x74, 0x65, 
-0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x34, 0x30, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x35, 0x20, 0x33, 0x31, 0x38, 
-0x20, 0x30, 0x20, 0x31, 0x36, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 
-0x0d, 0x0a, 0x22, 0x53, 0x75, 0x70, 0x70, 0x6c, 0x79, 0x44, 0x65, 0x70, 0x6f, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x20, 0x33, 0x31, 0x39, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x52, 0x65, 0x66, 
-0x69, 0x6e, 0x65, 0x72, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x37, 0x35, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x32, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x39, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x31, 
-0x0d, 0x0a, 0x22, 0x42, 0x61, 0x72, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x32, 0x31, 0x20, 0x30, 0x20, 0x31, 0x30, 0x34, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x39, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x45, 0x6e, 0x67, 0x69, 
-0x6e, 0x65, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x42, 0x61, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 
-0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x32, 0x32, 0x20, 0x30, 0x20, 0x35, 0x36, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x38, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 
-0x65, 0x54, 0x75, 0x72, 0x72, 0x65, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x31, 0x32, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x36, 0x30, 
-0x38, 0x34, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x32, 0x33, 0x20, 0x30, 0x20, 
-0x34, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x32, 0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x34, 0x0d, 0x0a, 0x22, 
-0x42, 0x75, 0x6e, 0x6b, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x32, 0x34, 0x20, 0x30, 0x20, 0x36, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x32, 0x31, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x54, 0x6f, 0x77, 
-0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 
-0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x32, 0x36, 0x20, 0x30, 0x20, 0x34, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x32, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x32, 0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x36, 0x0d, 0x0a, 0x22, 0x47, 0x68, 0x6f, 0x73, 0x74, 0x41, 0x63, 0x61, 0x64, 0x65, 0x6d, 
-0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x35, 
-0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x32, 0x37, 
-0x20, 0x30, 0x20, 0x36, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x32, 0x31, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x37, 0x0d, 
-0x0a, 0x22, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x32, 0x38, 0x20, 0x30, 0x20, 0x39, 0x36, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x32, 0x31, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x61, 0x72, 0x70, 
-0x6f, 0x72, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x32, 0x39, 0x20, 0x30, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x32, 0x37, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x39, 0x0d, 0x0a, 0x22, 0x41, 0x72, 0x6d, 0x6f, 0x72, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x33, 0x31, 0x20, 0x30, 0x20, 0x31, 0x30, 
-0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x32, 0x37, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x46, 0x75, 
-0x73, 0x69, 0x6f, 0x6e, 0x43, 0x6f, 0x72, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 
-0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x33, 0x33, 0x20, 0x30, 0x20, 0x31, 0x30, 0x34, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x32, 0x38, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x41, 0x75, 0x74, 0x6f, 0x54, 
-0x75, 0x72, 0x72, 0x65, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x31, 0x38, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x30, 0x2e, 0x38, 0x30, 0x30, 0x30, 0x34, 
-0x39, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x34, 0x39, 0x20, 0x30, 0x20, 0x31, 
-0x36, 0x20, 0x30, 0x20, 0x30, 0x20, 0x37, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x53, 0x69, 0x65, 0x67, 
-0x65, 0x54, 0x61, 0x6e, 0x6b, 0x53, 0x69, 0x65, 0x67, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x31, 0x20, 0x34, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x30, 0x0d, 0x0a, 0x31, 
-0x20, 0x31, 0x33, 0x20, 0x33, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x33, 0x38, 0x38, 
-0x20, 0x30, 0x20, 0x36, 0x38, 0x2e, 0x36, 0x36, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 
-0x20, 0x31, 0x0d, 0x0a, 0x33, 0x33, 0x20, 0x0d, 0x0a, 0x33, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x33, 0x0d, 0x0a, 0x22, 0x53, 0x69, 0x65, 0x67, 0x65, 0x54, 0x61, 
-0x6e, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 
-0x31, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 
-0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x35, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x32, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 0x20, 0x37, 0x20, 0x31, 0x2e, 0x30, 
-0x34, 0x30, 0x30, 0x34, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x35, 0x39, 0x31, 0x20, 
-0x30, 0x20, 0x37, 0x32, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x35, 0x20, 0x31, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x0d, 0x0a, 
-0x22, 0x56, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x41, 0x73, 0x73, 0x61, 0x75, 0x6c, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x32, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x20, 
-0x38, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 
-0x34, 0x30, 0x33, 0x20, 0x30, 0x20, 0x34, 0x31, 0x2e, 0x34, 0x34, 0x31, 0x34, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x30, 0x20, 0x31, 0x0d, 0x0a, 0x31, 0x39, 0x34, 0x30, 0x20, 0x0d, 0x0a, 0x33, 
-0x35, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x56, 
-0x69, 0x6b, 0x69, 0x6e, 0x67, 0x46, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x32, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x0d, 
-0x0a, 0x32, 0x20, 0x39, 0x20, 0x32, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x36, 0x32, 
-0x34, 0x20, 0x30, 0x20, 0x36, 0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x31, 
-0x0d, 0x0a, 0x31, 0x39, 0x34, 0x30, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x43, 
-0x65, 0x6e, 0x74, 0x65, 0x72, 0x46, 0x6c, 0x79, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x34, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x2e, 0x39, 0x33, 0x37, 0x35, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x35, 0x20, 0x34, 0x31, 0x37, 0x20, 
-0x30, 0x20, 0x33, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x31, 0x0d, 0x0a, 0x31, 
-0x38, 0x20, 0x0d, 0x0a, 0x31, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 
-0x37, 0x0d, 0x0a, 0x22, 0x42, 0x61, 0x72, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x54, 0x65, 0x63, 0x68, 
-0x4c, 0x61, 0x62, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 
-0x32, 0x35, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x34, 0x32, 
-0x31, 0x20, 0x30, 0x20, 0x34, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 0x0d, 
-0x0a, 0x35, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 
-0x38, 0x0d, 0x0a, 0x22, 0x42, 0x61, 0x72, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x52, 0x65, 0x61, 0x63, 
-0x74, 0x6f, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 
-0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x34, 0x32, 
-0x32, 0x20, 0x30, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 0x0d, 
-0x0a, 0x36, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 
-0x39, 0x0d, 0x0a, 0x22, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x54, 0x65, 0x63, 0x68, 0x4c, 
-0x61, 0x62, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x32, 
-0x35, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x34, 0x35, 0x34, 
-0x20, 0x30, 0x20, 0x34, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 
-0x35, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x30, 
-0x0d, 0x0a, 0x22, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x52, 0x65, 0x61, 0x63, 0x74, 0x6f, 
-0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x35, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x34, 0x35, 0x35, 0x20, 
-0x30, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 0x36, 
-0x20, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x31, 0x0d, 
-0x0a, 0x22, 0x53, 0x74, 0x61, 0x72, 0x70, 0x6f, 0x72, 0x74, 0x54, 0x65, 0x63, 0x68, 0x4c, 0x61, 
-0x62, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x35, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x37, 0x20, 
-0x30, 0x20, 0x34, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 0x35, 
-0x20, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x0d, 
-0x0a, 0x22, 0x53, 0x74, 0x61, 0x72, 0x70, 0x6f, 0x72, 0x74, 0x52, 0x65, 0x61, 0x63, 0x74, 0x6f, 
-0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x35, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x38, 0x20, 
-0x30, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 0x36, 
-0x20, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x0d, 
-0x0a, 0x22, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x46, 0x6c, 0x79, 0x69, 0x6e, 0x67, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x2e, 0x39, 
-0x33, 0x37, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x35, 0x20, 0x30, 0x20, 0x33, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 
-0x31, 0x0d, 0x0a, 0x32, 0x37, 0x20, 0x0d, 0x0a, 0x32, 0x37, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x61, 0x72, 0x70, 0x6f, 0x72, 0x74, 
-0x46, 0x6c, 0x79, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x2e, 0x39, 0x33, 0x37, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x35, 0x31, 0x38, 0x20, 0x30, 0x20, 0x33, 0x32, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 0x32, 0x38, 0x20, 0x0d, 0x0a, 0x32, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x53, 
-0x43, 0x56, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 
-0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 
-0x31, 0x2e, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x20, 0x35, 0x32, 0x34, 0x20, 0x30, 
-0x20, 0x32, 0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x42, 
-0x61, 0x72, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x46, 0x6c, 0x79, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x2e, 0x39, 0x33, 0x37, 0x35, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x34, 0x35, 0x32, 
-0x20, 0x30, 0x20, 0x33, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 0x32, 
-0x31, 0x20, 0x0d, 0x0a, 0x32, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 
-0x37, 0x0d, 0x0a, 0x22, 0x53, 0x75, 0x70, 0x70, 0x6c, 0x79, 0x44, 0x65, 0x70, 0x6f, 0x74, 0x4c, 
-0x6f, 0x77, 0x65, 0x72, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 
-0x20, 0x35, 0x35, 0x36, 0x20, 0x30, 0x20, 0x32, 0x30, 0x2e, 0x38, 0x30, 0x30, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 0x31, 0x39, 0x20, 0x0d, 0x0a, 0x31, 0x39, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x4d, 0x61, 0x72, 
-0x69, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x36, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x36, 0x30, 0x38, 0x34, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x20, 0x30, 0x20, 0x35, 0x36, 0x30, 0x20, 0x30, 0x20, 0x34, 0x30, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x52, 0x65, 0x61, 0x70, 0x65, 0x72, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x33, 0x2e, 0x37, 0x35, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 
-0x20, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x30, 0x30, 0x31, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 
-0x20, 0x35, 0x36, 0x31, 0x20, 0x30, 0x20, 0x37, 0x32, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x35, 0x30, 0x0d, 0x0a, 0x22, 0x47, 0x68, 0x6f, 0x73, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x33, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 
-0x30, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 
-0x30, 0x20, 0x35, 0x36, 0x32, 0x20, 0x30, 0x20, 0x36, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x4d, 0x61, 0x72, 0x61, 0x75, 0x64, 0x65, 0x72, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 
-0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x20, 0x30, 0x20, 0x35, 0x36, 0x33, 0x20, 0x30, 0x20, 0x34, 0x38, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x35, 0x20, 0x31, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x54, 0x68, 0x6f, 0x72, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x0d, 0x0a, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 
-0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x37, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 0x37, 0x35, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x36, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x31, 0x20, 0x36, 0x0d, 0x0a, 0x34, 0x20, 0x31, 0x30, 0x20, 0x33, 0x0d, 0x0a, 0x31, 0x20, 0x33, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x37, 0x20, 0x31, 0x2e, 0x32, 0x38, 
-0x30, 0x30, 0x33, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x20, 0x30, 0x20, 0x35, 0x39, 0x34, 0x20, 0x30, 
-0x20, 0x39, 0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x33, 0x0d, 0x0a, 0x22, 
-0x48, 0x65, 0x6c, 0x6c, 0x69, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 
-0x0a, 0x34, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x38, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x32, 0x2e, 
-0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x35, 0x39, 0x35, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x4d, 0x65, 
-0x64, 0x69, 0x76, 0x61, 0x63, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 
-0x0a, 0x32, 0x2e, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 
-0x30, 0x20, 0x36, 0x32, 0x30, 0x20, 0x30, 0x20, 0x36, 0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x42, 0x61, 0x6e, 0x73, 0x68, 0x65, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x37, 0x35, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 
-0x20, 0x36, 0x32, 0x31, 0x20, 0x30, 0x20, 0x39, 0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x35, 0x20, 0x31, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x37, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x36, 0x32, 0x32, 0x20, 0x30, 0x20, 0x39, 
-0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x35, 0x20, 0x31, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x42, 0x61, 
-0x74, 0x74, 0x6c, 0x65, 0x63, 0x72, 0x75, 0x69, 0x73, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x34, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x32, 0x20, 0x34, 0x20, 0x37, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 0x37, 0x35, 0x0d, 0x0a, 
-0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x20, 0x30, 0x20, 0x36, 0x32, 0x33, 0x20, 
-0x30, 0x20, 0x31, 0x34, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x32, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x38, 0x0d, 
-0x0a, 0x22, 0x4e, 0x75, 0x6b, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x4e, 0x65, 0x78, 
-0x75, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x34, 0x30, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x35, 0x20, 0x38, 0x38, 0x30, 0x20, 
-0x32, 0x20, 0x31, 0x36, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 0x0d, 
-0x0a, 0x22, 0x50, 0x79, 0x6c, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x20, 
-0x38, 0x38, 0x31, 0x20, 0x32, 0x20, 0x34, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 
-0x31, 0x0d, 0x0a, 0x22, 0x41, 0x73, 0x73, 0x69, 0x6d, 0x69, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 0x38, 0x32, 0x20, 0x32, 0x20, 0x34, 0x38, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x47, 0x61, 0x74, 0x65, 0x77, 
-0x61, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 0x38, 0x33, 0x20, 0x32, 
-0x20, 0x31, 0x30, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x35, 0x39, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 0x0d, 0x0a, 
-0x22, 0x46, 0x6f, 0x72, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 
-0x38, 0x34, 0x20, 0x32, 0x20, 0x37, 0x32, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x35, 0x39, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 
-0x34, 0x0d, 0x0a, 0x22, 0x46, 0x6c, 0x65, 0x65, 0x74, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 0x38, 0x35, 0x20, 0x32, 0x20, 
-0x39, 0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x36, 0x37, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x54, 
-0x77, 0x69, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x43, 0x6f, 0x75, 0x6e, 0x63, 0x69, 0x6c, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 0x38, 0x36, 0x20, 0x32, 0x20, 0x38, 
-0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x37, 0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x50, 0x68, 
-0x6f, 0x74, 0x6f, 0x6e, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x32, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x37, 0x20, 0x31, 0x2e, 0x32, 0x35, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 0x38, 0x37, 0x20, 0x32, 0x20, 0x36, 0x34, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x36, 0x33, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x53, 0x74, 
-0x61, 0x72, 0x67, 0x61, 0x74, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x38, 0x38, 0x39, 0x20, 0x32, 0x20, 0x39, 0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x37, 0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x72, 0x41, 0x72, 0x63, 
-0x68, 0x69, 0x76, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 
-0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 
-0x39, 0x30, 0x20, 0x32, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x36, 0x35, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 
-0x39, 0x0d, 0x0a, 0x22, 0x44, 0x61, 0x72, 0x6b, 0x53, 0x68, 0x72, 0x69, 0x6e, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 0x39, 0x31, 0x20, 0x32, 0x20, 0x31, 
-0x36, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x36, 0x35, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x52, 
-0x6f, 0x62, 0x6f, 0x74, 0x69, 0x63, 0x73, 0x42, 0x61, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 0x39, 0x32, 0x20, 0x32, 0x20, 0x31, 0x30, 0x34, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x37, 0x31, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x52, 0x6f, 0x62, 0x6f, 0x74, 
-0x69, 0x63, 0x73, 0x46, 0x61, 0x63, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 0x39, 0x33, 0x20, 0x32, 0x20, 0x31, 0x30, 0x34, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x37, 0x32, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x43, 0x79, 0x62, 0x65, 
-0x72, 0x6e, 0x65, 0x74, 0x69, 0x63, 0x73, 0x43, 0x6f, 0x72, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 
-0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x38, 0x39, 0x34, 0x20, 0x32, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x36, 0x32, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x61, 0x6c, 0x6f, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x38, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 
-0x20, 0x30, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 0x31, 0x2e, 0x31, 0x39, 0x39, 0x39, 
-0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x39, 0x31, 0x36, 0x20, 0x32, 0x20, 0x36, 
-0x30, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x61, 
-0x6c, 0x6b, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x32, 0x35, 
-0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 
-0x2e, 0x39, 0x35, 0x33, 0x31, 0x32, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 
-0x31, 0x33, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x35, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 
-0x31, 0x2e, 0x38, 0x37, 0x30, 0x31, 0x32, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x39, 
-0x31, 0x37, 0x20, 0x32, 0x20, 0x36, 0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x37, 0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x37, 0x35, 0x0d, 0x0a, 0x22, 0x48, 0x69, 0x67, 0x68, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x72, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 
-0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x37, 0x35, 0x33, 0x39, 0x31, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x39, 0x31, 0x39, 0x20, 0x32, 0x20, 0x38, 0x38, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x36, 
-0x38, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x61, 0x72, 
-0x6b, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x31, 0x20, 
-0x33, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x20, 0x30, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 0x31, 0x2e, 0x36, 0x39, 0x34, 0x30, 
-0x39, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x39, 0x32, 0x30, 0x20, 0x32, 0x20, 0x38, 
-0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x36, 0x39, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x53, 0x65, 
-0x6e, 0x74, 0x72, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x36, 0x20, 0x0d, 
-0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x36, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x31, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x20, 0x30, 0x20, 0x39, 0x32, 0x31, 0x20, 0x32, 0x20, 0x35, 0x39, 0x32, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x37, 0x32, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x68, 0x6f, 0x65, 0x6e, 0x69, 
-0x78, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x34, 0x2e, 0x32, 
-0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x31, 0x20, 0x35, 0x0d, 0x0a, 0x32, 0x20, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x30, 0x30, 0x31, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x39, 0x34, 0x36, 0x20, 0x32, 0x20, 0x35, 0x36, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x43, 0x61, 0x72, 
-0x72, 0x69, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x35, 0x30, 
-0x0d, 0x0a, 0x32, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x37, 0x20, 
-0x0d, 0x0a, 0x31, 0x2e, 0x38, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x36, 0x20, 0x30, 0x20, 0x39, 0x34, 0x38, 0x20, 0x32, 0x20, 0x31, 0x34, 0x34, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x32, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x36, 0x34, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x56, 0x6f, 0x69, 0x64, 
-0x52, 0x61, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x30, 0x0d, 
-0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 
-0x2e, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x36, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x32, 0x20, 0x34, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x30, 0x2e, 0x35, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x34, 0x20, 0x30, 0x20, 0x39, 0x35, 0x30, 0x20, 0x32, 0x20, 0x39, 0x36, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x31, 0x0d, 0x0a, 0x22, 0x57, 0x61, 0x72, 0x70, 0x50, 
-0x72, 0x69, 0x73, 0x6d, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x36, 0x20, 0x0d, 0x0a, 
-0x32, 0x2e, 0x39, 0x35, 0x33, 0x31, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x20, 0x30, 0x20, 0x39, 0x37, 0x36, 0x20, 0x32, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x76, 
-0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x37, 
-0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x31, 0x34, 
-0x38, 0x34, 0x34, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 
-0x20, 0x39, 0x37, 0x37, 0x20, 0x32, 0x20, 0x34, 0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x49, 0x6d, 0x6d, 0x6f, 0x72, 0x74, 0x61, 0x6c, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x32, 0x37, 0x35, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x32, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 
-0x20, 0x33, 0x30, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x34, 0x34, 0x39, 0x39, 0x35, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x20, 0x30, 0x20, 0x39, 0x37, 0x39, 0x20, 0x32, 0x20, 0x38, 0x38, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x50, 0x72, 0x6f, 0x62, 
-0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 0x35, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x20, 0x30, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 0x31, 0x2e, 0x35, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x20, 0x31, 0x30, 0x30, 0x36, 0x20, 0x32, 0x20, 0x32, 
-0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x74, 
-0x65, 0x72, 0x63, 0x65, 0x70, 0x74, 0x6f, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 
-0x0a, 0x37, 0x2e, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x35, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x32, 0x20, 0x33, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x37, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x36, 
-0x0d, 0x0a, 0x22, 0x48, 0x61, 0x74, 0x63, 0x68, 0x65, 0x72, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x36, 0x20, 0x31, 0x31, 0x35, 0x32, 0x20, 0x31, 0x20, 0x31, 0x36, 0x30, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x43, 0x72, 0x65, 
-0x65, 0x70, 0x54, 0x75, 0x6d, 0x6f, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x31, 0x37, 0x33, 0x33, 0x20, 0x31, 0x20, 0x32, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x35, 0x34, 0x20, 0x31, 0x20, 
-0x34, 0x38, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x70, 
-0x61, 0x77, 0x6e, 0x69, 0x6e, 0x67, 0x50, 0x6f, 0x6f, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 
-0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x35, 0x35, 0x20, 0x31, 0x20, 0x31, 0x30, 0x34, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x36, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x30, 0x0d, 0x0a, 0x22, 0x45, 0x76, 0x6f, 0x6c, 
-0x75, 0x74, 0x69, 0x6f, 0x6e, 0x43, 0x68, 0x61, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x35, 0x36, 0x20, 0x31, 0x20, 0x35, 0x36, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 
-0x36, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x48, 0x79, 0x64, 
-0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x44, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x35, 0x37, 0x20, 0x31, 0x20, 0x36, 0x34, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x53, 0x70, 0x69, 
-0x72, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x30, 0x0d, 0x0a, 
-0x32, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x31, 0x35, 0x38, 0x20, 0x31, 0x20, 0x31, 0x36, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x55, 0x6c, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 
-0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x30, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x31, 0x35, 0x39, 0x20, 0x31, 0x20, 0x31, 0x30, 0x34, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 0x31, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 
-0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x50, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x36, 0x30, 0x20, 0x31, 0x20, 0x38, 0x30, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x4e, 0x79, 0x64, 
-0x75, 0x73, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x36, 0x31, 0x20, 0x31, 0x20, 0x38, 0x30, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x42, 0x61, 0x6e, 
-0x65, 0x6c, 0x69, 0x6e, 0x67, 0x4e, 0x65, 0x73, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 
-0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x36, 0x32, 0x20, 0x31, 0x20, 0x39, 0x36, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x39, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x37, 0x0d, 0x0a, 0x22, 0x52, 0x6f, 0x61, 0x63, 0x68, 
-0x57, 0x61, 0x72, 0x72, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x31, 0x31, 0x36, 0x35, 0x20, 0x31, 0x20, 0x38, 0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x39, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x70, 0x69, 0x6e, 0x65, 0x43, 0x72, 0x61, 0x77, 
-0x6c, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x32, 0x20, 0x35, 0x0d, 0x0a, 0x31, 0x20, 0x37, 0x20, 0x31, 0x2e, 0x38, 0x35, 0x30, 0x31, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x36, 0x36, 0x20, 0x31, 0x20, 0x38, 
-0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x38, 0x39, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x53, 
-0x70, 0x6f, 0x72, 0x65, 0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x32, 0x20, 0x31, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x31, 0x35, 0x0d, 0x0a, 0x31, 
-0x20, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x36, 0x30, 0x38, 0x34, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x31, 0x36, 0x37, 0x20, 0x31, 0x20, 0x34, 0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x39, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x4c, 0x61, 0x69, 0x72, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x36, 0x20, 0x31, 0x32, 0x31, 0x36, 0x20, 
-0x31, 0x20, 0x31, 0x32, 0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x31, 0x0d, 
-0x0a, 0x38, 0x36, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x39, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x48, 0x69, 0x76, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x37, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x36, 0x20, 0x31, 0x32, 0x31, 0x38, 0x20, 0x31, 0x20, 0x31, 
-0x36, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x32, 0x20, 0x32, 0x0d, 0x0a, 0x38, 0x36, 
-0x20, 0x31, 0x30, 0x30, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x39, 0x34, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x47, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x53, 
-0x70, 0x69, 0x72, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x35, 0x30, 
-0x0d, 0x0a, 0x33, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x31, 0x32, 0x32, 0x30, 0x20, 0x31, 0x20, 0x31, 0x36, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 0x39, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 0x31, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x45, 0x67, 0x67, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x44, 0x72, 0x6f, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 
-0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 
-0x2e, 0x31, 0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 0x31, 0x2e, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x20, 0x30, 0x20, 0x31, 0x33, 0x34, 0x32, 0x20, 0x31, 0x20, 0x32, 0x37, 0x32, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x67, 0x6c, 0x69, 0x6e, 
-0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x39, 0x35, 0x33, 0x31, 
-0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 0x30, 0x2e, 
-0x36, 0x39, 0x36, 0x30, 0x34, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x20, 
-0x31, 0x33, 0x34, 0x33, 0x20, 0x31, 0x20, 0x33, 0x38, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x39, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x4f, 0x76, 0x65, 0x72, 0x6c, 0x6f, 0x72, 0x64, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x2e, 0x36, 0x34, 0x34, 0x35, 0x33, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x20, 0x31, 
-0x33, 0x34, 0x34, 0x20, 0x31, 0x20, 0x34, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x48, 0x79, 0x64, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x31, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x20, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x32, 0x34, 0x39, 0x35, 0x31, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x33, 0x34, 0x35, 0x20, 0x31, 0x20, 0x35, 0x32, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 0x31, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x4d, 0x75, 0x74, 0x61, 
-0x6c, 0x69, 0x73, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 
-0x34, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x39, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x31, 0x2e, 0x35, 0x32, 0x34, 0x36, 0x36, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x33, 0x34, 0x36, 0x20, 0x31, 0x20, 0x35, 0x32, 0x38, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 
-0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x55, 0x6c, 
-0x74, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x0d, 0x0a, 
-0x33, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 
-0x20, 0x37, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x39, 0x35, 0x33, 0x31, 0x32, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x20, 0x31, 0x20, 0x30, 0x2e, 0x38, 0x36, 0x30, 0x31, 0x30, 0x37, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 
-0x20, 0x30, 0x20, 0x31, 0x33, 0x34, 0x38, 0x20, 0x31, 0x20, 0x38, 0x38, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 0x33, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x52, 0x6f, 0x61, 0x63, 0x68, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x35, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x36, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x20, 0x34, 0x20, 0x32, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x33, 0x35, 
-0x31, 0x20, 0x31, 0x20, 0x34, 0x33, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 0x37, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 
-0x31, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x33, 0x35, 0x32, 
-0x20, 0x31, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 0x34, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 
-0x32, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x6f, 0x72, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x33, 0x2e, 0x33, 0x37, 0x35, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x31, 0x34, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x37, 
-0x20, 0x36, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x38, 0x39, 0x39, 0x39, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x33, 0x35, 0x33, 0x20, 0x31, 0x20, 0x36, 0x34, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 
-0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x42, 0x72, 
-0x6f, 0x6f, 0x64, 0x4c, 0x6f, 0x72, 0x64, 0x43, 0x6f, 0x63, 0x6f, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x33, 0x20, 0x37, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x34, 0x30, 0x36, 0x32, 0x35, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x42, 
-0x72, 0x6f, 0x6f, 0x64, 0x4c, 0x6f, 0x72, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 
-0x33, 0x20, 0x37, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x34, 0x30, 0x36, 0x32, 0x35, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x32, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x20, 0x31, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x20, 0x30, 0x20, 
-0x31, 0x33, 0x37, 0x32, 0x20, 0x31, 0x20, 0x35, 0x34, 0x31, 0x2e, 0x33, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x32, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 0x32, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x42, 0x61, 0x6e, 
-0x65, 0x6c, 0x69, 0x6e, 0x67, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x2e, 0x35, 0x20, 0x30, 0x20, 0x31, 0x33, 0x37, 0x34, 0x20, 0x31, 0x20, 0x31, 0x38, 0x2e, 
-0x39, 0x36, 0x32, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x36, 0x0d, 0x0a, 0x22, 
-0x44, 0x72, 0x6f, 0x6e, 0x65, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x20, 0x30, 0x20, 0x31, 0x33, 0x37, 0x38, 0x20, 0x31, 0x20, 0x32, 0x33, 0x2e, 0x33, 
-0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x34, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x30, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x37, 0x0d, 0x0a, 
-0x22, 0x48, 0x79, 0x64, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 
-0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 
-0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x33, 0x38, 0x32, 
-0x20, 0x31, 0x20, 0x32, 0x34, 0x2e, 0x32, 0x39, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x35, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x37, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x52, 0x6f, 0x61, 0x63, 0x68, 0x42, 0x75, 0x72, 0x72, 
-0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 
-0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x33, 0x38, 
-0x36, 0x20, 0x31, 0x20, 0x39, 0x2e, 0x36, 0x39, 0x31, 0x34, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x67, 0x6c, 0x69, 0x6e, 
-0x67, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x2e, 0x35, 
-0x20, 0x30, 0x20, 0x31, 0x33, 0x39, 0x30, 0x20, 0x31, 0x20, 0x32, 0x34, 0x2e, 0x32, 0x39, 0x31, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x34, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x35, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 
-0x66, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x42, 0x75, 0x72, 0x72, 
-0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x33, 0x39, 0x34, 0x20, 
-0x31, 0x20, 0x32, 0x34, 0x2e, 0x32, 0x39, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x34, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 
-0x31, 0x0d, 0x0a, 0x22, 0x52, 0x65, 0x64, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x4c, 0x61, 0x76, 0x61, 
-0x43, 0x72, 0x69, 0x74, 0x74, 0x65, 0x72, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x33, 0x39, 0x38, 0x20, 0x33, 0x20, 0x32, 0x34, 0x2e, 0x32, 0x38, 
-0x39, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x52, 0x65, 
-0x64, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x4c, 0x61, 0x76, 0x61, 0x43, 0x72, 0x69, 0x74, 0x74, 0x65, 
-0x72, 0x49, 0x6e, 0x6a, 0x75, 0x72, 0x65, 0x64, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x34, 0x30, 0x30, 0x20, 0x33, 0x20, 0x32, 0x34, 0x2e, 0x32, 
-0x38, 0x39, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x52, 
-0x65, 0x64, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x4c, 0x61, 0x76, 0x61, 0x43, 0x72, 0x69, 0x74, 0x74, 
-0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x34, 0x30, 0x32, 0x20, 0x33, 0x20, 0x32, 0x35, 
-0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x34, 0x0d, 0x0a, 
-0x22, 0x52, 0x65, 0x64, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x4c, 0x61, 0x76, 0x61, 0x43, 0x72, 0x69, 
-0x74, 0x74, 0x65, 0x72, 0x49, 0x6e, 0x6a, 0x75, 0x72, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x31, 0x34, 0x30, 0x34, 0x20, 0x33, 0x20, 0x32, 0x35, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x51, 0x75, 0x65, 0x65, 0x6e, 0x42, 
-0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x33, 0x20, 0x36, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 
-0x31, 0x34, 0x33, 0x33, 0x20, 0x31, 0x20, 0x31, 0x35, 0x2e, 0x33, 0x33, 0x32, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x35, 0x20, 0x31, 0x0d, 0x0a, 0x31, 0x32, 0x36, 0x20, 0x0d, 0x0a, 0x31, 0x32, 0x36, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x51, 
-0x75, 0x65, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x35, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x33, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x30, 0x2e, 
-0x39, 0x33, 0x37, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x39, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x38, 0x20, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x34, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x35, 0x20, 0x31, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x20, 0x30, 0x20, 0x31, 0x36, 0x33, 0x32, 0x20, 0x31, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x39, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 
-0x74, 0x6f, 0x72, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x32, 0x20, 0x33, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x34, 0x34, 0x34, 0x20, 0x31, 0x20, 0x31, 
-0x30, 0x2e, 0x39, 0x36, 0x32, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x32, 0x38, 0x0d, 0x0a, 0x22, 0x4f, 0x76, 0x65, 0x72, 0x6c, 0x6f, 0x72, 0x64, 0x43, 0x6f, 0x63, 
-0x6f, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 
-0x37, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x20, 
-0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x39, 0x0d, 0x0a, 
-0x22, 0x4f, 0x76, 0x65, 0x72, 0x73, 0x65, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x33, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 0x37, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x20, 0x31, 0x34, 0x34, 0x38, 0x20, 0x31, 0x20, 0x32, 0x36, 
-0x36, 0x2e, 0x36, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x31, 0x0d, 0x0a, 0x31, 
-0x30, 0x36, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x50, 0x6c, 0x61, 0x6e, 0x65, 0x74, 0x61, 0x72, 0x79, 
-0x46, 0x6f, 0x72, 0x74, 0x72, 0x65, 0x73, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x35, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 
-0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 
-0x20, 0x34, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x32, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x35, 0x20, 0x31, 0x34, 0x35, 0x30, 0x20, 0x30, 0x20, 0x38, 
-0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x31, 0x0d, 0x0a, 0x31, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x20, 0x32, 0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x31, 
-0x0d, 0x0a, 0x22, 0x55, 0x6c, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x42, 0x75, 0x72, 0x72, 
-0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x30, 0x30, 
-0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x37, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x20, 0x30, 
-0x20, 0x31, 0x35, 0x31, 0x32, 0x20, 0x31, 0x20, 0x33, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x35, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x4f, 0x72, 0x62, 0x69, 0x74, 0x61, 0x6c, 0x43, 
-0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 
-0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 
-0x35, 0x20, 0x31, 0x35, 0x31, 0x36, 0x20, 0x30, 0x20, 0x35, 0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x31, 0x31, 0x20, 0x31, 0x0d, 0x0a, 0x31, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x32, 0x31, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x33, 0x0d, 0x0a, 0x22, 0x57, 0x61, 0x72, 
-0x70, 0x47, 0x61, 0x74, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x35, 
-0x31, 0x38, 0x20, 0x32, 0x20, 0x31, 0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x31, 
-0x0d, 0x0a, 0x36, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x4f, 0x72, 0x62, 0x69, 0x74, 0x61, 0x6c, 0x43, 0x6f, 
-0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x46, 0x6c, 0x79, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x2e, 0x39, 0x33, 0x37, 0x35, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x35, 0x20, 0x31, 0x35, 0x32, 0x32, 
-0x20, 0x30, 0x20, 0x33, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x31, 0x0d, 0x0a, 
-0x31, 0x38, 0x20, 0x0d, 0x0a, 0x31, 0x33, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x46, 0x6f, 0x72, 0x63, 0x65, 0x46, 0x69, 0x65, 0x6c, 
-0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x33, 0x36, 0x0d, 0x0a, 0x22, 0x57, 0x61, 0x72, 0x70, 0x50, 0x72, 0x69, 0x73, 0x6d, 0x50, 0x68, 
-0x61, 0x73, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x30, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x36, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 
-0x31, 0x35, 0x32, 0x38, 0x20, 0x32, 0x20, 0x32, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 
-0x20, 0x31, 0x0d, 0x0a, 0x38, 0x31, 0x20, 0x0d, 0x0a, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x43, 0x72, 0x65, 0x65, 0x70, 0x54, 
-0x75, 0x6d, 0x6f, 0x72, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 
-0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x36, 0x36, 0x32, 0x20, 0x31, 0x20, 0x31, 0x38, 0x2e, 0x39, 
-0x36, 0x30, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x31, 0x0d, 0x0a, 0x38, 0x37, 
-0x20, 0x0d, 0x0a, 0x38, 0x37, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 
-0x38, 0x0d, 0x0a, 0x22, 0x43, 0x72, 0x65, 0x65, 0x70, 0x54, 0x75, 0x6d, 0x6f, 0x72, 0x51, 0x75, 
-0x65, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x36, 0x39, 0x34, 
-0x20, 0x31, 0x20, 0x32, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x31, 0x0d, 
-0x0a, 0x38, 0x37, 0x20, 0x0d, 0x0a, 0x38, 0x37, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x70, 0x69, 0x6e, 0x65, 0x43, 0x72, 0x61, 0x77, 
-0x6c, 0x65, 0x72, 0x55, 0x70, 0x72, 0x6f, 0x6f, 0x74, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 
-0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x37, 0x32, 0x35, 0x20, 0x31, 0x20, 0x31, 0x36, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x70, 0x6f, 
-0x72, 0x65, 0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x55, 0x70, 0x72, 0x6f, 0x6f, 0x74, 0x65, 
-0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x37, 0x32, 0x37, 
-0x20, 0x31, 0x20, 0x31, 0x36, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x39, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x31, 
-0x0d, 0x0a, 0x22, 0x41, 0x72, 0x63, 0x68, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 
-0x0d, 0x0a, 0x31, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x36, 
-0x20, 0x37, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x33, 0x20, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x31, 0x30, 
-0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x31, 0x2e, 0x37, 0x35, 0x33, 0x39, 0x31, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x4e, 0x79, 0x64, 0x75, 0x73, 0x43, 0x61, 0x6e, 0x61, 0x6c, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x37, 0x36, 0x38, 0x20, 
-0x31, 0x20, 0x33, 0x32, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x39, 0x35, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x33, 
-0x0d, 0x0a, 0x22, 0x42, 0x72, 0x6f, 0x6f, 0x64, 0x6c, 0x69, 0x6e, 0x67, 0x45, 0x73, 0x63, 0x6f, 
-0x72, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x36, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x37, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x47, 0x68, 0x6f, 0x73, 0x74, 0x41, 
-0x6c, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x74, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x33, 0x20, 
-0x36, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x33, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x30, 0x0d, 
-0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 
-0x31, 0x38, 0x33, 0x35, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x47, 0x68, 0x6f, 0x73, 0x74, 0x4e, 0x6f, 0x76, 0x61, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x32, 0x35, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x33, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 
-0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x31, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x35, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x38, 0x33, 0x37, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x52, 0x69, 0x63, 
-0x68, 0x4d, 0x69, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 
-0x37, 0x0d, 0x0a, 0x22, 0x52, 0x69, 0x63, 0x68, 0x4d, 0x69, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x46, 
-0x69, 0x65, 0x6c, 0x64, 0x37, 0x35, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x55, 0x72, 
-0x73, 0x61, 0x64, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 
-0x67, 0x61, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 
-0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x73, 0x45, 0x67, 0x67, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x4c, 0x61, 0x72, 0x76, 0x61, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 
-0x20, 0x0d, 0x0a, 0x30, 0x2e, 0x35, 0x36, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x52, 0x65, 0x61, 0x70, 0x65, 0x72, 0x50, 
-0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x33, 0x0d, 0x0a, 0x22, 
-0x4d, 0x61, 0x72, 0x69, 0x6e, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 
-0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x46, 0x69, 0x72, 0x65, 0x62, 
-0x61, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x4d, 0x65, 0x64, 0x69, 0x63, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x36, 0x0d, 0x0a, 
-0x22, 0x4d, 0x61, 0x72, 0x61, 0x75, 0x64, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x56, 0x75, 
-0x6c, 0x74, 0x75, 0x72, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 
-0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x69, 0x65, 0x67, 0x65, 0x54, 
-0x61, 0x6e, 0x6b, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 
-0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x56, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x30, 
-0x0d, 0x0a, 0x22, 0x42, 0x61, 0x6e, 0x73, 0x68, 0x65, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 
-0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x31, 0x0d, 0x0a, 0x22, 0x42, 
-0x61, 0x74, 0x74, 0x6c, 0x65, 0x63, 0x72, 0x75, 0x69, 0x73, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x32, 0x0d, 0x0a, 
-0x22, 0x4f, 0x72, 0x62, 0x69, 0x74, 0x61, 0x6c, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 
-0x33, 0x0d, 0x0a, 0x22, 0x42, 0x75, 0x6e, 0x6b, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 
-0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x42, 
-0x75, 0x6e, 0x6b, 0x65, 0x72, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x64, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x35, 0x0d, 
-0x0a, 0x22, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x54, 0x75, 0x72, 0x72, 0x65, 0x74, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 
-0x36, 0x0d, 0x0a, 0x22, 0x48, 0x65, 0x6c, 0x6c, 0x62, 0x61, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x37, 0x0d, 0x0a, 0x22, 
-0x47, 0x6f, 0x6c, 0x69, 0x61, 0x74, 0x68, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 
-0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x43, 0x79, 0x63, 0x6c, 
-0x6f, 0x6e, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 
-0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x57, 0x72, 0x61, 0x69, 0x74, 0x68, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x30, 
-0x0d, 0x0a, 0x22, 0x53, 0x63, 0x69, 0x65, 0x6e, 0x63, 0x65, 0x56, 0x65, 0x73, 0x73, 0x65, 0x6c, 
-0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 
-0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x37, 0x31, 0x0d, 0x0a, 0x22, 0x48, 0x65, 0x72, 0x63, 0x75, 0x6c, 0x65, 0x73, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x32, 0x0d, 
-0x0a, 0x22, 0x54, 0x68, 0x6f, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 
-0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x50, 0x65, 0x72, 0x64, 0x69, 
-0x74, 0x69, 0x6f, 0x6e, 0x54, 0x75, 0x72, 0x72, 0x65, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 
-0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x46, 
-0x6c, 0x61, 0x6d, 0x69, 0x6e, 0x67, 0x42, 0x65, 0x74, 0x74, 0x79, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x35, 0x0d, 0x0a, 0x22, 
-0x44, 0x65, 0x76, 0x61, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x75, 0x72, 0x72, 0x65, 
-0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x42, 0x6c, 0x61, 0x73, 0x74, 0x65, 0x72, 0x42, 0x69, 0x6c, 
-0x6c, 0x79, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x53, 0x70, 0x69, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x44, 
-0x69, 0x7a, 0x7a, 0x79, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x38, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x67, 0x6c, 0x69, 0x6e, 
-0x67, 0x4b, 0x65, 0x72, 0x72, 0x69, 0x67, 0x61, 0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x52, 0x61, 
-0x70, 0x74, 0x6f, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x51, 0x75, 0x65, 0x65, 0x6e, 0x43, 0x6f, 
-0x6f, 0x70, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x38, 0x31, 0x0d, 0x0a, 0x22, 0x48, 0x79, 0x64, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 
-0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 
-0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x38, 0x32, 0x0d, 0x0a, 0x22, 0x48, 0x79, 0x64, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x4c, 0x75, 
-0x72, 0x6b, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x4d, 0x75, 0x74, 0x61, 0x6c, 0x69, 0x73, 
-0x6b, 0x42, 0x72, 0x6f, 0x6f, 0x64, 0x6c, 0x6f, 0x72, 0x64, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 
-0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x42, 
-0x72, 0x6f, 0x6f, 0x64, 0x4c, 0x6f, 0x72, 0x64, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 
-0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x55, 0x6c, 0x74, 
-0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 
-0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x54, 0x6f, 0x72, 0x72, 0x61, 
-0x73, 0x71, 0x75, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x4f, 0x76, 0x65, 0x72, 0x73, 0x65, 0x65, 
-0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x4c, 0x75, 0x72, 0x6b, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x39, 0x0d, 0x0a, 
-0x22, 0x53, 0x70, 0x69, 0x6e, 0x65, 0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x30, 0x0d, 
-0x0a, 0x22, 0x53, 0x70, 0x6f, 0x72, 0x65, 0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x31, 
-0x0d, 0x0a, 0x22, 0x4e, 0x79, 0x64, 0x75, 0x73, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 
-0x32, 0x0d, 0x0a, 0x22, 0x4f, 0x6d, 0x65, 0x67, 0x61, 0x4e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 
-0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 
-0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x39, 0x33, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x67, 0x6c, 0x69, 0x6e, 0x67, 0x5a, 0x61, 0x67, 
-0x61, 0x72, 0x61, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 
-0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x77, 0x61, 0x72, 0x6d, 0x6c, 0x69, 0x6e, 
-0x67, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x42, 0x61, 0x6e, 0x65, 0x6c, 0x69, 0x6e, 0x67, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x36, 
-0x0d, 0x0a, 0x22, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x74, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x67, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 
-0x37, 0x0d, 0x0a, 0x22, 0x41, 0x62, 0x65, 0x72, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x38, 
-0x0d, 0x0a, 0x22, 0x53, 0x63, 0x6f, 0x75, 0x72, 0x67, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 
-0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x43, 
-0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x6f, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 
-0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x42, 0x69, 0x6c, 
-0x65, 0x4c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x77, 
-0x61, 0x72, 0x6d, 0x51, 0x75, 0x65, 0x65, 0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 
-0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x52, 0x6f, 0x61, 
-0x63, 0x68, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x52, 0x6f, 0x61, 0x63, 0x68, 0x56, 0x69, 0x6c, 0x65, 
-0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 
-0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 
-0x30, 0x34, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x61, 0x67, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x30, 0x35, 0x0d, 0x0a, 
-0x22, 0x53, 0x77, 0x61, 0x72, 0x6d, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 
-0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x4d, 
-0x75, 0x74, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 
-0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x47, 0x75, 0x61, 0x72, 
-0x64, 0x69, 0x61, 0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x32, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x76, 0x6f, 0x75, 0x72, 0x65, 
-0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x56, 0x69, 0x70, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x31, 0x30, 0x0d, 0x0a, 0x22, 
-0x42, 0x72, 0x75, 0x74, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x4c, 0x65, 
-0x76, 0x69, 0x61, 0x74, 0x68, 0x61, 0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 
-0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x61, 0x6c, 
-0x6f, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x61, 0x6c, 0x6f, 0x74, 0x41, 0x69, 0x75, 
-0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x44, 0x72, 0x61, 0x67, 0x6f, 0x6f, 0x6e, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x31, 0x35, 0x0d, 
-0x0a, 0x22, 0x48, 0x69, 0x67, 0x68, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x72, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x31, 0x36, 0x0d, 
-0x0a, 0x22, 0x41, 0x72, 0x63, 0x68, 0x6f, 0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 
-0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x31, 0x37, 0x0d, 0x0a, 0x22, 0x49, 0x6d, 0x6d, 
-0x6f, 0x72, 0x74, 0x61, 0x6c, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 
-0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x76, 
-0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x50, 0x68, 0x6f, 0x65, 0x6e, 0x69, 0x78, 0x41, 0x69, 
-0x75, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x52, 0x65, 0x61, 0x76, 0x65, 0x72, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x32, 0x31, 0x0d, 
-0x0a, 0x22, 0x54, 0x65, 0x6d, 0x70, 0x65, 0x73, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x50, 0x68, 
-0x6f, 0x74, 0x6f, 0x6e, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 
-0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x5a, 
-0x65, 0x61, 0x6c, 0x6f, 0x74, 0x56, 0x6f, 0x72, 0x61, 0x7a, 0x75, 0x6e, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x32, 0x34, 0x0d, 0x0a, 
-0x22, 0x5a, 0x65, 0x61, 0x6c, 0x6f, 0x74, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x32, 
-0x35, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x61, 0x6c, 0x6b, 0x65, 0x72, 0x53, 0x68, 0x61, 0x6b, 0x75, 
-0x72, 0x61, 0x73, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 
-0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x61, 0x72, 0x6b, 0x54, 0x65, 0x6d, 0x70, 
-0x6c, 0x61, 0x72, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x32, 0x37, 0x0d, 0x0a, 0x22, 
-0x43, 0x6f, 0x72, 0x73, 0x61, 0x69, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 
-0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x56, 0x6f, 0x69, 0x64, 
-0x52, 0x61, 0x79, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 
-0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x56, 0x6f, 0x69, 0x64, 0x52, 0x61, 0x79, 0x53, 
-0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 
-0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x4f, 0x72, 0x61, 0x63, 
-0x6c, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x44, 0x61, 0x72, 0x6b, 0x41, 0x72, 0x63, 0x68, 0x6f, 
-0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x44, 0x61, 0x72, 0x6b, 0x50, 0x79, 0x6c, 0x6f, 0x6e, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x33, 
-0x33, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x61, 0x6c, 0x6f, 0x74, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 
-0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x50, 0x75, 0x72, 
-0x69, 0x66, 0x69, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 
-0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x49, 0x6d, 0x6d, 0x6f, 0x72, 0x74, 
-0x61, 0x6c, 0x4b, 0x61, 0x72, 0x61, 0x78, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 
-0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6f, 
-0x73, 0x73, 0x75, 0x73, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x32, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6f, 0x73, 0x73, 0x75, 
-0x73, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x68, 
-0x6f, 0x65, 0x6e, 0x69, 0x78, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 0x65, 0x72, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x33, 0x39, 0x0d, 
-0x0a, 0x22, 0x43, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x43, 0x61, 
-0x72, 0x72, 0x69, 0x65, 0x72, 0x41, 0x69, 0x75, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x4b, 0x68, 
-0x61, 0x79, 0x64, 0x61, 0x72, 0x69, 0x6e, 0x4d, 0x6f, 0x6e, 0x6f, 0x6c, 0x69, 0x74, 0x68, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x34, 
-0x32, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x69, 0x65, 0x6c, 0x64, 0x42, 0x61, 0x74, 0x74, 0x65, 0x72, 
-0x79, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x45, 0x6c, 0x69, 0x74, 0x65, 0x4d, 0x61, 0x72, 0x69, 0x6e, 
-0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x4d, 0x61, 0x72, 0x61, 0x75, 0x64, 0x65, 0x72, 0x43, 0x6f, 
-0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x6f, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 
-0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x70, 0x65, 0x63, 0x4f, 
-0x70, 0x73, 0x47, 0x68, 0x6f, 0x73, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 
-0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x48, 0x65, 0x6c, 0x6c, 
-0x62, 0x61, 0x74, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x53, 0x74, 
-0x72, 0x69, 0x6b, 0x65, 0x47, 0x6f, 0x6c, 0x69, 0x61, 0x74, 0x68, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x34, 0x38, 0x0d, 0x0a, 0x22, 
-0x48, 0x65, 0x61, 0x76, 0x79, 0x53, 0x69, 0x65, 0x67, 0x65, 0x54, 0x61, 0x6e, 0x6b, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x34, 0x39, 
-0x0d, 0x0a, 0x22, 0x52, 0x61, 0x69, 0x64, 0x4c, 0x69, 0x62, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 
-0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 
-0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 
-0x35, 0x30, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x65, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x49, 0x49, 
-0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 
-0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 
-0x35, 0x31, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x76, 0x65, 0x72, 0x74, 0x42, 0x61, 0x6e, 0x73, 0x68, 
-0x65, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x69, 0x6c, 0x67, 0x75, 0x6e, 0x54, 0x75, 
-0x72, 0x72, 0x65, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x32, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x4f, 0x70, 
-0x73, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x54, 0x75, 0x72, 0x72, 0x65, 0x74, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x35, 0x34, 
-0x0d, 0x0a, 0x22, 0x53, 0x75, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x35, 0x35, 0x0d, 
-0x0a, 0x22, 0x53, 0x74, 0x61, 0x6c, 0x6b, 0x65, 0x72, 0x54, 0x61, 0x6c, 0x64, 0x61, 0x72, 0x69, 
-0x6d, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x54, 0x61, 0x6c, 0x64, 
-0x61, 0x72, 0x69, 0x6d, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x32, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x48, 0x69, 0x67, 0x68, 0x54, 0x65, 0x6d, 
-0x70, 0x6c, 0x61, 0x72, 0x54, 0x61, 0x6c, 0x64, 0x61, 0x72, 0x69, 0x6d, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x35, 0x38, 0x0d, 0x0a, 
-0x22, 0x49, 0x6d, 0x6d, 0x6f, 0x72, 0x74, 0x61, 0x6c, 0x54, 0x61, 0x6c, 0x64, 0x61, 0x72, 0x69, 
-0x6d, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6f, 0x73, 0x73, 0x75, 0x73, 0x54, 0x61, 
-0x6c, 0x64, 0x61, 0x72, 0x69, 0x6d, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 
-0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x57, 0x61, 0x72, 0x70, 0x50, 
-0x72, 0x69, 0x73, 0x6d, 0x54, 0x61, 0x6c, 0x64, 0x61, 0x72, 0x69, 0x6d, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x36, 0x31, 0x0d, 0x0a, 
-0x22, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x6e, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x54, 0x61, 0x6c, 
-0x64, 0x61, 0x72, 0x69, 0x6d, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 
-0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x4e, 0x65, 0x65, 0x64, 0x6c, 0x65, 
-0x53, 0x70, 0x69, 0x6e, 0x65, 0x73, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x36, 0x33, 0x0d, 0x0a, 0x22, 
-0x43, 0x6f, 0x72, 0x72, 0x75, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x36, 
-0x34, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x54, 0x65, 0x72, 0x72, 
-0x61, 0x6e, 0x73, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x4e, 0x65, 0x75, 
-0x72, 0x61, 0x6c, 0x50, 0x61, 0x72, 0x61, 0x73, 0x69, 0x74, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 
-0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 
-0x36, 0x36, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x65, 0x6e, 0x73, 
-0x65, 0x44, 0x72, 0x6f, 0x6e, 0x65, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x57, 0x65, 0x61, 
-0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x48, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x53, 0x65, 0x65, 
-0x6b, 0x65, 0x72, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x4d, 0x55, 0x4c, 
-0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 0x35, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x54, 
-0x68, 0x6f, 0x72, 0x41, 0x41, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x50, 
-0x75, 0x6e, 0x69, 0x73, 0x68, 0x65, 0x72, 0x47, 0x72, 0x65, 0x6e, 0x61, 0x64, 0x65, 0x73, 0x4c, 
-0x4d, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x56, 0x69, 0x6b, 0x69, 0x6e, 
-0x67, 0x46, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x37, 0x32, 0x0d, 
-0x0a, 0x22, 0x41, 0x54, 0x41, 0x4c, 0x61, 0x73, 0x65, 0x72, 0x42, 0x61, 0x74, 0x74, 0x65, 0x72, 
-0x79, 0x4c, 0x4d, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x41, 0x54, 0x53, 
-0x4c, 0x61, 0x73, 0x65, 0x72, 0x42, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x4c, 0x4d, 0x57, 0x65, 
-0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x4c, 0x6f, 0x6e, 0x67, 0x62, 0x6f, 0x6c, 0x74, 
-0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x37, 0x35, 0x0d, 0x0a, 
-0x22, 0x44, 0x38, 0x43, 0x68, 0x61, 0x72, 0x67, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x37, 0x36, 
-0x0d, 0x0a, 0x22, 0x59, 0x61, 0x6d, 0x61, 0x74, 0x6f, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x37, 0x37, 
-0x0d, 0x0a, 0x22, 0x49, 0x6f, 0x6e, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x73, 0x57, 0x65, 0x61, 
-0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x37, 0x38, 0x0d, 0x0a, 0x22, 0x41, 0x63, 0x69, 0x64, 0x53, 0x61, 0x6c, 0x69, 0x76, 
-0x61, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x70, 0x69, 0x6e, 0x65, 
-0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x38, 0x30, 0x0d, 0x0a, 
-0x22, 0x53, 0x70, 0x6f, 0x72, 0x65, 0x43, 0x72, 0x61, 0x77, 0x6c, 0x65, 0x72, 0x57, 0x65, 0x61, 
-0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x38, 0x31, 0x0d, 0x0a, 0x22, 0x47, 0x6c, 0x61, 0x69, 0x76, 0x65, 0x57, 0x75, 0x72, 
-0x6d, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x47, 0x6c, 0x61, 0x69, 0x76, 
-0x65, 0x57, 0x75, 0x72, 0x6d, 0x4d, 0x32, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x38, 0x33, 0x0d, 0x0a, 
-0x22, 0x47, 0x6c, 0x61, 0x69, 0x76, 0x65, 0x57, 0x75, 0x72, 0x6d, 0x4d, 0x33, 0x57, 0x65, 0x61, 
-0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x61, 0x6c, 0x6b, 0x65, 0x72, 0x57, 0x65, 
-0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x45, 0x4d, 0x50, 0x32, 0x57, 0x65, 0x61, 0x70, 
-0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x32, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x42, 0x61, 0x63, 0x6b, 0x6c, 0x61, 0x73, 0x68, 0x52, 0x6f, 
-0x63, 0x6b, 0x65, 0x74, 0x73, 0x4c, 0x4d, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x38, 0x37, 0x0d, 0x0a, 
-0x22, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x6e, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x57, 0x65, 0x61, 
-0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x32, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x61, 0x72, 0x61, 0x73, 0x69, 0x74, 0x65, 0x53, 
-0x70, 0x6f, 0x72, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x42, 0x72, 
-0x6f, 0x6f, 0x64, 0x6c, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x33, 
-0x2e, 0x38, 0x33, 0x35, 0x39, 0x34, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 
-0x34, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x2e, 0x31, 0x30, 0x30, 0x30, 
-0x39, 0x38, 0x20, 0x30, 0x2e, 0x36, 0x34, 0x35, 0x35, 0x30, 0x38, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x37, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x39, 
-0x30, 0x0d, 0x0a, 0x22, 0x42, 0x72, 0x6f, 0x6f, 0x64, 0x4c, 0x6f, 0x72, 0x64, 0x42, 0x57, 0x65, 
-0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x41, 0x75, 0x74, 0x6f, 0x54, 0x75, 0x72, 0x72, 
-0x65, 0x74, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x39, 0x32, 
-0x0d, 0x0a, 0x22, 0x4c, 0x61, 0x72, 0x76, 0x61, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x4d, 
-0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x41, 0x63, 0x69, 0x64, 0x53, 0x70, 
-0x69, 0x6e, 0x65, 0x73, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x46, 0x72, 
-0x65, 0x6e, 0x7a, 0x79, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 
-0x6e, 0x74, 0x61, 0x6d, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x39, 0x36, 
-0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x52, 0x61, 0x6c, 0x6c, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x39, 0x37, 0x0d, 
-0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x41, 0x72, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x39, 0x38, 0x0d, 0x0a, 0x22, 
-0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x39, 0x39, 0x0d, 0x0a, 0x22, 
-0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x44, 0x65, 0x66, 0x65, 0x6e, 0x64, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x22, 
-0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x48, 0x61, 0x72, 0x61, 0x73, 0x73, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x31, 0x0d, 0x0a, 0x22, 
-0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x49, 0x64, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x42, 0x65, 
-0x61, 0x63, 0x6f, 0x6e, 0x41, 0x75, 0x74, 0x6f, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 
-0x6f, 0x6e, 0x44, 0x65, 0x74, 0x65, 0x63, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 
-0x6f, 0x6e, 0x53, 0x63, 0x6f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 
-0x6e, 0x43, 0x6c, 0x61, 0x69, 0x6d, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 
-0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 
-0x43, 0x75, 0x73, 0x74, 0x6f, 0x6d, 0x31, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 
-0x6e, 0x43, 0x75, 0x73, 0x74, 0x6f, 0x6d, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 
-0x6f, 0x6e, 0x43, 0x75, 0x73, 0x74, 0x6f, 0x6d, 0x33, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 
-0x63, 0x6f, 0x6e, 0x43, 0x75, 0x73, 0x74, 0x6f, 0x6d, 0x34, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x41, 0x64, 
-0x65, 0x70, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 
-0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 
-0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x31, 0x20, 0x31, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x32, 0x2e, 0x32, 0x35, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x39, 0x32, 0x32, 0x20, 0x32, 0x20, 0x36, 0x37, 
-0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x37, 
-0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x52, 0x6f, 
-0x63, 0x6b, 0x73, 0x32, 0x78, 0x32, 0x4e, 0x6f, 0x6e, 0x43, 0x6f, 0x6e, 0x6a, 0x6f, 0x69, 0x6e, 
-0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x46, 0x75, 0x6e, 0x67, 0x61, 0x6c, 
-0x47, 0x72, 0x6f, 0x77, 0x74, 0x68, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x34, 0x0d, 0x0a, 
-0x22, 0x4e, 0x65, 0x75, 0x72, 0x61, 0x6c, 0x50, 0x61, 0x72, 0x61, 0x73, 0x69, 0x74, 0x65, 0x54, 
-0x65, 0x6e, 0x74, 0x61, 0x63, 0x6c, 0x65, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x35, 0x0d, 
-0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x73, 0x73, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 
-0x36, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x50, 0x72, 0x6f, 0x74, 0x6f, 
-0x73, 0x73, 0x53, 0x6d, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x37, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 
-0x6e, 0x5f, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 
-0x6f, 0x6e, 0x5f, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x53, 0x6d, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x39, 0x0d, 
-0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x5a, 0x65, 0x72, 0x67, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x30, 0x0d, 0x0a, 
-0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x5a, 0x65, 0x72, 0x67, 0x53, 0x6d, 0x61, 0x6c, 
-0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 
-0x32, 0x31, 0x0d, 0x0a, 0x22, 0x4c, 0x79, 0x6f, 0x74, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x32, 0x0d, 0x0a, 0x22, 
-0x43, 0x61, 0x72, 0x72, 0x69, 0x6f, 0x6e, 0x42, 0x69, 0x72, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x33, 0x0d, 0x0a, 
-0x22, 0x4b, 0x61, 0x72, 0x61, 0x6b, 0x4d, 0x61, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x34, 0x0d, 0x0a, 0x22, 
-0x4b, 0x61, 0x72, 0x61, 0x6b, 0x46, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x35, 0x0d, 0x0a, 
-0x22, 0x55, 0x72, 0x73, 0x61, 0x64, 0x61, 0x6b, 0x46, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x45, 0x78, 
-0x6f, 0x74, 0x69, 0x63, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x55, 0x72, 0x73, 0x61, 0x64, 0x61, 
-0x6b, 0x4d, 0x61, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x55, 0x72, 0x73, 0x61, 0x64, 
-0x61, 0x6b, 0x46, 0x65, 0x6d, 0x61, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x55, 0x72, 
-0x73, 0x61, 0x64, 0x61, 0x6b, 0x43, 0x61, 0x6c, 0x66, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x55, 
-0x72, 0x73, 0x61, 0x64, 0x61, 0x6b, 0x4d, 0x61, 0x6c, 0x65, 0x45, 0x78, 0x6f, 0x74, 0x69, 0x63, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x55, 0x74, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x42, 0x6f, 0x74, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x6f, 
-0x72, 0x42, 0x6f, 0x74, 0x31, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 
-0x6e, 0x74, 0x61, 0x74, 0x6f, 0x72, 0x42, 0x6f, 0x74, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x20, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x33, 0x33, 0x0d, 0x0a, 0x22, 
-0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x6f, 0x72, 0x42, 0x6f, 0x74, 0x33, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 
-0x33, 0x34, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x6f, 0x72, 
-0x42, 0x6f, 0x74, 0x34, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x63, 0x61, 0x6e, 0x74, 0x69, 
-0x70, 0x65, 0x64, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x6f, 0x67, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 
-0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x33, 0x37, 
-0x0d, 0x0a, 0x22, 0x53, 0x68, 0x65, 0x65, 0x70, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 
-0x77, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x54, 
-0x65, 0x72, 0x72, 0x61, 0x6e, 0x73, 0x45, 0x67, 0x67, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x6d, 0x65, 
-0x6e, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x54, 0x65, 
-0x72, 0x72, 0x61, 0x6e, 0x73, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x4d, 
-0x69, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x32, 0x0d, 
-0x0a, 0x22, 0x56, 0x65, 0x73, 0x70, 0x65, 0x6e, 0x65, 0x47, 0x65, 0x79, 0x73, 0x65, 0x72, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x53, 0x70, 0x61, 0x63, 0x65, 0x50, 0x6c, 0x61, 0x74, 0x66, 
-0x6f, 0x72, 0x6d, 0x47, 0x65, 0x79, 0x73, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x34, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x34, 0x0d, 
-0x0a, 0x22, 0x52, 0x69, 0x63, 0x68, 0x56, 0x65, 0x73, 0x70, 0x65, 0x6e, 0x65, 0x47, 0x65, 0x79, 
-0x73, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 
-0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x6c, 0x69, 0x67, 0x68, 
-0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 
-0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x75, 0x6c, 0x6c, 0x68, 0x6f, 0x72, 0x6e, 0x4c, 0x69, 0x67, 
-0x68, 0x74, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 
-0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x74, 0x72, 0x65, 0x65, 0x74, 0x6c, 0x69, 0x67, 
-0x68, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 
-0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x70, 0x61, 0x63, 0x65, 0x50, 0x6c, 0x61, 0x74, 0x66, 
-0x6f, 0x72, 0x6d, 0x53, 0x69, 0x67, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x44, 
-0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x74, 0x6f, 0x72, 0x65, 
-0x46, 0x72, 0x6f, 0x6e, 0x74, 0x43, 0x69, 0x74, 0x79, 0x50, 0x72, 0x6f, 0x70, 0x73, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 
-0x6c, 0x65, 0x42, 0x69, 0x6c, 0x6c, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x54, 0x61, 0x6c, 0x6c, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 
-0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 
-0x62, 0x6c, 0x65, 0x42, 0x69, 0x6c, 0x6c, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x53, 0x63, 0x72, 0x6f, 
-0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x54, 0x65, 0x78, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x35, 0x32, 0x0d, 0x0a, 
-0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x70, 0x61, 
-0x63, 0x65, 0x50, 0x6c, 0x61, 0x74, 0x66, 0x6f, 0x72, 0x6d, 0x42, 0x61, 0x72, 0x72, 0x69, 0x65, 
-0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x33, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 
-0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x69, 0x67, 0x6e, 0x73, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 
-0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 
-0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x69, 0x67, 0x6e, 0x73, 0x43, 0x6f, 
-0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x35, 0x35, 0x0d, 
-0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x69, 
-0x67, 0x6e, 0x73, 0x46, 0x75, 0x6e, 0x6e, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x35, 0x36, 0x0d, 0x0a, 0x22, 
-0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x69, 0x67, 0x6e, 
-0x73, 0x49, 0x63, 0x6f, 0x6e, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x69, 0x67, 0x6e, 0x73, 0x57, 
-0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x47, 0x61, 0x72, 0x61, 0x67, 0x65, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x33, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
-0x69, 0x62, 0x6c, 0x65, 0x47, 0x61, 0x72, 0x61, 0x67, 0x65, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 
-0x62, 0x6c, 0x65, 0x54, 0x72, 0x61, 0x66, 0x66, 0x69, 0x63, 0x53, 0x69, 0x67, 0x6e, 0x61, 0x6c, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x33, 0x36, 0x31, 0x0d, 0x0a, 0x22, 0x54, 0x72, 0x61, 0x66, 0x66, 0x69, 0x63, 0x53, 
-0x69, 0x67, 0x6e, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x42, 0x72, 0x61, 0x78, 0x69, 
-0x73, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 
-0x6c, 0x65, 0x31, 0x78, 0x31, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x42, 0x72, 0x61, 
-0x78, 0x69, 0x73, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
-0x69, 0x62, 0x6c, 0x65, 0x32, 0x78, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x44, 
-0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x44, 0x65, 0x62, 0x72, 0x69, 
-0x73, 0x34, 0x78, 0x34, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x36, 0x78, 
-0x36, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 
-0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x32, 0x78, 0x34, 0x56, 0x65, 0x72, 0x74, 
-0x69, 0x63, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x32, 0x78, 0x34, 0x48, 
-0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x38, 0x0d, 0x0a, 
-0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 
-0x6b, 0x32, 0x78, 0x36, 0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 
-0x39, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 
-0x52, 0x6f, 0x63, 0x6b, 0x32, 0x78, 0x36, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 
-0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 
-0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x34, 0x78, 0x34, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 
-0x31, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 
-0x52, 0x6f, 0x63, 0x6b, 0x36, 0x78, 0x36, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x44, 
-0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x44, 
-0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x55, 0x4c, 0x42, 0x52, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 
-0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x48, 
-0x75, 0x67, 0x65, 0x42, 0x4c, 0x55, 0x52, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x44, 
-0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x56, 
-0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x35, 
-0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 
-0x61, 0x6d, 0x70, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x48, 0x75, 0x67, 
-0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 
-0x74, 0x69, 0x62, 0x6c, 0x65, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x52, 0x61, 0x6d, 0x70, 0x44, 
-0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x55, 0x4c, 0x42, 0x52, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 
-0x62, 0x6c, 0x65, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x52, 0x61, 0x6d, 0x70, 0x44, 0x69, 0x61, 
-0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x42, 0x4c, 0x55, 0x52, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 
-0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 
-0x37, 0x38, 0x0d, 0x0a, 0x22, 0x4f, 0x76, 0x65, 0x72, 0x6c, 0x6f, 0x72, 0x64, 0x47, 0x65, 0x6e, 
-0x65, 0x72, 0x61, 0x74, 0x65, 0x43, 0x72, 0x65, 0x65, 0x70, 0x4b, 0x65, 0x79, 0x62, 0x69, 0x6e, 
-0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 
-0x37, 0x39, 0x0d, 0x0a, 0x22, 0x4d, 0x65, 0x6e, 0x67, 0x73, 0x6b, 0x53, 0x74, 0x61, 0x74, 0x75, 
-0x65, 0x41, 0x6c, 0x6f, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x4d, 0x65, 
-0x6e, 0x67, 0x73, 0x6b, 0x53, 0x74, 0x61, 0x74, 0x75, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x38, 0x31, 0x0d, 
-0x0a, 0x22, 0x57, 0x6f, 0x6c, 0x66, 0x53, 0x74, 0x61, 0x74, 0x75, 0x65, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x38, 
-0x32, 0x0d, 0x0a, 0x22, 0x47, 0x6c, 0x6f, 0x62, 0x65, 0x53, 0x74, 0x61, 0x74, 0x75, 0x65, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x38, 0x34, 0x0d, 0x0a, 
-0x22, 0x47, 0x6c, 0x61, 0x69, 0x76, 0x65, 0x57, 0x75, 0x72, 0x6d, 0x42, 0x6f, 0x75, 0x6e, 0x63, 
-0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x42, 0x72, 0x6f, 0x6f, 0x64, 
-0x4c, 0x6f, 0x72, 0x64, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x42, 0x72, 
-0x6f, 0x6f, 0x64, 0x4c, 0x6f, 0x72, 0x64, 0x41, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x38, 0x37, 0x0d, 
-0x0a, 0x22, 0x43, 0x72, 0x65, 0x65, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x31, 0x78, 
-0x31, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 
-0x38, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x65, 0x72, 0x6d, 0x61, 0x6e, 0x65, 0x6e, 0x74, 0x43, 0x72, 
-0x65, 0x65, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x31, 0x78, 0x31, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x38, 0x39, 0x0d, 0x0a, 
-0x22, 0x50, 0x61, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x31, 
-0x78, 0x31, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x39, 0x30, 0x0d, 0x0a, 0x22, 0x50, 0x61, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x42, 0x6c, 0x6f, 
-0x63, 0x6b, 0x65, 0x72, 0x32, 0x78, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x41, 0x75, 0x74, 0x6f, 0x54, 
-0x65, 0x73, 0x74, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x47, 
-0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x30, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x0d, 
-0x0a, 0x32, 0x2e, 0x30, 0x38, 0x35, 0x39, 0x34, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x37, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x41, 0x75, 0x74, 0x6f, 0x54, 0x65, 0x73, 0x74, 0x41, 
-0x74, 0x74, 0x61, 0x63, 0x6b, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x41, 0x69, 0x72, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x35, 0x20, 0x0d, 0x0a, 0x33, 0x2e, 0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x41, 0x75, 0x74, 0x6f, 0x54, 
-0x65, 0x73, 0x74, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 
-0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x48, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x45, 0x6d, 0x69, 
-0x74, 0x74, 0x65, 0x72, 0x53, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x41, 0x72, 0x72, 
-0x6f, 0x77, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x4d, 0x75, 0x6c, 0x74, 0x69, 0x4b, 0x69, 0x6c, 0x6c, 0x4f, 
-0x62, 0x6a, 0x65, 0x63, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x33, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x47, 0x6f, 
-0x6c, 0x66, 0x62, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x39, 0x37, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x43, 
-0x6f, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x43, 0x75, 0x62, 0x65, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x39, 
-0x39, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x43, 0x79, 0x6c, 0x69, 0x6e, 0x64, 0x65, 
-0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 
-0x30, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x44, 0x6f, 0x64, 0x65, 0x63, 0x61, 
-0x68, 0x65, 0x64, 0x72, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x49, 
-0x63, 0x6f, 0x73, 0x61, 0x68, 0x65, 0x64, 0x72, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x53, 0x68, 
-0x61, 0x70, 0x65, 0x4f, 0x63, 0x74, 0x61, 0x68, 0x65, 0x64, 0x72, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x30, 0x33, 0x0d, 0x0a, 
-0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x50, 0x79, 0x72, 0x61, 0x6d, 0x69, 0x64, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x30, 0x34, 0x0d, 0x0a, 
-0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x52, 0x6f, 0x75, 0x6e, 0x64, 0x65, 0x64, 0x43, 0x75, 0x62, 
-0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 
-0x30, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x53, 0x70, 0x68, 0x65, 0x72, 0x65, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x30, 
-0x36, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x54, 0x65, 0x74, 0x72, 0x61, 0x68, 0x65, 
-0x64, 0x72, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x34, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x54, 0x68, 0x69, 
-0x63, 0x6b, 0x54, 0x6f, 0x72, 0x75, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 
-0x54, 0x68, 0x69, 0x6e, 0x54, 0x6f, 0x72, 0x75, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 
-0x70, 0x65, 0x54, 0x6f, 0x72, 0x75, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 
-0x34, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x68, 
-0x61, 0x70, 0x65, 0x35, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x72, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x31, 0x32, 0x0d, 0x0a, 
-0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x36, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x53, 0x74, 0x61, 0x72, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x31, 
-0x33, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x38, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x53, 
-0x74, 0x61, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x34, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x41, 0x72, 0x72, 0x6f, 
-0x77, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 
-0x65, 0x42, 0x6f, 0x77, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x34, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x42, 0x6f, 
-0x78, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 
-0x31, 0x37, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x43, 0x61, 0x70, 0x73, 0x75, 0x6c, 
-0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 
-0x31, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x43, 0x72, 0x65, 0x73, 0x63, 0x65, 
-0x6e, 0x74, 0x4d, 0x6f, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x44, 
-0x65, 0x63, 0x61, 0x68, 0x65, 0x64, 0x72, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 
-0x70, 0x65, 0x44, 0x69, 0x61, 0x6d, 0x6f, 0x6e, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 
-0x70, 0x65, 0x46, 0x6f, 0x6f, 0x74, 0x62, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x53, 0x68, 
-0x61, 0x70, 0x65, 0x47, 0x65, 0x6d, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x53, 
-0x68, 0x61, 0x70, 0x65, 0x48, 0x65, 0x61, 0x72, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 
-0x70, 0x65, 0x4a, 0x61, 0x63, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x50, 
-0x6c, 0x75, 0x73, 0x53, 0x69, 0x67, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 
-0x53, 0x68, 0x61, 0x6d, 0x72, 0x6f, 0x63, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 
-0x65, 0x53, 0x70, 0x61, 0x64, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x54, 
-0x75, 0x62, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x34, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x45, 0x67, 0x67, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x30, 
-0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x59, 0x65, 0x6e, 0x53, 0x69, 0x67, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x31, 
-0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x58, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 
-0x70, 0x65, 0x57, 0x61, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x6c, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x33, 0x0d, 0x0a, 0x22, 
-0x53, 0x68, 0x61, 0x70, 0x65, 0x57, 0x6f, 0x6e, 0x53, 0x69, 0x67, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x34, 0x0d, 0x0a, 0x22, 
-0x53, 0x68, 0x61, 0x70, 0x65, 0x54, 0x65, 0x6e, 0x6e, 0x69, 0x73, 0x62, 0x61, 0x6c, 0x6c, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x35, 
-0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x53, 0x74, 0x72, 0x61, 0x77, 0x62, 0x65, 0x72, 
-0x72, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x34, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x53, 0x6d, 0x69, 0x6c, 0x65, 
-0x79, 0x46, 0x61, 0x63, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x53, 0x6f, 
-0x63, 0x63, 0x65, 0x72, 0x62, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 
-0x65, 0x52, 0x61, 0x69, 0x6e, 0x62, 0x6f, 0x77, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 
-0x65, 0x53, 0x61, 0x64, 0x46, 0x61, 0x63, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 
-0x65, 0x50, 0x6f, 0x75, 0x6e, 0x64, 0x53, 0x69, 0x67, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x68, 
-0x61, 0x70, 0x65, 0x50, 0x65, 0x61, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 
-0x50, 0x69, 0x6e, 0x65, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 
-0x70, 0x65, 0x4f, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 
-0x65, 0x50, 0x65, 0x61, 0x6e, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 
-0x4f, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 
-0x34, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x4c, 0x65, 0x6d, 0x6f, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x34, 0x37, 
-0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x4d, 0x6f, 0x6e, 0x65, 0x79, 0x42, 0x61, 0x67, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x34, 
-0x38, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x48, 0x6f, 0x72, 0x73, 0x65, 0x73, 0x68, 
-0x6f, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x34, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x48, 0x6f, 0x63, 0x6b, 0x65, 
-0x79, 0x53, 0x74, 0x69, 0x63, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x48, 
-0x6f, 0x63, 0x6b, 0x65, 0x79, 0x50, 0x75, 0x63, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 
-0x70, 0x65, 0x48, 0x61, 0x6e, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x47, 
-0x6f, 0x6c, 0x66, 0x43, 0x6c, 0x75, 0x62, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 
-0x47, 0x72, 0x61, 0x70, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x45, 0x75, 
-0x72, 0x6f, 0x53, 0x69, 0x67, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x44, 
-0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x53, 0x69, 0x67, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 
-0x70, 0x65, 0x42, 0x61, 0x73, 0x6b, 0x65, 0x74, 0x62, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x37, 0x0d, 0x0a, 0x22, 
-0x53, 0x68, 0x61, 0x70, 0x65, 0x43, 0x61, 0x72, 0x72, 0x6f, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x53, 
-0x68, 0x61, 0x70, 0x65, 0x43, 0x68, 0x65, 0x72, 0x72, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x68, 
-0x61, 0x70, 0x65, 0x42, 0x61, 0x73, 0x65, 0x62, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x53, 
-0x68, 0x61, 0x70, 0x65, 0x42, 0x61, 0x73, 0x65, 0x62, 0x61, 0x6c, 0x6c, 0x42, 0x61, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x36, 0x31, 
-0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x42, 0x61, 0x6e, 0x61, 0x6e, 0x61, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x36, 0x32, 0x0d, 
-0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x41, 0x70, 0x70, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x36, 0x33, 0x0d, 0x0a, 0x22, 
-0x53, 0x68, 0x61, 0x70, 0x65, 0x43, 0x61, 0x73, 0x68, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x36, 0x34, 0x0d, 
-0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x43, 0x61, 0x73, 0x68, 0x4d, 0x65, 0x64, 0x69, 0x75, 
-0x6d, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 
-0x36, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x43, 0x61, 0x73, 0x68, 0x53, 0x6d, 
-0x61, 0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x34, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x46, 0x6f, 0x6f, 0x74, 
-0x62, 0x61, 0x6c, 0x6c, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x53, 
-0x68, 0x61, 0x70, 0x65, 0x4c, 0x65, 0x6d, 0x6f, 0x6e, 0x53, 0x6d, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x36, 0x38, 0x0d, 
-0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x4f, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x53, 0x6d, 0x61, 
-0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x34, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 0x65, 0x54, 0x72, 0x65, 0x61, 0x73, 
-0x75, 0x72, 0x65, 0x43, 0x68, 0x65, 0x73, 0x74, 0x4f, 0x70, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x37, 0x30, 0x0d, 0x0a, 0x22, 
-0x53, 0x68, 0x61, 0x70, 0x65, 0x54, 0x72, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x43, 0x68, 0x65, 
-0x73, 0x74, 0x43, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x70, 
-0x65, 0x57, 0x61, 0x74, 0x65, 0x72, 0x6d, 0x65, 0x6c, 0x6f, 0x6e, 0x53, 0x6d, 0x61, 0x6c, 0x6c, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x37, 
-0x32, 0x0d, 0x0a, 0x22, 0x55, 0x6e, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x52, 
-0x6f, 0x63, 0x6b, 0x73, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x34, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x55, 0x6e, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x61, 
-0x62, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x63, 0x6b, 0x73, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 
-0x74, 0x69, 0x62, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x55, 0x6e, 0x62, 
-0x75, 0x69, 0x6c, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x50, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x37, 0x35, 0x0d, 
-0x0a, 0x22, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x32, 0x78, 0x32, 0x4e, 0x6f, 0x6e, 0x43, 0x6f, 
-0x6e, 0x6a, 0x6f, 0x69, 0x6e, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x45, 
-0x6e, 0x65, 0x6d, 0x79, 0x50, 0x61, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 
-0x65, 0x72, 0x31, 0x78, 0x31, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x34, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x45, 0x6e, 0x65, 0x6d, 0x79, 0x50, 0x61, 
-0x74, 0x68, 0x69, 0x6e, 0x67, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x32, 0x78, 0x32, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x37, 0x38, 
-0x0d, 0x0a, 0x22, 0x45, 0x6e, 0x65, 0x6d, 0x79, 0x50, 0x61, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x42, 
-0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x34, 0x78, 0x34, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x45, 0x6e, 0x65, 
-0x6d, 0x79, 0x50, 0x61, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 
-0x38, 0x78, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x34, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x45, 0x6e, 0x65, 0x6d, 0x79, 0x50, 0x61, 0x74, 0x68, 
-0x69, 0x6e, 0x67, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x31, 0x36, 0x78, 0x31, 0x36, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x31, 
-0x0d, 0x0a, 0x22, 0x53, 0x63, 0x6f, 0x70, 0x65, 0x54, 0x65, 0x73, 0x74, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 
-0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x33, 0x20, 0x36, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x30, 
-0x2e, 0x38, 0x36, 0x30, 0x38, 0x34, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x53, 
-0x65, 0x6e, 0x74, 0x72, 0x79, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 
-0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x4d, 0x69, 0x6e, 0x65, 0x72, 0x61, 
-0x6c, 0x46, 0x69, 0x65, 0x6c, 0x64, 0x37, 0x35, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x34, 0x0d, 0x0a, 0x22, 
-0x48, 0x65, 0x6c, 0x6c, 0x69, 0x6f, 0x6e, 0x54, 0x61, 0x6e, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x34, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x31, 
-0x20, 0x33, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x38, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 
-0x32, 0x20, 0x32, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x35, 0x39, 0x36, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x32, 0x39, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x35, 0x0d, 
-0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x54, 0x65, 0x72, 
-0x72, 0x61, 0x6e, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x38, 0x34, 0x31, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x52, 
-0x61, 0x6d, 0x70, 0x4c, 0x65, 0x66, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x38, 
-0x34, 0x33, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x37, 0x0d, 
-0x0a, 0x22, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x52, 0x61, 0x6d, 0x70, 0x52, 0x69, 0x67, 0x68, 
-0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x38, 0x34, 0x35, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x4d, 0x6f, 0x74, 0x68, 
-0x65, 0x72, 0x73, 0x68, 0x69, 0x70, 0x43, 0x6f, 0x72, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x32, 0x20, 0x34, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 0x37, 0x35, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x38, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x20, 0x35, 0x20, 0x30, 0x2e, 0x38, 0x35, 0x30, 0x30, 0x39, 0x38, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 
-0x20, 0x30, 0x20, 0x31, 0x38, 0x35, 0x33, 0x20, 0x32, 0x20, 0x34, 0x38, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x4c, 0x6f, 0x63, 0x75, 0x73, 0x74, 0x4d, 
-0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 0x37, 0x35, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x20, 0x33, 0x20, 0x30, 0x2e, 0x36, 0x30, 0x30, 0x30, 0x39, 0x38, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x30, 0x31, 0x38, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x36, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x34, 0x39, 0x30, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 
-0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x44, 0x65, 0x62, 
-0x72, 0x69, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x31, 0x39, 0x39, 0x36, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x4e, 0x79, 
-0x64, 0x75, 0x73, 0x43, 0x61, 0x6e, 0x61, 0x6c, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x65, 0x72, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x20, 0x37, 0x20, 0x32, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x31, 0x37, 0x36, 
-0x39, 0x20, 0x31, 0x20, 0x33, 0x32, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x39, 
-0x32, 0x0d, 0x0a, 0x22, 0x4e, 0x79, 0x64, 0x75, 0x73, 0x43, 0x61, 0x6e, 0x61, 0x6c, 0x43, 0x72, 
-0x65, 0x65, 0x70, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 
-0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x39, 0x33, 
-0x0d, 0x0a, 0x22, 0x53, 0x77, 0x61, 0x72, 0x6d, 0x48, 0x6f, 0x73, 0x74, 0x42, 0x75, 0x72, 0x72, 
-0x6f, 0x77, 0x65, 0x64, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 
-0x32, 0x30, 0x31, 0x34, 0x20, 0x31, 0x20, 0x34, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x39, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x34, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x77, 0x61, 0x72, 0x6d, 0x48, 0x6f, 0x73, 
-0x74, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 
-0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 
-0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 
-0x31, 0x33, 0x35, 0x36, 0x20, 0x31, 0x20, 0x36, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 0x34, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x34, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x4f, 0x72, 0x61, 0x63, 0x6c, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x39, 0x35, 0x34, 0x20, 0x32, 
-0x20, 0x38, 0x33, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x39, 0x36, 0x0d, 0x0a, 
-0x22, 0x54, 0x65, 0x6d, 0x70, 0x65, 0x73, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x37, 0x35, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 
-0x34, 0x20, 0x37, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x32, 0x20, 0x33, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x37, 0x20, 0x32, 0x32, 0x0d, 
-0x0a, 0x31, 0x20, 0x31, 0x35, 0x20, 0x33, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x35, 0x0d, 0x0a, 0x31, 
-0x20, 0x34, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x30, 0x20, 0x33, 
-0x2e, 0x33, 0x30, 0x30, 0x30, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x20, 0x30, 0x20, 0x39, 0x35, 
-0x35, 0x20, 0x32, 0x20, 0x39, 0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x32, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x36, 0x34, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 
-0x39, 0x37, 0x0d, 0x0a, 0x22, 0x57, 0x61, 0x72, 0x48, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 0x35, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x32, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x20, 0x37, 0x20, 0x31, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x34, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x57, 0x69, 0x64, 0x6f, 0x77, 0x4d, 0x69, 0x6e, 0x65, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x35, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 0x31, 0x32, 0x35, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x36, 0x31, 0x34, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x37, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x39, 0x39, 0x0d, 
-0x0a, 0x22, 0x56, 0x69, 0x70, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 
-0x20, 0x36, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x39, 0x35, 0x33, 0x31, 0x32, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x31, 0x33, 0x35, 0x34, 0x20, 0x31, 
-0x20, 0x36, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x31, 0x30, 0x31, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x30, 
-0x0d, 0x0a, 0x22, 0x57, 0x69, 0x64, 0x6f, 0x77, 0x4d, 0x69, 0x6e, 0x65, 0x42, 0x75, 0x72, 0x72, 
-0x6f, 0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 
-0x0a, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x32, 0x30, 0x39, 
-0x35, 0x20, 0x30, 0x20, 0x35, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x37, 0x20, 0x31, 0x0d, 0x0a, 
-0x34, 0x39, 0x38, 0x20, 0x0d, 0x0a, 0x34, 0x39, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x35, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x4c, 0x75, 0x72, 0x6b, 0x65, 0x72, 0x4d, 0x50, 
-0x45, 0x67, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x33, 0x2e, 0x33, 0x37, 0x35, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x4c, 0x75, 0x72, 
-0x6b, 0x65, 0x72, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x31, 0x35, 
-0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 
-0x0a, 0x32, 0x2e, 0x39, 0x35, 0x33, 0x31, 0x32, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x32, 0x31, 0x30, 0x34, 0x20, 0x31, 0x20, 0x35, 0x35, 0x33, 
-0x2e, 0x33, 0x32, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x35, 0x30, 0x34, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x33, 
-0x0d, 0x0a, 0x22, 0x4c, 0x75, 0x72, 0x6b, 0x65, 0x72, 0x4d, 0x50, 0x42, 0x75, 0x72, 0x72, 0x6f, 
-0x77, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 
-0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x32, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x32, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x31, 0x20, 0x39, 0x20, 0x32, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x20, 0x30, 0x20, 0x32, 0x31, 0x30, 0x38, 0x20, 0x31, 0x20, 0x34, 0x32, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x32, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x4c, 0x75, 0x72, 0x6b, 
-0x65, 0x72, 0x44, 0x65, 0x6e, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 
-0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x36, 0x33, 0x20, 0x31, 0x20, 0x31, 0x39, 0x32, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 0x31, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 0x65, 
-0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x57, 0x69, 0x64, 
-0x65, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x31, 0x38, 0x20, 
-0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x36, 0x0d, 0x0a, 0x22, 
-0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 
-0x45, 0x57, 0x69, 0x64, 0x65, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x32, 0x30, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x30, 0x37, 0x0d, 0x0a, 
-0x22, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 
-0x4e, 0x57, 0x57, 0x69, 0x64, 0x65, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x31, 0x32, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 
-0x30, 0x38, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x57, 0x69, 0x64, 0x65, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x31, 0x32, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x35, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 
-0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x57, 0x69, 0x64, 0x65, 0x31, 0x30, 0x4f, 0x75, 0x74, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x32, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 0x65, 0x6e, 
-0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x57, 0x69, 0x64, 0x65, 
-0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x32, 0x38, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 
-0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x57, 0x69, 
-0x64, 0x65, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x33, 
-0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x31, 0x32, 0x0d, 
-0x0a, 0x22, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 
-0x65, 0x4e, 0x57, 0x57, 0x69, 0x64, 0x65, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x31, 0x33, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x31, 
-0x33, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 
-0x64, 0x67, 0x65, 0x4e, 0x45, 0x57, 0x69, 0x64, 0x65, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x33, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x35, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 
-0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x57, 0x69, 0x64, 0x65, 0x31, 0x32, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x33, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 0x65, 0x6e, 
-0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x57, 0x69, 0x64, 0x65, 
-0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x33, 0x38, 0x20, 
-0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x31, 0x36, 0x0d, 0x0a, 0x22, 
-0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 
-0x57, 0x57, 0x69, 0x64, 0x65, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x34, 
-0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x31, 0x37, 0x0d, 
-0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 
-0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x52, 0x61, 0x6d, 0x70, 
-0x52, 0x69, 0x67, 0x68, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x35, 0x32, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x31, 0x38, 0x0d, 0x0a, 0x22, 
-0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 
-0x6f, 0x77, 0x65, 0x72, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x52, 0x61, 0x6d, 0x70, 0x4c, 0x65, 
-0x66, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x35, 0x34, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 
-0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 
-0x72, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x36, 0x34, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 
-0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x58, 
-0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 
-0x6f, 0x6f, 0x72, 0x45, 0x4f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x36, 
-0x36, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x35, 0x32, 0x31, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 
-0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x31, 0x36, 0x38, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x35, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 
-0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x45, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x31, 0x37, 0x30, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 
-0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 
-0x4e, 0x45, 0x4f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x37, 0x32, 0x20, 
-0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 
-0x32, 0x34, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 
-0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x4f, 0x70, 0x65, 0x6e, 0x65, 0x64, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x31, 0x37, 0x34, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 
-0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 
-0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 
-0x72, 0x4e, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x37, 0x36, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 
-0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x32, 0x36, 0x0d, 0x0a, 0x22, 
-0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 
-0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x57, 0x4f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x31, 0x37, 0x38, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x35, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 
-0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x53, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x31, 0x38, 0x30, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 
-0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x53, 
-0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x38, 0x32, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 
-0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x58, 0x65, 
-0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 
-0x6f, 0x72, 0x53, 0x45, 0x4f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x38, 
-0x34, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x35, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 
-0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x53, 0x4f, 0x70, 0x65, 0x6e, 
-0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x38, 0x36, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 
-0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x58, 
-0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 
-0x6f, 0x6f, 0x72, 0x53, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x38, 0x38, 0x20, 0x33, 0x20, 0x35, 
-0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x33, 0x32, 0x0d, 
-0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 
-0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x53, 0x57, 0x4f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x31, 0x39, 0x30, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x33, 0x33, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 
-0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x57, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x31, 0x39, 0x32, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 
-0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 
-0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 
-0x72, 0x57, 0x4f, 0x70, 0x65, 0x6e, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x39, 0x34, 0x20, 
-0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 
-0x33, 0x35, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 
-0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x31, 0x39, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 
-0x33, 0x36, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 
-0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x31, 0x39, 
-0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x33, 0x37, 0x0d, 
-0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 
-0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 
-0x65, 0x4e, 0x57, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x30, 
-0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x33, 0x38, 0x0d, 
-0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 
-0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 
-0x65, 0x4e, 0x57, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x30, 0x32, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x58, 
-0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 
-0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 
-0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x30, 0x34, 0x20, 
-0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x30, 0x0d, 0x0a, 0x22, 
-0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 
-0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 
-0x45, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x30, 0x36, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x58, 0x65, 
-0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 
-0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 
-0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x30, 0x38, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x58, 
-0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 
-0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 
-0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x31, 0x30, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 
-0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 
-0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x31, 0x32, 
-0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x31, 0x32, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x58, 0x65, 
-0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 
-0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x31, 
-0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x31, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 
-0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 
-0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 0x32, 0x4f, 
-0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x31, 0x36, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 
-0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 
-0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 0x32, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x31, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 
-0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 
-0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x48, 0x38, 0x4f, 0x75, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x32, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 
-0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 
-0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x48, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x32, 0x32, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x35, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 
-0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 
-0x72, 0x69, 0x64, 0x67, 0x65, 0x56, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x32, 0x32, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 
-0x35, 0x30, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 
-0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x56, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x32, 0x36, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x35, 0x31, 0x0d, 0x0a, 
-0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 
-0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 
-0x48, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x32, 0x38, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x35, 0x32, 0x0d, 0x0a, 
-0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 
-0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 
-0x48, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x33, 0x30, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x58, 0x65, 
-0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 
-0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x56, 0x31, 0x30, 
-0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x33, 0x32, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x58, 0x65, 
-0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 
-0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x56, 0x31, 0x30, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x33, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 
-0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 
-0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x48, 0x31, 0x32, 0x4f, 0x75, 0x74, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x33, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 
-0x67, 0x61, 0x5f, 0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 
-0x69, 0x6e, 0x67, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x48, 0x31, 0x32, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x32, 0x33, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x35, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 
-0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 
-0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x56, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x32, 0x34, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x35, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x5f, 
-0x43, 0x61, 0x76, 0x65, 0x72, 0x6e, 0x73, 0x5f, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x69, 0x6e, 0x67, 
-0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x56, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x32, 0x34, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 
-0x35, 0x39, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 
-0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x50, 0x75, 0x73, 0x68, 0x55, 
-0x6e, 0x69, 0x74, 0x52, 0x61, 0x6d, 0x70, 0x4c, 0x65, 0x66, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x36, 0x30, 
-0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x54, 0x65, 
-0x72, 0x72, 0x61, 0x6e, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x50, 0x75, 0x73, 0x68, 0x55, 0x6e, 0x69, 
-0x74, 0x52, 0x61, 0x6d, 0x70, 0x52, 0x69, 0x67, 0x68, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x36, 0x31, 0x0d, 
-0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 
-0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x50, 0x75, 0x73, 0x68, 0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x35, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 
-0x65, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x50, 0x75, 0x73, 0x68, 
-0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 
-0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 
-0x50, 0x75, 0x73, 0x68, 0x55, 0x6e, 0x69, 0x74, 0x52, 0x61, 0x6d, 0x70, 0x52, 0x69, 0x67, 0x68, 
-0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x35, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 
-0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x50, 0x75, 0x73, 
-0x68, 0x55, 0x6e, 0x69, 0x74, 0x52, 0x61, 0x6d, 0x70, 0x4c, 0x65, 0x66, 0x74, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 
-0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 
-0x36, 0x35, 0x0d, 0x0a, 0x22, 0x44, 0x69, 0x67, 0x65, 0x73, 0x74, 0x65, 0x72, 0x43, 0x72, 0x65, 
-0x65, 0x70, 0x53, 0x70, 0x72, 0x61, 0x79, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x55, 0x6e, 0x69, 
-0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x36, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x34, 0x20, 0x37, 0x20, 0x38, 0x20, 0x31, 0x30, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x36, 0x36, 0x0d, 
-0x0a, 0x22, 0x44, 0x69, 0x67, 0x65, 0x73, 0x74, 0x65, 0x72, 0x43, 0x72, 0x65, 0x65, 0x70, 0x53, 
-0x70, 0x72, 0x61, 0x79, 0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x4e, 0x79, 0x64, 0x75, 
-0x73, 0x43, 0x61, 0x6e, 0x61, 0x6c, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x57, 0x65, 
-0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x35, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x56, 0x69, 0x70, 0x65, 0x72, 0x43, 0x6f, 0x6e, 
-0x73, 0x75, 0x6d, 0x65, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x57, 0x65, 0x61, 
-0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x35, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x52, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x42, 
-0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x54, 0x65, 0x6d, 0x70, 
-0x65, 0x73, 0x74, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x59, 0x6f, 0x69, 
-0x6e, 0x6b, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x59, 0x6f, 0x69, 
-0x6e, 0x6b, 0x56, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x41, 0x69, 0x72, 0x4d, 0x69, 0x73, 0x73, 0x69, 
-0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x35, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x59, 0x6f, 0x69, 0x6e, 0x6b, 0x56, 0x69, 0x6b, 0x69, 0x6e, 
-0x67, 0x47, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x37, 0x34, 0x0d, 
-0x0a, 0x22, 0x59, 0x6f, 0x69, 0x6e, 0x6b, 0x53, 0x69, 0x65, 0x67, 0x65, 0x54, 0x61, 0x6e, 0x6b, 
-0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x57, 0x61, 0x72, 0x48, 0x6f, 
-0x75, 0x6e, 0x64, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x45, 0x79, 0x65, 
-0x53, 0x74, 0x61, 0x6c, 0x6b, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x57, 
-0x69, 0x64, 0x6f, 0x77, 0x4d, 0x69, 0x6e, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x37, 0x38, 0x0d, 
-0x0a, 0x22, 0x57, 0x69, 0x64, 0x6f, 0x77, 0x4d, 0x69, 0x6e, 0x65, 0x41, 0x69, 0x72, 0x57, 0x65, 
-0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x35, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x4d, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x68, 
-0x69, 0x70, 0x43, 0x6f, 0x72, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x57, 0x65, 0x61, 0x70, 
-0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x35, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x54, 0x6f, 0x72, 0x6e, 0x61, 0x64, 0x6f, 0x4d, 0x69, 0x73, 
-0x73, 0x69, 0x6c, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x38, 0x31, 0x0d, 0x0a, 0x22, 0x54, 0x6f, 
-0x72, 0x6e, 0x61, 0x64, 0x6f, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x44, 0x75, 0x6d, 0x6d, 
-0x79, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x54, 0x61, 0x6c, 0x6f, 0x6e, 
-0x73, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x38, 0x33, 0x0d, 
-0x0a, 0x22, 0x43, 0x72, 0x65, 0x65, 0x70, 0x54, 0x75, 0x6d, 0x6f, 0x72, 0x4d, 0x69, 0x73, 0x73, 
-0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x35, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x4c, 0x6f, 0x63, 0x75, 0x73, 0x74, 0x4d, 0x50, 0x45, 
-0x67, 0x67, 0x41, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x38, 
-0x35, 0x0d, 0x0a, 0x22, 0x4c, 0x6f, 0x63, 0x75, 0x73, 0x74, 0x4d, 0x50, 0x45, 0x67, 0x67, 0x42, 
-0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x38, 0x36, 0x0d, 0x0a, 
-0x22, 0x4c, 0x6f, 0x63, 0x75, 0x73, 0x74, 0x4d, 0x50, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x38, 0x37, 
-0x0d, 0x0a, 0x22, 0x52, 0x65, 0x70, 0x75, 0x6c, 0x73, 0x6f, 0x72, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 
-0x6e, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 
-0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x44, 
-0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x43, 
-0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 
-0x54, 0x6f, 0x77, 0x65, 0x72, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 
-0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 
-0x39, 0x30, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 
-0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x52, 0x61, 0x6d, 0x70, 0x4c, 
-0x65, 0x66, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 
-0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x54, 0x6f, 0x77, 0x65, 
-0x72, 0x52, 0x61, 0x6d, 0x70, 0x52, 0x69, 0x67, 0x68, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x39, 0x32, 0x0d, 
-0x0a, 0x22, 0x49, 0x63, 0x65, 0x32, 0x78, 0x32, 0x4e, 0x6f, 0x6e, 0x43, 0x6f, 0x6e, 0x6a, 0x6f, 
-0x69, 0x6e, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x49, 0x63, 0x65, 0x50, 
-0x72, 0x6f, 0x74, 0x6f, 0x73, 0x73, 0x43, 0x72, 0x61, 0x74, 0x65, 0x73, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x39, 0x34, 0x0d, 0x0a, 0x22, 
-0x50, 0x72, 0x6f, 0x74, 0x6f, 0x73, 0x73, 0x43, 0x72, 0x61, 0x74, 0x65, 0x73, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x39, 0x35, 0x0d, 0x0a, 
-0x22, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x4d, 0x69, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x50, 
-0x69, 0x63, 0x6b, 0x75, 0x70, 0x50, 0x61, 0x6c, 0x6c, 0x65, 0x74, 0x47, 0x61, 0x73, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x39, 
-0x37, 0x0d, 0x0a, 0x22, 0x50, 0x69, 0x63, 0x6b, 0x75, 0x70, 0x50, 0x61, 0x6c, 0x6c, 0x65, 0x74, 
-0x4d, 0x69, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x35, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x69, 
-0x63, 0x6b, 0x75, 0x70, 0x53, 0x63, 0x72, 0x61, 0x70, 0x53, 0x61, 0x6c, 0x76, 0x61, 0x67, 0x65, 
-0x31, 0x78, 0x31, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x35, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x50, 0x69, 0x63, 0x6b, 0x75, 0x70, 0x53, 
-0x63, 0x72, 0x61, 0x70, 0x53, 0x61, 0x6c, 0x76, 0x61, 0x67, 0x65, 0x32, 0x78, 0x32, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 
-0x30, 0x0d, 0x0a, 0x22, 0x50, 0x69, 0x63, 0x6b, 0x75, 0x70, 0x53, 0x63, 0x72, 0x61, 0x70, 0x53, 
-0x61, 0x6c, 0x76, 0x61, 0x67, 0x65, 0x33, 0x78, 0x33, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x52, 
-0x6f, 0x75, 0x67, 0x68, 0x54, 0x65, 0x72, 0x72, 0x61, 0x69, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 0x32, 0x0d, 0x0a, 0x22, 
-0x55, 0x6e, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x63, 0x6b, 
-0x73, 0x53, 0x6d, 0x61, 0x6c, 0x6c, 0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x55, 0x6e, 
-0x62, 0x75, 0x69, 0x6c, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x50, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x53, 
-0x6d, 0x61, 0x6c, 0x6c, 0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x55, 0x6e, 0x62, 0x75, 
-0x69, 0x6c, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x50, 0x6c, 0x61, 0x74, 0x65, 0x73, 0x55, 0x6e, 0x69, 
-0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 
-0x30, 0x35, 0x0d, 0x0a, 0x22, 0x55, 0x6e, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x61, 0x62, 0x6c, 0x65, 
-0x52, 0x6f, 0x63, 0x6b, 0x73, 0x53, 0x6d, 0x61, 0x6c, 0x6c, 0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 0x36, 0x0d, 
-0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x48, 0x65, 0x61, 0x6c, 0x69, 0x6e, 0x67, 
-0x53, 0x68, 0x72, 0x69, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x76, 0x69, 0x73, 0x69, 
-0x62, 0x6c, 0x65, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 0x38, 
-0x0d, 0x0a, 0x22, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x73, 0x73, 0x56, 0x65, 0x73, 0x70, 0x65, 0x6e, 
-0x65, 0x47, 0x65, 0x79, 0x73, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 
-0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x30, 0x39, 0x0d, 0x0a, 0x22, 
-0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 
-0x6f, 0x77, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 
-0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x54, 0x6f, 0x77, 
-0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x54, 0x68, 0x6f, 0x72, 0x6e, 0x4c, 
-0x69, 0x7a, 0x61, 0x72, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x43, 0x6c, 0x65, 0x61, 0x6e, 
-0x69, 0x6e, 0x67, 0x42, 0x6f, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x36, 0x78, 0x36, 0x57, 
-0x65, 0x61, 0x6b, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x50, 0x72, 0x6f, 0x74, 0x6f, 
-0x73, 0x73, 0x53, 0x6e, 0x61, 0x6b, 0x65, 0x53, 0x65, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x44, 0x65, 
-0x6d, 0x6f, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x34, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x50, 
-0x68, 0x79, 0x73, 0x69, 0x63, 0x73, 0x43, 0x61, 0x70, 0x73, 0x75, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x36, 0x0d, 0x0a, 
-0x22, 0x50, 0x68, 0x79, 0x73, 0x69, 0x63, 0x73, 0x43, 0x75, 0x62, 0x65, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x37, 0x0d, 0x0a, 0x22, 
-0x50, 0x68, 0x79, 0x73, 0x69, 0x63, 0x73, 0x43, 0x79, 0x6c, 0x69, 0x6e, 0x64, 0x65, 0x72, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x38, 
-0x0d, 0x0a, 0x22, 0x50, 0x68, 0x79, 0x73, 0x69, 0x63, 0x73, 0x4b, 0x6e, 0x6f, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x31, 0x39, 0x0d, 
-0x0a, 0x22, 0x50, 0x68, 0x79, 0x73, 0x69, 0x63, 0x73, 0x4c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x50, 0x68, 
-0x79, 0x73, 0x69, 0x63, 0x73, 0x50, 0x72, 0x69, 0x6d, 0x69, 0x74, 0x69, 0x76, 0x65, 0x73, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 0x31, 
-0x0d, 0x0a, 0x22, 0x50, 0x68, 0x79, 0x73, 0x69, 0x63, 0x73, 0x53, 0x70, 0x68, 0x65, 0x72, 0x65, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 
-0x32, 0x0d, 0x0a, 0x22, 0x50, 0x68, 0x79, 0x73, 0x69, 0x63, 0x73, 0x53, 0x74, 0x61, 0x72, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 0x33, 
-0x0d, 0x0a, 0x22, 0x43, 0x72, 0x65, 0x65, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x34, 
-0x78, 0x34, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x36, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 
-0x6c, 0x65, 0x43, 0x69, 0x74, 0x79, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x32, 0x78, 0x34, 0x56, 
-0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x44, 
-0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x43, 0x69, 0x74, 0x79, 0x44, 
-0x65, 0x62, 0x72, 0x69, 0x73, 0x32, 0x78, 0x34, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 
-0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 
-0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x43, 0x69, 0x74, 0x79, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 
-0x32, 0x78, 0x36, 0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 0x37, 
-0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x43, 
-0x69, 0x74, 0x79, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x32, 0x78, 0x36, 0x48, 0x6f, 0x72, 0x69, 
-0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x43, 0x69, 0x74, 0x79, 0x44, 0x65, 
-0x62, 0x72, 0x69, 0x73, 0x34, 0x78, 0x34, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x44, 
-0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x43, 0x69, 0x74, 0x79, 0x44, 
-0x65, 0x62, 0x72, 0x69, 0x73, 0x36, 0x78, 0x36, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 0x30, 0x0d, 0x0a, 0x22, 
-0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x43, 0x69, 0x74, 0x79, 
-0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x48, 0x75, 0x67, 0x65, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 
-0x61, 0x6c, 0x42, 0x4c, 0x55, 0x52, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x43, 0x69, 0x74, 0x79, 0x44, 0x65, 
-0x62, 0x72, 0x69, 0x73, 0x48, 0x75, 0x67, 0x65, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 
-0x55, 0x4c, 0x42, 0x52, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x54, 0x65, 0x73, 0x74, 
-0x5a, 0x65, 0x72, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x39, 
-0x34, 0x39, 0x32, 0x32, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 0x33, 
-0x0d, 0x0a, 0x22, 0x50, 0x61, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 
-0x72, 0x52, 0x61, 0x64, 0x69, 0x75, 0x73, 0x31, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x45, 0x78, 0x31, 0x32, 
-0x78, 0x34, 0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x33, 0x36, 0x36, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 
-0x35, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 
-0x52, 0x6f, 0x63, 0x6b, 0x45, 0x78, 0x31, 0x32, 0x78, 0x34, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 
-0x6e, 0x74, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x37, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x45, 0x78, 
-0x31, 0x32, 0x78, 0x36, 0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x36, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 
-0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x45, 0x78, 0x31, 0x32, 0x78, 0x36, 0x48, 0x6f, 0x72, 0x69, 
-0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 
-0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 0x38, 0x0d, 0x0a, 0x22, 
-0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 
-0x45, 0x78, 0x31, 0x34, 0x78, 0x34, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x33, 0x39, 0x0d, 0x0a, 0x22, 
-0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 
-0x45, 0x78, 0x31, 0x36, 0x78, 0x36, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 
-0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x34, 0x30, 0x0d, 0x0a, 0x22, 
-0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 
-0x45, 0x78, 0x31, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x55, 
-0x4c, 0x42, 0x52, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x32, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 
-0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x45, 0x78, 0x31, 
-0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x42, 0x4c, 0x55, 0x52, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 
-0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x45, 0x78, 0x31, 0x56, 0x65, 0x72, 
-0x74, 0x69, 0x63, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x37, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x34, 0x33, 
-0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 
-0x6f, 0x63, 0x6b, 0x45, 0x78, 0x31, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 
-0x48, 0x75, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x35, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x49, 0x63, 0x65, 0x32, 0x78, 0x34, 
-0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x36, 0x36, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x34, 0x35, 0x0d, 
-0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x49, 0x63, 
-0x65, 0x32, 0x78, 0x34, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x37, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x36, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
-0x69, 0x62, 0x6c, 0x65, 0x49, 0x63, 0x65, 0x32, 0x78, 0x36, 0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 
-0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x36, 0x38, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x49, 0x63, 0x65, 0x32, 0x78, 0x36, 0x48, 0x6f, 
-0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x36, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x34, 0x38, 0x0d, 
-0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x49, 0x63, 
-0x65, 0x34, 0x78, 0x34, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x49, 0x63, 0x65, 0x36, 0x78, 0x36, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 
-0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x49, 0x63, 0x65, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 
-0x6c, 0x48, 0x75, 0x67, 0x65, 0x55, 0x4c, 0x42, 0x52, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x33, 0x37, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x35, 0x31, 
-0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x49, 
-0x63, 0x65, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x42, 0x4c, 
-0x55, 0x52, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x49, 0x63, 0x65, 0x56, 0x65, 0x72, 0x74, 0x69, 
-0x63, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 
-0x37, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x35, 0x33, 0x0d, 0x0a, 
-0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x49, 0x63, 0x65, 
-0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x48, 0x75, 0x67, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x37, 0x35, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x36, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x65, 0x72, 0x74, 0x50, 0x6c, 
-0x61, 0x6e, 0x65, 0x74, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 
-0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x36, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x65, 0x72, 0x74, 0x50, 0x6c, 0x61, 
-0x6e, 0x65, 0x74, 0x53, 0x74, 0x72, 0x65, 0x65, 0x74, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x32, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x2e, 0x35, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x36, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x55, 0x6e, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x61, 0x62, 0x6c, 
-0x65, 0x42, 0x72, 0x69, 0x63, 0x6b, 0x73, 0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x55, 
-0x6e, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x73, 0x55, 
-0x6e, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x36, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x75, 0x73, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x41, 0x72, 0x63, 0x68, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x35, 
-0x39, 0x0d, 0x0a, 0x22, 0x41, 0x72, 0x74, 0x6f, 0x73, 0x69, 0x6c, 0x6f, 0x70, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x36, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x41, 0x6e, 0x74, 0x65, 0x70, 0x6c, 0x6f, 0x74, 0x74, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x36, 0x36, 0x31, 0x0d, 0x0a, 0x22, 0x4c, 0x61, 0x62, 0x42, 0x6f, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x34, 0x20, 0x39, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x43, 0x72, 0x61, 0x62, 0x65, 0x65, 
-0x74, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x36, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 
-0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x52, 0x61, 0x6d, 
-0x70, 0x52, 0x69, 0x67, 0x68, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 
-0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 0x77, 
-0x65, 0x72, 0x52, 0x61, 0x6d, 0x70, 0x4c, 0x65, 0x66, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x36, 0x35, 0x0d, 
-0x0a, 0x22, 0x4c, 0x61, 0x62, 0x4d, 0x69, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 
-0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x36, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x4c, 0x61, 0x62, 0x4d, 0x69, 0x6e, 0x65, 0x72, 
-0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 0x64, 0x37, 0x35, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x36, 0x37, 0x0d, 0x0a, 
-0x22, 0x53, 0x6e, 0x6f, 0x77, 0x52, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x72, 0x79, 0x5f, 0x54, 0x65, 
-0x72, 0x72, 0x61, 0x6e, 0x5f, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x53, 0x68, 0x6f, 0x72, 0x74, 0x38, 0x4f, 0x75, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x34, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x6e, 0x6f, 0x77, 0x52, 0x65, 
-0x66, 0x69, 0x6e, 0x65, 0x72, 0x79, 0x5f, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x5f, 0x45, 0x78, 
-0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x53, 
-0x68, 0x6f, 0x72, 0x74, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x36, 0x39, 0x0d, 0x0a, 0x22, 
-0x53, 0x6e, 0x6f, 0x77, 0x52, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x72, 0x79, 0x5f, 0x54, 0x65, 0x72, 
-0x72, 0x61, 0x6e, 0x5f, 0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 
-0x64, 0x67, 0x65, 0x4e, 0x57, 0x53, 0x68, 0x6f, 0x72, 0x74, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x35, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x36, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x6e, 0x6f, 0x77, 0x52, 0x65, 0x66, 
-0x69, 0x6e, 0x65, 0x72, 0x79, 0x5f, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x5f, 0x45, 0x78, 0x74, 
-0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x53, 0x68, 
-0x6f, 0x72, 0x74, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x35, 0x32, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x54, 
-0x61, 0x72, 0x73, 0x6f, 0x6e, 0x69, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x32, 0x36, 0x32, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x54, 0x61, 0x72, 0x73, 0x6f, 0x6e, 
-0x69, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x65, 0x64, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x32, 0x36, 0x34, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x54, 0x61, 0x72, 0x73, 
-0x6f, 0x6e, 0x69, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 
-0x36, 0x36, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x36, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x54, 0x61, 0x72, 0x73, 0x6f, 0x6e, 0x69, 0x73, 
-0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x45, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x65, 0x64, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x32, 0x36, 0x38, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x54, 0x61, 0x72, 0x73, 0x6f, 
-0x6e, 0x69, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x37, 0x30, 
-0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x36, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x54, 0x61, 0x72, 0x73, 0x6f, 0x6e, 0x69, 0x73, 0x5f, 0x44, 
-0x6f, 0x6f, 0x72, 0x45, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 
-0x37, 0x32, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x36, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x54, 0x61, 0x72, 0x73, 0x6f, 0x6e, 0x69, 0x73, 
-0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x37, 0x34, 0x20, 0x33, 
-0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x37, 
-0x38, 0x0d, 0x0a, 0x22, 0x54, 0x61, 0x72, 0x73, 0x6f, 0x6e, 0x69, 0x73, 0x5f, 0x44, 0x6f, 0x6f, 
-0x72, 0x4e, 0x57, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x37, 
-0x36, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x36, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x75, 0x6e, 0x64, 0x4d, 
-0x61, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x32, 0x37, 0x38, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x36, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x75, 0x6e, 
-0x64, 0x4d, 0x61, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x4c, 0x6f, 
-0x77, 0x65, 0x72, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x38, 0x30, 0x20, 0x33, 0x20, 0x34, 
-0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x38, 0x31, 0x0d, 
-0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x75, 0x6e, 0x64, 0x4d, 0x61, 0x6e, 0x73, 0x69, 0x6f, 
-0x6e, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x38, 0x32, 0x20, 
-0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 
-0x38, 0x32, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x75, 0x6e, 0x64, 0x4d, 0x61, 0x6e, 
-0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x45, 0x4c, 0x6f, 0x77, 0x65, 0x72, 
-0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x38, 0x34, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 
-0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x43, 
-0x6f, 0x6d, 0x70, 0x6f, 0x75, 0x6e, 0x64, 0x4d, 0x61, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x44, 
-0x6f, 0x6f, 0x72, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x38, 0x36, 0x20, 0x33, 0x20, 0x35, 0x33, 
-0x2e, 0x33, 0x32, 0x38, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x38, 0x34, 0x0d, 0x0a, 
-0x22, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x75, 0x6e, 0x64, 0x4d, 0x61, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 
-0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x45, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x65, 0x64, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x32, 0x38, 0x38, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x75, 
-0x6e, 0x64, 0x4d, 0x61, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x44, 0x6f, 0x6f, 0x72, 0x4e, 0x57, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x32, 0x39, 0x30, 0x20, 0x33, 0x20, 0x35, 0x33, 0x2e, 0x33, 0x32, 0x38, 
-0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6d, 
-0x70, 0x6f, 0x75, 0x6e, 0x64, 0x4d, 0x61, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x5f, 0x44, 0x6f, 0x6f, 
-0x72, 0x4e, 0x57, 0x4c, 0x6f, 0x77, 0x65, 0x72, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x39, 
-0x32, 0x20, 0x33, 0x20, 0x34, 0x32, 0x2e, 0x36, 0x37, 0x31, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x36, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x61, 0x67, 0x65, 0x72, 0x43, 0x6f, 
-0x63, 0x6f, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x35, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x61, 0x67, 0x65, 
-0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x37, 0x35, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x36, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x36, 0x30, 0x30, 0x31, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x33, 0x20, 0x30, 0x20, 0x32, 0x33, 0x33, 0x30, 0x20, 0x31, 0x20, 0x31, 0x39, 0x36, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x39, 0x37, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x4c, 0x69, 0x62, 0x65, 0x72, 
-0x61, 0x74, 0x6f, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 
-0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 
-0x33, 0x2e, 0x33, 0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x35, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x35, 0x20, 0x31, 0x2e, 0x38, 0x30, 0x30, 
-0x30, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x36, 0x32, 0x36, 0x20, 0x30, 0x20, 
-0x39, 0x36, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x39, 0x30, 0x0d, 0x0a, 0x22, 
-0x52, 0x61, 0x76, 0x61, 0x67, 0x65, 0x72, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x32, 0x33, 0x34, 0x30, 0x20, 0x31, 0x20, 0x39, 
-0x2e, 0x36, 0x39, 0x31, 0x34, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x35, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x36, 0x38, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x39, 
-0x31, 0x0d, 0x0a, 0x22, 0x54, 0x68, 0x6f, 0x72, 0x41, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x0d, 0x0a, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x32, 0x20, 0x34, 0x20, 0x37, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 0x37, 0x35, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x37, 0x20, 
-0x31, 0x35, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x31, 0x20, 0x32, 0x2e, 0x33, 0x39, 0x39, 0x39, 0x0d, 
-0x0a, 0x31, 0x20, 0x33, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x37, 0x20, 
-0x31, 0x2e, 0x32, 0x38, 0x30, 0x30, 0x33, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x20, 0x30, 0x20, 0x32, 
-0x33, 0x36, 0x32, 0x20, 0x30, 0x20, 0x34, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 
-0x31, 0x0d, 0x0a, 0x35, 0x32, 0x20, 0x0d, 0x0a, 0x35, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x36, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x43, 0x79, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x33, 0x2e, 0x33, 0x37, 
-0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x31, 0x38, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x31, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 
-0x20, 0x35, 0x39, 0x37, 0x20, 0x30, 0x20, 0x37, 0x32, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x35, 0x20, 0x31, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x36, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x4c, 0x6f, 0x63, 0x75, 0x73, 0x74, 0x4d, 0x50, 0x46, 
-0x6c, 0x79, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 
-0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x33, 0x38, 0x35, 0x20, 0x31, 0x20, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x36, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x38, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x36, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x44, 0x69, 0x73, 0x72, 0x75, 0x70, 0x74, 0x6f, 0x72, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x39, 0x39, 0x34, 
-0x20, 0x32, 0x20, 0x38, 0x30, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x37, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x39, 0x35, 
-0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 
-0x67, 0x65, 0x4e, 0x45, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x33, 
-0x39, 0x37, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x39, 0x36, 
-0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 
-0x67, 0x65, 0x4e, 0x45, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x33, 0x39, 0x39, 0x20, 
-0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x39, 0x37, 0x0d, 0x0a, 0x22, 
-0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 
-0x45, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x30, 0x31, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x39, 0x38, 0x0d, 0x0a, 
-0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 
-0x4e, 0x45, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x30, 0x33, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x36, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x41, 
-0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 
-0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x30, 0x35, 0x20, 
-0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x30, 0x0d, 0x0a, 0x22, 
-0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 
-0x45, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x30, 0x37, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x41, 0x69, 
-0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x38, 
-0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x30, 0x39, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x41, 0x69, 
-0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x38, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x31, 0x31, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 
-0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 0x30, 0x4f, 0x75, 
-0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x31, 0x33, 0x20, 0x30, 0x20, 0x34, 0x38, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 
-0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 0x30, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x31, 0x35, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 
-0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 0x32, 0x4f, 0x75, 0x74, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x31, 0x37, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 
-0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 0x32, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x31, 0x39, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 
-0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x38, 0x4f, 0x75, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x32, 0x31, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 
-0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x31, 0x30, 0x4f, 0x75, 
-0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x32, 0x35, 0x20, 0x30, 0x20, 0x34, 0x38, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 
-0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x31, 0x32, 
-0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x32, 0x39, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x41, 0x69, 
-0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 
-0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x33, 0x33, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x41, 
-0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 
-0x57, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x33, 0x37, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x31, 0x32, 0x0d, 0x0a, 
-0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 
-0x65, 0x4e, 0x57, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 
-0x34, 0x31, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x31, 0x33, 
-0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x4c, 0x69, 0x67, 0x68, 0x74, 
-0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x34, 0x34, 0x35, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x37, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x4c, 
-0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x38, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x34, 0x34, 0x37, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x37, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 
-0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x31, 0x30, 0x4f, 
-0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x34, 0x39, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 
-0x6b, 0x75, 0x72, 0x61, 0x73, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 
-0x4e, 0x45, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x35, 0x31, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x31, 0x37, 0x0d, 0x0a, 0x22, 0x53, 
-0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 
-0x67, 0x65, 0x4e, 0x45, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x34, 0x35, 0x33, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x31, 
-0x38, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x4c, 0x69, 0x67, 0x68, 
-0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x45, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x34, 0x35, 0x35, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x37, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x4c, 0x69, 
-0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x38, 0x4f, 0x75, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x35, 0x37, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 
-0x61, 0x73, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x38, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x35, 0x39, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x32, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 
-0x72, 0x61, 0x73, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 
-0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x36, 0x31, 0x20, 
-0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x32, 0x32, 0x0d, 0x0a, 0x22, 
-0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 
-0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x36, 
-0x33, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x32, 0x33, 0x0d, 
-0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 
-0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x34, 0x36, 0x35, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x37, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 0x73, 0x4c, 
-0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x4e, 0x57, 0x31, 0x32, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x36, 0x37, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x37, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x56, 0x6f, 0x69, 0x64, 0x4d, 0x50, 0x49, 
-0x6d, 0x6d, 0x6f, 0x72, 0x74, 0x61, 0x6c, 0x52, 0x65, 0x76, 0x69, 0x76, 0x65, 0x43, 0x6f, 0x72, 
-0x70, 0x73, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x32, 0x35, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 
-0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x20, 0x30, 
-0x20, 0x32, 0x34, 0x37, 0x31, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 
-0x32, 0x36, 0x0d, 0x0a, 0x22, 0x47, 0x75, 0x61, 0x72, 0x64, 0x69, 0x61, 0x6e, 0x43, 0x6f, 0x63, 
-0x6f, 0x6f, 0x6e, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 
-0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x33, 0x20, 0x37, 0x20, 0x0d, 
-0x0a, 0x31, 0x2e, 0x34, 0x30, 0x36, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x37, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x47, 0x75, 0x61, 0x72, 0x64, 0x69, 0x61, 0x6e, 0x4d, 
-0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x32, 
-0x30, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x37, 0x20, 0x0d, 0x0a, 0x31, 
-0x2e, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x32, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x39, 0x20, 0x31, 0x2e, 0x33, 0x30, 0x30, 0x30, 0x35, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x32, 0x34, 0x37, 0x39, 0x20, 0x31, 0x20, 0x36, 
-0x34, 0x30, 0x2e, 0x30, 0x31, 0x36, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 
-0x32, 0x38, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x76, 0x6f, 0x75, 0x72, 0x65, 0x72, 0x43, 0x6f, 0x63, 
-0x6f, 0x6f, 0x6e, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 
-0x30, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x33, 0x20, 0x37, 0x20, 0x0d, 
-0x0a, 0x31, 0x2e, 0x34, 0x30, 0x36, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x37, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x76, 0x6f, 0x75, 0x72, 0x65, 0x72, 0x4d, 
-0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x35, 0x30, 0x0d, 0x0a, 0x31, 
-0x35, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x37, 0x20, 0x0d, 0x0a, 0x32, 
-0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x32, 0x35, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x33, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 
-0x20, 0x30, 0x20, 0x32, 0x34, 0x38, 0x31, 0x20, 0x31, 0x20, 0x36, 0x34, 0x30, 0x2e, 0x30, 0x31, 
-0x36, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x31, 
-0x30, 0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x44, 
-0x65, 0x66, 0x69, 0x6c, 0x65, 0x72, 0x4d, 0x50, 0x42, 0x75, 0x72, 0x72, 0x6f, 0x77, 0x65, 0x64, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x33, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x32, 0x34, 0x38, 0x39, 0x20, 0x31, 
-0x20, 0x32, 0x34, 0x2e, 0x32, 0x39, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x35, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 0x31, 
-0x0d, 0x0a, 0x22, 0x44, 0x65, 0x66, 0x69, 0x6c, 0x65, 0x72, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x33, 0x20, 0x36, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x32, 0x34, 0x39, 0x31, 0x20, 0x31, 0x20, 
-0x38, 0x2e, 0x38, 0x30, 0x30, 0x37, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 
-0x32, 0x0d, 0x0a, 0x22, 0x4f, 0x72, 0x61, 0x63, 0x6c, 0x65, 0x53, 0x74, 0x61, 0x73, 0x69, 0x73, 
-0x54, 0x72, 0x61, 0x70, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x35, 0x30, 0x35, 0x20, 
-0x32, 0x20, 0x38, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x34, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 0x33, 0x0d, 0x0a, 0x22, 
-0x44, 0x69, 0x73, 0x72, 0x75, 0x70, 0x74, 0x6f, 0x72, 0x50, 0x68, 0x61, 0x73, 0x65, 0x64, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x32, 0x35, 0x34, 0x36, 0x20, 0x32, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x4c, 0x69, 0x62, 
-0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x41, 0x47, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x34, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x37, 
-0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x31, 0x30, 0x20, 0x31, 0x2e, 0x36, 
-0x30, 0x30, 0x31, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x32, 0x35, 0x35, 0x34, 0x20, 
-0x30, 0x20, 0x36, 0x34, 0x2e, 0x36, 0x36, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 
-0x31, 0x0d, 0x0a, 0x36, 0x38, 0x39, 0x20, 0x0d, 0x0a, 0x36, 0x38, 0x39, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 
-0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 
-0x6e, 0x65, 0x64, 0x4e, 0x45, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x35, 0x36, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 
-0x36, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 
-0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x4e, 0x45, 0x38, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x35, 0x36, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 
-0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 0x6e, 
-0x65, 0x64, 0x4e, 0x45, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x35, 0x36, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 
-0x38, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 
-0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x4e, 0x45, 0x31, 0x30, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x35, 0x37, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 
-0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 
-0x6e, 0x65, 0x64, 0x4e, 0x45, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x35, 0x37, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 
-0x34, 0x30, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x4e, 0x45, 0x31, 
-0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x35, 0x37, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 
-0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 
-0x6f, 0x6e, 0x65, 0x64, 0x4e, 0x57, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x35, 0x37, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 
-0x34, 0x32, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x4e, 0x57, 0x38, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x35, 0x37, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 
-0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 
-0x6e, 0x65, 0x64, 0x4e, 0x57, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x35, 0x38, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 
-0x34, 0x34, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x4e, 0x57, 0x31, 
-0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x35, 0x38, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 
-0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 
-0x6f, 0x6e, 0x65, 0x64, 0x4e, 0x57, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x35, 0x38, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x37, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x42, 
-0x72, 0x69, 0x64, 0x67, 0x65, 0x41, 0x62, 0x61, 0x6e, 0x64, 0x6f, 0x6e, 0x65, 0x64, 0x4e, 0x57, 
-0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x35, 0x38, 0x36, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 
-0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 0x65, 0x72, 
-0x54, 0x6f, 0x77, 0x65, 0x72, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x36, 0x30, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x37, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 
-0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x45, 0x38, 0x4f, 0x75, 0x74, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x30, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 
-0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 
-0x45, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x30, 0x34, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 
-0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 
-0x74, 0x53, 0x45, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x30, 
-0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x35, 0x31, 0x0d, 
-0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 
-0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x45, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x36, 0x30, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x35, 
-0x32, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 
-0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x57, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x31, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x37, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 
-0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x57, 0x38, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x31, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 
-0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 
-0x57, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x31, 0x34, 0x20, 
-0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x35, 0x35, 0x0d, 0x0a, 0x22, 
-0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 
-0x55, 0x6e, 0x69, 0x74, 0x53, 0x57, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x31, 
-0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x35, 0x36, 0x0d, 
-0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 
-0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x45, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x36, 0x31, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x37, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 
-0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x45, 0x31, 0x30, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x32, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 
-0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 
-0x45, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x32, 0x32, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x35, 0x39, 0x0d, 0x0a, 
-0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 
-0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x45, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x36, 0x32, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x36, 
-0x30, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 
-0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x57, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x32, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x36, 0x31, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 
-0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x57, 
-0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x32, 0x38, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 
-0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 
-0x74, 0x53, 0x57, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 
-0x33, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x36, 0x33, 
-0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 
-0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x57, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x36, 0x33, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x37, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 
-0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x45, 0x31, 0x32, 0x4f, 0x75, 
-0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x33, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 
-0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 
-0x4e, 0x45, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x33, 0x36, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x50, 
-0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 
-0x6e, 0x69, 0x74, 0x53, 0x45, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x36, 0x33, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 
-0x36, 0x37, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x45, 0x31, 0x32, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x36, 0x34, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x37, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 
-0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x57, 0x31, 0x32, 
-0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x34, 0x32, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 
-0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 
-0x69, 0x74, 0x4e, 0x57, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x34, 0x34, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x37, 0x30, 0x0d, 0x0a, 
-0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 
-0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x57, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x36, 0x34, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x37, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 
-0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x57, 0x31, 0x32, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x34, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 
-0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x38, 
-0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x35, 0x30, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 
-0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 
-0x69, 0x74, 0x4e, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x35, 0x32, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x50, 
-0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 
-0x6e, 0x69, 0x74, 0x53, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 
-0x35, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x37, 0x35, 
-0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 
-0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x36, 0x35, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x37, 
-0x36, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 
-0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x45, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x36, 0x35, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x37, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 
-0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x45, 0x38, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x36, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x37, 0x37, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 
-0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x57, 0x38, 0x4f, 
-0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x36, 0x32, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 
-0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 
-0x74, 0x57, 0x38, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x36, 0x34, 0x20, 0x30, 0x20, 
-0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 
-0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 
-0x69, 0x74, 0x4e, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 
-0x36, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x38, 0x31, 
-0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 
-0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x36, 0x36, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 
-0x38, 0x32, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x37, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 
-0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x31, 
-0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x37, 0x32, 0x20, 0x30, 0x20, 0x34, 0x38, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 
-0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 
-0x45, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x37, 0x34, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x38, 0x35, 0x0d, 0x0a, 
-0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 
-0x5f, 0x55, 0x6e, 0x69, 0x74, 0x45, 0x31, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 
-0x37, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x38, 0x36, 
-0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 
-0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x57, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x36, 0x37, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x37, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 
-0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x57, 0x31, 0x30, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x38, 0x30, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 
-0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x4e, 0x31, 
-0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x38, 0x32, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x50, 
-0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 
-0x6e, 0x69, 0x74, 0x4e, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x38, 0x34, 
-0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x39, 0x30, 0x0d, 0x0a, 
-0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 
-0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x36, 0x38, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x37, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 
-0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x53, 0x31, 0x32, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x36, 0x38, 0x38, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x37, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 
-0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x45, 0x31, 0x32, 0x4f, 
-0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x39, 0x30, 0x20, 0x30, 0x20, 0x34, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 
-0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 
-0x74, 0x45, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 0x36, 0x39, 0x32, 0x20, 0x30, 
-0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x50, 
-0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x5f, 0x55, 
-0x6e, 0x69, 0x74, 0x57, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x36, 0x39, 0x34, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x39, 
-0x35, 0x0d, 0x0a, 0x22, 0x50, 0x6f, 0x72, 0x74, 0x43, 0x69, 0x74, 0x79, 0x5f, 0x42, 0x72, 0x69, 
-0x64, 0x67, 0x65, 0x5f, 0x55, 0x6e, 0x69, 0x74, 0x57, 0x31, 0x32, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x36, 0x39, 0x36, 0x20, 0x30, 0x20, 0x34, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x37, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 0x65, 0x72, 0x52, 0x69, 
-0x63, 0x68, 0x4d, 0x69, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 
-0x39, 0x37, 0x0d, 0x0a, 0x22, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 0x65, 0x72, 0x52, 0x69, 0x63, 
-0x68, 0x4d, 0x69, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 0x64, 0x37, 0x35, 0x30, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x37, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 
-0x6c, 0x65, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 0x65, 0x72, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x50, 
-0x75, 0x73, 0x68, 0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x37, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x4c, 
-0x6f, 0x63, 0x75, 0x73, 0x74, 0x4d, 0x50, 0x50, 0x72, 0x65, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x30, 
-0x30, 0x0d, 0x0a, 0x22, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x49, 0x6e, 0x74, 0x65, 0x72, 
-0x63, 0x65, 0x70, 0x74, 0x6f, 0x72, 0x73, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x30, 0x31, 0x0d, 0x0a, 
-0x22, 0x41, 0x64, 0x65, 0x70, 0x74, 0x50, 0x68, 0x61, 0x73, 0x65, 0x53, 0x68, 0x69, 0x66, 0x74, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x34, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x31, 0x31, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 
-0x61, 0x67, 0x65, 0x72, 0x43, 0x6f, 0x72, 0x72, 0x6f, 0x73, 0x69, 0x76, 0x65, 0x42, 0x69, 0x6c, 
-0x65, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x48, 0x79, 0x64, 0x72, 
-0x61, 0x6c, 0x69, 0x73, 0x6b, 0x49, 0x6d, 0x70, 0x61, 0x6c, 0x65, 0x4d, 0x69, 0x73, 0x73, 0x69, 
-0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x38, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x43, 0x79, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x4d, 0x69, 0x73, 
-0x73, 0x69, 0x6c, 0x65, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x41, 0x69, 0x72, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x30, 0x35, 0x0d, 0x0a, 0x22, 
-0x43, 0x79, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x30, 0x36, 0x0d, 
-0x0a, 0x22, 0x43, 0x79, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 
-0x4c, 0x61, 0x72, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x38, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x54, 0x68, 0x6f, 0x72, 0x41, 0x41, 0x4c, 
-0x61, 0x6e, 0x63, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x4f, 0x72, 0x61, 0x63, 0x6c, 0x65, 0x57, 0x65, 
-0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x54, 0x65, 0x6d, 0x70, 0x65, 0x73, 0x74, 0x57, 
-0x65, 0x61, 0x70, 0x6f, 0x6e, 0x47, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x52, 
-0x61, 0x76, 0x61, 0x67, 0x65, 0x72, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x4d, 0x69, 0x73, 0x73, 
-0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x38, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x63, 0x6f, 0x75, 0x74, 0x4d, 0x50, 0x41, 0x69, 
-0x72, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x4c, 0x65, 0x66, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x53, 
-0x63, 0x6f, 0x75, 0x74, 0x4d, 0x50, 0x41, 0x69, 0x72, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x52, 
-0x69, 0x67, 0x68, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x41, 0x72, 0x62, 0x69, 0x74, 0x65, 0x72, 0x4d, 
-0x50, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x31, 0x34, 0x0d, 
-0x0a, 0x22, 0x47, 0x75, 0x61, 0x72, 0x64, 0x69, 0x61, 0x6e, 0x4d, 0x50, 0x57, 0x65, 0x61, 0x70, 
-0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x38, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x76, 0x6f, 0x75, 0x72, 0x65, 0x72, 0x4d, 0x50, 
-0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x31, 0x36, 0x0d, 0x0a, 
-0x22, 0x44, 0x65, 0x66, 0x69, 0x6c, 0x65, 0x72, 0x4d, 0x50, 0x44, 0x61, 0x72, 0x6b, 0x53, 0x77, 
-0x61, 0x72, 0x6d, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x31, 0x37, 0x0d, 0x0a, 0x22, 0x51, 0x75, 0x65, 
-0x65, 0x6e, 0x4d, 0x50, 0x45, 0x6e, 0x73, 0x6e, 0x61, 0x72, 0x65, 0x4d, 0x69, 0x73, 0x73, 0x69, 
-0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x38, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x51, 0x75, 0x65, 0x65, 0x6e, 0x4d, 0x50, 0x53, 0x70, 0x61, 
-0x77, 0x6e, 0x42, 0x72, 0x6f, 0x6f, 0x64, 0x6c, 0x69, 0x6e, 0x67, 0x73, 0x4d, 0x69, 0x73, 0x73, 
-0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x38, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x6e, 0x69, 0x6e, 0x67, 
-0x42, 0x6f, 0x6d, 0x62, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x48, 0x45, 
-0x52, 0x43, 0x50, 0x6c, 0x61, 0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x31, 0x20, 0x32, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 
-0x36, 0x20, 0x31, 0x2e, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x33, 
-0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x32, 0x31, 0x0d, 0x0a, 0x22, 
-0x47, 0x72, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x32, 0x32, 0x0d, 0x0a, 
-0x22, 0x43, 0x61, 0x75, 0x73, 0x74, 0x69, 0x63, 0x53, 0x70, 0x72, 0x61, 0x79, 0x4d, 0x69, 0x73, 
-0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x50, 0x61, 0x72, 0x61, 0x73, 0x69, 0x74, 0x69, 
-0x63, 0x42, 0x6f, 0x6d, 0x62, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x32, 0x34, 0x0d, 0x0a, 0x22, 
-0x50, 0x61, 0x72, 0x61, 0x73, 0x69, 0x74, 0x69, 0x63, 0x42, 0x6f, 0x6d, 0x62, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x38, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x41, 0x64, 0x65, 0x70, 0x74, 0x57, 0x65, 0x61, 0x70, 0x6f, 
-0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 
-0x32, 0x36, 0x0d, 0x0a, 0x22, 0x41, 0x64, 0x65, 0x70, 0x74, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 
-0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x4c, 0x69, 0x62, 0x65, 0x72, 
-0x61, 0x74, 0x6f, 0x72, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x4c, 
-0x69, 0x62, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x44, 0x61, 0x6d, 0x61, 0x67, 0x65, 0x4d, 0x69, 
-0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x38, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x4c, 0x69, 0x62, 0x65, 0x72, 0x61, 0x74, 
-0x6f, 0x72, 0x41, 0x47, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x4b, 
-0x44, 0x38, 0x43, 0x68, 0x61, 0x72, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x4b, 0x44, 
-0x38, 0x43, 0x68, 0x61, 0x72, 0x67, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x33, 0x32, 0x0d, 0x0a, 
-0x22, 0x53, 0x6c, 0x61, 0x79, 0x6e, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x47, 
-0x72, 0x61, 0x62, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x33, 0x33, 0x0d, 0x0a, 0x22, 0x53, 0x6c, 0x61, 
-0x79, 0x6e, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x47, 0x72, 0x61, 0x62, 0x41, 
-0x69, 0x72, 0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x34, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x53, 0x6c, 0x61, 0x79, 
-0x6e, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x47, 0x72, 0x61, 0x62, 0x47, 0x72, 
-0x6f, 0x75, 0x6e, 0x64, 0x55, 0x6e, 0x69, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x34, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x6c, 
-0x61, 0x79, 0x6e, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x57, 0x65, 0x61, 0x70, 
-0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x38, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 
-0x6c, 0x65, 0x45, 0x78, 0x70, 0x65, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x47, 0x61, 0x74, 0x65, 
-0x36, 0x78, 0x36, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x73, 0x74, 0x72, 
-0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x5a, 0x65, 0x72, 0x67, 0x49, 0x6e, 0x66, 0x65, 0x73, 
-0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x33, 0x78, 0x33, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x33, 0x38, 0x0d, 0x0a, 
-0x22, 0x48, 0x45, 0x52, 0x43, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x30, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 
-0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x20, 0x32, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x36, 0x20, 0x31, 0x2e, 0x35, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x4d, 0x6f, 0x6f, 0x70, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 
-0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x33, 0x20, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x2e, 0x31, 
-0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 0x31, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x34, 0x30, 0x0d, 0x0a, 0x22, 
-0x52, 0x65, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x34, 
-0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 
-0x20, 0x33, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x65, 0x65, 0x6b, 0x65, 0x72, 0x4d, 0x69, 
-0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x2e, 0x30, 0x39, 0x37, 0x36, 0x35, 
-0x36, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x34, 0x32, 0x0d, 0x0a, 
-0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 
-0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x4e, 0x45, 0x38, 
-0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 
-0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 
-0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x4e, 0x45, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x34, 
-0x34, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 
-0x4e, 0x45, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x41, 0x69, 
-0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x4e, 0x57, 0x38, 0x4f, 0x75, 0x74, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x38, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 
-0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 
-0x62, 0x6c, 0x65, 0x4e, 0x57, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x34, 0x37, 0x0d, 0x0a, 
-0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 
-0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x4e, 0x57, 0x31, 
-0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 
-0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 
-0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x57, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x34, 
-0x39, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 
-0x69, 0x64, 0x67, 0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 
-0x53, 0x57, 0x31, 0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x41, 0x69, 
-0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x57, 0x31, 0x32, 0x4f, 0x75, 
-0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 
-0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
-0x69, 0x62, 0x6c, 0x65, 0x53, 0x45, 0x38, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x35, 0x32, 0x0d, 0x0a, 
-0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 
-0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x45, 0x31, 
-0x30, 0x4f, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x41, 0x69, 0x75, 0x72, 0x54, 
-0x65, 0x6d, 0x70, 0x6c, 0x65, 0x42, 0x72, 0x69, 0x64, 0x67, 0x65, 0x44, 0x65, 0x73, 0x74, 0x72, 
-0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x53, 0x45, 0x31, 0x32, 0x4f, 0x75, 0x74, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 
-0x35, 0x34, 0x0d, 0x0a, 0x22, 0x46, 0x6c, 0x79, 0x6f, 0x76, 0x65, 0x72, 0x55, 0x6e, 0x69, 0x74, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x2e, 0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x72, 0x73, 0x61, 0x69, 0x72, 0x4d, 
-0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 
-0x31, 0x32, 0x35, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x35, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 0x30, 0x2e, 0x34, 0x37, 0x32, 0x34, 0x31, 
-0x32, 0x0d, 0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x63, 0x6f, 0x75, 0x74, 0x4d, 
-0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x37, 0x35, 0x0d, 0x0a, 0x31, 
-0x32, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x38, 
-0x31, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x38, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x31, 0x2e, 0x36, 0x39, 0x34, 0x30, 0x39, 
-0x0d, 0x0a, 0x32, 0x20, 0x37, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x37, 0x0d, 0x0a, 0x32, 
-0x20, 0x34, 0x20, 0x31, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x35, 0x37, 0x0d, 0x0a, 0x22, 
-0x41, 0x72, 0x62, 0x69, 0x74, 0x65, 0x72, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x33, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 
-0x20, 0x34, 0x20, 0x0d, 0x0a, 0x32, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x33, 0x20, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x35, 0x20, 
-0x31, 0x2e, 0x35, 0x0d, 0x0a, 0x0d, 0x0a, 0x34, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x63, 0x6f, 0x75, 
-0x72, 0x67, 0x65, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x32, 
-0x0d, 0x0a, 0x33, 0x37, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x33, 
-0x2e, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x31, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x20, 0x30, 0x2e, 0x38, 0x33, 0x33, 0x32, 
-0x35, 0x32, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x2e, 0x35, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x44, 0x65, 0x66, 
-0x69, 0x6c, 0x65, 0x72, 0x4d, 0x50, 0x50, 0x6c, 0x61, 0x67, 0x75, 0x65, 0x57, 0x65, 0x61, 0x70, 
-0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x38, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x51, 0x75, 0x65, 0x65, 0x6e, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 
-0x20, 0x0d, 0x0a, 0x33, 0x2e, 0x32, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x38, 0x36, 0x31, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 
-0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x53, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x58, 
-0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 
-0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x53, 0x45, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 
-0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 
-0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x36, 0x34, 0x0d, 0x0a, 0x22, 
-0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 
-0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x4e, 
-0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x38, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 
-0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 
-0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x4e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x36, 0x36, 0x0d, 0x0a, 
-0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
-0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 
-0x4e, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 
-0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 
-0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x36, 0x38, 0x0d, 
-0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 
-0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 
-0x36, 0x53, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 
-0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 
-0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x38, 0x53, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x37, 0x30, 
-0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 
-0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 
-0x72, 0x38, 0x53, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 
-0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 
-0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x38, 0x45, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x37, 
-0x32, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 
-0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 
-0x65, 0x72, 0x38, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 
-0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 
-0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x38, 0x4e, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 
-0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 
-0x37, 0x34, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 
-0x6b, 0x65, 0x72, 0x38, 0x4e, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x58, 0x65, 
-0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 
-0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x38, 0x57, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x38, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 
-0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x61, 0x6d, 0x70, 0x42, 0x6c, 0x6f, 
-0x63, 0x6b, 0x65, 0x72, 0x38, 0x53, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x52, 
-0x65, 0x70, 0x74, 0x69, 0x6c, 0x65, 0x43, 0x72, 0x61, 0x74, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x37, 0x38, 0x0d, 0x0a, 
-0x22, 0x53, 0x6c, 0x61, 0x79, 0x6e, 0x53, 0x77, 0x61, 0x72, 0x6d, 0x48, 0x6f, 0x73, 0x74, 0x53, 
-0x70, 0x61, 0x77, 0x6e, 0x46, 0x6c, 0x79, 0x65, 0x72, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x53, 
-0x6c, 0x61, 0x79, 0x6e, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x32, 
-0x20, 0x33, 0x20, 0x37, 0x20, 0x31, 0x30, 0x20, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x50, 0x75, 0x72, 0x69, 0x66, 
-0x69, 0x65, 0x72, 0x56, 0x65, 0x73, 0x70, 0x65, 0x6e, 0x65, 0x47, 0x65, 0x79, 0x73, 0x65, 0x72, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x38, 0x38, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x61, 0x6b, 0x75, 0x72, 0x61, 
-0x73, 0x56, 0x65, 0x73, 0x70, 0x65, 0x6e, 0x65, 0x47, 0x65, 0x79, 0x73, 0x65, 0x72, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x33, 0x34, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x38, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 
-0x6c, 0x65, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 0x65, 0x72, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x44, 
-0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x43, 
-0x72, 0x65, 0x65, 0x70, 0x4f, 0x6e, 0x6c, 0x79, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x34, 
-0x78, 0x34, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x38, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 0x65, 0x72, 0x4d, 0x69, 
-0x6e, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x38, 0x35, 0x0d, 0x0a, 
-0x22, 0x50, 0x75, 0x72, 0x69, 0x66, 0x69, 0x65, 0x72, 0x4d, 0x69, 0x6e, 0x65, 0x72, 0x61, 0x6c, 
-0x46, 0x69, 0x65, 0x6c, 0x64, 0x37, 0x35, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x42, 
-0x61, 0x74, 0x74, 0x6c, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4d, 0x69, 0x6e, 0x65, 
-0x72, 0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x42, 
-0x61, 0x74, 0x74, 0x6c, 0x65, 0x53, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x4d, 0x69, 0x6e, 0x65, 
-0x72, 0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 0x64, 0x37, 0x35, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x38, 0x38, 0x0d, 
-0x0a, 0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x4e, 0x6f, 0x76, 0x61, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x38, 0x39, 0x0d, 0x0a, 
-0x22, 0x42, 0x65, 0x61, 0x63, 0x6f, 0x6e, 0x5f, 0x4e, 0x6f, 0x76, 0x61, 0x53, 0x6d, 0x61, 0x6c, 
-0x6c, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 
-0x39, 0x30, 0x0d, 0x0a, 0x22, 0x55, 0x72, 0x73, 0x75, 0x6c, 0x61, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x33, 0x20, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x38, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x39, 0x31, 0x0d, 0x0a, 
-0x22, 0x45, 0x6c, 0x73, 0x65, 0x63, 0x61, 0x72, 0x6f, 0x5f, 0x43, 0x6f, 0x6c, 0x6f, 0x6e, 0x69, 
-0x73, 0x74, 0x5f, 0x48, 0x75, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x39, 0x32, 
-0x0d, 0x0a, 0x22, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x4f, 0x76, 0x65, 0x72, 
-0x6c, 0x6f, 0x72, 0x64, 0x43, 0x6f, 0x63, 0x6f, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x33, 0x20, 0x0d, 0x0a, 0x31, 0x2e, 0x38, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x38, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x4f, 0x76, 0x65, 0x72, 0x6c, 0x6f, 0x72, 0x64, 
-0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x33, 
-0x20, 0x0d, 0x0a, 0x30, 0x2e, 0x36, 0x34, 0x34, 0x35, 0x33, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x38, 0x20, 0x32, 0x37, 0x30, 0x38, 0x20, 0x31, 0x20, 
-0x32, 0x36, 0x36, 0x2e, 0x36, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x31, 0x20, 0x31, 0x0d, 
-0x0a, 0x31, 0x30, 0x36, 0x20, 0x0d, 0x0a, 0x30, 0x20, 0x31, 0x30, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x38, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x50, 0x79, 0x6c, 0x6f, 0x6e, 0x4f, 0x76, 
-0x65, 0x72, 0x63, 0x68, 0x61, 0x72, 0x67, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 
-0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x38, 0x20, 0x32, 0x37, 0x31, 0x36, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 
-0x20, 0x32, 0x0d, 0x0a, 0x36, 0x30, 0x20, 0x36, 0x30, 0x20, 0x0d, 0x0a, 0x36, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x42, 0x79, 0x70, 
-0x61, 0x73, 0x73, 0x41, 0x72, 0x6d, 0x6f, 0x72, 0x44, 0x72, 0x6f, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x31, 
-0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x37, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x38, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x41, 0x64, 0x65, 0x70, 0x74, 0x50, 0x69, 0x65, 0x72, 
-0x63, 0x69, 0x6e, 0x67, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x39, 0x37, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 
-0x72, 0x72, 0x6f, 0x73, 0x69, 0x76, 0x65, 0x50, 0x61, 0x72, 0x61, 0x73, 0x69, 0x74, 0x65, 0x57, 
-0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x38, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 
-0x64, 0x54, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x4d, 0x65, 0x72, 0x63, 0x43, 
-0x6f, 0x6d, 0x70, 0x6f, 0x75, 0x6e, 0x64, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x75, 0x70, 0x70, 0x6c, 
-0x79, 0x44, 0x65, 0x70, 0x6f, 0x74, 0x44, 0x72, 0x6f, 0x70, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x4c, 0x75, 
-0x72, 0x6b, 0x65, 0x72, 0x44, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x44, 0x38, 0x43, 0x68, 0x61, 
-0x72, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x39, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x54, 0x68, 0x6f, 0x72, 0x57, 0x72, 0x65, 0x63, 0x6b, 
-0x61, 0x67, 0x65, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x39, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x47, 0x6f, 0x6c, 0x69, 0x61, 0x74, 0x68, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x30, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x30, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x31, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x31, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x32, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x32, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x32, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x33, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x33, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x34, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x34, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x34, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x35, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x35, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x36, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x36, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x36, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x37, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x37, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x37, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x38, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x38, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x38, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x39, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x39, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x39, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x39, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x39, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x30, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x30, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x30, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x30, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x31, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x30, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x31, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 
-0x31, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x31, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x30, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x32, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x30, 0x32, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x32, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x30, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x32, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x30, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x32, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 
-0x33, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x33, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x30, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x33, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x30, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x33, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x30, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x34, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x30, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x34, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 
-0x34, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x34, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x30, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x35, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x30, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x35, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x30, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x35, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x30, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x36, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 
-0x36, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x36, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x30, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x36, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x30, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x37, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x30, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x37, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x30, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x37, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 
-0x37, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x38, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x30, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x38, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x30, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x38, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x30, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x39, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x30, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x39, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 
-0x39, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x39, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x30, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x30, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x30, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x31, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x30, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x31, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x30, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x31, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x30, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 
-0x31, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x31, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x31, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x31, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x31, 0x31, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x31, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x31, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x32, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x32, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x31, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x32, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 
-0x32, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x32, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x31, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x33, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x31, 0x33, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x33, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x31, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x33, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x31, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x34, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 
-0x34, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x34, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x31, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x34, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x31, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x35, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x31, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x35, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x31, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x35, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 
-0x35, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x36, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x31, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x36, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x31, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x36, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x31, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x37, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x31, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x37, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 
-0x37, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x37, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x31, 0x37, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x38, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x31, 0x38, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x38, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x31, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x38, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x31, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x38, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 
-0x39, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x39, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x31, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x39, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x31, 0x39, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x31, 0x39, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x32, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x30, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x32, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x30, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 
-0x30, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x30, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x32, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x31, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x32, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x31, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x32, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x31, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x31, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x32, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x32, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 
-0x32, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x32, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x32, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x32, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x32, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x33, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x32, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x33, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x33, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x32, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x33, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 
-0x33, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x34, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x32, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x34, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x32, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x34, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x32, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x32, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 
-0x35, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x35, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x32, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x36, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x32, 0x36, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x36, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x32, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x36, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x32, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x36, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 
-0x37, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x37, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x32, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x37, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x32, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x37, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x37, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x32, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x38, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x38, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x32, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x38, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 
-0x38, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x38, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x32, 0x39, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x39, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x32, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x39, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x32, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x39, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x32, 0x39, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x32, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x30, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 
-0x30, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x30, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x33, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x30, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x31, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x33, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x31, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x33, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x31, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 
-0x31, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x32, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x33, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x32, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x32, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x33, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x33, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x33, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x33, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 
-0x33, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x33, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x33, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x34, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x34, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x33, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x34, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x33, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x34, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 
-0x35, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x35, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x33, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x35, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x35, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x33, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x36, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x36, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x33, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x36, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 
-0x36, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x36, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x33, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x37, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x37, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x33, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x37, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x33, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x38, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 
-0x38, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x38, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x33, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x38, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x33, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x39, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x39, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x33, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x39, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x33, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x39, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x33, 
-0x39, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x33, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x30, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x34, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x30, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x34, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x30, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x34, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x31, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x34, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x31, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 
-0x31, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x31, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x34, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x32, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x34, 0x32, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x32, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x34, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x32, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x34, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x32, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 
-0x33, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x33, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x34, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x33, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x34, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x33, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x34, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x34, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x34, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x34, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 
-0x34, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x34, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x34, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x35, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x34, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x35, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x34, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x35, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x34, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x36, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 
-0x36, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x36, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x34, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x36, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x34, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x37, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x34, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x37, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x34, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x37, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 
-0x37, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x38, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x34, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x38, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x34, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x38, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x34, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x39, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x34, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x39, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 
-0x39, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x39, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x34, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x34, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x35, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x35, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x35, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 
-0x31, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x31, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x35, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x31, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x35, 0x31, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x31, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x35, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x32, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x32, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x35, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x32, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 
-0x32, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x32, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x35, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x33, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x35, 0x33, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x33, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x35, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x33, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x35, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x34, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 
-0x34, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x34, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x35, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x34, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x35, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x35, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x35, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x35, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x35, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x35, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x35, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 
-0x35, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x36, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x35, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x36, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x35, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x36, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x35, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x37, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x35, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x37, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 
-0x37, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x37, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x35, 0x37, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x38, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x35, 0x38, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x38, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x38, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x35, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x38, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x35, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x38, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 
-0x39, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x39, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x35, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x39, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x35, 0x39, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x39, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x35, 0x39, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x36, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x30, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x36, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x30, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 
-0x30, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x30, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x36, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x31, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x36, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x31, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x36, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x31, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x31, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x36, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x32, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 
-0x32, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x32, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x36, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x32, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x36, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x33, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x36, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x33, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x33, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x36, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x33, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 
-0x33, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x34, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x36, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x34, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x36, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x34, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x36, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x35, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x36, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x35, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 
-0x35, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x35, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x36, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x35, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x36, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x36, 0x36, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x36, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x36, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x36, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x36, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x36, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 
-0x37, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x37, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x36, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x37, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x37, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x36, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x37, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x37, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x36, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x38, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x38, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x36, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x38, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 
-0x38, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x38, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x36, 0x39, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x39, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x36, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x39, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x36, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x39, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x36, 0x39, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x36, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x30, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 
-0x30, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x30, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x37, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x30, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x37, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x31, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x37, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x31, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x37, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x31, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 
-0x31, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x32, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x32, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x37, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x32, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x37, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x32, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x32, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x37, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x33, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x37, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x33, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 
-0x33, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x33, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x37, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x33, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x34, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x37, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x34, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x37, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x34, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x37, 0x34, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x34, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 
-0x35, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x35, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x37, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x35, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x37, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x35, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x37, 0x36, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x36, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x36, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x37, 0x36, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x36, 0x35, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 
-0x36, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x36, 
-0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x37, 0x37, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x37, 0x32, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x37, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x37, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x37, 0x35, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x37, 0x37, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x37, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x37, 0x38, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x37, 0x37, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x38, 0x31, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 
-0x38, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x38, 0x34, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x38, 
-0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x37, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x38, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x38, 0x38, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x37, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x39, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x39, 0x31, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x37, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x39, 0x34, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x37, 0x39, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x39, 0x37, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x37, 
-0x39, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x37, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x30, 0x30, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x30, 
-0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x38, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x30, 0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x30, 0x34, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x38, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x30, 0x36, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x30, 0x37, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x38, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x30, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x31, 0x30, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x38, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x31, 0x33, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 
-0x31, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x31, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x31, 
-0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x38, 0x31, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x31, 0x39, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x32, 0x30, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x38, 0x32, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x32, 0x33, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x38, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x32, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x32, 0x36, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x38, 0x32, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x32, 0x39, 0x0d, 0x0a, 0x22, 
-0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 
-0x33, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x33, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x22, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x33, 
-0x33, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x38, 0x33, 0x34, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x33, 0x36, 
-0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x38, 0x33, 0x37, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x33, 0x39, 0x0d, 
-0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x38, 0x34, 0x30, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x34, 0x32, 0x0d, 0x0a, 
-0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x38, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x51, 0x75, 0x65, 0x65, 0x6e, 0x5a, 0x61, 0x67, 0x61, 0x72, 
-0x61, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x38, 0x34, 0x34, 0x0d, 0x0a, 0x22, 0x4f, 0x76, 0x65, 0x72, 0x73, 0x65, 0x65, 0x72, 0x5a, 
-0x61, 0x67, 0x61, 0x72, 0x61, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 
-0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x75, 0x6b, 0x6f, 
-0x76, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x43, 0x69, 0x76, 0x69, 0x6c, 0x69, 0x61, 
-0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x38, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x75, 0x6b, 0x6f, 0x76, 0x49, 0x6e, 0x66, 
-0x65, 0x73, 0x74, 0x65, 0x64, 0x4d, 0x61, 0x72, 0x69, 0x6e, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x34, 0x37, 0x0d, 0x0a, 
-0x22, 0x53, 0x74, 0x75, 0x6b, 0x6f, 0x76, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x53, 
-0x69, 0x65, 0x67, 0x65, 0x54, 0x61, 0x6e, 0x6b, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 
-0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x53, 0x74, 
-0x75, 0x6b, 0x6f, 0x76, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x44, 0x69, 0x61, 0x6d, 
-0x6f, 0x6e, 0x64, 0x62, 0x61, 0x63, 0x6b, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 
-0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x75, 
-0x6b, 0x6f, 0x76, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x42, 0x61, 0x6e, 0x73, 0x68, 
-0x65, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x38, 0x35, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x49, 0x4c, 0x69, 0x62, 0x65, 0x72, 0x61, 
-0x74, 0x6f, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 
-0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x38, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x75, 0x6b, 0x6f, 0x76, 0x49, 
-0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x42, 0x75, 0x6e, 0x6b, 0x65, 0x72, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x35, 0x32, 
-0x0d, 0x0a, 0x22, 0x53, 0x74, 0x75, 0x6b, 0x6f, 0x76, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 
-0x64, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x54, 0x75, 0x72, 0x72, 0x65, 0x74, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x35, 
-0x33, 0x0d, 0x0a, 0x22, 0x53, 0x74, 0x75, 0x6b, 0x6f, 0x76, 0x42, 0x72, 0x6f, 0x6f, 0x64, 0x51, 
-0x75, 0x65, 0x65, 0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x35, 0x34, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x61, 0x6c, 0x6f, 0x74, 
-0x46, 0x65, 0x6e, 0x69, 0x78, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 
-0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x53, 0x65, 0x6e, 0x74, 0x72, 
-0x79, 0x46, 0x65, 0x6e, 0x69, 0x78, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 
-0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x35, 0x36, 0x0d, 0x0a, 0x22, 0x41, 0x64, 0x65, 0x70, 
-0x74, 0x46, 0x65, 0x6e, 0x69, 0x78, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 
-0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x35, 0x37, 0x0d, 0x0a, 0x22, 0x49, 0x6d, 0x6d, 0x6f, 
-0x72, 0x74, 0x61, 0x6c, 0x46, 0x65, 0x6e, 0x69, 0x78, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x35, 0x38, 0x0d, 0x0a, 0x22, 0x43, 
-0x6f, 0x6c, 0x6f, 0x73, 0x73, 0x75, 0x73, 0x46, 0x65, 0x6e, 0x69, 0x78, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x35, 0x39, 0x0d, 
-0x0a, 0x22, 0x44, 0x69, 0x73, 0x72, 0x75, 0x70, 0x74, 0x6f, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 0x30, 0x0d, 0x0a, 
-0x22, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x46, 0x65, 0x6e, 0x69, 0x78, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 
-0x31, 0x0d, 0x0a, 0x22, 0x53, 0x63, 0x6f, 0x75, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 0x32, 0x0d, 0x0a, 0x22, 0x43, 
-0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x46, 0x65, 0x6e, 0x69, 0x78, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 0x33, 0x0d, 0x0a, 
-0x22, 0x50, 0x68, 0x6f, 0x74, 0x6f, 0x6e, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x46, 0x65, 0x6e, 
-0x69, 0x78, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x38, 0x36, 0x34, 0x0d, 0x0a, 0x22, 0x50, 0x72, 0x69, 0x6d, 0x61, 0x6c, 0x5a, 0x65, 
-0x72, 0x67, 0x6c, 0x69, 0x6e, 0x67, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 
-0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 0x35, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x61, 
-0x73, 0x61, 0x75, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 0x36, 0x0d, 0x0a, 0x22, 0x50, 0x72, 0x69, 0x6d, 0x61, 0x6c, 
-0x52, 0x6f, 0x61, 0x63, 0x68, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 
-0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 0x37, 0x0d, 0x0a, 0x22, 0x46, 0x69, 0x72, 0x65, 0x52, 
-0x6f, 0x61, 0x63, 0x68, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 0x38, 0x0d, 0x0a, 0x22, 0x50, 0x72, 0x69, 0x6d, 0x61, 0x6c, 
-0x47, 0x75, 0x61, 0x72, 0x64, 0x69, 0x61, 0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 
-0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x36, 0x39, 0x0d, 0x0a, 0x22, 0x50, 0x72, 
-0x69, 0x6d, 0x61, 0x6c, 0x48, 0x79, 0x64, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x37, 0x30, 
-0x0d, 0x0a, 0x22, 0x50, 0x72, 0x69, 0x6d, 0x61, 0x6c, 0x4d, 0x75, 0x74, 0x61, 0x6c, 0x69, 0x73, 
-0x6b, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x38, 0x37, 0x31, 0x0d, 0x0a, 0x22, 0x50, 0x72, 0x69, 0x6d, 0x61, 0x6c, 0x49, 0x6d, 0x70, 
-0x61, 0x6c, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x37, 0x32, 0x0d, 0x0a, 0x22, 0x50, 0x72, 0x69, 0x6d, 0x61, 0x6c, 
-0x53, 0x77, 0x61, 0x72, 0x6d, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x37, 0x33, 0x0d, 0x0a, 0x22, 0x43, 
-0x72, 0x65, 0x65, 0x70, 0x65, 0x72, 0x48, 0x6f, 0x73, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 
-0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x37, 0x34, 0x0d, 0x0a, 0x22, 
-0x50, 0x72, 0x69, 0x6d, 0x61, 0x6c, 0x55, 0x6c, 0x74, 0x72, 0x61, 0x6c, 0x69, 0x73, 0x6b, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 
-0x37, 0x35, 0x0d, 0x0a, 0x22, 0x54, 0x79, 0x72, 0x61, 0x6e, 0x6e, 0x6f, 0x7a, 0x6f, 0x72, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 
-0x37, 0x36, 0x0d, 0x0a, 0x22, 0x50, 0x72, 0x69, 0x6d, 0x61, 0x6c, 0x57, 0x75, 0x72, 0x6d, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 
-0x37, 0x37, 0x0d, 0x0a, 0x22, 0x48, 0x48, 0x52, 0x65, 0x61, 0x70, 0x65, 0x72, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x37, 0x38, 
-0x0d, 0x0a, 0x22, 0x48, 0x48, 0x57, 0x69, 0x64, 0x6f, 0x77, 0x4d, 0x69, 0x6e, 0x65, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x37, 
-0x39, 0x0d, 0x0a, 0x22, 0x48, 0x48, 0x48, 0x65, 0x6c, 0x6c, 0x69, 0x6f, 0x6e, 0x54, 0x61, 0x6e, 
-0x6b, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x38, 0x38, 0x30, 0x0d, 0x0a, 0x22, 0x48, 0x48, 0x57, 0x72, 0x61, 0x69, 0x74, 0x68, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 
-0x38, 0x31, 0x0d, 0x0a, 0x22, 0x48, 0x48, 0x56, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x38, 0x32, 
-0x0d, 0x0a, 0x22, 0x48, 0x48, 0x42, 0x61, 0x74, 0x74, 0x6c, 0x65, 0x63, 0x72, 0x75, 0x69, 0x73, 
-0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x38, 0x38, 0x33, 0x0d, 0x0a, 0x22, 0x48, 0x48, 0x52, 0x61, 0x76, 0x65, 0x6e, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 
-0x38, 0x34, 0x0d, 0x0a, 0x22, 0x48, 0x48, 0x42, 0x6f, 0x6d, 0x62, 0x65, 0x72, 0x50, 0x6c, 0x61, 
-0x74, 0x66, 0x6f, 0x72, 0x6d, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 
-0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x38, 0x35, 0x0d, 0x0a, 0x22, 0x48, 0x48, 0x4d, 0x65, 0x72, 
-0x63, 0x53, 0x74, 0x61, 0x72, 0x70, 0x6f, 0x72, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 
-0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x38, 0x36, 0x0d, 0x0a, 0x22, 0x48, 
-0x48, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x54, 0x75, 0x72, 0x72, 0x65, 0x74, 0x41, 0x43, 
-0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x38, 
-0x37, 0x0d, 0x0a, 0x22, 0x48, 0x69, 0x67, 0x68, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x72, 0x53, 
-0x6b, 0x69, 0x6e, 0x50, 0x72, 0x65, 0x76, 0x69, 0x65, 0x77, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x38, 0x38, 0x0d, 0x0a, 0x22, 0x57, 
-0x61, 0x72, 0x70, 0x50, 0x72, 0x69, 0x73, 0x6d, 0x53, 0x6b, 0x69, 0x6e, 0x50, 0x72, 0x65, 0x76, 
-0x69, 0x65, 0x77, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x38, 0x38, 0x39, 0x0d, 0x0a, 0x22, 0x53, 0x69, 0x65, 0x67, 0x65, 0x54, 0x61, 0x6e, 
-0x6b, 0x53, 0x6b, 0x69, 0x6e, 0x50, 0x72, 0x65, 0x76, 0x69, 0x65, 0x77, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x39, 0x30, 0x0d, 0x0a, 
-0x22, 0x4c, 0x69, 0x62, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x53, 0x6b, 0x69, 0x6e, 0x50, 0x72, 
-0x65, 0x76, 0x69, 0x65, 0x77, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x39, 0x31, 0x0d, 0x0a, 0x22, 0x22, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x39, 0x32, 0x0d, 0x0a, 0x22, 0x53, 
-0x74, 0x75, 0x6b, 0x6f, 0x76, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x54, 0x72, 0x6f, 
-0x6f, 0x70, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x39, 0x33, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 
-0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 
-0x63, 0x6b, 0x65, 0x72, 0x36, 0x53, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x39, 0x34, 0x0d, 0x0a, 0x22, 0x58, 
-0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 
-0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x53, 0x45, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 
-0x39, 0x35, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 
-0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x39, 0x36, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 
-0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 
-0x63, 0x6b, 0x65, 0x72, 0x36, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x39, 0x37, 0x0d, 0x0a, 0x22, 
-0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 
-0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x4e, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 
-0x39, 0x38, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 
-0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 
-0x4e, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x38, 0x39, 0x39, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 
-0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 
-0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x30, 0x30, 0x0d, 0x0a, 0x22, 
-0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 
-0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x36, 0x53, 0x57, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 
-0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x39, 0x30, 0x31, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 
-0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 
-0x38, 0x53, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x30, 0x32, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 
-0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 
-0x6f, 0x63, 0x6b, 0x65, 0x72, 0x38, 0x53, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x30, 0x33, 0x0d, 0x0a, 
-0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
-0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x38, 0x45, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 
-0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x39, 0x30, 0x34, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 
-0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 
-0x38, 0x4e, 0x45, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x30, 0x35, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 
-0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 
-0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x38, 0x4e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x30, 0x36, 0x0d, 0x0a, 
-0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 
-0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x38, 0x4e, 0x57, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 
-0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x39, 0x30, 0x37, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 0x61, 0x67, 0x61, 0x44, 0x65, 
-0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 
-0x72, 0x38, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x30, 0x38, 0x0d, 0x0a, 0x22, 0x58, 0x65, 0x6c, 0x4e, 
-0x61, 0x67, 0x61, 0x44, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x42, 
-0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x38, 0x53, 0x57, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x30, 0x39, 0x0d, 
-0x0a, 0x22, 0x53, 0x6e, 0x6f, 0x77, 0x47, 0x6c, 0x61, 0x7a, 0x65, 0x53, 0x74, 0x61, 0x72, 0x74, 
-0x65, 0x72, 0x4d, 0x50, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x39, 0x31, 0x30, 0x0d, 0x0a, 0x22, 0x53, 0x68, 0x69, 0x65, 0x6c, 0x64, 0x42, 
-0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x38, 
-0x39, 0x35, 0x20, 0x32, 0x20, 0x36, 0x34, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x39, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x37, 0x32, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x39, 0x31, 0x31, 0x0d, 0x0a, 0x22, 0x4f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x53, 0x69, 
-0x65, 0x67, 0x65, 0x4d, 0x6f, 0x64, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x32, 0x35, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x20, 0x30, 0x20, 
-0x33, 0x37, 0x34, 0x31, 0x20, 0x32, 0x20, 0x31, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x33, 
-0x2e, 0x37, 0x35, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x38, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x31, 0x32, 0x0d, 0x0a, 0x22, 0x4f, 0x76, 0x65, 0x72, 0x73, 
-0x65, 0x65, 0x72, 0x53, 0x69, 0x65, 0x67, 0x65, 0x4d, 0x6f, 0x64, 0x65, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x35, 0x30, 0x0d, 0x0a, 0x35, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x33, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x38, 0x20, 0x33, 0x37, 0x34, 0x33, 0x20, 0x31, 0x20, 0x31, 0x32, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x31, 0x33, 0x2e, 0x37, 0x35, 0x20, 0x31, 0x0d, 0x0a, 0x31, 0x30, 0x36, 
-0x20, 0x0d, 0x0a, 0x31, 0x32, 0x39, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x39, 0x31, 0x33, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x65, 0x6e, 0x52, 0x65, 0x70, 0x61, 0x69, 
-0x72, 0x44, 0x72, 0x6f, 0x6e, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 
-0x30, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x34, 0x0d, 0x0a, 0x31, 0x20, 0x34, 0x20, 0x38, 0x20, 
-0x31, 0x31, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x37, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x39, 0x31, 0x34, 0x0d, 0x0a, 0x22, 0x48, 0x69, 0x67, 0x68, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x61, 
-0x72, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x31, 0x35, 
-0x0d, 0x0a, 0x22, 0x43, 0x79, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 
-0x65, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x41, 0x69, 0x72, 0x41, 0x6c, 0x74, 0x65, 0x72, 0x6e, 0x61, 
-0x74, 0x69, 0x76, 0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x39, 0x31, 0x36, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x65, 0x6e, 0x53, 0x63, 
-0x72, 0x61, 0x6d, 0x62, 0x6c, 0x65, 0x72, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x31, 0x37, 
-0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x65, 0x6e, 0x52, 0x65, 0x70, 0x61, 0x69, 0x72, 0x44, 0x72, 
-0x6f, 0x6e, 0x65, 0x52, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 
-0x31, 0x38, 0x0d, 0x0a, 0x22, 0x52, 0x61, 0x76, 0x65, 0x6e, 0x53, 0x68, 0x72, 0x65, 0x64, 0x64, 
-0x65, 0x72, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x31, 
-0x39, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x65, 0x64, 0x41, 0x63, 0x69, 0x64, 
-0x53, 0x70, 0x69, 0x6e, 0x65, 0x73, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x32, 0x30, 0x0d, 0x0a, 
-0x22, 0x49, 0x6e, 0x66, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x45, 0x6e, 0x73, 0x6e, 0x61, 0x72, 0x65, 
-0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x32, 0x31, 0x0d, 
-0x0a, 0x22, 0x53, 0x4e, 0x41, 0x52, 0x45, 0x5f, 0x50, 0x4c, 0x41, 0x43, 0x45, 0x48, 0x4f, 0x4c, 
-0x44, 0x45, 0x52, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x39, 0x32, 0x32, 0x0d, 0x0a, 0x22, 0x54, 0x79, 0x63, 0x68, 0x75, 0x73, 0x52, 0x65, 
-0x61, 0x70, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x32, 0x33, 0x0d, 0x0a, 0x22, 0x54, 0x79, 0x63, 0x68, 0x75, 0x73, 
-0x46, 0x69, 0x72, 0x65, 0x62, 0x61, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 
-0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x32, 0x34, 0x0d, 0x0a, 0x22, 0x54, 0x79, 0x63, 
-0x68, 0x75, 0x73, 0x53, 0x70, 0x65, 0x63, 0x74, 0x72, 0x65, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 
-0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x32, 0x35, 0x0d, 0x0a, 0x22, 
-0x54, 0x79, 0x63, 0x68, 0x75, 0x73, 0x4d, 0x65, 0x64, 0x69, 0x63, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x32, 0x36, 0x0d, 0x0a, 
-0x22, 0x54, 0x79, 0x63, 0x68, 0x75, 0x73, 0x4d, 0x61, 0x72, 0x61, 0x75, 0x64, 0x65, 0x72, 0x41, 
-0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 
-0x32, 0x37, 0x0d, 0x0a, 0x22, 0x54, 0x79, 0x63, 0x68, 0x75, 0x73, 0x57, 0x61, 0x72, 0x68, 0x6f, 
-0x75, 0x6e, 0x64, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 
-0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x39, 0x32, 0x38, 0x0d, 0x0a, 0x22, 0x54, 0x79, 0x63, 0x68, 0x75, 0x73, 0x48, 
-0x45, 0x52, 0x43, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 
-0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x39, 0x32, 0x39, 0x0d, 0x0a, 0x22, 0x54, 0x79, 0x63, 0x68, 0x75, 0x73, 0x47, 
-0x68, 0x6f, 0x73, 0x74, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x33, 0x30, 0x0d, 0x0a, 0x22, 0x54, 0x79, 0x63, 0x68, 0x75, 0x73, 
-0x53, 0x43, 0x56, 0x41, 0x75, 0x74, 0x6f, 0x54, 0x75, 0x72, 0x72, 0x65, 0x74, 0x41, 0x43, 0x47, 
-0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x33, 0x31, 
-0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x61, 0x74, 0x75, 0x6c, 0x53, 0x74, 0x61, 0x6c, 0x6b, 0x65, 
-0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x39, 0x33, 0x32, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x61, 0x74, 0x75, 0x6c, 0x53, 0x65, 
-0x6e, 0x74, 0x72, 0x79, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 
-0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x33, 0x33, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x61, 0x74, 0x75, 
-0x6c, 0x44, 0x61, 0x72, 0x6b, 0x54, 0x65, 0x6d, 0x70, 0x6c, 0x61, 0x72, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x33, 0x34, 0x0d, 
-0x0a, 0x22, 0x5a, 0x65, 0x72, 0x61, 0x74, 0x75, 0x6c, 0x49, 0x6d, 0x6d, 0x6f, 0x72, 0x74, 0x61, 
-0x6c, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 
-0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x31, 0x39, 0x33, 0x35, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x61, 0x74, 0x75, 0x6c, 0x4f, 0x62, 
-0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 
-0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x33, 0x36, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x61, 
-0x74, 0x75, 0x6c, 0x44, 0x69, 0x73, 0x72, 0x75, 0x70, 0x74, 0x6f, 0x72, 0x41, 0x43, 0x47, 0x6c, 
-0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x33, 0x37, 0x0d, 
-0x0a, 0x22, 0x5a, 0x65, 0x72, 0x61, 0x74, 0x75, 0x6c, 0x57, 0x61, 0x72, 0x70, 0x50, 0x72, 0x69, 
-0x73, 0x6d, 0x41, 0x43, 0x47, 0x6c, 0x75, 0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 
-0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x39, 0x33, 0x38, 0x0d, 0x0a, 0x22, 0x5a, 0x65, 0x72, 0x61, 0x74, 0x75, 0x6c, 0x50, 
-0x68, 0x6f, 0x74, 0x6f, 0x6e, 0x43, 0x61, 0x6e, 0x6e, 0x6f, 0x6e, 0x41, 0x43, 0x47, 0x6c, 0x75, 
-0x65, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x44, 0x75, 0x6d, 0x6d, 0x79, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x33, 0x39, 0x0d, 0x0a, 
-0x22, 0x52, 0x65, 0x6e, 0x65, 0x67, 0x61, 0x64, 0x65, 0x4c, 0x6f, 0x6e, 0x67, 0x62, 0x6f, 0x6c, 
-0x74, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x57, 0x65, 0x61, 0x70, 0x6f, 0x6e, 0x22, 0x0d, 
-0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x34, 0x30, 
-0x0d, 0x0a, 0x22, 0x56, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x34, 0x31, 0x0d, 0x0a, 0x22, 0x52, 0x65, 
-0x6e, 0x65, 0x67, 0x61, 0x64, 0x65, 0x4d, 0x69, 0x73, 0x73, 0x69, 0x6c, 0x65, 0x54, 0x75, 0x72, 
-0x72, 0x65, 0x74, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x32, 0x20, 0x31, 0x32, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x32, 0x20, 0x37, 0x20, 0x30, 0x2e, 0x38, 0x36, 0x30, 0x38, 0x34, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x31, 0x31, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x39, 0x34, 0x32, 0x0d, 0x0a, 0x22, 0x50, 0x61, 0x72, 0x61, 0x73, 0x69, 0x74, 
-0x69, 0x63, 0x42, 0x6f, 0x6d, 0x62, 0x52, 0x65, 0x6c, 0x61, 0x79, 0x44, 0x75, 0x6d, 0x6d, 0x79, 
-0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 
-0x39, 0x34, 0x33, 0x0d, 0x0a, 0x22, 0x50, 0x72, 0x65, 0x76, 0x69, 0x65, 0x77, 0x42, 0x75, 0x6e, 
-0x6b, 0x65, 0x72, 0x55, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x64, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x34, 0x34, 0x0d, 0x0a, 0x22, 
-0x41, 0x73, 0x73, 0x69, 0x6d, 0x69, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x52, 0x69, 0x63, 0x68, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 
-0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 
-0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 0x36, 0x31, 0x20, 0x0d, 0x0a, 0x36, 0x31, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x34, 0x35, 0x0d, 0x0a, 0x22, 0x45, 0x78, 0x74, 
-0x72, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x52, 0x69, 0x63, 0x68, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x37, 0x35, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x33, 
-0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x39, 0x20, 
-0x31, 0x0d, 0x0a, 0x38, 0x38, 0x20, 0x0d, 0x0a, 0x38, 0x38, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x34, 0x36, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x68, 0x69, 0x62, 0x69, 
-0x74, 0x6f, 0x72, 0x5a, 0x6f, 0x6e, 0x65, 0x53, 0x6d, 0x61, 0x6c, 0x6c, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x20, 0x30, 0x0d, 
-0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x34, 
-0x37, 0x0d, 0x0a, 0x22, 0x49, 0x6e, 0x68, 0x69, 0x62, 0x69, 0x74, 0x6f, 0x72, 0x5a, 0x6f, 0x6e, 
-0x65, 0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x32, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x34, 0x38, 0x0d, 0x0a, 0x22, 0x49, 
-0x6e, 0x68, 0x69, 0x62, 0x69, 0x74, 0x6f, 0x72, 0x5a, 0x6f, 0x6e, 0x65, 0x4c, 0x61, 0x72, 0x67, 
-0x65, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x32, 0x32, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x31, 0x39, 0x34, 0x39, 0x0d, 0x0a, 0x22, 0x52, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x72, 
-0x79, 0x52, 0x69, 0x63, 0x68, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x37, 0x35, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x32, 0x20, 0x34, 0x20, 0x38, 0x20, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x20, 0x39, 0x20, 0x31, 0x0d, 0x0a, 0x32, 0x30, 
-0x20, 0x0d, 0x0a, 0x32, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 
-0x35, 0x30, 0x0d, 0x0a, 0x22, 0x4d, 0x69, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x46, 0x69, 0x65, 0x6c, 
-0x64, 0x34, 0x35, 0x30, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x31, 0x30, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 
-0x31, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x35, 0x31, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 
-0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 
-0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x52, 0x61, 0x6d, 0x70, 0x4c, 0x65, 0x66, 0x74, 0x47, 0x72, 
-0x65, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x37, 0x39, 0x33, 0x20, 0x33, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x35, 0x32, 0x0d, 0x0a, 0x22, 0x43, 
-0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 
-0x77, 0x65, 0x72, 0x44, 0x65, 0x62, 0x72, 0x69, 0x73, 0x52, 0x61, 0x6d, 0x70, 0x52, 0x69, 0x67, 
-0x68, 0x74, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x33, 0x37, 
-0x39, 0x35, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x35, 0x33, 
-0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 
-0x63, 0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x50, 0x75, 0x73, 0x68, 0x55, 0x6e, 0x69, 0x74, 0x52, 
-0x61, 0x6d, 0x70, 0x4c, 0x65, 0x66, 0x74, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 
-0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 
-0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 
-0x35, 0x34, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 
-0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x50, 0x75, 0x73, 0x68, 0x55, 0x6e, 0x69, 
-0x74, 0x52, 0x61, 0x6d, 0x70, 0x52, 0x69, 0x67, 0x68, 0x74, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x22, 
-0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 
-0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x31, 0x39, 0x35, 0x35, 0x0d, 0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 
-0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x52, 0x61, 0x6d, 0x70, 
-0x4c, 0x65, 0x66, 0x74, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 
-0x0a, 0x30, 0x0d, 0x0a, 0x33, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x33, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 
-0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x39, 0x35, 0x36, 0x0d, 
-0x0a, 0x22, 0x43, 0x6f, 0x6c, 0x6c, 0x61, 0x70, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x6f, 0x63, 
-0x6b, 0x54, 0x6f, 0x77, 0x65, 0x72, 0x52, 0x61, 0x6d, 0x70, 0x52, 0x69, 0x67, 0x68, 0x74, 0x47, 
-0x72, 0x65, 0x65, 0x6e, 0x22, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 
-0x30, 0x0d, 0x0a, 0x32, 0x0d, 0x0a, 0x32, 0x20, 0x38, 0x20, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x33, 
-0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x33, 0x20, 0x30, 
-0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x20, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x30, 0x20, 0x30, 0x20, 
-0x30, 0x20, 0x0d, 0x0a, 0x0d, 0x0a, 0x0d, 0x0a };
-
-const size_t LIBVOXELBOT_DATA_UNITS_SIZE = 162280;
-
@@ -0,0 +1,3075 @@
+// Generated by save_unit_table in libvoxelbot/utilities/unit_data_caching.cpp, do not edit.
+#pragma once
+#include "../utilities/unit_data_tables.h"
+
+const UnitTypeRecord LIBVOXELBOT_TABLE_UNITS[] = {
+    { 0, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 0, 0, 0, 0, 0, 0 },
+    { 1, "System_Snapshot_Dummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 0, 0, 0, 0, 0, 0 },
+    { 2, "Ball", true, 0, 0, 0, 6.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 0, 1, 0, 0, 0, 0 },
+    { 3, "StereoscopicOptionsUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 1, 0, 0, 0, 0, 0 },
+    { 4, "Colossus", true, 8, 300, 200, 2.25f, 1.0f, 6.0f, 0.0f, 978, 2, 1200.0f, false, false, 10.0f, 0, 70, false, 1, 3, 0, 1, 0, 0 },
+    { 5, "TechLab", true, 0, 50, 25, 0.0f, 1.0f, 0.0f, 0.0f, 1666, 0, 2.0f, false, false, 9.0f, 0, 0, false, 4, 3, 1, 0, 0, 0 },
+    { 6, "Reactor", true, 0, 50, 50, 0.0f, 1.0f, 0.0f, 0.0f, 1674, 0, 2.0f, false, false, 9.0f, 0, 0, false, 7, 3, 1, 0, 0, 0 },
+    { 7, "InfestorTerran", true, 0, 0, 0, 0.9375f, 0.0f, 0.0f, 0.0f, 40, 1, 78.0f, false, false, 9.0f, 0, 0, false, 10, 2, 1, 2, 0, 0 },
+    { 8, "BanelingCocoon", true, 0, 50, 25, 2.5f, 2.0f, 0.5f, 0.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 12, 1, 3, 0, 0, 0 },
+    { 9, "Baneling", true, 2, 50, 25, 2.5f, 0.0f, 0.5f, 0.0f, 80, 1, 320.0f, false, false, 8.0f, 0, 96, false, 13, 1, 3, 0, 0, 0 },
+    { 10, "Mothership", true, 0, 400, 400, 1.875f, 2.0f, 8.0f, 0.0f, 110, 2, 2560.0f, false, false, 14.0f, 0, 0, false, 14, 4, 3, 1, 0, 0 },
+    { 11, "PointDefenseDrone", true, 0, 100, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 7.0f, 0, 0, false, 18, 3, 4, 0, 0, 0 },
+    { 12, "Changeling", true, 0, 0, 0, 2.25f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 8.0f, 0, 0, false, 21, 2, 4, 0, 0, 0 },
+    { 13, "ChangelingZealot", true, 0, 0, 0, 2.25f, 1.0f, 0.0f, 0.0f, 183, 1, 8.0f, false, false, 9.0f, 12, 0, false, 23, 2, 4, 1, 0, 0 },
+    { 14, "ChangelingMarineShield", true, 0, 0, 0, 2.25f, 0.0f, 0.0f, 0.0f, 185, 1, 8.0f, false, false, 9.0f, 12, 0, false, 25, 2, 5, 1, 0, 0 },
+    { 15, "ChangelingMarine", true, 0, 0, 0, 2.25f, 0.0f, 0.0f, 0.0f, 187, 1, 8.0f, false, false, 9.0f, 12, 0, false, 27, 2, 6, 1, 0, 0 },
+    { 16, "ChangelingZerglingWings", true, 0, 0, 0, 2.95311999f, 0.0f, 0.0f, 0.0f, 189, 1, 8.0f, false, false, 8.0f, 12, 0, false, 29, 2, 7, 1, 0, 0 },
+    { 17, "ChangelingZergling", true, 0, 0, 0, 2.95311999f, 0.0f, 0.0f, 0.0f, 191, 1, 8.0f, false, false, 8.0f, 12, 0, false, 31, 2, 8, 1, 0, 0 },
+    { 18, "CommandCenter", true, 0, 400, 0, 0.0f, 1.0f, 0.0f, 15.0f, 318, 0, 1600.0f, false, false, 11.0f, 0, 0, false, 33, 3, 9, 0, 0, 0 },
+    { 19, "SupplyDepot", true, 0, 100, 0, 0.0f, 1.0f, 0.0f, 8.0f, 319, 0, 480.0f, false, false, 9.0f, 0, 0, false, 36, 3, 9, 0, 0, 0 },
+    { 20, "Refinery", true, 0, 75, 0, 0.0f, 1.0f, 0.0f, 0.0f, 320, 0, 480.0f, false, true, 9.0f, 0, 0, false, 39, 3, 9, 0, 0, 0 },
+    { 21, "Barracks", true, 0, 150, 0, 0.0f, 1.0f, 0.0f, 0.0f, 321, 0, 1040.0f, false, false, 9.0f, 0, 19, false, 42, 3, 9, 0, 0, 0 },
+    { 22, "EngineeringBay", true, 0, 125, 0, 0.0f, 1.0f, 0.0f, 0.0f, 322, 0, 560.0f, false, false, 9.0f, 0, 18, false, 45, 3, 9, 0, 0, 0 },
+    { 23, "MissileTurret", true, 0, 100, 0, 0.0f, 0.0f, 0.0f, 0.0f, 323, 0, 400.0f, false, false, 11.0f, 0, 22, false, 48, 3, 9, 1, 0, 0 },
+    { 24, "Bunker", true, 0, 100, 0, 0.0f, 1.0f, 0.0f, 0.0f, 324, 0, 640.0f, false, false, 10.0f, 0, 21, false, 51, 3, 10, 0, 0, 0 },
+    { 25, "SensorTower", true, 0, 125, 100, 0.0f, 0.0f, 0.0f, 0.0f, 326, 0, 400.0f, false, false, 12.0f, 0, 22, false, 54, 3, 10, 0, 0, 0 },
+    { 26, "GhostAcademy", true, 0, 150, 50, 0.0f, 1.0f, 0.0f, 0.0f, 327, 0, 640.0f, false, false, 9.0f, 0, 21, false, 57, 3, 10, 0, 0, 0 },
+    { 27, "Factory", true, 0, 150, 100, 0.0f, 1.0f, 0.0f, 0.0f, 328, 0, 960.0f, false, false, 9.0f, 0, 21, false, 60, 3, 10, 0, 0, 0 },
+    { 28, "Starport", true, 0, 150, 100, 0.0f, 1.0f, 0.0f, 0.0f, 329, 0, 800.0f, false, false, 9.0f, 0, 27, false, 63, 3, 10, 0, 0, 0 },
+    { 29, "Armory", true, 0, 150, 100, 0.0f, 1.0f, 0.0f, 0.0f, 331, 0, 1040.0f, false, false, 9.0f, 0, 27, false, 66, 3, 10, 0, 0, 0 },
+    { 30, "FusionCore", true, 0, 150, 150, 0.0f, 1.0f, 0.0f, 0.0f, 333, 0, 1040.0f, false, false, 9.0f, 0, 28, false, 69, 3, 10, 0, 0, 0 },
+    { 31, "AutoTurret", true, 0, 100, 0, 0.0f, 1.0f, 0.0f, 0.0f, 349, 0, 16.0f, false, false, 7.0f, 0, 0, false, 72, 3, 10, 1, 0, 0 },
+    { 32, "SiegeTankSieged", true, 0, 150, 125, 0.0f, 1.0f, 3.0f, 0.0f, 388, 0, 68.6679993f, false, false, 11.0f, 33, 0, false, 75, 2, 11, 1, 0, 1 },
+    { 33, "SiegeTank", true, 4, 150, 125, 2.25f, 1.0f, 3.0f, 0.0f, 591, 0, 720.0f, false, false, 11.0f, 0, 5, true, 77, 2, 12, 1, 1, 0 },
+    { 34, "VikingAssault", true, 2, 150, 75, 2.25f, 0.0f, 2.0f, 0.0f, 403, 0, 41.4413986f, false, false, 10.0f, 35, 0, false, 79, 2, 13, 1, 1, 1 },
+    { 35, "VikingFighter", true, 0, 150, 75, 2.75f, 0.0f, 2.0f, 0.0f, 624, 0, 672.0f, false, false, 10.0f, 0, 0, false, 81, 2, 14, 1, 2, 1 },
+    { 36, "CommandCenterFlying", true, 0, 400, 0, 0.9375f, 1.0f, 0.0f, 15.0f, 417, 0, 32.0f, false, false, 11.0f, 18, 0, false, 83, 3, 15, 0, 3, 1 },
+    { 37, "BarracksTechLab", true, 0, 50, 25, 0.0f, 1.0f, 0.0f, 0.0f, 421, 0, 400.0f, false, false, 9.0f, 0, 0, false, 86, 3, 15, 0, 4, 1 },
+    { 38, "BarracksReactor", true, 0, 50, 50, 0.0f, 1.0f, 0.0f, 0.0f, 422, 0, 800.0f, false, false, 9.0f, 0, 0, false, 89, 3, 15, 0, 5, 1 },
+    { 39, "FactoryTechLab", true, 0, 50, 25, 0.0f, 1.0f, 0.0f, 0.0f, 454, 0, 400.0f, false, false, 9.0f, 0, 0, false, 92, 3, 15, 0, 6, 1 },
+    { 40, "FactoryReactor", true, 0, 50, 50, 0.0f, 1.0f, 0.0f, 0.0f, 455, 0, 800.0f, false, false, 9.0f, 0, 0, false, 95, 3, 15, 0, 7, 1 },
+    { 41, "StarportTechLab", true, 0, 50, 25, 0.0f, 1.0f, 0.0f, 0.0f, 487, 0, 400.0f, false, false, 9.0f, 0, 0, false, 98, 3, 15, 0, 8, 1 },
+    { 42, "StarportReactor", true, 0, 50, 50, 0.0f, 1.0f, 0.0f, 0.0f, 488, 0, 800.0f, false, false, 9.0f, 0, 0, false, 101, 3, 15, 0, 9, 1 },
+    { 43, "FactoryFlying", true, 0, 150, 100, 0.9375f, 1.0f, 0.0f, 0.0f, 485, 0, 32.0f, false, false, 9.0f, 27, 0, false, 104, 3, 15, 0, 10, 1 },
+    { 44, "StarportFlying", true, 0, 150, 100, 0.9375f, 1.0f, 0.0f, 0.0f, 518, 0, 32.0f, false, false, 9.0f, 28, 0, false, 107, 3, 15, 0, 11, 1 },
+    { 45, "SCV", true, 1, 50, 0, 2.8125f, 0.0f, 1.0f, 0.0f, 524, 0, 272.0f, false, false, 8.0f, 0, 0, false, 110, 3, 15, 1, 12, 0 },
+    { 46, "BarracksFlying", true, 0, 150, 0, 0.9375f, 1.0f, 0.0f, 0.0f, 452, 0, 32.0f, false, false, 9.0f, 21, 0, false, 113, 3, 16, 0, 12, 1 },
+    { 47, "SupplyDepotLowered", true, 0, 100, 0, 0.0f, 1.0f, 0.0f, 8.0f, 556, 0, 20.8008003f, false, false, 9.0f, 19, 0, false, 116, 3, 16, 0, 13, 1 },
+    { 48, "Marine", true, 1, 50, 0, 2.25f, 0.0f, 1.0f, 0.0f, 560, 0, 400.0f, false, false, 9.0f, 0, 0, false, 119, 2, 16, 1, 14, 0 },
+    { 49, "Reaper", true, 1, 50, 50, 3.75f, 0.0f, 1.0f, 0.0f, 561, 0, 720.0f, false, false, 9.0f, 0, 0, false, 121, 2, 17, 1, 14, 0 },
+    { 50, "Ghost", true, 2, 150, 125, 2.8125f, 0.0f, 2.0f, 0.0f, 562, 0, 640.0f, false, false, 11.0f, 0, 0, false, 123, 2, 18, 1, 14, 0 },
+    { 51, "Marauder", true, 2, 100, 25, 2.25f, 1.0f, 2.0f, 0.0f, 563, 0, 480.0f, false, false, 10.0f, 0, 5, true, 125, 2, 19, 1, 14, 0 },
+    { 52, "Thor", true, 8, 300, 200, 1.875f, 1.0f, 6.0f, 0.0f, 594, 0, 960.0f, false, false, 11.0f, 0, 0, false, 127, 3, 20, 2, 14, 0 },
+    { 53, "Hellion", true, 2, 100, 0, 4.25f, 0.0f, 2.0f, 0.0f, 595, 0, 480.0f, false, false, 10.0f, 0, 0, false, 130, 2, 22, 1, 14, 0 },
+    { 54, "Medivac", true, 0, 100, 100, 2.5f, 1.0f, 2.0f, 0.0f, 620, 0, 672.0f, false, false, 11.0f, 0, 0, false, 132, 2, 23, 0, 14, 0 },
+    { 55, "Banshee", true, 0, 150, 100, 2.75f, 0.0f, 3.0f, 0.0f, 621, 0, 960.0f, false, false, 10.0f, 0, 5, true, 134, 2, 23, 1, 14, 0 },
+    { 56, "Raven", true, 0, 100, 200, 2.75f, 1.0f, 2.0f, 0.0f, 622, 0, 960.0f, false, false, 11.0f, 0, 5, true, 136, 2, 24, 0, 14, 0 },
+    { 57, "Battlecruiser", true, 0, 400, 300, 1.875f, 3.0f, 6.0f, 0.0f, 623, 0, 1440.0f, false, false, 12.0f, 0, 0, false, 138, 3, 24, 0, 14, 0 },
+    { 58, "Nuke", true, 0, 100, 100, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 141, 0, 24, 0, 14, 0 },
+    { 59, "Nexus", true, 0, 400, 0, 0.0f, 1.0f, 0.0f, 15.0f, 880, 2, 1600.0f, false, false, 11.0f, 0, 0, false, 141, 2, 24, 0, 14, 0 },
+    { 60, "Pylon", true, 0, 100, 0, 0.0f, 1.0f, 0.0f, 8.0f, 881, 2, 400.0f, false, false, 9.0f, 0, 0, false, 143, 2, 24, 0, 14, 0 },
+    { 61, "Assimilator", true, 0, 75, 0, 0.0f, 1.0f, 0.0f, 0.0f, 882, 2, 480.0f, false, true, 9.0f, 0, 0, false, 145, 2, 24, 0, 14, 0 },
+    { 62, "Gateway", true, 0, 150, 0, 0.0f, 1.0f, 0.0f, 0.0f, 883, 2, 1040.0f, false, false, 9.0f, 0, 59, false, 147, 2, 24, 0, 14, 0 },
+    { 63, "Forge", true, 0, 150, 0, 0.0f, 1.0f, 0.0f, 0.0f, 884, 2, 720.0f, false, false, 9.0f, 0, 59, false, 149, 2, 24, 0, 14, 0 },
+    { 64, "FleetBeacon", true, 0, 300, 200, 0.0f, 1.0f, 0.0f, 0.0f, 885, 2, 960.0f, false, false, 9.0f, 0, 67, false, 151, 2, 24, 0, 14, 0 },
+    { 65, "TwilightCouncil", true, 0, 150, 100, 0.0f, 1.0f, 0.0f, 0.0f, 886, 2, 800.0f, false, false, 9.0f, 0, 72, false, 153, 2, 24, 0, 14, 0 },
+    { 66, "PhotonCannon", true, 0, 150, 0, 0.0f, 1.0f, 0.0f, 0.0f, 887, 2, 640.0f, false, false, 11.0f, 0, 63, false, 155, 2, 24, 1, 14, 0 },
+    { 67, "Stargate", true, 0, 150, 150, 0.0f, 1.0f, 0.0f, 0.0f, 889, 2, 960.0f, false, false, 9.0f, 0, 72, false, 157, 2, 25, 0, 14, 0 },
+    { 68, "TemplarArchive", true, 0, 150, 200, 0.0f, 1.0f, 0.0f, 0.0f, 890, 2, 800.0f, false, false, 9.0f, 0, 65, false, 159, 2, 25, 0, 14, 0 },
+    { 69, "DarkShrine", true, 0, 150, 150, 0.0f, 1.0f, 0.0f, 0.0f, 891, 2, 1600.0f, false, false, 9.0f, 0, 65, false, 161, 2, 25, 0, 14, 0 },
+    { 70, "RoboticsBay", true, 0, 150, 150, 0.0f, 1.0f, 0.0f, 0.0f, 892, 2, 1040.0f, false, false, 9.0f, 0, 71, false, 163, 2, 25, 0, 14, 0 },
+    { 71, "RoboticsFacility", true, 0, 150, 100, 0.0f, 1.0f, 0.0f, 0.0f, 893, 2, 1040.0f, false, false, 9.0f, 0, 72, false, 165, 2, 25, 0, 14, 0 },
+    { 72, "CyberneticsCore", true, 0, 150, 0, 0.0f, 1.0f, 0.0f, 0.0f, 894, 2, 800.0f, false, false, 9.0f, 0, 62, false, 167, 2, 25, 0, 14, 0 },
+    { 73, "Zealot", true, 2, 100, 0, 2.25f, 1.0f, 2.0f, 0.0f, 916, 2, 608.0f, false, false, 9.0f, 0, 0, false, 169, 2, 25, 1, 14, 0 },
+    { 74, "Stalker", true, 2, 125, 50, 2.95311999f, 1.0f, 2.0f, 0.0f, 917, 2, 672.0f, false, false, 10.0f, 0, 72, false, 171, 2, 26, 1, 14, 0 },
+    { 75, "HighTemplar", true, 2, 50, 150, 1.875f, 0.0f, 2.0f, 0.0f, 919, 2, 880.0f, false, false, 10.0f, 0, 68, false, 173, 3, 27, 1, 14, 0 },
+    { 76, "DarkTemplar", true, 2, 125, 125, 2.8125f, 1.0f, 2.0f, 0.0f, 920, 2, 880.0f, false, false, 8.0f, 0, 69, false, 176, 3, 28, 1, 14, 0 },
+    { 77, "Sentry", true, 2, 50, 100, 2.25f, 1.0f, 2.0f, 0.0f, 921, 2, 592.0f, false, false, 10.0f, 0, 72, false, 179, 3, 29, 1, 14, 0 },
+    { 78, "Phoenix", true, 0, 150, 100, 4.25f, 0.0f, 2.0f, 0.0f, 946, 2, 560.0f, false, false, 10.0f, 0, 0, false, 182, 2, 30, 1, 14, 0 },
+    { 79, "Carrier", true, 0, 350, 250, 1.875f, 2.0f, 6.0f, 0.0f, 948, 2, 1440.0f, false, false, 12.0f, 0, 64, false, 184, 3, 31, 0, 14, 0 },
+    { 80, "VoidRay", true, 0, 250, 150, 2.5f, 0.0f, 4.0f, 0.0f, 950, 2, 960.0f, false, false, 10.0f, 0, 0, false, 187, 2, 31, 1, 14, 0 },
+    { 81, "WarpPrism", true, 0, 200, 0, 2.95311999f, 0.0f, 2.0f, 0.0f, 976, 2, 800.0f, false, false, 10.0f, 0, 0, false, 189, 3, 32, 0, 14, 0 },
+    { 82, "Observer", true, 0, 25, 75, 2.14843988f, 0.0f, 1.0f, 0.0f, 977, 2, 480.0f, false, false, 11.0f, 0, 0, false, 192, 2, 32, 0, 14, 0 },
+    { 83, "Immortal", true, 4, 275, 100, 2.25f, 1.0f, 4.0f, 0.0f, 979, 2, 880.0f, false, false, 9.0f, 0, 0, false, 194, 2, 32, 1, 14, 0 },
+    { 84, "Probe", true, 1, 50, 0, 2.8125f, 0.0f, 1.0f, 0.0f, 1006, 2, 272.0f, false, false, 8.0f, 0, 0, false, 196, 2, 33, 1, 14, 0 },
+    { 85, "Interceptor", true, 0, 15, 0, 7.5f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 7.0f, 0, 0, false, 198, 2, 34, 1, 14, 0 },
+    { 86, "Hatchery", true, 0, 350, 0, 0.0f, 1.0f, 0.0f, 6.0f, 1152, 1, 1600.0f, false, false, 10.0f, 0, 0, false, 200, 3, 35, 0, 14, 0 },
+    { 87, "CreepTumor", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 1733, 1, 240.0f, false, false, 11.0f, 0, 0, false, 203, 3, 35, 0, 14, 0 },
+    { 88, "Extractor", true, 0, 75, 0, 0.0f, 1.0f, 0.0f, 0.0f, 1154, 1, 480.0f, false, true, 9.0f, 0, 0, false, 206, 3, 35, 0, 14, 0 },
+    { 89, "SpawningPool", true, 0, 250, 0, 0.0f, 1.0f, 0.0f, 0.0f, 1155, 1, 1040.0f, false, false, 9.0f, 0, 86, false, 209, 3, 35, 0, 14, 0 },
+    { 90, "EvolutionChamber", true, 0, 125, 0, 0.0f, 1.0f, 0.0f, 0.0f, 1156, 1, 560.0f, false, false, 9.0f, 0, 86, false, 212, 3, 35, 0, 14, 0 },
+    { 91, "HydraliskDen", true, 0, 150, 100, 0.0f, 1.0f, 0.0f, 0.0f, 1157, 1, 640.0f, false, false, 9.0f, 0, 100, false, 215, 3, 35, 0, 14, 0 },
+    { 92, "Spire", true, 0, 250, 200, 0.0f, 1.0f, 0.0f, 0.0f, 1158, 1, 1600.0f, false, false, 9.0f, 0, 100, false, 218, 3, 35, 0, 14, 0 },
+    { 93, "UltraliskCavern", true, 0, 200, 200, 0.0f, 1.0f, 0.0f, 0.0f, 1159, 1, 1040.0f, false, false, 9.0f, 0, 101, false, 221, 3, 35, 0, 14, 0 },
+    { 94, "InfestationPit", true, 0, 150, 100, 0.0f, 1.0f, 0.0f, 0.0f, 1160, 1, 800.0f, false, false, 9.0f, 0, 100, false, 224, 3, 35, 0, 14, 0 },
+    { 95, "NydusNetwork", true, 0, 200, 150, 0.0f, 1.0f, 0.0f, 0.0f, 1161, 1, 800.0f, false, false, 9.0f, 0, 100, false, 227, 3, 35, 0, 14, 0 },
+    { 96, "BanelingNest", true, 0, 150, 50, 0.0f, 1.0f, 0.0f, 0.0f, 1162, 1, 960.0f, false, false, 9.0f, 0, 89, false, 230, 3, 35, 0, 14, 0 },
+    { 97, "RoachWarren", true, 0, 200, 0, 0.0f, 1.0f, 0.0f, 0.0f, 1165, 1, 880.0f, false, false, 9.0f, 0, 89, false, 233, 3, 35, 0, 14, 0 },
+    { 98, "SpineCrawler", true, 0, 150, 0, 0.0f, 2.0f, 0.0f, 0.0f, 1166, 1, 800.0f, false, false, 11.0f, 0, 89, false, 236, 3, 35, 1, 14, 0 },
+    { 99, "SporeCrawler", true, 0, 125, 0, 0.0f, 1.0f, 0.0f, 0.0f, 1167, 1, 480.0f, false, false, 11.0f, 0, 89, false, 239, 3, 36, 1, 14, 0 },
+    { 100, "Lair", true, 0, 500, 100, 0.0f, 1.0f, 0.0f, 6.0f, 1216, 1, 1280.0f, false, false, 11.0f, 0, 89, false, 242, 3, 37, 0, 14, 1 },
+    { 101, "Hive", true, 0, 700, 250, 0.0f, 1.0f, 0.0f, 6.0f, 1218, 1, 1600.0f, false, false, 12.0f, 0, 94, false, 245, 3, 37, 0, 15, 2 },
+    { 102, "GreaterSpire", true, 0, 350, 350, 0.0f, 1.0f, 0.0f, 0.0f, 1220, 1, 1600.0f, false, false, 9.0f, 0, 101, false, 248, 3, 37, 0, 17, 1 },
+    { 103, "Egg", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 251, 1, 37, 0, 18, 0 },
+    { 104, "Drone", true, 1, 50, 0, 2.8125f, 0.0f, 1.0f, 0.0f, 1342, 1, 272.0f, false, false, 8.0f, 0, 0, false, 252, 2, 37, 1, 18, 0 },
+    { 105, "Zergling", true, 1, 25, 0, 2.95311999f, 0.0f, 0.5f, 0.0f, 1343, 1, 384.0f, false, false, 8.0f, 0, 89, false, 254, 2, 38, 1, 18, 0 },
+    { 106, "Overlord", true, 0, 100, 0, 0.644531012f, 0.0f, 0.0f, 8.0f, 1344, 1, 400.0f, false, false, 11.0f, 0, 0, false, 256, 2, 39, 0, 18, 0 },
+    { 107, "Hydralisk", true, 2, 100, 50, 2.25f, 0.0f, 2.0f, 0.0f, 1345, 1, 528.0f, false, false, 9.0f, 0, 91, false, 258, 2, 39, 1, 18, 0 },
+    { 108, "Mutalisk", true, 0, 100, 100, 4.0f, 0.0f, 2.0f, 0.0f, 1346, 1, 528.0f, false, false, 11.0f, 0, 92, false, 260, 2, 40, 1, 18, 0 },
+    { 109, "Ultralisk", true, 8, 300, 200, 2.95311999f, 2.0f, 6.0f, 0.0f, 1348, 1, 880.0f, false, false, 9.0f, 0, 93, false, 262, 3, 41, 1, 18, 0 },
+    { 110, "Roach", true, 2, 75, 25, 2.25f, 1.0f, 2.0f, 0.0f, 1351, 1, 432.0f, false, false, 9.0f, 0, 97, false, 265, 2, 42, 1, 18, 0 },
+    { 111, "Infestor", true, 2, 100, 150, 2.25f, 0.0f, 2.0f, 0.0f, 1352, 1, 800.0f, false, false, 10.0f, 0, 94, false, 267, 3, 43, 0, 18, 0 },
+    { 112, "Corruptor", true, 0, 150, 100, 3.375f, 2.0f, 2.0f, 0.0f, 1353, 1, 640.0f, false, false, 10.0f, 0, 92, false, 270, 2, 43, 1, 18, 0 },
+    { 113, "BroodLordCocoon", true, 0, 300, 250, 1.40625f, 2.0f, 2.0f, 0.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 272, 2, 44, 0, 18, 0 },
+    { 114, "BroodLord", true, 0, 300, 250, 1.40625f, 1.0f, 4.0f, 0.0f, 1372, 1, 541.348022f, false, false, 12.0f, 0, 102, false, 274, 3, 44, 1, 18, 0 },
+    { 115, "BanelingBurrowed", true, 0, 50, 25, 0.0f, 0.0f, 0.5f, 0.0f, 1374, 1, 18.9629002f, false, false, 8.0f, 9, 0, false, 277, 1, 45, 0, 18, 0 },
+    { 116, "DroneBurrowed", true, 0, 50, 0, 0.0f, 0.0f, 1.0f, 0.0f, 1378, 1, 23.3281002f, false, false, 4.0f, 104, 0, false, 278, 2, 45, 0, 18, 0 },
+    { 117, "HydraliskBurrowed", true, 0, 100, 50, 0.0f, 0.0f, 2.0f, 0.0f, 1382, 1, 24.2910004f, false, false, 5.0f, 107, 0, false, 280, 2, 45, 0, 18, 0 },
+    { 118, "RoachBurrowed", true, 0, 75, 25, 0.0f, 1.0f, 2.0f, 0.0f, 1386, 1, 9.69141006f, false, false, 5.0f, 110, 0, false, 282, 2, 45, 0, 18, 0 },
+    { 119, "ZerglingBurrowed", true, 0, 25, 0, 0.0f, 0.0f, 0.5f, 0.0f, 1390, 1, 24.2910004f, false, false, 4.0f, 105, 0, false, 284, 2, 45, 0, 18, 0 },
+    { 120, "InfestorTerranBurrowed", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 1394, 1, 24.2910004f, false, false, 4.0f, 7, 0, false, 286, 2, 45, 0, 18, 0 },
+    { 121, "RedstoneLavaCritterBurrowed", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 1398, 3, 24.2891006f, false, false, 8.0f, 0, 0, false, 288, 1, 45, 0, 18, 0 },
+    { 122, "RedstoneLavaCritterInjuredBurrowed", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 1400, 3, 24.2891006f, false, false, 8.0f, 0, 0, false, 289, 1, 45, 0, 18, 0 },
+    { 123, "RedstoneLavaCritter", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 1402, 3, 25.3281002f, false, false, 8.0f, 0, 0, false, 290, 1, 45, 0, 18, 0 },
+    { 124, "RedstoneLavaCritterInjured", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 1404, 3, 25.3281002f, false, false, 8.0f, 0, 0, false, 291, 1, 45, 0, 18, 0 },
+    { 125, "QueenBurrowed", true, 0, 150, 0, 0.0f, 1.0f, 2.0f, 0.0f, 1433, 1, 15.3319998f, false, false, 5.0f, 126, 0, false, 292, 2, 45, 0, 18, 1 },
+    { 126, "Queen", true, 2, 150, 0, 0.9375f, 1.0f, 2.0f, 0.0f, 1632, 1, 800.0f, false, false, 9.0f, 0, 89, false, 294, 2, 45, 2, 19, 0 },
+    { 127, "InfestorBurrowed", true, 2, 100, 150, 2.0f, 0.0f, 2.0f, 0.0f, 1444, 1, 10.9629002f, false, false, 10.0f, 111, 0, false, 296, 3, 47, 0, 19, 0 },
+    { 128, "OverlordCocoon", true, 0, 150, 100, 1.875f, 2.0f, 0.0f, 8.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 299, 1, 47, 0, 19, 0 },
+    { 129, "Overseer", true, 0, 150, 50, 1.875f, 1.0f, 0.0f, 8.0f, 1448, 1, 266.679993f, false, false, 11.0f, 0, 100, false, 300, 2, 47, 0, 19, 1 },
+    { 130, "PlanetaryFortress", true, 0, 550, 150, 0.0f, 3.0f, 0.0f, 15.0f, 1450, 0, 800.0f, false, false, 11.0f, 0, 22, false, 302, 3, 47, 1, 20, 1 },
+    { 131, "UltraliskBurrowed", true, 0, 300, 200, 0.0f, 2.0f, 6.0f, 0.0f, 1512, 1, 34.0f, false, false, 5.0f, 109, 0, false, 305, 3, 48, 0, 21, 0 },
+    { 132, "OrbitalCommand", true, 0, 550, 0, 0.0f, 1.0f, 0.0f, 15.0f, 1516, 0, 560.0f, false, false, 11.0f, 0, 21, false, 308, 3, 48, 0, 21, 1 },
+    { 133, "WarpGate", true, 0, 150, 0, 0.0f, 1.0f, 0.0f, 0.0f, 1518, 2, 160.0f, false, false, 9.0f, 0, 0, false, 311, 2, 48, 0, 22, 1 },
+    { 134, "OrbitalCommandFlying", true, 0, 550, 0, 0.9375f, 1.0f, 0.0f, 15.0f, 1522, 0, 32.0f, false, false, 11.0f, 132, 0, false, 313, 3, 48, 0, 23, 1 },
+    { 135, "ForceField", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 316, 0, 48, 0, 24, 0 },
+    { 136, "WarpPrismPhasing", true, 0, 200, 0, 0.0f, 0.0f, 2.0f, 0.0f, 1528, 2, 24.0f, false, false, 11.0f, 81, 0, false, 316, 3, 48, 0, 24, 1 },
+    { 137, "CreepTumorBurrowed", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 1662, 1, 18.9608994f, false, false, 11.0f, 87, 0, false, 319, 3, 48, 0, 25, 1 },
+    { 138, "CreepTumorQueen", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 1694, 1, 240.0f, false, false, 11.0f, 87, 0, false, 322, 3, 48, 0, 26, 1 },
+    { 139, "SpineCrawlerUprooted", true, 0, 150, 0, 1.0f, 2.0f, 0.0f, 0.0f, 1725, 1, 16.0f, false, false, 11.0f, 98, 0, false, 325, 3, 48, 0, 27, 0 },
+    { 140, "SporeCrawlerUprooted", true, 0, 125, 0, 1.0f, 1.0f, 0.0f, 0.0f, 1727, 1, 16.0f, false, false, 11.0f, 99, 0, false, 328, 3, 48, 0, 27, 0 },
+    { 141, "Archon", true, 4, 175, 275, 2.8125f, 0.0f, 4.0f, 0.0f, 0, 2, 0.0f, false, false, 9.0f, 0, 0, false, 331, 2, 48, 1, 27, 0 },
+    { 142, "NydusCanal", true, 0, 50, 50, 0.0f, 1.0f, 0.0f, 0.0f, 1768, 1, 320.0f, false, false, 10.0f, 0, 95, false, 333, 3, 49, 0, 27, 0 },
+    { 143, "BroodlingEscort", true, 0, 0, 0, 6.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 7.0f, 0, 0, false, 336, 2, 49, 0, 27, 0 },
+    { 144, "GhostAlternate", true, 2, 150, 125, 2.8125f, 0.0f, 2.0f, 0.0f, 1835, 0, 0.0f, false, false, 11.0f, 50, 0, false, 338, 2, 49, 1, 27, 0 },
+    { 145, "GhostNova", true, 2, 150, 125, 2.8125f, 0.0f, 2.0f, 0.0f, 1837, 0, 0.0f, false, false, 11.0f, 50, 0, false, 340, 2, 50, 1, 27, 0 },
+    { 146, "RichMineralField", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 342, 1, 51, 0, 27, 0 },
+    { 147, "RichMineralField750", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 343, 1, 51, 0, 27, 0 },
+    { 148, "Ursadon", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 344, 1, 51, 0, 27, 0 },
+    { 149, "XelNagaTower", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 22.0f, 0, 0, false, 345, 1, 51, 0, 27, 0 },
+    { 150, "InfestedTerransEgg", true, 0, 0, 0, 0.0f, 2.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 346, 1, 51, 0, 27, 0 },
+    { 151, "Larva", true, 0, 0, 0, 0.5625f, 10.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 347, 2, 51, 0, 27, 0 },
+    { 152, "ReaperPlaceholder", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 349, 1, 51, 0, 27, 0 },
+    { 153, "MarineACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 154, "FirebatACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 155, "MedicACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 156, "MarauderACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 157, "VultureACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 158, "SiegeTankACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 159, "VikingACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 160, "BansheeACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 161, "BattlecruiserACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 162, "OrbitalCommandACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 163, "BunkerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 164, "BunkerUpgradedACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 165, "MissileTurretACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 166, "HellbatACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 167, "GoliathACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 168, "CycloneACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 169, "WraithACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 170, "ScienceVesselACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 171, "HerculesACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 172, "ThorACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 173, "PerditionTurretACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 174, "FlamingBettyACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 175, "DevastationTurretACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 176, "BlasterBillyACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 177, "SpinningDizzyACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 178, "ZerglingKerriganACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 179, "RaptorACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 180, "QueenCoopACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 181, "HydraliskACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 182, "HydraliskLurkerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 183, "MutaliskBroodlordACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 184, "BroodLordACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 185, "UltraliskACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 186, "TorrasqueACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 187, "OverseerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 188, "LurkerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 189, "SpineCrawlerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 190, "SporeCrawlerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 191, "NydusNetworkACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 192, "OmegaNetworkACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 193, "ZerglingZagaraACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 194, "SwarmlingACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 195, "BanelingACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 196, "SplitterlingACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 197, "AberrationACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 198, "ScourgeACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 199, "CorruptorACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 200, "BileLauncherACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 201, "SwarmQueenACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 202, "RoachACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 203, "RoachVileACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 204, "RavagerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 205, "SwarmHostACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 206, "MutaliskACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 207, "GuardianACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 208, "DevourerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 209, "ViperACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 210, "BrutaliskACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 211, "LeviathanACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 212, "ZealotACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 213, "ZealotAiurACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 214, "DragoonACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 215, "HighTemplarACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 216, "ArchonACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 217, "ImmortalACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 218, "ObserverACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 219, "PhoenixAiurACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 220, "ReaverACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 221, "TempestACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 222, "PhotonCannonACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 223, "ZealotVorazunACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 224, "ZealotShakurasACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 225, "StalkerShakurasACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 226, "DarkTemplarShakurasACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 227, "CorsairACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 228, "VoidRayACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 229, "VoidRayShakurasACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 230, "OracleACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 231, "DarkArchonACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 232, "DarkPylonACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 233, "ZealotPurifierACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 234, "SentryPurifierACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 235, "ImmortalKaraxACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 236, "ColossusACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 237, "ColossusPurifierACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 238, "PhoenixPurifierACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 239, "CarrierACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 240, "CarrierAiurACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 241, "KhaydarinMonolithACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 242, "ShieldBatteryACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 243, "EliteMarineACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 244, "MarauderCommandoACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 245, "SpecOpsGhostACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 246, "HellbatRangerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 247, "StrikeGoliathACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 248, "HeavySiegeTankACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 249, "RaidLiberatorACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 250, "RavenTypeIIACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 251, "CovertBansheeACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 252, "RailgunTurretACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 253, "BlackOpsMissileTurretACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 254, "SupplicantACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 255, "StalkerTaldarimACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 256, "SentryTaldarimACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 257, "HighTemplarTaldarimACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 258, "ImmortalTaldarimACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 259, "ColossusTaldarimACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 260, "WarpPrismTaldarimACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 261, "PhotonCannonTaldarimACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 262, "NeedleSpinesWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 263, "CorruptionWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 264, "InfestedTerransWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 265, "NeuralParasiteWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 266, "PointDefenseDroneReleaseWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 267, "HunterSeekerWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 350, 0, 51, 0, 27, 0 },
+    { 268, "MULE", true, 0, 50, 0, 2.8125f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 8.0f, 0, 0, false, 350, 2, 51, 0, 27, 0 },
+    { 269, "ThorAAWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 270, "PunisherGrenadesLMWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 271, "VikingFighterWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 272, "ATALaserBatteryLMWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 273, "ATSLaserBatteryLMWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 274, "LongboltMissileWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 275, "D8ChargeWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 276, "YamatoWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 277, "IonCannonsWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 278, "AcidSalivaWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 279, "SpineCrawlerWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 280, "SporeCrawlerWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 281, "GlaiveWurmWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 282, "GlaiveWurmM2Weapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 283, "GlaiveWurmM3Weapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 284, "StalkerWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 285, "EMP2Weapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 286, "BacklashRocketsLMWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 287, "PhotonCannonWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 288, "ParasiteSporeWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 352, 0, 51, 0, 27, 0 },
+    { 289, "Broodling", true, 0, 0, 0, 3.83593988f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 7.0f, 0, 0, false, 352, 2, 51, 1, 27, 0 },
+    { 290, "BroodLordBWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 291, "AutoTurretReleaseWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 292, "LarvaReleaseMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 293, "AcidSpinesWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 294, "FrenzyWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 295, "ContaminateWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 296, "BeaconRally", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 297, "BeaconArmy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 298, "BeaconAttack", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 299, "BeaconDefend", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 300, "BeaconHarass", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 301, "BeaconIdle", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 302, "BeaconAuto", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 303, "BeaconDetect", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 304, "BeaconScout", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 305, "BeaconClaim", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 306, "BeaconExpand", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 307, "BeaconCustom1", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 308, "BeaconCustom2", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 309, "BeaconCustom3", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 310, "BeaconCustom4", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 354, 0, 52, 0, 27, 0 },
+    { 311, "Adept", true, 2, 100, 25, 2.5f, 1.0f, 2.0f, 0.0f, 922, 2, 672.0f, false, false, 9.0f, 0, 72, false, 354, 2, 52, 1, 27, 0 },
+    { 312, "Rocks2x2NonConjoined", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 356, 2, 53, 0, 27, 0 },
+    { 313, "FungalGrowthMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 358, 0, 53, 0, 27, 0 },
+    { 314, "NeuralParasiteTentacleMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 358, 0, 53, 0, 27, 0 },
+    { 315, "Beacon_Protoss", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 358, 0, 53, 0, 27, 0 },
+    { 316, "Beacon_ProtossSmall", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 358, 0, 53, 0, 27, 0 },
+    { 317, "Beacon_Terran", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 358, 0, 53, 0, 27, 0 },
+    { 318, "Beacon_TerranSmall", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 358, 0, 53, 0, 27, 0 },
+    { 319, "Beacon_Zerg", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 358, 0, 53, 0, 27, 0 },
+    { 320, "Beacon_ZergSmall", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 358, 0, 53, 0, 27, 0 },
+    { 321, "Lyote", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 358, 1, 53, 0, 27, 0 },
+    { 322, "CarrionBird", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 359, 1, 53, 0, 27, 0 },
+    { 323, "KarakMale", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 360, 1, 53, 0, 27, 0 },
+    { 324, "KarakFemale", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 361, 1, 53, 0, 27, 0 },
+    { 325, "UrsadakFemaleExotic", true, 0, 0, 0, 1.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 362, 1, 53, 0, 27, 0 },
+    { 326, "UrsadakMale", true, 0, 0, 0, 1.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 363, 1, 53, 0, 27, 0 },
+    { 327, "UrsadakFemale", true, 0, 0, 0, 1.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 364, 1, 53, 0, 27, 0 },
+    { 328, "UrsadakCalf", true, 0, 0, 0, 1.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 365, 1, 53, 0, 27, 0 },
+    { 329, "UrsadakMaleExotic", true, 0, 0, 0, 1.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 366, 1, 53, 0, 27, 0 },
+    { 330, "UtilityBot", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 367, 1, 53, 0, 27, 0 },
+    { 331, "CommentatorBot1", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 368, 1, 53, 0, 27, 0 },
+    { 332, "CommentatorBot2", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 369, 1, 53, 0, 27, 0 },
+    { 333, "CommentatorBot3", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 370, 1, 53, 0, 27, 0 },
+    { 334, "CommentatorBot4", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 371, 1, 53, 0, 27, 0 },
+    { 335, "Scantipede", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 372, 1, 53, 0, 27, 0 },
+    { 336, "Dog", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 373, 1, 53, 0, 27, 0 },
+    { 337, "Sheep", true, 0, 0, 0, 1.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 374, 1, 53, 0, 27, 0 },
+    { 338, "Cow", true, 0, 0, 0, 1.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 375, 1, 53, 0, 27, 0 },
+    { 339, "InfestedTerransEggPlacement", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 376, 0, 53, 0, 27, 0 },
+    { 340, "InfestorTerransWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 376, 0, 53, 0, 27, 0 },
+    { 341, "MineralField", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 376, 1, 53, 0, 27, 0 },
+    { 342, "VespeneGeyser", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, true, 0.0f, 0, 0, false, 377, 1, 53, 0, 27, 0 },
+    { 343, "SpacePlatformGeyser", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, true, 0.0f, 342, 0, false, 378, 1, 53, 0, 27, 0 },
+    { 344, "RichVespeneGeyser", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, true, 0.0f, 0, 0, false, 379, 1, 53, 0, 27, 0 },
+    { 345, "DestructibleSearchlight", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 380, 1, 53, 0, 27, 0 },
+    { 346, "DestructibleBullhornLights", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 381, 1, 53, 0, 27, 0 },
+    { 347, "DestructibleStreetlight", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 382, 1, 53, 0, 27, 0 },
+    { 348, "DestructibleSpacePlatformSign", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 383, 1, 53, 0, 27, 0 },
+    { 349, "DestructibleStoreFrontCityProps", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 384, 1, 53, 0, 27, 0 },
+    { 350, "DestructibleBillboardTall", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 385, 1, 53, 0, 27, 0 },
+    { 351, "DestructibleBillboardScrollingText", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 386, 1, 53, 0, 27, 0 },
+    { 352, "DestructibleSpacePlatformBarrier", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 387, 1, 53, 0, 27, 0 },
+    { 353, "DestructibleSignsDirectional", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 388, 1, 53, 0, 27, 0 },
+    { 354, "DestructibleSignsConstruction", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 389, 1, 53, 0, 27, 0 },
+    { 355, "DestructibleSignsFunny", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 390, 1, 53, 0, 27, 0 },
+    { 356, "DestructibleSignsIcons", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 391, 1, 53, 0, 27, 0 },
+    { 357, "DestructibleSignsWarning", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 392, 1, 53, 0, 27, 0 },
+    { 358, "DestructibleGarage", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 393, 2, 53, 0, 27, 0 },
+    { 359, "DestructibleGarageLarge", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 395, 2, 53, 0, 27, 0 },
+    { 360, "DestructibleTrafficSignal", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 397, 1, 53, 0, 27, 0 },
+    { 361, "TrafficSignal", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 398, 1, 53, 0, 27, 0 },
+    { 362, "BraxisAlphaDestructible1x1", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 399, 2, 53, 0, 27, 0 },
+    { 363, "BraxisAlphaDestructible2x2", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 401, 2, 53, 0, 27, 0 },
+    { 364, "DestructibleDebris4x4", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 403, 2, 53, 0, 27, 0 },
+    { 365, "DestructibleDebris6x6", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 405, 2, 53, 0, 27, 0 },
+    { 366, "DestructibleRock2x4Vertical", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 407, 2, 53, 0, 27, 0 },
+    { 367, "DestructibleRock2x4Horizontal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 409, 2, 53, 0, 27, 0 },
+    { 368, "DestructibleRock2x6Vertical", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 411, 2, 53, 0, 27, 0 },
+    { 369, "DestructibleRock2x6Horizontal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 413, 2, 53, 0, 27, 0 },
+    { 370, "DestructibleRock4x4", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 415, 2, 53, 0, 27, 0 },
+    { 371, "DestructibleRock6x6", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 417, 2, 53, 0, 27, 0 },
+    { 372, "DestructibleRampDiagonalHugeULBR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 419, 2, 53, 0, 27, 0 },
+    { 373, "DestructibleRampDiagonalHugeBLUR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 421, 2, 53, 0, 27, 0 },
+    { 374, "DestructibleRampVerticalHuge", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 423, 2, 53, 0, 27, 0 },
+    { 375, "DestructibleRampHorizontalHuge", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 425, 2, 53, 0, 27, 0 },
+    { 376, "DestructibleDebrisRampDiagonalHugeULBR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 427, 2, 53, 0, 27, 0 },
+    { 377, "DestructibleDebrisRampDiagonalHugeBLUR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 429, 2, 53, 0, 27, 0 },
+    { 378, "OverlordGenerateCreepKeybind", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 431, 0, 53, 0, 27, 0 },
+    { 379, "MengskStatueAlone", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 431, 2, 53, 0, 27, 0 },
+    { 380, "MengskStatue", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 433, 2, 53, 0, 27, 0 },
+    { 381, "WolfStatue", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 435, 2, 53, 0, 27, 0 },
+    { 382, "GlobeStatue", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 437, 2, 53, 0, 27, 0 },
+    { 383, "Weapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 439, 0, 53, 0, 27, 0 },
+    { 384, "GlaiveWurmBounceWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 439, 0, 53, 0, 27, 0 },
+    { 385, "BroodLordWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 439, 0, 53, 0, 27, 0 },
+    { 386, "BroodLordAWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 439, 0, 53, 0, 27, 0 },
+    { 387, "CreepBlocker1x1", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 439, 0, 53, 0, 27, 0 },
+    { 388, "PermanentCreepBlocker1x1", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 439, 0, 53, 0, 27, 0 },
+    { 389, "PathingBlocker1x1", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 439, 0, 53, 0, 27, 0 },
+    { 390, "PathingBlocker2x2", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 439, 0, 53, 0, 27, 0 },
+    { 391, "AutoTestAttackTargetGround", true, 1, 100, 100, 2.08593988f, 0.0f, 1.0f, 0.0f, 0, 0, 0.0f, false, false, 7.0f, 0, 0, false, 439, 2, 53, 0, 27, 0 },
+    { 392, "AutoTestAttackTargetAir", true, 0, 100, 100, 3.75f, 0.0f, 2.0f, 0.0f, 0, 0, 0.0f, false, false, 8.0f, 0, 0, false, 441, 1, 53, 0, 27, 0 },
+    { 393, "AutoTestAttacker", true, 1, 50, 0, 2.25f, 0.0f, 1.0f, 0.0f, 0, 0, 0.0f, false, false, 8.0f, 0, 0, false, 442, 2, 53, 0, 27, 0 },
+    { 394, "HelperEmitterSelectionArrow", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 395, "MultiKillObject", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 396, "ShapeGolfball", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 397, "ShapeCone", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 398, "ShapeCube", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 399, "ShapeCylinder", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 400, "ShapeDodecahedron", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 401, "ShapeIcosahedron", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 402, "ShapeOctahedron", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 403, "ShapePyramid", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 404, "ShapeRoundedCube", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 405, "ShapeSphere", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 406, "ShapeTetrahedron", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 407, "ShapeThickTorus", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 408, "ShapeThinTorus", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 409, "ShapeTorus", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 410, "Shape4PointStar", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 411, "Shape5PointStar", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 412, "Shape6PointStar", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 413, "Shape8PointStar", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 414, "ShapeArrowPointer", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 415, "ShapeBowl", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 416, "ShapeBox", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 417, "ShapeCapsule", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 418, "ShapeCrescentMoon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 419, "ShapeDecahedron", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 420, "ShapeDiamond", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 421, "ShapeFootball", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 422, "ShapeGemstone", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 423, "ShapeHeart", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 424, "ShapeJack", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 425, "ShapePlusSign", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 426, "ShapeShamrock", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 427, "ShapeSpade", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 428, "ShapeTube", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 429, "ShapeEgg", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 430, "ShapeYenSign", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 431, "ShapeX", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 432, "ShapeWatermelon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 433, "ShapeWonSign", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 434, "ShapeTennisball", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 435, "ShapeStrawberry", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 436, "ShapeSmileyFace", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 437, "ShapeSoccerball", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 438, "ShapeRainbow", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 439, "ShapeSadFace", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 440, "ShapePoundSign", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 441, "ShapePear", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 442, "ShapePineapple", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 443, "ShapeOrange", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 444, "ShapePeanut", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 445, "ShapeO", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 446, "ShapeLemon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 447, "ShapeMoneyBag", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 448, "ShapeHorseshoe", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 449, "ShapeHockeyStick", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 450, "ShapeHockeyPuck", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 451, "ShapeHand", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 452, "ShapeGolfClub", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 453, "ShapeGrape", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 454, "ShapeEuroSign", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 455, "ShapeDollarSign", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 456, "ShapeBasketball", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 457, "ShapeCarrot", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 458, "ShapeCherry", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 459, "ShapeBaseball", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 460, "ShapeBaseballBat", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 461, "ShapeBanana", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 462, "ShapeApple", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 463, "ShapeCashLarge", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 464, "ShapeCashMedium", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 465, "ShapeCashSmall", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 466, "ShapeFootballColored", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 467, "ShapeLemonSmall", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 468, "ShapeOrangeSmall", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 469, "ShapeTreasureChestOpen", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 470, "ShapeTreasureChestClosed", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 471, "ShapeWatermelonSmall", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 0, 53, 0, 27, 0 },
+    { 472, "UnbuildableRocksDestructible", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 444, 2, 53, 0, 27, 0 },
+    { 473, "UnbuildableBricksDestructible", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 446, 2, 53, 0, 27, 0 },
+    { 474, "UnbuildablePlatesDestructible", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 448, 2, 53, 0, 27, 0 },
+    { 475, "Debris2x2NonConjoined", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 450, 2, 53, 0, 27, 0 },
+    { 476, "EnemyPathingBlocker1x1", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 452, 0, 53, 0, 27, 0 },
+    { 477, "EnemyPathingBlocker2x2", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 452, 0, 53, 0, 27, 0 },
+    { 478, "EnemyPathingBlocker4x4", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 452, 0, 53, 0, 27, 0 },
+    { 479, "EnemyPathingBlocker8x8", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 452, 0, 53, 0, 27, 0 },
+    { 480, "EnemyPathingBlocker16x16", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 452, 0, 53, 0, 27, 0 },
+    { 481, "ScopeTest", true, 1, 50, 0, 2.25f, 0.0f, 1.0f, 0.0f, 0, 0, 0.0f, false, false, 9.0f, 0, 0, false, 452, 2, 53, 1, 27, 0 },
+    { 482, "SentryACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 454, 0, 54, 0, 27, 0 },
+    { 483, "MineralField750", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 454, 1, 54, 0, 27, 0 },
+    { 484, "HellionTank", true, 4, 100, 0, 2.25f, 0.0f, 2.0f, 0.0f, 596, 0, 480.0f, false, false, 10.0f, 0, 29, false, 455, 3, 54, 1, 27, 0 },
+    { 485, "CollapsibleTerranTowerDebris", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 1841, 3, 0.0f, false, false, 0.0f, 0, 0, false, 458, 2, 55, 0, 27, 0 },
+    { 486, "DebrisRampLeft", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 1843, 3, 0.0f, false, false, 0.0f, 0, 0, false, 460, 2, 55, 0, 27, 0 },
+    { 487, "DebrisRampRight", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 1845, 3, 0.0f, false, false, 0.0f, 0, 0, false, 462, 2, 55, 0, 27, 0 },
+    { 488, "MothershipCore", true, 0, 100, 100, 1.875f, 1.0f, 2.0f, 0.0f, 1853, 2, 480.0f, false, false, 9.0f, 0, 0, false, 464, 3, 55, 1, 27, 0 },
+    { 489, "LocustMP", true, 0, 0, 0, 1.875f, 0.0f, 0.0f, 0.0f, 2018, 1, 0.0f, false, false, 6.0f, 0, 0, false, 467, 2, 56, 1, 27, 0 },
+    { 490, "CollapsibleRockTowerDebris", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 1996, 3, 0.0f, false, false, 0.0f, 0, 0, false, 469, 2, 57, 0, 27, 0 },
+    { 491, "NydusCanalAttacker", true, 0, 200, 0, 0.0f, 1.0f, 2.0f, 0.0f, 1769, 1, 320.0f, false, false, 10.0f, 0, 0, false, 471, 3, 57, 1, 27, 0 },
+    { 492, "NydusCanalCreeper", true, 0, 150, 75, 0.0f, 1.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 10.0f, 0, 0, false, 474, 3, 58, 0, 27, 0 },
+    { 493, "SwarmHostBurrowedMP", true, 0, 100, 75, 0.0f, 1.0f, 3.0f, 0.0f, 2014, 1, 42.0f, false, false, 10.0f, 494, 0, false, 477, 2, 58, 0, 27, 0 },
+    { 494, "SwarmHostMP", true, 4, 100, 75, 2.25f, 1.0f, 3.0f, 0.0f, 1356, 1, 640.0f, false, false, 10.0f, 0, 94, false, 479, 2, 58, 0, 27, 0 },
+    { 495, "Oracle", true, 0, 150, 150, 4.0f, 0.0f, 3.0f, 0.0f, 954, 2, 832.0f, false, false, 10.0f, 0, 0, false, 481, 3, 58, 0, 27, 0 },
+    { 496, "Tempest", true, 0, 250, 175, 2.25f, 2.0f, 5.0f, 0.0f, 955, 2, 960.0f, false, false, 12.0f, 0, 64, false, 484, 3, 58, 2, 27, 0 },
+    { 497, "WarHound", true, 4, 150, 75, 2.8125f, 1.0f, 3.0f, 0.0f, 0, 0, 0.0f, false, false, 11.0f, 0, 0, false, 487, 2, 60, 1, 27, 0 },
+    { 498, "WidowMine", true, 2, 75, 25, 2.8125f, 0.0f, 2.0f, 0.0f, 614, 0, 480.0f, false, false, 7.0f, 0, 0, false, 489, 2, 61, 0, 27, 0 },
+    { 499, "Viper", true, 0, 100, 200, 2.95311999f, 1.0f, 3.0f, 0.0f, 1354, 1, 640.0f, false, false, 11.0f, 0, 101, false, 491, 3, 61, 0, 27, 0 },
+    { 500, "WidowMineBurrowed", true, 0, 75, 25, 0.0f, 0.0f, 2.0f, 0.0f, 2095, 0, 52.0f, false, false, 7.0f, 498, 0, false, 494, 2, 61, 0, 27, 1 },
+    { 501, "LurkerMPEgg", true, 0, 0, 0, 3.375f, 1.0f, 2.0f, 0.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 496, 1, 61, 0, 28, 0 },
+    { 502, "LurkerMP", true, 4, 150, 150, 2.95311999f, 1.0f, 3.0f, 0.0f, 2104, 1, 553.328003f, false, false, 10.0f, 0, 504, false, 497, 2, 61, 0, 28, 0 },
+    { 503, "LurkerMPBurrowed", true, 0, 150, 150, 0.0f, 1.0f, 3.0f, 0.0f, 2108, 1, 42.0f, false, false, 10.0f, 502, 0, false, 499, 2, 61, 1, 28, 0 },
+    { 504, "LurkerDenMP", true, 0, 150, 150, 0.0f, 1.0f, 0.0f, 0.0f, 1163, 1, 1920.0f, false, false, 9.0f, 0, 91, false, 501, 3, 62, 0, 28, 0 },
+    { 505, "ExtendingBridgeNEWide8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2118, 0, 48.0f, false, false, 0.0f, 0, 0, false, 504, 1, 62, 0, 28, 0 },
+    { 506, "ExtendingBridgeNEWide8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2120, 0, 48.0f, false, false, 0.0f, 0, 0, false, 505, 1, 62, 0, 28, 0 },
+    { 507, "ExtendingBridgeNWWide8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2122, 0, 48.0f, false, false, 0.0f, 0, 0, false, 506, 1, 62, 0, 28, 0 },
+    { 508, "ExtendingBridgeNWWide8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2124, 0, 48.0f, false, false, 0.0f, 0, 0, false, 507, 1, 62, 0, 28, 0 },
+    { 509, "ExtendingBridgeNEWide10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2126, 0, 48.0f, false, false, 0.0f, 0, 0, false, 508, 1, 62, 0, 28, 0 },
+    { 510, "ExtendingBridgeNEWide10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2128, 0, 48.0f, false, false, 0.0f, 0, 0, false, 509, 1, 62, 0, 28, 0 },
+    { 511, "ExtendingBridgeNWWide10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2130, 0, 48.0f, false, false, 0.0f, 0, 0, false, 510, 1, 62, 0, 28, 0 },
+    { 512, "ExtendingBridgeNWWide10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2132, 0, 48.0f, false, false, 0.0f, 0, 0, false, 511, 1, 62, 0, 28, 0 },
+    { 513, "ExtendingBridgeNEWide12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2134, 0, 48.0f, false, false, 0.0f, 0, 0, false, 512, 1, 62, 0, 28, 0 },
+    { 514, "ExtendingBridgeNEWide12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2136, 0, 48.0f, false, false, 0.0f, 0, 0, false, 513, 1, 62, 0, 28, 0 },
+    { 515, "ExtendingBridgeNWWide12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2138, 0, 48.0f, false, false, 0.0f, 0, 0, false, 514, 1, 62, 0, 28, 0 },
+    { 516, "ExtendingBridgeNWWide12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2140, 0, 48.0f, false, false, 0.0f, 0, 0, false, 515, 1, 62, 0, 28, 0 },
+    { 517, "CollapsibleRockTowerDebrisRampRight", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 2152, 3, 0.0f, false, false, 0.0f, 0, 0, false, 516, 2, 62, 0, 28, 0 },
+    { 518, "CollapsibleRockTowerDebrisRampLeft", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 2154, 3, 0.0f, false, false, 0.0f, 0, 0, false, 518, 2, 62, 0, 28, 0 },
+    { 519, "XelNaga_Caverns_DoorE", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2164, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 520, "XelNaga_Caverns_DoorEOpened", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2166, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 521, "XelNaga_Caverns_DoorN", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2168, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 522, "XelNaga_Caverns_DoorNE", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2170, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 523, "XelNaga_Caverns_DoorNEOpened", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2172, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 524, "XelNaga_Caverns_DoorNOpened", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2174, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 525, "XelNaga_Caverns_DoorNW", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2176, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 526, "XelNaga_Caverns_DoorNWOpened", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2178, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 527, "XelNaga_Caverns_DoorS", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2180, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 528, "XelNaga_Caverns_DoorSE", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2182, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 529, "XelNaga_Caverns_DoorSEOpened", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2184, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 530, "XelNaga_Caverns_DoorSOpened", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2186, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 531, "XelNaga_Caverns_DoorSW", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2188, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 532, "XelNaga_Caverns_DoorSWOpened", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2190, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 533, "XelNaga_Caverns_DoorW", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2192, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 534, "XelNaga_Caverns_DoorWOpened", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2194, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 520, 0, 62, 0, 28, 0 },
+    { 535, "XelNaga_Caverns_Floating_BridgeNE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2196, 0, 48.0f, false, false, 0.0f, 0, 0, false, 520, 1, 62, 0, 28, 0 },
+    { 536, "XelNaga_Caverns_Floating_BridgeNE8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2198, 0, 48.0f, false, false, 0.0f, 0, 0, false, 521, 1, 62, 0, 28, 0 },
+    { 537, "XelNaga_Caverns_Floating_BridgeNW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2200, 0, 48.0f, false, false, 0.0f, 0, 0, false, 522, 1, 62, 0, 28, 0 },
+    { 538, "XelNaga_Caverns_Floating_BridgeNW8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2202, 0, 48.0f, false, false, 0.0f, 0, 0, false, 523, 1, 62, 0, 28, 0 },
+    { 539, "XelNaga_Caverns_Floating_BridgeNE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2204, 0, 48.0f, false, false, 0.0f, 0, 0, false, 524, 1, 62, 0, 28, 0 },
+    { 540, "XelNaga_Caverns_Floating_BridgeNE10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2206, 0, 48.0f, false, false, 0.0f, 0, 0, false, 525, 1, 62, 0, 28, 0 },
+    { 541, "XelNaga_Caverns_Floating_BridgeNW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2208, 0, 48.0f, false, false, 0.0f, 0, 0, false, 526, 1, 62, 0, 28, 0 },
+    { 542, "XelNaga_Caverns_Floating_BridgeNW10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2210, 0, 48.0f, false, false, 0.0f, 0, 0, false, 527, 1, 62, 0, 28, 0 },
+    { 543, "XelNaga_Caverns_Floating_BridgeNE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2212, 0, 48.0f, false, false, 0.0f, 0, 0, false, 528, 1, 62, 0, 28, 0 },
+    { 544, "XelNaga_Caverns_Floating_BridgeNE12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2214, 0, 48.0f, false, false, 0.0f, 0, 0, false, 529, 1, 62, 0, 28, 0 },
+    { 545, "XelNaga_Caverns_Floating_BridgeNW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2216, 0, 48.0f, false, false, 0.0f, 0, 0, false, 530, 1, 62, 0, 28, 0 },
+    { 546, "XelNaga_Caverns_Floating_BridgeNW12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2218, 0, 48.0f, false, false, 0.0f, 0, 0, false, 531, 1, 62, 0, 28, 0 },
+    { 547, "XelNaga_Caverns_Floating_BridgeH8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2220, 0, 48.0f, false, false, 0.0f, 0, 0, false, 532, 1, 62, 0, 28, 0 },
+    { 548, "XelNaga_Caverns_Floating_BridgeH8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2222, 0, 48.0f, false, false, 0.0f, 0, 0, false, 533, 1, 62, 0, 28, 0 },
+    { 549, "XelNaga_Caverns_Floating_BridgeV8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2224, 0, 48.0f, false, false, 0.0f, 0, 0, false, 534, 1, 62, 0, 28, 0 },
+    { 550, "XelNaga_Caverns_Floating_BridgeV8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2226, 0, 48.0f, false, false, 0.0f, 0, 0, false, 535, 1, 62, 0, 28, 0 },
+    { 551, "XelNaga_Caverns_Floating_BridgeH10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2228, 0, 48.0f, false, false, 0.0f, 0, 0, false, 536, 1, 62, 0, 28, 0 },
+    { 552, "XelNaga_Caverns_Floating_BridgeH10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2230, 0, 48.0f, false, false, 0.0f, 0, 0, false, 537, 1, 62, 0, 28, 0 },
+    { 553, "XelNaga_Caverns_Floating_BridgeV10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2232, 0, 48.0f, false, false, 0.0f, 0, 0, false, 538, 1, 62, 0, 28, 0 },
+    { 554, "XelNaga_Caverns_Floating_BridgeV10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2234, 0, 48.0f, false, false, 0.0f, 0, 0, false, 539, 1, 62, 0, 28, 0 },
+    { 555, "XelNaga_Caverns_Floating_BridgeH12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2236, 0, 48.0f, false, false, 0.0f, 0, 0, false, 540, 1, 62, 0, 28, 0 },
+    { 556, "XelNaga_Caverns_Floating_BridgeH12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2238, 0, 48.0f, false, false, 0.0f, 0, 0, false, 541, 1, 62, 0, 28, 0 },
+    { 557, "XelNaga_Caverns_Floating_BridgeV12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2240, 0, 48.0f, false, false, 0.0f, 0, 0, false, 542, 1, 62, 0, 28, 0 },
+    { 558, "XelNaga_Caverns_Floating_BridgeV12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2242, 0, 48.0f, false, false, 0.0f, 0, 0, false, 543, 1, 62, 0, 28, 0 },
+    { 559, "CollapsibleTerranTowerPushUnitRampLeft", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 544, 2, 62, 0, 28, 0 },
+    { 560, "CollapsibleTerranTowerPushUnitRampRight", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 546, 2, 62, 0, 28, 0 },
+    { 561, "CollapsibleRockTowerPushUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 548, 2, 62, 0, 28, 0 },
+    { 562, "CollapsibleTerranTowerPushUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 550, 2, 62, 0, 28, 0 },
+    { 563, "CollapsibleRockTowerPushUnitRampRight", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 552, 2, 62, 0, 28, 0 },
+    { 564, "CollapsibleRockTowerPushUnitRampLeft", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 554, 2, 62, 0, 28, 0 },
+    { 565, "DigesterCreepSprayTargetUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 556, 6, 62, 0, 28, 0 },
+    { 566, "DigesterCreepSprayUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 562, 0, 62, 0, 28, 0 },
+    { 567, "NydusCanalAttackerWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 562, 0, 62, 0, 28, 0 },
+    { 568, "ViperConsumeStructureWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 562, 0, 62, 0, 28, 0 },
+    { 569, "ResourceBlocker", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 2.0f, 0, 0, false, 562, 1, 62, 0, 28, 0 },
+    { 570, "TempestWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 571, "YoinkMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 572, "YoinkVikingAirMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 573, "YoinkVikingGroundMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 574, "YoinkSiegeTankMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 575, "WarHoundWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 576, "EyeStalkWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 577, "WidowMineWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 578, "WidowMineAirWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 579, "MothershipCoreWeaponWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 580, "TornadoMissileWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 581, "TornadoMissileDummyWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 582, "TalonsMissileWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 583, "CreepTumorMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 584, "LocustMPEggAMissileWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 585, "LocustMPEggBMissileWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 586, "LocustMPWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 587, "RepulsorCannonWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 563, 0, 62, 0, 28, 0 },
+    { 588, "CollapsibleRockTowerDiagonal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 563, 2, 62, 0, 28, 0 },
+    { 589, "CollapsibleTerranTowerDiagonal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 565, 2, 62, 0, 28, 0 },
+    { 590, "CollapsibleTerranTowerRampLeft", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 567, 2, 62, 0, 28, 0 },
+    { 591, "CollapsibleTerranTowerRampRight", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 569, 2, 62, 0, 28, 0 },
+    { 592, "Ice2x2NonConjoined", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 571, 2, 62, 0, 28, 0 },
+    { 593, "IceProtossCrates", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 594, "ProtossCrates", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 595, "TowerMine", true, 0, 50, 0, 0.0f, 0.0f, 4.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 596, "PickupPalletGas", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 597, "PickupPalletMinerals", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 598, "PickupScrapSalvage1x1", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 599, "PickupScrapSalvage2x2", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 600, "PickupScrapSalvage3x3", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 601, "RoughTerrain", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 602, "UnbuildableBricksSmallUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 603, "UnbuildablePlatesSmallUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 604, "UnbuildablePlatesUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 605, "UnbuildableRocksSmallUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 606, "XelNagaHealingShrine", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 607, "InvisibleTargetDummy", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 573, 0, 62, 0, 28, 0 },
+    { 608, "ProtossVespeneGeyser", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, true, 0.0f, 342, 0, false, 573, 1, 62, 0, 28, 0 },
+    { 609, "CollapsibleRockTower", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 574, 2, 62, 0, 28, 0 },
+    { 610, "CollapsibleTerranTower", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 576, 2, 62, 0, 28, 0 },
+    { 611, "ThornLizard", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 578, 1, 62, 0, 28, 0 },
+    { 612, "CleaningBot", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 579, 1, 62, 0, 28, 0 },
+    { 613, "DestructibleRock6x6Weak", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 580, 2, 62, 0, 28, 0 },
+    { 614, "ProtossSnakeSegmentDemo", true, 0, 150, 100, 4.0f, 1.0f, 0.0f, 8.0f, 0, 3, 0.0f, false, false, 11.0f, 0, 0, false, 582, 2, 62, 0, 28, 0 },
+    { 615, "PhysicsCapsule", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 0, 62, 0, 28, 0 },
+    { 616, "PhysicsCube", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 0, 62, 0, 28, 0 },
+    { 617, "PhysicsCylinder", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 0, 62, 0, 28, 0 },
+    { 618, "PhysicsKnot", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 0, 62, 0, 28, 0 },
+    { 619, "PhysicsL", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 0, 62, 0, 28, 0 },
+    { 620, "PhysicsPrimitives", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 0, 62, 0, 28, 0 },
+    { 621, "PhysicsSphere", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 0, 62, 0, 28, 0 },
+    { 622, "PhysicsStar", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 0, 62, 0, 28, 0 },
+    { 623, "CreepBlocker4x4", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 0, 62, 0, 28, 0 },
+    { 624, "DestructibleCityDebris2x4Vertical", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 584, 2, 62, 0, 28, 0 },
+    { 625, "DestructibleCityDebris2x4Horizontal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 586, 2, 62, 0, 28, 0 },
+    { 626, "DestructibleCityDebris2x6Vertical", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 588, 2, 62, 0, 28, 0 },
+    { 627, "DestructibleCityDebris2x6Horizontal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 590, 2, 62, 0, 28, 0 },
+    { 628, "DestructibleCityDebris4x4", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 592, 2, 62, 0, 28, 0 },
+    { 629, "DestructibleCityDebris6x6", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 594, 2, 62, 0, 28, 0 },
+    { 630, "DestructibleCityDebrisHugeDiagonalBLUR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 596, 2, 62, 0, 28, 0 },
+    { 631, "DestructibleCityDebrisHugeDiagonalULBR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 598, 2, 62, 0, 28, 0 },
+    { 632, "TestZerg", true, 2, 50, 0, 2.94921994f, 1.0f, 1.0f, 0.0f, 0, 1, 0.0f, false, false, 8.0f, 0, 0, false, 600, 2, 62, 0, 28, 0 },
+    { 633, "PathingBlockerRadius1", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 602, 0, 62, 0, 28, 0 },
+    { 634, "DestructibleRockEx12x4Vertical", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 366, 0, false, 602, 2, 62, 0, 28, 0 },
+    { 635, "DestructibleRockEx12x4Horizontal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 367, 0, false, 604, 2, 62, 0, 28, 0 },
+    { 636, "DestructibleRockEx12x6Vertical", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 368, 0, false, 606, 2, 62, 0, 28, 0 },
+    { 637, "DestructibleRockEx12x6Horizontal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 369, 0, false, 608, 2, 62, 0, 28, 0 },
+    { 638, "DestructibleRockEx14x4", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 370, 0, false, 610, 2, 62, 0, 28, 0 },
+    { 639, "DestructibleRockEx16x6", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 371, 0, false, 612, 2, 62, 0, 28, 0 },
+    { 640, "DestructibleRockEx1DiagonalHugeULBR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 372, 0, false, 614, 2, 62, 0, 28, 0 },
+    { 641, "DestructibleRockEx1DiagonalHugeBLUR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 373, 0, false, 616, 2, 62, 0, 28, 0 },
+    { 642, "DestructibleRockEx1VerticalHuge", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 374, 0, false, 618, 2, 62, 0, 28, 0 },
+    { 643, "DestructibleRockEx1HorizontalHuge", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 375, 0, false, 620, 2, 62, 0, 28, 0 },
+    { 644, "DestructibleIce2x4Vertical", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 366, 0, false, 622, 2, 62, 0, 28, 0 },
+    { 645, "DestructibleIce2x4Horizontal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 367, 0, false, 624, 2, 62, 0, 28, 0 },
+    { 646, "DestructibleIce2x6Vertical", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 368, 0, false, 626, 2, 62, 0, 28, 0 },
+    { 647, "DestructibleIce2x6Horizontal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 369, 0, false, 628, 2, 62, 0, 28, 0 },
+    { 648, "DestructibleIce4x4", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 370, 0, false, 630, 2, 62, 0, 28, 0 },
+    { 649, "DestructibleIce6x6", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 371, 0, false, 632, 2, 62, 0, 28, 0 },
+    { 650, "DestructibleIceDiagonalHugeULBR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 372, 0, false, 634, 2, 62, 0, 28, 0 },
+    { 651, "DestructibleIceDiagonalHugeBLUR", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 373, 0, false, 636, 2, 62, 0, 28, 0 },
+    { 652, "DestructibleIceVerticalHuge", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 374, 0, false, 638, 2, 62, 0, 28, 0 },
+    { 653, "DestructibleIceHorizontalHuge", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 375, 0, false, 640, 2, 62, 0, 28, 0 },
+    { 654, "DesertPlanetSearchlight", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 642, 1, 62, 0, 28, 0 },
+    { 655, "DesertPlanetStreetlight", true, 0, 0, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 2.5f, 0, 0, false, 643, 1, 62, 0, 28, 0 },
+    { 656, "UnbuildableBricksUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 644, 0, 62, 0, 28, 0 },
+    { 657, "UnbuildableRocksUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 644, 0, 62, 0, 28, 0 },
+    { 658, "ZerusDestructibleArch", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 644, 2, 62, 0, 28, 0 },
+    { 659, "Artosilope", true, 0, 0, 0, 2.25f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 646, 1, 62, 0, 28, 0 },
+    { 660, "Anteplott", true, 0, 0, 0, 2.25f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 647, 1, 62, 0, 28, 0 },
+    { 661, "LabBot", true, 0, 0, 0, 2.25f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 648, 2, 62, 0, 28, 0 },
+    { 662, "Crabeetle", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 650, 1, 62, 0, 28, 0 },
+    { 663, "CollapsibleRockTowerRampRight", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 651, 2, 62, 0, 28, 0 },
+    { 664, "CollapsibleRockTowerRampLeft", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 653, 2, 62, 0, 28, 0 },
+    { 665, "LabMineralField", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 655, 1, 62, 0, 28, 0 },
+    { 666, "LabMineralField750", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 656, 1, 62, 0, 28, 0 },
+    { 667, "SnowRefinery_Terran_ExtendingBridgeNEShort8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2246, 0, 48.0f, false, false, 0.0f, 0, 0, false, 657, 1, 62, 0, 28, 0 },
+    { 668, "SnowRefinery_Terran_ExtendingBridgeNEShort8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2248, 0, 48.0f, false, false, 0.0f, 0, 0, false, 658, 1, 62, 0, 28, 0 },
+    { 669, "SnowRefinery_Terran_ExtendingBridgeNWShort8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2250, 0, 48.0f, false, false, 0.0f, 0, 0, false, 659, 1, 62, 0, 28, 0 },
+    { 670, "SnowRefinery_Terran_ExtendingBridgeNWShort8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2252, 0, 48.0f, false, false, 0.0f, 0, 0, false, 660, 1, 62, 0, 28, 0 },
+    { 671, "Tarsonis_DoorN", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2262, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 672, "Tarsonis_DoorNLowered", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2264, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 673, "Tarsonis_DoorNE", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2266, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 674, "Tarsonis_DoorNELowered", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2268, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 675, "Tarsonis_DoorE", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2270, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 676, "Tarsonis_DoorELowered", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2272, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 677, "Tarsonis_DoorNW", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2274, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 678, "Tarsonis_DoorNWLowered", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2276, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 679, "CompoundMansion_DoorN", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2278, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 680, "CompoundMansion_DoorNLowered", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2280, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 681, "CompoundMansion_DoorNE", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2282, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 682, "CompoundMansion_DoorNELowered", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2284, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 683, "CompoundMansion_DoorE", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2286, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 684, "CompoundMansion_DoorELowered", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2288, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 685, "CompoundMansion_DoorNW", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2290, 3, 53.3280983f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 686, "CompoundMansion_DoorNWLowered", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2292, 3, 42.6719017f, false, false, 0.0f, 0, 0, false, 661, 0, 62, 0, 28, 0 },
+    { 687, "RavagerCocoon", true, 0, 0, 0, 0.0f, 5.0f, 2.0f, 0.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 661, 1, 62, 0, 28, 0 },
+    { 688, "Ravager", true, 4, 100, 100, 2.75f, 1.0f, 3.0f, 0.0f, 2330, 1, 196.0f, false, false, 9.0f, 0, 97, false, 662, 1, 62, 1, 28, 0 },
+    { 689, "Liberator", true, 0, 150, 150, 3.375f, 0.0f, 3.0f, 0.0f, 626, 0, 960.0f, false, false, 10.0f, 0, 0, false, 663, 2, 63, 1, 28, 0 },
+    { 690, "RavagerBurrowed", true, 0, 100, 100, 0.0f, 1.0f, 3.0f, 0.0f, 2340, 1, 9.69141006f, false, false, 5.0f, 688, 0, false, 665, 1, 64, 0, 28, 0 },
+    { 691, "ThorAP", true, 8, 300, 200, 1.875f, 1.0f, 6.0f, 0.0f, 2362, 0, 42.0f, false, false, 11.0f, 52, 0, false, 666, 3, 64, 2, 28, 1 },
+    { 692, "Cyclone", true, 4, 150, 100, 3.375f, 1.0f, 3.0f, 0.0f, 597, 0, 720.0f, false, false, 11.0f, 0, 5, true, 669, 2, 66, 1, 29, 0 },
+    { 693, "LocustMPFlying", true, 0, 0, 0, 1.875f, 0.0f, 0.0f, 0.0f, 2385, 1, 8.0f, false, false, 6.0f, 489, 0, false, 671, 2, 67, 0, 29, 0 },
+    { 694, "Disruptor", true, 4, 150, 150, 2.25f, 1.0f, 3.0f, 0.0f, 994, 2, 800.0f, false, false, 9.0f, 0, 70, false, 673, 2, 67, 0, 29, 0 },
+    { 695, "AiurLightBridgeNE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2397, 0, 48.0f, false, false, 0.0f, 0, 0, false, 675, 1, 67, 0, 29, 0 },
+    { 696, "AiurLightBridgeNE8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2399, 0, 48.0f, false, false, 0.0f, 0, 0, false, 676, 1, 67, 0, 29, 0 },
+    { 697, "AiurLightBridgeNE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2401, 0, 48.0f, false, false, 0.0f, 0, 0, false, 677, 1, 67, 0, 29, 0 },
+    { 698, "AiurLightBridgeNE10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2403, 0, 48.0f, false, false, 0.0f, 0, 0, false, 678, 1, 67, 0, 29, 0 },
+    { 699, "AiurLightBridgeNE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2405, 0, 48.0f, false, false, 0.0f, 0, 0, false, 679, 1, 67, 0, 29, 0 },
+    { 700, "AiurLightBridgeNE12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2407, 0, 48.0f, false, false, 0.0f, 0, 0, false, 680, 1, 67, 0, 29, 0 },
+    { 701, "AiurLightBridgeNW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2409, 0, 48.0f, false, false, 0.0f, 0, 0, false, 681, 1, 67, 0, 29, 0 },
+    { 702, "AiurLightBridgeNW8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2411, 0, 48.0f, false, false, 0.0f, 0, 0, false, 682, 1, 67, 0, 29, 0 },
+    { 703, "AiurLightBridgeNW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2413, 0, 48.0f, false, false, 0.0f, 0, 0, false, 683, 1, 67, 0, 29, 0 },
+    { 704, "AiurLightBridgeNW10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2415, 0, 48.0f, false, false, 0.0f, 0, 0, false, 684, 1, 67, 0, 29, 0 },
+    { 705, "AiurLightBridgeNW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2417, 0, 48.0f, false, false, 0.0f, 0, 0, false, 685, 1, 67, 0, 29, 0 },
+    { 706, "AiurLightBridgeNW12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2419, 0, 48.0f, false, false, 0.0f, 0, 0, false, 686, 1, 67, 0, 29, 0 },
+    { 707, "AiurTempleBridgeNE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2421, 0, 48.0f, false, false, 0.0f, 0, 0, false, 687, 1, 67, 0, 29, 0 },
+    { 708, "AiurTempleBridgeNE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2425, 0, 48.0f, false, false, 0.0f, 0, 0, false, 688, 1, 67, 0, 29, 0 },
+    { 709, "AiurTempleBridgeNE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2429, 0, 48.0f, false, false, 0.0f, 0, 0, false, 689, 1, 67, 0, 29, 0 },
+    { 710, "AiurTempleBridgeNW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2433, 0, 48.0f, false, false, 0.0f, 0, 0, false, 690, 1, 67, 0, 29, 0 },
+    { 711, "AiurTempleBridgeNW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2437, 0, 48.0f, false, false, 0.0f, 0, 0, false, 691, 1, 67, 0, 29, 0 },
+    { 712, "AiurTempleBridgeNW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2441, 0, 48.0f, false, false, 0.0f, 0, 0, false, 692, 1, 67, 0, 29, 0 },
+    { 713, "ShakurasLightBridgeNE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2445, 0, 48.0f, false, false, 0.0f, 0, 0, false, 693, 1, 67, 0, 29, 0 },
+    { 714, "ShakurasLightBridgeNE8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2447, 0, 48.0f, false, false, 0.0f, 0, 0, false, 694, 1, 67, 0, 29, 0 },
+    { 715, "ShakurasLightBridgeNE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2449, 0, 48.0f, false, false, 0.0f, 0, 0, false, 695, 1, 67, 0, 29, 0 },
+    { 716, "ShakurasLightBridgeNE10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2451, 0, 48.0f, false, false, 0.0f, 0, 0, false, 696, 1, 67, 0, 29, 0 },
+    { 717, "ShakurasLightBridgeNE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2453, 0, 48.0f, false, false, 0.0f, 0, 0, false, 697, 1, 67, 0, 29, 0 },
+    { 718, "ShakurasLightBridgeNE12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2455, 0, 48.0f, false, false, 0.0f, 0, 0, false, 698, 1, 67, 0, 29, 0 },
+    { 719, "ShakurasLightBridgeNW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2457, 0, 48.0f, false, false, 0.0f, 0, 0, false, 699, 1, 67, 0, 29, 0 },
+    { 720, "ShakurasLightBridgeNW8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2459, 0, 48.0f, false, false, 0.0f, 0, 0, false, 700, 1, 67, 0, 29, 0 },
+    { 721, "ShakurasLightBridgeNW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2461, 0, 48.0f, false, false, 0.0f, 0, 0, false, 701, 1, 67, 0, 29, 0 },
+    { 722, "ShakurasLightBridgeNW10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2463, 0, 48.0f, false, false, 0.0f, 0, 0, false, 702, 1, 67, 0, 29, 0 },
+    { 723, "ShakurasLightBridgeNW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2465, 0, 48.0f, false, false, 0.0f, 0, 0, false, 703, 1, 67, 0, 29, 0 },
+    { 724, "ShakurasLightBridgeNW12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2467, 0, 48.0f, false, false, 0.0f, 0, 0, false, 704, 1, 67, 0, 29, 0 },
+    { 725, "VoidMPImmortalReviveCorpse", true, 4, 250, 100, 2.25f, 1.0f, 4.0f, 0.0f, 2471, 2, 0.0f, false, false, 0.0f, 0, 0, false, 705, 2, 67, 0, 29, 0 },
+    { 726, "GuardianCocoonMP", true, 0, 150, 200, 1.40625f, 2.0f, 2.0f, 0.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 707, 2, 67, 0, 29, 0 },
+    { 727, "GuardianMP", true, 0, 150, 200, 1.5f, 2.0f, 2.0f, 0.0f, 2479, 1, 640.015991f, false, false, 10.0f, 0, 102, false, 709, 3, 67, 1, 29, 0 },
+    { 728, "DevourerCocoonMP", true, 0, 150, 200, 1.40625f, 2.0f, 2.0f, 0.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 712, 2, 68, 0, 29, 0 },
+    { 729, "DevourerMP", true, 0, 250, 150, 2.25f, 2.0f, 2.0f, 0.0f, 2481, 1, 640.015991f, false, false, 9.0f, 0, 102, false, 714, 3, 68, 1, 29, 0 },
+    { 730, "DefilerMPBurrowed", true, 2, 50, 150, 0.0f, 1.0f, 2.0f, 0.0f, 2489, 1, 24.2910004f, false, false, 5.0f, 0, 0, false, 717, 2, 69, 0, 29, 0 },
+    { 731, "DefilerMP", true, 2, 50, 150, 2.25f, 1.0f, 2.0f, 0.0f, 2491, 1, 8.8007803f, false, false, 10.0f, 0, 0, false, 719, 2, 69, 0, 29, 0 },
+    { 732, "OracleStasisTrap", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 2505, 2, 80.0f, false, false, 4.0f, 0, 0, false, 721, 2, 69, 0, 29, 0 },
+    { 733, "DisruptorPhased", true, 4, 0, 0, 2.25f, 1.0f, 3.0f, 0.0f, 2546, 2, 0.0f, false, false, 9.0f, 0, 0, false, 723, 2, 69, 0, 29, 0 },
+    { 734, "LiberatorAG", true, 0, 150, 150, 0.0f, 0.0f, 3.0f, 0.0f, 2554, 0, 64.6679993f, false, false, 10.0f, 689, 0, false, 725, 2, 69, 1, 29, 1 },
+    { 735, "AiurLightBridgeAbandonedNE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2564, 0, 48.0f, false, false, 0.0f, 0, 0, false, 727, 1, 70, 0, 30, 0 },
+    { 736, "AiurLightBridgeAbandonedNE8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2566, 0, 48.0f, false, false, 0.0f, 0, 0, false, 728, 1, 70, 0, 30, 0 },
+    { 737, "AiurLightBridgeAbandonedNE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2568, 0, 48.0f, false, false, 0.0f, 0, 0, false, 729, 1, 70, 0, 30, 0 },
+    { 738, "AiurLightBridgeAbandonedNE10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2570, 0, 48.0f, false, false, 0.0f, 0, 0, false, 730, 1, 70, 0, 30, 0 },
+    { 739, "AiurLightBridgeAbandonedNE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2572, 0, 48.0f, false, false, 0.0f, 0, 0, false, 731, 1, 70, 0, 30, 0 },
+    { 740, "AiurLightBridgeAbandonedNE12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2574, 0, 48.0f, false, false, 0.0f, 0, 0, false, 732, 1, 70, 0, 30, 0 },
+    { 741, "AiurLightBridgeAbandonedNW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2576, 0, 48.0f, false, false, 0.0f, 0, 0, false, 733, 1, 70, 0, 30, 0 },
+    { 742, "AiurLightBridgeAbandonedNW8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2578, 0, 48.0f, false, false, 0.0f, 0, 0, false, 734, 1, 70, 0, 30, 0 },
+    { 743, "AiurLightBridgeAbandonedNW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2580, 0, 48.0f, false, false, 0.0f, 0, 0, false, 735, 1, 70, 0, 30, 0 },
+    { 744, "AiurLightBridgeAbandonedNW10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2582, 0, 48.0f, false, false, 0.0f, 0, 0, false, 736, 1, 70, 0, 30, 0 },
+    { 745, "AiurLightBridgeAbandonedNW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2584, 0, 48.0f, false, false, 0.0f, 0, 0, false, 737, 1, 70, 0, 30, 0 },
+    { 746, "AiurLightBridgeAbandonedNW12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2586, 0, 48.0f, false, false, 0.0f, 0, 0, false, 738, 1, 70, 0, 30, 0 },
+    { 747, "CollapsiblePurifierTowerDebris", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 2600, 3, 0.0f, false, false, 0.0f, 0, 0, false, 739, 2, 70, 0, 30, 0 },
+    { 748, "PortCity_Bridge_UnitNE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2602, 0, 48.0f, false, false, 0.0f, 0, 0, false, 741, 1, 70, 0, 30, 0 },
+    { 749, "PortCity_Bridge_UnitNE8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2604, 0, 48.0f, false, false, 0.0f, 0, 0, false, 742, 1, 70, 0, 30, 0 },
+    { 750, "PortCity_Bridge_UnitSE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2606, 0, 48.0f, false, false, 0.0f, 0, 0, false, 743, 1, 70, 0, 30, 0 },
+    { 751, "PortCity_Bridge_UnitSE8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2608, 0, 48.0f, false, false, 0.0f, 0, 0, false, 744, 1, 70, 0, 30, 0 },
+    { 752, "PortCity_Bridge_UnitNW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2610, 0, 48.0f, false, false, 0.0f, 0, 0, false, 745, 1, 70, 0, 30, 0 },
+    { 753, "PortCity_Bridge_UnitNW8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2612, 0, 48.0f, false, false, 0.0f, 0, 0, false, 746, 1, 70, 0, 30, 0 },
+    { 754, "PortCity_Bridge_UnitSW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2614, 0, 48.0f, false, false, 0.0f, 0, 0, false, 747, 1, 70, 0, 30, 0 },
+    { 755, "PortCity_Bridge_UnitSW8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2616, 0, 48.0f, false, false, 0.0f, 0, 0, false, 748, 1, 70, 0, 30, 0 },
+    { 756, "PortCity_Bridge_UnitNE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2618, 0, 48.0f, false, false, 0.0f, 0, 0, false, 749, 1, 70, 0, 30, 0 },
+    { 757, "PortCity_Bridge_UnitNE10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2620, 0, 48.0f, false, false, 0.0f, 0, 0, false, 750, 1, 70, 0, 30, 0 },
+    { 758, "PortCity_Bridge_UnitSE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2622, 0, 48.0f, false, false, 0.0f, 0, 0, false, 751, 1, 70, 0, 30, 0 },
+    { 759, "PortCity_Bridge_UnitSE10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2624, 0, 48.0f, false, false, 0.0f, 0, 0, false, 752, 1, 70, 0, 30, 0 },
+    { 760, "PortCity_Bridge_UnitNW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2626, 0, 48.0f, false, false, 0.0f, 0, 0, false, 753, 1, 70, 0, 30, 0 },
+    { 761, "PortCity_Bridge_UnitNW10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2628, 0, 48.0f, false, false, 0.0f, 0, 0, false, 754, 1, 70, 0, 30, 0 },
+    { 762, "PortCity_Bridge_UnitSW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2630, 0, 48.0f, false, false, 0.0f, 0, 0, false, 755, 1, 70, 0, 30, 0 },
+    { 763, "PortCity_Bridge_UnitSW10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2632, 0, 48.0f, false, false, 0.0f, 0, 0, false, 756, 1, 70, 0, 30, 0 },
+    { 764, "PortCity_Bridge_UnitNE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2634, 0, 48.0f, false, false, 0.0f, 0, 0, false, 757, 1, 70, 0, 30, 0 },
+    { 765, "PortCity_Bridge_UnitNE12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2636, 0, 48.0f, false, false, 0.0f, 0, 0, false, 758, 1, 70, 0, 30, 0 },
+    { 766, "PortCity_Bridge_UnitSE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2638, 0, 48.0f, false, false, 0.0f, 0, 0, false, 759, 1, 70, 0, 30, 0 },
+    { 767, "PortCity_Bridge_UnitSE12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2640, 0, 48.0f, false, false, 0.0f, 0, 0, false, 760, 1, 70, 0, 30, 0 },
+    { 768, "PortCity_Bridge_UnitNW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2642, 0, 48.0f, false, false, 0.0f, 0, 0, false, 761, 1, 70, 0, 30, 0 },
+    { 769, "PortCity_Bridge_UnitNW12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2644, 0, 48.0f, false, false, 0.0f, 0, 0, false, 762, 1, 70, 0, 30, 0 },
+    { 770, "PortCity_Bridge_UnitSW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2646, 0, 48.0f, false, false, 0.0f, 0, 0, false, 763, 1, 70, 0, 30, 0 },
+    { 771, "PortCity_Bridge_UnitSW12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2648, 0, 48.0f, false, false, 0.0f, 0, 0, false, 764, 1, 70, 0, 30, 0 },
+    { 772, "PortCity_Bridge_UnitN8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2650, 0, 48.0f, false, false, 0.0f, 0, 0, false, 765, 1, 70, 0, 30, 0 },
+    { 773, "PortCity_Bridge_UnitN8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2652, 0, 48.0f, false, false, 0.0f, 0, 0, false, 766, 1, 70, 0, 30, 0 },
+    { 774, "PortCity_Bridge_UnitS8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2654, 0, 48.0f, false, false, 0.0f, 0, 0, false, 767, 1, 70, 0, 30, 0 },
+    { 775, "PortCity_Bridge_UnitS8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2656, 0, 48.0f, false, false, 0.0f, 0, 0, false, 768, 1, 70, 0, 30, 0 },
+    { 776, "PortCity_Bridge_UnitE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2658, 0, 48.0f, false, false, 0.0f, 0, 0, false, 769, 1, 70, 0, 30, 0 },
+    { 777, "PortCity_Bridge_UnitE8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2660, 0, 48.0f, false, false, 0.0f, 0, 0, false, 770, 1, 70, 0, 30, 0 },
+    { 778, "PortCity_Bridge_UnitW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2662, 0, 48.0f, false, false, 0.0f, 0, 0, false, 771, 1, 70, 0, 30, 0 },
+    { 779, "PortCity_Bridge_UnitW8", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2664, 0, 48.0f, false, false, 0.0f, 0, 0, false, 772, 1, 70, 0, 30, 0 },
+    { 780, "PortCity_Bridge_UnitN10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2666, 0, 48.0f, false, false, 0.0f, 0, 0, false, 773, 1, 70, 0, 30, 0 },
+    { 781, "PortCity_Bridge_UnitN10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2668, 0, 48.0f, false, false, 0.0f, 0, 0, false, 774, 1, 70, 0, 30, 0 },
+    { 782, "PortCity_Bridge_UnitS10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2670, 0, 48.0f, false, false, 0.0f, 0, 0, false, 775, 1, 70, 0, 30, 0 },
+    { 783, "PortCity_Bridge_UnitS10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2672, 0, 48.0f, false, false, 0.0f, 0, 0, false, 776, 1, 70, 0, 30, 0 },
+    { 784, "PortCity_Bridge_UnitE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2674, 0, 48.0f, false, false, 0.0f, 0, 0, false, 777, 1, 70, 0, 30, 0 },
+    { 785, "PortCity_Bridge_UnitE10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2676, 0, 48.0f, false, false, 0.0f, 0, 0, false, 778, 1, 70, 0, 30, 0 },
+    { 786, "PortCity_Bridge_UnitW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2678, 0, 48.0f, false, false, 0.0f, 0, 0, false, 779, 1, 70, 0, 30, 0 },
+    { 787, "PortCity_Bridge_UnitW10", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2680, 0, 48.0f, false, false, 0.0f, 0, 0, false, 780, 1, 70, 0, 30, 0 },
+    { 788, "PortCity_Bridge_UnitN12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2682, 0, 48.0f, false, false, 0.0f, 0, 0, false, 781, 1, 70, 0, 30, 0 },
+    { 789, "PortCity_Bridge_UnitN12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2684, 0, 48.0f, false, false, 0.0f, 0, 0, false, 782, 1, 70, 0, 30, 0 },
+    { 790, "PortCity_Bridge_UnitS12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2686, 0, 48.0f, false, false, 0.0f, 0, 0, false, 783, 1, 70, 0, 30, 0 },
+    { 791, "PortCity_Bridge_UnitS12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2688, 0, 48.0f, false, false, 0.0f, 0, 0, false, 784, 1, 70, 0, 30, 0 },
+    { 792, "PortCity_Bridge_UnitE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2690, 0, 48.0f, false, false, 0.0f, 0, 0, false, 785, 1, 70, 0, 30, 0 },
+    { 793, "PortCity_Bridge_UnitE12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2692, 0, 48.0f, false, false, 0.0f, 0, 0, false, 786, 1, 70, 0, 30, 0 },
+    { 794, "PortCity_Bridge_UnitW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2694, 0, 48.0f, false, false, 0.0f, 0, 0, false, 787, 1, 70, 0, 30, 0 },
+    { 795, "PortCity_Bridge_UnitW12", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 2696, 0, 48.0f, false, false, 0.0f, 0, 0, false, 788, 1, 70, 0, 30, 0 },
+    { 796, "PurifierRichMineralField", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 789, 1, 70, 0, 30, 0 },
+    { 797, "PurifierRichMineralField750", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 790, 1, 70, 0, 30, 0 },
+    { 798, "CollapsiblePurifierTowerPushUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 791, 2, 70, 0, 30, 0 },
+    { 799, "LocustMPPrecursor", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 793, 0, 70, 0, 30, 0 },
+    { 800, "ReleaseInterceptorsBeacon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 793, 0, 70, 0, 30, 0 },
+    { 801, "AdeptPhaseShift", true, 2, 0, 0, 2.25f, 1.0f, 2.0f, 0.0f, 0, 2, 0.0f, false, false, 4.0f, 311, 0, false, 793, 2, 70, 0, 30, 0 },
+    { 802, "RavagerCorrosiveBileMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 803, "HydraliskImpaleMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 804, "CycloneMissileLargeAir", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 805, "CycloneMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 806, "CycloneMissileLarge", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 807, "ThorAALance", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 808, "OracleWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 809, "TempestWeaponGround", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 810, "RavagerWeaponMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 811, "ScoutMPAirWeaponLeft", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 812, "ScoutMPAirWeaponRight", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 813, "ArbiterMPWeaponMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 814, "GuardianMPWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 815, "DevourerMPWeaponMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 816, "DefilerMPDarkSwarmWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 817, "QueenMPEnsnareMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 818, "QueenMPSpawnBroodlingsMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 819, "LightningBombWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 795, 0, 70, 0, 30, 0 },
+    { 820, "HERCPlacement", true, 2, 200, 100, 2.25f, 1.0f, 3.0f, 0.0f, 0, 0, 0.0f, false, false, 9.0f, 838, 0, false, 795, 2, 70, 1, 30, 0 },
+    { 821, "GrappleWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 797, 0, 71, 0, 30, 0 },
+    { 822, "CausticSprayMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 797, 0, 71, 0, 30, 0 },
+    { 823, "ParasiticBombMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 797, 0, 71, 0, 30, 0 },
+    { 824, "ParasiticBombDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 797, 0, 71, 0, 30, 0 },
+    { 825, "AdeptWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 797, 0, 71, 0, 30, 0 },
+    { 826, "AdeptUpgradeWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 797, 0, 71, 0, 30, 0 },
+    { 827, "LiberatorMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 797, 0, 71, 0, 30, 0 },
+    { 828, "LiberatorDamageMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 797, 0, 71, 0, 30, 0 },
+    { 829, "LiberatorAGMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 797, 0, 71, 0, 30, 0 },
+    { 830, "KD8Charge", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 797, 1, 71, 0, 30, 0 },
+    { 831, "KD8ChargeWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 798, 0, 71, 0, 30, 0 },
+    { 832, "SlaynElementalGrabWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 798, 0, 71, 0, 30, 0 },
+    { 833, "SlaynElementalGrabAirUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 4.0f, 0, 0, false, 798, 1, 71, 0, 30, 0 },
+    { 834, "SlaynElementalGrabGroundUnit", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 4.0f, 0, 0, false, 799, 1, 71, 0, 30, 0 },
+    { 835, "SlaynElementalWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 800, 0, 71, 0, 30, 0 },
+    { 836, "DestructibleExpeditionGate6x6", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 800, 2, 71, 0, 30, 0 },
+    { 837, "DestructibleZergInfestation3x3", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 802, 2, 71, 0, 30, 0 },
+    { 838, "HERC", true, 2, 200, 100, 2.25f, 1.0f, 3.0f, 0.0f, 0, 0, 0.0f, false, false, 9.0f, 0, 0, false, 804, 2, 71, 1, 30, 0 },
+    { 839, "Moopy", true, 0, 0, 0, 2.25f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 9.0f, 0, 0, false, 806, 2, 72, 1, 30, 0 },
+    { 840, "Replicant", true, 4, 150, 300, 2.25f, 1.0f, 4.0f, 0.0f, 0, 2, 0.0f, false, false, 9.0f, 0, 0, false, 808, 2, 73, 0, 30, 0 },
+    { 841, "SeekerMissile", true, 0, 0, 0, 0.0976561978f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 810, 0, 73, 0, 30, 0 },
+    { 842, "AiurTempleBridgeDestructibleNE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 810, 1, 73, 0, 30, 0 },
+    { 843, "AiurTempleBridgeDestructibleNE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 811, 1, 73, 0, 30, 0 },
+    { 844, "AiurTempleBridgeDestructibleNE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 812, 1, 73, 0, 30, 0 },
+    { 845, "AiurTempleBridgeDestructibleNW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 813, 1, 73, 0, 30, 0 },
+    { 846, "AiurTempleBridgeDestructibleNW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 814, 1, 73, 0, 30, 0 },
+    { 847, "AiurTempleBridgeDestructibleNW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 815, 1, 73, 0, 30, 0 },
+    { 848, "AiurTempleBridgeDestructibleSW8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 816, 1, 73, 0, 30, 0 },
+    { 849, "AiurTempleBridgeDestructibleSW10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 817, 1, 73, 0, 30, 0 },
+    { 850, "AiurTempleBridgeDestructibleSW12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 818, 1, 73, 0, 30, 0 },
+    { 851, "AiurTempleBridgeDestructibleSE8Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 819, 1, 73, 0, 30, 0 },
+    { 852, "AiurTempleBridgeDestructibleSE10Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 820, 1, 73, 0, 30, 0 },
+    { 853, "AiurTempleBridgeDestructibleSE12Out", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 821, 1, 73, 0, 30, 0 },
+    { 854, "FlyoverUnit", true, 0, 0, 0, 2.75f, 0.0f, 2.0f, 0.0f, 0, 3, 0.0f, false, false, 30.0f, 0, 0, false, 822, 0, 73, 0, 30, 0 },
+    { 855, "CorsairMP", true, 0, 150, 100, 2.8125f, 1.0f, 2.0f, 0.0f, 0, 2, 0.0f, false, false, 9.0f, 0, 0, false, 822, 2, 73, 1, 30, 0 },
+    { 856, "ScoutMP", true, 0, 275, 125, 2.8125f, 0.0f, 3.0f, 0.0f, 0, 2, 0.0f, false, false, 9.0f, 0, 0, false, 824, 2, 74, 2, 30, 0 },
+    { 857, "ArbiterMP", true, 0, 100, 350, 2.25f, 0.0f, 4.0f, 0.0f, 0, 2, 0.0f, false, false, 9.0f, 0, 0, false, 826, 2, 76, 1, 30, 0 },
+    { 858, "ScourgeMP", true, 0, 12, 37, 3.5f, 0.0f, 0.5f, 0.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 828, 2, 77, 1, 30, 0 },
+    { 859, "DefilerMPPlagueWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 830, 0, 78, 0, 30, 0 },
+    { 860, "QueenMP", true, 0, 0, 0, 3.25f, 0.0f, 0.0f, 2.0f, 0, 1, 0.0f, false, false, 11.0f, 0, 0, false, 830, 1, 78, 0, 30, 0 },
+    { 861, "XelNagaDestructibleRampBlocker6S", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 831, 2, 78, 0, 30, 0 },
+    { 862, "XelNagaDestructibleRampBlocker6SE", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 833, 2, 78, 0, 30, 0 },
+    { 863, "XelNagaDestructibleRampBlocker6E", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 835, 2, 78, 0, 30, 0 },
+    { 864, "XelNagaDestructibleRampBlocker6NE", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 837, 2, 78, 0, 30, 0 },
+    { 865, "XelNagaDestructibleRampBlocker6N", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 839, 2, 78, 0, 30, 0 },
+    { 866, "XelNagaDestructibleRampBlocker6NW", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 841, 2, 78, 0, 30, 0 },
+    { 867, "XelNagaDestructibleRampBlocker6W", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 843, 2, 78, 0, 30, 0 },
+    { 868, "XelNagaDestructibleRampBlocker6SW", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 845, 2, 78, 0, 30, 0 },
+    { 869, "XelNagaDestructibleRampBlocker8S", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 847, 2, 78, 0, 30, 0 },
+    { 870, "XelNagaDestructibleRampBlocker8SE", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 849, 2, 78, 0, 30, 0 },
+    { 871, "XelNagaDestructibleRampBlocker8E", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 851, 2, 78, 0, 30, 0 },
+    { 872, "XelNagaDestructibleRampBlocker8NE", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 853, 2, 78, 0, 30, 0 },
+    { 873, "XelNagaDestructibleRampBlocker8N", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 855, 2, 78, 0, 30, 0 },
+    { 874, "XelNagaDestructibleRampBlocker8NW", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 857, 2, 78, 0, 30, 0 },
+    { 875, "XelNagaDestructibleRampBlocker8W", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 859, 2, 78, 0, 30, 0 },
+    { 876, "XelNagaDestructibleRampBlocker8SW", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 861, 2, 78, 0, 30, 0 },
+    { 877, "ReptileCrate", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 863, 1, 78, 0, 30, 0 },
+    { 878, "SlaynSwarmHostSpawnFlyer", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 864, 1, 78, 0, 30, 0 },
+    { 879, "SlaynElemental", true, 0, 0, 0, 1.0f, 1.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 10.0f, 0, 0, false, 865, 4, 78, 0, 30, 0 },
+    { 880, "PurifierVespeneGeyser", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, true, 0.0f, 342, 0, false, 869, 1, 78, 0, 30, 0 },
+    { 881, "ShakurasVespeneGeyser", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, true, 0.0f, 342, 0, false, 870, 1, 78, 0, 30, 0 },
+    { 882, "CollapsiblePurifierTowerDiagonal", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 871, 2, 78, 0, 30, 0 },
+    { 883, "CreepOnlyBlocker4x4", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 873, 0, 78, 0, 30, 0 },
+    { 884, "PurifierMineralField", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 873, 1, 78, 0, 30, 0 },
+    { 885, "PurifierMineralField750", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 874, 1, 78, 0, 30, 0 },
+    { 886, "BattleStationMineralField", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 875, 1, 78, 0, 30, 0 },
+    { 887, "BattleStationMineralField750", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 876, 1, 78, 0, 30, 0 },
+    { 888, "Beacon_Nova", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 877, 0, 78, 0, 30, 0 },
+    { 889, "Beacon_NovaSmall", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 877, 0, 78, 0, 30, 0 },
+    { 890, "Ursula", true, 0, 0, 0, 2.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 8.0f, 0, 0, false, 877, 1, 78, 0, 30, 0 },
+    { 891, "Elsecaro_Colonist_Hut", true, 0, 100, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 10.0f, 0, 0, false, 878, 3, 78, 0, 30, 0 },
+    { 892, "TransportOverlordCocoon", true, 0, 150, 100, 1.875f, 2.0f, 0.0f, 8.0f, 0, 1, 0.0f, false, false, 5.0f, 0, 0, false, 881, 1, 78, 0, 30, 0 },
+    { 893, "OverlordTransport", true, 0, 100, 0, 0.644531012f, 0.0f, 0.0f, 8.0f, 2708, 1, 266.679993f, false, false, 11.0f, 0, 100, false, 882, 2, 78, 0, 30, 1 },
+    { 894, "PylonOvercharged", true, 0, 100, 0, 0.0f, 1.0f, 0.0f, 8.0f, 2716, 2, 0.0f, false, false, 9.0f, 60, 0, false, 884, 2, 78, 0, 31, 2 },
+    { 895, "BypassArmorDrone", true, 0, 0, 0, 5.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 7.0f, 0, 0, false, 886, 3, 78, 0, 33, 0 },
+    { 896, "AdeptPiercingWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 897, "CorrosiveParasiteWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 898, "InfestedTerran", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 899, "MercCompound", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 900, "SupplyDepotDrop", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 901, "LurkerDen", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 902, "D8Charge", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 903, "ThorWreckage", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 904, "Goliath", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 905, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 906, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 907, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 908, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 909, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 910, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 911, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 912, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 913, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 914, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 915, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 916, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 917, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 918, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 919, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 920, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 921, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 922, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 923, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 924, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 925, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 926, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 927, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 928, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 929, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 930, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 931, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 932, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 933, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 934, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 935, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 936, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 937, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 938, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 939, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 940, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 941, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 942, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 943, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 944, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 945, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 946, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 947, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 948, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 949, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 950, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 951, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 952, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 953, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 954, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 955, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 956, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 957, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 958, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 959, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 960, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 961, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 962, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 963, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 964, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 965, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 966, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 967, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 968, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 969, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 970, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 971, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 972, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 973, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 974, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 975, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 976, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 977, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 978, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 979, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 980, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 981, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 982, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 983, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 984, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 985, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 986, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 987, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 988, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 989, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 990, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 991, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 992, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 993, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 994, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 995, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 996, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 997, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 998, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 999, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1000, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1001, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1002, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1003, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1004, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1005, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1006, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1007, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1008, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1009, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1010, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1011, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1012, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1013, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1014, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1015, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1016, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1017, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1018, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1019, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1020, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1021, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1022, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1023, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1024, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1025, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1026, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1027, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1028, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1029, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1030, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1031, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1032, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1033, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1034, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1035, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1036, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1037, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1038, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1039, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1040, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1041, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1042, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1043, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1044, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1045, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1046, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1047, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1048, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1049, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1050, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1051, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1052, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1053, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1054, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1055, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1056, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1057, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1058, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1059, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1060, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1061, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1062, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1063, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1064, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1065, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1066, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1067, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1068, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1069, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1070, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1071, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1072, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1073, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1074, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1075, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1076, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1077, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1078, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1079, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1080, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1081, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1082, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1083, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1084, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1085, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1086, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1087, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1088, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1089, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1090, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1091, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1092, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1093, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1094, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1095, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1096, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1097, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1098, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1099, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1100, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1101, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1102, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1103, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1104, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1105, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1106, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1107, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1108, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1109, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1110, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1111, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1112, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1113, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1114, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1115, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1116, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1117, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1118, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1119, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1120, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1121, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1122, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1123, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1124, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1125, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1126, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1127, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1128, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1129, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1130, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1131, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1132, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1133, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1134, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1135, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1136, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1137, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1138, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1139, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1140, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1141, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1142, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1143, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1144, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1145, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1146, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1147, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1148, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1149, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1150, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1151, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1152, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1153, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1154, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1155, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1156, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1157, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1158, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1159, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1160, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1161, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1162, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1163, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1164, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1165, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1166, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1167, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1168, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1169, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1170, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1171, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1172, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1173, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1174, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1175, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1176, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1177, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1178, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1179, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1180, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1181, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1182, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1183, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1184, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1185, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1186, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1187, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1188, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1189, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1190, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1191, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1192, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1193, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1194, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1195, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1196, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1197, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1198, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1199, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1200, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1201, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1202, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1203, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1204, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1205, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1206, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1207, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1208, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1209, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1210, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1211, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1212, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1213, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1214, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1215, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1216, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1217, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1218, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1219, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1220, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1221, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1222, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1223, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1224, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1225, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1226, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1227, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1228, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1229, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1230, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1231, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1232, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1233, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1234, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1235, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1236, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1237, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1238, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1239, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1240, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1241, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1242, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1243, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1244, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1245, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1246, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1247, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1248, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1249, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1250, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1251, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1252, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1253, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1254, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1255, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1256, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1257, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1258, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1259, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1260, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1261, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1262, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1263, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1264, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1265, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1266, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1267, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1268, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1269, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1270, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1271, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1272, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1273, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1274, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1275, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1276, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1277, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1278, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1279, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1280, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1281, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1282, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1283, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1284, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1285, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1286, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1287, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1288, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1289, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1290, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1291, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1292, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1293, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1294, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1295, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1296, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1297, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1298, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1299, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1300, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1301, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1302, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1303, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1304, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1305, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1306, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1307, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1308, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1309, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1310, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1311, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1312, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1313, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1314, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1315, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1316, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1317, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1318, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1319, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1320, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1321, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1322, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1323, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1324, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1325, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1326, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1327, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1328, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1329, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1330, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1331, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1332, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1333, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1334, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1335, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1336, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1337, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1338, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1339, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1340, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1341, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1342, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1343, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1344, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1345, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1346, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1347, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1348, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1349, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1350, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1351, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1352, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1353, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1354, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1355, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1356, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1357, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1358, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1359, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1360, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1361, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1362, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1363, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1364, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1365, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1366, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1367, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1368, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1369, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1370, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1371, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1372, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1373, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1374, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1375, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1376, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1377, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1378, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1379, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1380, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1381, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1382, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1383, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1384, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1385, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1386, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1387, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1388, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1389, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1390, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1391, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1392, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1393, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1394, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1395, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1396, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1397, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1398, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1399, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1400, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1401, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1402, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1403, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1404, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1405, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1406, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1407, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1408, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1409, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1410, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1411, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1412, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1413, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1414, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1415, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1416, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1417, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1418, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1419, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1420, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1421, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1422, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1423, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1424, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1425, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1426, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1427, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1428, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1429, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1430, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1431, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1432, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1433, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1434, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1435, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1436, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1437, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1438, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1439, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1440, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1441, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1442, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1443, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1444, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1445, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1446, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1447, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1448, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1449, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1450, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1451, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1452, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1453, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1454, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1455, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1456, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1457, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1458, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1459, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1460, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1461, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1462, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1463, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1464, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1465, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1466, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1467, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1468, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1469, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1470, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1471, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1472, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1473, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1474, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1475, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1476, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1477, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1478, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1479, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1480, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1481, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1482, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1483, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1484, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1485, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1486, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1487, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1488, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1489, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1490, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1491, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1492, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1493, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1494, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1495, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1496, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1497, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1498, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1499, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1500, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1501, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1502, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1503, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1504, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1505, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1506, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1507, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1508, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1509, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1510, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1511, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1512, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1513, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1514, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1515, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1516, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1517, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1518, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1519, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1520, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1521, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1522, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1523, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1524, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1525, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1526, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1527, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1528, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1529, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1530, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1531, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1532, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1533, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1534, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1535, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1536, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1537, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1538, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1539, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1540, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1541, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1542, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1543, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1544, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1545, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1546, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1547, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1548, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1549, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1550, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1551, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1552, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1553, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1554, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1555, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1556, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1557, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1558, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1559, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1560, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1561, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1562, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1563, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1564, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1565, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1566, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1567, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1568, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1569, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1570, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1571, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1572, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1573, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1574, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1575, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1576, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1577, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1578, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1579, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1580, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1581, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1582, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1583, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1584, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1585, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1586, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1587, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1588, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1589, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1590, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1591, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1592, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1593, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1594, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1595, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1596, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1597, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1598, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1599, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1600, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1601, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1602, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1603, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1604, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1605, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1606, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1607, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1608, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1609, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1610, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1611, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1612, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1613, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1614, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1615, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1616, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1617, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1618, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1619, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1620, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1621, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1622, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1623, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1624, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1625, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1626, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1627, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1628, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1629, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1630, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1631, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1632, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1633, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1634, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1635, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1636, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1637, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1638, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1639, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1640, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1641, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1642, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1643, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1644, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1645, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1646, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1647, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1648, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1649, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1650, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1651, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1652, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1653, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1654, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1655, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1656, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1657, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1658, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1659, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1660, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1661, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1662, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1663, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1664, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1665, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1666, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1667, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1668, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1669, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1670, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1671, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1672, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1673, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1674, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1675, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1676, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1677, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1678, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1679, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1680, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1681, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1682, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1683, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1684, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1685, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1686, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1687, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1688, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1689, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1690, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1691, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1692, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1693, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1694, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1695, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1696, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1697, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1698, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1699, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1700, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1701, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1702, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1703, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1704, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1705, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1706, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1707, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1708, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1709, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1710, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1711, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1712, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1713, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1714, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1715, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1716, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1717, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1718, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1719, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1720, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1721, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1722, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1723, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1724, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1725, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1726, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1727, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1728, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1729, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1730, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1731, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1732, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1733, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1734, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1735, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1736, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1737, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1738, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1739, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1740, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1741, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1742, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1743, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1744, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1745, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1746, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1747, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1748, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1749, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1750, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1751, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1752, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1753, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1754, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1755, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1756, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1757, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1758, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1759, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1760, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1761, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1762, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1763, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1764, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1765, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1766, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1767, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1768, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1769, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1770, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1771, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1772, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1773, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1774, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1775, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1776, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1777, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1778, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1779, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1780, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1781, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1782, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1783, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1784, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1785, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1786, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1787, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1788, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1789, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1790, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1791, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1792, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1793, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1794, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1795, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1796, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1797, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1798, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1799, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1800, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1801, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1802, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1803, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1804, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1805, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1806, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1807, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1808, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1809, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1810, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1811, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1812, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1813, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1814, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1815, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1816, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1817, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1818, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1819, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1820, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1821, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1822, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1823, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1824, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1825, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1826, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1827, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1828, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1829, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1830, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1831, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1832, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1833, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1834, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1835, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1836, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1837, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1838, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1839, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1840, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1841, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1842, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1843, "QueenZagaraACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1844, "OverseerZagaraACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1845, "StukovInfestedCivilianACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1846, "StukovInfestedMarineACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1847, "StukovInfestedSiegeTankACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1848, "StukovInfestedDiamondbackACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1849, "StukovInfestedBansheeACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1850, "SILiberatorACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1851, "StukovInfestedBunkerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1852, "StukovInfestedMissileTurretACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1853, "StukovBroodQueenACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1854, "ZealotFenixACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1855, "SentryFenixACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1856, "AdeptFenixACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1857, "ImmortalFenixACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1858, "ColossusFenixACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1859, "DisruptorACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1860, "ObserverFenixACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1861, "ScoutACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1862, "CarrierFenixACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1863, "PhotonCannonFenixACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1864, "PrimalZerglingACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1865, "RavasaurACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1866, "PrimalRoachACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1867, "FireRoachACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1868, "PrimalGuardianACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1869, "PrimalHydraliskACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1870, "PrimalMutaliskACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1871, "PrimalImpalerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1872, "PrimalSwarmHostACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1873, "CreeperHostACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1874, "PrimalUltraliskACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1875, "TyrannozorACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1876, "PrimalWurmACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1877, "HHReaperACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1878, "HHWidowMineACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1879, "HHHellionTankACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1880, "HHWraithACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1881, "HHVikingACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1882, "HHBattlecruiserACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1883, "HHRavenACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1884, "HHBomberPlatformACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1885, "HHMercStarportACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1886, "HHMissileTurretACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1887, "HighTemplarSkinPreview", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1888, "WarpPrismSkinPreview", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1889, "SiegeTankSkinPreview", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1890, "LiberatorSkinPreview", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1891, "", false, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1892, "StukovInfestedTrooperACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 0, 78, 0, 33, 0 },
+    { 1893, "XelNagaDestructibleBlocker6S", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 889, 2, 78, 0, 33, 0 },
+    { 1894, "XelNagaDestructibleBlocker6SE", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 891, 2, 78, 0, 33, 0 },
+    { 1895, "XelNagaDestructibleBlocker6E", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 893, 2, 78, 0, 33, 0 },
+    { 1896, "XelNagaDestructibleBlocker6NE", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 895, 2, 78, 0, 33, 0 },
+    { 1897, "XelNagaDestructibleBlocker6N", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 897, 2, 78, 0, 33, 0 },
+    { 1898, "XelNagaDestructibleBlocker6NW", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 899, 2, 78, 0, 33, 0 },
+    { 1899, "XelNagaDestructibleBlocker6W", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 901, 2, 78, 0, 33, 0 },
+    { 1900, "XelNagaDestructibleBlocker6SW", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 903, 2, 78, 0, 33, 0 },
+    { 1901, "XelNagaDestructibleBlocker8S", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 905, 2, 78, 0, 33, 0 },
+    { 1902, "XelNagaDestructibleBlocker8SE", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 907, 2, 78, 0, 33, 0 },
+    { 1903, "XelNagaDestructibleBlocker8E", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 909, 2, 78, 0, 33, 0 },
+    { 1904, "XelNagaDestructibleBlocker8NE", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 911, 2, 78, 0, 33, 0 },
+    { 1905, "XelNagaDestructibleBlocker8N", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 913, 2, 78, 0, 33, 0 },
+    { 1906, "XelNagaDestructibleBlocker8NW", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 915, 2, 78, 0, 33, 0 },
+    { 1907, "XelNagaDestructibleBlocker8W", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 917, 2, 78, 0, 33, 0 },
+    { 1908, "XelNagaDestructibleBlocker8SW", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 919, 2, 78, 0, 33, 0 },
+    { 1909, "SnowGlazeStarterMP", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 921, 0, 78, 0, 33, 0 },
+    { 1910, "ShieldBattery", true, 0, 100, 0, 0.0f, 1.0f, 0.0f, 0.0f, 895, 2, 640.0f, false, false, 9.0f, 0, 72, false, 921, 2, 78, 0, 33, 0 },
+    { 1911, "ObserverSiegeMode", true, 0, 25, 75, 0.0f, 0.0f, 1.0f, 0.0f, 3741, 2, 12.0f, false, false, 13.75f, 82, 0, false, 923, 2, 78, 0, 33, 0 },
+    { 1912, "OverseerSiegeMode", true, 0, 150, 50, 0.0f, 1.0f, 0.0f, 8.0f, 3743, 1, 12.0f, false, false, 13.75f, 129, 0, false, 925, 2, 78, 0, 33, 1 },
+    { 1913, "RavenRepairDrone", true, 0, 100, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 7.0f, 0, 0, false, 927, 4, 78, 0, 34, 0 },
+    { 1914, "HighTemplarWeaponMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1915, "CycloneMissileLargeAirAlternative", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1916, "RavenScramblerMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1917, "RavenRepairDroneReleaseWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1918, "RavenShredderMissileWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1919, "InfestedAcidSpinesWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1920, "InfestorEnsnareAttackMissile", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1921, "SNARE_PLACEHOLDER", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1922, "TychusReaperACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1923, "TychusFirebatACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1924, "TychusSpectreACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1925, "TychusMedicACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1926, "TychusMarauderACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1927, "TychusWarhoundACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1928, "TychusHERCACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1929, "TychusGhostACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1930, "TychusSCVAutoTurretACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1931, "ZeratulStalkerACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1932, "ZeratulSentryACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1933, "ZeratulDarkTemplarACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1934, "ZeratulImmortalACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1935, "ZeratulObserverACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1936, "ZeratulDisruptorACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1937, "ZeratulWarpPrismACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1938, "ZeratulPhotonCannonACGluescreenDummy", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1939, "RenegadeLongboltMissileWeapon", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1940, "Viking", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 931, 0, 78, 0, 34, 0 },
+    { 1941, "RenegadeMissileTurret", true, 0, 100, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 11.0f, 0, 0, false, 931, 3, 78, 1, 34, 0 },
+    { 1942, "ParasiticBombRelayDummy", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 934, 0, 79, 0, 34, 0 },
+    { 1943, "PreviewBunkerUpgraded", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, false, 0.0f, 0, 0, false, 934, 0, 79, 0, 34, 0 },
+    { 1944, "AssimilatorRich", true, 0, 75, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 2, 0.0f, false, true, 9.0f, 61, 0, false, 934, 2, 79, 0, 34, 1 },
+    { 1945, "ExtractorRich", true, 0, 75, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 1, 0.0f, false, true, 9.0f, 88, 0, false, 936, 3, 79, 0, 35, 1 },
+    { 1946, "InhibitorZoneSmall", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 22.0f, 0, 0, false, 939, 1, 79, 0, 36, 0 },
+    { 1947, "InhibitorZoneMedium", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 22.0f, 0, 0, false, 940, 1, 79, 0, 36, 0 },
+    { 1948, "InhibitorZoneLarge", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 22.0f, 0, 0, false, 941, 1, 79, 0, 36, 0 },
+    { 1949, "RefineryRich", true, 0, 75, 0, 0.0f, 1.0f, 0.0f, 0.0f, 0, 0, 0.0f, false, true, 9.0f, 20, 0, false, 942, 3, 79, 0, 36, 1 },
+    { 1950, "MineralField450", true, 0, 0, 0, 0.0f, 10.0f, 0.0f, 0.0f, 0, 3, 0.0f, true, false, 0.0f, 0, 0, false, 945, 1, 79, 0, 37, 0 },
+    { 1951, "CollapsibleRockTowerDebrisRampLeftGreen", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 3793, 3, 0.0f, false, false, 0.0f, 0, 0, false, 946, 2, 79, 0, 37, 0 },
+    { 1952, "CollapsibleRockTowerDebrisRampRightGreen", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 3795, 3, 0.0f, false, false, 0.0f, 0, 0, false, 948, 2, 79, 0, 37, 0 },
+    { 1953, "CollapsibleRockTowerPushUnitRampLeftGreen", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 950, 2, 79, 0, 37, 0 },
+    { 1954, "CollapsibleRockTowerPushUnitRampRightGreen", true, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 952, 2, 79, 0, 37, 0 },
+    { 1955, "CollapsibleRockTowerRampLeftGreen", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 954, 2, 79, 0, 37, 0 },
+    { 1956, "CollapsibleRockTowerRampRightGreen", true, 0, 0, 0, 0.0f, 3.0f, 0.0f, 0.0f, 0, 3, 0.0f, false, false, 0.0f, 0, 0, false, 956, 2, 79, 0, 37, 0 },
+};
+
+const size_t LIBVOXELBOT_TABLE_UNITS_SIZE = 1957;
+
+const int LIBVOXELBOT_TABLE_UNIT_ATTRIBUTES[] = {
+    3,
+    2,
+    4,
+    7,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    1,
+    3,
+    3,
+    3,
+    2,
+    4,
+    6,
+    7,
+    1,
+    4,
+    8,
+    1,
+    3,
+    1,
+    3,
+    1,
+    3,
+    1,
+    3,
+    1,
+    3,
+    1,
+    3,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    2,
+    4,
+    2,
+    4,
+    2,
+    4,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    1,
+    3,
+    4,
+    2,
+    4,
+    8,
+    2,
+    4,
+    8,
+    1,
+    3,
+    1,
+    3,
+    3,
+    6,
+    2,
+    3,
+    2,
+    4,
+    7,
+    1,
+    4,
+    2,
+    4,
+    1,
+    4,
+    1,
+    4,
+    2,
+    4,
+    7,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    1,
+    3,
+    2,
+    4,
+    1,
+    3,
+    6,
+    1,
+    3,
+    6,
+    1,
+    4,
+    6,
+    1,
+    4,
+    2,
+    4,
+    7,
+    2,
+    4,
+    2,
+    4,
+    6,
+    1,
+    4,
+    2,
+    4,
+    1,
+    4,
+    1,
+    4,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    3,
+    1,
+    3,
+    1,
+    3,
+    2,
+    3,
+    1,
+    3,
+    1,
+    3,
+    2,
+    3,
+    7,
+    2,
+    3,
+    2,
+    3,
+    6,
+    2,
+    3,
+    3,
+    7,
+    2,
+    3,
+    7,
+    3,
+    1,
+    3,
+    1,
+    3,
+    2,
+    3,
+    1,
+    3,
+    1,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    6,
+    3,
+    6,
+    2,
+    3,
+    6,
+    3,
+    2,
+    3,
+    2,
+    4,
+    8,
+    2,
+    3,
+    7,
+    2,
+    4,
+    8,
+    2,
+    8,
+    2,
+    4,
+    8,
+    2,
+    4,
+    6,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    6,
+    7,
+    2,
+    3,
+    8,
+    1,
+    3,
+    3,
+    6,
+    3,
+    6,
+    8,
+    8,
+    3,
+    8,
+    3,
+    1,
+    3,
+    3,
+    1,
+    4,
+    1,
+    3,
+    1,
+    3,
+    2,
+    8,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    3,
+    4,
+    4,
+    4,
+    4,
+    4,
+    3,
+    3,
+    3,
+    3,
+    8,
+    8,
+    8,
+    8,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    2,
+    8,
+    2,
+    8,
+    2,
+    2,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    1,
+    5,
+    5,
+    1,
+    3,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    1,
+    3,
+    8,
+    1,
+    3,
+    4,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    4,
+    6,
+    1,
+    3,
+    2,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    8,
+    2,
+    3,
+    2,
+    3,
+    2,
+    4,
+    6,
+    2,
+    4,
+    7,
+    2,
+    4,
+    1,
+    4,
+    2,
+    3,
+    6,
+    1,
+    4,
+    3,
+    2,
+    3,
+    2,
+    3,
+    2,
+    3,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    2,
+    8,
+    2,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    3,
+    4,
+    7,
+    8,
+    10,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    8,
+    2,
+    8,
+    2,
+    8,
+    3,
+    4,
+    2,
+    8,
+    2,
+    3,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    1,
+    3,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    2,
+    2,
+    8,
+    3,
+    3,
+    4,
+    9,
+    3,
+    2,
+    8,
+    2,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    3,
+    3,
+    2,
+    4,
+    3,
+    2,
+    4,
+    7,
+    2,
+    4,
+    1,
+    3,
+    2,
+    4,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    2,
+    4,
+    3,
+    7,
+    2,
+    3,
+    7,
+    3,
+    7,
+    2,
+    3,
+    7,
+    3,
+    6,
+    3,
+    6,
+    1,
+    8,
+    2,
+    4,
+    2,
+    4,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    2,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    2,
+    8,
+    1,
+    3,
+    2,
+    3,
+    8,
+    3,
+    3,
+    2,
+    8,
+    2,
+    8,
+    2,
+    3,
+    1,
+    3,
+    1,
+    3,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    8,
+    1,
+    4,
+    2,
+    4,
+    2,
+    4,
+    1,
+    3,
+    3,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    3,
+    3,
+    2,
+    3,
+    7,
+    10,
+    8,
+    8,
+    2,
+    8,
+    8,
+    8,
+    8,
+    8,
+    3,
+    2,
+    4,
+    8,
+    3,
+    2,
+    3,
+    2,
+    8,
+    1,
+    4,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    1,
+    4,
+    2,
+    3,
+    1,
+    4,
+    8,
+    11,
+    2,
+    4,
+    8,
+    2,
+    8,
+    2,
+    3,
+    8,
+    8,
+    8,
+    8,
+    2,
+    4,
+    8,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+    2,
+    8,
+};
+
+const WeaponRecord LIBVOXELBOT_TABLE_UNIT_WEAPONS[] = {
+    { 1, 10.0f, 0, 1, 2, 7.0f, 1.5f },
+    { 2, 14.0f, 1, 0, 1, 6.0f, 1.33008003f },
+    { 1, 6.0f, 1, 0, 1, 5.0f, 0.860840023f },
+    { 3, 6.0f, 1, 0, 6, 7.0f, 2.20995998f },
+    { 1, 8.0f, 1, 0, 2, 0.100097999f, 1.19994998f },
+    { 3, 6.0f, 1, 0, 1, 5.0f, 0.860840023f },
+    { 3, 6.0f, 1, 0, 1, 5.0f, 0.860840023f },
+    { 1, 5.0f, 1, 0, 1, 0.100097999f, 0.696044981f },
+    { 1, 5.0f, 1, 0, 1, 0.100097999f, 0.696044981f },
+    { 2, 12.0f, 1, 0, 2, 7.0f, 0.860840023f },
+    { 3, 18.0f, 1, 0, 1, 6.0f, 0.800049007f },
+    { 1, 40.0f, 1, 1, 1, 13.0f, 3.0f },
+    { 1, 15.0f, 2, 1, 1, 7.0f, 1.04004002f },
+    { 1, 12.0f, 3, 1, 1, 6.0f, 1.0f },
+    { 2, 10.0f, 4, 1, 2, 9.0f, 2.0f },
+    { 1, 5.0f, 5, 0, 1, 0.100097999f, 1.5f },
+    { 3, 6.0f, 5, 0, 1, 5.0f, 0.860840023f },
+    { 1, 4.0f, 5, 0, 2, 5.0f, 1.10010004f },
+    { 3, 10.0f, 5, 1, 1, 6.0f, 1.5f },
+    { 1, 10.0f, 6, 1, 1, 6.0f, 1.5f },
+    { 2, 6.0f, 7, 1, 4, 10.0f, 3.0f },
+    { 1, 30.0f, 8, 0, 2, 7.0f, 1.28003001f },
+    { 1, 8.0f, 8, 1, 1, 5.0f, 2.5f },
+    { 1, 12.0f, 9, 0, 2, 6.0f, 1.25f },
+    { 3, 20.0f, 9, 0, 1, 7.0f, 1.25f },
+    { 1, 8.0f, 9, 0, 2, 0.100097999f, 1.19994998f },
+    { 3, 13.0f, 9, 1, 1, 6.0f, 1.87012005f },
+    { 1, 4.0f, 10, 0, 1, 6.0f, 1.75390995f },
+    { 1, 45.0f, 10, 0, 1, 0.100097999f, 1.69409001f },
+    { 3, 6.0f, 10, 0, 1, 5.0f, 1.0f },
+    { 2, 5.0f, 10, 1, 2, 5.0f, 1.10010004f },
+    { 3, 6.0f, 11, 1, 1, 6.0f, 0.5f },
+    { 1, 20.0f, 12, 1, 1, 6.0f, 1.44994998f },
+    { 1, 5.0f, 13, 0, 1, 0.100097999f, 1.5f },
+    { 3, 5.0f, 13, 0, 2, 2.0f, 3.0f },
+    { 1, 25.0f, 13, 1, 1, 7.0f, 1.85010004f },
+    { 2, 15.0f, 14, 1, 1, 7.0f, 0.860840023f },
+    { 1, 5.0f, 15, 0, 1, 0.100097999f, 1.5f },
+    { 1, 5.0f, 15, 0, 1, 0.100097999f, 0.696044981f },
+    { 3, 12.0f, 15, 0, 1, 5.0f, 0.824950993f },
+    { 3, 9.0f, 15, 0, 1, 3.0f, 1.52465999f },
+    { 1, 35.0f, 15, 0, 1, 1.0f, 0.860107005f },
+    { 1, 16.0f, 15, 0, 1, 4.0f, 2.0f },
+    { 2, 14.0f, 15, 1, 1, 6.0f, 1.89989996f },
+    { 1, 20.0f, 16, 0, 1, 10.0f, 2.5f },
+    { 2, 9.0f, 16, 0, 1, 8.0f, 1.0f },
+    { 1, 4.0f, 16, 0, 2, 5.0f, 1.0f },
+    { 1, 40.0f, 16, 0, 1, 6.0f, 2.0f },
+    { 3, 25.0f, 16, 1, 1, 3.0f, 1.75390995f },
+    { 3, 10.0f, 17, 1, 1, 6.0f, 1.5f },
+    { 3, 10.0f, 18, 1, 1, 6.0f, 1.5f },
+    { 1, 4.0f, 19, 0, 1, 0.100097999f, 0.645507991f },
+    { 1, 10.0f, 19, 1, 1, 4.0f, 2.25f },
+    { 3, 6.0f, 20, 0, 1, 5.0f, 0.860840023f },
+    { 1, 18.0f, 20, 0, 1, 2.0f, 2.0f },
+    { 1, 8.0f, 20, 0, 1, 5.0f, 0.850098014f },
+    { 1, 10.0f, 20, 0, 1, 3.0f, 0.600098014f },
+    { 3, 10.0f, 20, 0, 1, 7.0f, 2.0f },
+    { 2, 30.0f, 20, 1, 1, 15.0f, 3.30005002f },
+    { 1, 40.0f, 21, 0, 1, 10.0f, 3.30005002f },
+    { 1, 23.0f, 21, 0, 1, 7.0f, 1.30005002f },
+    { 1, 20.0f, 21, 1, 1, 9.0f, 2.0f },
+    { 1, 16.0f, 22, 0, 1, 6.0f, 1.60010004f },
+    { 2, 5.0f, 22, 0, 2, 5.0f, 1.80005002f },
+    { 2, 40.0f, 22, 1, 1, 11.0f, 2.39989996f },
+    { 1, 30.0f, 23, 0, 2, 7.0f, 1.28003001f },
+    { 3, 18.0f, 23, 0, 1, 5.0f, 1.0f },
+    { 1, 20.0f, 23, 0, 1, 9.0f, 1.30005002f },
+    { 2, 25.0f, 23, 0, 1, 5.0f, 3.0f },
+    { 1, 75.0f, 23, 0, 1, 10.0f, 1.60010004f },
+    { 1, 20.0f, 23, 0, 1, 6.0f, 1.5f },
+    { 1, 20.0f, 23, 0, 1, 6.0f, 1.5f },
+    { 3, 1.0f, 23, 0, 1, 0.100097999f, 1.0f },
+    { 2, 5.0f, 23, 0, 1, 5.0f, 0.47241199f },
+    { 1, 8.0f, 23, 0, 1, 4.0f, 1.69409001f },
+    { 2, 7.0f, 23, 1, 2, 4.0f, 1.25f },
+    { 3, 10.0f, 24, 0, 1, 5.0f, 1.5f },
+    { 2, 110.0f, 24, 0, 1, 0.0f, 0.833252013f },
+    { 2, 12.0f, 24, 0, 2, 7.0f, 0.860840023f },
+};
+
+const DamageBonusRecord LIBVOXELBOT_TABLE_UNIT_DAMAGE_BONUSES[] = {
+    { 1, 5.0f },
+    { 2, 30.0f },
+    { 2, 10.0f },
+    { 4, 8.0f },
+    { 2, 4.0f },
+    { 1, 10.0f },
+    { 2, 10.0f },
+    { 1, 6.0f },
+    { 1, 6.0f },
+    { 2, 5.0f },
+    { 1, 5.0f },
+    { 2, 4.0f },
+    { 2, 30.0f },
+    { 2, 5.0f },
+    { 3, 15.0f },
+    { 7, 6.0f },
+    { 3, 10.0f },
+    { 1, 10.0f },
+    { 1, 10.0f },
+    { 1, 12.0f },
+    { 7, 22.0f },
+    { 2, 10.0f },
+    { 7, 15.0f },
+    { 2, 7.0f },
+};
+
+const int LIBVOXELBOT_TABLE_UNIT_TECH_ALIASES[] = {
+    33,
+    1940,
+    1940,
+    18,
+    5,
+    6,
+    5,
+    6,
+    5,
+    6,
+    27,
+    28,
+    21,
+    19,
+    86,
+    86,
+    100,
+    92,
+    126,
+    106,
+    18,
+    18,
+    62,
+    18,
+    81,
+    87,
+    87,
+    498,
+    52,
+    689,
+    106,
+    60,
+    60,
+    106,
+    61,
+    88,
+    20,
+};
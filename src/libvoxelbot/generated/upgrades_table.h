@@ -0,0 +1,304 @@
+// Generated by save_upgrade_table in libvoxelbot/utilities/unit_data_caching.cpp, do not edit.
+#pragma once
+#include "../utilities/unit_data_tables.h"
+
+const UpgradeRecord LIBVOXELBOT_TABLE_UPGRADES[] = {
+    { 0, "", 0, 0, 0, 0.0f },
+    { 1, "CarrierLaunchSpeedUpgrade", 150, 150, 45, 1280.0f },
+    { 2, "GlialReconstitution", 100, 100, 216, 1760.0f },
+    { 3, "TunnelingClaws", 100, 100, 217, 1760.0f },
+    { 4, "ChitinousPlating", 150, 150, 265, 1760.0f },
+    { 5, "HiSecAutoTracking", 100, 100, 650, 1280.0f },
+    { 6, "TerranBuildingArmor", 150, 150, 651, 2240.0f },
+    { 7, "TerranInfantryWeaponsLevel1", 100, 100, 652, 2560.0f },
+    { 8, "TerranInfantryWeaponsLevel2", 175, 175, 653, 3040.0f },
+    { 9, "TerranInfantryWeaponsLevel3", 250, 250, 654, 3520.0f },
+    { 10, "NeosteelFrame", 100, 100, 655, 1760.0f },
+    { 11, "TerranInfantryArmorsLevel1", 100, 100, 656, 2560.0f },
+    { 12, "TerranInfantryArmorsLevel2", 175, 175, 657, 3040.0f },
+    { 13, "TerranInfantryArmorsLevel3", 250, 250, 658, 3520.0f },
+    { 14, "ReaperSpeed", 50, 50, 683, 1600.0f },
+    { 15, "Stimpack", 100, 100, 730, 2720.0f },
+    { 16, "ShieldWall", 100, 100, 731, 1760.0f },
+    { 17, "PunisherGrenades", 50, 50, 732, 960.0f },
+    { 18, "SiegeTech", 0, 0, 0, 0.0f },
+    { 19, "HighCapacityBarrels", 150, 150, 761, 1760.0f },
+    { 20, "BansheeCloak", 100, 100, 790, 1760.0f },
+    { 21, "MedivacCaduceusReactor", 100, 100, 792, 1280.0f },
+    { 22, "RavenCorvidReactor", 150, 150, 793, 1760.0f },
+    { 23, "HunterSeeker", 150, 150, 796, 1760.0f },
+    { 24, "DurableMaterials", 150, 150, 797, 1760.0f },
+    { 25, "PersonalCloaking", 150, 150, 820, 1920.0f },
+    { 26, "GhostMoebiusReactor", 100, 100, 821, 1280.0f },
+    { 27, "TerranVehicleArmorsLevel1", 100, 100, 852, 2560.0f },
+    { 28, "TerranVehicleArmorsLevel2", 175, 175, 853, 3040.0f },
+    { 29, "TerranVehicleArmorsLevel3", 250, 250, 854, 3520.0f },
+    { 30, "TerranVehicleWeaponsLevel1", 100, 100, 855, 2560.0f },
+    { 31, "TerranVehicleWeaponsLevel2", 175, 175, 856, 3040.0f },
+    { 32, "TerranVehicleWeaponsLevel3", 250, 250, 857, 3520.0f },
+    { 33, "TerranShipArmorsLevel1", 100, 100, 858, 2560.0f },
+    { 34, "TerranShipArmorsLevel2", 175, 175, 859, 3040.0f },
+    { 35, "TerranShipArmorsLevel3", 250, 250, 860, 3520.0f },
+    { 36, "TerranShipWeaponsLevel1", 100, 100, 861, 2560.0f },
+    { 37, "TerranShipWeaponsLevel2", 175, 175, 862, 3040.0f },
+    { 38, "TerranShipWeaponsLevel3", 250, 250, 863, 3520.0f },
+    { 39, "ProtossGroundWeaponsLevel1", 100, 100, 1062, 2560.0f },
+    { 40, "ProtossGroundWeaponsLevel2", 150, 150, 1063, 3040.0f },
+    { 41, "ProtossGroundWeaponsLevel3", 200, 200, 1064, 3520.0f },
+    { 42, "ProtossGroundArmorsLevel1", 100, 100, 1065, 2560.0f },
+    { 43, "ProtossGroundArmorsLevel2", 150, 150, 1066, 3040.0f },
+    { 44, "ProtossGroundArmorsLevel3", 200, 200, 1067, 3520.0f },
+    { 45, "ProtossShieldsLevel1", 150, 150, 1068, 2560.0f },
+    { 46, "ProtossShieldsLevel2", 225, 225, 1069, 3040.0f },
+    { 47, "ProtossShieldsLevel3", 300, 300, 1070, 3520.0f },
+    { 48, "ObserverGraviticBooster", 100, 100, 1093, 1280.0f },
+    { 49, "GraviticDrive", 100, 100, 1094, 1280.0f },
+    { 50, "ExtendedThermalLance", 150, 150, 1097, 2240.0f },
+    { 51, "HighTemplarKhaydarinAmulet", 0, 0, 0, 0.0f },
+    { 52, "PsiStormTech", 200, 200, 1126, 1760.0f },
+    { 53, "ZergMeleeWeaponsLevel1", 100, 100, 1186, 2560.0f },
+    { 54, "ZergMeleeWeaponsLevel2", 150, 150, 1187, 3040.0f },
+    { 55, "ZergMeleeWeaponsLevel3", 200, 200, 1188, 3520.0f },
+    { 56, "ZergGroundArmorsLevel1", 150, 150, 1189, 2560.0f },
+    { 57, "ZergGroundArmorsLevel2", 225, 225, 1190, 3040.0f },
+    { 58, "ZergGroundArmorsLevel3", 300, 300, 1191, 3520.0f },
+    { 59, "ZergMissileWeaponsLevel1", 100, 100, 1192, 2560.0f },
+    { 60, "ZergMissileWeaponsLevel2", 150, 150, 1193, 3040.0f },
+    { 61, "ZergMissileWeaponsLevel3", 200, 200, 1194, 3520.0f },
+    { 62, "overlordspeed", 100, 100, 1223, 960.0f },
+    { 63, "overlordtransport", 200, 200, 1224, 2080.0f },
+    { 64, "Burrow", 100, 100, 1225, 1600.0f },
+    { 65, "zerglingattackspeed", 200, 200, 1252, 2080.0f },
+    { 66, "zerglingmovementspeed", 100, 100, 1253, 1760.0f },
+    { 67, "hydraliskspeed", 0, 0, 0, 0.0f },
+    { 68, "ZergFlyerWeaponsLevel1", 100, 100, 1312, 2560.0f },
+    { 69, "ZergFlyerWeaponsLevel2", 175, 175, 1313, 3040.0f },
+    { 70, "ZergFlyerWeaponsLevel3", 250, 250, 1314, 3520.0f },
+    { 71, "ZergFlyerArmorsLevel1", 150, 150, 1315, 2560.0f },
+    { 72, "ZergFlyerArmorsLevel2", 225, 225, 1316, 3040.0f },
+    { 73, "ZergFlyerArmorsLevel3", 300, 300, 1317, 3520.0f },
+    { 74, "InfestorEnergyUpgrade", 150, 150, 1454, 1280.0f },
+    { 75, "CentrificalHooks", 150, 150, 1482, 1760.0f },
+    { 76, "BattlecruiserEnableSpecializations", 150, 150, 1532, 2240.0f },
+    { 77, "BattlecruiserBehemothReactor", 0, 0, 0, 0.0f },
+    { 78, "ProtossAirWeaponsLevel1", 100, 100, 1562, 2560.0f },
+    { 79, "ProtossAirWeaponsLevel2", 175, 175, 1563, 3040.0f },
+    { 80, "ProtossAirWeaponsLevel3", 250, 250, 1564, 3520.0f },
+    { 81, "ProtossAirArmorsLevel1", 150, 150, 1565, 2560.0f },
+    { 82, "ProtossAirArmorsLevel2", 225, 225, 1566, 3040.0f },
+    { 83, "ProtossAirArmorsLevel3", 300, 300, 1567, 3520.0f },
+    { 84, "WarpGateResearch", 50, 50, 1568, 2240.0f },
+    { 85, "haltech", 100, 100, 1571, 1280.0f },
+    { 86, "Charge", 100, 100, 1592, 2240.0f },
+    { 87, "BlinkTech", 100, 100, 1593, 2720.0f },
+    { 88, "AnabolicSynthesis", 150, 150, 263, 960.0f },
+    { 89, "ObverseIncubation", 0, 0, 0, 0.0f },
+    { 90, "VikingJotunBoosters", 0, 0, 0, 0.0f },
+    { 91, "OrganicCarapace", 0, 0, 0, 0.0f },
+    { 92, "InfestorPeristalsis", 0, 0, 0, 0.0f },
+    { 93, "AbdominalFortitude", 0, 0, 0, 0.0f },
+    { 94, "HydraliskSpeedUpgrade", 0, 0, 0, 0.0f },
+    { 95, "BanelingBurrowMove", 0, 0, 0, 0.0f },
+    { 96, "CombatDrugs", 0, 0, 0, 0.0f },
+    { 97, "StrikeCannons", 0, 0, 0, 0.0f },
+    { 98, "TransformationServos", 150, 150, 763, 1760.0f },
+    { 99, "PhoenixRangeUpgrade", 150, 150, 46, 1440.0f },
+    { 100, "TempestRangeUpgrade", 200, 200, 47, 1760.0f },
+    { 101, "NeuralParasite", 150, 150, 1455, 1760.0f },
+    { 102, "LocustLifetimeIncrease", 200, 200, 1456, 1920.0f },
+    { 103, "UltraliskBurrowChargeUpgrade", 0, 0, 0, 0.0f },
+    { 104, "OracleEnergyUpgrade", 0, 0, 0, 0.0f },
+    { 105, "RestoreShields", 0, 0, 0, 0.0f },
+    { 106, "", 0, 0, 0, 0.0f },
+    { 107, "", 0, 0, 0, 0.0f },
+    { 108, "", 0, 0, 0, 0.0f },
+    { 109, "ReaperJump", 0, 0, 0, 0.0f },
+    { 110, "IncreasedRange", 0, 0, 0, 0.0f },
+    { 111, "ZergBurrowMove", 0, 0, 0, 0.0f },
+    { 112, "AnionPulseCrystals", 0, 0, 0, 0.0f },
+    { 113, "TerranVehicleAndShipWeaponsLevel1", 100, 100, 2294, 2560.0f },
+    { 114, "TerranVehicleAndShipWeaponsLevel2", 175, 175, 2295, 3040.0f },
+    { 115, "TerranVehicleAndShipWeaponsLevel3", 250, 250, 2296, 3520.0f },
+    { 116, "TerranVehicleAndShipArmorsLevel1", 100, 100, 2297, 2560.0f },
+    { 117, "TerranVehicleAndShipArmorsLevel2", 175, 175, 2298, 3040.0f },
+    { 118, "TerranVehicleAndShipArmorsLevel3", 250, 250, 2299, 3520.0f },
+    { 119, "FlyingLocusts", 0, 0, 0, 0.0f },
+    { 120, "RoachSupply", 200, 200, 218, 2080.0f },
+    { 121, "ImmortalRevive", 100, 100, 1099, 1280.0f },
+    { 122, "DrillClaws", 75, 75, 764, 1760.0f },
+    { 123, "CycloneLockOnRangeUpgrade", 150, 150, 765, 1760.0f },
+    { 124, "CycloneAirUpgrade", 0, 0, 0, 0.0f },
+    { 125, "LiberatorMorph", 150, 150, 800, 1760.0f },
+    { 126, "AdeptShieldUpgrade", 0, 0, 0, 0.0f },
+    { 127, "LurkerRange", 200, 200, 1286, 1760.0f },
+    { 128, "ImmortalBarrier", 0, 0, 0, 0.0f },
+    { 129, "AdeptKillBounce", 0, 0, 0, 0.0f },
+    { 130, "AdeptPiercingAttack", 100, 100, 1594, 2240.0f },
+    { 131, "CinematicMode", 0, 0, 0, 0.0f },
+    { 132, "CursorDebug", 0, 0, 0, 0.0f },
+    { 133, "MagFieldLaunchers", 0, 0, 0, 0.0f },
+    { 134, "EvolveGroovedSpines", 100, 100, 1282, 1600.0f },
+    { 135, "EvolveMuscularAugments", 100, 100, 1283, 1600.0f },
+    { 136, "BansheeSpeed", 150, 150, 799, 2720.0f },
+    { 137, "MedivacRapidDeployment", 150, 150, 802, 1920.0f },
+    { 138, "RavenRecalibratedExplosives", 150, 150, 803, 1760.0f },
+    { 139, "MedivacIncreaseSpeedBoost", 100, 100, 804, 1280.0f },
+    { 140, "LiberatorAGRangeUpgrade", 150, 150, 805, 1760.0f },
+    { 141, "DarkTemplarBlinkUpgrade", 100, 100, 2720, 2240.0f },
+    { 142, "RavagerRange", 0, 0, 0, 0.0f },
+    { 143, "RavenDamageUpgrade", 0, 0, 0, 0.0f },
+    { 144, "CycloneLockOnDamageUpgrade", 100, 100, 769, 2240.0f },
+    { 145, "", 0, 0, 0, 0.0f },
+    { 146, "", 0, 0, 0, 0.0f },
+    { 147, "", 0, 0, 0, 0.0f },
+    { 148, "", 0, 0, 0, 0.0f },
+    { 149, "", 0, 0, 0, 0.0f },
+    { 150, "", 0, 0, 0, 0.0f },
+    { 151, "", 0, 0, 0, 0.0f },
+    { 152, "", 0, 0, 0, 0.0f },
+    { 153, "", 0, 0, 0, 0.0f },
+    { 154, "", 0, 0, 0, 0.0f },
+    { 155, "", 0, 0, 0, 0.0f },
+    { 156, "", 0, 0, 0, 0.0f },
+    { 157, "", 0, 0, 0, 0.0f },
+    { 158, "", 0, 0, 0, 0.0f },
+    { 159, "", 0, 0, 0, 0.0f },
+    { 160, "", 0, 0, 0, 0.0f },
+    { 161, "", 0, 0, 0, 0.0f },
+    { 162, "", 0, 0, 0, 0.0f },
+    { 163, "", 0, 0, 0, 0.0f },
+    { 164, "", 0, 0, 0, 0.0f },
+    { 165, "", 0, 0, 0, 0.0f },
+    { 166, "", 0, 0, 0, 0.0f },
+    { 167, "", 0, 0, 0, 0.0f },
+    { 168, "", 0, 0, 0, 0.0f },
+    { 169, "", 0, 0, 0, 0.0f },
+    { 170, "", 0, 0, 0, 0.0f },
+    { 171, "", 0, 0, 0, 0.0f },
+    { 172, "", 0, 0, 0, 0.0f },
+    { 173, "", 0, 0, 0, 0.0f },
+    { 174, "", 0, 0, 0, 0.0f },
+    { 175, "", 0, 0, 0, 0.0f },
+    { 176, "", 0, 0, 0, 0.0f },
+    { 177, "", 0, 0, 0, 0.0f },
+    { 178, "", 0, 0, 0, 0.0f },
+    { 179, "", 0, 0, 0, 0.0f },
+    { 180, "", 0, 0, 0, 0.0f },
+    { 181, "", 0, 0, 0, 0.0f },
+    { 182, "", 0, 0, 0, 0.0f },
+    { 183, "", 0, 0, 0, 0.0f },
+    { 184, "", 0, 0, 0, 0.0f },
+    { 185, "", 0, 0, 0, 0.0f },
+    { 186, "", 0, 0, 0, 0.0f },
+    { 187, "", 0, 0, 0, 0.0f },
+    { 188, "", 0, 0, 0, 0.0f },
+    { 189, "", 0, 0, 0, 0.0f },
+    { 190, "", 0, 0, 0, 0.0f },
+    { 191, "", 0, 0, 0, 0.0f },
+    { 192, "", 0, 0, 0, 0.0f },
+    { 193, "", 0, 0, 0, 0.0f },
+    { 194, "", 0, 0, 0, 0.0f },
+    { 195, "", 0, 0, 0, 0.0f },
+    { 196, "", 0, 0, 0, 0.0f },
+    { 197, "", 0, 0, 0, 0.0f },
+    { 198, "", 0, 0, 0, 0.0f },
+    { 199, "", 0, 0, 0, 0.0f },
+    { 200, "", 0, 0, 0, 0.0f },
+    { 201, "", 0, 0, 0, 0.0f },
+    { 202, "", 0, 0, 0, 0.0f },
+    { 203, "", 0, 0, 0, 0.0f },
+    { 204, "", 0, 0, 0, 0.0f },
+    { 205, "", 0, 0, 0, 0.0f },
+    { 206, "", 0, 0, 0, 0.0f },
+    { 207, "", 0, 0, 0, 0.0f },
+    { 208, "", 0, 0, 0, 0.0f },
+    { 209, "", 0, 0, 0, 0.0f },
+    { 210, "", 0, 0, 0, 0.0f },
+    { 211, "", 0, 0, 0, 0.0f },
+    { 212, "", 0, 0, 0, 0.0f },
+    { 213, "", 0, 0, 0, 0.0f },
+    { 214, "", 0, 0, 0, 0.0f },
+    { 215, "", 0, 0, 0, 0.0f },
+    { 216, "", 0, 0, 0, 0.0f },
+    { 217, "", 0, 0, 0, 0.0f },
+    { 218, "", 0, 0, 0, 0.0f },
+    { 219, "", 0, 0, 0, 0.0f },
+    { 220, "", 0, 0, 0, 0.0f },
+    { 221, "", 0, 0, 0, 0.0f },
+    { 222, "", 0, 0, 0, 0.0f },
+    { 223, "", 0, 0, 0, 0.0f },
+    { 224, "", 0, 0, 0, 0.0f },
+    { 225, "", 0, 0, 0, 0.0f },
+    { 226, "", 0, 0, 0, 0.0f },
+    { 227, "", 0, 0, 0, 0.0f },
+    { 228, "", 0, 0, 0, 0.0f },
+    { 229, "", 0, 0, 0, 0.0f },
+    { 230, "", 0, 0, 0, 0.0f },
+    { 231, "", 0, 0, 0, 0.0f },
+    { 232, "", 0, 0, 0, 0.0f },
+    { 233, "", 0, 0, 0, 0.0f },
+    { 234, "", 0, 0, 0, 0.0f },
+    { 235, "", 0, 0, 0, 0.0f },
+    { 236, "", 0, 0, 0, 0.0f },
+    { 237, "", 0, 0, 0, 0.0f },
+    { 238, "", 0, 0, 0, 0.0f },
+    { 239, "", 0, 0, 0, 0.0f },
+    { 240, "", 0, 0, 0, 0.0f },
+    { 241, "", 0, 0, 0, 0.0f },
+    { 242, "", 0, 0, 0, 0.0f },
+    { 243, "", 0, 0, 0, 0.0f },
+    { 244, "", 0, 0, 0, 0.0f },
+    { 245, "", 0, 0, 0, 0.0f },
+    { 246, "", 0, 0, 0, 0.0f },
+    { 247, "", 0, 0, 0, 0.0f },
+    { 248, "", 0, 0, 0, 0.0f },
+    { 249, "", 0, 0, 0, 0.0f },
+    { 250, "", 0, 0, 0, 0.0f },
+    { 251, "", 0, 0, 0, 0.0f },
+    { 252, "", 0, 0, 0, 0.0f },
+    { 253, "", 0, 0, 0, 0.0f },
+    { 254, "", 0, 0, 0, 0.0f },
+    { 255, "", 0, 0, 0, 0.0f },
+    { 256, "", 0, 0, 0, 0.0f },
+    { 257, "", 0, 0, 0, 0.0f },
+    { 258, "", 0, 0, 0, 0.0f },
+    { 259, "", 0, 0, 0, 0.0f },
+    { 260, "", 0, 0, 0, 0.0f },
+    { 261, "", 0, 0, 0, 0.0f },
+    { 262, "", 0, 0, 0, 0.0f },
+    { 263, "", 0, 0, 0, 0.0f },
+    { 264, "", 0, 0, 0, 0.0f },
+    { 265, "", 0, 0, 0, 0.0f },
+    { 266, "", 0, 0, 0, 0.0f },
+    { 267, "", 0, 0, 0, 0.0f },
+    { 268, "", 0, 0, 0, 0.0f },
+    { 269, "", 0, 0, 0, 0.0f },
+    { 270, "", 0, 0, 0, 0.0f },
+    { 271, "", 0, 0, 0, 0.0f },
+    { 272, "", 0, 0, 0, 0.0f },
+    { 273, "", 0, 0, 0, 0.0f },
+    { 274, "", 0, 0, 0, 0.0f },
+    { 275, "", 0, 0, 0, 0.0f },
+    { 276, "", 0, 0, 0, 0.0f },
+    { 277, "", 0, 0, 0, 0.0f },
+    { 278, "", 0, 0, 0, 0.0f },
+    { 279, "", 0, 0, 0, 0.0f },
+    { 280, "", 0, 0, 0, 0.0f },
+    { 281, "", 0, 0, 0, 0.0f },
+    { 282, "", 0, 0, 0, 0.0f },
+    { 283, "", 0, 0, 0, 0.0f },
+    { 284, "", 0, 0, 0, 0.0f },
+    { 285, "", 0, 0, 0, 0.0f },
+    { 286, "", 0, 0, 0, 0.0f },
+    { 287, "", 0, 0, 0, 0.0f },
+    { 288, "VoidRaySpeedUpgrade", 0, 0, 0, 0.0f },
+    { 289, "SmartServos", 100, 100, 766, 1760.0f },
+    { 290, "ArmorPiercingRockets", 150, 150, 767, 1760.0f },
+    { 291, "CycloneRapidFireLaunchers", 75, 75, 768, 1760.0f },
+    { 292, "RavenEnhancedMunitions", 150, 150, 806, 1760.0f },
+    { 293, "DiggingClaws", 150, 150, 3709, 1200.0f },
+    { 294, "CarrierCarrierCapacity", 0, 0, 0, 0.0f },
+    { 295, "CarrierLeashRangeUpgrade", 0, 0, 0, 0.0f },
+};
+
+const size_t LIBVOXELBOT_TABLE_UPGRADES_SIZE = 296;
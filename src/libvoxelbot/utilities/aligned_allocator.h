@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+/** Allocator returning memory aligned to the given number of bytes, used for containers processed with SIMD instructions */
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator {
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind {
+        typedef AlignedAllocator<U, Alignment> other;
+    };
+
+    AlignedAllocator() {
+    }
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {
+    }
+
+    T* allocate(std::size_t n) {
+        if (n == 0) return nullptr;
+#ifdef _WIN32
+        void* p = _aligned_malloc(n * sizeof(T), Alignment);
+#else
+        void* p = nullptr;
+        if (posix_memalign(&p, Alignment, n * sizeof(T)) != 0) p = nullptr;
+#endif
+        if (p == nullptr) throw std::bad_alloc();
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, std::size_t) {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        free(p);
+#endif
+    }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+inline bool operator==(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) {
+    return true;
+}
+
+template <typename T, typename U, std::size_t Alignment>
+inline bool operator!=(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) {
+    return false;
+}
@@ -4,6 +4,12 @@
 #include <iomanip>
 #include <iostream>
 #include <random>
+#include <thread>
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
 
 using namespace std;
 using namespace sc2;
@@ -32,152 +38,236 @@ static pair<int, int> round_point(Point2D p) {
     return make_pair((int)round(p.x), (int)round(p.y));
 }
 
-InfluenceMap& InfluenceMap::operator+=(const InfluenceMap& other) {
-    for (int i = 0; i < w * h; i++) {
-        weights[i] += other.weights[i];
-    }
-    return (*this);
-}
-
-InfluenceMap& InfluenceMap::operator+=(double other) {
-    for (int i = 0; i < w * h; i++) {
-        weights[i] += other;
-    }
-    return (*this);
-}
-
-InfluenceMap InfluenceMap::operator+(const InfluenceMap& other) const {
-    auto ret = (*this);
-    return (ret += other);
-}
-
-InfluenceMap& InfluenceMap::operator-=(const InfluenceMap& other) {
-    assert(w == other.w);
-    assert(h == other.h);
-
-    for (int i = 0; i < w * h; i++) {
-        weights[i] -= other.weights[i];
-    }
-    return (*this);
-}
-
-InfluenceMap InfluenceMap::operator-(const InfluenceMap& other) const {
-    auto ret = (*this);
-    return (ret -= other);
-}
-
-InfluenceMap& InfluenceMap::operator*=(const InfluenceMap& other) {
-    assert(w == other.w);
-    assert(h == other.h);
-    for (int i = 0; i < w * h; i++) {
-        weights[i] *= other.weights[i];
-    }
-    return (*this);
-}
-
-InfluenceMap InfluenceMap::operator*(const InfluenceMap& other) const {
-    auto ret = (*this);
-    return (ret *= other);
-}
-
-InfluenceMap& InfluenceMap::operator/=(const InfluenceMap& other) {
-    assert(w == other.w);
-    assert(h == other.h);
-
-    for (int i = 0; i < w * h; i++) {
-        weights[i] /= other.weights[i];
-    }
-    return (*this);
-}
-
-InfluenceMap InfluenceMap::operator/(const InfluenceMap& other) const {
-    auto ret = (*this);
-    return (ret /= other);
-}
-
-InfluenceMap InfluenceMap::operator+(double factor) const {
-    InfluenceMap ret = InfluenceMap(w, h);
-    for (int i = 0; i < w * h; i++) {
-        ret.weights[i] = weights[i] + factor;
-    }
-    return ret;
-}
-
-InfluenceMap InfluenceMap::operator-(double factor) const {
-    InfluenceMap ret = InfluenceMap(w, h);
-    for (int i = 0; i < w * h; i++) {
-        ret.weights[i] = weights[i] - factor;
-    }
-    return ret;
-}
-
-InfluenceMap InfluenceMap::operator*(double factor) const {
-    InfluenceMap ret = InfluenceMap(w, h);
-    for (int i = 0; i < w * h; i++) {
-        ret.weights[i] = weights[i] * factor;
-    }
-    return ret;
-}
-
-void InfluenceMap::operator*=(double factor) {
-    for (int i = 0; i < w * h; i++) {
-        weights[i] *= factor;
-    }
+/** Minimal SIMD abstraction used by the kernels below.
+ * FloatBatch processes several floats at once with AVX or SSE, ScalarBatch is the scalar fallback which is also used for the end of the rows.
+ * maximum(a, b) returns b when a is NaN, like std::max(b, a).
+ */
+struct ScalarBatch {
+    static const int size = 1;
+    float v;
+
+    static ScalarBatch load(const float* p) { return { *p }; }
+    static ScalarBatch broadcast(float x) { return { x }; }
+    void store(float* p) const { *p = v; }
+};
+
+struct ScalarMask {
+    bool v;
+};
+
+inline ScalarBatch operator+(ScalarBatch a, ScalarBatch b) { return { a.v + b.v }; }
+inline ScalarBatch operator*(ScalarBatch a, ScalarBatch b) { return { a.v * b.v }; }
+inline ScalarBatch operator/(ScalarBatch a, ScalarBatch b) { return { a.v / b.v }; }
+inline ScalarBatch maximum(ScalarBatch a, ScalarBatch b) { return { a.v > b.v ? a.v : b.v }; }
+inline ScalarMask equalMask(ScalarBatch a, ScalarBatch b) { return { a.v == b.v }; }
+inline ScalarMask greaterMask(ScalarBatch a, ScalarBatch b) { return { a.v > b.v }; }
+inline ScalarMask greaterEqualMask(ScalarBatch a, ScalarBatch b) { return { a.v >= b.v }; }
+inline ScalarBatch select(ScalarMask mask, ScalarBatch a, ScalarBatch b) { return { mask.v ? a.v : b.v }; }
+inline float horizontalMax(ScalarBatch a, float initial) { return a.v > initial ? a.v : initial; }
+inline float horizontalSum(ScalarBatch a) { return a.v; }
+
+#if defined(__AVX__)
+struct FloatBatch {
+    static const int size = 8;
+    __m256 v;
+
+    static FloatBatch load(const float* p) { return { _mm256_loadu_ps(p) }; }
+    static FloatBatch broadcast(float x) { return { _mm256_set1_ps(x) }; }
+    void store(float* p) const { _mm256_storeu_ps(p, v); }
+};
+
+struct FloatMask {
+    __m256 v;
+};
+
+inline FloatBatch operator+(FloatBatch a, FloatBatch b) { return { _mm256_add_ps(a.v, b.v) }; }
+inline FloatBatch operator*(FloatBatch a, FloatBatch b) { return { _mm256_mul_ps(a.v, b.v) }; }
+inline FloatBatch operator/(FloatBatch a, FloatBatch b) { return { _mm256_div_ps(a.v, b.v) }; }
+inline FloatBatch maximum(FloatBatch a, FloatBatch b) { return { _mm256_max_ps(a.v, b.v) }; }
+inline FloatMask equalMask(FloatBatch a, FloatBatch b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; }
+inline FloatMask greaterMask(FloatBatch a, FloatBatch b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+inline FloatMask greaterEqualMask(FloatBatch a, FloatBatch b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+inline FloatBatch select(FloatMask mask, FloatBatch a, FloatBatch b) { return { _mm256_blendv_ps(b.v, a.v, mask.v) }; }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+struct FloatBatch {
+    static const int size = 4;
+    __m128 v;
+
+    static FloatBatch load(const float* p) { return { _mm_loadu_ps(p) }; }
+    static FloatBatch broadcast(float x) { return { _mm_set1_ps(x) }; }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+};
+
+struct FloatMask {
+    __m128 v;
+};
+
+inline FloatBatch operator+(FloatBatch a, FloatBatch b) { return { _mm_add_ps(a.v, b.v) }; }
+inline FloatBatch operator*(FloatBatch a, FloatBatch b) { return { _mm_mul_ps(a.v, b.v) }; }
+inline FloatBatch operator/(FloatBatch a, FloatBatch b) { return { _mm_div_ps(a.v, b.v) }; }
+inline FloatBatch maximum(FloatBatch a, FloatBatch b) { return { _mm_max_ps(a.v, b.v) }; }
+inline FloatMask equalMask(FloatBatch a, FloatBatch b) { return { _mm_cmpeq_ps(a.v, b.v) }; }
+inline FloatMask greaterMask(FloatBatch a, FloatBatch b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+inline FloatMask greaterEqualMask(FloatBatch a, FloatBatch b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+inline FloatBatch select(FloatMask mask, FloatBatch a, FloatBatch b) { return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) }; }
+#else
+typedef ScalarBatch FloatBatch;
+typedef ScalarMask FloatMask;
+#endif
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+inline float horizontalMax(FloatBatch a, float initial) {
+    alignas(32) float values[FloatBatch::size];
+    a.store(values);
+    for (float v : values) initial = v > initial ? v : initial;
+    return initial;
+}
+
+inline float horizontalSum(FloatBatch a) {
+    alignas(32) float values[FloatBatch::size];
+    a.store(values);
+    float sum = 0;
+    for (float v : values) sum += v;
+    return sum;
+}
+#endif
+
+// Maps with fewer cells are processed on the calling thread only, starting threads costs more than propagating a regular map
+const int PARALLEL_MIN_CELLS = 512 * 512;
+const int PARALLEL_MIN_ROWS_PER_BAND = 16;
+
+/** Calls f(rowBegin, rowEnd) on bands of rows, in parallel for large maps */
+template <typename F>
+static void forEachRowBand(int begin, int end, int width, F f) {
+    int threadCount = 1;
+    if ((end - begin) * width >= PARALLEL_MIN_CELLS) {
+        threadCount = std::min((int)thread::hardware_concurrency(), (end - begin) / PARALLEL_MIN_ROWS_PER_BAND);
+    }
+    if (threadCount <= 1) {
+        f(begin, end);
+        return;
+    }
+
+    int band = (end - begin + threadCount - 1) / threadCount;
+    vector<thread> threads;
+    for (int rowBegin = begin + band; rowBegin < end; rowBegin += band) {
+        threads.emplace_back(f, rowBegin, std::min(end, rowBegin + band));
+    }
+    f(begin, std::min(end, begin + band));
+    for (auto& t : threads) t.join();
+}
+
+InfluenceMap& InfluenceMap::operator+=(float other) {
+    return (*this) = (*this) + other;
+}
+
+InfluenceMap& InfluenceMap::operator*=(float factor) {
+    return (*this) = (*this) * factor;
+}
+
+template <typename Batch>
+static int thresholdCells(float* weights, int begin, int end, float value) {
+    const Batch valueBatch = Batch::broadcast(value);
+    const Batch one = Batch::broadcast(1);
+    const Batch zero = Batch::broadcast(0);
+    int i = begin;
+    for (; i + Batch::size <= end; i += Batch::size) {
+        select(greaterEqualMask(Batch::load(weights + i), valueBatch), one, zero).store(weights + i);
+    }
+    return i;
 }
-
-void InfluenceMap::threshold(double value) {
-    for (int i = 0; i < w * h; i++)
-        weights[i] = weights[i] >= value ? 1 : 0;
+
+void InfluenceMap::threshold(float value) {
+    int i = thresholdCells<FloatBatch>(weights.data(), 0, w * h, value);
+    thresholdCells<ScalarBatch>(weights.data(), i, w * h, value);
 }
 
 double InfluenceMap::sum() const {
     double ret = 0.0;
+    const float* data = weights.data();
     for (int y = 0; y < h; y++) {
-        for (int x = 0; x < w; x++) {
-            ret += weights[y * w + x];
+        // Sum each row in floats and the rows in double to keep the precision on large maps
+        FloatBatch rowSum = FloatBatch::broadcast(0);
+        int x = 0;
+        for (; x + FloatBatch::size <= w; x += FloatBatch::size) {
+            rowSum = rowSum + FloatBatch::load(data + y * w + x);
+        }
+        double row = horizontalSum(rowSum);
+        for (; x < w; x++) {
+            row += data[y * w + x];
         }
+        ret += row;
     }
     return ret;
 }
 
 void InfluenceMap::max(const InfluenceMap& other) {
-    for (int i = 0; i < w*h; i++) {
-        weights[i] = std::max(weights[i], other.weights[i]);
+    assert(w == other.w);
+    assert(h == other.h);
+    float* data = weights.data();
+    const float* otherData = other.weights.data();
+    const int size = w * h;
+    int i = 0;
+    for (; i + FloatBatch::size <= size; i += FloatBatch::size) {
+        maximum(FloatBatch::load(otherData + i), FloatBatch::load(data + i)).store(data + i);
+    }
+    for (; i < size; i++) {
+        data[i] = std::max(data[i], otherData[i]);
+    }
+}
+
+template <typename Batch>
+static float maxCells(const float* weights, int& i, int end, bool finiteOnly, float initial) {
+    const Batch zero = Batch::broadcast(0);
+    Batch ret = Batch::broadcast(initial);
+    for (; i + Batch::size <= end; i += Batch::size) {
+        Batch value = Batch::load(weights + i);
+        if (finiteOnly) {
+            // x - x is NaN for infinite and NaN values
+            Batch difference = value + value * Batch::broadcast(-1);
+            value = select(equalMask(difference, zero), value, ret);
+        }
+        ret = maximum(value, ret);
     }
+    return horizontalMax(ret, initial);
 }
 
-double InfluenceMap::max() const {
-    double ret = 0.0;
-    for (int i = 0; i < w * h; i++) {
-        ret = std::max(ret, weights[i]);
-    }
-    return ret;
+float InfluenceMap::max() const {
+    int i = 0;
+    float ret = maxCells<FloatBatch>(weights.data(), i, w * h, false, 0.0f);
+    return maxCells<ScalarBatch>(weights.data(), i, w * h, false, ret);
 }
 
-double InfluenceMap::maxFinite() const {
-    double ret = 0.0;
-    for (auto w : weights) {
-        if (isfinite(w))
-            ret = std::max(ret, w);
-    }
-    return ret;
+float InfluenceMap::maxFinite() const {
+    int i = 0;
+    float ret = maxCells<FloatBatch>(weights.data(), i, w * h, true, 0.0f);
+    return maxCells<ScalarBatch>(weights.data(), i, w * h, true, ret);
 }
 
 Point2DI InfluenceMap::argmax() const {
-    double mx = -100000;
-    Point2DI best(0, 0);
+    // Find the row holding the largest finite value with the vectorized kernel, then the first cell of that row holding it
+    float mx = -100000;
+    int bestRow = -1;
     for (int y = 0; y < h; y++) {
+        int i = y * w;
+        float rowMax = maxCells<FloatBatch>(weights.data(), i, y * w + w, true, mx);
+        rowMax = maxCells<ScalarBatch>(weights.data(), i, y * w + w, true, rowMax);
+        if (rowMax > mx) {
+            mx = rowMax;
+            bestRow = y;
+        }
+    }
+
+    if (bestRow >= 0) {
         for (int x = 0; x < w; x++) {
-            if (weights[y * w + x] > mx && isfinite(weights[y * w + x])) {
-                mx = weights[y * w + x];
-                best = Point2DI(x, y);
-            }
+            if (weights[bestRow * w + x] == mx)
+                return Point2DI(x, bestRow);
         }
     }
-    return best;
+    return Point2DI(0, 0);
 }
 
-InfluenceMap InfluenceMap::replace_nonzero(double with) const {
+InfluenceMap InfluenceMap::replace_nonzero(float with) const {
     InfluenceMap ret = InfluenceMap(w, h);
     for (int i = 0; i < w * h; i++) {
         ret.weights[i] = weights[i] != 0 ? with : 0;
@@ -185,7 +275,7 @@ InfluenceMap InfluenceMap::replace_nonzero(double with) const {
     return ret;
 }
 
-InfluenceMap InfluenceMap::replace_nan(double with) const {
+InfluenceMap InfluenceMap::replace_nan(float with) const {
     InfluenceMap ret = InfluenceMap(w, h);
     for (int i = 0; i < w * h; i++) {
         ret.weights[i] = isnan(weights[i]) ? with : weights[i];
@@ -193,7 +283,7 @@ InfluenceMap InfluenceMap::replace_nan(double with) const {
     return ret;
 }
 
-InfluenceMap InfluenceMap::replace(double value, double with) const {
+InfluenceMap InfluenceMap::replace(float value, float with) const {
     InfluenceMap ret = InfluenceMap(w, h);
     for (int i = 0; i < w * h; i++) {
         ret.weights[i] = weights[i] == value ? with : weights[i];
@@ -201,24 +291,24 @@ InfluenceMap InfluenceMap::replace(double value, double with) const {
     return ret;
 }
 
-void InfluenceMap::addInfluence(double influence, Point2DI pos) {
+void InfluenceMap::addInfluence(float influence, Point2DI pos) {
     assert(pos.x >= 0 && pos.x < w && pos.y >= 0 && pos.y < h);
     weights[pos.y * w + pos.x] += influence;
 }
 
-void InfluenceMap::addInfluence(double influence, Point2D pos) {
+void InfluenceMap::addInfluence(float influence, Point2D pos) {
     auto p = round_point(pos);
     assert(p.first >= 0 && p.first < w && p.second >= 0 && p.second < h);
     weights[p.second * w + p.first] += influence;
 }
 
-void InfluenceMap::setInfluence(double influence, Point2D pos) {
+void InfluenceMap::setInfluence(float influence, Point2D pos) {
     auto p = round_point(pos);
     assert(p.first >= 0 && p.first < w && p.second >= 0 && p.second < h);
     weights[p.second * w + p.first] = influence;
 }
 
-void InfluenceMap::addInfluenceInDecayingCircle(double influence, double radius, Point2D pos) {
+void InfluenceMap::addInfluenceInDecayingCircle(float influence, float radius, Point2D pos) {
     int x0, y0;
     tie(x0, y0) = round_point(pos);
 
@@ -234,7 +324,7 @@ void InfluenceMap::addInfluenceInDecayingCircle(double influence, double radius,
     }
 }
 
-void InfluenceMap::setInfluenceInCircle(double influence, double radius, Point2D pos) {
+void InfluenceMap::setInfluenceInCircle(float influence, float radius, Point2D pos) {
     int x0, y0;
     tie(x0, y0) = round_point(pos);
 
@@ -292,7 +382,7 @@ void InfluenceMap::maxInfluence(const vector<vector<double> >& influence, Point2
             int x = x0 + dx;
             int y = y0 + dy;
             if (x >= 0 && y >= 0 && x < w && y < h) {
-                weights[y * w + x] = std::max(weights[y * w + x], influence[dx + r][dy + r]);
+                weights[y * w + x] = std::max(weights[y * w + x], (float)influence[dx + r][dy + r]);
             }
         }
     }
@@ -308,21 +398,17 @@ void InfluenceMap::maxInfluenceMultiple(const vector<vector<double> >& influence
             int x = x0 + dx;
             int y = y0 + dy;
             if (x >= 0 && y >= 0 && x < w && y < h) {
-                weights[y * w + x] = std::max(weights[y * w + x], influence[dx + r][dy + r] * factor);
+                weights[y * w + x] = std::max(weights[y * w + x], (float)(influence[dx + r][dy + r] * factor));
             }
         }
     }
 }
 
-vector<double> temporary_buffer;
-void InfluenceMap::propagateMax(double decay, double speed, const InfluenceMap& traversable) {
-    double factor = 1 - decay;
-    // Diagonal decay
-    double factor2 = pow(factor, 1.41);
-
-    temporary_buffer.resize(weights.size());
-    vector<double>& newWeights = temporary_buffer;
+// Per thread so that maps can be propagated concurrently
+static thread_local vector<float, AlignedAllocator<float, 32>> temporary_buffer;
 
+/** Copies the cells next to the border onto the border and prepares the output buffer */
+static void prepareBorders(vector<float, AlignedAllocator<float, 32>>& weights, vector<float, AlignedAllocator<float, 32>>& newWeights, int w, int h) {
     for (int y = 0; y < h; y++) {
         weights[y * w + 0] = weights[y * w + 1];
         weights[y * w + w - 1] = weights[y * w + w - 2];
@@ -332,101 +418,118 @@ void InfluenceMap::propagateMax(double decay, double speed, const InfluenceMap&
         weights[(h - 1) * w + x] = weights[(h - 2) * w + x];
     }
 
-    for (int y = 1; y < h - 1; y++) {
-        int yw = y * w;
-        for (int x = 1; x < w - 1; x++) {
-            int i = yw + x;
-            if (traversable[i] == 0) {
-                newWeights[i] = 0;
-                continue;
-            }
-
-            double c = 0;
-            c = std::max(c, weights[i]);
-            c = std::max(c, weights[i - 1]);
-            c = std::max(c, weights[i + 1]);
-            c = std::max(c, weights[i - w]);
-            c = std::max(c, weights[i + w]);
-            c *= factor;
-
-            double c2 = 0;
-            c2 = std::max(c2, weights[i - w - 1]);
-            c2 = std::max(c2, weights[i - w + 1]);
-            c2 = std::max(c2, weights[i + w - 1]);
-            c2 = std::max(c2, weights[i + w + 1]);
-            c2 *= factor2;
-            c = std::max(c, c2);
-
-            c = c * speed + (1 - speed) * weights[i];
-            newWeights[i] = c;
-        }
+    newWeights.resize(weights.size());
+    for (int y = 0; y < h; y++) {
+        newWeights[y * w + 0] = weights[y * w + 0];
+        newWeights[y * w + w - 1] = weights[y * w + w - 1];
     }
+    for (int x = 0; x < w; x++) {
+        newWeights[x] = weights[x];
+        newWeights[(h - 1) * w + x] = weights[(h - 1) * w + x];
+    }
+}
+
+template <typename Batch>
+static int propagateMaxCells(const float* weights, const float* traversable, float* newWeights, int w, int begin, int end, float factor, float factor2, float speed) {
+    const Batch zero = Batch::broadcast(0);
+    const Batch factorBatch = Batch::broadcast(factor);
+    const Batch factor2Batch = Batch::broadcast(factor2);
+    const Batch speedBatch = Batch::broadcast(speed);
+    const Batch inverseSpeedBatch = Batch::broadcast(1 - speed);
+    int i = begin;
+    for (; i + Batch::size <= end; i += Batch::size) {
+        const Batch center = Batch::load(weights + i);
+        Batch c = maximum(center, zero);
+        c = maximum(Batch::load(weights + i - 1), c);
+        c = maximum(Batch::load(weights + i + 1), c);
+        c = maximum(Batch::load(weights + i - w), c);
+        c = maximum(Batch::load(weights + i + w), c);
+        c = c * factorBatch;
+
+        Batch c2 = maximum(Batch::load(weights + i - w - 1), zero);
+        c2 = maximum(Batch::load(weights + i - w + 1), c2);
+        c2 = maximum(Batch::load(weights + i + w - 1), c2);
+        c2 = maximum(Batch::load(weights + i + w + 1), c2);
+        c2 = c2 * factor2Batch;
+        c = maximum(c2, c);
+
+        c = c * speedBatch + inverseSpeedBatch * center;
+        select(equalMask(Batch::load(traversable + i), zero), zero, c).store(newWeights + i);
+    }
+    return i;
+}
+
+void InfluenceMap::propagateMax(float decay, float speed, const InfluenceMap& traversable) {
+    float factor = 1 - decay;
+    // Diagonal decay
+    float factor2 = pow(factor, 1.41f);
+
+    prepareBorders(weights, temporary_buffer, w, h);
+    const float* data = weights.data();
+    const float* traversableData = traversable.weights.data();
+    float* newWeights = temporary_buffer.data();
+    const int width = w;
+
+    forEachRowBand(1, h - 1, w, [=](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; y++) {
+            int i = propagateMaxCells<FloatBatch>(data, traversableData, newWeights, width, y * width + 1, y * width + width - 1, factor, factor2, speed);
+            propagateMaxCells<ScalarBatch>(data, traversableData, newWeights, width, i, y * width + width - 1, factor, factor2, speed);
+        }
+    });
 
     swap(weights, temporary_buffer);
 }
 
-void InfluenceMap::propagateSum(double decay, double speed, const InfluenceMap& traversable) {
-    // double decayCorrectionFactor = (5*(1-decay) + 4*pow(1-decay,1.41))/9;
-    // decay *= decay / (1 - decayCorrectionFactor);
-    double factor = 1 - decay;
-    // cout << "Estimated decay at " << ((5*(1-decay) + 4*pow(1-decay,1.41))/9) << endl;
-    // Diagonal decay
-    // double factor2 = pow(factor, 1.41);
+template <typename Batch>
+static int propagateSumCells(const float* weights, const float* traversable, float* newWeights, int w, int begin, int end, float factor, float speed) {
+    const Batch zero = Batch::broadcast(0);
+    const Batch gaussianFactor0 = Batch::broadcast(1);     //0.195346;
+    const Batch gaussianFactor1 = Batch::broadcast(1);     //0.123317;
+    const Batch gaussianFactor2 = Batch::broadcast(0.75f); //0.077847;
+    const Batch factorBatch = Batch::broadcast(factor);
+    const Batch speedBatch = Batch::broadcast(speed);
+    const Batch inverseSpeedBatch = Batch::broadcast(1 - speed);
+    int i = begin;
+    for (; i + Batch::size <= end; i += Batch::size) {
+        const Batch traversableCenter = Batch::load(traversable + i);
+        Batch neighbours = gaussianFactor0;
+        neighbours = neighbours + gaussianFactor1 * (Batch::load(traversable + i - 1) + Batch::load(traversable + i + 1) + Batch::load(traversable + i - w) + Batch::load(traversable + i + w));
+        neighbours = neighbours + gaussianFactor2 * (Batch::load(traversable + i - w - 1) + Batch::load(traversable + i - w + 1) + Batch::load(traversable + i + w - 1) + Batch::load(traversable + i + w + 1));
 
-    double gaussianFactor0 = 1;     //0.195346;
-    double gaussianFactor1 = 1;     //0.123317;
-    double gaussianFactor2 = 0.75;  //0.077847;
+        const Batch center = Batch::load(weights + i);
+        Batch c = (Batch::load(weights + i - 1) + Batch::load(weights + i + 1) + Batch::load(weights + i - w) + Batch::load(weights + i + w)) * gaussianFactor1;
+        c = c + center * gaussianFactor0;
+        c = c + (Batch::load(weights + i - w - 1) + Batch::load(weights + i - w + 1) + Batch::load(weights + i + w - 1) + Batch::load(weights + i + w + 1)) * gaussianFactor2;
 
-    temporary_buffer.resize(weights.size());
-    vector<double>& newWeights = temporary_buffer;
+        // To prevent the total weight values from increasing unbounded
+        c = select(greaterMask(neighbours, zero), c / neighbours, c);
 
-    for (int y = 0; y < h; y++) {
-        weights[y * w + 0] = weights[y * w + 1];
-        weights[y * w + w - 1] = weights[y * w + w - 2];
-    }
-    for (int x = 0; x < w; x++) {
-        weights[x] = weights[x + w];
-        weights[(h - 1) * w + x] = weights[(h - 2) * w + x];
+        c = c * speedBatch + inverseSpeedBatch * center;
+        select(equalMask(traversableCenter, zero), zero, c * factorBatch).store(newWeights + i);
     }
+    return i;
+}
 
-    for (int y = 1; y < h - 1; y++) {
-        int yw = y * w;
-        for (int x = 1; x < w - 1; x++) {
-            int i = yw + x;
-
-            if (traversable[i] == 0) {
-                newWeights[i] = 0;
-                continue;
-            }
-
-            double neighbours = gaussianFactor0;
-            neighbours += gaussianFactor1 * (traversable[i - 1] + traversable[i + 1] + traversable[i - w] + traversable[i + w]) + gaussianFactor2 * (traversable[i - w - 1] + traversable[i - w + 1] + traversable[i + w - 1] + traversable[i + w + 1]);
-
-            double c = 0;
-            c += weights[i - 1];
-            c += weights[i + 1];
-            c += weights[i - w];
-            c += weights[i + w];
-            c *= gaussianFactor1;
-
-            c += weights[i] * gaussianFactor0;
-
-            double c2 = 0;
-            c2 += weights[i - w - 1];
-            c2 += weights[i - w + 1];
-            c2 += weights[i + w - 1];
-            c2 += weights[i + w + 1];
-            c2 *= gaussianFactor2;
-            c += c2;
+void InfluenceMap::propagateSum(float decay, float speed, const InfluenceMap& traversable) {
+    // double decayCorrectionFactor = (5*(1-decay) + 4*pow(1-decay,1.41))/9;
+    // decay *= decay / (1 - decayCorrectionFactor);
+    float factor = 1 - decay;
+    // cout << "Estimated decay at " << ((5*(1-decay) + 4*pow(1-decay,1.41))/9) << endl;
+    // Diagonal decay
+    // double factor2 = pow(factor, 1.41);
 
-            // To prevent the total weight values from increasing unbounded
-            if (neighbours > 0)
-                c /= neighbours;
+    prepareBorders(weights, temporary_buffer, w, h);
+    const float* data = weights.data();
+    const float* traversableData = traversable.weights.data();
+    float* newWeights = temporary_buffer.data();
+    const int width = w;
 
-            c = c * speed + (1 - speed) * weights[i];
-            newWeights[i] = c * factor;
+    forEachRowBand(1, h - 1, w, [=](int rowBegin, int rowEnd) {
+        for (int y = rowBegin; y < rowEnd; y++) {
+            int i = propagateSumCells<FloatBatch>(data, traversableData, newWeights, width, y * width + 1, y * width + width - 1, factor, speed);
+            propagateSumCells<ScalarBatch>(data, traversableData, newWeights, width, i, y * width + width - 1, factor, speed);
         }
-    }
+    });
 
     swap(weights, temporary_buffer);
 }
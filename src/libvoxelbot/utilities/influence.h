@@ -1,10 +1,89 @@
 #pragma once
 #include "sc2api/sc2_api.h"
+#include "aligned_allocator.h"
+#include <cassert>
 #include <vector>
 
-struct InfluenceMap {
-    std::vector<double> weights;
-    int w, h;
+struct InfluenceMap;
+
+/** Base of the lazily evaluated influence map expressions.
+ * Arithmetic between maps builds an expression tree which is evaluated in a single pass
+ * when it is assigned to an InfluenceMap, so chained operations do not allocate temporary maps.
+ */
+template <typename E>
+struct InfluenceExpression {
+    const E& self() const {
+        return static_cast<const E&>(*this);
+    }
+};
+
+// Maps are referenced by the expression tree, intermediate expressions are stored by value since they are temporaries
+template <typename E>
+struct InfluenceOperand {
+    typedef const E type;
+};
+
+template <>
+struct InfluenceOperand<InfluenceMap> {
+    typedef const InfluenceMap& type;
+};
+
+struct InfluenceAdd {
+    static float apply(float a, float b) { return a + b; }
+};
+
+struct InfluenceSubtract {
+    static float apply(float a, float b) { return a - b; }
+};
+
+struct InfluenceMultiply {
+    static float apply(float a, float b) { return a * b; }
+};
+
+struct InfluenceDivide {
+    static float apply(float a, float b) { return a / b; }
+};
+
+template <typename L, typename R, typename Op>
+struct InfluenceBinaryExpression : InfluenceExpression<InfluenceBinaryExpression<L, R, Op>> {
+    typename InfluenceOperand<L>::type left;
+    typename InfluenceOperand<R>::type right;
+
+    InfluenceBinaryExpression(const L& left, const R& right)
+        : left(left), right(right) {
+        assert(left.width() == right.width());
+        assert(left.height() == right.height());
+    }
+
+    int width() const { return left.width(); }
+    int height() const { return left.height(); }
+
+    float operator[](int index) const {
+        return Op::apply(left[index], right[index]);
+    }
+};
+
+template <typename L, typename Op>
+struct InfluenceScalarExpression : InfluenceExpression<InfluenceScalarExpression<L, Op>> {
+    typename InfluenceOperand<L>::type left;
+    float scalar;
+
+    InfluenceScalarExpression(const L& left, float scalar)
+        : left(left), scalar(scalar) {
+    }
+
+    int width() const { return left.width(); }
+    int height() const { return left.height(); }
+
+    float operator[](int index) const {
+        return Op::apply(left[index], scalar);
+    }
+};
+
+struct InfluenceMap : InfluenceExpression<InfluenceMap> {
+    // Aligned for the SIMD kernels in influence.cpp
+    std::vector<float, AlignedAllocator<float, 32>> weights;
+    int w = 0, h = 0;
 
     InfluenceMap() {
     }
@@ -12,101 +91,167 @@ struct InfluenceMap {
     InfluenceMap(int width, int height) {
         w = width;
         h = height;
-        weights = std::vector<double>(width*height, 0.0);
+        weights.assign(width*height, 0.0f);
+    }
+
+    template <typename E>
+    InfluenceMap(const InfluenceExpression<E>& expression) {
+        *this = expression;
     }
 
     InfluenceMap(const sc2::ImageData map);
     InfluenceMap(const SC2APIProtocol::ImageData map);
 
-    inline double& operator()(int x, int y) {
+    int width() const { return w; }
+    int height() const { return h; }
+
+    inline float& operator()(int x, int y) {
         return weights[y*w + x];
     }
 
-    inline double operator()(int x, int y) const {
+    inline float operator()(int x, int y) const {
         return weights[y*w + x];
     }
 
-    inline double& operator()(sc2::Point2DI p) {
+    inline float& operator()(sc2::Point2DI p) {
         return weights[p.y*w + p.x];
     }
 
-    inline double operator()(sc2::Point2DI p) const {
+    inline float operator()(sc2::Point2DI p) const {
         return weights[p.y*w + p.x];
     }
 
-    inline double& operator()(sc2::Point2D p) {
+    inline float& operator()(sc2::Point2D p) {
         return weights[std::min(h-1, std::max(0, (int)round(p.y)))*w + std::min(w-1, std::max(0, (int)round(p.x)))];
     }
 
-    inline double operator()(sc2::Point2D p) const {
+    inline float operator()(sc2::Point2D p) const {
         return weights[std::min(h-1, std::max(0, (int)round(p.y)))*w + std::min(w-1, std::max(0, (int)round(p.x)))];
     }
 
-    inline double& operator[](int index) {
+    inline float& operator[](int index) {
         return weights[index];
     }
 
-    inline double operator[](int index) const {
+    inline float operator[](int index) const {
         return weights[index];
     }
 
-    InfluenceMap& operator+= (const InfluenceMap& other);
-
-    InfluenceMap& operator+= (double other);
-
-    InfluenceMap operator+ (const InfluenceMap& other) const;
-
-    InfluenceMap& operator-= (const InfluenceMap& other);
-
-    InfluenceMap operator- (const InfluenceMap& other) const;
-
-    InfluenceMap& operator*= (const InfluenceMap& other);
-
-    InfluenceMap operator* (const InfluenceMap& other) const;
+    /** Evaluates the expression in a single pass.
+     * The expression may reference this map since every element only depends on the elements at the same index.
+     */
+    template <typename E>
+    InfluenceMap& operator= (const InfluenceExpression<E>& expression) {
+        const E& e = expression.self();
+        if (e.width() != w || e.height() != h) {
+            // The expression cannot reference this map since the sizes differ
+            w = e.width();
+            h = e.height();
+            weights.resize(w*h);
+        }
+        float* out = weights.data();
+        const int size = w*h;
+        for (int i = 0; i < size; i++) {
+            out[i] = e[i];
+        }
+        return (*this);
+    }
 
-    InfluenceMap& operator/= (const InfluenceMap& other);
+    template <typename E>
+    InfluenceMap& operator+= (const InfluenceExpression<E>& other) {
+        return (*this) = InfluenceBinaryExpression<InfluenceMap, E, InfluenceAdd>(*this, other.self());
+    }
 
-    InfluenceMap operator/ (const InfluenceMap& other) const;
+    template <typename E>
+    InfluenceMap& operator-= (const InfluenceExpression<E>& other) {
+        return (*this) = InfluenceBinaryExpression<InfluenceMap, E, InfluenceSubtract>(*this, other.self());
+    }
 
-    InfluenceMap operator+ (double factor) const;
+    template <typename E>
+    InfluenceMap& operator*= (const InfluenceExpression<E>& other) {
+        return (*this) = InfluenceBinaryExpression<InfluenceMap, E, InfluenceMultiply>(*this, other.self());
+    }
 
-    InfluenceMap operator- (double factor) const;
+    template <typename E>
+    InfluenceMap& operator/= (const InfluenceExpression<E>& other) {
+        return (*this) = InfluenceBinaryExpression<InfluenceMap, E, InfluenceDivide>(*this, other.self());
+    }
 
-    InfluenceMap operator* (double factor) const;
+    InfluenceMap& operator+= (float other);
 
-    void operator*= (double factor);
+    InfluenceMap& operator*= (float factor);
 
-    void threshold(double value);
+    void threshold(float value);
 
     double sum() const;
 
-    double max() const;
+    float max() const;
     void max(const InfluenceMap& other);
-    double maxFinite() const;
+    float maxFinite() const;
 
     sc2::Point2DI argmax() const;
 
-    InfluenceMap replace_nonzero(double with) const;
-    InfluenceMap replace_nan(double with) const;
-    InfluenceMap replace(double value, double with) const;
+    InfluenceMap replace_nonzero(float with) const;
+    InfluenceMap replace_nan(float with) const;
+    InfluenceMap replace(float value, float with) const;
 
-    void addInfluence(double influence, sc2::Point2DI pos);
-    void addInfluence(double influence, sc2::Point2D pos);
-    void setInfluence(double influence, sc2::Point2D pos);
-    void addInfluenceInDecayingCircle(double influence, double radius, sc2::Point2D pos);
-    void setInfluenceInCircle(double influence, double radius, sc2::Point2D pos);
+    void addInfluence(float influence, sc2::Point2DI pos);
+    void addInfluence(float influence, sc2::Point2D pos);
+    void setInfluence(float influence, sc2::Point2D pos);
+    void addInfluenceInDecayingCircle(float influence, float radius, sc2::Point2D pos);
+    void setInfluenceInCircle(float influence, float radius, sc2::Point2D pos);
 
     void addInfluence(const std::vector<std::vector<double> >& influence, sc2::Point2D);
-    
+
     void addInfluenceMultiple(const std::vector<std::vector<double> >& influence, sc2::Point2D, double factor);
 
     void maxInfluence(const std::vector<std::vector<double> >& influence, sc2::Point2D);
 
     void maxInfluenceMultiple(const std::vector<std::vector<double> >& influence, sc2::Point2D, double factor);
 
-    void propagateMax(double decay, double speed, const InfluenceMap& traversable);
-    void propagateSum(double decay, double speed, const InfluenceMap& traversable);
+    void propagateMax(float decay, float speed, const InfluenceMap& traversable);
+    void propagateSum(float decay, float speed, const InfluenceMap& traversable);
     sc2::Point2DI samplePointFromProbabilityDistribution() const;
 
     void print() const;
 };
+
+template <typename L, typename R>
+inline InfluenceBinaryExpression<L, R, InfluenceAdd> operator+ (const InfluenceExpression<L>& left, const InfluenceExpression<R>& right) {
+    return InfluenceBinaryExpression<L, R, InfluenceAdd>(left.self(), right.self());
+}
+
+template <typename L, typename R>
+inline InfluenceBinaryExpression<L, R, InfluenceSubtract> operator- (const InfluenceExpression<L>& left, const InfluenceExpression<R>& right) {
+    return InfluenceBinaryExpression<L, R, InfluenceSubtract>(left.self(), right.self());
+}
+
+template <typename L, typename R>
+inline InfluenceBinaryExpression<L, R, InfluenceMultiply> operator* (const InfluenceExpression<L>& left, const InfluenceExpression<R>& right) {
+    return InfluenceBinaryExpression<L, R, InfluenceMultiply>(left.self(), right.self());
+}
+
+template <typename L, typename R>
+inline InfluenceBinaryExpression<L, R, InfluenceDivide> operator/ (const InfluenceExpression<L>& left, const InfluenceExpression<R>& right) {
+    return InfluenceBinaryExpression<L, R, InfluenceDivide>(left.self(), right.self());
+}
+
+template <typename L>
+inline InfluenceScalarExpression<L, InfluenceAdd> operator+ (const InfluenceExpression<L>& left, double factor) {
+    return InfluenceScalarExpression<L, InfluenceAdd>(left.self(), (float)factor);
+}
+
+template <typename L>
+inline InfluenceScalarExpression<L, InfluenceSubtract> operator- (const InfluenceExpression<L>& left, double factor) {
+    return InfluenceScalarExpression<L, InfluenceSubtract>(left.self(), (float)factor);
+}
+
+template <typename L>
+inline InfluenceScalarExpression<L, InfluenceMultiply> operator* (const InfluenceExpression<L>& left, double factor) {
+    return InfluenceScalarExpression<L, InfluenceMultiply>(left.self(), (float)factor);
+}
+
+template <typename L>
+inline InfluenceScalarExpression<L, InfluenceDivide> operator/ (const InfluenceExpression<L>& left, double factor) {
+    return InfluenceScalarExpression<L, InfluenceDivide>(left.self(), (float)factor);
+}
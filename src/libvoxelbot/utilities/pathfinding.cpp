@@ -1,162 +1,271 @@
 #include "pathfinding.h"
+#include <algorithm>
 #include <cmath>
-#include <iostream>
-#include <queue>
+#include <limits>
 #include <vector>
 
 using namespace std;
 using namespace sc2;
 
-struct PathfindingEntry {
-    double cost;
-    double h;
-    Point2DI pos;
+// Above that many buckets, the bucket queue would spend more time skipping empty buckets than a heap spends sorting
+const int64_t MAX_BUCKET_COUNT = 1 << 16;
 
-    PathfindingEntry(double _cost, Point2DI _pos)
-        : cost(_cost), h(0), pos(_pos) {
-    }
+const int dx[8] = { 1, 1, 1, 0, 0, -1, -1, -1 };
+const int dy[8] = { 1, 0, -1, 1, -1, 1, 0, -1 };
+const float dc[8] = { 1.41f, 1, 1.41f, 1, 1, 1.41f, 1, 1.41f };
 
-    PathfindingEntry(double _cost, double _h, Point2DI _pos)
-        : cost(_cost), h(_h), pos(_pos) {
-    }
+/** Prepares the queue for a search where every step costs between minStepCost and maxStepCost.
+ * Pass a non-positive minStepCost to use the binary heap.
+ */
+void PathfindingQueue::reset(float minStepCost, float maxStepCost) {
+    for (auto& bucket : buckets)
+        bucket.clear();
+    while (!heap.empty())
+        heap.pop();
+    count = 0;
+    currentBucket = 0;
 
-    bool operator<(const PathfindingEntry& other) const {
-        return cost + h > other.cost + other.h;
+    useBuckets = minStepCost > 0 && isfinite(maxStepCost) && maxStepCost / minStepCost < MAX_BUCKET_COUNT - 2;
+    if (useBuckets) {
+        // A step can never skip more than maxStepCost / bucketWidth buckets, so the buckets can be reused in a circular fashion
+        bucketWidth = minStepCost;
+        size_t bucketCount = (size_t)ceil(maxStepCost / minStepCost) + 2;
+        if (buckets.size() < bucketCount)
+            buckets.resize(bucketCount);
     }
-};
+}
 
-const int MAX_MAP_SIZE = 256;
+void PathfindingQueue::push(float cost, int index) {
+    count++;
+    if (!useBuckets) {
+        heap.push(Entry(cost, index));
+        return;
+    }
 
-int dx[8] = { 1, 1, 1, 0, 0, -1, -1, -1 };
-int dy[8] = { 1, 0, -1, 1, -1, 1, 0, -1 };
-double dc[8] = { 1.41, 1, 1.41, 1, 1, 1.41, 1, 1.41 };
+    // Clamp to guard against float rounding, an entry can never end up before the current bucket or wrap around
+    int64_t bucket = (int64_t)(cost / bucketWidth);
+    bucket = std::max(currentBucket, std::min(currentBucket + (int64_t)buckets.size() - 1, bucket));
+    buckets[bucket % buckets.size()].push_back(Entry(cost, index));
+}
 
-/** Returns a map of distances from the starting points.
- * A point is considered a starting point if the element in the startingPoints map is non-zero.
- * The costs per cell are given by the costs map.
- * Diagonal movement costs sqrt(2) times more than axis aligned movement.
+/** Returns an entry with the lowest cost. With buckets, entries of the same bucket are returned in any order
+ * which is still exact since a step costs at least the bucket width.
  */
-InfluenceMap getDistances(const InfluenceMap& startingPoints, const InfluenceMap& costs) {
-    assert(startingPoints.w == costs.w);
-    assert(startingPoints.h == costs.h);
+PathfindingQueue::Entry PathfindingQueue::pop() {
+    assert(count > 0);
+    count--;
+    if (!useBuckets) {
+        auto entry = heap.top();
+        heap.pop();
+        return entry;
+    }
 
-    InfluenceMap distances(startingPoints.w, startingPoints.h);
-    for (auto& w : distances.weights)
-        w = numeric_limits<double>::infinity();
+    while (buckets[currentBucket % buckets.size()].empty())
+        currentBucket++;
+    auto& bucket = buckets[currentBucket % buckets.size()];
+    auto entry = bucket.back();
+    bucket.pop_back();
+    return entry;
+}
 
-    static priority_queue<PathfindingEntry> pq;
+void PathfindingContext::prepare(const InfluenceMap& costMap) {
+    w = costMap.w;
+    h = costMap.h;
+    size_t size = w * h;
+    if (versions.size() < size) {
+        costs.resize(size);
+        parents.resize(size);
+        versions.resize(size, 0);
+        targetVersions.resize(size, 0);
+    }
 
-    int h = startingPoints.h;
-    int w = startingPoints.w;
+    version++;
+    if (version == 0) {
+        // The version wrapped around, old stamps could be mistaken for current ones
+        fill(versions.begin(), versions.end(), 0);
+        fill(targetVersions.begin(), targetVersions.end(), 0);
+        version = 1;
+    }
 
-    for (int y = 0; y < h; y++) {
-        for (int x = 0; x < w; x++) {
-            if (startingPoints(x, y)) {
-                pq.push(PathfindingEntry(0.0, Point2DI(x, y)));
-                distances(x, y) = 0;
-            }
+    float minCost = numeric_limits<float>::infinity();
+    float maxCost = 0;
+    for (int i = 0; i < w * h; i++) {
+        float cost = costMap.weights[i];
+        if (isfinite(cost)) {
+            minCost = std::min(minCost, cost);
+            maxCost = std::max(maxCost, cost);
         }
     }
+    queue.reset(minCost, maxCost * dc[0]);
+}
 
-    while (!pq.empty()) {
-        auto currentEntry = pq.top();
-        auto currentPos = currentEntry.pos;
-        pq.pop();
-        if (currentEntry.cost > distances(currentPos)) {
+void PathfindingContext::addSource(int index, int label, vector<int>* labels) {
+    if (getCost(index) > 0) {
+        costs[index] = 0;
+        parents[index] = index;
+        versions[index] = version;
+        if (labels != nullptr)
+            (*labels)[index] = label;
+        queue.push(0, index);
+    }
+}
+
+/** Runs Dijkstra from the sources added since the last prepare call.
+ * The search stops when the goal is reached or when targetCount cells marked as targets have been reached.
+ * Returns the last reached cell.
+ */
+int PathfindingContext::search(const InfluenceMap& costMap, int goal, int targetCount, vector<int>* labels) {
+    int current = -1;
+    while (!queue.empty()) {
+        auto entry = queue.pop();
+        current = entry.second;
+        if (entry.first > costs[current]) {
             continue;
         }
 
+        if (current == goal) {
+            break;
+        }
+
+        if (targetVersions[current] == version) {
+            targetVersions[current] = 0;
+            if (--targetCount == 0)
+                break;
+        }
+
+        int cx = current % w;
+        int cy = current / w;
         for (int i = 0; i < 8; i++) {
-            int x = currentPos.x + dx[i];
-            int y = currentPos.y + dy[i];
-            if ((unsigned int)x >= w || (unsigned int)y >= h || isinf(costs(x, y))) {
+            int x = cx + dx[i];
+            int y = cy + dy[i];
+            if ((unsigned int)x >= (unsigned int)w || (unsigned int)y >= (unsigned int)h) {
+                continue;
+            }
+
+            int next = y * w + x;
+            float stepCost = costMap.weights[next];
+            if (!isfinite(stepCost)) {
                 continue;
             }
 
-            double newDistance = currentEntry.cost + costs(x, y) * dc[i];
-            if (newDistance < distances(x, y)) {
-                distances(x, y) = newDistance;
-                pq.push(PathfindingEntry(newDistance, Point2DI(x, y)));
+            float newCost = entry.first + stepCost * dc[i];
+            if (newCost < getCost(next)) {
+                costs[next] = newCost;
+                parents[next] = current;
+                versions[next] = version;
+                if (labels != nullptr)
+                    (*labels)[next] = (*labels)[current];
+                queue.push(newCost, next);
             }
         }
     }
-
-    // Clear queue (required as it is reused for the next pathfinding call)
-    while (!pq.empty())
-        pq.pop();
-    return distances;
+    return current;
 }
 
-/** Returns the shortest path between the start and end point.
+/** Returns a map of distances from the starting points.
+ * A point is considered a starting point if the element in the startingPoints map is non-zero.
  * The costs per cell are given by the costs map.
  * Diagonal movement costs sqrt(2) times more than axis aligned movement.
  */
-vector<Point2DI> getPath(const Point2DI from, const Point2DI to, const InfluenceMap& costs) {
-    static vector<vector<double> > cost(MAX_MAP_SIZE, vector<double>(MAX_MAP_SIZE));
-    static vector<vector<int> > version(MAX_MAP_SIZE, vector<int>(MAX_MAP_SIZE));
-    static vector<vector<Point2DI> > parent(MAX_MAP_SIZE, vector<Point2DI>(MAX_MAP_SIZE));
-    static priority_queue<PathfindingEntry> pq;
-    static int pathfindingVersion = 0;
-
-    int w = costs.w;
-    int h = costs.h;
-
-    // Make sure map is sane
-    assert(w <= MAX_MAP_SIZE);
-    assert(h <= MAX_MAP_SIZE);
-
-    pathfindingVersion++;
-
-    pq.push(PathfindingEntry(0.0, from));
-    cost[from.x][from.y] = 0;
-    version[from.x][from.y] = pathfindingVersion;
-    parent[from.x][from.y] = from;
-    bool reached = false;
-
-    while (!pq.empty()) {
-        auto currentEntry = pq.top();
-        auto currentPos = currentEntry.pos;
-        pq.pop();
-        if (currentEntry.cost > cost[currentPos.x][currentPos.y]) {
-            continue;
-        }
+InfluenceMap PathfindingContext::getDistances(const InfluenceMap& startingPoints, const InfluenceMap& costMap) {
+    assert(startingPoints.w == costMap.w);
+    assert(startingPoints.h == costMap.h);
 
-        if (currentEntry.pos == to) {
-            reached = true;
-            break;
-        }
+    prepare(costMap);
+    for (int i = 0; i < w * h; i++) {
+        if (startingPoints.weights[i] != 0)
+            addSource(i, 0, nullptr);
+    }
+    search(costMap, -1, -1, nullptr);
 
-        for (int i = 0; i < 8; i++) {
-            int x = currentPos.x + dx[i];
-            int y = currentPos.y + dy[i];
-            if (x < 0 || x >= w || y < 0 || y >= h) {
-                continue;
-            }
-            // TODO: sqrt can be optimized
-            double newCost = currentEntry.cost + costs(x, y) * dc[i];
-            if ((newCost < cost[x][y] || version[x][y] != pathfindingVersion) && isfinite(cost[x][y])) {
-                cost[x][y] = newCost;
-                parent[x][y] = currentPos;
-                version[x][y] = pathfindingVersion;
-                pq.push(PathfindingEntry(newCost, 0 /* abs(x - to.x) + abs(y - to.y) */, Point2DI(x, y)));
-            }
+    InfluenceMap distances(w, h);
+    for (int i = 0; i < w * h; i++)
+        distances.weights[i] = getCost(i);
+    return distances;
+}
+
+/** Returns a map of distances from the closest source.
+ * labels (optional) receives, for each cell, the index in sources of its closest source or -1 if no source can reach it.
+ * This replaces one search per source when only the closest one matters, for example to partition the map between bases.
+ */
+InfluenceMap PathfindingContext::getDistances(const vector<Point2DI>& sources, const InfluenceMap& costMap, vector<int>* labels) {
+    prepare(costMap);
+    if (labels != nullptr)
+        labels->assign(w * h, -1);
+    for (size_t i = 0; i < sources.size(); i++) {
+        assert(sources[i].x >= 0 && sources[i].x < w && sources[i].y >= 0 && sources[i].y < h);
+        addSource(sources[i].y * w + sources[i].x, (int)i, labels);
+    }
+    search(costMap, -1, -1, labels);
+
+    InfluenceMap distances(w, h);
+    for (int i = 0; i < w * h; i++)
+        distances.weights[i] = getCost(i);
+    return distances;
+}
+
+/** Returns the distance from the source to each of the targets (infinity if unreachable).
+ * The search stops as soon as every target is reached, so close targets are much cheaper than a full distance map.
+ */
+vector<float> PathfindingContext::getDistances(Point2DI source, const vector<Point2DI>& targets, const InfluenceMap& costMap) {
+    prepare(costMap);
+    int targetCount = 0;
+    for (auto& target : targets) {
+        assert(target.x >= 0 && target.x < w && target.y >= 0 && target.y < h);
+        int index = target.y * w + target.x;
+        if (targetVersions[index] != version) {
+            targetVersions[index] = version;
+            targetCount++;
         }
     }
+    addSource(source.y * w + source.x, 0, nullptr);
+    if (targetCount > 0)
+        search(costMap, -1, targetCount, nullptr);
 
-    // Clear queue (required as it is reused for the next pathfinding call)
-    while (!pq.empty())
-        pq.pop();
+    vector<float> distances(targets.size());
+    for (size_t i = 0; i < targets.size(); i++)
+        distances[i] = getCost(targets[i].y * w + targets[i].x);
+    return distances;
+}
 
-    if (!reached)
+/** Returns the shortest path between the start and end point.
+ * The costs per cell are given by the costs map.
+ * Diagonal movement costs sqrt(2) times more than axis aligned movement.
+ */
+vector<Point2DI> PathfindingContext::getPath(const Point2DI from, const Point2DI to, const InfluenceMap& costMap) {
+    prepare(costMap);
+    int start = from.y * w + from.x;
+    int goal = to.y * w + to.x;
+    addSource(start, 0, nullptr);
+    if (search(costMap, goal, -1, nullptr) != goal)
         return vector<Point2DI>();
 
-    Point2DI currentPos = to;
-    vector<Point2DI> path = { currentPos };
-    while (currentPos != from) {
-        auto p = parent[currentPos.x][currentPos.y];
-        path.push_back(p);
-        currentPos = p;
-    }
+    vector<Point2DI> path;
+    for (int current = goal; current != start; current = parents[current])
+        path.push_back(Point2DI(current % w, current / w));
+    path.push_back(from);
     reverse(path.begin(), path.end());
     return path;
-}
\ No newline at end of file
+}
+
+// Each thread gets its own scratch buffers so the searches can run concurrently
+static PathfindingContext& threadContext() {
+    static thread_local PathfindingContext context;
+    return context;
+}
+
+vector<Point2DI> getPath(const Point2DI from, const Point2DI to, const InfluenceMap& costs) {
+    return threadContext().getPath(from, to, costs);
+}
+
+InfluenceMap getDistances(const InfluenceMap& startingPoints, const InfluenceMap& costs) {
+    return threadContext().getDistances(startingPoints, costs);
+}
+
+InfluenceMap getDistances(const vector<Point2DI>& sources, const InfluenceMap& costs, vector<int>* labels) {
+    return threadContext().getDistances(sources, costs, labels);
+}
+
+vector<float> getDistances(const Point2DI source, const vector<Point2DI>& targets, const InfluenceMap& costs) {
+    return threadContext().getDistances(source, targets, costs);
+}
@@ -1,7 +1,71 @@
 #pragma once
 #include "influence.h"
 #include "sc2api/sc2_api.h"
+#include <cstdint>
+#include <limits>
+#include <queue>
 #include <vector>
 
+/** Priority queue of the grid searches.
+ * When the cell costs are positive and in a reasonable range, the keys are quantized in circular buckets of the width of the cheapest step,
+ * which keeps the search exact (a cell can not improve another cell of the same bucket) with constant time operations.
+ * Otherwise it falls back to a binary heap.
+ */
+class PathfindingQueue {
+    typedef std::pair<float, int> Entry;
+
+    struct EntryComparer {
+        bool operator()(const Entry& a, const Entry& b) const {
+            return a.first > b.first;
+        }
+    };
+
+    std::vector<std::vector<Entry>> buckets;
+    std::priority_queue<Entry, std::vector<Entry>, EntryComparer> heap;
+    float bucketWidth = 0;
+    int64_t currentBucket = 0;
+    size_t count = 0;
+    bool useBuckets = false;
+
+   public:
+    void reset(float minStepCost, float maxStepCost);
+    void push(float cost, int index);
+    Entry pop();
+    bool empty() const { return count == 0; }
+};
+
+/** Scratch state of the grid searches.
+ * A context can be reused for any number of searches on maps of any size but must only be used by one thread at a time.
+ * The free functions below use one context per thread.
+ */
+class PathfindingContext {
+    PathfindingQueue queue;
+    std::vector<float> costs;
+    std::vector<int> parents;
+    std::vector<uint32_t> versions;
+    std::vector<uint32_t> targetVersions;
+    uint32_t version = 0;
+    int w = 0, h = 0;
+
+    void prepare(const InfluenceMap& costMap);
+    float getCost(int index) const { return versions[index] == version ? costs[index] : std::numeric_limits<float>::infinity(); }
+    void addSource(int index, int label, std::vector<int>* labels);
+    int search(const InfluenceMap& costMap, int goal, int targetCount, std::vector<int>* labels);
+
+   public:
+    /** Distances from the non-zero cells of startingPoints to every cell */
+    InfluenceMap getDistances(const InfluenceMap& startingPoints, const InfluenceMap& costs);
+
+    /** Distances from the closest source to every cell. If labels is given, it receives the index of the closest source of every cell (-1 if unreachable) */
+    InfluenceMap getDistances(const std::vector<sc2::Point2DI>& sources, const InfluenceMap& costs, std::vector<int>* labels = nullptr);
+
+    /** Distances from the source to each target, the search stops as soon as all of the targets are reached */
+    std::vector<float> getDistances(sc2::Point2DI source, const std::vector<sc2::Point2DI>& targets, const InfluenceMap& costs);
+
+    std::vector<sc2::Point2DI> getPath(const sc2::Point2DI from, const sc2::Point2DI to, const InfluenceMap& costs);
+};
+
 std::vector<sc2::Point2DI> getPath (const sc2::Point2DI from, const sc2::Point2DI to, const InfluenceMap& costs);
-InfluenceMap getDistances (const InfluenceMap& startingPoints, const InfluenceMap& costs);
\ No newline at end of file
+InfluenceMap getDistances (const InfluenceMap& startingPoints, const InfluenceMap& costs);
+InfluenceMap getDistances (const std::vector<sc2::Point2DI>& sources, const InfluenceMap& costs, std::vector<int>* labels = nullptr);
+std::vector<float> getDistances (const sc2::Point2DI source, const std::vector<sc2::Point2DI>& targets, const InfluenceMap& costs);
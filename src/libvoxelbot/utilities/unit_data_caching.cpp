@@ -1,12 +1,10 @@
 #include "unit_data_caching.h"
-#include "../generated/units_data.h"
-#include "../generated/upgrades_data.h"
-#include "../generated/abilities_data.h"
+#include "unit_data_tables.h"
+#include "../generated/units_table.h"
+#include "../generated/upgrades_table.h"
+#include "../generated/abilities_table.h"
 #include <string>
-#include <sstream>
-#include <cereal/archives/binary.hpp>
-#include <cereal/types/string.hpp>
-#include "sc2_serialization.h"
+#include <cstdio>
 
 using namespace std;
 using namespace sc2;
@@ -69,11 +67,11 @@ void save_unit_data(const vector<UnitTypeData>& unit_types, string path) {
     stream.close();
 }
 
-std::vector<sc2::UnitTypeData> load_unit_data() {
-    // auto stream = ifstream(UNIT_DATA_CACHE_PATH);
-	auto stream = stringstream(string((char*)LIBVOXELBOT_DATA_UNITS, LIBVOXELBOT_DATA_UNITS_SIZE));
+// Parses a file written by save_unit_data. Only used by the caching program to verify the serialization.
+std::vector<sc2::UnitTypeData> load_unit_data(string path) {
+    auto stream = ifstream(path);
     if (!stream) {
-        cerr << "Could not open unit data cache file at " << UNIT_DATA_CACHE_PATH << endl;
+        cerr << "Could not open unit data cache file at " << path << endl;
         exit(1);
     }
     int nUnits;
@@ -150,154 +148,233 @@ std::vector<sc2::UnitTypeData> load_unit_data() {
         type.tech_requirement = (UNIT_TYPEID)tech_req;
         stream >> type.require_attached;
     }
-    //stream.close();
-
-    // Some sanity checks
-    assert(unit_types[(int)UNIT_TYPEID::ZERG_OVERLORD].food_provided == 8);
-    assert(unit_types[(int)UNIT_TYPEID::TERRAN_SCV].mineral_cost == 50);
-    assert(unit_types[(int)UNIT_TYPEID::ZERG_ROACH].ability_id == ABILITY_ID::TRAIN_ROACH);
+    stream.close();
     return unit_types;
 }
 
-struct SerializableAbility {
-    bool available;
-    int ability_id;
-    std::string link_name;
-    uint32_t link_index;
-    std::string button_name;
-    std::string friendly_name;
-    std::string hotkey;
-    uint32_t remaps_to_ability_id;
-    std::vector<uint32_t> remaps_from_ability_id;
-    AbilityData::Target target;
-    bool allow_minimap;
-    bool allow_autocast;
-    bool is_building;
-    float footprint_radius;
-    bool is_instant_placement;
-    float cast_range;
+// Formats a float so that it is parsed back to the exact same value
+static string table_float(float value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.9g", value);
+    string result = buffer;
+    if (result.find_first_of(".e") == string::npos) {
+        result += ".0";
+    }
+    return result + "f";
+}
 
-    template<class Archive>
-    void serialize(Archive & archive) {
-        archive(
-            available,
-            ability_id,
-            link_name,
-            link_index,
-            button_name,
-            friendly_name,
-            hotkey,
-            remaps_to_ability_id,
-            remaps_from_ability_id,
-            target,
-            allow_minimap,
-            allow_autocast,
-            is_building,
-            footprint_radius,
-            is_instant_placement,
-            cast_range
-        );
+static string table_string(const string& value) {
+    string result = "\"";
+    for (unsigned char c : value) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+        } else if (c < 32 || c > 126) {
+            char buffer[8];
+            snprintf(buffer, sizeof(buffer), "\\%03o", c);
+            result += buffer;
+        } else {
+            result += c;
+        }
     }
-};
+    return result + "\"";
+}
 
-void save_ability_data(vector<AbilityData> abilities) {
-    vector<SerializableAbility> abilities2;
-    for (auto& a : abilities) {
-        SerializableAbility a2;
+static string table_bool(bool value) {
+    return value ? "true" : "false";
+}
 
-        a2.available = a.available;
-        a2.ability_id = a.ability_id;
-        a2.link_name = a.link_name;
-        a2.link_index = a.link_index;
-        a2.button_name = a.button_name;
-        a2.friendly_name = a.friendly_name;
-        a2.hotkey = a.hotkey;
-        a2.remaps_to_ability_id = a.remaps_to_ability_id;
-        a2.remaps_from_ability_id = a.remaps_from_ability_id;
-        a2.target = a.target;
-        a2.allow_minimap = a.allow_minimap;
-        a2.allow_autocast = a.allow_autocast;
-        a2.is_building = a.is_building;
-        a2.footprint_radius = a.footprint_radius;
-        a2.is_instant_placement = a.is_instant_placement;
-        a2.cast_range = a.cast_range;
-        abilities2.push_back(a2);
-    }
+static void write_table_header(ofstream& stream, string generator) {
+    stream << "// Generated by " << generator << " in libvoxelbot/utilities/unit_data_caching.cpp, do not edit.\n";
+    stream << "#pragma once\n";
+    stream << "#include \"../utilities/unit_data_tables.h\"\n";
+}
 
-    std::ofstream file(ABILITY_DATA_CACHE_PATH, std::ios::binary);
-    {
-        cereal::BinaryOutputArchive archive(file);
-        archive(abilities2);
-		cout << "Serialize abilities" << endl;
+static void write_table(ofstream& stream, string type, string name, vector<string> rows) {
+    // Empty arrays are not allowed, the count fields of the records never reference the placeholder
+    if (rows.empty()) rows.push_back("0");
+    stream << "\nconst " << type << " " << name << "[] = {\n";
+    for (auto& row : rows) {
+        stream << "    " << row << ",\n";
     }
-    file.close();
+    stream << "};\n";
 }
 
-std::vector<sc2::AbilityData> load_ability_data() {
-	auto file = stringstream(string((char*)LIBVOXELBOT_DATA_ABILITIES, LIBVOXELBOT_DATA_ABILITIES_SIZE));
-    // std::ifstream file(ABILITY_DATA_CACHE_PATH, std::ios::binary);
-    if (!file) {
-        cerr << "Could not open unit data cache file at " << ABILITY_DATA_CACHE_PATH << endl;
-        exit(1);
-    }
+static void write_table_size(ofstream& stream, string name, size_t size) {
+    stream << "\nconst size_t " << name << "_SIZE = " << size << ";\n";
+}
+
+void save_unit_table(const vector<UnitTypeData>& unit_types, string path) {
+    vector<string> rows, attributes, weapons, damageBonuses, techAliases;
+    for (const UnitTypeData& type : unit_types) {
+        size_t attributesBegin = attributes.size();
+        for (auto a : type.attributes) attributes.push_back(to_string((int)a));
+
+        size_t weaponsBegin = weapons.size();
+        for (auto& w : type.weapons) {
+            size_t damageBonusBegin = damageBonuses.size();
+            for (auto& b : w.damage_bonus) {
+                damageBonuses.push_back("{ " + to_string((int)b.attribute) + ", " + table_float(b.bonus) + " }");
+            }
+            weapons.push_back("{ " + to_string((int)w.type) + ", " + table_float(w.damage_) + ", " + to_string(damageBonusBegin) + ", " + to_string(w.damage_bonus.size()) + ", " + to_string(w.attacks) + ", " + table_float(w.range) + ", " + table_float(w.speed) + " }");
+        }
 
-    vector<SerializableAbility> abilities2;
-    {
-        cereal::BinaryInputArchive archive(file);
-        archive(abilities2);
+        size_t techAliasBegin = techAliases.size();
+        for (auto a : type.tech_alias) techAliases.push_back(to_string((int)a));
+
+        rows.push_back("{ " + to_string((int)type.unit_type_id) + ", " + table_string(type.name) + ", " + table_bool(type.available) + ", "
+            + to_string(type.cargo_size) + ", " + to_string(type.mineral_cost) + ", " + to_string(type.vespene_cost) + ", "
+            + table_float(type.movement_speed) + ", " + table_float(type.armor) + ", " + table_float(type.food_required) + ", " + table_float(type.food_provided) + ", "
+            + to_string((int)type.ability_id) + ", " + to_string((int)type.race) + ", " + table_float(type.build_time) + ", "
+            + table_bool(type.has_minerals) + ", " + table_bool(type.has_vespene) + ", " + table_float(type.sight_range) + ", "
+            + to_string((int)type.unit_alias) + ", " + to_string((int)type.tech_requirement) + ", " + table_bool(type.require_attached) + ", "
+            + to_string(attributesBegin) + ", " + to_string(type.attributes.size()) + ", "
+            + to_string(weaponsBegin) + ", " + to_string(type.weapons.size()) + ", "
+            + to_string(techAliasBegin) + ", " + to_string(type.tech_alias.size()) + " }");
     }
-    //file.close();
 
-    vector<AbilityData> abilities;
-    for (auto& a : abilities2) {
-        AbilityData a2;
+    auto stream = ofstream(path);
+    write_table_header(stream, "save_unit_table");
+    write_table(stream, "UnitTypeRecord", "LIBVOXELBOT_TABLE_UNITS", rows);
+    write_table_size(stream, "LIBVOXELBOT_TABLE_UNITS", rows.size());
+    write_table(stream, "int", "LIBVOXELBOT_TABLE_UNIT_ATTRIBUTES", attributes);
+    write_table(stream, "WeaponRecord", "LIBVOXELBOT_TABLE_UNIT_WEAPONS", weapons);
+    write_table(stream, "DamageBonusRecord", "LIBVOXELBOT_TABLE_UNIT_DAMAGE_BONUSES", damageBonuses);
+    write_table(stream, "int", "LIBVOXELBOT_TABLE_UNIT_TECH_ALIASES", techAliases);
+    stream.close();
+}
 
-        a2.available = a.available;
-        a2.ability_id = a.ability_id;
-        a2.link_name = a.link_name;
-        a2.link_index = a.link_index;
-        a2.button_name = a.button_name;
-        a2.friendly_name = a.friendly_name;
-        a2.hotkey = a.hotkey;
-        a2.remaps_to_ability_id = a.remaps_to_ability_id;
-        a2.remaps_from_ability_id = a.remaps_from_ability_id;
-        a2.target = a.target;
-        a2.allow_minimap = a.allow_minimap;
-        a2.allow_autocast = a.allow_autocast;
-        a2.is_building = a.is_building;
-        a2.footprint_radius = a.footprint_radius;
-        a2.is_instant_placement = a.is_instant_placement;
-        a2.cast_range = a.cast_range;
-        abilities.push_back(a2);
+std::vector<sc2::UnitTypeData> load_unit_data() {
+    vector<UnitTypeData> unit_types(LIBVOXELBOT_TABLE_UNITS_SIZE);
+    for (size_t i = 0; i < LIBVOXELBOT_TABLE_UNITS_SIZE; i++) {
+        const UnitTypeRecord& record = LIBVOXELBOT_TABLE_UNITS[i];
+        UnitTypeData& type = unit_types[i];
+        type.unit_type_id = (UNIT_TYPEID)record.unit_type_id;
+        type.name = record.name;
+        type.available = record.available;
+        type.cargo_size = record.cargo_size;
+        type.mineral_cost = record.mineral_cost;
+        type.vespene_cost = record.vespene_cost;
+        type.attributes.reserve(record.attributes_count);
+        for (int j = 0; j < record.attributes_count; j++) {
+            type.attributes.push_back((Attribute)LIBVOXELBOT_TABLE_UNIT_ATTRIBUTES[record.attributes_begin + j]);
+        }
+        type.movement_speed = record.movement_speed;
+        type.armor = record.armor;
+        type.weapons.resize(record.weapons_count);
+        for (int j = 0; j < record.weapons_count; j++) {
+            const WeaponRecord& weaponRecord = LIBVOXELBOT_TABLE_UNIT_WEAPONS[record.weapons_begin + j];
+            Weapon& w = type.weapons[j];
+            w.type = (Weapon::TargetType)weaponRecord.type;
+            w.damage_ = weaponRecord.damage;
+            w.damage_bonus.resize(weaponRecord.damage_bonus_count);
+            for (int k = 0; k < weaponRecord.damage_bonus_count; k++) {
+                const DamageBonusRecord& bonusRecord = LIBVOXELBOT_TABLE_UNIT_DAMAGE_BONUSES[weaponRecord.damage_bonus_begin + k];
+                w.damage_bonus[k].attribute = (Attribute)bonusRecord.attribute;
+                w.damage_bonus[k].bonus = bonusRecord.bonus;
+            }
+            w.attacks = weaponRecord.attacks;
+            w.range = weaponRecord.range;
+            w.speed = weaponRecord.speed;
+        }
+        type.food_required = record.food_required;
+        type.food_provided = record.food_provided;
+        type.ability_id = (ABILITY_ID)record.ability_id;
+        type.race = (Race)record.race;
+        type.build_time = record.build_time;
+        type.has_minerals = record.has_minerals;
+        type.has_vespene = record.has_vespene;
+        type.sight_range = record.sight_range;
+        type.tech_alias.reserve(record.tech_alias_count);
+        for (int j = 0; j < record.tech_alias_count; j++) {
+            type.tech_alias.push_back((UNIT_TYPEID)LIBVOXELBOT_TABLE_UNIT_TECH_ALIASES[record.tech_alias_begin + j]);
+        }
+        type.unit_alias = (UNIT_TYPEID)record.unit_alias;
+        type.tech_requirement = (UNIT_TYPEID)record.tech_requirement;
+        type.require_attached = record.require_attached;
     }
 
-    return abilities;
+    // Some sanity checks
+    assert(unit_types[(int)UNIT_TYPEID::ZERG_OVERLORD].food_provided == 8);
+    assert(unit_types[(int)UNIT_TYPEID::TERRAN_SCV].mineral_cost == 50);
+    assert(unit_types[(int)UNIT_TYPEID::ZERG_ROACH].ability_id == ABILITY_ID::TRAIN_ROACH);
+    return unit_types;
 }
 
-void save_upgrade_data(vector<UpgradeData> upgrades) {
-    std::ofstream file(UPGRADE_DATA_CACHE_PATH, std::ios::binary);
-    {
-        cereal::BinaryOutputArchive archive(file);
-        archive(upgrades);
-		cout << "Serialize upgrades" << endl;
+void save_ability_table(const vector<AbilityData>& abilities, string path) {
+    vector<string> rows, remapsFrom;
+    for (auto& a : abilities) {
+        size_t remapsFromBegin = remapsFrom.size();
+        for (auto id : a.remaps_from_ability_id) remapsFrom.push_back(to_string(id));
+
+        rows.push_back("{ " + table_bool(a.available) + ", " + to_string((int)a.ability_id) + ", " + table_string(a.link_name) + ", " + to_string(a.link_index) + ", "
+            + table_string(a.button_name) + ", " + table_string(a.friendly_name) + ", " + table_string(a.hotkey) + ", "
+            + to_string(a.remaps_to_ability_id) + ", " + to_string(remapsFromBegin) + ", " + to_string(a.remaps_from_ability_id.size()) + ", "
+            + to_string((int)a.target) + ", " + table_bool(a.allow_minimap) + ", " + table_bool(a.allow_autocast) + ", " + table_bool(a.is_building) + ", "
+            + table_float(a.footprint_radius) + ", " + table_bool(a.is_instant_placement) + ", " + table_float(a.cast_range) + " }");
     }
-    file.close();
+
+    auto stream = ofstream(path);
+    write_table_header(stream, "save_ability_table");
+    write_table(stream, "AbilityRecord", "LIBVOXELBOT_TABLE_ABILITIES", rows);
+    write_table_size(stream, "LIBVOXELBOT_TABLE_ABILITIES", rows.size());
+    write_table(stream, "int", "LIBVOXELBOT_TABLE_ABILITY_REMAPS_FROM", remapsFrom);
+    stream.close();
 }
 
+std::vector<sc2::AbilityData> load_ability_data() {
+    vector<AbilityData> abilities(LIBVOXELBOT_TABLE_ABILITIES_SIZE);
+    for (size_t i = 0; i < LIBVOXELBOT_TABLE_ABILITIES_SIZE; i++) {
+        const AbilityRecord& record = LIBVOXELBOT_TABLE_ABILITIES[i];
+        AbilityData& a = abilities[i];
+        a.available = record.available;
+        a.ability_id = record.ability_id;
+        a.link_name = record.link_name;
+        a.link_index = record.link_index;
+        a.button_name = record.button_name;
+        a.friendly_name = record.friendly_name;
+        a.hotkey = record.hotkey;
+        a.remaps_to_ability_id = record.remaps_to_ability_id;
+        a.remaps_from_ability_id.reserve(record.remaps_from_ability_id_count);
+        for (int j = 0; j < record.remaps_from_ability_id_count; j++) {
+            a.remaps_from_ability_id.push_back(LIBVOXELBOT_TABLE_ABILITY_REMAPS_FROM[record.remaps_from_ability_id_begin + j]);
+        }
+        a.target = (AbilityData::Target)record.target;
+        a.allow_minimap = record.allow_minimap;
+        a.allow_autocast = record.allow_autocast;
+        a.is_building = record.is_building;
+        a.footprint_radius = record.footprint_radius;
+        a.is_instant_placement = record.is_instant_placement;
+        a.cast_range = record.cast_range;
+    }
+    return abilities;
+}
 
-std::vector<sc2::UpgradeData> load_upgrade_data() {
-	auto file = stringstream(string((char*)LIBVOXELBOT_DATA_UPGRADES, LIBVOXELBOT_DATA_UPGRADES_SIZE));
-    // std::ifstream file(UPGRADE_DATA_CACHE_PATH, std::ios::binary);
-    if (!file) {
-        cerr << "Could not open upgrade data cache file at " << UPGRADE_DATA_CACHE_PATH << endl;
-        exit(1);
+void save_upgrade_table(const vector<UpgradeData>& upgrades, string path) {
+    vector<string> rows;
+    for (auto& u : upgrades) {
+        rows.push_back("{ " + to_string(u.upgrade_id) + ", " + table_string(u.name) + ", " + to_string(u.mineral_cost) + ", " + to_string(u.vespene_cost) + ", "
+            + to_string((int)u.ability_id) + ", " + table_float(u.research_time) + " }");
     }
 
-    vector<sc2::UpgradeData> upgrades;
-    {
-        cereal::BinaryInputArchive archive(file);
-        archive(upgrades);
+    auto stream = ofstream(path);
+    write_table_header(stream, "save_upgrade_table");
+    write_table(stream, "UpgradeRecord", "LIBVOXELBOT_TABLE_UPGRADES", rows);
+    write_table_size(stream, "LIBVOXELBOT_TABLE_UPGRADES", rows.size());
+    stream.close();
+}
+
+std::vector<sc2::UpgradeData> load_upgrade_data() {
+    vector<UpgradeData> upgrades(LIBVOXELBOT_TABLE_UPGRADES_SIZE);
+    for (size_t i = 0; i < LIBVOXELBOT_TABLE_UPGRADES_SIZE; i++) {
+        const UpgradeRecord& record = LIBVOXELBOT_TABLE_UPGRADES[i];
+        UpgradeData& u = upgrades[i];
+        u.upgrade_id = record.upgrade_id;
+        u.name = record.name;
+        u.mineral_cost = record.mineral_cost;
+        u.vespene_cost = record.vespene_cost;
+        u.ability_id = (ABILITY_ID)record.ability_id;
+        u.research_time = record.research_time;
     }
-    //file.close();
     return upgrades;
 }
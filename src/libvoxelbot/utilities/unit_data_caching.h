@@ -3,13 +3,18 @@
 #include <fstream>
 #include <vector>
 
+// The unit, ability and upgrade data is compiled in as static tables so it is available without any parsing.
+// The tables are generated by the caching program (libvoxelbot/caching/caching.cpp) from the data of a running game.
 const std::string UNIT_DATA_CACHE_PATH = "sc2-libvoxelbot/libvoxelbot/generated/units.data";
-const std::string UPGRADE_DATA_CACHE_PATH = "sc2-libvoxelbot/libvoxelbot/generated/upgrades.bin";
-const std::string ABILITY_DATA_CACHE_PATH = "sc2-libvoxelbot/libvoxelbot/generated/abilities.bin";
+const std::string UNIT_TABLE_PATH = "sc2-libvoxelbot/libvoxelbot/generated/units_table.h";
+const std::string UPGRADE_TABLE_PATH = "sc2-libvoxelbot/libvoxelbot/generated/upgrades_table.h";
+const std::string ABILITY_TABLE_PATH = "sc2-libvoxelbot/libvoxelbot/generated/abilities_table.h";
 
 void save_unit_data(const std::vector<sc2::UnitTypeData>& unit_types, std::string path=UNIT_DATA_CACHE_PATH);
+std::vector<sc2::UnitTypeData> load_unit_data(std::string path);
+void save_unit_table(const std::vector<sc2::UnitTypeData>& unit_types, std::string path=UNIT_TABLE_PATH);
+void save_ability_table(const std::vector<sc2::AbilityData>& abilities, std::string path=ABILITY_TABLE_PATH);
+void save_upgrade_table(const std::vector<sc2::UpgradeData>& upgrades, std::string path=UPGRADE_TABLE_PATH);
 std::vector<sc2::UnitTypeData> load_unit_data();
-void save_ability_data(std::vector<sc2::AbilityData> abilities);
-void save_upgrade_data(std::vector<sc2::UpgradeData> upgrades);
 std::vector<sc2::AbilityData> load_ability_data();
 std::vector<sc2::UpgradeData> load_upgrade_data();
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Plain records of the static game data tables generated by unit_data_caching.cpp.
+// Variable length fields are stored as [begin, begin + count) ranges into flat arrays.
+
+struct DamageBonusRecord {
+    int attribute;
+    float bonus;
+};
+
+struct WeaponRecord {
+    int type;
+    float damage;
+    int damage_bonus_begin;
+    int damage_bonus_count;
+    int attacks;
+    float range;
+    float speed;
+};
+
+struct UnitTypeRecord {
+    int unit_type_id;
+    const char* name;
+    bool available;
+    int cargo_size;
+    int mineral_cost;
+    int vespene_cost;
+    float movement_speed;
+    float armor;
+    float food_required;
+    float food_provided;
+    int ability_id;
+    int race;
+    float build_time;
+    bool has_minerals;
+    bool has_vespene;
+    float sight_range;
+    int unit_alias;
+    int tech_requirement;
+    bool require_attached;
+    int attributes_begin;
+    int attributes_count;
+    int weapons_begin;
+    int weapons_count;
+    int tech_alias_begin;
+    int tech_alias_count;
+};
+
+struct AbilityRecord {
+    bool available;
+    int ability_id;
+    const char* link_name;
+    uint32_t link_index;
+    const char* button_name;
+    const char* friendly_name;
+    const char* hotkey;
+    uint32_t remaps_to_ability_id;
+    int remaps_from_ability_id_begin;
+    int remaps_from_ability_id_count;
+    int target;
+    bool allow_minimap;
+    bool allow_autocast;
+    bool is_building;
+    float footprint_radius;
+    bool is_instant_placement;
+    float cast_range;
+};
+
+struct UpgradeRecord {
+    uint32_t upgrade_id;
+    const char* name;
+    uint32_t mineral_cost;
+    uint32_t vespene_cost;
+    int ability_id;
+    float research_time;
+};
@@ -0,0 +1,174 @@
+// Tests of the wall solver on tile fixtures of main ramps, built by the wall_solver_tests CMake target. They do not need a running game.
+// The fixture is the standard main ramp of the ladder maps in its four orientations, the two mains of a map have opposite orientations.
+// Usage: wall_solver_tests, it prints the nodes and the time of each search and returns 1 if a test failed
+#include "../WallSolver.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// '#' blocked, 'H' buildable tile of the main, 'r' ramp, '.' walkable low ground. The first row is the top of the map.
+	const std::vector<std::string> StandardRamp =
+	{
+		"HHHHHHHHHHHHHH#######",
+		"HHHHHHHHHHHHHH#######",
+		"HHHHHHHHHHHHHH#######",
+		"HHHHHHHHHHHHH########",
+		"HHHHHHHHHHHH#########",
+		"HHHHHHHHHHH##########",
+		"HHHHHHHHHrr##########",
+		"HHHHHHHHrrrr#########",
+		"HHHHHHHrrrrrr########",
+		"HHHHHH#rrrrrrr#######",
+		"HHHHH###rrrrrrr......",
+		"HHHH#####rrrrr.......",
+		"HHH#######rrr........",
+		"HH#########r.........",
+		"H###########.........",
+		"#############........",
+	};
+
+	// Same ramp with a top twice as wide, a barracks and two supply depots cannot close it
+	const std::vector<std::string> WideRamp =
+	{
+		"HHHHHHHHHHHHHHHH#######",
+		"HHHHHHHHHHHHHHHH#######",
+		"HHHHHHHHHHHHHHHH#######",
+		"HHHHHHHHHHHHHHH########",
+		"HHHHHHHHHHHHHH#########",
+		"HHHHHHHHHHHHH##########",
+		"HHHHHHHHHHHrr##########",
+		"HHHHHHHHHHrrrr#########",
+		"HHHHHHHHHrrrrrr########",
+		"HHHHHHHHrrrrrrr########",
+		"HHHHHHHrrrrrrrr########",
+		"HHHHHHrrrrrrrrrr#######",
+		"HHHHH#rrrrrrrrrrr......",
+		"HHHH###rrrrrrrrr.......",
+		"HHH#####rrrrrrr........",
+		"HH#######rrrrr.........",
+		"H#########rrr..........",
+		"###########r...........",
+		"############...........",
+	};
+
+	const WallFootprint Barracks = { 3, true };
+	const WallFootprint BarracksWithoutAddon = { 3, false };
+	const WallFootprint SupplyDepot = { 2, false };
+	const CCTilePosition Origin(40, 60);
+
+	std::vector<std::string> Mirror(std::vector<std::string> rows, bool mirrorX, bool mirrorY)
+	{
+		if (mirrorX)
+		{
+			for (auto & row : rows)
+				std::reverse(row.begin(), row.end());
+		}
+		if (mirrorY)
+			std::reverse(rows.begin(), rows.end());
+		return rows;
+	}
+
+	// Sets the tiles the way BuildingManager::PlaceWallBuildings does with the regions of the map
+	WallSolver MakeSolver(const std::vector<std::string> & rows)
+	{
+		const int width = int(rows.front().size());
+		const int height = int(rows.size());
+		const auto getTile = [&rows, width, height](int x, int y)
+		{
+			return x >= 0 && y >= 0 && x < width && y < height ? rows[height - 1 - y][x] : '#';
+		};
+
+		WallSolver solver(Origin, width, height);
+		for (int y = 0; y < height; ++y)
+		{
+			for (int x = 0; x < width; ++x)
+			{
+				const auto tile = CCTilePosition(Origin.x + x, Origin.y + y);
+				const char type = getTile(x, y);
+				if (type == '#')
+					continue;
+				solver.setTile(tile, type == 'H' ? WallSolver::TileType::Buildable : WallSolver::TileType::Walkable);
+				if (type == 'H' && (x == 0 || y == 0 || x == width - 1 || y == height - 1))
+					solver.addInsideTile(tile);
+				if (type != 'r')
+					continue;
+				solver.addOutsideTile(tile);
+				for (const auto & neighbor : { CCTilePosition(x + 1, y), CCTilePosition(x - 1, y), CCTilePosition(x, y + 1), CCTilePosition(x, y - 1) })
+				{
+					if (getTile(neighbor.x, neighbor.y) == 'H')
+						solver.addTargetTile(CCTilePosition(Origin.x + neighbor.x, Origin.y + neighbor.y));
+				}
+			}
+		}
+		return solver;
+	}
+
+	std::string ToString(const std::vector<CCTilePosition> & positions)
+	{
+		std::string text;
+		for (const auto & position : positions)
+			text += "(" + std::to_string(position.x - Origin.x) + "," + std::to_string(position.y - Origin.y) + ") ";
+		return text;
+	}
+
+	int failures = 0;
+
+	// An empty list of expected positions means that no wall should be found
+	void Test(const std::string & name, const WallSolver & solver, const std::vector<WallFootprint> & footprints, const std::vector<CCTilePosition> & expectedPositions)
+	{
+		WallSolution solution;
+		const auto start = std::chrono::steady_clock::now();
+		const bool found = solver.solve(footprints, 0, solution);
+		const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		std::vector<CCTilePosition> expected;
+		for (const auto & position : expectedPositions)
+			expected.push_back(CCTilePosition(Origin.x + position.x, Origin.y + position.y));
+		const bool passed = !solution.truncated && (expected.empty() ? !found : found && solution.gap == 0 && solution.positions == expected);
+		if (!passed)
+			++failures;
+
+		std::cout << (passed ? "PASS " : "FAIL ") << name << ": " << (found ? "wall " + ToString(solution.positions) : std::string("no wall "))
+			<< "nodes " << solution.nodes << ", gaps computed " << solution.gapComputations << (solution.truncated ? " (truncated)" : "")
+			<< ", " << ms << " ms" << std::endl;
+		if (!passed)
+			std::cout << "    expected " << (expected.empty() ? std::string("no wall") : ToString(expected)) << std::endl;
+	}
+}
+
+int main()
+{
+	const std::vector<WallFootprint> barracksWall = { Barracks, SupplyDepot, SupplyDepot };
+	const std::vector<WallFootprint> barracksWithoutAddonWall = { BarracksWithoutAddon, SupplyDepot, SupplyDepot };
+	const std::vector<WallFootprint> supplyDepotWall = { SupplyDepot, SupplyDepot, SupplyDepot };
+
+	// Bottom left tile of each footprint, relative to the bottom left of the fixture. The addon of the barracks does not fit next to the bottom right ramp.
+	const auto bottomRight = MakeSolver(Mirror(StandardRamp, false, false));
+	Test("bottom right ramp, barracks", bottomRight, barracksWall, {});
+	Test("bottom right ramp, barracks without addon", bottomRight, barracksWithoutAddonWall, { { 6, 9 }, { 9, 10 }, { 5, 7 } });
+	Test("bottom right ramp, supply depots", bottomRight, supplyDepotWall, { { 7, 9 }, { 9, 10 }, { 5, 7 } });
+
+	const auto bottomLeft = MakeSolver(Mirror(StandardRamp, true, false));
+	Test("bottom left ramp, barracks", bottomLeft, barracksWall, { { 12, 9 }, { 10, 10 }, { 14, 7 } });
+	Test("bottom left ramp, supply depots", bottomLeft, supplyDepotWall, { { 12, 9 }, { 10, 10 }, { 14, 7 } });
+
+	const auto topRight = MakeSolver(Mirror(StandardRamp, false, true));
+	Test("top right ramp, barracks", topRight, barracksWall, { { 8, 2 }, { 7, 5 }, { 5, 7 } });
+	Test("top right ramp, supply depots", topRight, supplyDepotWall, { { 7, 5 }, { 9, 4 }, { 5, 7 } });
+
+	const auto topLeft = MakeSolver(Mirror(StandardRamp, true, true));
+	Test("top left ramp, barracks", topLeft, barracksWall, { { 12, 4 }, { 10, 4 }, { 14, 7 } });
+	Test("top left ramp, supply depots", topLeft, supplyDepotWall, { { 12, 5 }, { 10, 4 }, { 14, 7 } });
+
+	const auto wide = MakeSolver(WideRamp);
+	Test("wide ramp, barracks", wide, barracksWall, {});
+	Test("wide ramp, barracks without addon", wide, barracksWithoutAddonWall, {});
+	Test("wide ramp, supply depots", wide, supplyDepotWall, {});
+
+	std::cout << (failures == 0 ? "All the tests passed" : std::to_string(failures) + " tests failed") << std::endl;
+	return failures == 0 ? 0 : 1;
+}